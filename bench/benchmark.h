@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+namespace bench {
+
+/**
+ * Controls the measured loop of a single benchmark run. Setup code preceding
+ * the first call to keepRunning is not measured.
+ */
+class State : boost::noncopyable {
+public:
+    State(int64_t numIterations) :
+        _numIterations(numIterations) {
+    }
+
+    inline bool keepRunning() {
+        if (_iteration == 0) {
+            _start = std::chrono::steady_clock::now();
+        }
+        if (_iteration == _numIterations) {
+            _end = std::chrono::steady_clock::now();
+            return false;
+        }
+        ++_iteration;
+        return true;
+    }
+
+    /**
+     * Number of bytes consumed by a single iteration, used to report throughput.
+     */
+    void setBytesPerIteration(int64_t bytes) {
+        _bytesPerIteration = bytes;
+    }
+
+    /**
+     * Number of items (e.g. instructions, faces) processed by a single iteration.
+     */
+    void setItemsPerIteration(int64_t items) {
+        _itemsPerIteration = items;
+    }
+
+    int64_t numIterations() const { return _numIterations; }
+    int64_t bytesPerIteration() const { return _bytesPerIteration; }
+    int64_t itemsPerIteration() const { return _itemsPerIteration; }
+
+    std::chrono::nanoseconds elapsed() const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(_end - _start);
+    }
+
+private:
+    int64_t _numIterations;
+    int64_t _iteration {0};
+    int64_t _bytesPerIteration {0};
+    int64_t _itemsPerIteration {0};
+
+    std::chrono::steady_clock::time_point _start;
+    std::chrono::steady_clock::time_point _end;
+};
+
+using BenchmarkFunc = std::function<void(State &)>;
+
+struct Benchmark {
+    std::string name;
+    BenchmarkFunc func;
+};
+
+std::vector<Benchmark> &benchmarks();
+
+inline bool registerBenchmark(std::string name, BenchmarkFunc func) {
+    benchmarks().push_back(Benchmark {std::move(name), std::move(func)});
+    return true;
+}
+
+/**
+ * Prevents the compiler from optimizing away a computed value by letting its
+ * address escape through a volatile sink.
+ */
+template <class T>
+inline void doNotOptimize(const T &value) {
+    static const void *volatile sink;
+    sink = &value;
+}
+
+} // namespace bench
+
+} // namespace reone
+
+#define BENCHMARK(suite, name)                                                                                       \
+    static void suite##_##name(reone::bench::State &state);                                                          \
+    static const bool suite##_##name##_registered = reone::bench::registerBenchmark(#suite "." #name, suite##_##name); \
+    static void suite##_##name(reone::bench::State &state)
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "reone/system/binarywriter.h"
+#include "reone/system/stream/memoryoutput.h"
+
+namespace reone {
+
+namespace graphics {
+
+/**
+ * Generates an area walkmesh (WOK) covering a gridSize x gridSize square of
+ * unit cells, two walkable triangles per cell, with a median-split AABB tree.
+ */
+inline ByteBuffer newGridWalkmeshBytes(int gridSize, uint32_t material = 1) {
+    struct AabbNode {
+        glm::vec3 min {0.0f};
+        glm::vec3 max {0.0f};
+        int faceIdx {-1};
+        uint32_t left {0};
+        uint32_t right {0};
+    };
+
+    auto vertices = std::vector<glm::vec3>();
+    for (int y = 0; y <= gridSize; ++y) {
+        for (int x = 0; x <= gridSize; ++x) {
+            float z = 0.1f * static_cast<float>((x + y) % 3);
+            vertices.push_back(glm::vec3(static_cast<float>(x), static_cast<float>(y), z));
+        }
+    }
+    auto indices = std::vector<uint32_t>();
+    for (int y = 0; y < gridSize; ++y) {
+        for (int x = 0; x < gridSize; ++x) {
+            uint32_t v00 = y * (gridSize + 1) + x;
+            uint32_t v10 = v00 + 1;
+            uint32_t v01 = v00 + gridSize + 1;
+            uint32_t v11 = v01 + 1;
+            indices.insert(indices.end(), {v00, v10, v11, v00, v11, v01});
+        }
+    }
+    int numFaces = static_cast<int>(indices.size() / 3);
+
+    auto faceMin = [&](int face) {
+        return glm::min(glm::min(vertices[indices[3 * face + 0]], vertices[indices[3 * face + 1]]), vertices[indices[3 * face + 2]]);
+    };
+    auto faceMax = [&](int face) {
+        return glm::max(glm::max(vertices[indices[3 * face + 0]], vertices[indices[3 * face + 1]]), vertices[indices[3 * face + 2]]);
+    };
+
+    auto nodes = std::vector<AabbNode>();
+    auto faces = std::vector<int>();
+    for (int i = 0; i < numFaces; ++i) {
+        faces.push_back(i);
+    }
+    std::function<uint32_t(int, int, int)> buildNode = [&](int begin, int end, int axis) {
+        auto nodeIdx = static_cast<uint32_t>(nodes.size());
+        nodes.push_back(AabbNode());
+        auto min = glm::vec3(std::numeric_limits<float>::max());
+        auto max = glm::vec3(std::numeric_limits<float>::lowest());
+        for (int i = begin; i < end; ++i) {
+            min = glm::min(min, faceMin(faces[i]));
+            max = glm::max(max, faceMax(faces[i]));
+        }
+        nodes[nodeIdx].min = min;
+        nodes[nodeIdx].max = max;
+        if (end - begin == 1) {
+            nodes[nodeIdx].faceIdx = faces[begin];
+            return nodeIdx;
+        }
+        int mid = (begin + end) / 2;
+        std::nth_element(faces.begin() + begin, faces.begin() + mid, faces.begin() + end, [&](int l, int r) {
+            return (faceMin(l) + faceMax(l))[axis] < (faceMin(r) + faceMax(r))[axis];
+        });
+        uint32_t left = buildNode(begin, mid, 1 - axis);
+        uint32_t right = buildNode(mid, end, 1 - axis);
+        nodes[nodeIdx].left = left;
+        nodes[nodeIdx].right = right;
+        return nodeIdx;
+    };
+    buildNode(0, numFaces, 0);
+
+    static constexpr uint32_t kHeaderSize = 136;
+    uint32_t offVertices = kHeaderSize;
+    uint32_t offIndices = offVertices + 12 * static_cast<uint32_t>(vertices.size());
+    uint32_t offMaterials = offIndices + 12 * numFaces;
+    uint32_t offNormals = offMaterials + 4 * numFaces;
+    uint32_t offAabb = offNormals + 12 * numFaces;
+
+    auto bytes = ByteBuffer();
+    auto stream = MemoryOutputStream(bytes);
+    auto writer = BinaryWriter(stream);
+    writer.writeString("BWM V1.0");
+    writer.writeUint32(1);      // type
+    writer.write(4 * 3 * 4, 0); // use positions
+    writer.write(3 * 4, 0);     // position
+    writer.writeUint32(static_cast<uint32_t>(vertices.size()));
+    writer.writeUint32(offVertices);
+    writer.writeUint32(numFaces);
+    writer.writeUint32(offIndices);
+    writer.writeUint32(offMaterials);
+    writer.writeUint32(offNormals);
+    writer.writeUint32(0); // offset to planar distances
+    writer.writeUint32(static_cast<uint32_t>(nodes.size()));
+    writer.writeUint32(offAabb);
+    writer.write(7 * 4, 0); // unknown, adjacencies, edges, perimeters
+    for (auto &vertex : vertices) {
+        writer.writeFloat(vertex.x);
+        writer.writeFloat(vertex.y);
+        writer.writeFloat(vertex.z);
+    }
+    for (auto index : indices) {
+        writer.writeUint32(index);
+    }
+    for (int i = 0; i < numFaces; ++i) {
+        writer.writeUint32(material);
+    }
+    for (int i = 0; i < numFaces; ++i) {
+        writer.writeFloat(0.0f);
+        writer.writeFloat(0.0f);
+        writer.writeFloat(1.0f);
+    }
+    for (auto &node : nodes) {
+        writer.writeFloat(node.min.x);
+        writer.writeFloat(node.min.y);
+        writer.writeFloat(node.min.z);
+        writer.writeFloat(node.max.x);
+        writer.writeFloat(node.max.y);
+        writer.writeFloat(node.max.z);
+        writer.writeInt32(node.faceIdx);
+        writer.writeUint32(0); // unknown
+        writer.writeUint32(0); // most significant plane
+        writer.writeUint32(node.left);
+        writer.writeUint32(node.right);
+    }
+    return bytes;
+}
+
+} // namespace graphics
+
+} // namespace reone
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/game/pathfinder.h"
+
+#include "../benchmark.h"
+
+using namespace reone;
+using namespace reone::game;
+
+static constexpr int kGridSize = 32;
+
+/**
+ * Path points on a kGridSize x kGridSize lattice, four-connected.
+ */
+static std::vector<Path::Point> newGridPoints() {
+    auto points = std::vector<Path::Point>();
+    for (int y = 0; y < kGridSize; ++y) {
+        for (int x = 0; x < kGridSize; ++x) {
+            auto point = Path::Point();
+            point.x = static_cast<float>(x);
+            point.y = static_cast<float>(y);
+            if (x > 0) {
+                point.adjPoints.push_back(y * kGridSize + x - 1);
+            }
+            if (x < kGridSize - 1) {
+                point.adjPoints.push_back(y * kGridSize + x + 1);
+            }
+            if (y > 0) {
+                point.adjPoints.push_back((y - 1) * kGridSize + x);
+            }
+            if (y < kGridSize - 1) {
+                point.adjPoints.push_back((y + 1) * kGridSize + x);
+            }
+            points.push_back(std::move(point));
+        }
+    }
+    return points;
+}
+
+BENCHMARK(pathfinder, find_path_across_grid) {
+    auto pathfinder = Pathfinder();
+    auto points = newGridPoints();
+    auto pointZ = std::unordered_map<int, float>();
+    for (int i = 0; i < static_cast<int>(points.size()); ++i) {
+        pointZ[i] = 0.0f;
+    }
+    pathfinder.load(points, pointZ);
+    float far = static_cast<float>(kGridSize - 1);
+    state.setItemsPerIteration(1);
+
+    while (state.keepRunning()) {
+        auto path = pathfinder.findPath(glm::vec3(0.0f), glm::vec3(far, far, 0.0f));
+        bench::doNotOptimize(path);
+    }
+}
@@ -0,0 +1,340 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/graphics/format/bwmreader.h"
+#include "reone/graphics/format/mdlmdxreader.h"
+#include "reone/graphics/format/tpcreader.h"
+#include "reone/graphics/model.h"
+#include "reone/system/binarywriter.h"
+#include "reone/system/stream/memoryinput.h"
+#include "reone/system/stream/memoryoutput.h"
+
+#include "../../test/fixtures/graphics.h"
+
+#include "../benchmark.h"
+#include "../fixtures/graphics.h"
+
+using namespace reone;
+using namespace reone::graphics;
+
+static constexpr uint32_t kMdlDataOffset = 12;
+static constexpr uint32_t kMdlNodeSize = 80;
+static constexpr uint32_t kMdlMeshSize = 332;
+static constexpr uint32_t kMdlFaceSize = 32;
+static constexpr uint32_t kMdxVertexSize = 8 * sizeof(float);
+
+struct ModelBytes {
+    ByteBuffer mdl;
+    ByteBuffer mdx;
+};
+
+/**
+ * Generates a model with a root node and numChildren trimesh children, each of
+ * which has numGrandChildren dummy children of its own. Every trimesh is a flat
+ * grid of meshGridSize x meshGridSize quads with position, normal and UV data in
+ * the MDX.
+ */
+static ModelBytes newModelBytes(int numChildren, int numGrandChildren, int meshGridSize) {
+    int numNodes = 1 + numChildren * (1 + numGrandChildren);
+    int numMeshVertices = (meshGridSize + 1) * (meshGridSize + 1);
+    int numMeshFaces = 2 * meshGridSize * meshGridSize;
+
+    auto names = std::vector<std::string>();
+    for (int i = 0; i < numNodes; ++i) {
+        names.push_back("node" + std::to_string(i));
+    }
+
+    // Data layout: headers, name offsets, names, nodes with trailing child
+    // offsets, then faces and indices of every mesh
+    uint32_t offNameOffsets = 80 + 116;
+    uint32_t offNames = offNameOffsets + 4 * numNodes;
+    auto nameOffsets = std::vector<uint32_t>();
+    uint32_t offNodes = offNames;
+    for (auto &name : names) {
+        nameOffsets.push_back(offNodes);
+        offNodes += static_cast<uint32_t>(name.size()) + 1;
+    }
+
+    struct NodeLayout {
+        uint32_t offset {0};
+        std::vector<uint16_t> children;
+        bool mesh {false};
+        uint32_t offFaces {0};
+        uint32_t offIndicesOffset {0};
+        uint32_t offIndices {0};
+        uint32_t offMdxData {0};
+    };
+    auto nodes = std::vector<NodeLayout>(numNodes);
+    for (int i = 0; i < numChildren; ++i) {
+        uint16_t child = 1 + i * (1 + numGrandChildren);
+        nodes[0].children.push_back(child);
+        nodes[child].mesh = true;
+        for (int j = 0; j < numGrandChildren; ++j) {
+            nodes[child].children.push_back(child + 1 + j);
+        }
+    }
+    uint32_t offset = offNodes;
+    for (auto &node : nodes) {
+        node.offset = offset;
+        offset += kMdlNodeSize + (node.mesh ? kMdlMeshSize : 0) + 4 * static_cast<uint32_t>(node.children.size());
+    }
+    uint32_t offMdx = 0;
+    for (auto &node : nodes) {
+        if (!node.mesh) {
+            continue;
+        }
+        node.offFaces = offset;
+        offset += kMdlFaceSize * numMeshFaces;
+        node.offIndicesOffset = offset;
+        offset += 4;
+        node.offIndices = offset;
+        offset += 3 * 2 * numMeshFaces;
+        node.offMdxData = offMdx;
+        offMdx += kMdxVertexSize * numMeshVertices;
+    }
+    uint32_t mdlSize = offset;
+
+    auto bytes = ModelBytes();
+    auto stream = MemoryOutputStream(bytes.mdl);
+    auto writer = BinaryWriter(stream);
+
+    // File Header
+    writer.writeUint32(0);
+    writer.writeUint32(mdlSize);
+    writer.writeUint32(offMdx);
+
+    // Geometry Header
+    writer.writeUint32(0);
+    writer.writeUint32(0);
+    writer.writeString(std::string("some_model").append(22, '\0'));
+    writer.writeUint32(nodes[0].offset);
+    writer.writeUint32(numNodes);
+    writer.write(6 * 4, 0);
+    writer.writeUint32(0);
+    writer.writeUint32(2);
+
+    // Model Header
+    writer.write(4, 0);
+    writer.writeUint32(0);      // number of child models
+    writer.write(3 * 4, 0);     // animations
+    writer.writeUint32(0);      // supermodel reference
+    writer.write(6 * 4, 0);     // bounding box
+    writer.writeFloat(1.0f);    // radius
+    writer.writeFloat(1.0f);    // animation scale
+    writer.writeString(std::string("NULL").append(28, '\0'));
+    writer.writeUint32(0);      // offset to animation root node
+    writer.writeUint32(0);      // unknown
+    writer.writeUint32(offMdx); // MDX size
+    writer.writeUint32(0);      // offset to MDX
+    writer.writeUint32(offNameOffsets);
+    writer.writeUint32(numNodes);
+    writer.writeUint32(numNodes);
+
+    for (auto nameOffset : nameOffsets) {
+        writer.writeUint32(nameOffset);
+    }
+    for (auto &name : names) {
+        writer.writeCString(name);
+    }
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        auto &node = nodes[i];
+        uint32_t offChildren = node.offset + kMdlNodeSize + (node.mesh ? kMdlMeshSize : 0);
+        writer.writeUint16(node.mesh ? MdlNodeFlags::dummy | MdlNodeFlags::mesh : 0); // flags
+        writer.writeUint16(static_cast<uint16_t>(i));     // node number
+        writer.writeUint16(static_cast<uint16_t>(i));     // name index
+        writer.writeUint16(0);                            // padding
+        writer.writeUint32(nodes[0].offset);              // offset to root node
+        writer.writeUint32(0);                            // offset to parent node
+        writer.writeFloat(static_cast<float>(i));         // position
+        writer.writeFloat(0.0f);
+        writer.writeFloat(0.0f);
+        writer.writeFloat(1.0f); // orientation
+        writer.writeFloat(0.0f);
+        writer.writeFloat(0.0f);
+        writer.writeFloat(0.0f);
+        writer.writeUint32(offChildren);
+        writer.writeUint32(static_cast<uint32_t>(node.children.size()));
+        writer.writeUint32(static_cast<uint32_t>(node.children.size()));
+        writer.write(6 * 4, 0); // controller keys and data
+        if (node.mesh) {
+            // Common Mesh Header (KotOR layout)
+            writer.write(2 * 4, 0); // function pointers
+            writer.writeUint32(node.offFaces);
+            writer.writeUint32(numMeshFaces);
+            writer.writeUint32(numMeshFaces);
+            writer.write(6 * 4, 0); // bounding box
+            writer.writeFloat(1.0f); // radius
+            writer.write(3 * 4, 0); // average
+            for (int j = 0; j < 2 * 3; ++j) {
+                writer.writeFloat(1.0f); // diffuse and ambient
+            }
+            writer.writeUint32(0); // transparency hint
+            writer.writeString(std::string("NULL").append(28, '\0'));
+            writer.write(32 + 12 + 12, 0); // textures 2-4
+            writer.writeUint32(0); // indices count array
+            writer.writeUint32(1);
+            writer.writeUint32(1);
+            writer.writeUint32(node.offIndicesOffset);
+            writer.writeUint32(1);
+            writer.writeUint32(1);
+            writer.write(3 * 4, 0); // inverted counter array
+            writer.write(3 * 4 + 8, 0);
+            writer.write(5 * 4, 0); // UV animation
+            writer.writeUint32(kMdxVertexSize);
+            writer.writeUint32(0x1 | 0x2 | 0x20); // MDX data flags: vertices, UV1, normals
+            writer.writeInt32(0);                 // offset to vertices
+            writer.writeInt32(3 * 4);             // offset to normals
+            writer.writeInt32(-1);                // offset to vertex colors
+            writer.writeInt32(6 * 4);             // offset to UV1
+            writer.writeInt32(-1);                // offset to UV2
+            writer.writeInt32(-1);                // offset to UV3
+            writer.writeInt32(-1);                // offset to UV4
+            writer.writeInt32(-1);                // offset to tangent space
+            writer.write(3 * 4, 0);
+            writer.writeUint16(static_cast<uint16_t>(numMeshVertices));
+            writer.writeUint16(1); // number of textures
+            writer.write(6, 0);    // lightmapped, rotate texture, background geometry, shadow, beaming, render
+            writer.write(2, 0);
+            writer.writeFloat(0.0f); // total area
+            writer.write(4, 0);
+            writer.writeUint32(node.offMdxData);
+            writer.writeUint32(0); // offset to vertices in MDL
+        }
+        for (auto child : node.children) {
+            writer.writeUint32(nodes[child].offset);
+        }
+    }
+
+    auto mdxStream = MemoryOutputStream(bytes.mdx);
+    auto mdxWriter = BinaryWriter(mdxStream);
+    for (auto &node : nodes) {
+        if (!node.mesh) {
+            continue;
+        }
+        for (int y = 0; y < meshGridSize; ++y) {
+            for (int x = 0; x < meshGridSize; ++x) {
+                int v0 = y * (meshGridSize + 1) + x;
+                int v1 = v0 + 1;
+                int v2 = v0 + meshGridSize + 1;
+                int v3 = v2 + 1;
+                for (auto &indices : {std::array<int, 3> {v0, v1, v3}, std::array<int, 3> {v0, v3, v2}}) {
+                    writer.writeFloat(0.0f); // normal
+                    writer.writeFloat(0.0f);
+                    writer.writeFloat(1.0f);
+                    writer.writeFloat(0.0f); // plane distance
+                    writer.writeUint32(0);   // material
+                    writer.write(3 * 2, 0xff);
+                    for (auto index : indices) {
+                        writer.writeUint16(static_cast<uint16_t>(index));
+                    }
+                }
+            }
+        }
+        writer.writeUint32(node.offIndices);
+        for (int y = 0; y < meshGridSize; ++y) {
+            for (int x = 0; x < meshGridSize; ++x) {
+                int v0 = y * (meshGridSize + 1) + x;
+                int v2 = v0 + meshGridSize + 1;
+                for (auto index : {v0, v0 + 1, v2 + 1, v0, v2 + 1, v2}) {
+                    writer.writeUint16(static_cast<uint16_t>(index));
+                }
+            }
+        }
+        for (int y = 0; y <= meshGridSize; ++y) {
+            for (int x = 0; x <= meshGridSize; ++x) {
+                mdxWriter.writeFloat(static_cast<float>(x)); // position
+                mdxWriter.writeFloat(static_cast<float>(y));
+                mdxWriter.writeFloat(0.0f);
+                mdxWriter.writeFloat(0.0f); // normal
+                mdxWriter.writeFloat(0.0f);
+                mdxWriter.writeFloat(1.0f);
+                mdxWriter.writeFloat(x / static_cast<float>(meshGridSize)); // UV1
+                mdxWriter.writeFloat(y / static_cast<float>(meshGridSize));
+            }
+        }
+    }
+
+    return bytes;
+}
+
+/**
+ * Generates a DXT5 compressed TPC with a full mip chain.
+ */
+static ByteBuffer newCompressedTextureBytes(int size) {
+    auto mipSize = [](int size) { return glm::max(16, ((size + 3) / 4) * ((size + 3) / 4) * 16); };
+
+    auto bytes = ByteBuffer();
+    auto stream = MemoryOutputStream(bytes);
+    auto writer = BinaryWriter(stream);
+    writer.writeUint32(mipSize(size)); // data size
+    writer.writeUint32(0);
+    writer.writeUint16(size);
+    writer.writeUint16(size);
+    writer.writeByte(4); // RGBA
+    int numMipMaps = 1;
+    for (int s = size; s > 1; s /= 2) {
+        ++numMipMaps;
+    }
+    writer.writeByte(numMipMaps);
+    writer.write(114, 0);
+    for (int s = size; s >= 1; s /= 2) {
+        writer.write(mipSize(s), 0x55);
+    }
+    writer.writeString("proceduretype cycle\r\n");
+    return bytes;
+}
+
+BENCHMARK(tpc_reader, load_dxt5_1024) {
+    auto bytes = newCompressedTextureBytes(1024);
+    state.setBytesPerIteration(bytes.size());
+
+    while (state.keepRunning()) {
+        auto stream = MemoryInputStream(bytes);
+        auto reader = TpcReader(stream, "some_texture", TextureUsage::Default);
+        reader.load();
+        bench::doNotOptimize(reader.texture());
+    }
+}
+
+BENCHMARK(mdl_mdx_reader, load_mesh_nodes) {
+    auto bytes = newModelBytes(32, 16, 8);
+    auto models = MockModels();
+    auto textures = MockTextures();
+    state.setBytesPerIteration(bytes.mdl.size() + bytes.mdx.size());
+    state.setItemsPerIteration(1 + 32 * 17);
+
+    while (state.keepRunning()) {
+        auto mdl = MemoryInputStream(bytes.mdl);
+        auto mdx = MemoryInputStream(bytes.mdx);
+        auto reader = MdlMdxReader(mdl, mdx, models, textures);
+        reader.load();
+        bench::doNotOptimize(reader.model());
+    }
+}
+
+BENCHMARK(bwm_reader, load_wok_64x64) {
+    auto bytes = newGridWalkmeshBytes(64);
+    state.setBytesPerIteration(bytes.size());
+    state.setItemsPerIteration(2 * 64 * 64);
+
+    while (state.keepRunning()) {
+        auto stream = MemoryInputStream(bytes);
+        auto reader = BwmReader(stream);
+        reader.load();
+        bench::doNotOptimize(reader.walkmesh());
+    }
+}
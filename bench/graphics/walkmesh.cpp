@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/graphics/format/bwmreader.h"
+#include "reone/graphics/walkmesh.h"
+#include "reone/system/stream/memoryinput.h"
+
+#include "../benchmark.h"
+#include "../fixtures/graphics.h"
+
+using namespace reone;
+using namespace reone::graphics;
+
+static constexpr int kGridSize = 64;
+
+static std::shared_ptr<Walkmesh> loadGridWalkmesh() {
+    auto bytes = newGridWalkmeshBytes(kGridSize);
+    auto stream = MemoryInputStream(bytes);
+    auto reader = BwmReader(stream);
+    reader.load();
+    return reader.walkmesh();
+}
+
+BENCHMARK(walkmesh, raycast_down) {
+    auto walkmesh = loadGridWalkmesh();
+    auto surfaces = std::set<uint32_t> {1};
+    auto numRays = 0;
+    state.setItemsPerIteration(1);
+
+    while (state.keepRunning()) {
+        // Walk the ray origin across the grid so that every query takes a different path through the AABB tree
+        float x = 0.5f + static_cast<float>(numRays % kGridSize);
+        float y = 0.5f + static_cast<float>((numRays / kGridSize) % kGridSize);
+        ++numRays;
+        float distance = 0.0f;
+        auto face = walkmesh->raycast(surfaces, glm::vec3(x, y, 10.0f), glm::vec3(0.0f, 0.0f, -1.0f), 20.0f, distance);
+        bench::doNotOptimize(face);
+    }
+}
+
+BENCHMARK(walkmesh, raycast_miss) {
+    auto walkmesh = loadGridWalkmesh();
+    auto surfaces = std::set<uint32_t> {1};
+    state.setItemsPerIteration(1);
+
+    while (state.keepRunning()) {
+        float distance = 0.0f;
+        auto face = walkmesh->raycast(surfaces, glm::vec3(-10.0f, -10.0f, 10.0f), glm::vec3(0.0f, 0.0f, -1.0f), 20.0f, distance);
+        bench::doNotOptimize(face);
+    }
+}
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark.h"
+
+using namespace reone;
+using namespace reone::bench;
+
+namespace reone {
+
+namespace bench {
+
+std::vector<Benchmark> &benchmarks() {
+    static std::vector<Benchmark> benchmarks;
+    return benchmarks;
+}
+
+} // namespace bench
+
+} // namespace reone
+
+struct BenchmarkResult {
+    std::string name;
+    int64_t numIterations {0};
+    double nsPerIteration {0.0};
+    double bytesPerSecond {0.0};
+    double itemsPerSecond {0.0};
+};
+
+static constexpr int64_t kMaxIterations = 1000000000;
+
+static BenchmarkResult runBenchmark(const Benchmark &benchmark, double minTime) {
+    int64_t numIterations = 1;
+    while (true) {
+        auto state = State(numIterations);
+        benchmark.func(state);
+
+        double seconds = std::chrono::duration<double>(state.elapsed()).count();
+        if (seconds >= minTime || numIterations >= kMaxIterations) {
+            auto result = BenchmarkResult();
+            result.name = benchmark.name;
+            result.numIterations = numIterations;
+            result.nsPerIteration = 1e9 * seconds / numIterations;
+            if (seconds > 0.0) {
+                result.bytesPerSecond = state.bytesPerIteration() * numIterations / seconds;
+                result.itemsPerSecond = state.itemsPerIteration() * numIterations / seconds;
+            }
+            return result;
+        }
+
+        // Overshoot the minimum time slightly, growing by at least 2x and at most 10x
+        double multiplier = seconds > 0.0 ? 1.4 * minTime / seconds : 10.0;
+        multiplier = std::max(2.0, std::min(10.0, multiplier));
+        numIterations = std::min(kMaxIterations, static_cast<int64_t>(numIterations * multiplier));
+    }
+}
+
+static std::string escapeJson(const std::string &s) {
+    std::string escaped;
+    for (char ch : s) {
+        if (ch == '"' || ch == '\\') {
+            escaped.push_back('\\');
+        }
+        escaped.push_back(ch);
+    }
+    return escaped;
+}
+
+static void writeJson(const std::vector<BenchmarkResult> &results, std::ostream &out) {
+    out << "{\n  \"benchmarks\": [";
+    for (size_t i = 0; i < results.size(); ++i) {
+        auto &result = results[i];
+        out << (i > 0 ? ",\n" : "\n");
+        out << "    {";
+        out << "\"name\": \"" << escapeJson(result.name) << "\", ";
+        out << "\"iterations\": " << result.numIterations << ", ";
+        out << "\"ns_per_iteration\": " << std::fixed << std::setprecision(2) << result.nsPerIteration << ", ";
+        out << "\"bytes_per_second\": " << std::setprecision(0) << result.bytesPerSecond << ", ";
+        out << "\"items_per_second\": " << std::setprecision(0) << result.itemsPerSecond;
+        out << "}";
+    }
+    out << "\n  ]\n}\n";
+}
+
+int main(int argc, char **argv) {
+    try {
+        boost::program_options::options_description description;
+        description.add_options()                                                                                          //
+            ("filter", boost::program_options::value<std::string>()->default_value(""), "run benchmarks whose name contains this") //
+            ("min-time", boost::program_options::value<double>()->default_value(0.5), "minimum measured time per benchmark, s")   //
+            ("json", boost::program_options::value<std::filesystem::path>(), "write results as JSON to this file")                //
+            ("list", "list benchmarks and exit");
+
+        boost::program_options::variables_map vars;
+        boost::program_options::store(boost::program_options::parse_command_line(argc, argv, description), vars);
+        boost::program_options::notify(vars);
+
+        auto &filter = vars["filter"].as<std::string>();
+        auto minTime = vars["min-time"].as<double>();
+
+        auto selected = std::vector<Benchmark>();
+        for (auto &benchmark : benchmarks()) {
+            if (filter.empty() || benchmark.name.find(filter) != std::string::npos) {
+                selected.push_back(benchmark);
+            }
+        }
+        std::sort(selected.begin(), selected.end(), [](auto &l, auto &r) { return l.name < r.name; });
+
+        if (vars.count("list") > 0) {
+            for (auto &benchmark : selected) {
+                std::cout << benchmark.name << std::endl;
+            }
+            return 0;
+        }
+
+        auto results = std::vector<BenchmarkResult>();
+        for (auto &benchmark : selected) {
+            auto result = runBenchmark(benchmark, minTime);
+            std::cout << std::left << std::setw(40) << result.name
+                      << std::right << std::setw(12) << result.numIterations << " iterations"
+                      << std::setw(16) << std::fixed << std::setprecision(1) << result.nsPerIteration << " ns/iter";
+            if (result.bytesPerSecond > 0.0) {
+                std::cout << std::setw(12) << std::setprecision(1) << result.bytesPerSecond / (1024.0 * 1024.0) << " MiB/s";
+            }
+            if (result.itemsPerSecond > 0.0) {
+                std::cout << std::setw(14) << std::setprecision(0) << result.itemsPerSecond << " items/s";
+            }
+            std::cout << std::endl;
+            results.push_back(std::move(result));
+        }
+
+        if (vars.count("json") > 0) {
+            auto json = std::ofstream(vars["json"].as<std::filesystem::path>());
+            writeJson(results, json);
+        }
+
+        return 0;
+
+    } catch (const std::exception &ex) {
+        std::cerr << ex.what() << std::endl;
+        return 1;
+    }
+}
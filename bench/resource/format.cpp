@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/resource/2da.h"
+#include "reone/resource/format/2dareader.h"
+#include "reone/resource/format/2dawriter.h"
+#include "reone/resource/format/erfreader.h"
+#include "reone/resource/format/erfwriter.h"
+#include "reone/resource/format/gffreader.h"
+#include "reone/resource/format/gffwriter.h"
+#include "reone/resource/format/tlkreader.h"
+#include "reone/resource/format/tlkwriter.h"
+#include "reone/resource/gff.h"
+#include "reone/resource/talktable.h"
+#include "reone/system/stream/memoryinput.h"
+#include "reone/system/stream/memoryoutput.h"
+
+#include "../benchmark.h"
+
+using namespace reone;
+using namespace reone::resource;
+
+/**
+ * Creature-like GFF: a handful of scalar fields plus lists of structs, as in
+ * UTC/GIT files.
+ */
+static std::shared_ptr<Gff> newCreatureGff(int numListItems) {
+    auto items = std::vector<std::shared_ptr<Gff>>();
+    for (int i = 0; i < numListItems; ++i) {
+        items.push_back(Gff::Builder()
+                            .type(i)
+                            .field(Gff::Field::newResRef("InventoryRes", "g_w_blstrpstl00" + std::to_string(i % 10)))
+                            .field(Gff::Field::newWord("Repos_PosX", i))
+                            .field(Gff::Field::newWord("Repos_PosY", i))
+                            .field(Gff::Field::newByte("Dropable", i % 2))
+                            .field(Gff::Field::newVector("Position", glm::vec3(static_cast<float>(i))))
+                            .field(Gff::Field::newOrientation("Orientation", glm::quat(1.0f, 0.0f, 0.0f, 0.0f)))
+                            .build());
+    }
+    return Gff::Builder()
+        .type(0xffffffff)
+        .field(Gff::Field::newResRef("TemplateResRef", "n_commoner01"))
+        .field(Gff::Field::newCExoString("Tag", "commoner01"))
+        .field(Gff::Field::newCExoLocString("FirstName", 12345, ""))
+        .field(Gff::Field::newInt("HitPoints", 20))
+        .field(Gff::Field::newFloat("ChallengeRating", 1.5f))
+        .field(Gff::Field::newDword64("Experience", 100))
+        .field(Gff::Field::newList("ItemList", std::move(items)))
+        .build();
+}
+
+static ByteBuffer writeGff(std::shared_ptr<Gff> gff) {
+    auto bytes = ByteBuffer();
+    auto stream = MemoryOutputStream(bytes);
+    auto writer = GffWriter(ResourceType::Utc, std::move(gff));
+    writer.save(stream);
+    return bytes;
+}
+
+static ByteBuffer writeTwoDa(int numRows, int numColumns) {
+    auto columns = std::vector<std::string>();
+    for (int i = 0; i < numColumns; ++i) {
+        columns.push_back("column" + std::to_string(i));
+    }
+    auto rows = std::vector<TwoDa::Row>();
+    for (int i = 0; i < numRows; ++i) {
+        auto values = std::vector<std::string>();
+        for (int j = 0; j < numColumns; ++j) {
+            values.push_back(j % 3 == 0 ? "****" : std::to_string(i * numColumns + j));
+        }
+        rows.push_back(TwoDa::newRow(std::move(values)));
+    }
+    auto twoDa = TwoDa(std::move(columns), std::move(rows));
+
+    auto bytes = ByteBuffer();
+    auto stream = MemoryOutputStream(bytes);
+    auto writer = TwoDaWriter(twoDa);
+    writer.save(stream);
+    return bytes;
+}
+
+static ByteBuffer writeTalkTable(int numStrings) {
+    auto builder = TalkTable::Builder();
+    for (int i = 0; i < numStrings; ++i) {
+        builder.string("String number " + std::to_string(i) + " of the synthetic talk table.", i % 4 == 0 ? "snd" + std::to_string(i) : "");
+    }
+    auto talkTable = builder.build();
+
+    auto bytes = ByteBuffer();
+    auto stream = MemoryOutputStream(bytes);
+    auto writer = TlkWriter(*talkTable);
+    writer.save(stream);
+    return bytes;
+}
+
+BENCHMARK(gff_reader, load_creature) {
+    auto bytes = writeGff(newCreatureGff(100));
+    state.setBytesPerIteration(bytes.size());
+
+    while (state.keepRunning()) {
+        auto stream = MemoryInputStream(bytes);
+        auto reader = GffReader(stream);
+        reader.load();
+        bench::doNotOptimize(reader.root());
+    }
+}
+
+BENCHMARK(two_da_reader, load_appearance_sized) {
+    auto bytes = writeTwoDa(700, 80);
+    state.setBytesPerIteration(bytes.size());
+
+    while (state.keepRunning()) {
+        auto stream = MemoryInputStream(bytes);
+        auto reader = TwoDaReader(stream);
+        reader.load();
+        bench::doNotOptimize(reader.twoDa());
+    }
+}
+
+BENCHMARK(tlk_reader, load) {
+    auto bytes = writeTalkTable(10000);
+    state.setBytesPerIteration(bytes.size());
+
+    while (state.keepRunning()) {
+        auto stream = MemoryInputStream(bytes);
+        auto reader = TlkReader(stream);
+        reader.load();
+        bench::doNotOptimize(reader.table());
+    }
+}
+
+BENCHMARK(erf_reader, load_module) {
+    auto writer = ErfWriter();
+    auto gffBytes = writeGff(newCreatureGff(10));
+    for (int i = 0; i < 2000; ++i) {
+        writer.add(ErfWriter::Resource {"resource" + std::to_string(i), ResourceType::Utc, gffBytes});
+    }
+    auto bytes = ByteBuffer();
+    auto out = MemoryOutputStream(bytes);
+    writer.save(ErfWriter::FileType::MOD, out);
+    state.setItemsPerIteration(2000);
+
+    while (state.keepRunning()) {
+        auto stream = MemoryInputStream(bytes);
+        auto reader = ErfReader(stream);
+        reader.load();
+        bench::doNotOptimize(reader.keys());
+    }
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/script/execution.h"
+#include "reone/script/executioncontext.h"
+#include "reone/script/format/ncsreader.h"
+#include "reone/script/format/ncswriter.h"
+#include "reone/script/program.h"
+#include "reone/system/stream/memoryinput.h"
+#include "reone/system/stream/memoryoutput.h"
+
+#include "../benchmark.h"
+
+using namespace reone;
+using namespace reone::script;
+
+static constexpr int kNumLoopIterations = 10000;
+
+/**
+ * Counts from zero to numIterations, returning the counter.
+ */
+static std::shared_ptr<ScriptProgram> newLoopProgram(int numIterations) {
+    auto program = std::make_shared<ScriptProgram>("some_program");
+    program->add(Instruction::newCONSTI(0));
+    program->add(Instruction::newCONSTI(numIterations));
+    program->add(Instruction::newCPTOPSP(-8, 8));
+    program->add(Instruction(InstructionType::LTII));
+    program->add(Instruction::newJZ(18));
+    program->add(Instruction::newINCISP(-8));
+    program->add(Instruction::newJMP(-22));
+    program->add(Instruction::newMOVSP(-4));
+    return program;
+}
+
+BENCHMARK(script_execution, run_loop) {
+    auto program = newLoopProgram(kNumLoopIterations);
+    state.setItemsPerIteration(kNumLoopIterations);
+
+    while (state.keepRunning()) {
+        auto execution = ScriptExecution(program, std::make_unique<ExecutionContext>());
+        bench::doNotOptimize(execution.run());
+    }
+}
+
+BENCHMARK(ncs_reader, load_loop) {
+    auto program = newLoopProgram(kNumLoopIterations);
+    auto bytes = ByteBuffer();
+    auto writer = NcsWriter(*program);
+    writer.save(std::make_shared<MemoryOutputStream>(bytes));
+    state.setBytesPerIteration(bytes.size());
+
+    while (state.keepRunning()) {
+        auto stream = MemoryInputStream(bytes);
+        auto reader = NcsReader(stream, "some_program");
+        reader.load();
+        bench::doNotOptimize(reader.program());
+    }
+}
@@ -0,0 +1,15 @@
+uniform sampler2D sMainTex;
+
+in vec2 fragUV1;
+in vec4 fragVertexColor;
+
+out vec4 fragColor;
+
+void main() {
+    vec4 mainTexSample = texture(sMainTex, fragUV1);
+    vec3 objectColor = fragVertexColor.rgb * mainTexSample.rgb;
+    if (isFeatureEnabled(FEATURE_DISCARD) && length(uDiscardColor.rgb - objectColor) < 0.01) {
+        discard;
+    }
+    fragColor = vec4(objectColor, fragVertexColor.a * mainTexSample.a);
+}
@@ -1,13 +0,0 @@
-uniform sampler2D sMainTex;
-
-in vec2 fragUV1;
-flat in int fragInstanceID;
-
-out vec4 fragColor;
-
-void main() {
-    vec2 uv = fragUV1 * uTextChars[fragInstanceID].uv.zw + uTextChars[fragInstanceID].uv.xy;
-    vec4 mainTexSample = texture(sMainTex, uv);
-    vec3 objectColor = uColor.rgb * mainTexSample.rgb;
-    fragColor = vec4(objectColor, mainTexSample.a);
-}
@@ -5,6 +5,9 @@ layout(triangle_strip, max_vertices = 12) out;
 
 void main() {
     for (int cascade = 0; cascade < NUM_SHADOW_CASCADES; ++cascade) {
+        if ((uShadowLayerMask & (1 << cascade)) == 0) {
+            continue;
+        }
         gl_Layer = cascade;
         for (int i = 0; i < 3; ++i) {
             gl_Position = uShadowLightSpace[cascade] * gl_in[i].gl_Position;
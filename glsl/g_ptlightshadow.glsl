@@ -7,6 +7,9 @@ out vec4 fragPosWorldSpace;
 
 void main() {
     for (int face = 0; face < NUM_CUBE_FACES; ++face) {
+        if ((uShadowLayerMask & (1 << face)) == 0) {
+            continue;
+        }
         gl_Layer = face;
         for (int i = 0; i < 3; ++i) {
             fragPosWorldSpace = gl_in[i].gl_Position;
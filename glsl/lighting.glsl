@@ -11,13 +11,52 @@ float getLightAttenuation(Light light, vec3 worldPos) {
     return radius2 / (radius2 + distance2);
 }
 
+uvec2 getClusterLights(vec3 eyePos) {
+    vec4 clipPos = uProjection * vec4(eyePos, 1.0);
+    vec2 ndc = clipPos.xy / clipPos.w;
+    ivec2 tile = clamp(
+        ivec2((0.5 * ndc + 0.5) * vec2(NUM_LIGHT_CLUSTERS_X, NUM_LIGHT_CLUSTERS_Y)),
+        ivec2(0),
+        ivec2(NUM_LIGHT_CLUSTERS_X - 1, NUM_LIGHT_CLUSTERS_Y - 1));
+
+    float depth = max(-eyePos.z, uClusterNear);
+    int slice = min(int(log(depth / uClusterNear) * uClusterScale), NUM_LIGHT_CLUSTERS_Z - 1);
+
+    int cluster = (slice * NUM_LIGHT_CLUSTERS_Y + tile.y) * NUM_LIGHT_CLUSTERS_X + tile.x;
+    uvec4 masks = uLightClusters[cluster / 2];
+
+    return (cluster % 2 == 0) ? masks.xy : masks.zw;
+}
+
+bool nextClusterLight(inout uvec2 lights, inout int i) {
+    while (lights.x != 0u) {
+        bool set = (lights.x & 1u) != 0u;
+        lights.x >>= 1;
+        ++i;
+        if (set)
+            return true;
+    }
+    if (i < 32) {
+        i = 31;
+    }
+    while (lights.y != 0u) {
+        bool set = (lights.y & 1u) != 0u;
+        lights.y >>= 1;
+        ++i;
+        if (set)
+            return true;
+    }
+    return false;
+}
+
 void getIrradianceAmbient(
-    vec3 worldPos, vec3 normal, vec3 albedo, vec3 environment, float metallic, float roughness,
+    vec3 worldPos, vec3 normal, vec3 albedo, vec3 environment, float metallic, float roughness, uvec2 lights,
     out vec3 ambientD, out vec3 ambientS) {
 
     vec3 irradiance = uWorldAmbientColor.rgb;
 
-    for (int i = 0; i < uNumLights; ++i) {
+    int i = -1;
+    while (nextClusterLight(lights, i)) {
         if (!uLights[i].ambientOnly)
             continue;
 
@@ -40,7 +79,7 @@ void getIrradianceAmbient(
 }
 
 void getIrradianceDirect(
-    vec3 worldPos, vec3 normal, vec3 albedo, float metallic, float roughness,
+    vec3 worldPos, vec3 normal, vec3 albedo, float metallic, float roughness, uvec2 lights,
     out vec3 diffuse, out vec3 specular, out vec3 areaDiffuse, out vec3 areaSpecular) {
 
     diffuse = vec3(0.0);
@@ -60,7 +99,8 @@ void getIrradianceDirect(
 
     vec3 F0 = mix(vec3(0.04), albedo, metallic);
 
-    for (int i = 0; i < uNumLights; ++i) {
+    int i = -1;
+    while (nextClusterLight(lights, i)) {
         if (uLights[i].ambientOnly)
             continue;
 
@@ -0,0 +1,6 @@
+const int MAX_INSTANCES = 64;
+
+layout(std140) uniform Instances {
+    mat4 uInstanceModels[MAX_INSTANCES];
+    mat4 uInstanceModelsInv[MAX_INSTANCES];
+};
@@ -1,4 +1,8 @@
 const int MAX_LIGHTS = 64;
+const int NUM_LIGHT_CLUSTERS_X = 16;
+const int NUM_LIGHT_CLUSTERS_Y = 8;
+const int NUM_LIGHT_CLUSTERS_Z = 8;
+const int NUM_LIGHT_CLUSTERS = NUM_LIGHT_CLUSTERS_X * NUM_LIGHT_CLUSTERS_Y * NUM_LIGHT_CLUSTERS_Z;
 
 struct Light {
     vec4 position;
@@ -11,5 +15,8 @@ struct Light {
 
 layout(std140) uniform Lighting {
     int uNumLights;
+    float uClusterNear;
+    float uClusterScale;
     Light uLights[MAX_LIGHTS];
+    uvec4 uLightClusters[NUM_LIGHT_CLUSTERS / 2];
 };
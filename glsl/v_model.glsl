@@ -43,10 +43,17 @@ void main() {
             (uBones[i4] * N) * w4;
     }
 
+    mat4 model = uModel;
+    mat4 modelInv = uModelInv;
+    if (isFeatureEnabled(FEATURE_INSTANCED)) {
+        model = uInstanceModels[gl_InstanceID];
+        modelInv = uInstanceModelsInv[gl_InstanceID];
+    }
+
     fragPosObjSpace = P;
-    fragPosWorldSpace = uModel * P;
+    fragPosWorldSpace = model * P;
 
-    mat3 normalMatrix = transpose(mat3(uModelInv));
+    mat3 normalMatrix = transpose(mat3(modelInv));
     fragNormalWorldSpace = normalize(normalMatrix * N.xyz);
 
     fragUV1 = aUV1;
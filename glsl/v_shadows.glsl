@@ -1,5 +1,6 @@
 layout(location = 0) in vec3 aPosition;
 
 void main() {
-    gl_Position = uModel * vec4(aPosition, 1.0);
+    mat4 model = isFeatureEnabled(FEATURE_INSTANCED) ? uInstanceModels[gl_InstanceID] : uModel;
+    gl_Position = model * vec4(aPosition, 1.0);
 }
@@ -0,0 +1,12 @@
+layout(location = 0) in vec2 aPosition;
+layout(location = 2) in vec2 aUV1;
+layout(location = 3) in vec4 aColor;
+
+out vec2 fragUV1;
+out vec4 fragVertexColor;
+
+void main() {
+    gl_Position = uProjection * vec4(aPosition, 0.0, 1.0);
+    fragUV1 = aUV1;
+    fragVertexColor = aColor;
+}
@@ -23,6 +23,7 @@
 #include "reone/movie/movie.h"
 #include "reone/script/routines.h"
 #include "reone/system/logutil.h"
+#include "reone/system/slotmap.h"
 
 #include "action.h"
 #include "combat.h"
@@ -44,6 +45,7 @@
 #include "gui/profileoverlay.h"
 #include "gui/saveload.h"
 #include "location.h"
+#include "modulecache.h"
 #include "object/area.h"
 #include "object/camera/animated.h"
 #include "object/camera/dialog.h"
@@ -99,7 +101,8 @@ public:
         _options(options),
         _services(services),
         _party(*this),
-        _combat(*this, services) {
+        _combat(*this, services),
+        _loadedModules(options.game.residentModules) {
     }
 
     ~Game() {
@@ -188,6 +191,11 @@ public:
 
     std::shared_ptr<Object> getObjectById(uint32_t id) const;
 
+    /**
+     * @return borrowed pointer to object or nullptr, without copying a shared pointer
+     */
+    Object *findObjectById(uint32_t id) const;
+
     inline std::shared_ptr<Module> newModule() {
         return newObject<Module>(*this, _services);
     }
@@ -258,11 +266,24 @@ public:
 
     template <class T, class... Args>
     inline std::shared_ptr<T> newObject(Args &&...args) {
-        auto object = std::make_shared<T>(_nextObjectId++, std::forward<Args>(args)...);
-        auto [inserted, _] = _objectById.insert(std::make_pair(object->id(), std::move(object)));
-        return std::static_pointer_cast<T>(inserted->second);
+        // Object id is a slot map handle, which must be known before construction
+        uint32_t id = _objects.insert(nullptr);
+        std::shared_ptr<T> object;
+        try {
+            object = std::make_shared<T>(id, std::forward<Args>(args)...);
+        } catch (...) {
+            _objects.erase(id);
+            throw;
+        }
+        *_objects.find(id) = object;
+        return object;
     }
 
+    /**
+     * Unregisters object, so that its id no longer resolves to it.
+     */
+    void destroyObject(uint32_t id);
+
     template <class T, class... Args>
     inline std::shared_ptr<T> newAction(Args &&...args) {
         return std::make_shared<T>(*this, _services, std::forward<Args>(args)...);
@@ -342,8 +363,7 @@ private:
     bool _paused {false};
     std::set<std::string> _moduleNames;
 
-    uint32_t _nextObjectId {2}; // ids 0 and 1 are reserved
-    std::map<uint32_t, std::shared_ptr<Object>> _objectById;
+    SlotMap<std::shared_ptr<Object>> _objects; // handles never collide with reserved ids 0 and 1
 
     // Services
 
@@ -381,7 +401,7 @@ private:
     std::string _nextModule;
     std::string _nextEntry;
     std::shared_ptr<Module> _module;
-    std::map<std::string, std::shared_ptr<Module>> _loadedModules;
+    ModuleCache _loadedModules;
 
     // END Modules
 
@@ -422,6 +442,7 @@ private:
 
     void loadDefaultParty();
     void loadNextModule();
+    void unloadModule(Module &module);
     void playMusic(const std::string &resRef);
     void toggleInGameCameraType();
 
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "reone/system/profiler.h"
 #include "reone/system/timer.h"
 #include "reone/graphics/font.h"
 
@@ -52,8 +53,17 @@ private:
     int _numFrames {0};
     int _fps {0};
 
+    std::string _uniformsLine;
+
+    uint64_t _zonesStartNs {0};
+    std::vector<std::string> _zoneLines;
+
     Timer _refreshTimer;
     std::shared_ptr<graphics::Font> _font;
+
+    void refreshUniforms();
+    void refreshZones();
+    void saveTrace();
 };
 
 } // namespace game
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "types.h"
+
+namespace reone {
+
+namespace game {
+
+class Area;
+class Module;
+
+struct ObjectSnapshot {
+    ObjectType type {ObjectType::Invalid};
+    int gitIndex {-1};
+
+    glm::vec3 position {0.0f};
+    float facing {0.0f};
+    int currentHitPoints {0};
+    bool dead {false};
+    bool plot {false};
+    bool open {false};
+
+    std::map<int, bool> localBooleans;
+    std::map<int, int> localNumbers;
+};
+
+struct ModuleSnapshot {
+    std::vector<ObjectSnapshot> objects;
+
+    std::map<int, bool> areaLocalBooleans;
+    std::map<int, int> areaLocalNumbers;
+    std::map<int, bool> moduleLocalBooleans;
+    std::map<int, int> moduleLocalNumbers;
+};
+
+/**
+ * Keeps at most a fixed number of modules resident. When capacity is
+ * exceeded, the least recently used module is evicted and mutable state of
+ * its area objects is kept as a snapshot, to be applied when the module is
+ * loaded again. Locals of the area and the module itself are kept as well.
+ * Objects are matched by type and GIT index, therefore objects spawned at
+ * runtime are not part of the snapshot.
+ *
+ * Capacity is at least two, so that the module being left is never evicted
+ * while the scene graph and party may still reference its objects.
+ */
+class ModuleCache : boost::noncopyable {
+public:
+    ModuleCache(int capacity) :
+        _capacity(std::max(kMinCapacity, capacity)) {
+    }
+
+    /**
+     * @return resident module or nullptr, marking it as most recently used
+     */
+    std::shared_ptr<Module> get(const std::string &name);
+
+    /**
+     * Adds module as most recently used.
+     *
+     * @return modules evicted to stay within capacity
+     */
+    std::vector<std::shared_ptr<Module>> add(const std::string &name, std::shared_ptr<Module> module);
+
+    /**
+     * Applies and discards snapshot of a previously evicted module.
+     *
+     * @return true if snapshot was found, false otherwise
+     */
+    bool restore(const std::string &name, Module &module);
+
+    void clear();
+
+    int capacity() const { return _capacity; }
+    int numResident() const { return static_cast<int>(_resident.size()); }
+    int numSnapshots() const { return static_cast<int>(_snapshots.size()); }
+
+    static ModuleSnapshot takeSnapshot(const Module &module);
+    static ModuleSnapshot takeSnapshot(const Module &module, const Area &area);
+
+    static void applySnapshot(const ModuleSnapshot &snapshot, Module &module);
+    static void applySnapshot(const ModuleSnapshot &snapshot, Module &module, Area &area);
+
+private:
+    static constexpr int kMinCapacity = 2;
+
+    int _capacity;
+
+    std::list<std::pair<std::string, std::shared_ptr<Module>>> _resident; /**< most recently used first */
+    std::map<std::string, ModuleSnapshot> _snapshots;
+};
+
+} // namespace game
+
+} // namespace reone
@@ -21,7 +21,7 @@
 #include "reone/scene/graph.h"
 #include "reone/scene/node.h"
 #include "reone/scene/user.h"
-#include "reone/system/timer.h"
+#include "reone/system/timerqueue.h"
 
 #include "action.h"
 #include "action/playanimation.h"
@@ -77,6 +77,7 @@ public:
     const std::string &name() const { return _name; }
     const std::string &conversation() const { return _conversation; }
     bool plotFlag() const { return _plot; }
+    int gitIndex() const { return _gitIndex; }
 
     Room *room() const { return _room; }
     const glm::vec3 &position() const { return _position; }
@@ -86,6 +87,7 @@ public:
 
     void setTag(std::string tag) { _tag = std::move(tag); }
     void setPlotFlag(bool plot) { _plot = plot; }
+    void setGitIndex(int index) { _gitIndex = index; }
     void setCommandable(bool commandable) { _commandable = commandable; }
 
     void setRoom(Room *room);
@@ -197,15 +199,9 @@ public:
     // END Scripts
 
 protected:
-    struct DelayedAction {
-        std::shared_ptr<Action> action;
-        std::unique_ptr<Timer> timer;
-    };
-
     struct AppliedEffect {
         std::shared_ptr<Effect> effect;
         DurationType durationType {DurationType::Instant};
-        float duration {0.0f};
     };
 
     uint32_t _id;
@@ -218,6 +214,7 @@ protected:
     std::string _blueprintResRef;
     std::string _name;
     std::string _conversation;
+    int _gitIndex {-1}; /**< index in the area GIT list of this object type, -1 if spawned at runtime */
     bool _minOneHP {false};
     int _hitPoints {0};
     int _maxHitPoints {0};
@@ -244,10 +241,11 @@ protected:
     int _itemIndex {0};
     int _effectIndex {0};
 
+    TimerQueue _timers; /**< delayed actions and expiry of temporary effects */
+
     // Actions
 
     std::deque<std::shared_ptr<Action>> _actions;
-    std::vector<DelayedAction> _delayed;
 
     // END Actions
 
@@ -285,7 +283,6 @@ protected:
 
     void updateActions(float dt);
     void removeCompletedActions();
-    void updateDelayedActions(float dt);
 
     void executeActions(float dt);
 
@@ -293,8 +290,8 @@ protected:
 
     // Effects
 
-    void updateEffects(float dt);
     void applyInstantEffect(Effect &effect);
+    void expireEffect(const Effect &effect);
 
     // END Effects
 };
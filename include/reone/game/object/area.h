@@ -88,6 +88,7 @@ public:
     void update3rdPersonCameraFacing();
     void update3rdPersonCameraTarget();
     void landObject(Object &object);
+    void determineObjectRoom(Object &object);
 
     bool moveCreature(const std::shared_ptr<Creature> &creature, const glm::vec2 &dir, bool run, float dt);
     bool moveCreatureTowards(const std::shared_ptr<Creature> &creature, const glm::vec2 &dest, bool run, float dt);
@@ -219,10 +220,10 @@ private:
     std::string _localizedName;
     RoomMap _rooms;
     Visibility _visibility;
+    std::unordered_map<Room *, std::vector<Room *>> _visibleRoomsByRoom; /**< potentially visible sets, each including the room itself */
     CameraStyle _camStyleDefault;
     CameraStyle _camStyleCombat;
     std::string _music;
-    Timer _heartbeatTimer;
     bool _unescapable {false};
     Grass _grass;
     glm::vec3 _ambientColor {0.0f};
@@ -249,6 +250,19 @@ private:
 
     // END Cameras
 
+    // Visibility
+
+    Room *_pvsLeaderRoom {nullptr};
+    Room *_pvsCameraRoom {nullptr};
+    bool _pvsAllVisible {false};
+    bool _pvsValid {false};
+
+    glm::vec3 _cameraRoomPosition {0.0f};
+    Room *_cameraRoom {nullptr};
+    bool _cameraRoomValid {false};
+
+    // END Visibility
+
     // Objects
 
     ObjectList _objects;
@@ -283,10 +297,13 @@ private:
     void loadPTH();
 
     void add(const std::shared_ptr<Object> &object);
+    void remove(Object &object);
     void doDestroyObject(uint32_t objectId);
     void doDestroyObjects();
     void updateVisibility();
-    void updateHeartbeat(float dt);
+    void cacheRoomVisibility();
+    void scheduleHeartbeat();
+    void runHeartbeatScripts();
 
     void doUpdatePerception();
     void updateObjectSelection();
@@ -300,9 +317,16 @@ private:
      */
     Visibility fixVisibility(const Visibility &visiblity);
 
-    void determineObjectRoom(Object &object);
+    /**
+     * Finds the room under the active camera. Result is reused until the
+     * camera moves.
+     */
+    Room *getCameraRoom();
+
     void checkTriggersIntersection(const std::shared_ptr<Object> &triggerrer);
 
+    void prefetchResources(const schema::GIT &git);
+
     // Loading ARE
 
     void loadARE(const schema::ARE &are);
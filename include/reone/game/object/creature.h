@@ -108,6 +108,11 @@ public:
     void clearAllActions() override;
     void die() override;
 
+    /**
+     * Puts creature into the dead state, without running the death script.
+     */
+    void markDead();
+
     void giveXP(int amount);
 
     void playSound(SoundSetEntry entry, bool positional = true);
@@ -27,8 +27,10 @@ namespace game {
 
 struct GameOptions {
     std::filesystem::path path;
+    std::filesystem::path cachePath {"cache"}; /**< processed asset cache directory, empty to disable */
     bool developer {false};
     bool neo {false};
+    int residentModules {4};
 };
 
 struct OptionsView {
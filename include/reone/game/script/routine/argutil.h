@@ -47,23 +47,23 @@ class Talent;
 std::shared_ptr<Object> getCaller(const RoutineContext &ctx);
 std::shared_ptr<Object> getTriggerrer(const RoutineContext &ctx);
 
-int getInt(const std::vector<script::Variable> &args, int index);
-float getFloat(const std::vector<script::Variable> &args, int index);
-std::string getString(const std::vector<script::Variable> &args, int index);
-glm::vec3 getVector(const std::vector<script::Variable> &args, int index);
-std::shared_ptr<Object> getObject(const std::vector<script::Variable> &args, int index, const RoutineContext &ctx);
-std::shared_ptr<Effect> getEffect(const std::vector<script::Variable> &args, int index);
-std::shared_ptr<Event> getEvent(const std::vector<script::Variable> &args, int index);
-std::shared_ptr<Location> getLocationArgument(const std::vector<script::Variable> &args, int index);
-std::shared_ptr<Talent> getTalent(const std::vector<script::Variable> &args, int index);
-std::shared_ptr<script::ExecutionContext> getAction(const std::vector<script::Variable> &args, int index);
+int getInt(const script::VariableSpan &args, int index);
+float getFloat(const script::VariableSpan &args, int index);
+std::string getString(const script::VariableSpan &args, int index);
+glm::vec3 getVector(const script::VariableSpan &args, int index);
+std::shared_ptr<Object> getObject(const script::VariableSpan &args, int index, const RoutineContext &ctx);
+std::shared_ptr<Effect> getEffect(const script::VariableSpan &args, int index);
+std::shared_ptr<Event> getEvent(const script::VariableSpan &args, int index);
+std::shared_ptr<Location> getLocationArgument(const script::VariableSpan &args, int index);
+std::shared_ptr<Talent> getTalent(const script::VariableSpan &args, int index);
+std::shared_ptr<script::ExecutionContext> getAction(const script::VariableSpan &args, int index);
 
-int getIntOrElse(const std::vector<script::Variable> &args, int index, int defValue);
-float getFloatOrElse(const std::vector<script::Variable> &args, int index, float defValue);
-std::string getStringOrElse(const std::vector<script::Variable> &args, int index, std::string defValue);
-glm::vec3 getVectorOrElse(const std::vector<script::Variable> &args, int index, glm::vec3 defValue);
-std::shared_ptr<Object> getObjectOrNull(const std::vector<script::Variable> &args, int index, const RoutineContext &ctx);
-std::shared_ptr<Object> getObjectOrCaller(const std::vector<script::Variable> &args, int index, const RoutineContext &ctx);
+int getIntOrElse(const script::VariableSpan &args, int index, int defValue);
+float getFloatOrElse(const script::VariableSpan &args, int index, float defValue);
+std::string getStringOrElse(const script::VariableSpan &args, int index, std::string defValue);
+glm::vec3 getVectorOrElse(const script::VariableSpan &args, int index, glm::vec3 defValue);
+std::shared_ptr<Object> getObjectOrNull(const script::VariableSpan &args, int index, const RoutineContext &ctx);
+std::shared_ptr<Object> getObjectOrCaller(const script::VariableSpan &args, int index, const RoutineContext &ctx);
 
 std::shared_ptr<Creature> checkCreature(const std::shared_ptr<Object> &object);
 std::shared_ptr<Door> checkDoor(const std::shared_ptr<Object> &object);
@@ -17,17 +17,19 @@
 
 #pragma once
 
+#include "reone/script/executioncontext.h"
 #include "reone/script/routine.h"
 #include "reone/script/routines.h"
 
 #include "../types.h"
 
+#include "routine/context.h"
+
 namespace reone {
 
 namespace game {
 
 struct ServicesView;
-struct RoutineContext;
 
 class Game;
 
@@ -46,7 +48,17 @@ public:
         std::string name,
         script::VariableType retType,
         std::vector<script::VariableType> argTypes,
-        script::Variable (*fn)(const std::vector<script::Variable> &args, const RoutineContext &ctx));
+        script::RoutineFunc fn);
+
+    /**
+     * Adapts routine implementation to the script routine calling convention.
+     * Arguments are passed through as is, without being copied.
+     */
+    template <script::Variable (*Fn)(const script::VariableSpan &, const RoutineContext &)>
+    static script::Variable thunk(const script::VariableSpan &args, script::ExecutionContext &execution) {
+        auto &routines = static_cast<Routines &>(*execution.routines);
+        return Fn(args, RoutineContext(*routines._game, *routines._services, execution));
+    }
 
     script::Routine &get(int index) override;
 
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "reone/system/types.h"
+
+#include "types.h"
+
+namespace reone {
+
+namespace graphics {
+
+class Texture;
+class Walkmesh;
+
+// Engine-ready blobs of processed resources, stored in the asset cache
+
+ByteBuffer writeTextureBlob(const Texture &texture);
+std::shared_ptr<Texture> readTextureBlob(ByteBuffer &blob, std::string name, TextureUsage usage);
+
+ByteBuffer writeWalkmeshBlob(const Walkmesh &walkmesh);
+std::shared_ptr<Walkmesh> readWalkmeshBlob(ByteBuffer &blob);
+
+} // namespace graphics
+
+} // namespace reone
@@ -26,6 +26,7 @@
 #include "../models.h"
 #include "../pipeline.h"
 #include "../shaders.h"
+#include "../spritebatch.h"
 #include "../textures.h"
 #include "../uniforms.h"
 #include "../walkmeshes.h"
@@ -56,6 +57,7 @@ public:
     graphics::Models &models() { return *_models; }
     graphics::Pipeline &pipeline() { return *_pipeline; }
     graphics::Shaders &shaders() { return *_shaders; }
+    graphics::SpriteBatch &spriteBatch() { return *_spriteBatch; }
     graphics::Textures &textures() { return *_textures; }
     graphics::Uniforms &uniforms() { return *_uniforms; }
     graphics::Walkmeshes &walkmeshes() { return *_walkmeshes; }
@@ -74,6 +76,7 @@ protected:
     std::unique_ptr<graphics::Models> _models;
     std::unique_ptr<graphics::Pipeline> _pipeline;
     std::unique_ptr<graphics::Shaders> _shaders;
+    std::unique_ptr<graphics::SpriteBatch> _spriteBatch;
     std::unique_ptr<graphics::Textures> _textures;
     std::unique_ptr<graphics::Uniforms> _uniforms;
     std::unique_ptr<graphics::Walkmeshes> _walkmeshes;
@@ -28,6 +28,7 @@ class IMeshes;
 class IModels;
 class IPipeline;
 class IShaders;
+class ISpriteBatch;
 class ITextures;
 class IUniforms;
 class IWalkmeshes;
@@ -41,6 +42,7 @@ struct GraphicsServices {
     IModels &models;
     IPipeline &pipeline;
     IShaders &shaders;
+    ISpriteBatch &spriteBatch;
     ITextures &textures;
     IUniforms &uniforms;
     IWalkmeshes &walkmeshes;
@@ -54,6 +56,7 @@ struct GraphicsServices {
         IModels &models,
         IPipeline &pipeline,
         IShaders &shaders,
+        ISpriteBatch &spriteBatch,
         ITextures &textures,
         IUniforms &uniforms,
         IWalkmeshes &walkmeshes,
@@ -65,6 +68,7 @@ struct GraphicsServices {
         models(models),
         pipeline(pipeline),
         shaders(shaders),
+        spriteBatch(spriteBatch),
         textures(textures),
         uniforms(uniforms),
         walkmeshes(walkmeshes),
@@ -17,12 +17,23 @@
 
 #pragma once
 
+#include "types.h"
+
 namespace reone {
 
 namespace graphics {
 
-void decompressDXT1(uint32_t width, uint32_t height, const uint8_t *blockStorage, uint32_t *image);
-void decompressDXT5(uint32_t width, uint32_t height, const uint8_t *blockStorage, uint32_t *image);
+/**
+ * Decompresses DXT1 blocks directly into pixels of the specified format, which
+ * must be one of RGB8, RGBA8, BGR8 or BGRA8.
+ */
+void decompressDXT1(int width, int height, const uint8_t *blocks, PixelFormat dstFormat, uint8_t *pixels);
+
+/**
+ * Decompresses DXT5 blocks directly into pixels of the specified format, which
+ * must be one of RGB8, RGBA8, BGR8 or BGRA8.
+ */
+void decompressDXT5(int width, int height, const uint8_t *blocks, PixelFormat dstFormat, uint8_t *pixels);
 
 } // namespace graphics
 
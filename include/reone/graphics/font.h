@@ -17,32 +17,19 @@
 
 #pragma once
 
+#include "spritebatch.h"
 #include "types.h"
 
 namespace reone {
 
 namespace graphics {
 
-class GraphicsContext;
-class Meshes;
-class Shaders;
 class Texture;
-class Textures;
-class Uniforms;
 
 class Font {
 public:
-    Font(
-        GraphicsContext &graphicsContext,
-        Meshes &meshes,
-        Shaders &shaders,
-        Textures &textures,
-        Uniforms &uniforms) :
-        _graphicsContext(graphicsContext),
-        _meshes(meshes),
-        _shaders(shaders),
-        _textures(textures),
-        _uniforms(uniforms) {
+    Font(ISpriteBatch &spriteBatch) :
+        _spriteBatch(spriteBatch) {
     }
 
     void load(std::shared_ptr<Texture> texture);
@@ -53,6 +40,21 @@ public:
         const glm::vec3 &color = glm::vec3(1.0f, 1.0f, 1.0f),
         TextGravity align = TextGravity::CenterCenter);
 
+    /**
+     * Draws glyphs previously laid out using this font.
+     */
+    void draw(const std::vector<Sprite> &glyphs);
+
+    /**
+     * Appends a sprite per character of text to glyphs.
+     */
+    void layout(
+        const std::string &text,
+        const glm::vec3 &position,
+        const glm::vec3 &color,
+        TextGravity align,
+        std::vector<Sprite> &glyphs) const;
+
     float measure(const std::string &text) const;
 
     float height() const { return _height; }
@@ -67,14 +69,11 @@ private:
     std::shared_ptr<Texture> _texture;
     float _height {0.0f};
     std::vector<Glyph> _glyphs;
+    std::vector<Sprite> _glyphSprites;
 
     // Services
 
-    GraphicsContext &_graphicsContext;
-    Meshes &_meshes;
-    Shaders &_shaders;
-    Textures &_textures;
-    Uniforms &_uniforms;
+    ISpriteBatch &_spriteBatch;
 
     // END Services
 
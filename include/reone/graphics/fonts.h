@@ -23,11 +23,8 @@ namespace reone {
 
 namespace graphics {
 
-class GraphicsContext;
-class Meshes;
-class Shaders;
+class ISpriteBatch;
 class Textures;
-class Uniforms;
 
 class IFonts {
 public:
@@ -40,17 +37,9 @@ public:
 
 class Fonts : public IFonts {
 public:
-    Fonts(
-        GraphicsContext &graphicsContext,
-        Meshes &meshes,
-        Shaders &shaders,
-        Textures &textures,
-        Uniforms &uniforms) :
-        _graphicsContext(graphicsContext),
-        _meshes(meshes),
-        _shaders(shaders),
-        _textures(textures),
-        _uniforms(uniforms) {
+    Fonts(ISpriteBatch &spriteBatch, Textures &textures) :
+        _spriteBatch(spriteBatch),
+        _textures(textures) {
     }
 
     void clear() override {
@@ -71,11 +60,8 @@ private:
 
     // Services
 
-    GraphicsContext &_graphicsContext;
-    Meshes &_meshes;
-    Shaders &_shaders;
+    ISpriteBatch &_spriteBatch;
     Textures &_textures;
-    Uniforms &_uniforms;
 
     // END Services
 
@@ -28,10 +28,14 @@ namespace graphics {
 
 class TpcReader : boost::noncopyable {
 public:
-    TpcReader(IInputStream &tpc, std::string resRef, TextureUsage usage) :
+    /**
+     * @param maxBaseSize largest dimension of the mip level to load, or zero to load full resolution
+     */
+    TpcReader(IInputStream &tpc, std::string resRef, TextureUsage usage, int maxBaseSize = 0) :
         _tpc(BinaryReader(tpc)),
         _resRef(std::move(resRef)),
-        _usage(usage) {
+        _usage(usage),
+        _maxBaseSize(maxBaseSize) {
     }
 
     void load();
@@ -39,6 +43,11 @@ public:
     std::shared_ptr<Texture> texture() const { return _texture; }
     const ByteBuffer &txiData() const { return _txiData; }
 
+    int width() const { return _width; }
+    int height() const { return _height; }
+    int numMipMaps() const { return std::max(1, static_cast<int>(_numMipMaps)); }
+    int mipLevel() const { return _mipLevel; }
+
 private:
     enum class EncodingType {
         Grayscale = 1,
@@ -49,6 +58,7 @@ private:
     BinaryReader _tpc;
     std::string _resRef;
     TextureUsage _usage;
+    int _maxBaseSize;
 
     uint32_t _dataSize {0};
     uint16_t _width {0};
@@ -57,6 +67,7 @@ private:
     bool _compressed {false};
     int _numLayers {0};
     uint8_t _numMipMaps {0};
+    int _mipLevel {0};
 
     std::vector<Texture::Layer> _layers;
     Texture::Features _features;
@@ -43,6 +43,14 @@ public:
         _depth = std::move(depth);
     }
 
+    /**
+     * Attaches a single layer of a layered depth texture, e.g. a cube map face or an array element.
+     */
+    void attachDepthLayer(std::shared_ptr<IAttachment> depth, int layer) {
+        _depth = std::move(depth);
+        _depthLayer = layer;
+    }
+
     void attachColorDepth(std::shared_ptr<IAttachment> color, std::shared_ptr<IAttachment> depth) {
         _colors.clear();
         _colors.push_back(std::move(color));
@@ -75,10 +83,11 @@ private:
     std::vector<std::shared_ptr<IAttachment>> _colors;
     std::shared_ptr<IAttachment> _depth;
     std::shared_ptr<IAttachment> _depthStencil;
+    int _depthLayer {-1};
 
     void configure();
 
-    void attachTexture(const Texture &texture, Attachment attachment, int index = 0) const;
+    void attachTexture(const Texture &texture, Attachment attachment, int index = 0, int layer = -1) const;
     void attachRenderbuffer(const Renderbuffer &renderbuffer, Attachment attachment, int index = 0) const;
 
     // OpenGL
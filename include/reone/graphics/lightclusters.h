@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "aabb.h"
+
+namespace reone {
+
+namespace graphics {
+
+class Camera;
+
+struct LightingUniforms;
+
+/**
+ * Assigns lights to clusters: subdivisions of the view frustum, which are
+ * uniform in screen space and exponential in depth. Shading a fragment then
+ * only evaluates lights affecting its cluster.
+ */
+class LightClusters : boost::noncopyable {
+public:
+    /**
+     * Fills cluster bit masks of lighting uniforms from its lights.
+     */
+    void assign(const Camera &camera, LightingUniforms &lighting);
+
+private:
+    glm::mat4 _projection {0.0f};
+    float _zNear {0.0f};
+    float _zFar {0.0f};
+    float _clusterNear {0.0f};
+    float _clusterScale {0.0f};
+
+    std::vector<AABB> _bounds; /**< view space bounds of clusters */
+
+    void computeBounds(const Camera &camera);
+
+    int getSlice(float depth) const;
+};
+
+} // namespace graphics
+
+} // namespace reone
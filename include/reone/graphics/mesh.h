@@ -25,6 +25,14 @@ namespace graphics {
 
 class Mesh : boost::noncopyable {
 public:
+    /**
+     * Defines which CPU-side data outlives the upload to GPU.
+     */
+    enum class Residency {
+        GpuOnly,  /**< render-only: vertices and faces are released after upload */
+        Queryable /**< faces and positions/texture coordinates are kept for CPU queries */
+    };
+
     struct VertexSpec {
         int stride {0};
         int offCoords {-1};
@@ -54,12 +62,17 @@ public:
         }
     };
 
-    Mesh(std::vector<float> vertices, std::vector<Face> faces, VertexSpec spec) :
+    Mesh(std::vector<float> vertices, std::vector<Face> faces, VertexSpec spec, Residency residency = Residency::Queryable) :
         _vertices(std::move(vertices)),
         _faces(std::move(faces)),
-        _spec(std::move(spec)) {
-        computeFaceData();
+        _spec(std::move(spec)),
+        _residency(residency),
+        _numIndices(3 * static_cast<int>(_faces.size())) {
         computeAABB();
+        if (_residency == Residency::Queryable) {
+            copyQueryableData();
+            computeFaceData();
+        }
     }
 
     ~Mesh() { deinit(); }
@@ -70,17 +83,36 @@ public:
     void draw();
     void drawInstanced(int count);
 
+    // Queryable meshes only
+
     std::vector<glm::vec3> getVertexCoords(const Face &face) const;
     glm::vec2 getUV1(const Face &face, const glm::vec3 &baryPosition) const;
     glm::vec2 getUV2(const Face &face, const glm::vec3 &baryPosition) const;
 
     const std::vector<Face> &faces() const { return _faces; }
+
+    // END Queryable meshes only
+
     const AABB &aabb() const { return _aabb; }
 
+    Residency residency() const { return _residency; }
+
+    /**
+     * @return true if interleaved vertex data is still held in RAM, i.e. mesh has not been uploaded to GPU yet
+     */
+    bool hasVertexData() const { return !_vertices.empty(); }
+
 private:
     std::vector<float> _vertices;
     std::vector<Face> _faces;
     VertexSpec _spec;
+    Residency _residency;
+    int _numIndices;
+
+    // Compact copy of vertex data for queryable meshes
+    std::vector<glm::vec3> _positions;
+    std::vector<glm::vec2> _uv1;
+    std::vector<glm::vec2> _uv2;
 
     AABB _aabb;
     bool _inited {false};
@@ -93,8 +125,11 @@ private:
 
     // END OpenGL
 
+    void copyQueryableData();
     void computeFaceData();
     void computeAABB();
+
+    void releaseCpuData();
 };
 
 } // namespace graphics
@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include "reone/system/cache.h"
+
 #include "types.h"
 
 namespace reone {
@@ -52,7 +54,7 @@ private:
     Textures &_textures;
     resource::Resources &_resources;
 
-    std::unordered_map<std::string, std::shared_ptr<Model>> _cache;
+    Cache<std::string, Model> _cache;
 
     std::shared_ptr<Model> doGet(const std::string &resRef);
 };
@@ -36,6 +36,7 @@ struct GraphicsOptions {
     TextureQuality textureQuality {TextureQuality::High};
     int shadowResolution {2048};
     int anisotropicFiltering {2};
+    int textureStreamingBudget {512}; /**< memory for streamed textures in MiB, zero disables streaming */
     float drawDistance {kDefaultObjectDrawDistance};
 };
 
@@ -78,6 +78,12 @@ private:
         }
     };
 
+    struct StaticShadows {
+        const IScene *scene {nullptr}; /**< nullptr if cached static shadows are invalid */
+        uint32_t revision {0};
+        glm::mat4 lightSpace[kNumCubeFaces] {glm::mat4(1.0f)};
+    };
+
     struct Attachments {
         std::shared_ptr<Texture> cbGBufferDiffuse;
         std::shared_ptr<Texture> cbGBufferLightmap;
@@ -103,10 +109,14 @@ private:
         std::shared_ptr<Renderbuffer> dbGBuffer;
         std::shared_ptr<Texture> dbDirectionalLightShadows;
         std::shared_ptr<Texture> dbPointLightShadows;
+        std::shared_ptr<Texture> dbPointLightShadowsStatic;
         std::shared_ptr<Texture> dbOutput;
 
         std::shared_ptr<Framebuffer> fbPointLightShadows;
         std::shared_ptr<Framebuffer> fbDirectionalLightShadows;
+        std::shared_ptr<Framebuffer> fbPointLightShadowsStatic;
+        std::vector<std::shared_ptr<Framebuffer>> fbPointLightShadowsLayers;
+        std::vector<std::shared_ptr<Framebuffer>> fbPointLightShadowsStaticLayers;
         std::shared_ptr<Framebuffer> fbGBuffer;
         std::shared_ptr<Framebuffer> fbOpaqueGeometry;
         std::shared_ptr<Framebuffer> fbTransparentGeometry;
@@ -117,6 +127,8 @@ private:
         std::shared_ptr<Framebuffer> fbPong;
         std::shared_ptr<Framebuffer> fbPongHalf;
         std::shared_ptr<Framebuffer> fbOutput;
+
+        StaticShadows staticShadows;
     };
 
     GraphicsOptions &_options;
@@ -141,6 +153,7 @@ private:
     void computeLightSpaceMatrices(IScene &scene);
 
     void drawShadows(IScene &scene, Attachments &attachments);
+    void drawStaticShadows(IScene &scene, Attachments &attachments);
     void drawOpaqueGeometry(IScene &scene, Attachments &attachments);
     void drawTransparentGeometry(IScene &scene, Attachments &attachments);
     void drawLensFlares(IScene &scene, Framebuffer &dst);
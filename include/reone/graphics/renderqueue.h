@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "shaders.h"
+#include "types.h"
+#include "uniforms.h"
+
+namespace reone {
+
+namespace graphics {
+
+class ITextures;
+class Mesh;
+class Texture;
+
+constexpr int kMaxDrawTextures = 4;
+
+enum class RenderPass {
+    Shadows,
+    Opaque
+};
+
+/**
+ * Per-draw subset of general uniforms. Defaults match GeneralUniforms::resetLocals.
+ */
+struct DrawLocals {
+    glm::mat4 model {1.0f};
+    glm::mat4 modelInv {1.0f};
+    glm::mat3x4 uv {1.0f};
+    glm::vec4 selfIllumColor {1.0f};
+    glm::vec4 heightMapFrameBounds {0.0f};
+    float alpha {1.0f};
+    float waterAlpha {1.0f};
+    float heightMapScaling {1.0f};
+    int featureMask {0};
+    int shadowLayerMask {kShadowLayerMaskAll};
+
+    void apply(GeneralUniforms &general) const;
+};
+
+struct DrawTexture {
+    Texture *texture {nullptr};
+    int unit {TextureUnits::mainTex};
+};
+
+struct DrawCommand {
+    RenderPass pass {RenderPass::Opaque};
+    ShaderProgramId program {ShaderProgramId::None};
+    Mesh *mesh {nullptr};
+    DrawTexture textures[kMaxDrawTextures];
+    DrawLocals locals;
+    int numBones {0};
+    float depth {0.0f}; /**< normalized distance to camera, used to sort front to back */
+};
+
+class IRenderBackend {
+public:
+    virtual ~IRenderBackend() = default;
+
+    virtual void useProgram(ShaderProgramId program) = 0;
+    virtual void bindTexture(Texture &texture, int unit) = 0;
+    virtual void setLocals(const DrawLocals &locals) = 0;
+    virtual void setBones(const glm::mat4 *bones, int count) = 0;
+    virtual void setInstances(const glm::mat4 *models, const glm::mat4 *modelsInv, int count) = 0;
+    virtual void drawMesh(Mesh &mesh) = 0;
+    virtual void drawMeshInstanced(Mesh &mesh, int count) = 0;
+};
+
+class RenderBackend : public IRenderBackend, boost::noncopyable {
+public:
+    RenderBackend(IShaders &shaders, ITextures &textures, IUniforms &uniforms) :
+        _shaders(shaders),
+        _textures(textures),
+        _uniforms(uniforms) {
+    }
+
+    void useProgram(ShaderProgramId program) override;
+    void bindTexture(Texture &texture, int unit) override;
+    void setLocals(const DrawLocals &locals) override;
+    void setBones(const glm::mat4 *bones, int count) override;
+    void setInstances(const glm::mat4 *models, const glm::mat4 *modelsInv, int count) override;
+    void drawMesh(Mesh &mesh) override;
+    void drawMeshInstanced(Mesh &mesh, int count) override;
+
+private:
+    IShaders &_shaders;
+    ITextures &_textures;
+    IUniforms &_uniforms;
+};
+
+/**
+ * Collects draw commands during scene traversal, sorts them by a 64-bit key
+ * (pass, shader program, texture set, mesh, depth) and submits them to a
+ * backend, skipping redundant program and texture changes. Adjacent commands
+ * that only differ by model transform are submitted as a single instanced draw.
+ */
+class RenderQueue : boost::noncopyable {
+public:
+    void clear();
+
+    void add(const DrawCommand &command, const glm::mat4 *bones = nullptr);
+
+    void sort();
+
+    /**
+     * Submits sorted commands of the specified pass.
+     *
+     * @return number of issued draw calls
+     */
+    int submit(RenderPass pass, IRenderBackend &backend) const;
+
+    /**
+     * Submits a single command without any state tracking.
+     */
+    static void submit(const DrawCommand &command, const glm::mat4 *bones, IRenderBackend &backend);
+
+    static uint64_t makeKey(const DrawCommand &command);
+
+    size_t size() const { return _commands.size(); }
+
+private:
+    struct Entry {
+        uint64_t key {0};
+        uint32_t command {0};
+        uint32_t bones {0};
+    };
+
+    std::vector<DrawCommand> _commands;
+    std::vector<glm::mat4> _bones;
+    std::vector<Entry> _entries;
+};
+
+} // namespace graphics
+
+} // namespace reone
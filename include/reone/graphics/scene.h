@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include "types.h"
+
 namespace reone {
 
 namespace graphics {
@@ -27,7 +29,14 @@ class IScene {
 public:
     virtual ~IScene() = default;
 
-    virtual void drawShadows() = 0;
+    /**
+     * Draws shadow casters into layers of the shadow map, culling them against light space frusta.
+     *
+     * @param lightSpace array of light space matrices, one per layer
+     * @param numLayers number of shadow map layers
+     * @param casters which casters to draw
+     */
+    virtual void drawShadows(const glm::mat4 *lightSpace, int numLayers, ShadowCasters casters) = 0;
     virtual void drawOpaque() = 0;
     virtual void drawTransparent() = 0;
     virtual void drawLensFlares() = 0;
@@ -56,6 +65,11 @@ public:
     virtual float shadowStrength() const = 0;
     virtual float shadowRadius() const = 0;
 
+    /**
+     * @return revision of static shadow casters, changed whenever cached static shadows must be redrawn
+     */
+    virtual uint32_t staticShadowsRevision() const = 0;
+
     // END Shadows
 };
 
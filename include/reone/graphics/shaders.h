@@ -34,7 +34,7 @@ enum class ShaderProgramId {
     SimpleColor,
     SimpleTexture,
     GUI,
-    Text,
+    Sprite,
     Points,
 
     PointLightShadows,
@@ -95,7 +95,7 @@ private:
     std::shared_ptr<ShaderProgram> _spSimpleColor;
     std::shared_ptr<ShaderProgram> _spSimpleTexture;
     std::shared_ptr<ShaderProgram> _spGUI;
-    std::shared_ptr<ShaderProgram> _spText;
+    std::shared_ptr<ShaderProgram> _spSprite;
     std::shared_ptr<ShaderProgram> _spPoints;
 
     std::shared_ptr<ShaderProgram> _spPointLightShadows;
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "types.h"
+
+namespace reone {
+
+namespace graphics {
+
+constexpr int kMaxSprites = 16384;
+
+class IGraphicsContext;
+class IShaders;
+class ITextures;
+class IUniforms;
+class IWindow;
+class Texture;
+
+/**
+ * Screen-space textured quad.
+ */
+struct Sprite {
+    glm::vec4 bounds {0.0f}; /**< left, top, width, height */
+
+    /**
+     * Texture coordinates of top left, top right, bottom right and bottom left corners.
+     */
+    glm::vec2 uv[4] {
+        glm::vec2(0.0f, 1.0f),
+        glm::vec2(1.0f, 1.0f),
+        glm::vec2(1.0f, 0.0f),
+        glm::vec2(0.0f, 0.0f)};
+
+    glm::vec4 color {1.0f};
+
+    Sprite() = default;
+
+    Sprite(glm::vec4 bounds, glm::vec4 color = glm::vec4(1.0f)) :
+        bounds(std::move(bounds)),
+        color(std::move(color)) {
+    }
+
+    /**
+     * Transforms texture coordinates the same way GUI shader does.
+     */
+    void transformUV(const glm::mat3x4 &transform);
+};
+
+struct SpriteMaterial {
+    Texture *texture {nullptr};
+    BlendMode blendMode {BlendMode::Normal};
+    bool discard {false};
+    glm::vec3 discardColor {0.0f};
+
+    SpriteMaterial() = default;
+
+    SpriteMaterial(Texture &texture, BlendMode blendMode = BlendMode::Normal) :
+        texture(&texture),
+        blendMode(blendMode) {
+    }
+
+    bool operator==(const SpriteMaterial &other) const {
+        return texture == other.texture &&
+               blendMode == other.blendMode &&
+               discard == other.discard &&
+               (!discard || discardColor == other.discardColor);
+    }
+
+    bool operator!=(const SpriteMaterial &other) const {
+        return !(*this == other);
+    }
+};
+
+class ISpriteBatch {
+public:
+    virtual ~ISpriteBatch() = default;
+
+    /**
+     * Starts accumulating sprites. Calls can be nested: sprites are only
+     * flushed when the outermost batch ends.
+     */
+    virtual void begin() = 0;
+    virtual void end() = 0;
+
+    virtual void draw(const SpriteMaterial &material, const Sprite &sprite) = 0;
+    virtual void draw(const SpriteMaterial &material, const std::vector<Sprite> &sprites) = 0;
+
+    /**
+     * Draws accumulated sprites, issuing one draw call per run of sprites
+     * sharing a material. Drawing order is preserved.
+     */
+    virtual void flush() = 0;
+};
+
+class SpriteBatch : public ISpriteBatch, boost::noncopyable {
+public:
+    SpriteBatch(
+        IGraphicsContext &graphicsContext,
+        IShaders &shaders,
+        ITextures &textures,
+        IUniforms &uniforms,
+        IWindow &window) :
+        _graphicsContext(graphicsContext),
+        _shaders(shaders),
+        _textures(textures),
+        _uniforms(uniforms),
+        _window(window) {
+    }
+
+    ~SpriteBatch() { deinit(); }
+
+    void init();
+    void deinit();
+
+    void begin() override;
+    void end() override;
+
+    void draw(const SpriteMaterial &material, const Sprite &sprite) override;
+    void draw(const SpriteMaterial &material, const std::vector<Sprite> &sprites) override;
+
+    void flush() override;
+
+    int numPendingSegments() const { return static_cast<int>(_segments.size()); }
+    int numPendingSprites() const { return static_cast<int>(_vertices.size() / 4); }
+
+private:
+    struct Vertex {
+        glm::vec2 position {0.0f};
+        glm::vec2 uv {0.0f};
+        glm::vec4 color {1.0f};
+    };
+
+    struct Segment {
+        SpriteMaterial material;
+        int firstSprite {0};
+        int numSprites {0};
+    };
+
+    bool _inited {false};
+    int _depth {0};
+
+    std::vector<Vertex> _vertices;
+    std::vector<Segment> _segments;
+
+    // OpenGL
+
+    uint32_t _vaoId {0};
+    uint32_t _vboId {0};
+    uint32_t _iboId {0};
+
+    // END OpenGL
+
+    // Services
+
+    IGraphicsContext &_graphicsContext;
+    IShaders &_shaders;
+    ITextures &_textures;
+    IUniforms &_uniforms;
+    IWindow &_window;
+
+    // END Services
+
+    void append(const SpriteMaterial &material, const Sprite &sprite);
+};
+
+} // namespace graphics
+
+} // namespace reone
@@ -148,6 +148,25 @@ public:
 
     // END Pixels
 
+    // Streaming
+
+    /**
+     * Records that this texture is drawn covering about size pixels on
+     * screen. Textures that are bound without a recorded size are assumed to
+     * require full resolution.
+     */
+    void requestScreenSize(float size) { _requestedScreenSize = std::max(_requestedScreenSize, size); }
+
+    void resetUsage() {
+        _requestedScreenSize = 0.0f;
+        _bound = false;
+    }
+
+    bool isBound() const { return _bound; }
+    float requestedScreenSize() const { return _requestedScreenSize; }
+
+    // END Streaming
+
     // OpenGL
 
     uint32_t nameGL() const { return _nameGL; }
@@ -166,6 +185,13 @@ private:
     std::vector<Layer> _layers; /**< either one for 2D textures, or six for cube maps */
     Features _features;
 
+    // Streaming
+
+    float _requestedScreenSize {0.0f};
+    bool _bound {false}; /**< bound since usage was last reset */
+
+    // END Streaming
+
     // OpenGL
 
     uint32_t _nameGL {0};
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+namespace graphics {
+
+/**
+ * CPU-side model of streamed texture residency. Tracks, per texture, which
+ * mip level is resident as the base level, and decides which levels to load
+ * next from on-screen demand, so that committed memory stays within budget.
+ * Knows nothing of OpenGL: callers perform transitions and report back.
+ */
+class TextureResidency : boost::noncopyable {
+public:
+    struct Transition {
+        int id {0};
+        int level {0}; /**< mip level to make the base level of the texture */
+    };
+
+    TextureResidency(size_t budget, int maxPendingTransitions) :
+        _budget(budget),
+        _maxPendingTransitions(maxPendingTransitions) {
+    }
+
+    /**
+     * @param size largest dimension of the full resolution level
+     * @param levelSizes size of every mip level in bytes, starting from full resolution
+     * @param residentLevel mip level that is resident initially, and is never evicted
+     * @return texture identifier
+     */
+    int add(int size, std::vector<size_t> levelSizes, int residentLevel);
+    void remove(int id);
+
+    /**
+     * Registers that the texture was drawn covering screenSize pixels since
+     * the last update.
+     */
+    void request(int id, float screenSize);
+
+    /**
+     * Registers that the texture was drawn with an unknown on-screen size
+     * since the last update, which requires full resolution.
+     */
+    void requestFullResolution(int id);
+
+    /**
+     * Consumes requests and decides which transitions to begin. Upgrades are
+     * prioritized by how many levels are missing, then by on-screen size.
+     * Textures are only evicted down to the level they are requested at,
+     * least recently requested first.
+     */
+    std::vector<Transition> update();
+
+    void complete(int id, int level);
+    void cancel(int id);
+
+    bool contains(int id) const { return _entries.count(id) > 0; }
+
+    int residentLevel(int id) const;
+    int pendingLevel(int id) const;
+
+    /**
+     * @return bytes used by resident levels, or to be used by pending upgrades
+     */
+    size_t committedBytes() const;
+
+    size_t budget() const { return _budget; }
+    int numPendingTransitions() const;
+
+private:
+    struct Entry {
+        int size {0};
+        std::vector<size_t> chainSizes; /**< size of mip chain starting at every level */
+        int minResidentLevel {0};
+        int residentLevel {0};
+        int pendingLevel {-1};
+
+        float screenSize {0.0f};
+        bool requested {false};
+        int wantedLevel {0};
+        uint32_t lastRequestFrame {0};
+
+        size_t committedBytes() const {
+            int level = pendingLevel == -1 ? residentLevel : std::min(residentLevel, pendingLevel);
+            return chainSizes[level];
+        }
+    };
+
+    size_t _budget;
+    int _maxPendingTransitions;
+
+    int _nextId {1};
+    uint32_t _frame {0};
+    std::map<int, Entry> _entries;
+
+    int getWantedLevel(const Entry &entry) const;
+};
+
+} // namespace graphics
+
+} // namespace reone
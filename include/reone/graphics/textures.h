@@ -17,13 +17,19 @@
 
 #pragma once
 
+#include "reone/system/cache.h"
+#include "reone/system/threadpool.h"
+
+#include "textureresidency.h"
 #include "types.h"
 
 namespace reone {
 
 namespace resource {
 
+class AssetCache;
 class Resources;
+struct ResourceId;
 
 }
 
@@ -31,6 +37,7 @@ namespace graphics {
 
 class GraphicsOptions;
 class Texture;
+class TpcReader;
 
 class ITextures {
 public:
@@ -39,6 +46,18 @@ public:
 
     virtual void clear() = 0;
 
+    /**
+     * Cancels pending loads of streamed mip levels and waits for the load in
+     * progress, if any. Must be called before resource providers change.
+     */
+    virtual void cancelStreaming() = 0;
+
+    /**
+     * Uploads streamed mip levels that finished loading, and schedules new
+     * loads based on how textures were used since the previous update.
+     */
+    virtual void update() = 0;
+
     virtual void bind(Texture &texture, int unit = TextureUnits::mainTex) = 0;
     virtual void bindBuiltIn() = 0;
 
@@ -60,14 +79,17 @@ public:
 
 class Textures : public ITextures, boost::noncopyable {
 public:
-    Textures(GraphicsOptions &options, resource::Resources &resources) :
+    Textures(GraphicsOptions &options, resource::Resources &resources, resource::AssetCache &assetCache) :
         _options(options),
-        _resources(resources) {
+        _resources(resources),
+        _assetCache(assetCache) {
     }
 
     void init();
 
     void clear() override;
+    void cancelStreaming() override;
+    void update() override;
 
     void bind(Texture &texture, int unit = TextureUnits::mainTex) override;
     void bindBuiltIn() override;
@@ -88,12 +110,27 @@ public:
     // END Built-in
 
 private:
+    struct StreamedTexture {
+        std::weak_ptr<Texture> texture;
+        std::string resRef;
+        TextureUsage usage {TextureUsage::Default};
+        int size {0};
+    };
+
+    struct StreamedLevel {
+        int id {0};
+        int level {0};
+        std::shared_ptr<Texture> texture; /**< null if loading failed */
+        bool canceled {false};
+    };
+
     int _activeUnit {0};
 
     GraphicsOptions &_options;
     resource::Resources &_resources;
+    resource::AssetCache &_assetCache;
 
-    std::unordered_map<std::string, std::shared_ptr<Texture>> _cache;
+    Cache<std::string, Texture> _cache;
 
     // Built-in
 
@@ -108,7 +145,27 @@ private:
 
     // END Built-in
 
+    // Streaming
+
+    std::unique_ptr<TextureResidency> _residency;
+    std::map<int, StreamedTexture> _streamed;
+    std::mutex _streamedMutex; /**< textures are requested from multiple threads */
+
+    std::vector<StreamedLevel> _loadedLevels;
+    std::mutex _loadedLevelsMutex;
+
+    std::map<int, std::shared_ptr<Task>> _streamingTasks; /**< pending loads by texture, accessed from main thread only */
+    std::mutex _streamingMutex;                           /**< held while a streamed level is loading */
+
+    ThreadPool _streamingPool {1}; /**< destroyed first, so that loads in progress complete */
+
+    // END Streaming
+
     std::shared_ptr<Texture> doGet(const std::string &resRef, TextureUsage usage);
+    std::shared_ptr<Texture> findCached(const resource::ResourceId &id, uint64_t sourceHash, TextureUsage usage);
+
+    void addStreamed(const TpcReader &tpc, TextureUsage usage);
+    void loadStreamedLevel(int id, std::string resRef, TextureUsage usage, int maxBaseSize, const std::atomic_bool &canceled);
 };
 
 } // namespace graphics
@@ -27,6 +27,11 @@ void prepareCubemap(Texture &texture);
 
 Texture::Properties getTextureProperties(TextureUsage usage);
 
+/**
+ * @return size in bytes of a single layer of pixels in the specified format
+ */
+int getPixelDataSize(int width, int height, PixelFormat format);
+
 inline bool isCompressed(PixelFormat format) {
     return format == PixelFormat::DXT1 || format == PixelFormat::DXT5;
 }
@@ -28,15 +28,21 @@ constexpr float kDefaultObjectDrawDistance = 64.0f;
 constexpr int kNumCubeFaces = 6;
 constexpr int kNumShadowCascades = 4;
 constexpr int kNumShadowLightSpace = 6;
+constexpr int kShadowLayerMaskAll = (1 << kNumShadowLightSpace) - 1;
 constexpr int kNumSSAOSamples = 64;
 
 constexpr int kMaxBones = 24;
 constexpr int kMaxLights = 64;
 constexpr int kMaxParticles = 64;
-constexpr int kMaxTextChars = 128;
 constexpr int kMaxGrassClusters = 256;
 constexpr int kMaxWalkmeshMaterials = 64;
 constexpr int kMaxPoints = 128;
+constexpr int kMaxInstances = 64;
+
+constexpr int kNumLightClustersX = 16;
+constexpr int kNumLightClustersY = 8;
+constexpr int kNumLightClustersZ = 8;
+constexpr int kNumLightClusters = kNumLightClustersX * kNumLightClustersY * kNumLightClustersZ;
 
 enum class TextureUsage {
     Default,
@@ -139,6 +145,12 @@ enum class CameraType {
     Perspective
 };
 
+enum class ShadowCasters {
+    Static, /**< casters whose shadows can be cached between frames */
+    Dynamic,
+    All
+};
+
 struct TextureUnits {
     // 2D
 
@@ -170,7 +182,6 @@ struct TextureUnits {
 
 struct UniformBlockBindingPoints {
     static constexpr int general = 0;
-    static constexpr int text = 1;
     static constexpr int lighting = 2;
     static constexpr int skeletal = 3;
     static constexpr int particles = 4;
@@ -178,6 +189,8 @@ struct UniformBlockBindingPoints {
     static constexpr int ssao = 6;
     static constexpr int walkmesh = 7;
     static constexpr int points = 8;
+    static constexpr int locals = 9;
+    static constexpr int instances = 10;
 };
 
 // MDL
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+namespace graphics {
+
+/**
+ * Uniform buffer that is sub-allocated sequentially. Every write goes to the
+ * next suitably aligned range, which is then bound to a binding point. When
+ * the buffer is full, its storage is orphaned and writing starts over, so that
+ * ranges still in use by the GPU are never overwritten.
+ */
+class UniformRingBuffer : boost::noncopyable {
+public:
+    UniformRingBuffer(ptrdiff_t capacity) :
+        _capacity(capacity) {
+    }
+
+    ~UniformRingBuffer() { deinit(); }
+
+    void init();
+    void deinit();
+
+    /**
+     * Copies data into the next free range and binds that range to the binding point.
+     */
+    void write(int bindingPoint, const void *data, ptrdiff_t size);
+
+private:
+    ptrdiff_t _capacity;
+
+    bool _inited {false};
+    ptrdiff_t _alignment {256};
+    ptrdiff_t _offset {0};
+
+    // OpenGL
+
+    uint32_t _nameGL {0};
+
+    // END OpenGL
+};
+
+} // namespace graphics
+
+} // namespace reone
@@ -19,6 +19,7 @@
 
 #include "types.h"
 #include "uniformbuffer.h"
+#include "uniformringbuffer.h"
 
 namespace reone {
 
@@ -38,37 +39,53 @@ struct UniformsFeatureFlags {
     static constexpr int hashedalphatest = 0x400;
     static constexpr int premulalpha = 0x800;
     static constexpr int envmapcube = 0x1000;
+    static constexpr int instanced = 0x2000;
 };
 
+/**
+ * General uniforms are split into two uniform blocks: globals, that are
+ * usually set once per frame, and locals, that are set per draw call. Locals
+ * start at screenProjection. Both parts must follow std140 layout.
+ */
 struct GeneralUniforms {
+    // Globals
+
     glm::mat4 projection {1.0f};
-    glm::mat4 screenProjection {1.0f};
     glm::mat4 view {1.0f};
     glm::mat4 viewInv {1.0f};
+    glm::mat4 shadowLightSpace[kNumShadowLightSpace] {glm::mat4(1.0f)};
+    glm::vec4 cameraPosition {0.0f};
+    glm::vec4 worldAmbientColor {1.0f};
+    glm::vec4 fogColor {0.0f};
+    glm::vec4 shadowLightPosition {0.0f}; /**< W = 0 if light is directional */
+    glm::vec4 shadowCascadeFarPlanes {0.0f};
+    float clipNear {kDefaultClipPlaneNear};
+    float clipFar {kDefaultClipPlaneFar};
+    float fogNear {0.0f};
+    float fogFar {0.0f};
+    float shadowStrength {0.0f};
+    float shadowRadius {0.0f};
+    float globalsPadding[2] {0.0f};
+
+    // END Globals
+
+    // Locals
+
+    glm::mat4 screenProjection {1.0f};
     glm::mat4 model {1.0f};
     glm::mat4 modelInv {1.0f};
     glm::mat3x4 uv {1.0f};
-    glm::vec4 cameraPosition {0.0f};
     glm::vec4 color {1.0f};
-    glm::vec4 worldAmbientColor {1.0f};
     glm::vec4 selfIllumColor {1.0f};
     glm::vec4 discardColor {0.0f};
-    glm::vec4 fogColor {0.0f};
-    glm::vec4 shadowLightPosition {0.0f}; /**< W = 0 if light is directional */
     glm::vec4 heightMapFrameBounds {0.0f};
     glm::vec2 screenResolution {0.0f};
     glm::vec2 screenResolutionRcp {0.0f};
     glm::vec2 blurDirection {0.0f};
     glm::ivec2 gridSize {0};
-    float clipNear {kDefaultClipPlaneNear};
-    float clipFar {kDefaultClipPlaneFar};
     float alpha {1.0f};
     float waterAlpha {1.0f};
-    float fogNear {0.0f};
-    float fogFar {0.0f};
     float heightMapScaling {1.0f};
-    float shadowStrength {0.0f};
-    float shadowRadius {0.0f};
     float billboardSize {1.0f};
     float ssaoSampleRadius {0.5f};
     float ssaoBias {0.1f};
@@ -77,9 +94,9 @@ struct GeneralUniforms {
     float ssrMaxSteps {32.0f};
     float sharpenAmount {0.25f};
     int featureMask {0}; /**< any combination of UniformFeaturesFlags */
-    float padding[3];
-    glm::vec4 shadowCascadeFarPlanes {0.0f};
-    glm::mat4 shadowLightSpace[kNumShadowLightSpace] {glm::mat4(1.0f)};
+    int shadowLayerMask {kShadowLayerMaskAll}; /**< shadow map layers to render into */
+
+    // END Locals
 
     void resetGlobals() {
         projection = glm::mat4(1.0f);
@@ -123,6 +140,7 @@ struct GeneralUniforms {
         ssrMaxSteps = 32.0f;
         sharpenAmount = 0.25f;
         featureMask = 0;
+        shadowLayerMask = kShadowLayerMaskAll;
     }
 };
 
@@ -137,8 +155,11 @@ struct LightUniforms {
 
 struct LightingUniforms {
     int numLights {0};
-    float padding[3];
+    float clusterNear {0.0f};
+    float clusterScale {0.0f}; /**< number of depth slices divided by log(far / near) */
+    float padding;
     LightUniforms lights[kMaxLights];
+    glm::uvec4 clusters[kNumLightClusters / 2]; /**< bit masks of lights affecting a cluster, two clusters per element */
 };
 
 struct SkeletalUniforms {
@@ -171,15 +192,6 @@ struct GrassUniforms {
     GrassClusterUniforms clusters[kMaxGrassClusters];
 };
 
-struct TextCharacterUniforms {
-    glm::vec4 posScale {0.0f};
-    glm::vec4 uv {0.0f};
-};
-
-struct TextUniforms {
-    TextCharacterUniforms chars[kMaxTextChars];
-};
-
 struct SSAOUniforms {
     glm::vec4 samples[kNumSSAOSamples] {glm::vec4(0.0f)};
 };
@@ -192,12 +204,31 @@ struct PointsUniforms {
     glm::vec4 points[kMaxPoints] {glm::vec4(0.0f)};
 };
 
+struct UniformsStats {
+    size_t bytesUploaded {0};
+    int numUploads {0};
+};
+
+struct InstancesUniforms {
+    glm::mat4 models[kMaxInstances] {glm::mat4(1.0f)};
+    glm::mat4 modelsInv[kMaxInstances] {glm::mat4(1.0f)};
+};
+
 class IUniforms {
 public:
     virtual ~IUniforms() = default;
 
+    /**
+     * Starts accounting uploads of a new frame.
+     */
+    virtual void beginFrame() = 0;
+
+    /**
+     * @return upload statistics of the previous frame
+     */
+    virtual const UniformsStats &frameStats() const = 0;
+
     virtual void setGeneral(const std::function<void(GeneralUniforms &)> &block) = 0;
-    virtual void setText(const std::function<void(TextUniforms &)> &block) = 0;
     virtual void setLighting(const std::function<void(LightingUniforms &)> &block) = 0;
     virtual void setSkeletal(const std::function<void(SkeletalUniforms &)> &block) = 0;
     virtual void setParticles(const std::function<void(ParticlesUniforms &)> &block) = 0;
@@ -205,6 +236,7 @@ public:
     virtual void setSSAO(const std::function<void(SSAOUniforms &)> &block) = 0;
     virtual void setWalkmesh(const std::function<void(WalkmeshUniforms &)> &block) = 0;
     virtual void setPoints(const std::function<void(PointsUniforms &)> &block) = 0;
+    virtual void setInstances(const std::function<void(InstancesUniforms &)> &block) = 0;
 };
 
 class Uniforms : public IUniforms, boost::noncopyable {
@@ -214,8 +246,11 @@ public:
     void init();
     void deinit();
 
+    void beginFrame() override;
+
+    const UniformsStats &frameStats() const override { return _prevFrameStats; }
+
     void setGeneral(const std::function<void(GeneralUniforms &)> &block) override;
-    void setText(const std::function<void(TextUniforms &)> &block) override;
     void setLighting(const std::function<void(LightingUniforms &)> &block) override;
     void setSkeletal(const std::function<void(SkeletalUniforms &)> &block) override;
     void setParticles(const std::function<void(ParticlesUniforms &)> &block) override;
@@ -223,6 +258,7 @@ public:
     void setSSAO(const std::function<void(SSAOUniforms &)> &block) override;
     void setWalkmesh(const std::function<void(WalkmeshUniforms &)> &block) override;
     void setPoints(const std::function<void(PointsUniforms &)> &block) override;
+    void setInstances(const std::function<void(InstancesUniforms &)> &block) override;
 
 private:
     bool _inited {false};
@@ -230,7 +266,6 @@ private:
     // Uniforms
 
     GeneralUniforms _general;
-    TextUniforms _text;
     LightingUniforms _lighting;
     SkeletalUniforms _skeletal;
     ParticlesUniforms _particles;
@@ -238,13 +273,13 @@ private:
     SSAOUniforms _ssao;
     WalkmeshUniforms _walkmesh;
     PointsUniforms _points;
+    InstancesUniforms _instances;
 
     // END Uniforms
 
     // Uniform Buffers
 
     std::shared_ptr<UniformBuffer> _ubGeneral;
-    std::shared_ptr<UniformBuffer> _ubText;
     std::shared_ptr<UniformBuffer> _ubLighting;
     std::shared_ptr<UniformBuffer> _ubSkeletal;
     std::shared_ptr<UniformBuffer> _ubParticles;
@@ -252,9 +287,17 @@ private:
     std::shared_ptr<UniformBuffer> _ubSSAO;
     std::shared_ptr<UniformBuffer> _ubWalkmesh;
     std::shared_ptr<UniformBuffer> _ubPoints;
+    std::shared_ptr<UniformBuffer> _ubInstances;
+
+    std::unique_ptr<UniformRingBuffer> _rbLocals;
 
     // END Uniform Buffers
 
+    GeneralUniforms _uploadedGeneral;
+
+    UniformsStats _frameStats;
+    UniformsStats _prevFrameStats;
+
     std::unique_ptr<UniformBuffer> initBuffer(const void *data, ptrdiff_t size);
 
     void refreshBuffer(UniformBuffer &buffer, int bindingPoint, const void *data, ptrdiff_t size);
@@ -57,6 +57,7 @@ public:
     bool isAreaWalkmesh() const { return _area; }
 
     const std::vector<Face> &faces() const { return _faces; }
+    const std::shared_ptr<AABB> &rootAABB() const { return _rootAabb; }
 
     void add(Face &&face) {
         _faces.push_back(face);
@@ -66,6 +67,10 @@ public:
         _rootAabb = std::move(aabb);
     }
 
+    void setAreaWalkmesh(bool area) {
+        _area = area;
+    }
+
 private:
     std::vector<Face> _faces;
     std::shared_ptr<AABB> _rootAabb;
@@ -18,6 +18,7 @@
 #pragma once
 
 #include "reone/resource/types.h"
+#include "reone/system/cache.h"
 
 #include "types.h"
 
@@ -25,6 +26,7 @@ namespace reone {
 
 namespace resource {
 
+class AssetCache;
 class Resources;
 
 }
@@ -44,7 +46,7 @@ public:
 
 class Walkmeshes : public IWalkmeshes, boost::noncopyable {
 public:
-    Walkmeshes(resource::Resources &resources);
+    Walkmeshes(resource::Resources &resources, resource::AssetCache &assetCache);
 
     void clear() override;
 
@@ -52,8 +54,9 @@ public:
 
 private:
     resource::Resources &_resources;
+    resource::AssetCache &_assetCache;
 
-    std::unordered_map<std::string, std::shared_ptr<Walkmesh>> _cache;
+    Cache<std::string, Walkmesh> _cache;
 
     std::shared_ptr<Walkmesh> doGet(const std::string &resRef, resource::ResourceType type);
 };
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "reone/graphics/spritebatch.h"
 #include "reone/graphics/texture.h"
 #include "reone/graphics/types.h"
 
@@ -242,6 +243,23 @@ protected:
     virtual const glm::vec3 &getBorderColor() const;
 
 private:
+    /**
+     * Glyphs of the last drawn text, reused until anything affecting the layout changes.
+     */
+    struct TextLayout {
+        std::vector<std::string> lines;
+        graphics::Font *font {nullptr};
+        glm::ivec4 extent {0};
+        glm::ivec2 offset {0};
+        glm::ivec2 size {0};
+        glm::vec3 color {0.0f};
+        TextAlign align {TextAlign::CenterCenter};
+
+        std::vector<graphics::Sprite> glyphs;
+    };
+
+    TextLayout _textLayout;
+
     void loadExtent(const schema::GUI_EXTENT &gui);
     void loadBorder(const schema::GUI_BORDER &gui);
     void loadText(const schema::GUI_TEXT &gui);
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "reone/system/types.h"
+
+#include "id.h"
+
+namespace reone {
+
+namespace resource {
+
+/**
+ * Increment whenever layout of any cached blob changes.
+ */
+constexpr uint32_t kAssetCacheVersion = 1;
+
+constexpr uint64_t kHashSeed = 0xcbf29ce484222325ull;
+
+/**
+ * On-disk cache of processed resources. Blobs are stored per resource, along
+ * with hash of the source bytes they were processed from, so that blobs of
+ * modified resources, or blobs written by a different cache version, are
+ * ignored and later overwritten.
+ */
+class AssetCache : boost::noncopyable {
+public:
+    /**
+     * @param path cache directory, or empty path to disable caching
+     */
+    AssetCache(std::filesystem::path path) :
+        _path(std::move(path)) {
+    }
+
+    void init();
+
+    /**
+     * @return blob processed from source bytes with the specified hash, or nullptr if not cached
+     */
+    std::shared_ptr<ByteBuffer> find(const ResourceId &id, uint64_t sourceHash);
+
+    void add(const ResourceId &id, uint64_t sourceHash, const ByteBuffer &blob);
+
+    bool isEnabled() const { return !_path.empty(); }
+
+private:
+    std::filesystem::path _path;
+
+    std::unordered_set<std::string> _filenames; /**< blobs known to exist */
+    std::mutex _filenamesMutex;
+};
+
+/**
+ * @return FNV-1a style hash of bytes, folding in little-endian 64-bit words
+ *         rather than single bytes. Not compatible with byte-wise FNV-1a.
+ *         Hash of multiple buffers is computed by passing previous hash as seed.
+ */
+uint64_t hashBytes(const ByteBuffer &bytes, uint64_t seed = kHashSeed);
+
+} // namespace resource
+
+} // namespace reone
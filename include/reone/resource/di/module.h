@@ -18,6 +18,7 @@
 #pragma once
 
 #include "../2das.h"
+#include "../assetcache.h"
 #include "../gffs.h"
 #include "../resources.h"
 #include "../strings.h"
@@ -30,8 +31,12 @@ namespace resource {
 
 class ResourceModule : boost::noncopyable {
 public:
-    ResourceModule(std::filesystem::path gamePath) :
-        _gamePath(std::move(gamePath)) {
+    /**
+     * @param cachePath directory of processed asset cache, or empty path to disable it
+     */
+    ResourceModule(std::filesystem::path gamePath, std::filesystem::path cachePath = std::filesystem::path()) :
+        _gamePath(std::move(gamePath)),
+        _cachePath(std::move(cachePath)) {
     }
 
     ~ResourceModule() { deinit(); }
@@ -39,6 +44,7 @@ public:
     void init();
     void deinit();
 
+    AssetCache &assetCache() { return *_assetCache; }
     Gffs &gffs() { return *_gffs; }
     Resources &resources() { return *_resources; }
     Strings &strings() { return *_strings; }
@@ -48,7 +54,9 @@ public:
 
 private:
     std::filesystem::path _gamePath;
+    std::filesystem::path _cachePath;
 
+    std::unique_ptr<AssetCache> _assetCache;
     std::unique_ptr<Gffs> _gffs;
     std::unique_ptr<Resources> _resources;
     std::unique_ptr<Strings> _strings;
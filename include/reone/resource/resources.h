@@ -54,10 +54,12 @@ public:
 class Resources : public IResources, boost::noncopyable {
 public:
     void clear() override {
+        std::lock_guard<std::mutex> lock(_providersMutex);
         _providers.clear();
     }
 
     void clearLocal() override {
+        std::lock_guard<std::mutex> lock(_providersMutex);
         auto toErase = std::remove_if(_providers.begin(), _providers.end(), [](auto &pair) {
             return pair.local;
         });
@@ -65,6 +67,7 @@ public:
     }
 
     void add(std::unique_ptr<IResourceProvider> provider, bool local = false) {
+        std::lock_guard<std::mutex> lock(_providersMutex);
         _providers.push_front(ResourceProviderLocalPair {std::move(provider), local});
     }
 
@@ -81,6 +84,7 @@ public:
 
 private:
     ResourceProviderList _providers;
+    std::mutex _providersMutex; /**< resources are found from worker threads, and providers share file streams between lookups */
 };
 
 } // namespace resource
@@ -17,9 +17,12 @@
 
 #pragma once
 
+#include "reone/graphics/lightclusters.h"
+#include "reone/graphics/renderqueue.h"
 #include "reone/graphics/scene.h"
 
 #include "fogproperties.h"
+#include "nodelist.h"
 #include "node/camera.h"
 #include "node/dummy.h"
 #include "node/emitter.h"
@@ -124,7 +127,7 @@ public:
 
     void update(float dt) override;
 
-    void drawShadows() override;
+    void drawShadows(const glm::mat4 *lightSpace, int numLayers, graphics::ShadowCasters casters) override;
     void drawOpaque() override;
     void drawTransparent() override;
     void drawLensFlares() override;
@@ -164,6 +167,14 @@ public:
     void removeRoot(GrassSceneNode &node) override;
     void removeRoot(SoundSceneNode &node) override;
 
+    /**
+     * Refreshes render lists of the root, that this model belongs to, after
+     * its node tree has changed.
+     */
+    void onModelChanged(ModelSceneNode &model);
+
+    void onMeshTransparencyChanged(MeshSceneNode &mesh);
+
     // END Roots
 
     // Lighting
@@ -208,6 +219,13 @@ public:
     glm::vec3 shadowLightPosition() const override { return _shadowLight->getOrigin(); }
     float shadowStrength() const override { return _shadowStrength; }
     float shadowRadius() const override { return _shadowLight->radius(); }
+    uint32_t staticShadowsRevision() const override { return _staticShadowsRevision; }
+
+    /**
+     * Marks static shadow casters as changed, so that cached static shadows
+     * are redrawn.
+     */
+    void invalidateStaticShadows() { _staticShadowsDirty = true; }
 
     // END Shadows
 
@@ -246,6 +264,12 @@ public:
     // END Factory methods
 
 private:
+    struct ModelLeafs {
+        std::vector<MeshSceneNode *> meshes;
+        std::vector<LightSceneNode *> lights;
+        std::vector<EmitterSceneNode *> emitters;
+    };
+
     std::string _name;
     graphics::GraphicsOptions &_graphicsOpt;
     graphics::GraphicsServices &_graphicsSvc;
@@ -274,15 +298,20 @@ private:
 
     // Leafs
 
-    std::vector<MeshSceneNode *> _opaqueMeshes;
-    std::vector<MeshSceneNode *> _transparentMeshes;
-    std::vector<MeshSceneNode *> _shadowMeshes;
-    std::vector<LightSceneNode *> _lights;
-    std::vector<EmitterSceneNode *> _emitters;
+    NodeList<MeshSceneNode> _opaqueMeshes;
+    NodeList<MeshSceneNode> _transparentMeshes;
+    NodeList<MeshSceneNode> _shadowMeshes;
+    NodeList<LightSceneNode> _lights;
+    NodeList<EmitterSceneNode> _emitters;
+
+    std::unordered_map<ModelSceneNode *, ModelLeafs> _leafsByModel; /**< leafs of unculled model roots */
 
     std::vector<std::pair<SceneNode *, std::vector<SceneNode *>>> _opaqueLeafs;
     std::vector<std::pair<SceneNode *, std::vector<SceneNode *>>> _transparentLeafs;
 
+    graphics::RenderQueue _renderQueue;
+    graphics::RenderQueue _shadowQueue;
+
     // END Leafs
 
     // Lighting
@@ -290,6 +319,7 @@ private:
     glm::vec3 _ambientLightColor {0.5f};
 
     std::vector<LightSceneNode *> _activeLights;
+    graphics::LightClusters _lightClusters;
 
     // END Lighting
 
@@ -300,6 +330,9 @@ private:
 
     LightSceneNode *_shadowLight {nullptr};
 
+    bool _staticShadowsDirty {true};
+    uint32_t _staticShadowsRevision {0}; /**< unique across scene graphs */
+
     // END Shadows
 
     // Fog
@@ -319,15 +352,20 @@ private:
     void cullRoots();
 
     void refresh();
-    void refreshFromNode(SceneNode &node);
+
+    void addModelLeafs(ModelSceneNode &model);
+    void removeModelLeafs(ModelSceneNode &model);
+    void collectModelLeafs(SceneNode &node, ModelLeafs &leafs);
 
     void updateLighting();
     void updateShadowLight(float dt);
+    void updateStaticShadows();
     void updateFlareLights();
     void updateSounds();
 
     void prepareOpaqueLeafs();
     void prepareTransparentLeafs();
+    void prepareRenderQueue();
 
     std::vector<LightSceneNode *> computeClosestLights(int count, const std::function<bool(const LightSceneNode &, float)> &pred) const;
 
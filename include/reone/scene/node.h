@@ -70,7 +70,7 @@ public:
     SceneNodeType type() const { return _type; }
     SceneNode *parent() { return _parent; }
     const SceneNode *parent() const { return _parent; }
-    const std::unordered_set<SceneNode *> &children() const { return _children; }
+    const std::vector<SceneNode *> &children() const { return _children; }
     const graphics::AABB &aabb() const { return _aabb; }
     IUser *user() { return _user; }
     const IUser *user() const { return _user; }
@@ -88,8 +88,17 @@ public:
     // Transformations
 
     const glm::mat4 &localTransform() const { return _localTransform; }
-    const glm::mat4 &absoluteTransform() const { return _absTransform; }
-    const glm::mat4 &absoluteTransformInverse() const { return _absTransformInv; }
+
+    /**
+     * Absolute transform is recomputed lazily, after local transform of this
+     * node or any of its ancestors has changed.
+     */
+    const glm::mat4 &absoluteTransform() const;
+
+    /**
+     * Inverse of absolute transform is only computed on request.
+     */
+    const glm::mat4 &absoluteTransformInverse() const;
 
     void setLocalTransform(glm::mat4 transform);
 
@@ -102,7 +111,7 @@ protected:
     audio::AudioServices &_audioSvc;
 
     SceneNode *_parent {nullptr};
-    std::unordered_set<SceneNode *> _children;
+    std::vector<SceneNode *> _children;
 
     graphics::AABB _aabb;
 
@@ -120,8 +129,10 @@ protected:
     // Transformations
 
     glm::mat4 _localTransform {1.0f};
-    glm::mat4 _absTransform {1.0f};
-    glm::mat4 _absTransformInv {1.0f};
+    mutable glm::mat4 _absTransform {1.0f};
+    mutable glm::mat4 _absTransformInv {1.0f};
+    mutable bool _absTransformDirty {false};
+    mutable bool _absTransformInvDirty {false};
 
     // END Transformations
 
@@ -136,8 +147,12 @@ protected:
         _audioSvc(audioSvc) {
     }
 
-    void computeAbsoluteTransforms();
+    void invalidateAbsoluteTransforms();
+    void computeAbsoluteTransform() const;
 
+    /**
+     * Called when absolute transform of this node is invalidated.
+     */
     virtual void onAbsoluteTransformChanged() {}
 };
 
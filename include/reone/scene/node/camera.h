@@ -40,13 +40,18 @@ public:
 
     bool isInFrustum(const SceneNode &other) const;
 
-    std::shared_ptr<graphics::Camera> camera() const { return _camera; }
+    /**
+     * Returns camera, whose view matrix is synchronized with absolute
+     * transform of this node.
+     */
+    std::shared_ptr<graphics::Camera> camera() const;
 
     void setOrthographicProjection(float left, float right, float bottom, float top, float zNear, float zFar);
     void setPerspectiveProjection(float fovy, float aspect, float zNear, float zFar);
 
 private:
     std::shared_ptr<graphics::Camera> _camera;
+    mutable bool _viewDirty {false};
 
     void onAbsoluteTransformChanged() override;
 };
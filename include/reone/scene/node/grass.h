@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "reone/graphics/mesh.h"
 #include "reone/graphics/modelnode.h"
 #include "reone/graphics/types.h"
 
@@ -67,9 +68,30 @@ private:
     GrassProperties _properties;
     graphics::ModelNode &_aabbNode;
 
-    std::vector<int> _grassFaces;
-    std::stack<GrassClusterSceneNode *> _clusterPool;                          /**< pre-allocated pool of clusters */
-    std::map<int, std::vector<GrassClusterSceneNode *>> _materializedClusters; /**< materialized clusters grouped by face */
+    struct MaterializedFace {
+        int faceIdx {0};
+        std::vector<GrassClusterSceneNode *> clusters;
+    };
+
+    // Spatial index
+
+    glm::vec2 _gridOrigin {0.0f};
+    glm::ivec2 _gridSize {0};
+    std::vector<int> _cellOffsets; /**< offset of each cell into _cellFaces, plus end offset */
+    std::vector<int> _cellFaces;   /**< grass faces grouped by cell */
+
+    // END Spatial index
+
+    std::stack<GrassClusterSceneNode *> _clusterPool; /**< pre-allocated pool of clusters */
+    std::vector<MaterializedFace> _materializedFaces;
+    std::vector<bool> _faceMaterialized; /**< indexed by face */
+
+    glm::vec3 _lastCameraPos {0.0f};
+    bool _refreshPending {true}; /**< refresh grass regardless of camera movement */
+
+    glm::ivec2 getCell(const glm::vec2 &position) const;
+
+    void retireOutOfDistanceFaces(const std::vector<graphics::Mesh::Face> &faces, const glm::vec3 &cameraPos);
 };
 
 } // namespace scene
@@ -21,6 +21,13 @@
 
 namespace reone {
 
+namespace graphics {
+
+class RenderQueue;
+struct DrawCommand;
+
+} // namespace graphics
+
 namespace scene {
 
 class ModelSceneNode;
@@ -49,20 +56,32 @@ public:
     void update(float dt) override;
 
     void draw();
-    void drawShadow();
+
+    void enqueue(graphics::RenderQueue &queue, float depth);
+    void enqueueShadow(graphics::RenderQueue &queue, int layerMask = graphics::kShadowLayerMaskAll);
+
+    /**
+     * Records on-screen size of this mesh in pixels for streaming of its textures.
+     */
+    void requestTextureScreenSize(float size);
 
     bool shouldRender() const;
     bool shouldCastShadows() const;
 
-    bool isTransparent() const;
+    /**
+     * @return true if this mesh is expected to cast the same shadow over many frames
+     */
+    bool isStaticShadowCaster() const;
+
+    bool isTransparent() const { return _transparent; }
 
     ModelSceneNode &model() { return _model; }
     const ModelSceneNode &model() const { return _model; }
 
     void setDiffuseMap(graphics::Texture *texture) override;
     void setEnvironmentMap(graphics::Texture *texture) override;
-    void setAlpha(float alpha) { _alpha = alpha; }
-    void setSelfIllumColor(glm::vec3 color) { _selfIllumColor = std::move(color); }
+    void setAlpha(float alpha);
+    void setSelfIllumColor(glm::vec3 color);
 
 private:
     struct NodeTextures {
@@ -79,12 +98,21 @@ private:
     int _bumpmapCycleFrame {0};
     float _alpha {1.0f};
     glm::vec3 _selfIllumColor {0.0f};
+    bool _transparent {false};
 
     void initTextures();
 
     void refreshAdditionalTextures();
 
     bool isLightingEnabled() const;
+    bool computeTransparent() const;
+
+    /**
+     * Recomputes transparency and notifies the scene graph when it changes.
+     */
+    void refreshTransparency();
+
+    bool prepareDraw(graphics::DrawCommand &command, glm::mat4 *bones) const;
 
     // Animation
 
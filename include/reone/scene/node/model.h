@@ -147,7 +147,8 @@ private:
 
     // Lookups
 
-    std::unordered_map<uint16_t, ModelNodeSceneNode *> _nodeByNumber;
+    std::vector<ModelNodeSceneNode *> _nodes; /**< parents precede their children */
+    std::vector<ModelNodeSceneNode *> _nodeByNumber;
     std::unordered_map<std::string, ModelNodeSceneNode *> _nodeByName;
     std::unordered_map<std::string, SceneNode *> _attachments;
 
@@ -167,6 +168,7 @@ private:
     // END Flags
 
     void buildNodeTree(graphics::ModelNode &node, SceneNode &parent);
+    void computeNodeTransforms();
 
     // Animation
 
@@ -178,6 +180,8 @@ private:
     static AnimationBlendMode getAnimationBlendMode(int flags);
 
     // END Animation
+
+    void onAbsoluteTransformChanged() override;
 };
 
 } // namespace scene
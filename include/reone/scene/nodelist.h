@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+namespace reone {
+
+namespace scene {
+
+/**
+ * Ordered set of scene node pointers with O(1) insertion, lookup and removal.
+ *
+ * Nodes are stored contiguously, in the order they were added. Removal leaves
+ * a hole, which is closed by compact, preserving the order of remaining nodes.
+ */
+template <class T>
+class NodeList : boost::noncopyable {
+public:
+    using const_iterator = typename std::vector<T *>::const_iterator;
+
+    /**
+     * @return true if node was added, false if already present
+     */
+    bool add(T &node) {
+        if (_indices.count(&node) > 0) {
+            return false;
+        }
+        _indices[&node] = _nodes.size();
+        _nodes.push_back(&node);
+        return true;
+    }
+
+    /**
+     * @return true if node was removed, false if not present
+     */
+    bool remove(T &node) {
+        auto it = _indices.find(&node);
+        if (it == _indices.end()) {
+            return false;
+        }
+        _nodes[it->second] = nullptr;
+        _indices.erase(it);
+        ++_numHoles;
+        return true;
+    }
+
+    void clear() {
+        _nodes.clear();
+        _indices.clear();
+        _numHoles = 0;
+    }
+
+    /**
+     * Closes holes left by removed nodes. Must be called before iterating.
+     */
+    void compact() {
+        if (_numHoles == 0) {
+            return;
+        }
+        size_t size = 0;
+        for (auto node : _nodes) {
+            if (!node) {
+                continue;
+            }
+            _indices[node] = size;
+            _nodes[size++] = node;
+        }
+        _nodes.resize(size);
+        _numHoles = 0;
+    }
+
+    bool contains(const T &node) const {
+        return _indices.count(const_cast<T *>(&node)) > 0;
+    }
+
+    bool empty() const { return _indices.empty(); }
+    size_t size() const { return _indices.size(); }
+
+    const_iterator begin() const { return _nodes.begin(); }
+    const_iterator end() const { return _nodes.end(); }
+
+private:
+    std::vector<T *> _nodes;
+    std::unordered_map<T *, size_t> _indices;
+    size_t _numHoles {0};
+};
+
+} // namespace scene
+
+} // namespace reone
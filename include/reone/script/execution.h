@@ -50,6 +50,7 @@ private:
     std::unique_ptr<ExecutionContext> _context;
     std::unordered_map<InstructionType, std::function<void(const Instruction &)>> _handlers;
     std::vector<Variable> _stack;
+    std::vector<Variable> _routineArgs; /**< reused by routines that cannot read arguments from the stack */
     std::vector<uint32_t> _returnOffsets;
     uint32_t _nextInstruction {0};
     int _globalCount {0};
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "executioncontext.h"
+#include "routine.h"
+#include "routines.h"
+#include "variable.h"
+
+namespace reone {
+
+namespace script {
+
+/**
+ * Ahead-of-time compiled script. Receives the same context as the interpreter
+ * and returns what the interpreted program would have left on top of the stack.
+ */
+using NativeScriptFunc = int (*)(ExecutionContext &ctx);
+
+/**
+ * Native counterparts of compiled scripts, generated by codegen. A native
+ * function is only used when the hash of the NCS it was generated from
+ * matches the hash of the NCS being loaded.
+ */
+class NativeScripts : boost::noncopyable {
+public:
+    void add(std::string resRef, uint32_t hash, NativeScriptFunc func);
+
+    NativeScriptFunc find(const std::string &resRef, uint32_t hash) const;
+
+    bool empty() const { return _scripts.empty(); }
+
+private:
+    struct NativeScript {
+        uint32_t hash {0};
+        NativeScriptFunc func {nullptr};
+    };
+
+    std::unordered_map<std::string, std::vector<NativeScript>> _scripts;
+};
+
+/**
+ * @return FNV-1a hash of compiled script bytes
+ */
+uint32_t hashScriptBytes(const char *bytes, size_t size);
+
+// Runtime support for generated code. Mirrors what the interpreter does for
+// the corresponding instructions.
+
+constexpr float kNativeFloatTolerance = 1e-5f;
+
+inline Variable callRoutine(ExecutionContext &ctx, int routine, std::initializer_list<Variable> args) {
+    return ctx.routines->get(routine).invoke(VariableSpan(args.begin(), args.size()), ctx);
+}
+
+inline bool nativeEqual(float left, float right) {
+    return std::fabs(left - right) < kNativeFloatTolerance;
+}
+
+inline float nativeDivide(float left, float right) {
+    return left / std::max(kNativeFloatTolerance, right);
+}
+
+inline int32_t nativeShiftRight(int32_t left, int32_t right) {
+    return left < 0 ? -((-left) >> right) : (left >> right);
+}
+
+} // namespace script
+
+} // namespace reone
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "native.h"
 #include "types.h"
 
 namespace reone {
@@ -92,7 +93,13 @@ public:
 
     const Instruction &getInstruction(uint32_t offset) const;
 
+    /**
+     * @return ahead-of-time compiled counterpart of this program, if any
+     */
+    NativeScriptFunc native() const { return _native; }
+
     void setLength(uint32_t length) { _length = length; }
+    void setNative(NativeScriptFunc native) { _native = native; }
 
 private:
     std::string _name;
@@ -100,6 +107,7 @@ private:
     uint32_t _length {13};
     std::vector<Instruction> _instructions;
     std::unordered_map<uint32_t, int> _insIdxByOffset;
+    NativeScriptFunc _native {nullptr};
 };
 
 } // namespace script
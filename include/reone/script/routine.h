@@ -26,6 +26,8 @@ namespace script {
 
 struct ExecutionContext;
 
+using RoutineFunc = Variable (*)(const VariableSpan &args, ExecutionContext &ctx);
+
 class Routine {
 public:
     Routine() = default;
@@ -35,19 +37,31 @@ public:
         VariableType retType,
         Variable defRetValue,
         std::vector<VariableType> argTypes,
-        std::function<Variable(const std::vector<Variable> &, ExecutionContext &ctx)> fn) :
+        RoutineFunc fn) :
         _name(std::move(name)),
         _returnType(retType),
         _defaultReturnValue(std::move(defRetValue)),
         _argumentTypes(std::move(argTypes)),
-        _func(std::move(fn)) {
+        _func(fn) {
+
+        _stackArguments = std::none_of(_argumentTypes.begin(), _argumentTypes.end(), [](auto type) {
+            return type == VariableType::Vector || type == VariableType::Action;
+        });
     }
 
-    virtual Variable invoke(const std::vector<Variable> &args, ExecutionContext &ctx);
+    virtual ~Routine() = default;
+
+    virtual Variable invoke(const VariableSpan &args, ExecutionContext &ctx);
 
     int getArgumentCount() const;
     VariableType getArgumentType(int index) const;
 
+    /**
+     * @return true if every argument occupies exactly one stack variable, so
+     *         that arguments can be read directly from the stack
+     */
+    bool hasStackArguments() const { return _stackArguments; }
+
     const std::string &name() const { return _name; }
     VariableType returnType() const { return _returnType; }
 
@@ -56,7 +70,8 @@ private:
     VariableType _returnType {VariableType::Void};
     Variable _defaultReturnValue;
     std::vector<VariableType> _argumentTypes;
-    std::function<Variable(const std::vector<Variable> &, ExecutionContext &ctx)> _func;
+    RoutineFunc _func {nullptr};
+    bool _stackArguments {true};
 
     Variable onException(const std::string &msg, const std::exception &ex) const;
 };
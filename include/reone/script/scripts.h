@@ -19,6 +19,7 @@
 
 #include "reone/resource/resources.h"
 
+#include "native.h"
 #include "program.h"
 
 namespace reone {
@@ -53,9 +54,13 @@ public:
         return _objects.insert(make_pair(key, std::move(object))).first->second;
     }
 
+    NativeScripts &natives() { return _natives; }
+
 private:
     resource::Resources &_resources;
 
+    NativeScripts _natives;
+
     std::unordered_map<std::string, std::shared_ptr<ScriptProgram>> _objects;
 
     std::shared_ptr<ScriptProgram> doGet(std::string resRef);
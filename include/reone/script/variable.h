@@ -82,6 +82,38 @@ struct Variable {
     static Variable ofAction(std::shared_ptr<ExecutionContext> context);
 };
 
+/**
+ * Non-owning view of a sequence of variables. Negative stride allows viewing
+ * the VM stack from the top, where the first routine argument is.
+ */
+class VariableSpan {
+public:
+    VariableSpan() = default;
+
+    VariableSpan(const std::vector<Variable> &variables) :
+        _first(variables.data()),
+        _size(variables.size()) {
+    }
+
+    VariableSpan(const Variable *first, size_t size, ptrdiff_t stride = 1) :
+        _first(first),
+        _size(size),
+        _stride(stride) {
+    }
+
+    const Variable &operator[](size_t index) const {
+        return _first[static_cast<ptrdiff_t>(index) * _stride];
+    }
+
+    bool empty() const { return _size == 0; }
+    size_t size() const { return _size; }
+
+private:
+    const Variable *_first {nullptr};
+    size_t _size {0};
+    ptrdiff_t _stride {1};
+};
+
 } // namespace script
 
 } // namespace reone
@@ -71,45 +71,50 @@ public:
         });
     }
 
-    std::vector<uint16_t> readUint16Array(int size) {
-        std::vector<uint16_t> elems;
-        elems.reserve(size);
-        for (int i = 0; i < size; ++i) {
-            elems.push_back(readUint16());
-        }
+    std::vector<uint16_t> readUint16Array(int count) {
+        std::vector<uint16_t> elems(count);
+        readUint16Array(elems.data(), count);
         return elems;
     }
 
-    std::vector<uint32_t> readUint32Array(int size) {
-        return readArray<uint32_t>(size, [this]() {
-            return readUint32();
-        });
+    std::vector<uint32_t> readUint32Array(int count) {
+        std::vector<uint32_t> elems(count);
+        readUint32Array(elems.data(), count);
+        return elems;
     }
 
     std::vector<uint32_t> readUint32ArrayAt(size_t off, int count) {
-        return readArrayAt<uint32_t>(off, count, [this]() {
-            return readUint32();
+        return readAt<std::vector<uint32_t>>(off, [this, &count]() {
+            return readUint32Array(count);
         });
     }
 
     std::vector<int32_t> readInt32Array(int count) {
-        return readArray<int32_t>(count, [this]() {
-            return readInt32();
-        });
+        std::vector<int32_t> elems(count);
+        readInt32Array(elems.data(), count);
+        return elems;
     }
 
     std::vector<float> readFloatArray(int count) {
-        return readArray<float>(count, [this]() {
-            return readFloat();
-        });
+        std::vector<float> elems(count);
+        readFloatArray(elems.data(), count);
+        return elems;
     }
 
     std::vector<float> readFloatArrayAt(size_t off, int count) {
-        return readArrayAt<float>(off, count, [this]() {
-            return readFloat();
+        return readAt<std::vector<float>>(off, [this, &count]() {
+            return readFloatArray(count);
         });
     }
 
+    // Bulk reads into caller-provided storage: a single stream read, followed
+    // by an in-place byte swap only when stream endianess differs from native.
+
+    void readUint16Array(uint16_t *out, int count);
+    void readUint32Array(uint32_t *out, int count);
+    void readInt32Array(int32_t *out, int count);
+    void readFloatArray(float *out, int count);
+
     inline size_t position() const {
         return _stream.position();
     }
@@ -127,26 +132,11 @@ public:
         return retval;
     }
 
-    template <class T>
-    std::vector<T> readArray(int size, std::function<T()> read) {
-        std::vector<T> array;
-        array.reserve(size);
-        for (int i = 0; i < size; ++i) {
-            array.push_back(read());
-        }
-        return array;
-    }
-
-    template <class T>
-    std::vector<T> readArrayAt(size_t off, int size, std::function<T()> read) {
-        return readAt<std::vector<T>>(off, [this, &size, &read]() {
-            return readArray<T>(size, read);
-        });
-    }
-
 private:
     IInputStream &_stream;
     boost::endian::order _endianess;
+
+    void readBulk(char *out, size_t size);
 };
 
 } // namespace reone
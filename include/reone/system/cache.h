@@ -19,24 +19,36 @@
 
 namespace reone {
 
+/**
+ * Thread-safe cache of shared values. Values are created outside of the
+ * lock, so that value factories may recursively access the cache. When two
+ * threads create a value for the same key, the first one inserted wins.
+ */
 template <class Key, class Value, class Comparer = std::less<Key>>
 class Cache : boost::noncopyable {
 public:
     void clear() {
+        std::lock_guard<std::mutex> lock(_mutex);
         _items.clear();
     }
 
     std::shared_ptr<Value> getOrAdd(Key key, std::function<std::shared_ptr<Value>()> valueFactory) {
-        auto it = _items.find(key);
-        if (it != _items.end()) {
-            return it->second;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto it = _items.find(key);
+            if (it != _items.end()) {
+                return it->second;
+            }
         }
-        auto [inserted, _] = _items.insert(std::make_pair(std::move(key), valueFactory()));
+        auto value = valueFactory();
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto [inserted, _] = _items.insert(std::make_pair(std::move(key), std::move(value)));
         return inserted->second;
     }
 
 private:
     std::map<Key, std::shared_ptr<Value>, Comparer> _items;
+    std::mutex _mutex;
 };
 
 } // namespace reone
@@ -21,10 +21,24 @@
 
 namespace reone {
 
+#ifdef R_DISABLE_DEBUG_LOG
+constexpr LogSeverity kMinCompiledLogSeverity = LogSeverity::Info;
+#else
+constexpr LogSeverity kMinCompiledLogSeverity = LogSeverity::Debug;
+#endif
+
+/**
+ * Starts a background thread, that writes log messages to the specified file or, if filename is empty, to stderr.
+ */
 void initLog(LogSeverity minSeverity = LogSeverity::Info,
              std::set<LogChannel> channels = std::set<LogChannel> {LogChannel::Global},
              std::string filename = "");
 
+/**
+ * Writes pending log messages and stops the background thread.
+ */
+void deinitLog();
+
 void error(const std::string &s, LogChannel channel = LogChannel::Global);
 void error(const boost::format &s, LogChannel channel = LogChannel::Global);
 void warn(const std::string &s, LogChannel channel = LogChannel::Global);
@@ -35,5 +49,14 @@ void debug(const std::string &s, LogChannel channel = LogChannel::Global);
 void debug(const boost::format &s, LogChannel channel = LogChannel::Global);
 
 bool isLogChannelEnabled(LogChannel channel);
+bool isLogSeverityEnabled(LogSeverity severity);
+
+/**
+ * Cheap check to perform before formatting a log message. Debug messages are
+ * filtered out at compile time when R_DISABLE_DEBUG_LOG is defined.
+ */
+inline bool isLogEnabled(LogSeverity severity, LogChannel channel) {
+    return severity >= kMinCompiledLogSeverity && isLogSeverityEnabled(severity) && isLogChannelEnabled(channel);
+}
 
 } // namespace reone
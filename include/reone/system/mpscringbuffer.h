@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+/**
+ * Bounded lock-free ring buffer for multiple producers and a single consumer.
+ * Every slot carries a sequence number, which tells producers and the consumer
+ * whether the slot is free or holds a value.
+ */
+template <class T>
+class MpscRingBuffer : boost::noncopyable {
+public:
+    MpscRingBuffer(size_t capacity) :
+        _capacity(capacity),
+        _mask(capacity - 1) {
+        if (capacity < 2 || (capacity & (capacity - 1)) != 0) {
+            throw std::invalid_argument("Ring buffer capacity must be a power of two");
+        }
+        _slots = std::make_unique<Slot[]>(capacity);
+        for (size_t i = 0; i < capacity; ++i) {
+            _slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Safe to call from any thread. Value is only moved from on success.
+     *
+     * @return false if ring buffer is full
+     */
+    bool tryPush(T &&value) {
+        size_t pos = _head.load(std::memory_order_relaxed);
+        while (true) {
+            auto &slot = _slots[pos & _mask];
+            size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    slot.value = std::move(value);
+                    slot.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * Must only be called from the consumer thread.
+     *
+     * @return false if ring buffer is empty
+     */
+    bool tryPop(T &value) {
+        auto &slot = _slots[_tail & _mask];
+        size_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if (sequence != _tail + 1) {
+            return false;
+        }
+        value = std::move(slot.value);
+        slot.sequence.store(_tail + _capacity, std::memory_order_release);
+        ++_tail;
+        return true;
+    }
+
+    size_t capacity() const { return _capacity; }
+
+private:
+    struct Slot {
+        std::atomic<size_t> sequence {0};
+        T value;
+    };
+
+    size_t _capacity;
+    size_t _mask;
+    std::unique_ptr<Slot[]> _slots;
+
+    alignas(64) std::atomic<size_t> _head {0};
+    alignas(64) size_t _tail {0};
+};
+
+} // namespace reone
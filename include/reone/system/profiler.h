@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "stream/output.h"
+
+namespace reone {
+
+struct ProfileEvent {
+    const char *name {nullptr};
+    uint64_t startNs {0};
+    uint64_t endNs {0};
+};
+
+struct ProfileZoneStats {
+    std::string name;
+    int count {0};
+    uint64_t totalNs {0};
+};
+
+/**
+ * Fixed capacity ring buffer of profile events. Only the owning thread pushes
+ * events, any thread may take a snapshot. When full, oldest events are
+ * overwritten. One slot is kept spare, as the owning thread may be writing
+ * it while a snapshot is taken.
+ */
+class ProfileEventRing : boost::noncopyable {
+public:
+    ProfileEventRing(uint32_t threadId, size_t capacity) :
+        _threadId(threadId),
+        _events(capacity + 1) {
+        if (capacity == 0) {
+            throw std::invalid_argument("capacity must not be zero");
+        }
+    }
+
+    void push(const ProfileEvent &event) {
+        uint64_t head = _head.load(std::memory_order_relaxed);
+        _events[head % _events.size()] = event;
+        _head.store(head + 1, std::memory_order_release);
+    }
+
+    /**
+     * @return events in the order they were pushed, oldest first
+     */
+    std::vector<ProfileEvent> snapshot() const;
+
+    uint32_t threadId() const { return _threadId; }
+
+private:
+    uint32_t _threadId;
+    std::vector<ProfileEvent> _events;
+    std::atomic<uint64_t> _head {0};
+};
+
+void setProfilingEnabled(bool enabled);
+bool isProfilingEnabled();
+
+/**
+ * @return nanoseconds elapsed since the profiler was initialized
+ */
+uint64_t profileTimestamp();
+
+/**
+ * Records an event into the ring buffer of the calling thread. Name must point
+ * to a string with static storage duration.
+ */
+void profileEvent(const char *name, uint64_t startNs, uint64_t endNs);
+
+/**
+ * @return per-zone totals of events started within [startNs, endNs), sorted by total time in descending order
+ */
+std::vector<ProfileZoneStats> profileZoneStats(uint64_t startNs, uint64_t endNs);
+
+/**
+ * Writes recorded events of all threads in Chrome Trace Event format, as
+ * understood by chrome://tracing and Perfetto.
+ */
+void writeChromeTrace(IOutputStream &stream);
+
+/**
+ * Records the lifetime of this object as a profile event, if profiling is enabled.
+ */
+class ProfileZone : boost::noncopyable {
+public:
+    ProfileZone(const char *name) :
+        _name(name) {
+        if (isProfilingEnabled()) {
+            _startNs = profileTimestamp();
+            _active = true;
+        }
+    }
+
+    ~ProfileZone() {
+        if (_active) {
+            profileEvent(_name, _startNs, profileTimestamp());
+        }
+    }
+
+private:
+    const char *_name;
+    uint64_t _startNs {0};
+    bool _active {false};
+};
+
+#define REONE_PROFILE_CONCAT_IMPL(a, b) a##b
+#define REONE_PROFILE_CONCAT(a, b) REONE_PROFILE_CONCAT_IMPL(a, b)
+
+#define PROFILE_ZONE(name) ::reone::ProfileZone REONE_PROFILE_CONCAT(profileZone, __LINE__)(name)
+
+} // namespace reone
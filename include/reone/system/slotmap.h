@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+/**
+ * Densely packed container, whose elements are addressed by 32-bit handles.
+ *
+ * A handle combines a slot index (lower kIndexBits bits) with a generation
+ * of that slot (upper bits). Lookups are O(1), and handles of erased
+ * elements are detected as stale, even when their slot has been reused.
+ * Elements are stored contiguously, in no particular order. Since
+ * generations start at 1, a handle is never less than 1 << kIndexBits.
+ */
+template <class T>
+class SlotMap : boost::noncopyable {
+public:
+    static constexpr int kIndexBits = 20;
+    static constexpr uint32_t kIndexMask = (1u << kIndexBits) - 1;
+    static constexpr uint32_t kMaxGeneration = (1u << (32 - kIndexBits)) - 1;
+
+    using iterator = typename std::vector<T>::iterator;
+    using const_iterator = typename std::vector<T>::const_iterator;
+
+    uint32_t insert(T value) {
+        uint32_t slotIdx;
+        if (!_freeSlots.empty()) {
+            slotIdx = _freeSlots.back();
+            _freeSlots.pop_back();
+        } else {
+            if (_slots.size() > kIndexMask) {
+                throw std::length_error("SlotMap capacity exceeded");
+            }
+            slotIdx = static_cast<uint32_t>(_slots.size());
+            _slots.push_back(Slot());
+        }
+        auto &slot = _slots[slotIdx];
+        slot.denseIdx = static_cast<uint32_t>(_values.size());
+        slot.occupied = true;
+        _values.push_back(std::move(value));
+        _denseToSlot.push_back(slotIdx);
+        return (slot.generation << kIndexBits) | slotIdx;
+    }
+
+    /**
+     * @return true if element was erased, false if handle is stale
+     */
+    bool erase(uint32_t handle) {
+        auto slot = findSlot(handle);
+        if (!slot) {
+            return false;
+        }
+        // Move last element into the hole to keep elements contiguous
+        uint32_t denseIdx = slot->denseIdx;
+        uint32_t lastDenseIdx = static_cast<uint32_t>(_values.size() - 1);
+        if (denseIdx != lastDenseIdx) {
+            _values[denseIdx] = std::move(_values[lastDenseIdx]);
+            _denseToSlot[denseIdx] = _denseToSlot[lastDenseIdx];
+            _slots[_denseToSlot[denseIdx]].denseIdx = denseIdx;
+        }
+        _values.pop_back();
+        _denseToSlot.pop_back();
+
+        slot->occupied = false;
+        slot->generation = slot->generation == kMaxGeneration ? 1 : slot->generation + 1;
+        _freeSlots.push_back(handle & kIndexMask);
+
+        return true;
+    }
+
+    void clear() {
+        for (uint32_t i = 0; i < _slots.size(); ++i) {
+            auto &slot = _slots[i];
+            if (slot.occupied) {
+                slot.occupied = false;
+                slot.generation = slot.generation == kMaxGeneration ? 1 : slot.generation + 1;
+                _freeSlots.push_back(i);
+            }
+        }
+        _values.clear();
+        _denseToSlot.clear();
+    }
+
+    /**
+     * @return pointer to element or nullptr if handle is stale
+     */
+    T *find(uint32_t handle) {
+        auto slot = findSlot(handle);
+        return slot ? &_values[slot->denseIdx] : nullptr;
+    }
+
+    const T *find(uint32_t handle) const {
+        auto slot = const_cast<SlotMap *>(this)->findSlot(handle);
+        return slot ? &_values[slot->denseIdx] : nullptr;
+    }
+
+    bool contains(uint32_t handle) const {
+        return find(handle) != nullptr;
+    }
+
+    iterator begin() { return _values.begin(); }
+    iterator end() { return _values.end(); }
+    const_iterator begin() const { return _values.begin(); }
+    const_iterator end() const { return _values.end(); }
+
+    size_t size() const { return _values.size(); }
+    bool empty() const { return _values.empty(); }
+
+private:
+    struct Slot {
+        uint32_t denseIdx {0};
+        uint32_t generation {1};
+        bool occupied {false};
+    };
+
+    std::vector<Slot> _slots;
+    std::vector<uint32_t> _freeSlots;
+
+    std::vector<T> _values;
+    std::vector<uint32_t> _denseToSlot;
+
+    Slot *findSlot(uint32_t handle) {
+        uint32_t slotIdx = handle & kIndexMask;
+        if (slotIdx >= _slots.size()) {
+            return nullptr;
+        }
+        auto &slot = _slots[slotIdx];
+        if (!slot.occupied || slot.generation != (handle >> kIndexBits)) {
+            return nullptr;
+        }
+        return &slot;
+    }
+};
+
+} // namespace reone
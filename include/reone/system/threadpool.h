@@ -104,4 +104,11 @@ private:
     }
 };
 
+/**
+ * Invokes func for every index in [0, count) on pool threads and blocks until
+ * all invocations complete. The first exception thrown by func is rethrown.
+ * Must not be called from a pool thread.
+ */
+void parallelFor(IThreadPool &pool, size_t count, const std::function<void(size_t)> &func);
+
 } // namespace reone
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+/**
+ * Schedules callbacks to run after a delay. Pending timers are kept in a
+ * min-heap ordered by due time, so that advancing the queue only touches
+ * timers that are due. Timers that are due at the same time run in the
+ * order they were scheduled.
+ */
+class TimerQueue : boost::noncopyable {
+public:
+    using Callback = std::function<void()>;
+
+    /**
+     * @return id of the scheduled timer, that can be used to cancel it
+     */
+    uint32_t schedule(float delay, Callback callback);
+
+    /**
+     * @return true if timer was pending, false otherwise
+     */
+    bool cancel(uint32_t id);
+
+    /**
+     * Advances time and runs callbacks of due timers. Timers scheduled by
+     * these callbacks will not run before the next update.
+     */
+    void update(float dt);
+
+    void clear();
+
+    bool isPending(uint32_t id) const { return _pending.count(id) > 0; }
+
+    double time() const { return _time; }
+    int size() const { return static_cast<int>(_pending.size()); }
+
+private:
+    struct Entry {
+        double due {0.0};
+        uint32_t id {0};
+        Callback callback;
+    };
+
+    struct EntryLater {
+        bool operator()(const Entry &lhs, const Entry &rhs) const {
+            return lhs.due != rhs.due ? lhs.due > rhs.due : lhs.id > rhs.id;
+        }
+    };
+
+    double _time {0.0};
+    uint32_t _nextId {1};
+
+    std::vector<Entry> _heap;
+    std::unordered_set<uint32_t> _pending;
+};
+
+} // namespace reone
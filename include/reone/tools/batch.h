@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+struct BatchError {
+    std::filesystem::path path;
+    std::string message;
+
+    BatchError() = default;
+
+    BatchError(std::filesystem::path path, std::string message) :
+        path(std::move(path)),
+        message(std::move(message)) {
+    }
+};
+
+/**
+ * Applies a function to every input path, optionally spreading the work
+ * across a ThreadPool. Per-file errors are collected rather than aborting
+ * the batch and are returned in input order, regardless of completion order.
+ */
+class BatchExecutor : boost::noncopyable {
+public:
+    using ItemFunc = std::function<void(const std::filesystem::path &)>;
+    using ProgressFunc = std::function<void(size_t numProcessed, size_t numTotal)>;
+
+    /**
+     * @param numWorkers number of worker threads, 1 to process on the calling thread, -1 to use all hardware threads
+     */
+    BatchExecutor(int numWorkers = 1) :
+        _numWorkers(numWorkers) {
+        if (_numWorkers == 0 || _numWorkers < -1) {
+            throw std::invalid_argument("numWorkers");
+        }
+    }
+
+    /**
+     * Blocks until all input paths are processed. Progress is reported on the
+     * calling thread.
+     */
+    std::vector<BatchError> execute(const std::vector<std::filesystem::path> &input,
+                                    const ItemFunc &func,
+                                    const ProgressFunc &progress = nullptr);
+
+private:
+    int _numWorkers;
+
+    std::vector<BatchError> executeSequential(const std::vector<std::filesystem::path> &input,
+                                              const ItemFunc &func,
+                                              const ProgressFunc &progress);
+
+    std::vector<BatchError> executeParallel(int numWorkers,
+                                            const std::vector<std::filesystem::path> &input,
+                                            const ItemFunc &func,
+                                            const ProgressFunc &progress);
+};
+
+} // namespace reone
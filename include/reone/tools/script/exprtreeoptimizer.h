@@ -88,9 +88,21 @@ public:
 
 class ExpressionTreeOptimizer : public IExpressionTreeOptimizer, boost::noncopyable {
 public:
+    /**
+     * @param compactVariables whether to merge variable declarations with
+     *                         initialization and inline write-once / read-once
+     *                         variables. Both improve readability, but may
+     *                         change order in which actions are evaluated.
+     */
+    ExpressionTreeOptimizer(bool compactVariables = true) :
+        _compactVariables(compactVariables) {
+    }
+
     void optimize(ExpressionTree &tree) override;
 
 private:
+    bool _compactVariables;
+
     void analyze(ExpressionTree &tree, OptimizationContext &ctx);
     void analyzeFunction(Function &func, OptimizationContext &ctx);
 
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../exprtree.h"
+
+namespace reone {
+
+class IOutputStream;
+class TextWriter;
+
+namespace script {
+
+class IRoutines;
+
+/**
+ * Lowers an expression tree into a C++ class that can be registered as a
+ * native script. Expects a tree optimized without variable compaction, so
+ * that actions are evaluated in the original order.
+ *
+ * Throws NotImplementedException for programs that cannot be lowered, e.g.
+ * those passing actions as routine arguments.
+ */
+class CppWriter {
+public:
+    CppWriter(
+        ExpressionTree &program,
+        IRoutines &routines) :
+        _program(program),
+        _routines(routines) {
+    }
+
+    void save(const std::string &className, IOutputStream &stream);
+
+private:
+    struct WriteContext {
+        const Function *function {nullptr};
+        std::set<std::string> writtenLabels;
+    };
+
+    ExpressionTree &_program;
+    IRoutines &_routines;
+
+    void writeFunction(const Function &function, TextWriter &writer);
+    void writeBlock(int level, const BlockExpression &block, WriteContext &ctx, TextWriter &writer);
+    void writeStatement(int level, const Expression &expression, WriteContext &ctx, TextWriter &writer);
+    void writeExpression(const Expression &expression, TextWriter &writer);
+    void writeOperand(const Expression &expression, TextWriter &writer);
+    void writeAction(const ActionExpression &actionExpr, bool result, TextWriter &writer);
+
+    void collectParameters(const Function &function,
+                           std::map<std::string, VariableType> &locals,
+                           std::map<std::string, VariableType> &globals);
+
+    VariableType expressionType(const Expression &expression);
+
+    std::string indentAtLevel(int level);
+
+    std::string describeFunction(const Function &function);
+    std::string describeLabel(const LabelExpression &labelExpr);
+    std::string describeParameter(const ParameterExpression &paramExpr);
+    std::string describeConstant(const Variable &value);
+    std::string describeType(VariableType type);
+    std::string describeDefaultValue(VariableType type);
+};
+
+} // namespace script
+
+} // namespace reone
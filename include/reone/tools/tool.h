@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "batch.h"
 #include "types.h"
 
 #include "reone/resource/exception/format.h"
@@ -44,23 +45,41 @@ public:
 
     virtual bool supports(Operation operation, const std::filesystem::path &input) const = 0;
 
+    /**
+     * @param numWorkers number of files processed concurrently by invokeBatch, -1 to use all hardware threads
+     */
+    void setNumWorkers(int numWorkers) {
+        _numWorkers = numWorkers;
+    }
+
+    void setProgressCallback(BatchExecutor::ProgressFunc progress) {
+        _progress = std::move(progress);
+    }
+
 protected:
-    void doInvokeBatch(
+    int _numWorkers {1};
+    BatchExecutor::ProgressFunc _progress;
+
+    std::vector<BatchError> doInvokeBatch(
         const std::vector<std::filesystem::path> &input,
         const std::filesystem::path &outputDir,
         std::function<void(const std::filesystem::path &, const std::filesystem::path &)> block) {
 
-        for (auto &path : input) {
-            auto outDir = outputDir;
-            if (outDir.empty()) {
-                outDir = path.parent_path();
-            }
-            try {
+        auto executor = BatchExecutor(_numWorkers);
+        auto errors = executor.execute(
+            input,
+            [&outputDir, &block](auto &path) {
+                auto outDir = outputDir;
+                if (outDir.empty()) {
+                    outDir = path.parent_path();
+                }
                 block(path, outDir);
-            } catch (const resource::FormatException &e) {
-                error(boost::format("Error while processing '%s': %s") % path % std::string(e.what()));
-            }
+            },
+            _progress);
+        for (auto &err : errors) {
+            error(boost::format("Error while processing '%s': %s") % err.path % err.message);
         }
+        return errors;
     }
 };
 
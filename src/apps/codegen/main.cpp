@@ -20,11 +20,18 @@
 
 #include "gffschema.h"
 #include "guis.h"
+#include "natives.h"
 #include "routines.h"
 
 using namespace reone;
 using namespace reone::resource;
 
+// Scripts run for every creature on every combat round
+static const std::vector<std::string> kDefaultNativeScripts {
+    "k_def_endround01",
+    "k_def_heartbt01",
+    "k_def_percept01"};
+
 int main(int argc, char **argv) {
     try {
         boost::program_options::options_description description;
@@ -33,7 +40,8 @@ int main(int argc, char **argv) {
             ("destdir", boost::program_options::value<std::string>()->required())   //
             ("k1dir", boost::program_options::value<std::string>()->required())     //
             ("k2dir", boost::program_options::value<std::string>()->required())     //
-            ("restype", boost::program_options::value<std::string>());              //
+            ("restype", boost::program_options::value<std::string>())               //
+            ("scripts", boost::program_options::value<std::string>());              //
 
         boost::program_options::variables_map vars;
         boost::program_options::store(boost::program_options::parse_command_line(argc, argv, description), vars);
@@ -76,6 +84,14 @@ int main(int argc, char **argv) {
         } else if (generator == "guis") {
             generateGuis(k1Dir, k2Dir, destDir);
 
+        } else if (generator == "natives") {
+            auto scripts = kDefaultNativeScripts;
+            if (vars.count("scripts") > 0) {
+                scripts.clear();
+                boost::split(scripts, vars["scripts"].as<std::string>(), boost::is_any_of(","), boost::token_compress_on);
+            }
+            generateNatives(k1Dir, k2Dir, scripts, destDir);
+
         } else {
             throw std::runtime_error("Invalid generator argument: " + generator);
         }
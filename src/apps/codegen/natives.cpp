@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "natives.h"
+
+#include "reone/game/script/routines.h"
+#include "reone/resource/provider/keybif.h"
+#include "reone/script/format/ncsreader.h"
+#include "reone/script/native.h"
+#include "reone/system/fileutil.h"
+#include "reone/system/stream/fileoutput.h"
+#include "reone/system/stream/memoryinput.h"
+#include "reone/system/stream/memoryoutput.h"
+#include "reone/system/textwriter.h"
+#include "reone/tools/script/exprtree.h"
+#include "reone/tools/script/exprtreeoptimizer.h"
+#include "reone/tools/script/format/cppwriter.h"
+
+#include "templates.h"
+
+using namespace reone::game;
+using namespace reone::resource;
+using namespace reone::script;
+
+namespace reone {
+
+struct LoweredScript {
+    std::string resRef;
+    uint32_t hash {0};
+    std::string className;
+    std::string code;
+};
+
+static std::string scriptClassName(const std::string &resRef) {
+    auto name = std::string("ncs_");
+    for (auto ch : resRef) {
+        name.push_back(std::isalnum(static_cast<unsigned char>(ch)) ? ch : '_');
+    }
+    return name;
+}
+
+static std::vector<LoweredScript> lowerScripts(GameID gameId,
+                                               const std::filesystem::path &gameDir,
+                                               const std::vector<std::string> &scripts) {
+    auto keyPath = findFileIgnoreCase(gameDir, "chitin.key");
+    if (!keyPath) {
+        throw std::runtime_error("chitin.key file not found: " + gameDir.string());
+    }
+    auto keyBif = KeyBifResourceProvider(*keyPath);
+    keyBif.init();
+
+    auto routines = Routines(gameId, nullptr, nullptr);
+    routines.init();
+
+    std::vector<LoweredScript> lowered;
+    for (auto &resRef : scripts) {
+        auto ncsBytes = keyBif.findResourceData(ResourceId(resRef, ResourceType::Ncs));
+        if (!ncsBytes) {
+            std::cerr << "Script not found: " << resRef << std::endl;
+            continue;
+        }
+        auto className = scriptClassName(resRef);
+        try {
+            auto ncs = MemoryInputStream(*ncsBytes);
+            auto reader = NcsReader(ncs, resRef);
+            reader.load();
+
+            auto optimizer = ExpressionTreeOptimizer(false);
+            auto tree = ExpressionTree::fromProgram(*reader.program(), routines, optimizer);
+
+            auto codeBytes = ByteBuffer();
+            auto code = MemoryOutputStream(codeBytes);
+            auto writer = CppWriter(tree, routines);
+            writer.save(className, code);
+
+            auto script = LoweredScript();
+            script.resRef = resRef;
+            script.hash = hashScriptBytes(ncsBytes->data(), ncsBytes->size());
+            script.className = className;
+            script.code = std::string(codeBytes.begin(), codeBytes.end());
+            lowered.push_back(std::move(script));
+
+        } catch (const std::exception &e) {
+            std::cerr << "Script left interpreted: " << resRef << ": " << e.what() << std::endl;
+        }
+    }
+    return lowered;
+}
+
+static void writeNamespace(const std::string &name, const std::vector<LoweredScript> &scripts, TextWriter &code) {
+    if (scripts.empty()) {
+        return;
+    }
+    code.write(str(boost::format("namespace %s {\n\n") % name));
+    for (auto &script : scripts) {
+        code.write(script.code);
+        code.write("\n");
+    }
+    code.write(str(boost::format("} // namespace %s\n\n") % name));
+}
+
+static void writeRegistrations(const std::string &ns, const std::vector<LoweredScript> &scripts, TextWriter &code) {
+    for (auto &script : scripts) {
+        code.write(str(boost::format("%snatives.add(\"%s\", 0x%08x, &%s::%s::run);\n") % kIndent % script.resRef % script.hash % ns % script.className));
+    }
+}
+
+void generateNatives(const std::filesystem::path &k1Dir,
+                     const std::filesystem::path &k2Dir,
+                     const std::vector<std::string> &scripts,
+                     const std::filesystem::path &destDir) {
+    auto k1Scripts = lowerScripts(GameID::KotOR, k1Dir, scripts);
+    auto k2Scripts = lowerScripts(GameID::TSL, k2Dir, scripts);
+
+    auto path = destDir;
+    path.append("natives.cpp");
+    auto stream = FileOutputStream(path);
+    auto code = TextWriter(stream);
+    code.write(kCopyrightNotice + "\n\n");
+    code.write(str(boost::format(kIncludeFormat + "\n") % "reone/game/script/natives.h"));
+    code.write("\n");
+    code.write(str(boost::format(kIncludeFormat + "\n") % "reone/script/enginetype.h"));
+    code.write(str(boost::format(kIncludeFormat + "\n") % "reone/script/native.h"));
+    code.write("\n");
+    code.write("using namespace reone::script;\n");
+    code.write("\n");
+    code.write("namespace reone {\n\n");
+    code.write("namespace game {\n\n");
+    writeNamespace("kotor", k1Scripts, code);
+    writeNamespace("tsl", k2Scripts, code);
+    code.write("void registerNativeScripts(NativeScripts &natives) {\n");
+    writeRegistrations("kotor", k1Scripts, code);
+    writeRegistrations("tsl", k2Scripts, code);
+    code.write("}\n\n");
+    code.write("} // namespace game\n\n");
+    code.write("} // namespace reone\n");
+}
+
+} // namespace reone
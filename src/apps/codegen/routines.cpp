@@ -249,7 +249,7 @@ static void writeReoneRoutineInitArgExpr(int idx,
 static void writeReoneRoutineImpl(const Function &func,
                                   const std::map<std::string, Constant> &constants,
                                   TextWriter &code) {
-    code.write(str(boost::format("static Variable %s(const std::vector<Variable> &args, const RoutineContext &ctx) {\n") % func.name));
+    code.write(str(boost::format("static Variable %s(const VariableSpan &args, const RoutineContext &ctx) {\n") % func.name));
     if (!func.args.empty()) {
         code.write(kIndent + "// Load\n");
     }
@@ -307,7 +307,7 @@ static void writeReoneRegisterRoutinesFunc(const std::string &category,
             args.push_back(nssTypeToMacro(arg.type));
         }
         auto argsStr = boost::join(args, ", ");
-        code.write(str(boost::format("%sinsert(%d, \"%s\", %s, {%s}, &%s);\n") % kIndent % idx % func.name % retType % argsStr % func.name));
+        code.write(str(boost::format("%sinsert(%d, \"%s\", %s, {%s}, &thunk<&%s>);\n") % kIndent % idx % func.name % retType % argsStr % func.name));
     }
     code.write("}\n\n");
 }
@@ -54,7 +54,7 @@ void Engine::loadOptions() {
 
 void Engine::initServices(GameID gameId) {
     _systemModule = std::make_unique<SystemModule>();
-    _resourceModule = std::make_unique<ResourceModule>(_options->game.path);
+    _resourceModule = std::make_unique<ResourceModule>(_options->game.path, _options->game.cachePath);
     _graphicsModule = std::make_unique<GraphicsModule>(_options->graphics, *_resourceModule);
     _audioModule = std::make_unique<AudioModule>(_options->audio, *_resourceModule);
     _movieModule = std::make_unique<MovieModule>(_options->game.path, *_graphicsModule, *_audioModule);
@@ -108,6 +108,8 @@ void Engine::deinit() {
 
     _optionsView.reset();
     _options.reset();
+
+    deinitLog();
 }
 
 int Engine::run() {
@@ -41,7 +41,9 @@ std::unique_ptr<Options> OptionsParser::parse() {
     options_description descCommon;
     descCommon.add_options()                                                                                                    //
         ("game", value<std::string>(), "path to game directory")                                                                //
+        ("cachedir", value<std::string>()->default_value(options->game.cachePath.string()), "path to asset cache directory")    //
         ("dev", value<bool>()->default_value(options->game.developer), "enable developer mode")                                 //
+        ("modules", value<int>()->default_value(options->game.residentModules), "number of modules to keep in memory (min. 2)") //
         ("width", value<int>()->default_value(options->graphics.width), "window width")                                         //
         ("height", value<int>()->default_value(options->graphics.height), "window height")                                      //
         ("fullscreen", value<bool>()->default_value(options->graphics.fullscreen), "enable fullscreen")                         //
@@ -55,6 +57,7 @@ std::unique_ptr<Options> OptionsParser::parse() {
         ("shadowres", value<int>()->default_value(glm::log2(options->graphics.shadowResolution) - 10), "shadow map resolution") //
         ("anisofilter", value<int>()->default_value(options->graphics.anisotropicFiltering), "anisotropic filtering")           //
         ("drawdist", value<int>()->default_value(static_cast<int>(kDefaultObjectDrawDistance)), "draw distance")                //
+        ("texbudget", value<int>()->default_value(options->graphics.textureStreamingBudget), "texture streaming budget in MiB") //
         ("musicvol", value<int>()->default_value(options->audio.musicVolume), "music volume in percents")                       //
         ("voicevol", value<int>()->default_value(options->audio.voiceVolume), "voice volume in percents")                       //
         ("soundvol", value<int>()->default_value(options->audio.soundVolume), "sound volume in percents")                       //
@@ -77,7 +80,9 @@ std::unique_ptr<Options> OptionsParser::parse() {
     // Convert Boost options to game options
 
     options->game.path = vars.count("game") > 0 ? std::filesystem::path(vars["game"].as<std::string>()) : std::filesystem::current_path();
+    options->game.cachePath = vars["cachedir"].as<std::string>();
     options->game.developer = vars["dev"].as<bool>();
+    options->game.residentModules = vars["modules"].as<int>();
     options->graphics.width = vars["width"].as<int>();
     options->graphics.height = vars["height"].as<int>();
     options->graphics.fullscreen = vars["fullscreen"].as<bool>();
@@ -91,6 +96,7 @@ std::unique_ptr<Options> OptionsParser::parse() {
     options->graphics.shadowResolution = 1 << (10 + vars["shadowres"].as<int>());
     options->graphics.anisotropicFiltering = vars["anisofilter"].as<int>();
     options->graphics.drawDistance = static_cast<float>(vars["drawdist"].as<int>());
+    options->graphics.textureStreamingBudget = vars["texbudget"].as<int>();
     options->audio.musicVolume = vars["musicvol"].as<int>();
     options->audio.voiceVolume = vars["voicevol"].as<int>();
     options->audio.soundVolume = vars["soundvol"].as<int>();
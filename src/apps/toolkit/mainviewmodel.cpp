@@ -74,6 +74,8 @@ static const std::set<ResourceType> kFilesPlaintextResourceTypes {
     ResourceType::Lyt,
     ResourceType::Vis};
 
+static constexpr int kNumBatchWorkers = -1; // all hardware threads
+
 void MainViewModel::openFile(const GameDirectoryItem &item) {
     withResourceStream(item, [this, &item](auto &res) {
         try {
@@ -551,21 +553,35 @@ void MainViewModel::extractAllBifs(const std::filesystem::path &destPath) {
     auto keyReader = KeyReader(key);
     keyReader.load();
 
+    std::vector<std::filesystem::path> bifPaths;
+    std::map<std::filesystem::path, int> bifIdxByPath;
+    for (size_t i = 0; i < _keyFiles.size(); ++i) {
+        auto cleanedFilename = boost::replace_all_copy(_keyFiles[i].filename, "\\", "/");
+        auto bifPath = findFileIgnoreCase(_gamePath, cleanedFilename);
+        if (!bifPath) {
+            continue;
+        }
+        bifPaths.push_back(*bifPath);
+        bifIdxByPath[*bifPath] = static_cast<int>(i);
+    }
+
     auto progress = Progress();
     progress.visible = true;
     progress.title = "Extract all BIF archives";
     _progress.invoke(progress);
 
-    int bifIdx = 0;
-    for (auto &file : _keyFiles) {
-        auto cleanedFilename = boost::replace_all_copy(file.filename, "\\", "/");
-        auto bifPath = findFileIgnoreCase(_gamePath, cleanedFilename);
-        if (!bifPath) {
-            continue;
-        }
-        progress.value = 100 * bifIdx / static_cast<int>(_keyFiles.size());
-        tool.extractBIF(keyReader, bifIdx++, *bifPath, destPath);
-        _progress.invoke(progress);
+    auto executor = BatchExecutor(kNumBatchWorkers);
+    auto errors = executor.execute(
+        bifPaths,
+        [&](auto &bifPath) {
+            tool.extractBIF(keyReader, bifIdxByPath.at(bifPath), bifPath, destPath);
+        },
+        [this, &progress](auto numProcessed, auto numTotal) {
+            progress.value = static_cast<int>(100 * numProcessed / numTotal);
+            _progress.invoke(progress);
+        });
+    for (auto &err : errors) {
+        error(boost::format("Error while extracting '%s': %s") % err.path % err.message);
     }
 
     progress.visible = false;
@@ -583,6 +599,7 @@ void MainViewModel::batchConvertTpcToTga(const std::filesystem::path &srcPath, c
             tpcFiles.push_back(file.path());
         }
     }
+    std::sort(tpcFiles.begin(), tpcFiles.end());
 
     auto progress = Progress();
     progress.visible = true;
@@ -590,13 +607,12 @@ void MainViewModel::batchConvertTpcToTga(const std::filesystem::path &srcPath, c
     _progress.invoke(progress);
 
     auto tool = TpcTool();
-    for (size_t i = 0; i < tpcFiles.size(); ++i) {
-        progress.value = 100 * static_cast<int>(i / tpcFiles.size());
+    tool.setNumWorkers(kNumBatchWorkers);
+    tool.setProgressCallback([this, &progress](auto numProcessed, auto numTotal) {
+        progress.value = static_cast<int>(100 * numProcessed / numTotal);
         _progress.invoke(progress);
-
-        auto &tpcPath = tpcFiles[i];
-        tool.toTGA(tpcPath, destPath);
-    }
+    });
+    tool.invokeBatch(Operation::ToTGA, tpcFiles, destPath, _gamePath);
 
     progress.visible = false;
     _progress.invoke(progress);
@@ -23,6 +23,7 @@
 #include "reone/scene/di/services.h"
 #include "reone/scene/graphs.h"
 #include "reone/system/logutil.h"
+#include "reone/system/profiler.h"
 #include "reone/system/randomutil.h"
 
 using namespace reone::graphics;
@@ -91,6 +92,8 @@ void Combat::addAttack(std::shared_ptr<Creature> attacker,
 }
 
 void Combat::update(float dt) {
+    PROFILE_ZONE("Combat::update");
+
     for (auto it = _roundByAttacker.begin(); it != _roundByAttacker.end();) {
         Round &round = *it->second;
         updateRound(round, dt);
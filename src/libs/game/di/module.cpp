@@ -17,6 +17,8 @@
 
 #include "reone/game/di/module.h"
 
+#include "reone/game/script/natives.h"
+
 namespace reone {
 
 namespace game {
@@ -64,6 +66,8 @@ void GameModule::init() {
     _guiSounds->init();
     _portraits->init();
     _surfaces->init();
+
+    registerNativeScripts(_script.scripts().natives());
 }
 
 void GameModule::deinit() {
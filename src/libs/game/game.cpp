@@ -67,6 +67,7 @@
 #include "reone/system/di/services.h"
 #include "reone/system/fileutil.h"
 #include "reone/system/logutil.h"
+#include "reone/system/profiler.h"
 
 using namespace reone::audio;
 using namespace reone::graphics;
@@ -183,6 +184,8 @@ void Game::mainLoopIteration(float dt) {
 }
 
 void Game::update(float dt) {
+    PROFILE_ZONE("Game::update");
+
     if (_movie) {
         updateMovie(dt);
         return;
@@ -216,6 +219,10 @@ void Game::update(float dt) {
 }
 
 void Game::drawAll() {
+    PROFILE_ZONE("Game::drawAll");
+
+    _services.graphics.uniforms.beginFrame();
+    _services.graphics.textures.update();
     _services.graphics.context.clearColorDepth();
 
     if (_movie) {
@@ -233,6 +240,8 @@ void Game::drawAll() {
 }
 
 void Game::loadModule(const std::string &name, std::string entry) {
+    PROFILE_ZONE("Game::loadModule");
+
     info("Load module '" + name + "'");
 
     withLoadingScreen("load_" + name, [this, &name, &entry]() {
@@ -253,12 +262,9 @@ void Game::loadModule(const std::string &name, std::string entry) {
 
             _services.scene.graphs.get(kSceneMain).clear();
 
-            auto maybeModule = _loadedModules.find(name);
-            if (maybeModule != _loadedModules.end()) {
-                _module = maybeModule->second;
-            } else {
+            _module = _loadedModules.get(name);
+            if (!_module) {
                 _module = newModule();
-                _objectById.insert(std::make_pair(_module->id(), _module));
 
                 std::shared_ptr<Gff> ifo(_services.resource.gffs.get("module", ResourceType::Ifo));
                 if (!ifo) {
@@ -266,7 +272,11 @@ void Game::loadModule(const std::string &name, std::string entry) {
                 }
 
                 _module->load(name, *ifo);
-                _loadedModules.insert(std::make_pair(name, _module));
+                _loadedModules.restore(name, *_module);
+
+                for (auto &evicted : _loadedModules.add(name, _module)) {
+                    unloadModule(*evicted);
+                }
             }
 
             if (_party.isEmpty()) {
@@ -293,13 +303,35 @@ void Game::loadModule(const std::string &name, std::string entry) {
     });
 }
 
+void Game::unloadModule(Module &module) {
+    auto &area = *module.area();
+    for (auto &object : area.objects()) {
+        for (auto &item : object->items()) {
+            destroyObject(item->id());
+        }
+        if (object->type() == ObjectType::Creature) {
+            for (auto &item : static_cast<Creature &>(*object).equipment()) {
+                destroyObject(item.second->id());
+            }
+        }
+        destroyObject(object->id());
+    }
+    for (auto cameraType : {CameraType::FirstPerson, CameraType::ThirdPerson, CameraType::Animated, CameraType::Dialog}) {
+        auto camera = area.getCamera(cameraType);
+        if (camera) {
+            destroyObject(camera->id());
+        }
+    }
+    destroyObject(area.id());
+    destroyObject(module.id());
+}
+
 void Game::loadDefaultParty() {
     std::string member1, member2, member3;
     _party.defaultMembers(member1, member2, member3);
 
     if (!member1.empty()) {
         std::shared_ptr<Creature> player = newCreature();
-        _objectById.insert(std::make_pair(player->id(), player));
         player->loadFromBlueprint(member1);
         player->setTag(kObjectTagPlayer);
         player->setImmortal(true);
@@ -308,14 +340,12 @@ void Game::loadDefaultParty() {
     }
     if (!member2.empty()) {
         std::shared_ptr<Creature> companion = newCreature();
-        _objectById.insert(std::make_pair(companion->id(), companion));
         companion->loadFromBlueprint(member2);
         companion->setImmortal(true);
         _party.addMember(0, companion);
     }
     if (!member3.empty()) {
         std::shared_ptr<Creature> companion = newCreature();
-        _objectById.insert(std::make_pair(companion->id(), companion));
         companion->loadFromBlueprint(member3);
         companion->setImmortal(true);
         _party.addMember(1, companion);
@@ -418,12 +448,24 @@ std::shared_ptr<Object> Game::getObjectById(uint32_t id) const {
     case kObjectInvalid:
         return nullptr;
     default: {
-        auto it = _objectById.find(id);
-        return it != _objectById.end() ? it->second : nullptr;
+        auto object = _objects.find(id);
+        return object ? *object : nullptr;
     }
     }
 }
 
+Object *Game::findObjectById(uint32_t id) const {
+    if (id == kObjectSelf) {
+        throw std::invalid_argument("Invalid id: " + std::to_string(id));
+    }
+    auto object = _objects.find(id);
+    return object ? object->get() : nullptr;
+}
+
+void Game::destroyObject(uint32_t id) {
+    _objects.erase(id);
+}
+
 void Game::drawGUI() {
     switch (_screen) {
     case Screen::InGame:
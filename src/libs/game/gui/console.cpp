@@ -211,6 +211,8 @@ void Console::drawLines() {
 
     glm::vec3 position(kTextOffset, height - 0.5f * _font->height(), 0.0f);
 
+    _services.graphics.spriteBatch.begin();
+
     // Input
 
     std::string text("> " + _input.text());
@@ -223,6 +225,8 @@ void Console::drawLines() {
         position.y -= _font->height();
         _font->draw(line, position, glm::vec3(1.0f), TextGravity::RightCenter);
     }
+
+    _services.graphics.spriteBatch.end();
 }
 
 void Console::cmdClear(std::string input, std::vector<std::string> tokens) {
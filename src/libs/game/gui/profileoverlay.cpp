@@ -25,9 +25,12 @@
 #include "reone/graphics/meshes.h"
 #include "reone/graphics/shaders.h"
 #include "reone/graphics/textutil.h"
+#include "reone/graphics/uniforms.h"
 #include "reone/graphics/window.h"
 #include "reone/system/clock.h"
 #include "reone/system/di/services.h"
+#include "reone/system/logutil.h"
+#include "reone/system/stream/fileoutput.h"
 
 using namespace reone::graphics;
 
@@ -43,6 +46,9 @@ static constexpr float kRefreshPeriod = 5.0f; // seconds
 static constexpr int kFrameWidth = 125;
 static constexpr float kTextOffset = 3.0f;
 
+static constexpr int kMaxZoneLines = 10;
+static constexpr char kTraceFilename[] = "trace.json";
+
 void ProfileOverlay::init() {
     _frequency = _services.system.clock.performanceFrequency();
     _font = _services.graphics.fonts.get(kFontResRef);
@@ -51,12 +57,19 @@ void ProfileOverlay::init() {
 bool ProfileOverlay::handle(const SDL_Event &event) {
     if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_F5) {
         _enabled = !_enabled;
+        setProfilingEnabled(_enabled);
         if (_enabled) {
             _counter = _services.system.clock.performanceCounter();
+            _zonesStartNs = profileTimestamp();
+            _zoneLines.clear();
             _refreshTimer.reset(kRefreshDelay);
         }
         return true;
     }
+    if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_F6 && _enabled) {
+        saveTrace();
+        return true;
+    }
 
     return false;
 }
@@ -72,6 +85,8 @@ void ProfileOverlay::update(float dt) {
     if (_refreshTimer.elapsed()) {
         uint64_t counter = _services.system.clock.performanceCounter();
         _fps = static_cast<int>(_numFrames * _frequency / (counter - _counter));
+        refreshUniforms();
+        refreshZones();
         _numFrames = 0;
         _counter = counter;
         _refreshTimer.reset(kRefreshPeriod);
@@ -84,14 +99,62 @@ void ProfileOverlay::draw() {
     }
 
     _services.graphics.context.withBlending(BlendMode::Normal, [this]() {
+        _services.graphics.spriteBatch.begin();
         _font->draw(
             std::to_string(_fps),
             glm::vec3(static_cast<float>(_options.graphics.width) - kTextOffset, static_cast<float>(_options.graphics.height) - kTextOffset, 0.0f),
             glm::vec3(1.0f),
             TextGravity::LeftTop);
+        _font->draw(
+            _uniformsLine,
+            glm::vec3(static_cast<float>(_options.graphics.width) - kTextOffset, static_cast<float>(_options.graphics.height) - kTextOffset - _font->height(), 0.0f),
+            glm::vec3(1.0f),
+            TextGravity::LeftTop);
+        for (size_t i = 0; i < _zoneLines.size(); ++i) {
+            _font->draw(
+                _zoneLines[i],
+                glm::vec3(static_cast<float>(_options.graphics.width) - kTextOffset, static_cast<float>(_options.graphics.height) - kTextOffset - (i + 2) * _font->height(), 0.0f),
+                glm::vec3(1.0f),
+                TextGravity::LeftTop);
+        }
+        _services.graphics.spriteBatch.end();
     });
 }
 
+void ProfileOverlay::refreshUniforms() {
+    // Uniform uploads of the last complete frame
+    auto &stats = _services.graphics.uniforms.frameStats();
+    _uniformsLine = str(boost::format("uniforms %.1f KB, %d uploads") % (stats.bytesUploaded / 1024.0f) % stats.numUploads);
+}
+
+void ProfileOverlay::refreshZones() {
+    // Average time spent in each zone per frame since the previous refresh
+    uint64_t now = profileTimestamp();
+    auto stats = profileZoneStats(_zonesStartNs, now);
+    _zonesStartNs = now;
+
+    _zoneLines.clear();
+    int numFrames = std::max(1, _numFrames);
+    for (auto &zone : stats) {
+        if (_zoneLines.size() == kMaxZoneLines) {
+            break;
+        }
+        float ms = zone.totalNs / 1e6f / numFrames;
+        _zoneLines.push_back(str(boost::format("%s %.2f ms") % zone.name % ms));
+    }
+}
+
+void ProfileOverlay::saveTrace() {
+    auto path = std::filesystem::current_path() / kTraceFilename;
+    try {
+        auto stream = FileOutputStream(path);
+        writeChromeTrace(stream);
+        info("Profile trace saved to " + path.string());
+    } catch (const std::exception &e) {
+        error("Failed to save profile trace: " + std::string(e.what()));
+    }
+}
+
 } // namespace game
 
 } // namespace reone
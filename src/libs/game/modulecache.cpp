@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/game/modulecache.h"
+
+#include "reone/system/logutil.h"
+
+#include "reone/game/object/area.h"
+#include "reone/game/object/creature.h"
+#include "reone/game/object/door.h"
+#include "reone/game/object/module.h"
+
+namespace reone {
+
+namespace game {
+
+using ObjectKey = std::pair<ObjectType, int>;
+
+std::shared_ptr<Module> ModuleCache::get(const std::string &name) {
+    auto it = std::find_if(_resident.begin(), _resident.end(), [&name](auto &pair) { return pair.first == name; });
+    if (it == _resident.end()) {
+        return nullptr;
+    }
+    _resident.splice(_resident.begin(), _resident, it);
+    return it->second;
+}
+
+std::vector<std::shared_ptr<Module>> ModuleCache::add(const std::string &name, std::shared_ptr<Module> module) {
+    _resident.emplace_front(name, std::move(module));
+
+    std::vector<std::shared_ptr<Module>> evicted;
+    while (static_cast<int>(_resident.size()) > _capacity) {
+        auto &lru = _resident.back();
+        info("Evict module '" + lru.first + "'");
+        _snapshots[lru.first] = takeSnapshot(*lru.second);
+        evicted.push_back(std::move(lru.second));
+        _resident.pop_back();
+    }
+    return evicted;
+}
+
+bool ModuleCache::restore(const std::string &name, Module &module) {
+    auto maybeSnapshot = _snapshots.find(name);
+    if (maybeSnapshot == _snapshots.end()) {
+        return false;
+    }
+    applySnapshot(maybeSnapshot->second, module);
+    _snapshots.erase(maybeSnapshot);
+    return true;
+}
+
+void ModuleCache::clear() {
+    _resident.clear();
+    _snapshots.clear();
+}
+
+ModuleSnapshot ModuleCache::takeSnapshot(const Module &module) {
+    return takeSnapshot(module, *module.area());
+}
+
+ModuleSnapshot ModuleCache::takeSnapshot(const Module &module, const Area &area) {
+    ModuleSnapshot snapshot;
+    snapshot.areaLocalBooleans = area.localBooleans();
+    snapshot.areaLocalNumbers = area.localNumbers();
+    snapshot.moduleLocalBooleans = module.localBooleans();
+    snapshot.moduleLocalNumbers = module.localNumbers();
+    for (auto &object : area.objects()) {
+        if (object->gitIndex() == -1) {
+            continue;
+        }
+        ObjectSnapshot objectSnapshot;
+        objectSnapshot.type = object->type();
+        objectSnapshot.gitIndex = object->gitIndex();
+        objectSnapshot.position = object->position();
+        objectSnapshot.facing = object->getFacing();
+        objectSnapshot.currentHitPoints = object->currentHitPoints();
+        objectSnapshot.dead = object->isDead();
+        objectSnapshot.plot = object->plotFlag();
+        objectSnapshot.open = object->isOpen();
+        objectSnapshot.localBooleans = object->localBooleans();
+        objectSnapshot.localNumbers = object->localNumbers();
+        snapshot.objects.push_back(std::move(objectSnapshot));
+    }
+    return snapshot;
+}
+
+void ModuleCache::applySnapshot(const ModuleSnapshot &snapshot, Module &module) {
+    applySnapshot(snapshot, module, *module.area());
+}
+
+void ModuleCache::applySnapshot(const ModuleSnapshot &snapshot, Module &module, Area &area) {
+    for (auto &local : snapshot.areaLocalBooleans) {
+        area.setLocalBoolean(local.first, local.second);
+    }
+    for (auto &local : snapshot.areaLocalNumbers) {
+        area.setLocalNumber(local.first, local.second);
+    }
+    for (auto &local : snapshot.moduleLocalBooleans) {
+        module.setLocalBoolean(local.first, local.second);
+    }
+    for (auto &local : snapshot.moduleLocalNumbers) {
+        module.setLocalNumber(local.first, local.second);
+    }
+
+    std::map<ObjectKey, const ObjectSnapshot *> objectSnapshots;
+    for (auto &objectSnapshot : snapshot.objects) {
+        objectSnapshots[std::make_pair(objectSnapshot.type, objectSnapshot.gitIndex)] = &objectSnapshot;
+    }
+
+    for (auto &object : area.objects()) {
+        if (object->gitIndex() == -1) {
+            continue;
+        }
+        auto maybeSnapshot = objectSnapshots.find(std::make_pair(object->type(), object->gitIndex()));
+        if (maybeSnapshot == objectSnapshots.end()) {
+            // Object was destroyed before module was evicted
+            area.destroyObject(*object);
+            continue;
+        }
+        auto &objectSnapshot = *maybeSnapshot->second;
+        object->setPosition(objectSnapshot.position);
+        object->setFacing(objectSnapshot.facing);
+        area.determineObjectRoom(*object);
+        object->setCurrentHitPoints(objectSnapshot.currentHitPoints);
+        object->setPlotFlag(objectSnapshot.plot);
+        for (auto &local : objectSnapshot.localBooleans) {
+            object->setLocalBoolean(local.first, local.second);
+        }
+        for (auto &local : objectSnapshot.localNumbers) {
+            object->setLocalNumber(local.first, local.second);
+        }
+        if (object->type() == ObjectType::Door && objectSnapshot.open != object->isOpen()) {
+            auto door = std::static_pointer_cast<Door>(object);
+            if (objectSnapshot.open) {
+                door->open(nullptr);
+            } else {
+                door->close(nullptr);
+            }
+        } else if (object->type() == ObjectType::Creature && objectSnapshot.dead && !object->isDead()) {
+            std::static_pointer_cast<Creature>(object)->markDead();
+        }
+    }
+}
+
+} // namespace game
+
+} // namespace reone
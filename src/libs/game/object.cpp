@@ -36,8 +36,8 @@ static constexpr float kMaxConversationDistance = 4.0f;
 static constexpr float kDistanceWalk = 4.0f;
 
 void Object::update(float dt) {
+    _timers.update(dt);
     updateActions(dt);
-    updateEffects(dt);
     if (!_dead) {
         executeActions(dt);
     }
@@ -79,15 +79,13 @@ void Object::addActionOnTop(std::shared_ptr<Action> action) {
 }
 
 void Object::delayAction(std::shared_ptr<Action> action, float seconds) {
-    DelayedAction delayed;
-    delayed.action = std::move(action);
-    delayed.timer = std::make_unique<Timer>(seconds);
-    _delayed.push_back(std::move(delayed));
+    _timers.schedule(seconds, [this, action = std::move(action)]() {
+        _actions.push_back(action);
+    });
 }
 
 void Object::updateActions(float dt) {
     removeCompletedActions();
-    updateDelayedActions(dt);
 }
 
 void Object::removeCompletedActions() {
@@ -100,21 +98,6 @@ void Object::removeCompletedActions() {
     }
 }
 
-void Object::updateDelayedActions(float dt) {
-    for (auto &delayed : _delayed) {
-        delayed.timer->update(dt);
-        if (delayed.timer->elapsed()) {
-            _actions.push_back(std::move(delayed.action));
-        }
-    }
-    auto delayedToRemove = std::remove_if(
-        _delayed.begin(),
-        _delayed.end(),
-        [](const DelayedAction &delayed) { return delayed.timer->elapsed(); });
-
-    _delayed.erase(delayedToRemove, _delayed.end());
-}
-
 void Object::executeActions(float dt) {
     if (_actions.empty()) {
         return;
@@ -261,8 +244,12 @@ void Object::applyEffect(const std::shared_ptr<Effect> &effect, DurationType dur
         AppliedEffect appliedEffect;
         appliedEffect.effect = effect;
         appliedEffect.durationType = durationType;
-        appliedEffect.duration = duration;
         _effects.push_back(std::move(appliedEffect));
+        if (durationType == DurationType::Temporary) {
+            _timers.schedule(duration, [this, effect]() {
+                expireEffect(*effect);
+            });
+        }
     }
 }
 
@@ -270,20 +257,16 @@ void Object::applyInstantEffect(Effect &effect) {
     effect.applyTo(*this);
 }
 
-void Object::updateEffects(float dt) {
-    for (auto it = _effects.begin(); it != _effects.end();) {
-        AppliedEffect &effect = *it;
-        bool temporary = effect.durationType == DurationType::Temporary;
-        if (temporary) {
-            effect.duration = glm::max(0.0f, effect.duration - dt);
-        }
-        if (temporary && effect.duration == 0.0f) {
-            applyInstantEffect(*effect.effect);
-            it = _effects.erase(it);
-        } else {
-            ++it;
-        }
+void Object::expireEffect(const Effect &effect) {
+    auto it = std::find_if(_effects.begin(), _effects.end(), [&effect](auto &applied) {
+        return applied.effect.get() == &effect;
+    });
+    if (it == _effects.end()) {
+        // Effect has been cleared before expiring
+        return;
     }
+    applyInstantEffect(*it->effect);
+    _effects.erase(it);
 }
 
 void Object::playAnimation(AnimationType animation, AnimationProperties properties) {
@@ -307,6 +290,9 @@ void Object::setRoom(Room *room) {
     if (_room) {
         _room->addTenant(this);
     }
+
+    // Objects entering a room share its visibility
+    setVisible(!_room || _room->isVisible());
 }
 
 void Object::setPosition(const glm::vec3 &position) {
@@ -54,8 +54,11 @@
 #include "reone/scene/node/trigger.h"
 #include "reone/scene/node/walkmesh.h"
 #include "reone/scene/types.h"
+#include "reone/system/di/services.h"
 #include "reone/system/logutil.h"
+#include "reone/system/profiler.h"
 #include "reone/system/randomutil.h"
+#include "reone/system/threadpool.h"
 
 using namespace reone::audio;
 using namespace reone::gui;
@@ -93,7 +96,7 @@ Area::Area(
     _sceneName(std::move(sceneName)) {
 
     init();
-    _heartbeatTimer.reset(kHeartbeatInterval);
+    scheduleHeartbeat();
 }
 
 void Area::init() {
@@ -119,12 +122,94 @@ void Area::load(std::string name, const Gff &are, const Gff &git, bool fromSave)
     auto gitParsed = schema::parseGIT(git);
 
     loadARE(areParsed);
+    prefetchResources(gitParsed);
     loadGIT(gitParsed);
     loadLYT();
     loadVIS();
     loadPTH();
 }
 
+void Area::prefetchResources(const schema::GIT &git) {
+    PROFILE_ZONE("Area::prefetchResources");
+
+    // Phase one: collect resources referenced by the layout and GIT blueprints
+
+    std::set<std::string> models;
+    std::set<std::string> textures;
+    std::set<std::pair<std::string, ResourceType>> walkmeshes;
+
+    auto layout = _services.game.layouts.get(_name);
+    if (layout) {
+        for (auto &lytRoom : layout->rooms) {
+            models.insert(boost::to_lower_copy(lytRoom.name));
+            walkmeshes.insert(std::make_pair(boost::to_lower_copy(lytRoom.name), ResourceType::Wok));
+        }
+    }
+    auto appearances = _services.resource.twoDas.get("appearance");
+    auto heads = _services.resource.twoDas.get("heads");
+    for (auto &gitCreature : git.Creature_List) {
+        auto utc = _services.resource.gffs.get(gitCreature.TemplateResRef, ResourceType::Utc);
+        if (!utc || !appearances) {
+            continue;
+        }
+        // Character body models depend on equipment, leave them to the second phase
+        int appearance = utc->getInt("Appearance_Type");
+        if (appearances->getString(appearance, "modeltype") == "B") {
+            int headIdx = appearances->getInt(appearance, "normalhead", -1);
+            if (headIdx != -1 && heads) {
+                models.insert(boost::to_lower_copy(heads->getString(headIdx, "head")));
+            }
+        } else {
+            models.insert(boost::to_lower_copy(appearances->getString(appearance, "race")));
+            textures.insert(boost::to_lower_copy(appearances->getString(appearance, "racetex")));
+        }
+    }
+    auto genericDoors = _services.resource.twoDas.get("genericdoors");
+    for (auto &gitDoor : git.Door_List) {
+        auto utd = _services.resource.gffs.get(gitDoor.TemplateResRef, ResourceType::Utd);
+        if (!utd || !genericDoors) {
+            continue;
+        }
+        auto modelName = boost::to_lower_copy(genericDoors->getString(utd->getInt("GenericType"), "modelname"));
+        models.insert(modelName);
+        for (int i = 0; i < 3; ++i) {
+            walkmeshes.insert(std::make_pair(modelName + std::to_string(i), ResourceType::Dwk));
+        }
+    }
+    auto placeables = _services.resource.twoDas.get("placeables");
+    for (auto &gitPlaceable : git.Placeable_List) {
+        auto utp = _services.resource.gffs.get(gitPlaceable.TemplateResRef, ResourceType::Utp);
+        if (!utp || !placeables) {
+            continue;
+        }
+        auto modelName = boost::to_lower_copy(placeables->getString(utp->getInt("Appearance"), "modelname"));
+        models.insert(modelName);
+        walkmeshes.insert(std::make_pair(modelName, ResourceType::Pwk));
+    }
+    models.erase("");
+    textures.erase("");
+
+    // Decode collected resources in parallel into resource caches. GPU upload
+    // is deferred until objects are instantiated on the main thread.
+
+    std::vector<std::function<void()>> jobs;
+    for (auto &model : models) {
+        jobs.push_back([this, &model]() { _services.graphics.models.get(model); });
+    }
+    for (auto &texture : textures) {
+        jobs.push_back([this, &texture]() { _services.graphics.textures.get(texture, TextureUsage::Diffuse); });
+    }
+    for (auto &walkmesh : walkmeshes) {
+        jobs.push_back([this, &walkmesh]() { _services.graphics.walkmeshes.get(walkmesh.first, walkmesh.second); });
+    }
+    try {
+        parallelFor(_services.system.threadPool, jobs.size(), [&jobs](size_t i) { jobs[i](); });
+    } catch (const std::exception &e) {
+        // Failed resources will be loaded again, and reported, in the second phase
+        warn("Error prefetching area resources: " + std::string(e.what()));
+    }
+}
+
 void Area::loadARE(const schema::ARE &are) {
     _localizedName = _services.resource.strings.getText(are.Name.first);
 
@@ -231,66 +316,82 @@ void Area::loadProperties(const schema::GIT &git) {
 }
 
 void Area::loadCreatures(const schema::GIT &git) {
+    int gitIndex = 0;
     for (auto &creatureStruct : git.Creature_List) {
         std::shared_ptr<Creature> creature = _game.newCreature(_sceneName);
         creature->loadFromGIT(creatureStruct);
+        creature->setGitIndex(gitIndex++);
         landObject(*creature);
         add(creature);
     }
 }
 
 void Area::loadDoors(const schema::GIT &git) {
+    int gitIndex = 0;
     for (auto &doorStruct : git.Door_List) {
         std::shared_ptr<Door> door = _game.newDoor(_sceneName);
         door->loadFromGIT(doorStruct);
+        door->setGitIndex(gitIndex++);
         add(door);
     }
 }
 
 void Area::loadPlaceables(const schema::GIT &git) {
+    int gitIndex = 0;
     for (auto &placeableStruct : git.Placeable_List) {
         std::shared_ptr<Placeable> placeable = _game.newPlaceable(_sceneName);
         placeable->loadFromGIT(placeableStruct);
+        placeable->setGitIndex(gitIndex++);
         add(placeable);
     }
 }
 
 void Area::loadWaypoints(const schema::GIT &git) {
+    int gitIndex = 0;
     for (auto &waypointStruct : git.WaypointList) {
         std::shared_ptr<Waypoint> waypoint = _game.newWaypoint(_sceneName);
         waypoint->loadFromGIT(waypointStruct);
+        waypoint->setGitIndex(gitIndex++);
         add(waypoint);
     }
 }
 
 void Area::loadTriggers(const schema::GIT &git) {
+    int gitIndex = 0;
     for (auto &gffs : git.TriggerList) {
         std::shared_ptr<Trigger> trigger = _game.newTrigger(_sceneName);
         trigger->loadFromGIT(gffs);
+        trigger->setGitIndex(gitIndex++);
         add(trigger);
     }
 }
 
 void Area::loadSounds(const schema::GIT &git) {
+    int gitIndex = 0;
     for (auto &soundStruct : git.SoundList) {
         std::shared_ptr<Sound> sound = _game.newSound(_sceneName);
         sound->loadFromGIT(soundStruct);
+        sound->setGitIndex(gitIndex++);
         add(sound);
     }
 }
 
 void Area::loadCameras(const schema::GIT &git) {
+    int gitIndex = 0;
     for (auto &cameraStruct : git.CameraList) {
         std::shared_ptr<StaticCamera> camera = _game.newStaticCamera(_cameraAspect, _sceneName);
         camera->loadFromGIT(cameraStruct);
+        camera->setGitIndex(gitIndex++);
         add(camera);
     }
 }
 
 void Area::loadEncounters(const schema::GIT &git) {
+    int gitIndex = 0;
     for (auto &encounterStruct : git.Encounter_List) {
         std::shared_ptr<Encounter> encounter = _game.newEncounter(_sceneName);
         encounter->loadFromGIT(encounterStruct);
+        encounter->setGitIndex(gitIndex++);
         add(encounter);
     }
 }
@@ -362,6 +463,26 @@ void Area::loadVIS() {
         return;
     }
     _visibility = fixVisibility(*visibility);
+    cacheRoomVisibility();
+}
+
+void Area::cacheRoomVisibility() {
+    _visibleRoomsByRoom.clear();
+    for (auto &[name, room] : _rooms) {
+        auto &visibleRooms = _visibleRoomsByRoom[room.get()];
+        visibleRooms.push_back(room.get());
+        auto adjRoomNames = _visibility.equal_range(name);
+        for (auto adjRoomName = adjRoomNames.first; adjRoomName != adjRoomNames.second; ++adjRoomName) {
+            auto adjRoom = _rooms.find(adjRoomName->second);
+            if (adjRoom == _rooms.end()) {
+                continue;
+            }
+            if (std::find(visibleRooms.begin(), visibleRooms.end(), adjRoom->second.get()) == visibleRooms.end()) {
+                visibleRooms.push_back(adjRoom->second.get());
+            }
+        }
+    }
+    _pvsValid = false;
 }
 
 Visibility Area::fixVisibility(const Visibility &visibility) {
@@ -401,6 +522,14 @@ void Area::initCameras(const glm::vec3 &entryPosition, float entryFacing) {
 
     auto &sceneGraph = _services.scene.graphs.get(_sceneName);
 
+    // Cameras are recreated on every entry, previous ones must not stay registered
+    for (auto type : {CameraType::FirstPerson, CameraType::ThirdPerson, CameraType::Dialog, CameraType::Animated}) {
+        auto camera = getCamera(type);
+        if (camera) {
+            _game.destroyObject(camera->id());
+        }
+    }
+
     _firstPersonCamera = _game.newFirstPersonCamera(glm::radians(kDefaultFieldOfView), _cameraAspect, _sceneName);
     _firstPersonCamera->load();
     _firstPersonCamera->setPosition(position);
@@ -479,17 +608,22 @@ void Area::doDestroyObjects() {
 }
 
 void Area::doDestroyObject(uint32_t objectId) {
-    auto object = _game.getObjectById(objectId);
+    auto object = _game.findObjectById(objectId);
     if (!object) {
         return;
     }
-    auto room = object->room();
+    remove(*object);
+    _game.destroyObject(objectId);
+}
+
+void Area::remove(Object &object) {
+    auto room = object.room();
     if (room) {
-        room->removeTenant(object.get());
+        room->removeTenant(&object);
     }
 
     auto &sceneGraph = _services.scene.graphs.get(_sceneName);
-    auto sceneNode = object->sceneNode();
+    auto sceneNode = object.sceneNode();
     if (sceneNode) {
         if (sceneNode->type() == SceneNodeType::Model) {
             sceneGraph.removeRoot(*std::static_pointer_cast<ModelSceneNode>(sceneNode));
@@ -499,36 +633,36 @@ void Area::doDestroyObject(uint32_t objectId) {
             sceneGraph.removeRoot(*std::static_pointer_cast<TriggerSceneNode>(sceneNode));
         }
     }
-    if (object->type() == ObjectType::Placeable) {
-        auto placeable = std::static_pointer_cast<Placeable>(object);
-        auto walkmesh = placeable->walkmesh();
+    if (object.type() == ObjectType::Placeable) {
+        auto &placeable = static_cast<Placeable &>(object);
+        auto walkmesh = placeable.walkmesh();
         if (walkmesh) {
             sceneGraph.removeRoot(*walkmesh);
         }
-    } else if (object->type() == ObjectType::Door) {
-        auto door = std::static_pointer_cast<Door>(object);
-        auto walkmeshOpen1 = door->walkmeshOpen1();
+    } else if (object.type() == ObjectType::Door) {
+        auto &door = static_cast<Door &>(object);
+        auto walkmeshOpen1 = door.walkmeshOpen1();
         if (walkmeshOpen1) {
             sceneGraph.removeRoot(*walkmeshOpen1);
         }
-        auto walkmeshOpen2 = door->walkmeshOpen2();
+        auto walkmeshOpen2 = door.walkmeshOpen2();
         if (walkmeshOpen2) {
             sceneGraph.removeRoot(*walkmeshOpen2);
         }
-        auto walkmeshClosed = door->walkmeshClosed();
+        auto walkmeshClosed = door.walkmeshClosed();
         if (walkmeshClosed) {
             sceneGraph.removeRoot(*walkmeshClosed);
         }
     }
 
-    auto maybeObject = std::find_if(_objects.begin(), _objects.end(), [&object](auto &o) { return o.get() == object.get(); });
+    auto maybeObject = std::find_if(_objects.begin(), _objects.end(), [&object](auto &o) { return o.get() == &object; });
     if (maybeObject != _objects.end()) {
         _objects.erase(maybeObject);
     }
-    auto maybeTagObjects = _objectsByTag.find(object->tag());
+    auto maybeTagObjects = _objectsByTag.find(object.tag());
     if (maybeTagObjects != _objectsByTag.end()) {
         auto &tagObjects = maybeTagObjects->second;
-        auto maybeObjectByTag = std::find_if(tagObjects.begin(), tagObjects.end(), [&object](auto &o) { return o.get() == object.get(); });
+        auto maybeObjectByTag = std::find_if(tagObjects.begin(), tagObjects.end(), [&object](auto &o) { return o.get() == &object; });
         if (maybeObjectByTag != tagObjects.end()) {
             tagObjects.erase(maybeObjectByTag);
         }
@@ -536,8 +670,8 @@ void Area::doDestroyObject(uint32_t objectId) {
             _objectsByTag.erase(maybeTagObjects);
         }
     }
-    auto &typeObjects = _objectsByType.find(object->type())->second;
-    auto maybeObjectByType = std::find_if(typeObjects.begin(), typeObjects.end(), [&object](auto &o) { return o.get() == object.get(); });
+    auto &typeObjects = _objectsByType.find(object.type())->second;
+    auto maybeObjectByType = std::find_if(typeObjects.begin(), typeObjects.end(), [&object](auto &o) { return o.get() == &object; });
     if (maybeObjectByType != typeObjects.end()) {
         typeObjects.erase(maybeObjectByType);
     }
@@ -595,8 +729,9 @@ void Area::loadParty(const glm::vec3 &position, float facing, bool fromSave) {
 }
 
 void Area::unloadParty() {
+    // Party members outlive the area, therefore they are only removed from it
     for (auto &member : _game.party().members()) {
-        doDestroyObject(member.creature->id());
+        remove(*member.creature);
     }
 }
 
@@ -619,6 +754,8 @@ bool Area::handleKeyDown(const SDL_KeyboardEvent &event) {
 }
 
 void Area::update(float dt) {
+    PROFILE_ZONE("Area::update");
+
     doDestroyObjects();
     updateVisibility();
     updateObjectSelection();
@@ -632,7 +769,6 @@ void Area::update(float dt) {
         object->update(dt);
     }
     updatePerception(dt);
-    updateHeartbeat(dt);
 }
 
 bool Area::moveCreature(const std::shared_ptr<Creature> &creature, const glm::vec2 &dir, bool run, float dt) {
@@ -795,31 +931,58 @@ void Area::onPartyLeaderMoved(bool roomChanged) {
 void Area::updateRoomVisibility() {
     std::shared_ptr<Creature> partyLeader(_game.party().getLeader());
     Room *leaderRoom = partyLeader ? partyLeader->room() : nullptr;
-    bool allVisible = _game.cameraType() != CameraType::ThirdPerson || !leaderRoom;
+
+    // Third-person camera follows the party leader, other cameras may look
+    // into any room, so the room under the camera must be visible as well
+    bool thirdPerson = _game.cameraType() == CameraType::ThirdPerson;
+    Room *cameraRoom = thirdPerson ? nullptr : getCameraRoom();
+    bool allVisible = _visibleRoomsByRoom.empty() || (thirdPerson ? !leaderRoom : !cameraRoom);
+
+    // Only touch rooms and their tenants when the potentially visible set changes
+    if (_pvsValid && _pvsAllVisible == allVisible && _pvsLeaderRoom == leaderRoom && _pvsCameraRoom == cameraRoom) {
+        return;
+    }
+    _pvsValid = true;
+    _pvsAllVisible = allVisible;
+    _pvsLeaderRoom = leaderRoom;
+    _pvsCameraRoom = cameraRoom;
 
     if (allVisible) {
         for (auto &room : _rooms) {
             room.second->setVisible(true);
         }
-    } else {
-        auto adjRoomNames = _visibility.equal_range(leaderRoom->name());
-        for (auto &room : _rooms) {
-            // Room is visible if either of the following is true:
-            // 1. party leader is not in a room
-            // 2. this room is the party leaders room
-            // 3. this room is adjacent to the party leaders room
-            bool visible = !leaderRoom || room.second.get() == leaderRoom;
-            if (!visible) {
-                for (auto adjRoom = adjRoomNames.first; adjRoom != adjRoomNames.second; adjRoom++) {
-                    if (adjRoom->second == room.first) {
-                        visible = true;
-                        break;
-                    }
-                }
-            }
-            room.second->setVisible(visible);
+        return;
+    }
+    std::set<Room *> visibleRooms;
+    for (auto sourceRoom : {leaderRoom, cameraRoom}) {
+        auto maybeVisible = _visibleRoomsByRoom.find(sourceRoom);
+        if (maybeVisible != _visibleRoomsByRoom.end()) {
+            visibleRooms.insert(maybeVisible->second.begin(), maybeVisible->second.end());
         }
     }
+    for (auto &room : _rooms) {
+        room.second->setVisible(visibleRooms.count(room.second.get()) > 0);
+    }
+}
+
+Room *Area::getCameraRoom() {
+    auto camera = _game.getActiveCamera();
+    if (!camera) {
+        return nullptr;
+    }
+    auto cameraPos = camera->sceneNode()->getOrigin();
+    if (_cameraRoomValid && _cameraRoomPosition == cameraPos) {
+        return _cameraRoom;
+    }
+    _cameraRoom = nullptr;
+    auto &sceneGraph = _services.scene.graphs.get(_sceneName);
+    Collision collision;
+    if (sceneGraph.testElevation(cameraPos, collision)) {
+        _cameraRoom = dynamic_cast<Room *>(collision.user);
+    }
+    _cameraRoomPosition = cameraPos;
+    _cameraRoomValid = true;
+    return _cameraRoom;
 }
 
 void Area::update3rdPersonCameraTarget() {
@@ -866,19 +1029,22 @@ void Area::checkTriggersIntersection(const std::shared_ptr<Object> &triggerrer)
     }
 }
 
-void Area::updateHeartbeat(float dt) {
-    _heartbeatTimer.update(dt);
-    if (_heartbeatTimer.elapsed()) {
-        if (!_onHeartbeat.empty()) {
-            _game.scriptRunner().run(_onHeartbeat, _id);
-        }
-        for (auto &object : _objects) {
-            std::string heartbeat(object->getOnHeartbeat());
-            if (!heartbeat.empty()) {
-                _game.scriptRunner().run(heartbeat, object->id());
-            }
+void Area::scheduleHeartbeat() {
+    _timers.schedule(kHeartbeatInterval, [this]() {
+        runHeartbeatScripts();
+        scheduleHeartbeat();
+    });
+}
+
+void Area::runHeartbeatScripts() {
+    if (!_onHeartbeat.empty()) {
+        _game.scriptRunner().run(_onHeartbeat, _id);
+    }
+    for (auto &object : _objects) {
+        std::string heartbeat(object->getOnHeartbeat());
+        if (!heartbeat.empty()) {
+            _game.scriptRunner().run(heartbeat, object->id());
         }
-        _heartbeatTimer.reset(kHeartbeatInterval);
     }
 }
 
@@ -1187,20 +1353,28 @@ void Area::doUpdatePerception() {
             // Hearing
             bool wasHeard = creature->perception().heard.count(other) > 0;
             if (!wasHeard && heard) {
-                debug(boost::format("%s heard by %s") % other->tag() % creature->tag(), LogChannel::Perception);
+                if (isLogEnabled(LogSeverity::Debug, LogChannel::Perception)) {
+                    debug(boost::format("%s heard by %s") % other->tag() % creature->tag(), LogChannel::Perception);
+                }
                 creature->onObjectHeard(other);
             } else if (wasHeard && !heard) {
-                debug(boost::format("%s inaudible to %s") % other->tag() % creature->tag(), LogChannel::Perception);
+                if (isLogEnabled(LogSeverity::Debug, LogChannel::Perception)) {
+                    debug(boost::format("%s inaudible to %s") % other->tag() % creature->tag(), LogChannel::Perception);
+                }
                 creature->onObjectInaudible(other);
             }
 
             // Sight
             bool wasSeen = creature->perception().seen.count(other) > 0;
             if (!wasSeen && seen) {
-                debug(boost::format("%s seen by %s") % other->tag() % creature->tag(), LogChannel::Perception);
+                if (isLogEnabled(LogSeverity::Debug, LogChannel::Perception)) {
+                    debug(boost::format("%s seen by %s") % other->tag() % creature->tag(), LogChannel::Perception);
+                }
                 creature->onObjectSeen(other);
             } else if (wasSeen && !seen) {
-                debug(boost::format("%s vanished from %s") % other->tag() % creature->tag(), LogChannel::Perception);
+                if (isLogEnabled(LogSeverity::Debug, LogChannel::Perception)) {
+                    debug(boost::format("%s vanished from %s") % other->tag() % creature->tag(), LogChannel::Perception);
+                }
                 creature->onObjectVanished(other);
             }
         }
@@ -485,17 +485,22 @@ void Creature::playSound(SoundSetEntry entry, bool positional) {
 }
 
 void Creature::die() {
-    _currentHitPoints = 0;
-    _dead = true;
-    _name = _services.resource.strings.getText(kStrRefRemains);
+    markDead();
 
     debug(boost::format("Creature %s is dead") % _tag);
 
     playSound(SoundSetEntry::Dead);
-    playAnimation(getDieAnimation());
     runDeathScript();
 }
 
+void Creature::markDead() {
+    _currentHitPoints = 0;
+    _dead = true;
+    _name = _services.resource.strings.getText(kStrRefRemains);
+
+    playAnimation(getDieAnimation());
+}
+
 void Creature::runDeathScript() {
     if (!_onDeath.empty()) {
         _game.scriptRunner().run(_onDeath, _id, kObjectInvalid);
@@ -31,6 +31,7 @@
 #include "reone/resource/gffs.h"
 #include "reone/resource/resources.h"
 #include "reone/system/logutil.h"
+#include "reone/system/profiler.h"
 
 using namespace reone::graphics;
 using namespace reone::resource;
@@ -271,6 +272,8 @@ void Module::onPlaceableClick(const std::shared_ptr<Placeable> &placeable) {
 }
 
 void Module::update(float dt) {
+    PROFILE_ZONE("Module::update");
+
     if (_game.cameraType() == CameraType::ThirdPerson) {
         _player->update(dt);
     }
@@ -23,6 +23,7 @@
 #include "reone/game/types.h"
 #include "reone/graphics/di/services.h"
 #include "reone/graphics/lips.h"
+#include "reone/graphics/textures.h"
 #include "reone/graphics/types.h"
 #include "reone/resource/2das.h"
 #include "reone/resource/di/services.h"
@@ -77,6 +78,9 @@ void ResourceDirector::onModuleLoad(const std::string &name) {
     _scriptSvc.scripts.clear();
     _graphicsSvc.lips.clear();
     _resourceSvc.gffs.clear();
+
+    // Streamed textures must not be loaded from archives of the next module
+    _graphicsSvc.textures.cancelStreaming();
     _resourceSvc.resources.clearLocal();
 
     loadModuleResources(name);
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/game/script/natives.h"
+
+#include "reone/script/enginetype.h"
+#include "reone/script/native.h"
+
+using namespace reone::script;
+
+namespace reone {
+
+namespace game {
+
+// Empty on purpose. Generated scripts are derived from game data, which cannot
+// be checked in; regenerate with "codegen --generator natives" to populate.
+void registerNativeScripts(NativeScripts &natives) {
+}
+
+} // namespace game
+
+} // namespace reone
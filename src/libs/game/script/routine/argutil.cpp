@@ -36,7 +36,7 @@ namespace reone {
 
 namespace game {
 
-static void throwIfMissing(const std::vector<Variable> &args, int index) {
+static void throwIfMissing(const VariableSpan &args, int index) {
     if (index < 0 || index >= args.size()) {
         throw RoutineArgumentMissingException(str(boost::format("Argument index out of range: %d/%d") % index % static_cast<int>(args.size())));
     }
@@ -126,31 +126,31 @@ std::shared_ptr<Object> getTriggerrer(const RoutineContext &ctx) {
     return object;
 }
 
-int getInt(const std::vector<Variable> &args, int index) {
+int getInt(const VariableSpan &args, int index) {
     throwIfMissing(args, index);
     throwIfUnexpectedType(VariableType::Int, args[index].type);
     return args[index].intValue;
 }
 
-float getFloat(const std::vector<Variable> &args, int index) {
+float getFloat(const VariableSpan &args, int index) {
     throwIfMissing(args, index);
     throwIfUnexpectedType(VariableType::Float, args[index].type);
     return args[index].floatValue;
 }
 
-std::string getString(const std::vector<Variable> &args, int index) {
+std::string getString(const VariableSpan &args, int index) {
     throwIfMissing(args, index);
     throwIfUnexpectedType(VariableType::String, args[index].type);
     return args[index].strValue;
 }
 
-glm::vec3 getVector(const std::vector<Variable> &args, int index) {
+glm::vec3 getVector(const VariableSpan &args, int index) {
     throwIfMissing(args, index);
     throwIfUnexpectedType(VariableType::Vector, args[index].type);
     return args[index].vecValue;
 }
 
-std::shared_ptr<Object> getObject(const std::vector<Variable> &args, int index, const RoutineContext &ctx) {
+std::shared_ptr<Object> getObject(const VariableSpan &args, int index, const RoutineContext &ctx) {
     throwIfMissing(args, index);
     throwIfUnexpectedType(VariableType::Object, args[index].type);
 
@@ -164,7 +164,7 @@ std::shared_ptr<Object> getObject(const std::vector<Variable> &args, int index,
     return object;
 }
 
-std::shared_ptr<Effect> getEffect(const std::vector<Variable> &args, int index) {
+std::shared_ptr<Effect> getEffect(const VariableSpan &args, int index) {
     throwIfMissing(args, index);
     throwIfUnexpectedType(VariableType::Effect, args[index].type);
     auto effect = std::static_pointer_cast<Effect>(args[index].engineType);
@@ -172,7 +172,7 @@ std::shared_ptr<Effect> getEffect(const std::vector<Variable> &args, int index)
     return effect;
 }
 
-std::shared_ptr<Event> getEvent(const std::vector<Variable> &args, int index) {
+std::shared_ptr<Event> getEvent(const VariableSpan &args, int index) {
     throwIfMissing(args, index);
     throwIfUnexpectedType(VariableType::Event, args[index].type);
     auto event = std::static_pointer_cast<Event>(args[index].engineType);
@@ -180,7 +180,7 @@ std::shared_ptr<Event> getEvent(const std::vector<Variable> &args, int index) {
     return event;
 }
 
-std::shared_ptr<Location> getLocationArgument(const std::vector<Variable> &args, int index) {
+std::shared_ptr<Location> getLocationArgument(const VariableSpan &args, int index) {
     throwIfMissing(args, index);
     throwIfUnexpectedType(VariableType::Location, args[index].type);
     auto location = std::static_pointer_cast<Location>(args[index].engineType);
@@ -188,7 +188,7 @@ std::shared_ptr<Location> getLocationArgument(const std::vector<Variable> &args,
     return location;
 }
 
-std::shared_ptr<Talent> getTalent(const std::vector<Variable> &args, int index) {
+std::shared_ptr<Talent> getTalent(const VariableSpan &args, int index) {
     throwIfMissing(args, index);
     throwIfUnexpectedType(VariableType::Talent, args[index].type);
     auto talent = std::static_pointer_cast<Talent>(args[index].engineType);
@@ -196,13 +196,13 @@ std::shared_ptr<Talent> getTalent(const std::vector<Variable> &args, int index)
     return talent;
 }
 
-std::shared_ptr<ExecutionContext> getAction(const std::vector<Variable> &args, int index) {
+std::shared_ptr<ExecutionContext> getAction(const VariableSpan &args, int index) {
     throwIfMissing(args, index);
     throwIfUnexpectedType(VariableType::Action, args[index].type);
     return args[index].context;
 }
 
-int getIntOrElse(const std::vector<Variable> &args, int index, int defValue) {
+int getIntOrElse(const VariableSpan &args, int index, int defValue) {
     if (index < 0 || index >= args.size()) {
         return defValue;
     }
@@ -210,7 +210,7 @@ int getIntOrElse(const std::vector<Variable> &args, int index, int defValue) {
     return args[index].intValue;
 }
 
-float getFloatOrElse(const std::vector<Variable> &args, int index, float defValue) {
+float getFloatOrElse(const VariableSpan &args, int index, float defValue) {
     if (index < 0 || index >= args.size()) {
         return defValue;
     }
@@ -218,7 +218,7 @@ float getFloatOrElse(const std::vector<Variable> &args, int index, float defValu
     return args[index].floatValue;
 }
 
-std::string getStringOrElse(const std::vector<Variable> &args, int index, std::string defValue) {
+std::string getStringOrElse(const VariableSpan &args, int index, std::string defValue) {
     if (index < 0 || index >= args.size()) {
         return defValue;
     }
@@ -226,7 +226,7 @@ std::string getStringOrElse(const std::vector<Variable> &args, int index, std::s
     return args[index].strValue;
 }
 
-glm::vec3 getVectorOrElse(const std::vector<Variable> &args, int index, glm::vec3 defValue) {
+glm::vec3 getVectorOrElse(const VariableSpan &args, int index, glm::vec3 defValue) {
     if (index < 0 || index >= args.size()) {
         return defValue;
     }
@@ -234,7 +234,7 @@ glm::vec3 getVectorOrElse(const std::vector<Variable> &args, int index, glm::vec
     return args[index].vecValue;
 }
 
-std::shared_ptr<Object> getObjectOrNull(const std::vector<Variable> &args, int index, const RoutineContext &ctx) {
+std::shared_ptr<Object> getObjectOrNull(const VariableSpan &args, int index, const RoutineContext &ctx) {
     if (index < 0 || index >= args.size()) {
         return nullptr;
     } else {
@@ -242,7 +242,7 @@ std::shared_ptr<Object> getObjectOrNull(const std::vector<Variable> &args, int i
     }
 }
 
-std::shared_ptr<Object> getObjectOrCaller(const std::vector<Variable> &args, int index, const RoutineContext &ctx) {
+std::shared_ptr<Object> getObjectOrCaller(const VariableSpan &args, int index, const RoutineContext &ctx) {
     if (index < 0 || index >= args.size()) {
         return getCaller(ctx);
     } else {
@@ -87,14 +87,14 @@ namespace reone {
 
 namespace game {
 
-static Variable ActionRandomWalk(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionRandomWalk(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto action = ctx.game.newAction<RandomWalkAction>();
     getCaller(ctx)->addAction(std::move(action));
     return Variable::ofNull();
 }
 
-static Variable ActionMoveToLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionMoveToLocation(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto lDestination = getLocationArgument(args, 0);
     auto bRun = getIntOrElse(args, 1, 0);
@@ -108,7 +108,7 @@ static Variable ActionMoveToLocation(const std::vector<Variable> &args, const Ro
     return Variable::ofNull();
 }
 
-static Variable ActionMoveToObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionMoveToObject(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oMoveTo = getObject(args, 0, ctx);
     auto bRun = getIntOrElse(args, 1, 0);
@@ -123,7 +123,7 @@ static Variable ActionMoveToObject(const std::vector<Variable> &args, const Rout
     return Variable::ofNull();
 }
 
-static Variable ActionMoveAwayFromObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionMoveAwayFromObject(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oFleeFrom = getObject(args, 0, ctx);
     auto bRun = getIntOrElse(args, 1, 0);
@@ -138,7 +138,7 @@ static Variable ActionMoveAwayFromObject(const std::vector<Variable> &args, cons
     return Variable::ofNull();
 }
 
-static Variable ActionEquipItem(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionEquipItem(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
     auto nInventorySlot = getInt(args, 1);
@@ -154,7 +154,7 @@ static Variable ActionEquipItem(const std::vector<Variable> &args, const Routine
     return Variable::ofNull();
 }
 
-static Variable ActionUnequipItem(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionUnequipItem(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
     auto bInstant = getIntOrElse(args, 1, 0);
@@ -169,7 +169,7 @@ static Variable ActionUnequipItem(const std::vector<Variable> &args, const Routi
     return Variable::ofNull();
 }
 
-static Variable ActionPickUpItem(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionPickUpItem(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
 
@@ -182,7 +182,7 @@ static Variable ActionPickUpItem(const std::vector<Variable> &args, const Routin
     return Variable::ofNull();
 }
 
-static Variable ActionPutDownItem(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionPutDownItem(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
 
@@ -195,7 +195,7 @@ static Variable ActionPutDownItem(const std::vector<Variable> &args, const Routi
     return Variable::ofNull();
 }
 
-static Variable ActionAttack(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionAttack(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oAttackee = getObject(args, 0, ctx);
     auto bPassive = getIntOrElse(args, 1, 0);
@@ -210,7 +210,7 @@ static Variable ActionAttack(const std::vector<Variable> &args, const RoutineCon
     return Variable::ofNull();
 }
 
-static Variable ActionSpeakString(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionSpeakString(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sStringToSpeak = getString(args, 0);
     auto nTalkVolume = getIntOrElse(args, 1, 0);
@@ -224,7 +224,7 @@ static Variable ActionSpeakString(const std::vector<Variable> &args, const Routi
     return Variable::ofNull();
 }
 
-static Variable ActionPlayAnimation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionPlayAnimation(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nAnimation = getInt(args, 0);
     auto fSpeed = getFloatOrElse(args, 1, 1.0f);
@@ -239,7 +239,7 @@ static Variable ActionPlayAnimation(const std::vector<Variable> &args, const Rou
     return Variable::ofNull();
 }
 
-static Variable ActionOpenDoor(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionOpenDoor(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oDoor = getObject(args, 0, ctx);
 
@@ -251,7 +251,7 @@ static Variable ActionOpenDoor(const std::vector<Variable> &args, const RoutineC
     return Variable::ofNull();
 }
 
-static Variable ActionCloseDoor(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionCloseDoor(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oDoor = getObject(args, 0, ctx);
 
@@ -263,7 +263,7 @@ static Variable ActionCloseDoor(const std::vector<Variable> &args, const Routine
     return Variable::ofNull();
 }
 
-static Variable ActionCastSpellAtObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionCastSpellAtObject(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nSpell = getInt(args, 0);
     auto oTarget = getObject(args, 1, ctx);
@@ -285,7 +285,7 @@ static Variable ActionCastSpellAtObject(const std::vector<Variable> &args, const
     return Variable::ofNull();
 }
 
-static Variable ActionGiveItem(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionGiveItem(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
     auto oGiveTo = getObject(args, 1, ctx);
@@ -299,7 +299,7 @@ static Variable ActionGiveItem(const std::vector<Variable> &args, const RoutineC
     return Variable::ofNull();
 }
 
-static Variable ActionTakeItem(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionTakeItem(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
     auto oTakeFrom = getObject(args, 1, ctx);
@@ -313,7 +313,7 @@ static Variable ActionTakeItem(const std::vector<Variable> &args, const RoutineC
     return Variable::ofNull();
 }
 
-static Variable ActionForceFollowObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionForceFollowObject(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oFollow = getObject(args, 0, ctx);
     auto fFollowDistance = getFloatOrElse(args, 1, 0.0f);
@@ -327,7 +327,7 @@ static Variable ActionForceFollowObject(const std::vector<Variable> &args, const
     return Variable::ofNull();
 }
 
-static Variable ActionJumpToObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionJumpToObject(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oToJumpTo = getObject(args, 0, ctx);
     auto bWalkStraightLineToPoint = getIntOrElse(args, 1, 1);
@@ -341,7 +341,7 @@ static Variable ActionJumpToObject(const std::vector<Variable> &args, const Rout
     return Variable::ofNull();
 }
 
-static Variable ActionWait(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionWait(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto fSeconds = getFloat(args, 0);
 
@@ -353,7 +353,7 @@ static Variable ActionWait(const std::vector<Variable> &args, const RoutineConte
     return Variable::ofNull();
 }
 
-static Variable ActionStartConversation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionStartConversation(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObjectToConverse = getObject(args, 0, ctx);
     auto sDialogResRef = getStringOrElse(args, 1, "");
@@ -407,21 +407,21 @@ static Variable ActionStartConversation(const std::vector<Variable> &args, const
     return Variable::ofNull();
 }
 
-static Variable ActionPauseConversation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionPauseConversation(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto action = ctx.game.newAction<PauseConversationAction>();
     getCaller(ctx)->addAction(std::move(action));
     return Variable::ofNull();
 }
 
-static Variable ActionResumeConversation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionResumeConversation(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto action = ctx.game.newAction<ResumeConversationAction>();
     getCaller(ctx)->addAction(std::move(action));
     return Variable::ofNull();
 }
 
-static Variable ActionJumpToLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionJumpToLocation(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto lLocation = getLocationArgument(args, 0);
 
@@ -433,7 +433,7 @@ static Variable ActionJumpToLocation(const std::vector<Variable> &args, const Ro
     return Variable::ofNull();
 }
 
-static Variable ActionCastSpellAtLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionCastSpellAtLocation(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nSpell = getInt(args, 0);
     auto lTargetLocation = getLocationArgument(args, 1);
@@ -455,7 +455,7 @@ static Variable ActionCastSpellAtLocation(const std::vector<Variable> &args, con
     return Variable::ofNull();
 }
 
-static Variable ActionSpeakStringByStrRef(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionSpeakStringByStrRef(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nStrRef = getInt(args, 0);
     auto nTalkVolume = getIntOrElse(args, 1, 0);
@@ -469,7 +469,7 @@ static Variable ActionSpeakStringByStrRef(const std::vector<Variable> &args, con
     return Variable::ofNull();
 }
 
-static Variable ActionUseFeat(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionUseFeat(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nFeat = getInt(args, 0);
     auto oTarget = getObject(args, 1, ctx);
@@ -484,7 +484,7 @@ static Variable ActionUseFeat(const std::vector<Variable> &args, const RoutineCo
     return Variable::ofNull();
 }
 
-static Variable ActionUseSkill(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionUseSkill(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nSkill = getInt(args, 0);
     auto oTarget = getObject(args, 1, ctx);
@@ -501,7 +501,7 @@ static Variable ActionUseSkill(const std::vector<Variable> &args, const RoutineC
     return Variable::ofNull();
 }
 
-static Variable ActionDoCommand(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionDoCommand(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto aActionToDo = getAction(args, 0);
 
@@ -513,7 +513,7 @@ static Variable ActionDoCommand(const std::vector<Variable> &args, const Routine
     return Variable::ofNull();
 }
 
-static Variable ActionUseTalentOnObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionUseTalentOnObject(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto tChosenTalent = getTalent(args, 0);
     auto oTarget = getObject(args, 1, ctx);
@@ -527,7 +527,7 @@ static Variable ActionUseTalentOnObject(const std::vector<Variable> &args, const
     return Variable::ofNull();
 }
 
-static Variable ActionUseTalentAtLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionUseTalentAtLocation(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto tChosenTalent = getTalent(args, 0);
     auto lTargetLocation = getLocationArgument(args, 1);
@@ -541,7 +541,7 @@ static Variable ActionUseTalentAtLocation(const std::vector<Variable> &args, con
     return Variable::ofNull();
 }
 
-static Variable ActionInteractObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionInteractObject(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oPlaceable = getObject(args, 0, ctx);
 
@@ -554,7 +554,7 @@ static Variable ActionInteractObject(const std::vector<Variable> &args, const Ro
     return Variable::ofNull();
 }
 
-static Variable ActionMoveAwayFromLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionMoveAwayFromLocation(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto lMoveAwayFrom = getLocationArgument(args, 0);
     auto bRun = getIntOrElse(args, 1, 0);
@@ -569,14 +569,14 @@ static Variable ActionMoveAwayFromLocation(const std::vector<Variable> &args, co
     return Variable::ofNull();
 }
 
-static Variable ActionSurrenderToEnemies(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionSurrenderToEnemies(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto action = ctx.game.newAction<SurrenderToEnemiesAction>();
     getCaller(ctx)->addAction(std::move(action));
     return Variable::ofNull();
 }
 
-static Variable ActionForceMoveToLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionForceMoveToLocation(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto lDestination = getLocationArgument(args, 0);
     auto bRun = getIntOrElse(args, 1, 0);
@@ -591,7 +591,7 @@ static Variable ActionForceMoveToLocation(const std::vector<Variable> &args, con
     return Variable::ofNull();
 }
 
-static Variable ActionForceMoveToObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionForceMoveToObject(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oMoveTo = getObject(args, 0, ctx);
     auto bRun = getIntOrElse(args, 1, 0);
@@ -607,7 +607,7 @@ static Variable ActionForceMoveToObject(const std::vector<Variable> &args, const
     return Variable::ofNull();
 }
 
-static Variable ActionEquipMostDamagingMelee(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionEquipMostDamagingMelee(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oVersus = getObjectOrNull(args, 0, ctx);
     auto bOffHand = getIntOrElse(args, 1, 0);
@@ -621,7 +621,7 @@ static Variable ActionEquipMostDamagingMelee(const std::vector<Variable> &args,
     return Variable::ofNull();
 }
 
-static Variable ActionEquipMostDamagingRanged(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionEquipMostDamagingRanged(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oVersus = getObjectOrNull(args, 0, ctx);
 
@@ -633,14 +633,14 @@ static Variable ActionEquipMostDamagingRanged(const std::vector<Variable> &args,
     return Variable::ofNull();
 }
 
-static Variable ActionEquipMostEffectiveArmor(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionEquipMostEffectiveArmor(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto action = ctx.game.newAction<EquipMostEffectiveArmorAction>();
     getCaller(ctx)->addAction(std::move(action));
     return Variable::ofNull();
 }
 
-static Variable ActionUnlockObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionUnlockObject(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
 
@@ -652,7 +652,7 @@ static Variable ActionUnlockObject(const std::vector<Variable> &args, const Rout
     return Variable::ofNull();
 }
 
-static Variable ActionLockObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionLockObject(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
 
@@ -664,7 +664,7 @@ static Variable ActionLockObject(const std::vector<Variable> &args, const Routin
     return Variable::ofNull();
 }
 
-static Variable ActionCastFakeSpellAtObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionCastFakeSpellAtObject(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nSpell = getInt(args, 0);
     auto oTarget = getObject(args, 1, ctx);
@@ -680,7 +680,7 @@ static Variable ActionCastFakeSpellAtObject(const std::vector<Variable> &args, c
     return Variable::ofNull();
 }
 
-static Variable ActionCastFakeSpellAtLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionCastFakeSpellAtLocation(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nSpell = getInt(args, 0);
     auto lTarget = getLocationArgument(args, 1);
@@ -696,7 +696,7 @@ static Variable ActionCastFakeSpellAtLocation(const std::vector<Variable> &args,
     return Variable::ofNull();
 }
 
-static Variable ActionBarkString(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionBarkString(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto strRef = getInt(args, 0);
 
@@ -708,14 +708,14 @@ static Variable ActionBarkString(const std::vector<Variable> &args, const Routin
     return Variable::ofNull();
 }
 
-static Variable ActionFollowLeader(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionFollowLeader(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto action = ctx.game.newAction<FollowLeaderAction>();
     getCaller(ctx)->addAction(std::move(action));
     return Variable::ofNull();
 }
 
-static Variable ActionFollowOwner(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionFollowOwner(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto fRange = getFloatOrElse(args, 0, 2.5f);
 
@@ -727,7 +727,7 @@ static Variable ActionFollowOwner(const std::vector<Variable> &args, const Routi
     return Variable::ofNull();
 }
 
-static Variable ActionSwitchWeapons(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionSwitchWeapons(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto action = ctx.game.newAction<SwitchWeaponsAction>();
     getCaller(ctx)->addAction(std::move(action));
@@ -735,99 +735,99 @@ static Variable ActionSwitchWeapons(const std::vector<Variable> &args, const Rou
 }
 
 void Routines::registerActionKotorRoutines() {
-    insert(20, "ActionRandomWalk", R_VOID, {}, &ActionRandomWalk);
-    insert(21, "ActionMoveToLocation", R_VOID, {R_LOCATION, R_INT}, &ActionMoveToLocation);
-    insert(22, "ActionMoveToObject", R_VOID, {R_OBJECT, R_INT, R_FLOAT}, &ActionMoveToObject);
-    insert(23, "ActionMoveAwayFromObject", R_VOID, {R_OBJECT, R_INT, R_FLOAT}, &ActionMoveAwayFromObject);
-    insert(32, "ActionEquipItem", R_VOID, {R_OBJECT, R_INT, R_INT}, &ActionEquipItem);
-    insert(33, "ActionUnequipItem", R_VOID, {R_OBJECT, R_INT}, &ActionUnequipItem);
-    insert(34, "ActionPickUpItem", R_VOID, {R_OBJECT}, &ActionPickUpItem);
-    insert(35, "ActionPutDownItem", R_VOID, {R_OBJECT}, &ActionPutDownItem);
-    insert(37, "ActionAttack", R_VOID, {R_OBJECT, R_INT}, &ActionAttack);
-    insert(39, "ActionSpeakString", R_VOID, {R_STRING, R_INT}, &ActionSpeakString);
-    insert(40, "ActionPlayAnimation", R_VOID, {R_INT, R_FLOAT, R_FLOAT}, &ActionPlayAnimation);
-    insert(43, "ActionOpenDoor", R_VOID, {R_OBJECT}, &ActionOpenDoor);
-    insert(44, "ActionCloseDoor", R_VOID, {R_OBJECT}, &ActionCloseDoor);
-    insert(48, "ActionCastSpellAtObject", R_VOID, {R_INT, R_OBJECT, R_INT, R_INT, R_INT, R_INT, R_INT}, &ActionCastSpellAtObject);
-    insert(135, "ActionGiveItem", R_VOID, {R_OBJECT, R_OBJECT}, &ActionGiveItem);
-    insert(136, "ActionTakeItem", R_VOID, {R_OBJECT, R_OBJECT}, &ActionTakeItem);
-    insert(167, "ActionForceFollowObject", R_VOID, {R_OBJECT, R_FLOAT}, &ActionForceFollowObject);
-    insert(196, "ActionJumpToObject", R_VOID, {R_OBJECT, R_INT}, &ActionJumpToObject);
-    insert(202, "ActionWait", R_VOID, {R_FLOAT}, &ActionWait);
-    insert(204, "ActionStartConversation", R_VOID, {R_OBJECT, R_STRING, R_INT, R_INT, R_INT, R_STRING, R_STRING, R_STRING, R_STRING, R_STRING, R_STRING, R_INT}, &ActionStartConversation);
-    insert(205, "ActionPauseConversation", R_VOID, {}, &ActionPauseConversation);
-    insert(206, "ActionResumeConversation", R_VOID, {}, &ActionResumeConversation);
-    insert(214, "ActionJumpToLocation", R_VOID, {R_LOCATION}, &ActionJumpToLocation);
-    insert(234, "ActionCastSpellAtLocation", R_VOID, {R_INT, R_LOCATION, R_INT, R_INT, R_INT, R_INT}, &ActionCastSpellAtLocation);
-    insert(240, "ActionSpeakStringByStrRef", R_VOID, {R_INT, R_INT}, &ActionSpeakStringByStrRef);
-    insert(287, "ActionUseFeat", R_VOID, {R_INT, R_OBJECT}, &ActionUseFeat);
-    insert(288, "ActionUseSkill", R_VOID, {R_INT, R_OBJECT, R_INT, R_OBJECT}, &ActionUseSkill);
-    insert(294, "ActionDoCommand", R_VOID, {R_ACTION}, &ActionDoCommand);
-    insert(309, "ActionUseTalentOnObject", R_VOID, {R_TALENT, R_OBJECT}, &ActionUseTalentOnObject);
-    insert(310, "ActionUseTalentAtLocation", R_VOID, {R_TALENT, R_LOCATION}, &ActionUseTalentAtLocation);
-    insert(329, "ActionInteractObject", R_VOID, {R_OBJECT}, &ActionInteractObject);
-    insert(360, "ActionMoveAwayFromLocation", R_VOID, {R_LOCATION, R_INT, R_FLOAT}, &ActionMoveAwayFromLocation);
-    insert(379, "ActionSurrenderToEnemies", R_VOID, {}, &ActionSurrenderToEnemies);
-    insert(382, "ActionForceMoveToLocation", R_VOID, {R_LOCATION, R_INT, R_FLOAT}, &ActionForceMoveToLocation);
-    insert(383, "ActionForceMoveToObject", R_VOID, {R_OBJECT, R_INT, R_FLOAT, R_FLOAT}, &ActionForceMoveToObject);
-    insert(399, "ActionEquipMostDamagingMelee", R_VOID, {R_OBJECT, R_INT}, &ActionEquipMostDamagingMelee);
-    insert(400, "ActionEquipMostDamagingRanged", R_VOID, {R_OBJECT}, &ActionEquipMostDamagingRanged);
-    insert(404, "ActionEquipMostEffectiveArmor", R_VOID, {}, &ActionEquipMostEffectiveArmor);
-    insert(483, "ActionUnlockObject", R_VOID, {R_OBJECT}, &ActionUnlockObject);
-    insert(484, "ActionLockObject", R_VOID, {R_OBJECT}, &ActionLockObject);
-    insert(501, "ActionCastFakeSpellAtObject", R_VOID, {R_INT, R_OBJECT, R_INT}, &ActionCastFakeSpellAtObject);
-    insert(502, "ActionCastFakeSpellAtLocation", R_VOID, {R_INT, R_LOCATION, R_INT}, &ActionCastFakeSpellAtLocation);
-    insert(700, "ActionBarkString", R_VOID, {R_INT}, &ActionBarkString);
-    insert(730, "ActionFollowLeader", R_VOID, {}, &ActionFollowLeader);
+    insert(20, "ActionRandomWalk", R_VOID, {}, &thunk<&ActionRandomWalk>);
+    insert(21, "ActionMoveToLocation", R_VOID, {R_LOCATION, R_INT}, &thunk<&ActionMoveToLocation>);
+    insert(22, "ActionMoveToObject", R_VOID, {R_OBJECT, R_INT, R_FLOAT}, &thunk<&ActionMoveToObject>);
+    insert(23, "ActionMoveAwayFromObject", R_VOID, {R_OBJECT, R_INT, R_FLOAT}, &thunk<&ActionMoveAwayFromObject>);
+    insert(32, "ActionEquipItem", R_VOID, {R_OBJECT, R_INT, R_INT}, &thunk<&ActionEquipItem>);
+    insert(33, "ActionUnequipItem", R_VOID, {R_OBJECT, R_INT}, &thunk<&ActionUnequipItem>);
+    insert(34, "ActionPickUpItem", R_VOID, {R_OBJECT}, &thunk<&ActionPickUpItem>);
+    insert(35, "ActionPutDownItem", R_VOID, {R_OBJECT}, &thunk<&ActionPutDownItem>);
+    insert(37, "ActionAttack", R_VOID, {R_OBJECT, R_INT}, &thunk<&ActionAttack>);
+    insert(39, "ActionSpeakString", R_VOID, {R_STRING, R_INT}, &thunk<&ActionSpeakString>);
+    insert(40, "ActionPlayAnimation", R_VOID, {R_INT, R_FLOAT, R_FLOAT}, &thunk<&ActionPlayAnimation>);
+    insert(43, "ActionOpenDoor", R_VOID, {R_OBJECT}, &thunk<&ActionOpenDoor>);
+    insert(44, "ActionCloseDoor", R_VOID, {R_OBJECT}, &thunk<&ActionCloseDoor>);
+    insert(48, "ActionCastSpellAtObject", R_VOID, {R_INT, R_OBJECT, R_INT, R_INT, R_INT, R_INT, R_INT}, &thunk<&ActionCastSpellAtObject>);
+    insert(135, "ActionGiveItem", R_VOID, {R_OBJECT, R_OBJECT}, &thunk<&ActionGiveItem>);
+    insert(136, "ActionTakeItem", R_VOID, {R_OBJECT, R_OBJECT}, &thunk<&ActionTakeItem>);
+    insert(167, "ActionForceFollowObject", R_VOID, {R_OBJECT, R_FLOAT}, &thunk<&ActionForceFollowObject>);
+    insert(196, "ActionJumpToObject", R_VOID, {R_OBJECT, R_INT}, &thunk<&ActionJumpToObject>);
+    insert(202, "ActionWait", R_VOID, {R_FLOAT}, &thunk<&ActionWait>);
+    insert(204, "ActionStartConversation", R_VOID, {R_OBJECT, R_STRING, R_INT, R_INT, R_INT, R_STRING, R_STRING, R_STRING, R_STRING, R_STRING, R_STRING, R_INT}, &thunk<&ActionStartConversation>);
+    insert(205, "ActionPauseConversation", R_VOID, {}, &thunk<&ActionPauseConversation>);
+    insert(206, "ActionResumeConversation", R_VOID, {}, &thunk<&ActionResumeConversation>);
+    insert(214, "ActionJumpToLocation", R_VOID, {R_LOCATION}, &thunk<&ActionJumpToLocation>);
+    insert(234, "ActionCastSpellAtLocation", R_VOID, {R_INT, R_LOCATION, R_INT, R_INT, R_INT, R_INT}, &thunk<&ActionCastSpellAtLocation>);
+    insert(240, "ActionSpeakStringByStrRef", R_VOID, {R_INT, R_INT}, &thunk<&ActionSpeakStringByStrRef>);
+    insert(287, "ActionUseFeat", R_VOID, {R_INT, R_OBJECT}, &thunk<&ActionUseFeat>);
+    insert(288, "ActionUseSkill", R_VOID, {R_INT, R_OBJECT, R_INT, R_OBJECT}, &thunk<&ActionUseSkill>);
+    insert(294, "ActionDoCommand", R_VOID, {R_ACTION}, &thunk<&ActionDoCommand>);
+    insert(309, "ActionUseTalentOnObject", R_VOID, {R_TALENT, R_OBJECT}, &thunk<&ActionUseTalentOnObject>);
+    insert(310, "ActionUseTalentAtLocation", R_VOID, {R_TALENT, R_LOCATION}, &thunk<&ActionUseTalentAtLocation>);
+    insert(329, "ActionInteractObject", R_VOID, {R_OBJECT}, &thunk<&ActionInteractObject>);
+    insert(360, "ActionMoveAwayFromLocation", R_VOID, {R_LOCATION, R_INT, R_FLOAT}, &thunk<&ActionMoveAwayFromLocation>);
+    insert(379, "ActionSurrenderToEnemies", R_VOID, {}, &thunk<&ActionSurrenderToEnemies>);
+    insert(382, "ActionForceMoveToLocation", R_VOID, {R_LOCATION, R_INT, R_FLOAT}, &thunk<&ActionForceMoveToLocation>);
+    insert(383, "ActionForceMoveToObject", R_VOID, {R_OBJECT, R_INT, R_FLOAT, R_FLOAT}, &thunk<&ActionForceMoveToObject>);
+    insert(399, "ActionEquipMostDamagingMelee", R_VOID, {R_OBJECT, R_INT}, &thunk<&ActionEquipMostDamagingMelee>);
+    insert(400, "ActionEquipMostDamagingRanged", R_VOID, {R_OBJECT}, &thunk<&ActionEquipMostDamagingRanged>);
+    insert(404, "ActionEquipMostEffectiveArmor", R_VOID, {}, &thunk<&ActionEquipMostEffectiveArmor>);
+    insert(483, "ActionUnlockObject", R_VOID, {R_OBJECT}, &thunk<&ActionUnlockObject>);
+    insert(484, "ActionLockObject", R_VOID, {R_OBJECT}, &thunk<&ActionLockObject>);
+    insert(501, "ActionCastFakeSpellAtObject", R_VOID, {R_INT, R_OBJECT, R_INT}, &thunk<&ActionCastFakeSpellAtObject>);
+    insert(502, "ActionCastFakeSpellAtLocation", R_VOID, {R_INT, R_LOCATION, R_INT}, &thunk<&ActionCastFakeSpellAtLocation>);
+    insert(700, "ActionBarkString", R_VOID, {R_INT}, &thunk<&ActionBarkString>);
+    insert(730, "ActionFollowLeader", R_VOID, {}, &thunk<&ActionFollowLeader>);
 }
 
 void Routines::registerActionTslRoutines() {
-    insert(20, "ActionRandomWalk", R_VOID, {}, &ActionRandomWalk);
-    insert(21, "ActionMoveToLocation", R_VOID, {R_LOCATION, R_INT}, &ActionMoveToLocation);
-    insert(22, "ActionMoveToObject", R_VOID, {R_OBJECT, R_INT, R_FLOAT}, &ActionMoveToObject);
-    insert(23, "ActionMoveAwayFromObject", R_VOID, {R_OBJECT, R_INT, R_FLOAT}, &ActionMoveAwayFromObject);
-    insert(32, "ActionEquipItem", R_VOID, {R_OBJECT, R_INT, R_INT}, &ActionEquipItem);
-    insert(33, "ActionUnequipItem", R_VOID, {R_OBJECT, R_INT}, &ActionUnequipItem);
-    insert(34, "ActionPickUpItem", R_VOID, {R_OBJECT}, &ActionPickUpItem);
-    insert(35, "ActionPutDownItem", R_VOID, {R_OBJECT}, &ActionPutDownItem);
-    insert(37, "ActionAttack", R_VOID, {R_OBJECT, R_INT}, &ActionAttack);
-    insert(39, "ActionSpeakString", R_VOID, {R_STRING, R_INT}, &ActionSpeakString);
-    insert(40, "ActionPlayAnimation", R_VOID, {R_INT, R_FLOAT, R_FLOAT}, &ActionPlayAnimation);
-    insert(43, "ActionOpenDoor", R_VOID, {R_OBJECT}, &ActionOpenDoor);
-    insert(44, "ActionCloseDoor", R_VOID, {R_OBJECT}, &ActionCloseDoor);
-    insert(48, "ActionCastSpellAtObject", R_VOID, {R_INT, R_OBJECT, R_INT, R_INT, R_INT, R_INT, R_INT}, &ActionCastSpellAtObject);
-    insert(135, "ActionGiveItem", R_VOID, {R_OBJECT, R_OBJECT}, &ActionGiveItem);
-    insert(136, "ActionTakeItem", R_VOID, {R_OBJECT, R_OBJECT}, &ActionTakeItem);
-    insert(167, "ActionForceFollowObject", R_VOID, {R_OBJECT, R_FLOAT}, &ActionForceFollowObject);
-    insert(196, "ActionJumpToObject", R_VOID, {R_OBJECT, R_INT}, &ActionJumpToObject);
-    insert(202, "ActionWait", R_VOID, {R_FLOAT}, &ActionWait);
-    insert(204, "ActionStartConversation", R_VOID, {R_OBJECT, R_STRING, R_INT, R_INT, R_INT, R_STRING, R_STRING, R_STRING, R_STRING, R_STRING, R_STRING, R_INT, R_INT, R_INT, R_INT}, &ActionStartConversation);
-    insert(205, "ActionPauseConversation", R_VOID, {}, &ActionPauseConversation);
-    insert(206, "ActionResumeConversation", R_VOID, {}, &ActionResumeConversation);
-    insert(214, "ActionJumpToLocation", R_VOID, {R_LOCATION}, &ActionJumpToLocation);
-    insert(234, "ActionCastSpellAtLocation", R_VOID, {R_INT, R_LOCATION, R_INT, R_INT, R_INT, R_INT}, &ActionCastSpellAtLocation);
-    insert(240, "ActionSpeakStringByStrRef", R_VOID, {R_INT, R_INT}, &ActionSpeakStringByStrRef);
-    insert(287, "ActionUseFeat", R_VOID, {R_INT, R_OBJECT}, &ActionUseFeat);
-    insert(288, "ActionUseSkill", R_VOID, {R_INT, R_OBJECT, R_INT, R_OBJECT}, &ActionUseSkill);
-    insert(294, "ActionDoCommand", R_VOID, {R_ACTION}, &ActionDoCommand);
-    insert(309, "ActionUseTalentOnObject", R_VOID, {R_TALENT, R_OBJECT}, &ActionUseTalentOnObject);
-    insert(310, "ActionUseTalentAtLocation", R_VOID, {R_TALENT, R_LOCATION}, &ActionUseTalentAtLocation);
-    insert(329, "ActionInteractObject", R_VOID, {R_OBJECT}, &ActionInteractObject);
-    insert(360, "ActionMoveAwayFromLocation", R_VOID, {R_LOCATION, R_INT, R_FLOAT}, &ActionMoveAwayFromLocation);
-    insert(379, "ActionSurrenderToEnemies", R_VOID, {}, &ActionSurrenderToEnemies);
-    insert(382, "ActionForceMoveToLocation", R_VOID, {R_LOCATION, R_INT, R_FLOAT}, &ActionForceMoveToLocation);
-    insert(383, "ActionForceMoveToObject", R_VOID, {R_OBJECT, R_INT, R_FLOAT, R_FLOAT}, &ActionForceMoveToObject);
-    insert(399, "ActionEquipMostDamagingMelee", R_VOID, {R_OBJECT, R_INT}, &ActionEquipMostDamagingMelee);
-    insert(400, "ActionEquipMostDamagingRanged", R_VOID, {R_OBJECT}, &ActionEquipMostDamagingRanged);
-    insert(404, "ActionEquipMostEffectiveArmor", R_VOID, {}, &ActionEquipMostEffectiveArmor);
-    insert(483, "ActionUnlockObject", R_VOID, {R_OBJECT}, &ActionUnlockObject);
-    insert(484, "ActionLockObject", R_VOID, {R_OBJECT}, &ActionLockObject);
-    insert(501, "ActionCastFakeSpellAtObject", R_VOID, {R_INT, R_OBJECT, R_INT}, &ActionCastFakeSpellAtObject);
-    insert(502, "ActionCastFakeSpellAtLocation", R_VOID, {R_INT, R_LOCATION, R_INT}, &ActionCastFakeSpellAtLocation);
-    insert(700, "ActionBarkString", R_VOID, {R_INT}, &ActionBarkString);
-    insert(730, "ActionFollowLeader", R_VOID, {}, &ActionFollowLeader);
-    insert(843, "ActionFollowOwner", R_VOID, {R_FLOAT}, &ActionFollowOwner);
-    insert(853, "ActionSwitchWeapons", R_VOID, {}, &ActionSwitchWeapons);
+    insert(20, "ActionRandomWalk", R_VOID, {}, &thunk<&ActionRandomWalk>);
+    insert(21, "ActionMoveToLocation", R_VOID, {R_LOCATION, R_INT}, &thunk<&ActionMoveToLocation>);
+    insert(22, "ActionMoveToObject", R_VOID, {R_OBJECT, R_INT, R_FLOAT}, &thunk<&ActionMoveToObject>);
+    insert(23, "ActionMoveAwayFromObject", R_VOID, {R_OBJECT, R_INT, R_FLOAT}, &thunk<&ActionMoveAwayFromObject>);
+    insert(32, "ActionEquipItem", R_VOID, {R_OBJECT, R_INT, R_INT}, &thunk<&ActionEquipItem>);
+    insert(33, "ActionUnequipItem", R_VOID, {R_OBJECT, R_INT}, &thunk<&ActionUnequipItem>);
+    insert(34, "ActionPickUpItem", R_VOID, {R_OBJECT}, &thunk<&ActionPickUpItem>);
+    insert(35, "ActionPutDownItem", R_VOID, {R_OBJECT}, &thunk<&ActionPutDownItem>);
+    insert(37, "ActionAttack", R_VOID, {R_OBJECT, R_INT}, &thunk<&ActionAttack>);
+    insert(39, "ActionSpeakString", R_VOID, {R_STRING, R_INT}, &thunk<&ActionSpeakString>);
+    insert(40, "ActionPlayAnimation", R_VOID, {R_INT, R_FLOAT, R_FLOAT}, &thunk<&ActionPlayAnimation>);
+    insert(43, "ActionOpenDoor", R_VOID, {R_OBJECT}, &thunk<&ActionOpenDoor>);
+    insert(44, "ActionCloseDoor", R_VOID, {R_OBJECT}, &thunk<&ActionCloseDoor>);
+    insert(48, "ActionCastSpellAtObject", R_VOID, {R_INT, R_OBJECT, R_INT, R_INT, R_INT, R_INT, R_INT}, &thunk<&ActionCastSpellAtObject>);
+    insert(135, "ActionGiveItem", R_VOID, {R_OBJECT, R_OBJECT}, &thunk<&ActionGiveItem>);
+    insert(136, "ActionTakeItem", R_VOID, {R_OBJECT, R_OBJECT}, &thunk<&ActionTakeItem>);
+    insert(167, "ActionForceFollowObject", R_VOID, {R_OBJECT, R_FLOAT}, &thunk<&ActionForceFollowObject>);
+    insert(196, "ActionJumpToObject", R_VOID, {R_OBJECT, R_INT}, &thunk<&ActionJumpToObject>);
+    insert(202, "ActionWait", R_VOID, {R_FLOAT}, &thunk<&ActionWait>);
+    insert(204, "ActionStartConversation", R_VOID, {R_OBJECT, R_STRING, R_INT, R_INT, R_INT, R_STRING, R_STRING, R_STRING, R_STRING, R_STRING, R_STRING, R_INT, R_INT, R_INT, R_INT}, &thunk<&ActionStartConversation>);
+    insert(205, "ActionPauseConversation", R_VOID, {}, &thunk<&ActionPauseConversation>);
+    insert(206, "ActionResumeConversation", R_VOID, {}, &thunk<&ActionResumeConversation>);
+    insert(214, "ActionJumpToLocation", R_VOID, {R_LOCATION}, &thunk<&ActionJumpToLocation>);
+    insert(234, "ActionCastSpellAtLocation", R_VOID, {R_INT, R_LOCATION, R_INT, R_INT, R_INT, R_INT}, &thunk<&ActionCastSpellAtLocation>);
+    insert(240, "ActionSpeakStringByStrRef", R_VOID, {R_INT, R_INT}, &thunk<&ActionSpeakStringByStrRef>);
+    insert(287, "ActionUseFeat", R_VOID, {R_INT, R_OBJECT}, &thunk<&ActionUseFeat>);
+    insert(288, "ActionUseSkill", R_VOID, {R_INT, R_OBJECT, R_INT, R_OBJECT}, &thunk<&ActionUseSkill>);
+    insert(294, "ActionDoCommand", R_VOID, {R_ACTION}, &thunk<&ActionDoCommand>);
+    insert(309, "ActionUseTalentOnObject", R_VOID, {R_TALENT, R_OBJECT}, &thunk<&ActionUseTalentOnObject>);
+    insert(310, "ActionUseTalentAtLocation", R_VOID, {R_TALENT, R_LOCATION}, &thunk<&ActionUseTalentAtLocation>);
+    insert(329, "ActionInteractObject", R_VOID, {R_OBJECT}, &thunk<&ActionInteractObject>);
+    insert(360, "ActionMoveAwayFromLocation", R_VOID, {R_LOCATION, R_INT, R_FLOAT}, &thunk<&ActionMoveAwayFromLocation>);
+    insert(379, "ActionSurrenderToEnemies", R_VOID, {}, &thunk<&ActionSurrenderToEnemies>);
+    insert(382, "ActionForceMoveToLocation", R_VOID, {R_LOCATION, R_INT, R_FLOAT}, &thunk<&ActionForceMoveToLocation>);
+    insert(383, "ActionForceMoveToObject", R_VOID, {R_OBJECT, R_INT, R_FLOAT, R_FLOAT}, &thunk<&ActionForceMoveToObject>);
+    insert(399, "ActionEquipMostDamagingMelee", R_VOID, {R_OBJECT, R_INT}, &thunk<&ActionEquipMostDamagingMelee>);
+    insert(400, "ActionEquipMostDamagingRanged", R_VOID, {R_OBJECT}, &thunk<&ActionEquipMostDamagingRanged>);
+    insert(404, "ActionEquipMostEffectiveArmor", R_VOID, {}, &thunk<&ActionEquipMostEffectiveArmor>);
+    insert(483, "ActionUnlockObject", R_VOID, {R_OBJECT}, &thunk<&ActionUnlockObject>);
+    insert(484, "ActionLockObject", R_VOID, {R_OBJECT}, &thunk<&ActionLockObject>);
+    insert(501, "ActionCastFakeSpellAtObject", R_VOID, {R_INT, R_OBJECT, R_INT}, &thunk<&ActionCastFakeSpellAtObject>);
+    insert(502, "ActionCastFakeSpellAtLocation", R_VOID, {R_INT, R_LOCATION, R_INT}, &thunk<&ActionCastFakeSpellAtLocation>);
+    insert(700, "ActionBarkString", R_VOID, {R_INT}, &thunk<&ActionBarkString>);
+    insert(730, "ActionFollowLeader", R_VOID, {}, &thunk<&ActionFollowLeader>);
+    insert(843, "ActionFollowOwner", R_VOID, {R_FLOAT}, &thunk<&ActionFollowOwner>);
+    insert(853, "ActionSwitchWeapons", R_VOID, {}, &thunk<&ActionSwitchWeapons>);
 }
 
 } // namespace game
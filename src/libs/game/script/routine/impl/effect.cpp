@@ -129,13 +129,13 @@ namespace reone {
 
 namespace game {
 
-static Variable EffectAssuredHit(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectAssuredHit(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<AssuredHitEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectHeal(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectHeal(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nDamageToHeal = getInt(args, 0);
 
@@ -146,7 +146,7 @@ static Variable EffectHeal(const std::vector<Variable> &args, const RoutineConte
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectDamage(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectDamage(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nDamageAmount = getInt(args, 0);
     auto nDamageType = getIntOrElse(args, 1, 8);
@@ -161,7 +161,7 @@ static Variable EffectDamage(const std::vector<Variable> &args, const RoutineCon
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectAbilityIncrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectAbilityIncrease(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nAbilityToIncrease = getInt(args, 0);
     auto nModifyBy = getInt(args, 1);
@@ -174,7 +174,7 @@ static Variable EffectAbilityIncrease(const std::vector<Variable> &args, const R
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectDamageResistance(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectDamageResistance(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nDamageType = getInt(args, 0);
     auto nAmount = getInt(args, 1);
@@ -188,7 +188,7 @@ static Variable EffectDamageResistance(const std::vector<Variable> &args, const
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectResurrection(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectResurrection(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nHPPercent = getIntOrElse(args, 0, 0);
 
@@ -199,7 +199,7 @@ static Variable EffectResurrection(const std::vector<Variable> &args, const Rout
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectACIncrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectACIncrease(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nValue = getInt(args, 0);
     auto nModifyType = getIntOrElse(args, 1, 0);
@@ -213,7 +213,7 @@ static Variable EffectACIncrease(const std::vector<Variable> &args, const Routin
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectSavingThrowIncrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectSavingThrowIncrease(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nSave = getInt(args, 0);
     auto nValue = getInt(args, 1);
@@ -227,7 +227,7 @@ static Variable EffectSavingThrowIncrease(const std::vector<Variable> &args, con
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectAttackIncrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectAttackIncrease(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nBonus = getInt(args, 0);
     auto nModifierType = getIntOrElse(args, 1, 0);
@@ -240,7 +240,7 @@ static Variable EffectAttackIncrease(const std::vector<Variable> &args, const Ro
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectDamageReduction(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectDamageReduction(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nAmount = getInt(args, 0);
     auto nDamagePower = getInt(args, 1);
@@ -254,7 +254,7 @@ static Variable EffectDamageReduction(const std::vector<Variable> &args, const R
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectDamageIncrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectDamageIncrease(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nBonus = getInt(args, 0);
     auto nDamageType = getIntOrElse(args, 1, 8);
@@ -267,13 +267,13 @@ static Variable EffectDamageIncrease(const std::vector<Variable> &args, const Ro
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectEntangle(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectEntangle(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<EntangleEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectDeath(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectDeath(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nSpectacularDeath = getIntOrElse(args, 0, 0);
     auto nDisplayFeedback = getIntOrElse(args, 1, 1);
@@ -289,19 +289,19 @@ static Variable EffectDeath(const std::vector<Variable> &args, const RoutineCont
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectKnockdown(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectKnockdown(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<KnockdownEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectParalyze(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectParalyze(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<ParalyzeEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectSpellImmunity(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectSpellImmunity(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nImmunityToSpell = getIntOrElse(args, 0, -1);
 
@@ -313,7 +313,7 @@ static Variable EffectSpellImmunity(const std::vector<Variable> &args, const Rou
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectForceJump(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectForceJump(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
     auto nAdvanced = getIntOrElse(args, 1, 0);
@@ -325,13 +325,13 @@ static Variable EffectForceJump(const std::vector<Variable> &args, const Routine
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectSleep(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectSleep(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<SleepEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectTemporaryForcePoints(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectTemporaryForcePoints(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nTempForce = getInt(args, 0);
 
@@ -342,31 +342,31 @@ static Variable EffectTemporaryForcePoints(const std::vector<Variable> &args, co
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectConfused(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectConfused(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<ConfusedEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectFrightened(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectFrightened(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<FrightenedEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectChoke(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectChoke(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<ChokeEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectStunned(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectStunned(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<StunnedEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectRegenerate(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectRegenerate(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nAmount = getInt(args, 0);
     auto fIntervalSeconds = getFloat(args, 1);
@@ -378,7 +378,7 @@ static Variable EffectRegenerate(const std::vector<Variable> &args, const Routin
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectMovementSpeedIncrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectMovementSpeedIncrease(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nNewSpeedPercent = getInt(args, 0);
 
@@ -389,7 +389,7 @@ static Variable EffectMovementSpeedIncrease(const std::vector<Variable> &args, c
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectAreaOfEffect(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectAreaOfEffect(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nAreaEffectId = getInt(args, 0);
     auto sOnEnterScript = getStringOrElse(args, 1, "");
@@ -403,7 +403,7 @@ static Variable EffectAreaOfEffect(const std::vector<Variable> &args, const Rout
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectVisualEffect(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectVisualEffect(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nVisualEffectId = getInt(args, 0);
     auto nMissEffect = getIntOrElse(args, 1, 0);
@@ -416,7 +416,7 @@ static Variable EffectVisualEffect(const std::vector<Variable> &args, const Rout
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectLinkEffects(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectLinkEffects(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto eChildEffect = getEffect(args, 0);
     auto eParentEffect = getEffect(args, 1);
@@ -428,7 +428,7 @@ static Variable EffectLinkEffects(const std::vector<Variable> &args, const Routi
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectBeam(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectBeam(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nBeamVisualEffect = getInt(args, 0);
     auto oEffector = getObject(args, 1, ctx);
@@ -444,7 +444,7 @@ static Variable EffectBeam(const std::vector<Variable> &args, const RoutineConte
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectForceResistanceIncrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectForceResistanceIncrease(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nValue = getInt(args, 0);
 
@@ -455,13 +455,13 @@ static Variable EffectForceResistanceIncrease(const std::vector<Variable> &args,
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectBodyFuel(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectBodyFuel(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<BodyFuelEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectPoison(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectPoison(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nPoisonType = getInt(args, 0);
 
@@ -473,7 +473,7 @@ static Variable EffectPoison(const std::vector<Variable> &args, const RoutineCon
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectAssuredDeflection(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectAssuredDeflection(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nReturn = getIntOrElse(args, 0, 0);
 
@@ -484,7 +484,7 @@ static Variable EffectAssuredDeflection(const std::vector<Variable> &args, const
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectForcePushTargeted(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectForcePushTargeted(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto lCentre = getLocationArgument(args, 0);
     auto nIgnoreTestDirectLine = getIntOrElse(args, 1, 0);
@@ -497,13 +497,13 @@ static Variable EffectForcePushTargeted(const std::vector<Variable> &args, const
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectHaste(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectHaste(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<HasteEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectImmunity(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectImmunity(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nImmunityType = getInt(args, 0);
 
@@ -515,7 +515,7 @@ static Variable EffectImmunity(const std::vector<Variable> &args, const RoutineC
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectDamageImmunityIncrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectDamageImmunityIncrease(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nDamageType = getInt(args, 0);
     auto nPercentImmunity = getInt(args, 1);
@@ -528,7 +528,7 @@ static Variable EffectDamageImmunityIncrease(const std::vector<Variable> &args,
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectTemporaryHitpoints(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectTemporaryHitpoints(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nHitPoints = getInt(args, 0);
 
@@ -539,7 +539,7 @@ static Variable EffectTemporaryHitpoints(const std::vector<Variable> &args, cons
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectSkillIncrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectSkillIncrease(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nSkill = getInt(args, 0);
     auto nValue = getInt(args, 1);
@@ -552,7 +552,7 @@ static Variable EffectSkillIncrease(const std::vector<Variable> &args, const Rou
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectDamageForcePoints(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectDamageForcePoints(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nDamage = getInt(args, 0);
 
@@ -563,7 +563,7 @@ static Variable EffectDamageForcePoints(const std::vector<Variable> &args, const
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectHealForcePoints(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectHealForcePoints(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nHeal = getInt(args, 0);
 
@@ -574,7 +574,7 @@ static Variable EffectHealForcePoints(const std::vector<Variable> &args, const R
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectHitPointChangeWhenDying(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectHitPointChangeWhenDying(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto fHitPointChangePerRound = getFloat(args, 0);
 
@@ -585,19 +585,19 @@ static Variable EffectHitPointChangeWhenDying(const std::vector<Variable> &args,
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectDroidStun(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectDroidStun(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<DroidStunEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectForcePushed(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectForcePushed(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<ForcePushedEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectForceResisted(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectForceResisted(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oSource = getObject(args, 0, ctx);
 
@@ -608,13 +608,13 @@ static Variable EffectForceResisted(const std::vector<Variable> &args, const Rou
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectForceFizzle(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectForceFizzle(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<ForceFizzleEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectAbilityDecrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectAbilityDecrease(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nAbility = getInt(args, 0);
     auto nModifyBy = getInt(args, 1);
@@ -627,7 +627,7 @@ static Variable EffectAbilityDecrease(const std::vector<Variable> &args, const R
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectAttackDecrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectAttackDecrease(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nPenalty = getInt(args, 0);
     auto nModifierType = getIntOrElse(args, 1, 0);
@@ -640,7 +640,7 @@ static Variable EffectAttackDecrease(const std::vector<Variable> &args, const Ro
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectDamageDecrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectDamageDecrease(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nPenalty = getInt(args, 0);
     auto nDamageType = getIntOrElse(args, 1, 8);
@@ -653,7 +653,7 @@ static Variable EffectDamageDecrease(const std::vector<Variable> &args, const Ro
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectDamageImmunityDecrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectDamageImmunityDecrease(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nDamageType = getInt(args, 0);
     auto nPercentImmunity = getInt(args, 1);
@@ -666,7 +666,7 @@ static Variable EffectDamageImmunityDecrease(const std::vector<Variable> &args,
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectACDecrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectACDecrease(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nValue = getInt(args, 0);
     auto nModifyType = getIntOrElse(args, 1, 0);
@@ -680,7 +680,7 @@ static Variable EffectACDecrease(const std::vector<Variable> &args, const Routin
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectMovementSpeedDecrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectMovementSpeedDecrease(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nPercentChange = getInt(args, 0);
 
@@ -691,7 +691,7 @@ static Variable EffectMovementSpeedDecrease(const std::vector<Variable> &args, c
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectSavingThrowDecrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectSavingThrowDecrease(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nSave = getInt(args, 0);
     auto nValue = getInt(args, 1);
@@ -705,7 +705,7 @@ static Variable EffectSavingThrowDecrease(const std::vector<Variable> &args, con
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectSkillDecrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectSkillDecrease(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nSkill = getInt(args, 0);
     auto nValue = getInt(args, 1);
@@ -718,7 +718,7 @@ static Variable EffectSkillDecrease(const std::vector<Variable> &args, const Rou
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectForceResistanceDecrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectForceResistanceDecrease(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nValue = getInt(args, 0);
 
@@ -729,7 +729,7 @@ static Variable EffectForceResistanceDecrease(const std::vector<Variable> &args,
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectInvisibility(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectInvisibility(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nInvisibilityType = getInt(args, 0);
 
@@ -741,7 +741,7 @@ static Variable EffectInvisibility(const std::vector<Variable> &args, const Rout
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectConcealment(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectConcealment(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nPercentage = getInt(args, 0);
 
@@ -752,7 +752,7 @@ static Variable EffectConcealment(const std::vector<Variable> &args, const Routi
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectForceShield(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectForceShield(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nShield = getInt(args, 0);
 
@@ -763,7 +763,7 @@ static Variable EffectForceShield(const std::vector<Variable> &args, const Routi
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectDispelMagicAll(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectDispelMagicAll(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nCasterLevel = getInt(args, 0);
 
@@ -774,7 +774,7 @@ static Variable EffectDispelMagicAll(const std::vector<Variable> &args, const Ro
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectDisguise(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectDisguise(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nDisguiseAppearance = getInt(args, 0);
 
@@ -785,25 +785,25 @@ static Variable EffectDisguise(const std::vector<Variable> &args, const RoutineC
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectTrueSeeing(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectTrueSeeing(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<TrueSeeingEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectSeeInvisible(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectSeeInvisible(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<SeeInvisibleEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectTimeStop(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectTimeStop(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<TimeStopEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectBlasterDeflectionIncrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectBlasterDeflectionIncrease(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nChange = getInt(args, 0);
 
@@ -814,7 +814,7 @@ static Variable EffectBlasterDeflectionIncrease(const std::vector<Variable> &arg
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectBlasterDeflectionDecrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectBlasterDeflectionDecrease(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nChange = getInt(args, 0);
 
@@ -825,13 +825,13 @@ static Variable EffectBlasterDeflectionDecrease(const std::vector<Variable> &arg
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectHorrified(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectHorrified(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<HorrifiedEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectSpellLevelAbsorption(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectSpellLevelAbsorption(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nMaxSpellLevelAbsorbed = getInt(args, 0);
     auto nTotalSpellLevelsAbsorbed = getIntOrElse(args, 1, 0);
@@ -844,7 +844,7 @@ static Variable EffectSpellLevelAbsorption(const std::vector<Variable> &args, co
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectDispelMagicBest(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectDispelMagicBest(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nCasterLevel = getInt(args, 0);
 
@@ -855,7 +855,7 @@ static Variable EffectDispelMagicBest(const std::vector<Variable> &args, const R
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectMissChance(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectMissChance(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nPercentage = getInt(args, 0);
 
@@ -866,7 +866,7 @@ static Variable EffectMissChance(const std::vector<Variable> &args, const Routin
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectModifyAttacks(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectModifyAttacks(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nAttacks = getInt(args, 0);
 
@@ -877,7 +877,7 @@ static Variable EffectModifyAttacks(const std::vector<Variable> &args, const Rou
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectDamageShield(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectDamageShield(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nDamageAmount = getInt(args, 0);
     auto nRandomAmount = getInt(args, 1);
@@ -891,7 +891,7 @@ static Variable EffectDamageShield(const std::vector<Variable> &args, const Rout
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectForceDrain(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectForceDrain(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nDamage = getInt(args, 0);
 
@@ -902,13 +902,13 @@ static Variable EffectForceDrain(const std::vector<Variable> &args, const Routin
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectPsychicStatic(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectPsychicStatic(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<PsychicStaticEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectLightsaberThrow(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectLightsaberThrow(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget1 = getObject(args, 0, ctx);
     auto oTarget2 = getObjectOrNull(args, 1, ctx);
@@ -926,31 +926,31 @@ static Variable EffectLightsaberThrow(const std::vector<Variable> &args, const R
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectWhirlWind(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectWhirlWind(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<WhirlWindEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectCutSceneHorrified(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectCutSceneHorrified(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<CutsceneHorrifiedEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectCutSceneParalyze(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectCutSceneParalyze(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<CutsceneParalyzeEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectCutSceneStunned(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectCutSceneStunned(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<CutsceneStunnedEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectForceBody(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectForceBody(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nLevel = getInt(args, 0);
 
@@ -961,19 +961,19 @@ static Variable EffectForceBody(const std::vector<Variable> &args, const Routine
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectFury(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectFury(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<FuryEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectBlind(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectBlind(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<BlindEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectFPRegenModifier(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectFPRegenModifier(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nPercent = getInt(args, 0);
 
@@ -984,7 +984,7 @@ static Variable EffectFPRegenModifier(const std::vector<Variable> &args, const R
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectVPRegenModifier(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectVPRegenModifier(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nPercent = getInt(args, 0);
 
@@ -995,31 +995,31 @@ static Variable EffectVPRegenModifier(const std::vector<Variable> &args, const R
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectCrush(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectCrush(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<CrushEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectDroidConfused(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectDroidConfused(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<DroidConfusedEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectForceSight(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectForceSight(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<ForceSightEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectMindTrick(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectMindTrick(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<MindTrickEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectFactionModifier(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectFactionModifier(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nNewFaction = getInt(args, 0);
 
@@ -1030,183 +1030,183 @@ static Variable EffectFactionModifier(const std::vector<Variable> &args, const R
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectDroidScramble(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectDroidScramble(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<DroidScrambleEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
 void Routines::registerEffectKotorRoutines() {
-    insert(51, "EffectAssuredHit", R_EFFECT, {}, &EffectAssuredHit);
-    insert(78, "EffectHeal", R_EFFECT, {R_INT}, &EffectHeal);
-    insert(79, "EffectDamage", R_EFFECT, {R_INT, R_INT, R_INT}, &EffectDamage);
-    insert(80, "EffectAbilityIncrease", R_EFFECT, {R_INT, R_INT}, &EffectAbilityIncrease);
-    insert(81, "EffectDamageResistance", R_EFFECT, {R_INT, R_INT, R_INT}, &EffectDamageResistance);
-    insert(82, "EffectResurrection", R_EFFECT, {}, &EffectResurrection);
-    insert(115, "EffectACIncrease", R_EFFECT, {R_INT, R_INT, R_INT}, &EffectACIncrease);
-    insert(117, "EffectSavingThrowIncrease", R_EFFECT, {R_INT, R_INT, R_INT}, &EffectSavingThrowIncrease);
-    insert(118, "EffectAttackIncrease", R_EFFECT, {R_INT, R_INT}, &EffectAttackIncrease);
-    insert(119, "EffectDamageReduction", R_EFFECT, {R_INT, R_INT, R_INT}, &EffectDamageReduction);
-    insert(120, "EffectDamageIncrease", R_EFFECT, {R_INT, R_INT}, &EffectDamageIncrease);
-    insert(130, "EffectEntangle", R_EFFECT, {}, &EffectEntangle);
-    insert(133, "EffectDeath", R_EFFECT, {R_INT, R_INT}, &EffectDeath);
-    insert(134, "EffectKnockdown", R_EFFECT, {}, &EffectKnockdown);
-    insert(148, "EffectParalyze", R_EFFECT, {}, &EffectParalyze);
-    insert(149, "EffectSpellImmunity", R_EFFECT, {R_INT}, &EffectSpellImmunity);
-    insert(153, "EffectForceJump", R_EFFECT, {R_OBJECT, R_INT}, &EffectForceJump);
-    insert(154, "EffectSleep", R_EFFECT, {}, &EffectSleep);
-    insert(156, "EffectTemporaryForcePoints", R_EFFECT, {R_INT}, &EffectTemporaryForcePoints);
-    insert(157, "EffectConfused", R_EFFECT, {}, &EffectConfused);
-    insert(158, "EffectFrightened", R_EFFECT, {}, &EffectFrightened);
-    insert(159, "EffectChoke", R_EFFECT, {}, &EffectChoke);
-    insert(161, "EffectStunned", R_EFFECT, {}, &EffectStunned);
-    insert(164, "EffectRegenerate", R_EFFECT, {R_INT, R_FLOAT}, &EffectRegenerate);
-    insert(165, "EffectMovementSpeedIncrease", R_EFFECT, {R_INT}, &EffectMovementSpeedIncrease);
-    insert(171, "EffectAreaOfEffect", R_EFFECT, {R_INT, R_STRING, R_STRING, R_STRING}, &EffectAreaOfEffect);
-    insert(180, "EffectVisualEffect", R_EFFECT, {R_INT, R_INT}, &EffectVisualEffect);
-    insert(199, "EffectLinkEffects", R_EFFECT, {R_EFFECT, R_EFFECT}, &EffectLinkEffects);
-    insert(207, "EffectBeam", R_EFFECT, {R_INT, R_OBJECT, R_INT, R_INT}, &EffectBeam);
-    insert(212, "EffectForceResistanceIncrease", R_EFFECT, {R_INT}, &EffectForceResistanceIncrease);
-    insert(224, "EffectBodyFuel", R_EFFECT, {}, &EffectBodyFuel);
-    insert(250, "EffectPoison", R_EFFECT, {R_INT}, &EffectPoison);
-    insert(252, "EffectAssuredDeflection", R_EFFECT, {R_INT}, &EffectAssuredDeflection);
-    insert(269, "EffectForcePushTargeted", R_EFFECT, {R_LOCATION, R_INT}, &EffectForcePushTargeted);
-    insert(270, "EffectHaste", R_EFFECT, {}, &EffectHaste);
-    insert(273, "EffectImmunity", R_EFFECT, {R_INT}, &EffectImmunity);
-    insert(275, "EffectDamageImmunityIncrease", R_EFFECT, {R_INT, R_INT}, &EffectDamageImmunityIncrease);
-    insert(314, "EffectTemporaryHitpoints", R_EFFECT, {R_INT}, &EffectTemporaryHitpoints);
-    insert(351, "EffectSkillIncrease", R_EFFECT, {R_INT, R_INT}, &EffectSkillIncrease);
-    insert(372, "EffectDamageForcePoints", R_EFFECT, {R_INT}, &EffectDamageForcePoints);
-    insert(373, "EffectHealForcePoints", R_EFFECT, {R_INT}, &EffectHealForcePoints);
-    insert(387, "EffectHitPointChangeWhenDying", R_EFFECT, {R_FLOAT}, &EffectHitPointChangeWhenDying);
-    insert(391, "EffectDroidStun", R_EFFECT, {}, &EffectDroidStun);
-    insert(392, "EffectForcePushed", R_EFFECT, {}, &EffectForcePushed);
-    insert(402, "EffectForceResisted", R_EFFECT, {R_OBJECT}, &EffectForceResisted);
-    insert(420, "EffectForceFizzle", R_EFFECT, {}, &EffectForceFizzle);
-    insert(446, "EffectAbilityDecrease", R_EFFECT, {R_INT, R_INT}, &EffectAbilityDecrease);
-    insert(447, "EffectAttackDecrease", R_EFFECT, {R_INT, R_INT}, &EffectAttackDecrease);
-    insert(448, "EffectDamageDecrease", R_EFFECT, {R_INT, R_INT}, &EffectDamageDecrease);
-    insert(449, "EffectDamageImmunityDecrease", R_EFFECT, {R_INT, R_INT}, &EffectDamageImmunityDecrease);
-    insert(450, "EffectACDecrease", R_EFFECT, {R_INT, R_INT, R_INT}, &EffectACDecrease);
-    insert(451, "EffectMovementSpeedDecrease", R_EFFECT, {R_INT}, &EffectMovementSpeedDecrease);
-    insert(452, "EffectSavingThrowDecrease", R_EFFECT, {R_INT, R_INT, R_INT}, &EffectSavingThrowDecrease);
-    insert(453, "EffectSkillDecrease", R_EFFECT, {R_INT, R_INT}, &EffectSkillDecrease);
-    insert(454, "EffectForceResistanceDecrease", R_EFFECT, {R_INT}, &EffectForceResistanceDecrease);
-    insert(457, "EffectInvisibility", R_EFFECT, {R_INT}, &EffectInvisibility);
-    insert(458, "EffectConcealment", R_EFFECT, {R_INT}, &EffectConcealment);
-    insert(459, "EffectForceShield", R_EFFECT, {R_INT}, &EffectForceShield);
-    insert(460, "EffectDispelMagicAll", R_EFFECT, {R_INT}, &EffectDispelMagicAll);
-    insert(463, "EffectDisguise", R_EFFECT, {R_INT}, &EffectDisguise);
-    insert(465, "EffectTrueSeeing", R_EFFECT, {}, &EffectTrueSeeing);
-    insert(466, "EffectSeeInvisible", R_EFFECT, {}, &EffectSeeInvisible);
-    insert(467, "EffectTimeStop", R_EFFECT, {}, &EffectTimeStop);
-    insert(469, "EffectBlasterDeflectionIncrease", R_EFFECT, {R_INT}, &EffectBlasterDeflectionIncrease);
-    insert(470, "EffectBlasterDeflectionDecrease", R_EFFECT, {R_INT}, &EffectBlasterDeflectionDecrease);
-    insert(471, "EffectHorrified", R_EFFECT, {}, &EffectHorrified);
-    insert(472, "EffectSpellLevelAbsorption", R_EFFECT, {R_INT, R_INT, R_INT}, &EffectSpellLevelAbsorption);
-    insert(473, "EffectDispelMagicBest", R_EFFECT, {R_INT}, &EffectDispelMagicBest);
-    insert(477, "EffectMissChance", R_EFFECT, {R_INT}, &EffectMissChance);
-    insert(485, "EffectModifyAttacks", R_EFFECT, {R_INT}, &EffectModifyAttacks);
-    insert(487, "EffectDamageShield", R_EFFECT, {R_INT, R_INT, R_INT}, &EffectDamageShield);
-    insert(675, "EffectForceDrain", R_EFFECT, {R_INT}, &EffectForceDrain);
-    insert(676, "EffectPsychicStatic", R_EFFECT, {}, &EffectPsychicStatic);
-    insert(702, "EffectLightsaberThrow", R_EFFECT, {R_OBJECT, R_OBJECT, R_OBJECT, R_INT}, &EffectLightsaberThrow);
-    insert(703, "EffectWhirlWind", R_EFFECT, {}, &EffectWhirlWind);
-    insert(754, "EffectCutSceneHorrified", R_EFFECT, {}, &EffectCutSceneHorrified);
-    insert(755, "EffectCutSceneParalyze", R_EFFECT, {}, &EffectCutSceneParalyze);
-    insert(756, "EffectCutSceneStunned", R_EFFECT, {}, &EffectCutSceneStunned);
+    insert(51, "EffectAssuredHit", R_EFFECT, {}, &thunk<&EffectAssuredHit>);
+    insert(78, "EffectHeal", R_EFFECT, {R_INT}, &thunk<&EffectHeal>);
+    insert(79, "EffectDamage", R_EFFECT, {R_INT, R_INT, R_INT}, &thunk<&EffectDamage>);
+    insert(80, "EffectAbilityIncrease", R_EFFECT, {R_INT, R_INT}, &thunk<&EffectAbilityIncrease>);
+    insert(81, "EffectDamageResistance", R_EFFECT, {R_INT, R_INT, R_INT}, &thunk<&EffectDamageResistance>);
+    insert(82, "EffectResurrection", R_EFFECT, {}, &thunk<&EffectResurrection>);
+    insert(115, "EffectACIncrease", R_EFFECT, {R_INT, R_INT, R_INT}, &thunk<&EffectACIncrease>);
+    insert(117, "EffectSavingThrowIncrease", R_EFFECT, {R_INT, R_INT, R_INT}, &thunk<&EffectSavingThrowIncrease>);
+    insert(118, "EffectAttackIncrease", R_EFFECT, {R_INT, R_INT}, &thunk<&EffectAttackIncrease>);
+    insert(119, "EffectDamageReduction", R_EFFECT, {R_INT, R_INT, R_INT}, &thunk<&EffectDamageReduction>);
+    insert(120, "EffectDamageIncrease", R_EFFECT, {R_INT, R_INT}, &thunk<&EffectDamageIncrease>);
+    insert(130, "EffectEntangle", R_EFFECT, {}, &thunk<&EffectEntangle>);
+    insert(133, "EffectDeath", R_EFFECT, {R_INT, R_INT}, &thunk<&EffectDeath>);
+    insert(134, "EffectKnockdown", R_EFFECT, {}, &thunk<&EffectKnockdown>);
+    insert(148, "EffectParalyze", R_EFFECT, {}, &thunk<&EffectParalyze>);
+    insert(149, "EffectSpellImmunity", R_EFFECT, {R_INT}, &thunk<&EffectSpellImmunity>);
+    insert(153, "EffectForceJump", R_EFFECT, {R_OBJECT, R_INT}, &thunk<&EffectForceJump>);
+    insert(154, "EffectSleep", R_EFFECT, {}, &thunk<&EffectSleep>);
+    insert(156, "EffectTemporaryForcePoints", R_EFFECT, {R_INT}, &thunk<&EffectTemporaryForcePoints>);
+    insert(157, "EffectConfused", R_EFFECT, {}, &thunk<&EffectConfused>);
+    insert(158, "EffectFrightened", R_EFFECT, {}, &thunk<&EffectFrightened>);
+    insert(159, "EffectChoke", R_EFFECT, {}, &thunk<&EffectChoke>);
+    insert(161, "EffectStunned", R_EFFECT, {}, &thunk<&EffectStunned>);
+    insert(164, "EffectRegenerate", R_EFFECT, {R_INT, R_FLOAT}, &thunk<&EffectRegenerate>);
+    insert(165, "EffectMovementSpeedIncrease", R_EFFECT, {R_INT}, &thunk<&EffectMovementSpeedIncrease>);
+    insert(171, "EffectAreaOfEffect", R_EFFECT, {R_INT, R_STRING, R_STRING, R_STRING}, &thunk<&EffectAreaOfEffect>);
+    insert(180, "EffectVisualEffect", R_EFFECT, {R_INT, R_INT}, &thunk<&EffectVisualEffect>);
+    insert(199, "EffectLinkEffects", R_EFFECT, {R_EFFECT, R_EFFECT}, &thunk<&EffectLinkEffects>);
+    insert(207, "EffectBeam", R_EFFECT, {R_INT, R_OBJECT, R_INT, R_INT}, &thunk<&EffectBeam>);
+    insert(212, "EffectForceResistanceIncrease", R_EFFECT, {R_INT}, &thunk<&EffectForceResistanceIncrease>);
+    insert(224, "EffectBodyFuel", R_EFFECT, {}, &thunk<&EffectBodyFuel>);
+    insert(250, "EffectPoison", R_EFFECT, {R_INT}, &thunk<&EffectPoison>);
+    insert(252, "EffectAssuredDeflection", R_EFFECT, {R_INT}, &thunk<&EffectAssuredDeflection>);
+    insert(269, "EffectForcePushTargeted", R_EFFECT, {R_LOCATION, R_INT}, &thunk<&EffectForcePushTargeted>);
+    insert(270, "EffectHaste", R_EFFECT, {}, &thunk<&EffectHaste>);
+    insert(273, "EffectImmunity", R_EFFECT, {R_INT}, &thunk<&EffectImmunity>);
+    insert(275, "EffectDamageImmunityIncrease", R_EFFECT, {R_INT, R_INT}, &thunk<&EffectDamageImmunityIncrease>);
+    insert(314, "EffectTemporaryHitpoints", R_EFFECT, {R_INT}, &thunk<&EffectTemporaryHitpoints>);
+    insert(351, "EffectSkillIncrease", R_EFFECT, {R_INT, R_INT}, &thunk<&EffectSkillIncrease>);
+    insert(372, "EffectDamageForcePoints", R_EFFECT, {R_INT}, &thunk<&EffectDamageForcePoints>);
+    insert(373, "EffectHealForcePoints", R_EFFECT, {R_INT}, &thunk<&EffectHealForcePoints>);
+    insert(387, "EffectHitPointChangeWhenDying", R_EFFECT, {R_FLOAT}, &thunk<&EffectHitPointChangeWhenDying>);
+    insert(391, "EffectDroidStun", R_EFFECT, {}, &thunk<&EffectDroidStun>);
+    insert(392, "EffectForcePushed", R_EFFECT, {}, &thunk<&EffectForcePushed>);
+    insert(402, "EffectForceResisted", R_EFFECT, {R_OBJECT}, &thunk<&EffectForceResisted>);
+    insert(420, "EffectForceFizzle", R_EFFECT, {}, &thunk<&EffectForceFizzle>);
+    insert(446, "EffectAbilityDecrease", R_EFFECT, {R_INT, R_INT}, &thunk<&EffectAbilityDecrease>);
+    insert(447, "EffectAttackDecrease", R_EFFECT, {R_INT, R_INT}, &thunk<&EffectAttackDecrease>);
+    insert(448, "EffectDamageDecrease", R_EFFECT, {R_INT, R_INT}, &thunk<&EffectDamageDecrease>);
+    insert(449, "EffectDamageImmunityDecrease", R_EFFECT, {R_INT, R_INT}, &thunk<&EffectDamageImmunityDecrease>);
+    insert(450, "EffectACDecrease", R_EFFECT, {R_INT, R_INT, R_INT}, &thunk<&EffectACDecrease>);
+    insert(451, "EffectMovementSpeedDecrease", R_EFFECT, {R_INT}, &thunk<&EffectMovementSpeedDecrease>);
+    insert(452, "EffectSavingThrowDecrease", R_EFFECT, {R_INT, R_INT, R_INT}, &thunk<&EffectSavingThrowDecrease>);
+    insert(453, "EffectSkillDecrease", R_EFFECT, {R_INT, R_INT}, &thunk<&EffectSkillDecrease>);
+    insert(454, "EffectForceResistanceDecrease", R_EFFECT, {R_INT}, &thunk<&EffectForceResistanceDecrease>);
+    insert(457, "EffectInvisibility", R_EFFECT, {R_INT}, &thunk<&EffectInvisibility>);
+    insert(458, "EffectConcealment", R_EFFECT, {R_INT}, &thunk<&EffectConcealment>);
+    insert(459, "EffectForceShield", R_EFFECT, {R_INT}, &thunk<&EffectForceShield>);
+    insert(460, "EffectDispelMagicAll", R_EFFECT, {R_INT}, &thunk<&EffectDispelMagicAll>);
+    insert(463, "EffectDisguise", R_EFFECT, {R_INT}, &thunk<&EffectDisguise>);
+    insert(465, "EffectTrueSeeing", R_EFFECT, {}, &thunk<&EffectTrueSeeing>);
+    insert(466, "EffectSeeInvisible", R_EFFECT, {}, &thunk<&EffectSeeInvisible>);
+    insert(467, "EffectTimeStop", R_EFFECT, {}, &thunk<&EffectTimeStop>);
+    insert(469, "EffectBlasterDeflectionIncrease", R_EFFECT, {R_INT}, &thunk<&EffectBlasterDeflectionIncrease>);
+    insert(470, "EffectBlasterDeflectionDecrease", R_EFFECT, {R_INT}, &thunk<&EffectBlasterDeflectionDecrease>);
+    insert(471, "EffectHorrified", R_EFFECT, {}, &thunk<&EffectHorrified>);
+    insert(472, "EffectSpellLevelAbsorption", R_EFFECT, {R_INT, R_INT, R_INT}, &thunk<&EffectSpellLevelAbsorption>);
+    insert(473, "EffectDispelMagicBest", R_EFFECT, {R_INT}, &thunk<&EffectDispelMagicBest>);
+    insert(477, "EffectMissChance", R_EFFECT, {R_INT}, &thunk<&EffectMissChance>);
+    insert(485, "EffectModifyAttacks", R_EFFECT, {R_INT}, &thunk<&EffectModifyAttacks>);
+    insert(487, "EffectDamageShield", R_EFFECT, {R_INT, R_INT, R_INT}, &thunk<&EffectDamageShield>);
+    insert(675, "EffectForceDrain", R_EFFECT, {R_INT}, &thunk<&EffectForceDrain>);
+    insert(676, "EffectPsychicStatic", R_EFFECT, {}, &thunk<&EffectPsychicStatic>);
+    insert(702, "EffectLightsaberThrow", R_EFFECT, {R_OBJECT, R_OBJECT, R_OBJECT, R_INT}, &thunk<&EffectLightsaberThrow>);
+    insert(703, "EffectWhirlWind", R_EFFECT, {}, &thunk<&EffectWhirlWind>);
+    insert(754, "EffectCutSceneHorrified", R_EFFECT, {}, &thunk<&EffectCutSceneHorrified>);
+    insert(755, "EffectCutSceneParalyze", R_EFFECT, {}, &thunk<&EffectCutSceneParalyze>);
+    insert(756, "EffectCutSceneStunned", R_EFFECT, {}, &thunk<&EffectCutSceneStunned>);
 }
 
 void Routines::registerEffectTslRoutines() {
-    insert(51, "EffectAssuredHit", R_EFFECT, {}, &EffectAssuredHit);
-    insert(78, "EffectHeal", R_EFFECT, {R_INT}, &EffectHeal);
-    insert(79, "EffectDamage", R_EFFECT, {R_INT, R_INT, R_INT}, &EffectDamage);
-    insert(80, "EffectAbilityIncrease", R_EFFECT, {R_INT, R_INT}, &EffectAbilityIncrease);
-    insert(81, "EffectDamageResistance", R_EFFECT, {R_INT, R_INT, R_INT}, &EffectDamageResistance);
-    insert(82, "EffectResurrection", R_EFFECT, {R_INT}, &EffectResurrection);
-    insert(115, "EffectACIncrease", R_EFFECT, {R_INT, R_INT, R_INT}, &EffectACIncrease);
-    insert(117, "EffectSavingThrowIncrease", R_EFFECT, {R_INT, R_INT, R_INT}, &EffectSavingThrowIncrease);
-    insert(118, "EffectAttackIncrease", R_EFFECT, {R_INT, R_INT}, &EffectAttackIncrease);
-    insert(119, "EffectDamageReduction", R_EFFECT, {R_INT, R_INT, R_INT}, &EffectDamageReduction);
-    insert(120, "EffectDamageIncrease", R_EFFECT, {R_INT, R_INT}, &EffectDamageIncrease);
-    insert(130, "EffectEntangle", R_EFFECT, {}, &EffectEntangle);
-    insert(133, "EffectDeath", R_EFFECT, {R_INT, R_INT, R_INT}, &EffectDeath);
-    insert(134, "EffectKnockdown", R_EFFECT, {}, &EffectKnockdown);
-    insert(148, "EffectParalyze", R_EFFECT, {}, &EffectParalyze);
-    insert(149, "EffectSpellImmunity", R_EFFECT, {R_INT}, &EffectSpellImmunity);
-    insert(153, "EffectForceJump", R_EFFECT, {R_OBJECT, R_INT}, &EffectForceJump);
-    insert(154, "EffectSleep", R_EFFECT, {}, &EffectSleep);
-    insert(156, "EffectTemporaryForcePoints", R_EFFECT, {R_INT}, &EffectTemporaryForcePoints);
-    insert(157, "EffectConfused", R_EFFECT, {}, &EffectConfused);
-    insert(158, "EffectFrightened", R_EFFECT, {}, &EffectFrightened);
-    insert(159, "EffectChoke", R_EFFECT, {}, &EffectChoke);
-    insert(161, "EffectStunned", R_EFFECT, {}, &EffectStunned);
-    insert(164, "EffectRegenerate", R_EFFECT, {R_INT, R_FLOAT}, &EffectRegenerate);
-    insert(165, "EffectMovementSpeedIncrease", R_EFFECT, {R_INT}, &EffectMovementSpeedIncrease);
-    insert(171, "EffectAreaOfEffect", R_EFFECT, {R_INT, R_STRING, R_STRING, R_STRING}, &EffectAreaOfEffect);
-    insert(180, "EffectVisualEffect", R_EFFECT, {R_INT, R_INT}, &EffectVisualEffect);
-    insert(199, "EffectLinkEffects", R_EFFECT, {R_EFFECT, R_EFFECT}, &EffectLinkEffects);
-    insert(207, "EffectBeam", R_EFFECT, {R_INT, R_OBJECT, R_INT, R_INT}, &EffectBeam);
-    insert(212, "EffectForceResistanceIncrease", R_EFFECT, {R_INT}, &EffectForceResistanceIncrease);
-    insert(224, "EffectBodyFuel", R_EFFECT, {}, &EffectBodyFuel);
-    insert(250, "EffectPoison", R_EFFECT, {R_INT}, &EffectPoison);
-    insert(252, "EffectAssuredDeflection", R_EFFECT, {R_INT}, &EffectAssuredDeflection);
-    insert(269, "EffectForcePushTargeted", R_EFFECT, {R_LOCATION, R_INT}, &EffectForcePushTargeted);
-    insert(270, "EffectHaste", R_EFFECT, {}, &EffectHaste);
-    insert(273, "EffectImmunity", R_EFFECT, {R_INT}, &EffectImmunity);
-    insert(275, "EffectDamageImmunityIncrease", R_EFFECT, {R_INT, R_INT}, &EffectDamageImmunityIncrease);
-    insert(314, "EffectTemporaryHitpoints", R_EFFECT, {R_INT}, &EffectTemporaryHitpoints);
-    insert(351, "EffectSkillIncrease", R_EFFECT, {R_INT, R_INT}, &EffectSkillIncrease);
-    insert(372, "EffectDamageForcePoints", R_EFFECT, {R_INT}, &EffectDamageForcePoints);
-    insert(373, "EffectHealForcePoints", R_EFFECT, {R_INT}, &EffectHealForcePoints);
-    insert(387, "EffectHitPointChangeWhenDying", R_EFFECT, {R_FLOAT}, &EffectHitPointChangeWhenDying);
-    insert(391, "EffectDroidStun", R_EFFECT, {}, &EffectDroidStun);
-    insert(392, "EffectForcePushed", R_EFFECT, {}, &EffectForcePushed);
-    insert(402, "EffectForceResisted", R_EFFECT, {R_OBJECT}, &EffectForceResisted);
-    insert(420, "EffectForceFizzle", R_EFFECT, {}, &EffectForceFizzle);
-    insert(446, "EffectAbilityDecrease", R_EFFECT, {R_INT, R_INT}, &EffectAbilityDecrease);
-    insert(447, "EffectAttackDecrease", R_EFFECT, {R_INT, R_INT}, &EffectAttackDecrease);
-    insert(448, "EffectDamageDecrease", R_EFFECT, {R_INT, R_INT}, &EffectDamageDecrease);
-    insert(449, "EffectDamageImmunityDecrease", R_EFFECT, {R_INT, R_INT}, &EffectDamageImmunityDecrease);
-    insert(450, "EffectACDecrease", R_EFFECT, {R_INT, R_INT, R_INT}, &EffectACDecrease);
-    insert(451, "EffectMovementSpeedDecrease", R_EFFECT, {R_INT}, &EffectMovementSpeedDecrease);
-    insert(452, "EffectSavingThrowDecrease", R_EFFECT, {R_INT, R_INT, R_INT}, &EffectSavingThrowDecrease);
-    insert(453, "EffectSkillDecrease", R_EFFECT, {R_INT, R_INT}, &EffectSkillDecrease);
-    insert(454, "EffectForceResistanceDecrease", R_EFFECT, {R_INT}, &EffectForceResistanceDecrease);
-    insert(457, "EffectInvisibility", R_EFFECT, {R_INT}, &EffectInvisibility);
-    insert(458, "EffectConcealment", R_EFFECT, {R_INT}, &EffectConcealment);
-    insert(459, "EffectForceShield", R_EFFECT, {R_INT}, &EffectForceShield);
-    insert(460, "EffectDispelMagicAll", R_EFFECT, {R_INT}, &EffectDispelMagicAll);
-    insert(463, "EffectDisguise", R_EFFECT, {R_INT}, &EffectDisguise);
-    insert(465, "EffectTrueSeeing", R_EFFECT, {}, &EffectTrueSeeing);
-    insert(466, "EffectSeeInvisible", R_EFFECT, {}, &EffectSeeInvisible);
-    insert(467, "EffectTimeStop", R_EFFECT, {}, &EffectTimeStop);
-    insert(469, "EffectBlasterDeflectionIncrease", R_EFFECT, {R_INT}, &EffectBlasterDeflectionIncrease);
-    insert(470, "EffectBlasterDeflectionDecrease", R_EFFECT, {R_INT}, &EffectBlasterDeflectionDecrease);
-    insert(471, "EffectHorrified", R_EFFECT, {}, &EffectHorrified);
-    insert(472, "EffectSpellLevelAbsorption", R_EFFECT, {R_INT, R_INT, R_INT}, &EffectSpellLevelAbsorption);
-    insert(473, "EffectDispelMagicBest", R_EFFECT, {R_INT}, &EffectDispelMagicBest);
-    insert(477, "EffectMissChance", R_EFFECT, {R_INT}, &EffectMissChance);
-    insert(485, "EffectModifyAttacks", R_EFFECT, {R_INT}, &EffectModifyAttacks);
-    insert(487, "EffectDamageShield", R_EFFECT, {R_INT, R_INT, R_INT}, &EffectDamageShield);
-    insert(675, "EffectForceDrain", R_EFFECT, {R_INT}, &EffectForceDrain);
-    insert(676, "EffectPsychicStatic", R_EFFECT, {}, &EffectPsychicStatic);
-    insert(702, "EffectLightsaberThrow", R_EFFECT, {R_OBJECT, R_OBJECT, R_OBJECT, R_INT}, &EffectLightsaberThrow);
-    insert(703, "EffectWhirlWind", R_EFFECT, {}, &EffectWhirlWind);
-    insert(754, "EffectCutSceneHorrified", R_EFFECT, {}, &EffectCutSceneHorrified);
-    insert(755, "EffectCutSceneParalyze", R_EFFECT, {}, &EffectCutSceneParalyze);
-    insert(756, "EffectCutSceneStunned", R_EFFECT, {}, &EffectCutSceneStunned);
-    insert(770, "EffectForceBody", R_EFFECT, {R_INT}, &EffectForceBody);
-    insert(777, "EffectFury", R_EFFECT, {}, &EffectFury);
-    insert(778, "EffectBlind", R_EFFECT, {}, &EffectBlind);
-    insert(779, "EffectFPRegenModifier", R_EFFECT, {R_INT}, &EffectFPRegenModifier);
-    insert(780, "EffectVPRegenModifier", R_EFFECT, {R_INT}, &EffectVPRegenModifier);
-    insert(781, "EffectCrush", R_EFFECT, {}, &EffectCrush);
-    insert(809, "EffectDroidConfused", R_EFFECT, {}, &EffectDroidConfused);
-    insert(823, "EffectForceSight", R_EFFECT, {}, &EffectForceSight);
-    insert(848, "EffectMindTrick", R_EFFECT, {}, &EffectMindTrick);
-    insert(849, "EffectFactionModifier", R_EFFECT, {R_INT}, &EffectFactionModifier);
-    insert(852, "EffectDroidScramble", R_EFFECT, {}, &EffectDroidScramble);
+    insert(51, "EffectAssuredHit", R_EFFECT, {}, &thunk<&EffectAssuredHit>);
+    insert(78, "EffectHeal", R_EFFECT, {R_INT}, &thunk<&EffectHeal>);
+    insert(79, "EffectDamage", R_EFFECT, {R_INT, R_INT, R_INT}, &thunk<&EffectDamage>);
+    insert(80, "EffectAbilityIncrease", R_EFFECT, {R_INT, R_INT}, &thunk<&EffectAbilityIncrease>);
+    insert(81, "EffectDamageResistance", R_EFFECT, {R_INT, R_INT, R_INT}, &thunk<&EffectDamageResistance>);
+    insert(82, "EffectResurrection", R_EFFECT, {R_INT}, &thunk<&EffectResurrection>);
+    insert(115, "EffectACIncrease", R_EFFECT, {R_INT, R_INT, R_INT}, &thunk<&EffectACIncrease>);
+    insert(117, "EffectSavingThrowIncrease", R_EFFECT, {R_INT, R_INT, R_INT}, &thunk<&EffectSavingThrowIncrease>);
+    insert(118, "EffectAttackIncrease", R_EFFECT, {R_INT, R_INT}, &thunk<&EffectAttackIncrease>);
+    insert(119, "EffectDamageReduction", R_EFFECT, {R_INT, R_INT, R_INT}, &thunk<&EffectDamageReduction>);
+    insert(120, "EffectDamageIncrease", R_EFFECT, {R_INT, R_INT}, &thunk<&EffectDamageIncrease>);
+    insert(130, "EffectEntangle", R_EFFECT, {}, &thunk<&EffectEntangle>);
+    insert(133, "EffectDeath", R_EFFECT, {R_INT, R_INT, R_INT}, &thunk<&EffectDeath>);
+    insert(134, "EffectKnockdown", R_EFFECT, {}, &thunk<&EffectKnockdown>);
+    insert(148, "EffectParalyze", R_EFFECT, {}, &thunk<&EffectParalyze>);
+    insert(149, "EffectSpellImmunity", R_EFFECT, {R_INT}, &thunk<&EffectSpellImmunity>);
+    insert(153, "EffectForceJump", R_EFFECT, {R_OBJECT, R_INT}, &thunk<&EffectForceJump>);
+    insert(154, "EffectSleep", R_EFFECT, {}, &thunk<&EffectSleep>);
+    insert(156, "EffectTemporaryForcePoints", R_EFFECT, {R_INT}, &thunk<&EffectTemporaryForcePoints>);
+    insert(157, "EffectConfused", R_EFFECT, {}, &thunk<&EffectConfused>);
+    insert(158, "EffectFrightened", R_EFFECT, {}, &thunk<&EffectFrightened>);
+    insert(159, "EffectChoke", R_EFFECT, {}, &thunk<&EffectChoke>);
+    insert(161, "EffectStunned", R_EFFECT, {}, &thunk<&EffectStunned>);
+    insert(164, "EffectRegenerate", R_EFFECT, {R_INT, R_FLOAT}, &thunk<&EffectRegenerate>);
+    insert(165, "EffectMovementSpeedIncrease", R_EFFECT, {R_INT}, &thunk<&EffectMovementSpeedIncrease>);
+    insert(171, "EffectAreaOfEffect", R_EFFECT, {R_INT, R_STRING, R_STRING, R_STRING}, &thunk<&EffectAreaOfEffect>);
+    insert(180, "EffectVisualEffect", R_EFFECT, {R_INT, R_INT}, &thunk<&EffectVisualEffect>);
+    insert(199, "EffectLinkEffects", R_EFFECT, {R_EFFECT, R_EFFECT}, &thunk<&EffectLinkEffects>);
+    insert(207, "EffectBeam", R_EFFECT, {R_INT, R_OBJECT, R_INT, R_INT}, &thunk<&EffectBeam>);
+    insert(212, "EffectForceResistanceIncrease", R_EFFECT, {R_INT}, &thunk<&EffectForceResistanceIncrease>);
+    insert(224, "EffectBodyFuel", R_EFFECT, {}, &thunk<&EffectBodyFuel>);
+    insert(250, "EffectPoison", R_EFFECT, {R_INT}, &thunk<&EffectPoison>);
+    insert(252, "EffectAssuredDeflection", R_EFFECT, {R_INT}, &thunk<&EffectAssuredDeflection>);
+    insert(269, "EffectForcePushTargeted", R_EFFECT, {R_LOCATION, R_INT}, &thunk<&EffectForcePushTargeted>);
+    insert(270, "EffectHaste", R_EFFECT, {}, &thunk<&EffectHaste>);
+    insert(273, "EffectImmunity", R_EFFECT, {R_INT}, &thunk<&EffectImmunity>);
+    insert(275, "EffectDamageImmunityIncrease", R_EFFECT, {R_INT, R_INT}, &thunk<&EffectDamageImmunityIncrease>);
+    insert(314, "EffectTemporaryHitpoints", R_EFFECT, {R_INT}, &thunk<&EffectTemporaryHitpoints>);
+    insert(351, "EffectSkillIncrease", R_EFFECT, {R_INT, R_INT}, &thunk<&EffectSkillIncrease>);
+    insert(372, "EffectDamageForcePoints", R_EFFECT, {R_INT}, &thunk<&EffectDamageForcePoints>);
+    insert(373, "EffectHealForcePoints", R_EFFECT, {R_INT}, &thunk<&EffectHealForcePoints>);
+    insert(387, "EffectHitPointChangeWhenDying", R_EFFECT, {R_FLOAT}, &thunk<&EffectHitPointChangeWhenDying>);
+    insert(391, "EffectDroidStun", R_EFFECT, {}, &thunk<&EffectDroidStun>);
+    insert(392, "EffectForcePushed", R_EFFECT, {}, &thunk<&EffectForcePushed>);
+    insert(402, "EffectForceResisted", R_EFFECT, {R_OBJECT}, &thunk<&EffectForceResisted>);
+    insert(420, "EffectForceFizzle", R_EFFECT, {}, &thunk<&EffectForceFizzle>);
+    insert(446, "EffectAbilityDecrease", R_EFFECT, {R_INT, R_INT}, &thunk<&EffectAbilityDecrease>);
+    insert(447, "EffectAttackDecrease", R_EFFECT, {R_INT, R_INT}, &thunk<&EffectAttackDecrease>);
+    insert(448, "EffectDamageDecrease", R_EFFECT, {R_INT, R_INT}, &thunk<&EffectDamageDecrease>);
+    insert(449, "EffectDamageImmunityDecrease", R_EFFECT, {R_INT, R_INT}, &thunk<&EffectDamageImmunityDecrease>);
+    insert(450, "EffectACDecrease", R_EFFECT, {R_INT, R_INT, R_INT}, &thunk<&EffectACDecrease>);
+    insert(451, "EffectMovementSpeedDecrease", R_EFFECT, {R_INT}, &thunk<&EffectMovementSpeedDecrease>);
+    insert(452, "EffectSavingThrowDecrease", R_EFFECT, {R_INT, R_INT, R_INT}, &thunk<&EffectSavingThrowDecrease>);
+    insert(453, "EffectSkillDecrease", R_EFFECT, {R_INT, R_INT}, &thunk<&EffectSkillDecrease>);
+    insert(454, "EffectForceResistanceDecrease", R_EFFECT, {R_INT}, &thunk<&EffectForceResistanceDecrease>);
+    insert(457, "EffectInvisibility", R_EFFECT, {R_INT}, &thunk<&EffectInvisibility>);
+    insert(458, "EffectConcealment", R_EFFECT, {R_INT}, &thunk<&EffectConcealment>);
+    insert(459, "EffectForceShield", R_EFFECT, {R_INT}, &thunk<&EffectForceShield>);
+    insert(460, "EffectDispelMagicAll", R_EFFECT, {R_INT}, &thunk<&EffectDispelMagicAll>);
+    insert(463, "EffectDisguise", R_EFFECT, {R_INT}, &thunk<&EffectDisguise>);
+    insert(465, "EffectTrueSeeing", R_EFFECT, {}, &thunk<&EffectTrueSeeing>);
+    insert(466, "EffectSeeInvisible", R_EFFECT, {}, &thunk<&EffectSeeInvisible>);
+    insert(467, "EffectTimeStop", R_EFFECT, {}, &thunk<&EffectTimeStop>);
+    insert(469, "EffectBlasterDeflectionIncrease", R_EFFECT, {R_INT}, &thunk<&EffectBlasterDeflectionIncrease>);
+    insert(470, "EffectBlasterDeflectionDecrease", R_EFFECT, {R_INT}, &thunk<&EffectBlasterDeflectionDecrease>);
+    insert(471, "EffectHorrified", R_EFFECT, {}, &thunk<&EffectHorrified>);
+    insert(472, "EffectSpellLevelAbsorption", R_EFFECT, {R_INT, R_INT, R_INT}, &thunk<&EffectSpellLevelAbsorption>);
+    insert(473, "EffectDispelMagicBest", R_EFFECT, {R_INT}, &thunk<&EffectDispelMagicBest>);
+    insert(477, "EffectMissChance", R_EFFECT, {R_INT}, &thunk<&EffectMissChance>);
+    insert(485, "EffectModifyAttacks", R_EFFECT, {R_INT}, &thunk<&EffectModifyAttacks>);
+    insert(487, "EffectDamageShield", R_EFFECT, {R_INT, R_INT, R_INT}, &thunk<&EffectDamageShield>);
+    insert(675, "EffectForceDrain", R_EFFECT, {R_INT}, &thunk<&EffectForceDrain>);
+    insert(676, "EffectPsychicStatic", R_EFFECT, {}, &thunk<&EffectPsychicStatic>);
+    insert(702, "EffectLightsaberThrow", R_EFFECT, {R_OBJECT, R_OBJECT, R_OBJECT, R_INT}, &thunk<&EffectLightsaberThrow>);
+    insert(703, "EffectWhirlWind", R_EFFECT, {}, &thunk<&EffectWhirlWind>);
+    insert(754, "EffectCutSceneHorrified", R_EFFECT, {}, &thunk<&EffectCutSceneHorrified>);
+    insert(755, "EffectCutSceneParalyze", R_EFFECT, {}, &thunk<&EffectCutSceneParalyze>);
+    insert(756, "EffectCutSceneStunned", R_EFFECT, {}, &thunk<&EffectCutSceneStunned>);
+    insert(770, "EffectForceBody", R_EFFECT, {R_INT}, &thunk<&EffectForceBody>);
+    insert(777, "EffectFury", R_EFFECT, {}, &thunk<&EffectFury>);
+    insert(778, "EffectBlind", R_EFFECT, {}, &thunk<&EffectBlind>);
+    insert(779, "EffectFPRegenModifier", R_EFFECT, {R_INT}, &thunk<&EffectFPRegenModifier>);
+    insert(780, "EffectVPRegenModifier", R_EFFECT, {R_INT}, &thunk<&EffectVPRegenModifier>);
+    insert(781, "EffectCrush", R_EFFECT, {}, &thunk<&EffectCrush>);
+    insert(809, "EffectDroidConfused", R_EFFECT, {}, &thunk<&EffectDroidConfused>);
+    insert(823, "EffectForceSight", R_EFFECT, {}, &thunk<&EffectForceSight>);
+    insert(848, "EffectMindTrick", R_EFFECT, {}, &thunk<&EffectMindTrick>);
+    insert(849, "EffectFactionModifier", R_EFFECT, {R_INT}, &thunk<&EffectFactionModifier>);
+    insert(852, "EffectDroidScramble", R_EFFECT, {}, &thunk<&EffectDroidScramble>);
 }
 
 } // namespace game
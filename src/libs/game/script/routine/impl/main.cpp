@@ -59,7 +59,7 @@ namespace reone {
 
 namespace game {
 
-static Variable Random(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable Random(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nMaxInteger = getInt(args, 0);
 
@@ -69,7 +69,7 @@ static Variable Random(const std::vector<Variable> &args, const RoutineContext &
     return Variable::ofInt(randomInt(0, nMaxInteger - 1));
 }
 
-static Variable PrintString(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable PrintString(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sString = getString(args, 0);
 
@@ -80,7 +80,7 @@ static Variable PrintString(const std::vector<Variable> &args, const RoutineCont
     return Variable::ofNull();
 }
 
-static Variable PrintFloat(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable PrintFloat(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto fFloat = getFloat(args, 0);
     auto nWidth = getIntOrElse(args, 1, 18);
@@ -92,7 +92,7 @@ static Variable PrintFloat(const std::vector<Variable> &args, const RoutineConte
     throw RoutineNotImplementedException("PrintFloat");
 }
 
-static Variable FloatToString(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable FloatToString(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto fFloat = getFloat(args, 0);
     auto nWidth = getIntOrElse(args, 1, 18);
@@ -104,7 +104,7 @@ static Variable FloatToString(const std::vector<Variable> &args, const RoutineCo
     return Variable::ofString(std::to_string(fFloat));
 }
 
-static Variable PrintInteger(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable PrintInteger(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nInteger = getInt(args, 0);
 
@@ -114,7 +114,7 @@ static Variable PrintInteger(const std::vector<Variable> &args, const RoutineCon
     throw RoutineNotImplementedException("PrintInteger");
 }
 
-static Variable PrintObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable PrintObject(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -124,7 +124,7 @@ static Variable PrintObject(const std::vector<Variable> &args, const RoutineCont
     throw RoutineNotImplementedException("PrintObject");
 }
 
-static Variable AssignCommand(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AssignCommand(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oActionSubject = getObject(args, 0, ctx);
     auto aActionToAssign = getAction(args, 1);
@@ -137,7 +137,7 @@ static Variable AssignCommand(const std::vector<Variable> &args, const RoutineCo
     return Variable::ofNull();
 }
 
-static Variable DelayCommand(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable DelayCommand(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto fSeconds = getFloat(args, 0);
     auto aActionToDelay = getAction(args, 1);
@@ -150,7 +150,7 @@ static Variable DelayCommand(const std::vector<Variable> &args, const RoutineCon
     return Variable::ofNull();
 }
 
-static Variable ExecuteScript(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ExecuteScript(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sScript = getString(args, 0);
     auto oTarget = getObject(args, 1, ctx);
@@ -163,13 +163,13 @@ static Variable ExecuteScript(const std::vector<Variable> &args, const RoutineCo
     return Variable::ofNull();
 }
 
-static Variable ClearAllActions(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ClearAllActions(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     getCaller(ctx)->clearAllActions();
     return Variable::ofNull();
 }
 
-static Variable SetFacing(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetFacing(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto fDirection = getFloat(args, 0);
 
@@ -181,7 +181,7 @@ static Variable SetFacing(const std::vector<Variable> &args, const RoutineContex
     return Variable::ofNull();
 }
 
-static Variable SwitchPlayerCharacter(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SwitchPlayerCharacter(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
 
@@ -191,7 +191,7 @@ static Variable SwitchPlayerCharacter(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("SwitchPlayerCharacter");
 }
 
-static Variable SetTime(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetTime(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nHour = getInt(args, 0);
     auto nMinute = getInt(args, 1);
@@ -204,7 +204,7 @@ static Variable SetTime(const std::vector<Variable> &args, const RoutineContext
     throw RoutineNotImplementedException("SetTime");
 }
 
-static Variable SetPartyLeader(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetPartyLeader(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
 
@@ -215,7 +215,7 @@ static Variable SetPartyLeader(const std::vector<Variable> &args, const RoutineC
     return Variable::ofNull();
 }
 
-static Variable SetAreaUnescapable(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetAreaUnescapable(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto bUnescapable = getInt(args, 0);
 
@@ -227,33 +227,33 @@ static Variable SetAreaUnescapable(const std::vector<Variable> &args, const Rout
     return Variable::ofNull();
 }
 
-static Variable GetAreaUnescapable(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetAreaUnescapable(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     bool unescapable = ctx.game.module()->area()->isUnescapable();
     return Variable::ofInt(static_cast<int>(unescapable));
 }
 
-static Variable GetTimeHour(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetTimeHour(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetTimeHour");
 }
 
-static Variable GetTimeMinute(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetTimeMinute(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetTimeMinute");
 }
 
-static Variable GetTimeSecond(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetTimeSecond(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetTimeSecond");
 }
 
-static Variable GetTimeMillisecond(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetTimeMillisecond(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetTimeMillisecond");
 }
 
-static Variable GetArea(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetArea(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
 
@@ -264,19 +264,19 @@ static Variable GetArea(const std::vector<Variable> &args, const RoutineContext
     return Variable::ofObject(getObjectIdOrInvalid(area));
 }
 
-static Variable GetEnteringObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetEnteringObject(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto triggerrer = getTriggerrer(ctx);
     return Variable::ofObject(getObjectIdOrInvalid(triggerrer));
 }
 
-static Variable GetExitingObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetExitingObject(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto triggerrer = getTriggerrer(ctx);
     return Variable::ofObject(getObjectIdOrInvalid(triggerrer));
 }
 
-static Variable GetPosition(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetPosition(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
 
@@ -286,7 +286,7 @@ static Variable GetPosition(const std::vector<Variable> &args, const RoutineCont
     return Variable::ofVector(oTarget->position());
 }
 
-static Variable GetFacing(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFacing(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
 
@@ -297,7 +297,7 @@ static Variable GetFacing(const std::vector<Variable> &args, const RoutineContex
     return Variable::ofFloat(facing);
 }
 
-static Variable GetItemPossessor(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetItemPossessor(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
 
@@ -307,7 +307,7 @@ static Variable GetItemPossessor(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("GetItemPossessor");
 }
 
-static Variable GetItemPossessedBy(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetItemPossessedBy(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto sItemTag = getString(args, 1);
@@ -324,7 +324,7 @@ static Variable GetItemPossessedBy(const std::vector<Variable> &args, const Rout
     return Variable::ofObject(getObjectIdOrInvalid(item));
 }
 
-static Variable CreateItemOnObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable CreateItemOnObject(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sItemTemplate = getString(args, 0);
     auto oTarget = getObjectOrCaller(args, 1, ctx);
@@ -342,7 +342,7 @@ static Variable CreateItemOnObject(const std::vector<Variable> &args, const Rout
     return Variable::ofObject(getObjectIdOrInvalid(item));
 }
 
-static Variable GetLastAttacker(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastAttacker(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oAttackee = getObjectOrCaller(args, 0, ctx);
 
@@ -352,7 +352,7 @@ static Variable GetLastAttacker(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("GetLastAttacker");
 }
 
-static Variable GetNearestCreature(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetNearestCreature(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nFirstCriteriaType = getInt(args, 0);
     auto nFirstCriteriaValue = getInt(args, 1);
@@ -381,7 +381,7 @@ static Variable GetNearestCreature(const std::vector<Variable> &args, const Rout
     return Variable::ofObject(getObjectIdOrInvalid(creature));
 }
 
-static Variable GetDistanceToObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetDistanceToObject(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -392,7 +392,7 @@ static Variable GetDistanceToObject(const std::vector<Variable> &args, const Rou
     return Variable::ofFloat(caller->getDistanceTo(*oObject));
 }
 
-static Variable GetIsObjectValid(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsObjectValid(const VariableSpan &args, const RoutineContext &ctx) {
     bool valid;
     try {
         auto oObject = getObject(args, 0, ctx);
@@ -403,7 +403,7 @@ static Variable GetIsObjectValid(const std::vector<Variable> &args, const Routin
     return Variable::ofInt(static_cast<bool>(valid));
 }
 
-static Variable SetCameraFacing(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetCameraFacing(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto fDirection = getFloat(args, 0);
 
@@ -413,7 +413,7 @@ static Variable SetCameraFacing(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("SetCameraFacing");
 }
 
-static Variable PlaySound(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable PlaySound(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sSoundName = getString(args, 0);
 
@@ -423,12 +423,12 @@ static Variable PlaySound(const std::vector<Variable> &args, const RoutineContex
     throw RoutineNotImplementedException("PlaySound");
 }
 
-static Variable GetSpellTargetObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetSpellTargetObject(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetSpellTargetObject");
 }
 
-static Variable GetCurrentHitPoints(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetCurrentHitPoints(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObjectOrCaller(args, 0, ctx);
 
@@ -439,7 +439,7 @@ static Variable GetCurrentHitPoints(const std::vector<Variable> &args, const Rou
     return Variable::ofInt(hitPoints);
 }
 
-static Variable GetMaxHitPoints(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetMaxHitPoints(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObjectOrCaller(args, 0, ctx);
 
@@ -450,17 +450,17 @@ static Variable GetMaxHitPoints(const std::vector<Variable> &args, const Routine
     return Variable::ofInt(hitPoints);
 }
 
-static Variable GetLastItemEquipped(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastItemEquipped(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLastItemEquipped");
 }
 
-static Variable GetSubScreenID(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetSubScreenID(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetSubScreenID");
 }
 
-static Variable CancelCombat(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable CancelCombat(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oidCreature = getObject(args, 0, ctx);
 
@@ -470,7 +470,7 @@ static Variable CancelCombat(const std::vector<Variable> &args, const RoutineCon
     throw RoutineNotImplementedException("CancelCombat");
 }
 
-static Variable GetCurrentForcePoints(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetCurrentForcePoints(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObjectOrCaller(args, 0, ctx);
 
@@ -480,7 +480,7 @@ static Variable GetCurrentForcePoints(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("GetCurrentForcePoints");
 }
 
-static Variable GetMaxForcePoints(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetMaxForcePoints(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObjectOrCaller(args, 0, ctx);
 
@@ -490,7 +490,7 @@ static Variable GetMaxForcePoints(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("GetMaxForcePoints");
 }
 
-static Variable PauseGame(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable PauseGame(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto bPause = getInt(args, 0);
 
@@ -500,7 +500,7 @@ static Variable PauseGame(const std::vector<Variable> &args, const RoutineContex
     throw RoutineNotImplementedException("PauseGame");
 }
 
-static Variable SetPlayerRestrictMode(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetPlayerRestrictMode(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto bRestrict = getInt(args, 0);
 
@@ -512,7 +512,7 @@ static Variable SetPlayerRestrictMode(const std::vector<Variable> &args, const R
     return Variable::ofNull();
 }
 
-static Variable GetStringLength(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetStringLength(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sString = getString(args, 0);
 
@@ -522,7 +522,7 @@ static Variable GetStringLength(const std::vector<Variable> &args, const Routine
     return Variable::ofInt(static_cast<int>(sString.length()));
 }
 
-static Variable GetStringUpperCase(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetStringUpperCase(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sString = getString(args, 0);
 
@@ -532,7 +532,7 @@ static Variable GetStringUpperCase(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("GetStringUpperCase");
 }
 
-static Variable GetStringLowerCase(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetStringLowerCase(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sString = getString(args, 0);
 
@@ -542,7 +542,7 @@ static Variable GetStringLowerCase(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("GetStringLowerCase");
 }
 
-static Variable GetStringRight(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetStringRight(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sString = getString(args, 0);
     auto nCount = getInt(args, 1);
@@ -557,7 +557,7 @@ static Variable GetStringRight(const std::vector<Variable> &args, const RoutineC
     return Variable::ofString(std::move(right));
 }
 
-static Variable GetStringLeft(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetStringLeft(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sString = getString(args, 0);
     auto nCount = getInt(args, 1);
@@ -572,7 +572,7 @@ static Variable GetStringLeft(const std::vector<Variable> &args, const RoutineCo
     return Variable::ofString(std::move(left));
 }
 
-static Variable InsertString(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable InsertString(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sDestination = getString(args, 0);
     auto sString = getString(args, 1);
@@ -584,7 +584,7 @@ static Variable InsertString(const std::vector<Variable> &args, const RoutineCon
     throw RoutineNotImplementedException("InsertString");
 }
 
-static Variable GetSubString(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetSubString(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sString = getString(args, 0);
     auto nStart = getInt(args, 1);
@@ -596,7 +596,7 @@ static Variable GetSubString(const std::vector<Variable> &args, const RoutineCon
     return Variable::ofString(sString.substr(nStart, nStart));
 }
 
-static Variable FindSubString(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable FindSubString(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sString = getString(args, 0);
     auto sSubString = getString(args, 1);
@@ -608,7 +608,7 @@ static Variable FindSubString(const std::vector<Variable> &args, const RoutineCo
     return Variable::ofInt(pos != std::string::npos ? static_cast<int>(pos) : -1);
 }
 
-static Variable fabs(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable fabs(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto fValue = getFloat(args, 0);
 
@@ -618,7 +618,7 @@ static Variable fabs(const std::vector<Variable> &args, const RoutineContext &ct
     throw RoutineNotImplementedException("fabs");
 }
 
-static Variable cos(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable cos(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto fValue = getFloat(args, 0);
 
@@ -628,7 +628,7 @@ static Variable cos(const std::vector<Variable> &args, const RoutineContext &ctx
     throw RoutineNotImplementedException("cos");
 }
 
-static Variable sin(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable sin(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto fValue = getFloat(args, 0);
 
@@ -638,7 +638,7 @@ static Variable sin(const std::vector<Variable> &args, const RoutineContext &ctx
     throw RoutineNotImplementedException("sin");
 }
 
-static Variable tan(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable tan(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto fValue = getFloat(args, 0);
 
@@ -648,7 +648,7 @@ static Variable tan(const std::vector<Variable> &args, const RoutineContext &ctx
     throw RoutineNotImplementedException("tan");
 }
 
-static Variable acos(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable acos(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto fValue = getFloat(args, 0);
 
@@ -658,7 +658,7 @@ static Variable acos(const std::vector<Variable> &args, const RoutineContext &ct
     throw RoutineNotImplementedException("acos");
 }
 
-static Variable asin(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable asin(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto fValue = getFloat(args, 0);
 
@@ -668,7 +668,7 @@ static Variable asin(const std::vector<Variable> &args, const RoutineContext &ct
     throw RoutineNotImplementedException("asin");
 }
 
-static Variable atan(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable atan(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto fValue = getFloat(args, 0);
 
@@ -678,7 +678,7 @@ static Variable atan(const std::vector<Variable> &args, const RoutineContext &ct
     throw RoutineNotImplementedException("atan");
 }
 
-static Variable log(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable log(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto fValue = getFloat(args, 0);
 
@@ -688,7 +688,7 @@ static Variable log(const std::vector<Variable> &args, const RoutineContext &ctx
     throw RoutineNotImplementedException("log");
 }
 
-static Variable pow(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable pow(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto fValue = getFloat(args, 0);
     auto fExponent = getFloat(args, 1);
@@ -699,7 +699,7 @@ static Variable pow(const std::vector<Variable> &args, const RoutineContext &ctx
     throw RoutineNotImplementedException("pow");
 }
 
-static Variable sqrt(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable sqrt(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto fValue = getFloat(args, 0);
 
@@ -709,7 +709,7 @@ static Variable sqrt(const std::vector<Variable> &args, const RoutineContext &ct
     throw RoutineNotImplementedException("sqrt");
 }
 
-static Variable abs(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable abs(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nValue = getInt(args, 0);
 
@@ -719,7 +719,7 @@ static Variable abs(const std::vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofInt(std::abs(nValue));
 }
 
-static Variable GetPlayerRestrictMode(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetPlayerRestrictMode(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObjectOrCaller(args, 0, ctx);
 
@@ -730,7 +730,7 @@ static Variable GetPlayerRestrictMode(const std::vector<Variable> &args, const R
     return Variable::ofInt(static_cast<int>(restrict));
 }
 
-static Variable GetCasterLevel(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetCasterLevel(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -740,7 +740,7 @@ static Variable GetCasterLevel(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("GetCasterLevel");
 }
 
-static Variable GetFirstEffect(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFirstEffect(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -751,7 +751,7 @@ static Variable GetFirstEffect(const std::vector<Variable> &args, const RoutineC
     return Variable::ofEffect(creature->getFirstEffect());
 }
 
-static Variable GetNextEffect(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetNextEffect(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -762,7 +762,7 @@ static Variable GetNextEffect(const std::vector<Variable> &args, const RoutineCo
     return Variable::ofEffect(creature->getNextEffect());
 }
 
-static Variable RemoveEffect(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable RemoveEffect(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto eEffect = getEffect(args, 1);
@@ -773,7 +773,7 @@ static Variable RemoveEffect(const std::vector<Variable> &args, const RoutineCon
     throw RoutineNotImplementedException("RemoveEffect");
 }
 
-static Variable GetIsEffectValid(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsEffectValid(const VariableSpan &args, const RoutineContext &ctx) {
     bool valid;
     try {
         auto eEffect = getEffect(args, 0);
@@ -784,7 +784,7 @@ static Variable GetIsEffectValid(const std::vector<Variable> &args, const Routin
     return Variable::ofInt(static_cast<int>(valid));
 }
 
-static Variable GetEffectDurationType(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetEffectDurationType(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto eEffect = getEffect(args, 0);
 
@@ -794,7 +794,7 @@ static Variable GetEffectDurationType(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("GetEffectDurationType");
 }
 
-static Variable GetEffectSubType(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetEffectSubType(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto eEffect = getEffect(args, 0);
 
@@ -804,7 +804,7 @@ static Variable GetEffectSubType(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("GetEffectSubType");
 }
 
-static Variable GetEffectCreator(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetEffectCreator(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto eEffect = getEffect(args, 0);
 
@@ -814,7 +814,7 @@ static Variable GetEffectCreator(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("GetEffectCreator");
 }
 
-static Variable IntToString(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable IntToString(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nInteger = getInt(args, 0);
 
@@ -824,7 +824,7 @@ static Variable IntToString(const std::vector<Variable> &args, const RoutineCont
     return Variable::ofString(std::to_string(nInteger));
 }
 
-static Variable GetFirstObjectInArea(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFirstObjectInArea(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObjectOrNull(args, 0, ctx);
     auto nObjectFilter = getIntOrElse(args, 1, 1);
@@ -835,7 +835,7 @@ static Variable GetFirstObjectInArea(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("GetFirstObjectInArea");
 }
 
-static Variable GetNextObjectInArea(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetNextObjectInArea(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObjectOrNull(args, 0, ctx);
     auto nObjectFilter = getIntOrElse(args, 1, 1);
@@ -846,7 +846,7 @@ static Variable GetNextObjectInArea(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("GetNextObjectInArea");
 }
 
-static Variable d2(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable d2(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nNumDice = getIntOrElse(args, 0, 1);
 
@@ -861,7 +861,7 @@ static Variable d2(const std::vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofInt(total);
 }
 
-static Variable d3(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable d3(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nNumDice = getIntOrElse(args, 0, 1);
 
@@ -876,7 +876,7 @@ static Variable d3(const std::vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofInt(total);
 }
 
-static Variable d4(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable d4(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nNumDice = getIntOrElse(args, 0, 1);
 
@@ -891,7 +891,7 @@ static Variable d4(const std::vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofInt(total);
 }
 
-static Variable d6(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable d6(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nNumDice = getIntOrElse(args, 0, 1);
 
@@ -906,7 +906,7 @@ static Variable d6(const std::vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofInt(total);
 }
 
-static Variable d8(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable d8(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nNumDice = getIntOrElse(args, 0, 1);
 
@@ -921,7 +921,7 @@ static Variable d8(const std::vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofInt(total);
 }
 
-static Variable d10(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable d10(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nNumDice = getIntOrElse(args, 0, 1);
 
@@ -936,7 +936,7 @@ static Variable d10(const std::vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofInt(total);
 }
 
-static Variable d12(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable d12(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nNumDice = getIntOrElse(args, 0, 1);
 
@@ -951,7 +951,7 @@ static Variable d12(const std::vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofInt(total);
 }
 
-static Variable d20(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable d20(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nNumDice = getIntOrElse(args, 0, 1);
 
@@ -966,7 +966,7 @@ static Variable d20(const std::vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofInt(total);
 }
 
-static Variable d100(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable d100(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nNumDice = getIntOrElse(args, 0, 1);
 
@@ -981,7 +981,7 @@ static Variable d100(const std::vector<Variable> &args, const RoutineContext &ct
     return Variable::ofInt(total);
 }
 
-static Variable VectorMagnitude(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable VectorMagnitude(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto vVector = getVector(args, 0);
 
@@ -991,12 +991,12 @@ static Variable VectorMagnitude(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("VectorMagnitude");
 }
 
-static Variable GetMetaMagicFeat(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetMetaMagicFeat(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetMetaMagicFeat");
 }
 
-static Variable GetObjectType(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetObjectType(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
 
@@ -1006,7 +1006,7 @@ static Variable GetObjectType(const std::vector<Variable> &args, const RoutineCo
     return Variable::ofInt(static_cast<int>(oTarget->type()));
 }
 
-static Variable GetRacialType(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetRacialType(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -1017,7 +1017,7 @@ static Variable GetRacialType(const std::vector<Variable> &args, const RoutineCo
     return Variable::ofInt(static_cast<int>(creature->racialType()));
 }
 
-static Variable FortitudeSave(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable FortitudeSave(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto nDC = getInt(args, 1);
@@ -1030,7 +1030,7 @@ static Variable FortitudeSave(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("FortitudeSave");
 }
 
-static Variable ReflexSave(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ReflexSave(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto nDC = getInt(args, 1);
@@ -1043,7 +1043,7 @@ static Variable ReflexSave(const std::vector<Variable> &args, const RoutineConte
     throw RoutineNotImplementedException("ReflexSave");
 }
 
-static Variable WillSave(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable WillSave(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto nDC = getInt(args, 1);
@@ -1056,12 +1056,12 @@ static Variable WillSave(const std::vector<Variable> &args, const RoutineContext
     throw RoutineNotImplementedException("WillSave");
 }
 
-static Variable GetSpellSaveDC(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetSpellSaveDC(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetSpellSaveDC");
 }
 
-static Variable MagicalEffect(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable MagicalEffect(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto eEffect = getEffect(args, 0);
 
@@ -1071,7 +1071,7 @@ static Variable MagicalEffect(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("MagicalEffect");
 }
 
-static Variable SupernaturalEffect(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SupernaturalEffect(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto eEffect = getEffect(args, 0);
 
@@ -1081,7 +1081,7 @@ static Variable SupernaturalEffect(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("SupernaturalEffect");
 }
 
-static Variable ExtraordinaryEffect(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ExtraordinaryEffect(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto eEffect = getEffect(args, 0);
 
@@ -1091,7 +1091,7 @@ static Variable ExtraordinaryEffect(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("ExtraordinaryEffect");
 }
 
-static Variable GetAC(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetAC(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto nForFutureUse = getIntOrElse(args, 1, 0);
@@ -1102,7 +1102,7 @@ static Variable GetAC(const std::vector<Variable> &args, const RoutineContext &c
     throw RoutineNotImplementedException("GetAC");
 }
 
-static Variable RoundsToSeconds(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable RoundsToSeconds(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nRounds = getInt(args, 0);
 
@@ -1112,7 +1112,7 @@ static Variable RoundsToSeconds(const std::vector<Variable> &args, const Routine
     return Variable::ofFloat(nRounds / 6.0f);
 }
 
-static Variable HoursToSeconds(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable HoursToSeconds(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nHours = getInt(args, 0);
 
@@ -1122,7 +1122,7 @@ static Variable HoursToSeconds(const std::vector<Variable> &args, const RoutineC
     return Variable::ofInt(nHours * 3600);
 }
 
-static Variable TurnsToSeconds(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable TurnsToSeconds(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nTurns = getInt(args, 0);
 
@@ -1132,7 +1132,7 @@ static Variable TurnsToSeconds(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("TurnsToSeconds");
 }
 
-static Variable SoundObjectSetFixedVariance(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SoundObjectSetFixedVariance(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oSound = getObject(args, 0, ctx);
     auto fFixedVariance = getFloat(args, 1);
@@ -1143,7 +1143,7 @@ static Variable SoundObjectSetFixedVariance(const std::vector<Variable> &args, c
     throw RoutineNotImplementedException("SoundObjectSetFixedVariance");
 }
 
-static Variable GetGoodEvilValue(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetGoodEvilValue(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -1153,12 +1153,12 @@ static Variable GetGoodEvilValue(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("GetGoodEvilValue");
 }
 
-static Variable GetPartyMemberCount(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetPartyMemberCount(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     return Variable::ofInt(ctx.game.party().getSize());
 }
 
-static Variable GetAlignmentGoodEvil(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetAlignmentGoodEvil(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -1168,7 +1168,7 @@ static Variable GetAlignmentGoodEvil(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("GetAlignmentGoodEvil");
 }
 
-static Variable GetFirstObjectInShape(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFirstObjectInShape(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nShape = getInt(args, 0);
     auto fSize = getFloat(args, 1);
@@ -1183,7 +1183,7 @@ static Variable GetFirstObjectInShape(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("GetFirstObjectInShape");
 }
 
-static Variable GetNextObjectInShape(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetNextObjectInShape(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nShape = getInt(args, 0);
     auto fSize = getFloat(args, 1);
@@ -1198,7 +1198,7 @@ static Variable GetNextObjectInShape(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("GetNextObjectInShape");
 }
 
-static Variable SignalEvent(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SignalEvent(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto evToRun = getEvent(args, 1);
@@ -1211,7 +1211,7 @@ static Variable SignalEvent(const std::vector<Variable> &args, const RoutineCont
     return Variable::ofNull();
 }
 
-static Variable EventUserDefined(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EventUserDefined(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nUserDefinedEventNumber = getInt(args, 0);
 
@@ -1222,7 +1222,7 @@ static Variable EventUserDefined(const std::vector<Variable> &args, const Routin
     return Variable::ofEvent(std::move(event));
 }
 
-static Variable VectorNormalize(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable VectorNormalize(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto vVector = getVector(args, 0);
 
@@ -1232,7 +1232,7 @@ static Variable VectorNormalize(const std::vector<Variable> &args, const Routine
     return Variable::ofVector(glm::normalize(vVector));
 }
 
-static Variable GetItemStackSize(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetItemStackSize(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
 
@@ -1243,7 +1243,7 @@ static Variable GetItemStackSize(const std::vector<Variable> &args, const Routin
     return Variable::ofInt(item->stackSize());
 }
 
-static Variable GetAbilityScore(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetAbilityScore(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto nAbilityType = getInt(args, 1);
@@ -1256,7 +1256,7 @@ static Variable GetAbilityScore(const std::vector<Variable> &args, const Routine
     return Variable::ofInt(creature->attributes().getAbilityScore(ability));
 }
 
-static Variable GetIsDead(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsDead(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -1267,7 +1267,7 @@ static Variable GetIsDead(const std::vector<Variable> &args, const RoutineContex
     return Variable::ofInt(static_cast<int>(creature->isDead()));
 }
 
-static Variable PrintVector(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable PrintVector(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto vVector = getVector(args, 0);
     auto bPrepend = getInt(args, 1);
@@ -1278,7 +1278,7 @@ static Variable PrintVector(const std::vector<Variable> &args, const RoutineCont
     throw RoutineNotImplementedException("PrintVector");
 }
 
-static Variable Vector(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable Vector(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto x = getFloatOrElse(args, 0, 0.0f);
     auto y = getFloatOrElse(args, 1, 0.0f);
@@ -1290,7 +1290,7 @@ static Variable Vector(const std::vector<Variable> &args, const RoutineContext &
     return Variable::ofVector(glm::vec3(x, y, z));
 }
 
-static Variable SetFacingPoint(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetFacingPoint(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto vTarget = getVector(args, 0);
 
@@ -1302,7 +1302,7 @@ static Variable SetFacingPoint(const std::vector<Variable> &args, const RoutineC
     return Variable::ofNull();
 }
 
-static Variable AngleToVector(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AngleToVector(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto fAngle = getFloat(args, 0);
 
@@ -1313,7 +1313,7 @@ static Variable AngleToVector(const std::vector<Variable> &args, const RoutineCo
     return Variable::ofVector(std::move(vector));
 }
 
-static Variable VectorToAngle(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable VectorToAngle(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto vVector = getVector(args, 0);
 
@@ -1323,7 +1323,7 @@ static Variable VectorToAngle(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("VectorToAngle");
 }
 
-static Variable TouchAttackMelee(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable TouchAttackMelee(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
     auto bDisplayFeedback = getIntOrElse(args, 1, 1);
@@ -1334,7 +1334,7 @@ static Variable TouchAttackMelee(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("TouchAttackMelee");
 }
 
-static Variable TouchAttackRanged(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable TouchAttackRanged(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
     auto bDisplayFeedback = getIntOrElse(args, 1, 1);
@@ -1345,7 +1345,7 @@ static Variable TouchAttackRanged(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("TouchAttackRanged");
 }
 
-static Variable SetItemStackSize(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetItemStackSize(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
     auto nStackSize = getInt(args, 1);
@@ -1358,7 +1358,7 @@ static Variable SetItemStackSize(const std::vector<Variable> &args, const Routin
     return Variable::ofNull();
 }
 
-static Variable GetDistanceBetween(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetDistanceBetween(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObjectA = getObject(args, 0, ctx);
     auto oObjectB = getObject(args, 1, ctx);
@@ -1369,7 +1369,7 @@ static Variable GetDistanceBetween(const std::vector<Variable> &args, const Rout
     return Variable::ofFloat(oObjectA->getDistanceTo(*oObjectB));
 }
 
-static Variable SetReturnStrref(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetReturnStrref(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto bShow = getInt(args, 0);
     auto srStringRef = getIntOrElse(args, 1, 0);
@@ -1381,7 +1381,7 @@ static Variable SetReturnStrref(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("SetReturnStrref");
 }
 
-static Variable GetItemInSlot(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetItemInSlot(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nInventorySlot = getInt(args, 0);
     auto oCreature = getObjectOrCaller(args, 1, ctx);
@@ -1394,7 +1394,7 @@ static Variable GetItemInSlot(const std::vector<Variable> &args, const RoutineCo
     return Variable::ofObject(getObjectIdOrInvalid(item));
 }
 
-static Variable SetGlobalString(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetGlobalString(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sIdentifier = getString(args, 0);
     auto sValue = getString(args, 1);
@@ -1406,7 +1406,7 @@ static Variable SetGlobalString(const std::vector<Variable> &args, const Routine
     return Variable::ofNull();
 }
 
-static Variable SetCommandable(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetCommandable(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto bCommandable = getInt(args, 0);
     auto oTarget = getObjectOrCaller(args, 1, ctx);
@@ -1419,7 +1419,7 @@ static Variable SetCommandable(const std::vector<Variable> &args, const RoutineC
     return Variable::ofNull();
 }
 
-static Variable GetCommandable(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetCommandable(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObjectOrCaller(args, 0, ctx);
 
@@ -1429,7 +1429,7 @@ static Variable GetCommandable(const std::vector<Variable> &args, const RoutineC
     return Variable::ofInt(static_cast<int>(oTarget->isCommandable()));
 }
 
-static Variable GetHitDice(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetHitDice(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -1440,7 +1440,7 @@ static Variable GetHitDice(const std::vector<Variable> &args, const RoutineConte
     return Variable::ofInt(creature->attributes().getAggregateLevel());
 }
 
-static Variable GetTag(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetTag(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -1450,7 +1450,7 @@ static Variable GetTag(const std::vector<Variable> &args, const RoutineContext &
     return Variable::ofString(oObject->tag());
 }
 
-static Variable ResistForce(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ResistForce(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oSource = getObject(args, 0, ctx);
     auto oTarget = getObject(args, 1, ctx);
@@ -1461,7 +1461,7 @@ static Variable ResistForce(const std::vector<Variable> &args, const RoutineCont
     throw RoutineNotImplementedException("ResistForce");
 }
 
-static Variable GetEffectType(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetEffectType(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto eEffect = getEffect(args, 0);
 
@@ -1471,7 +1471,7 @@ static Variable GetEffectType(const std::vector<Variable> &args, const RoutineCo
     return Variable::ofInt(static_cast<int>(eEffect->type()));
 }
 
-static Variable GetFactionEqual(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFactionEqual(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oFirstObject = getObject(args, 0, ctx);
     auto oSecondObject = getObjectOrCaller(args, 1, ctx);
@@ -1484,7 +1484,7 @@ static Variable GetFactionEqual(const std::vector<Variable> &args, const Routine
     return Variable::ofInt(static_cast<int>(firstObject->faction() == secondObject->faction()));
 }
 
-static Variable ChangeFaction(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ChangeFaction(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObjectToChangeFaction = getObject(args, 0, ctx);
     auto oMemberOfFactionToJoin = getObject(args, 1, ctx);
@@ -1495,7 +1495,7 @@ static Variable ChangeFaction(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("ChangeFaction");
 }
 
-static Variable GetIsListening(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsListening(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -1505,7 +1505,7 @@ static Variable GetIsListening(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("GetIsListening");
 }
 
-static Variable SetListening(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetListening(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto bValue = getInt(args, 1);
@@ -1516,7 +1516,7 @@ static Variable SetListening(const std::vector<Variable> &args, const RoutineCon
     throw RoutineNotImplementedException("SetListening");
 }
 
-static Variable SetListenPattern(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetListenPattern(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto sPattern = getString(args, 1);
@@ -1528,7 +1528,7 @@ static Variable SetListenPattern(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("SetListenPattern");
 }
 
-static Variable TestStringAgainstPattern(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable TestStringAgainstPattern(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sPattern = getString(args, 0);
     auto sStringToTest = getString(args, 1);
@@ -1539,7 +1539,7 @@ static Variable TestStringAgainstPattern(const std::vector<Variable> &args, cons
     throw RoutineNotImplementedException("TestStringAgainstPattern");
 }
 
-static Variable GetMatchedSubstring(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetMatchedSubstring(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nString = getInt(args, 0);
 
@@ -1549,12 +1549,12 @@ static Variable GetMatchedSubstring(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("GetMatchedSubstring");
 }
 
-static Variable GetMatchedSubstringsCount(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetMatchedSubstringsCount(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetMatchedSubstringsCount");
 }
 
-static Variable GetFactionWeakestMember(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFactionWeakestMember(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oFactionMember = getObjectOrCaller(args, 0, ctx);
     auto bMustBeVisible = getIntOrElse(args, 1, 1);
@@ -1565,7 +1565,7 @@ static Variable GetFactionWeakestMember(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("GetFactionWeakestMember");
 }
 
-static Variable GetFactionStrongestMember(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFactionStrongestMember(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oFactionMember = getObjectOrCaller(args, 0, ctx);
     auto bMustBeVisible = getIntOrElse(args, 1, 1);
@@ -1576,7 +1576,7 @@ static Variable GetFactionStrongestMember(const std::vector<Variable> &args, con
     throw RoutineNotImplementedException("GetFactionStrongestMember");
 }
 
-static Variable GetFactionMostDamagedMember(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFactionMostDamagedMember(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oFactionMember = getObjectOrCaller(args, 0, ctx);
     auto bMustBeVisible = getIntOrElse(args, 1, 1);
@@ -1587,7 +1587,7 @@ static Variable GetFactionMostDamagedMember(const std::vector<Variable> &args, c
     throw RoutineNotImplementedException("GetFactionMostDamagedMember");
 }
 
-static Variable GetFactionLeastDamagedMember(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFactionLeastDamagedMember(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oFactionMember = getObjectOrCaller(args, 0, ctx);
     auto bMustBeVisible = getIntOrElse(args, 1, 1);
@@ -1598,7 +1598,7 @@ static Variable GetFactionLeastDamagedMember(const std::vector<Variable> &args,
     throw RoutineNotImplementedException("GetFactionLeastDamagedMember");
 }
 
-static Variable GetFactionGold(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFactionGold(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oFactionMember = getObject(args, 0, ctx);
 
@@ -1608,7 +1608,7 @@ static Variable GetFactionGold(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("GetFactionGold");
 }
 
-static Variable GetFactionAverageReputation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFactionAverageReputation(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oSourceFactionMember = getObject(args, 0, ctx);
     auto oTarget = getObject(args, 1, ctx);
@@ -1619,7 +1619,7 @@ static Variable GetFactionAverageReputation(const std::vector<Variable> &args, c
     throw RoutineNotImplementedException("GetFactionAverageReputation");
 }
 
-static Variable GetFactionAverageGoodEvilAlignment(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFactionAverageGoodEvilAlignment(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oFactionMember = getObject(args, 0, ctx);
 
@@ -1629,7 +1629,7 @@ static Variable GetFactionAverageGoodEvilAlignment(const std::vector<Variable> &
     throw RoutineNotImplementedException("GetFactionAverageGoodEvilAlignment");
 }
 
-static Variable SoundObjectGetFixedVariance(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SoundObjectGetFixedVariance(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oSound = getObject(args, 0, ctx);
 
@@ -1639,7 +1639,7 @@ static Variable SoundObjectGetFixedVariance(const std::vector<Variable> &args, c
     throw RoutineNotImplementedException("SoundObjectGetFixedVariance");
 }
 
-static Variable GetFactionAverageLevel(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFactionAverageLevel(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oFactionMember = getObject(args, 0, ctx);
 
@@ -1649,7 +1649,7 @@ static Variable GetFactionAverageLevel(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("GetFactionAverageLevel");
 }
 
-static Variable GetFactionAverageXP(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFactionAverageXP(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oFactionMember = getObject(args, 0, ctx);
 
@@ -1659,7 +1659,7 @@ static Variable GetFactionAverageXP(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("GetFactionAverageXP");
 }
 
-static Variable GetFactionMostFrequentClass(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFactionMostFrequentClass(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oFactionMember = getObject(args, 0, ctx);
 
@@ -1669,7 +1669,7 @@ static Variable GetFactionMostFrequentClass(const std::vector<Variable> &args, c
     throw RoutineNotImplementedException("GetFactionMostFrequentClass");
 }
 
-static Variable GetFactionWorstAC(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFactionWorstAC(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oFactionMember = getObjectOrCaller(args, 0, ctx);
     auto bMustBeVisible = getIntOrElse(args, 1, 1);
@@ -1680,7 +1680,7 @@ static Variable GetFactionWorstAC(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("GetFactionWorstAC");
 }
 
-static Variable GetFactionBestAC(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFactionBestAC(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oFactionMember = getObjectOrCaller(args, 0, ctx);
     auto bMustBeVisible = getIntOrElse(args, 1, 1);
@@ -1691,7 +1691,7 @@ static Variable GetFactionBestAC(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("GetFactionBestAC");
 }
 
-static Variable GetGlobalString(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetGlobalString(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sIdentifier = getString(args, 0);
 
@@ -1701,12 +1701,12 @@ static Variable GetGlobalString(const std::vector<Variable> &args, const Routine
     return Variable::ofString(ctx.game.getGlobalString(sIdentifier));
 }
 
-static Variable GetListenPatternNumber(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetListenPatternNumber(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetListenPatternNumber");
 }
 
-static Variable GetWaypointByTag(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetWaypointByTag(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sWaypointTag = getString(args, 0);
 
@@ -1724,7 +1724,7 @@ static Variable GetWaypointByTag(const std::vector<Variable> &args, const Routin
     return Variable::ofObject(getObjectIdOrInvalid(waypoint));
 }
 
-static Variable GetTransitionTarget(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetTransitionTarget(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTransition = getObject(args, 0, ctx);
 
@@ -1734,7 +1734,7 @@ static Variable GetTransitionTarget(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("GetTransitionTarget");
 }
 
-static Variable GetObjectByTag(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetObjectByTag(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sTag = getString(args, 0);
     auto nNth = getIntOrElse(args, 1, 0);
@@ -1752,7 +1752,7 @@ static Variable GetObjectByTag(const std::vector<Variable> &args, const RoutineC
     return Variable::ofObject(getObjectIdOrInvalid(object));
 }
 
-static Variable AdjustAlignment(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AdjustAlignment(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oSubject = getObject(args, 0, ctx);
     auto nAlignment = getInt(args, 1);
@@ -1765,7 +1765,7 @@ static Variable AdjustAlignment(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("AdjustAlignment");
 }
 
-static Variable SetAreaTransitionBMP(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetAreaTransitionBMP(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nPredefinedAreaTransition = getInt(args, 0);
     auto sCustomAreaTransitionBMP = getStringOrElse(args, 1, "");
@@ -1776,7 +1776,7 @@ static Variable SetAreaTransitionBMP(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("SetAreaTransitionBMP");
 }
 
-static Variable GetReputation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetReputation(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oSource = getObject(args, 0, ctx);
     auto oTarget = getObject(args, 1, ctx);
@@ -1787,7 +1787,7 @@ static Variable GetReputation(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("GetReputation");
 }
 
-static Variable AdjustReputation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AdjustReputation(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
     auto oSourceFactionMember = getObject(args, 1, ctx);
@@ -1799,12 +1799,12 @@ static Variable AdjustReputation(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("AdjustReputation");
 }
 
-static Variable GetModuleFileName(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetModuleFileName(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetModuleFileName");
 }
 
-static Variable GetGoingToBeAttackedBy(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetGoingToBeAttackedBy(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
 
@@ -1814,7 +1814,7 @@ static Variable GetGoingToBeAttackedBy(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("GetGoingToBeAttackedBy");
 }
 
-static Variable GetLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLocation(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -1824,7 +1824,7 @@ static Variable GetLocation(const std::vector<Variable> &args, const RoutineCont
     return Variable::ofLocation(ctx.game.newLocation(oObject->position(), oObject->getFacing()));
 }
 
-static Variable CreateLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable CreateLocation(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto vPosition = getVector(args, 0);
     auto fOrientation = getFloat(args, 1);
@@ -1836,7 +1836,7 @@ static Variable CreateLocation(const std::vector<Variable> &args, const RoutineC
     return Variable::ofLocation(ctx.game.newLocation(std::move(vPosition), orientation));
 }
 
-static Variable ApplyEffectAtLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ApplyEffectAtLocation(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nDurationType = getInt(args, 0);
     auto eEffect = getEffect(args, 1);
@@ -1849,7 +1849,7 @@ static Variable ApplyEffectAtLocation(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("ApplyEffectAtLocation");
 }
 
-static Variable GetIsPC(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsPC(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -1861,7 +1861,7 @@ static Variable GetIsPC(const std::vector<Variable> &args, const RoutineContext
     return Variable::ofInt(static_cast<int>(pc));
 }
 
-static Variable FeetToMeters(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable FeetToMeters(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto fFeet = getFloat(args, 0);
 
@@ -1871,7 +1871,7 @@ static Variable FeetToMeters(const std::vector<Variable> &args, const RoutineCon
     throw RoutineNotImplementedException("FeetToMeters");
 }
 
-static Variable YardsToMeters(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable YardsToMeters(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto fYards = getFloat(args, 0);
 
@@ -1881,7 +1881,7 @@ static Variable YardsToMeters(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("YardsToMeters");
 }
 
-static Variable ApplyEffectToObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ApplyEffectToObject(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nDurationType = getInt(args, 0);
     auto eEffect = getEffect(args, 1);
@@ -1896,7 +1896,7 @@ static Variable ApplyEffectToObject(const std::vector<Variable> &args, const Rou
     return Variable::ofNull();
 }
 
-static Variable SpeakString(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SpeakString(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sStringToSpeak = getString(args, 0);
     auto nTalkVolume = getIntOrElse(args, 1, 0);
@@ -1907,12 +1907,12 @@ static Variable SpeakString(const std::vector<Variable> &args, const RoutineCont
     throw RoutineNotImplementedException("SpeakString");
 }
 
-static Variable GetSpellTargetLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetSpellTargetLocation(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetSpellTargetLocation");
 }
 
-static Variable GetPositionFromLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetPositionFromLocation(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto lLocation = getLocationArgument(args, 0);
 
@@ -1922,7 +1922,7 @@ static Variable GetPositionFromLocation(const std::vector<Variable> &args, const
     return Variable::ofVector(lLocation->position());
 }
 
-static Variable GetFacingFromLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFacingFromLocation(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto lLocation = getLocationArgument(args, 0);
 
@@ -1932,7 +1932,7 @@ static Variable GetFacingFromLocation(const std::vector<Variable> &args, const R
     return Variable::ofFloat(glm::degrees(lLocation->facing()));
 }
 
-static Variable GetNearestCreatureToLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetNearestCreatureToLocation(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nFirstCriteriaType = getInt(args, 0);
     auto nFirstCriteriaValue = getInt(args, 1);
@@ -1949,7 +1949,7 @@ static Variable GetNearestCreatureToLocation(const std::vector<Variable> &args,
     throw RoutineNotImplementedException("GetNearestCreatureToLocation");
 }
 
-static Variable GetNearestObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetNearestObject(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nObjectType = getIntOrElse(args, 0, 32767);
     auto oTarget = getObjectOrCaller(args, 1, ctx);
@@ -1965,7 +1965,7 @@ static Variable GetNearestObject(const std::vector<Variable> &args, const Routin
     return Variable::ofObject(getObjectIdOrInvalid(object));
 }
 
-static Variable GetNearestObjectToLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetNearestObjectToLocation(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nObjectType = getInt(args, 0);
     auto lLocation = getLocationArgument(args, 1);
@@ -1977,7 +1977,7 @@ static Variable GetNearestObjectToLocation(const std::vector<Variable> &args, co
     throw RoutineNotImplementedException("GetNearestObjectToLocation");
 }
 
-static Variable GetNearestObjectByTag(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetNearestObjectByTag(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sTag = getString(args, 0);
     auto oTarget = getObjectOrCaller(args, 1, ctx);
@@ -1993,7 +1993,7 @@ static Variable GetNearestObjectByTag(const std::vector<Variable> &args, const R
     return Variable::ofObject(getObjectIdOrInvalid(object));
 }
 
-static Variable IntToFloat(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable IntToFloat(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nInteger = getInt(args, 0);
 
@@ -2003,7 +2003,7 @@ static Variable IntToFloat(const std::vector<Variable> &args, const RoutineConte
     return Variable::ofFloat(static_cast<float>(nInteger));
 }
 
-static Variable FloatToInt(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable FloatToInt(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto fFloat = getFloat(args, 0);
 
@@ -2013,7 +2013,7 @@ static Variable FloatToInt(const std::vector<Variable> &args, const RoutineConte
     return Variable::ofInt(static_cast<int>(fFloat));
 }
 
-static Variable StringToInt(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable StringToInt(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sNumber = getString(args, 0);
 
@@ -2027,7 +2027,7 @@ static Variable StringToInt(const std::vector<Variable> &args, const RoutineCont
     return Variable::ofInt(intValue);
 }
 
-static Variable StringToFloat(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable StringToFloat(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sNumber = getString(args, 0);
 
@@ -2037,7 +2037,7 @@ static Variable StringToFloat(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("StringToFloat");
 }
 
-static Variable GetIsEnemy(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsEnemy(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
     auto oSource = getObjectOrCaller(args, 1, ctx);
@@ -2051,7 +2051,7 @@ static Variable GetIsEnemy(const std::vector<Variable> &args, const RoutineConte
     return Variable::ofInt(static_cast<int>(enemy));
 }
 
-static Variable GetIsFriend(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsFriend(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
     auto oSource = getObjectOrCaller(args, 1, ctx);
@@ -2065,7 +2065,7 @@ static Variable GetIsFriend(const std::vector<Variable> &args, const RoutineCont
     return Variable::ofInt(static_cast<int>(isFriend));
 }
 
-static Variable GetIsNeutral(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsNeutral(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
     auto oSource = getObjectOrCaller(args, 1, ctx);
@@ -2079,13 +2079,13 @@ static Variable GetIsNeutral(const std::vector<Variable> &args, const RoutineCon
     return Variable::ofInt(static_cast<int>(neutral));
 }
 
-static Variable GetPCSpeaker(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetPCSpeaker(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto player = ctx.game.party().player();
     return Variable::ofObject(getObjectIdOrInvalid(player));
 }
 
-static Variable GetStringByStrRef(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetStringByStrRef(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nStrRef = getInt(args, 0);
 
@@ -2095,7 +2095,7 @@ static Variable GetStringByStrRef(const std::vector<Variable> &args, const Routi
     return Variable::ofString(ctx.services.resource.strings.getText(nStrRef));
 }
 
-static Variable DestroyObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable DestroyObject(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oDestroy = getObject(args, 0, ctx);
     auto fDelay = getFloatOrElse(args, 1, 0.0f);
@@ -2110,12 +2110,12 @@ static Variable DestroyObject(const std::vector<Variable> &args, const RoutineCo
     return Variable::ofNull();
 }
 
-static Variable GetModule(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetModule(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     return Variable::ofObject(getObjectIdOrInvalid(ctx.game.module()));
 }
 
-static Variable CreateObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable CreateObject(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nObjectType = getInt(args, 0);
     auto sTemplate = getString(args, 1);
@@ -2131,7 +2131,7 @@ static Variable CreateObject(const std::vector<Variable> &args, const RoutineCon
     return Variable::ofObject(getObjectIdOrInvalid(object));
 }
 
-static Variable EventSpellCastAt(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EventSpellCastAt(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCaster = getObject(args, 0, ctx);
     auto nSpell = getInt(args, 1);
@@ -2143,37 +2143,37 @@ static Variable EventSpellCastAt(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("EventSpellCastAt");
 }
 
-static Variable GetLastSpellCaster(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastSpellCaster(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLastSpellCaster");
 }
 
-static Variable GetLastSpell(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastSpell(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLastSpell");
 }
 
-static Variable GetUserDefinedEventNumber(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetUserDefinedEventNumber(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     return Variable::ofInt(ctx.execution.userDefinedEventNumber);
 }
 
-static Variable GetSpellId(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetSpellId(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetSpellId");
 }
 
-static Variable RandomName(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable RandomName(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("RandomName");
 }
 
-static Variable GetLoadFromSaveGame(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLoadFromSaveGame(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLoadFromSaveGame");
 }
 
-static Variable GetName(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetName(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -2183,12 +2183,12 @@ static Variable GetName(const std::vector<Variable> &args, const RoutineContext
     return Variable::ofString(oObject->name());
 }
 
-static Variable GetLastSpeaker(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastSpeaker(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLastSpeaker");
 }
 
-static Variable BeginConversation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable BeginConversation(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sResRef = getStringOrElse(args, 0, "");
     auto oObjectToDialog = getObjectOrNull(args, 1, ctx);
@@ -2199,48 +2199,48 @@ static Variable BeginConversation(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("BeginConversation");
 }
 
-static Variable GetLastPerceived(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastPerceived(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto caller = checkCreature(getCaller(ctx));
     auto perceived = caller->perception().lastPerceived;
     return Variable::ofObject(getObjectIdOrInvalid(perceived));
 }
 
-static Variable GetLastPerceptionHeard(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastPerceptionHeard(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto caller = checkCreature(getCaller(ctx));
     bool heard = caller->perception().lastPerception == PerceptionType::Heard;
     return Variable::ofInt(static_cast<int>(heard));
 }
 
-static Variable GetLastPerceptionInaudible(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastPerceptionInaudible(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto caller = checkCreature(getCaller(ctx));
     bool inaudible = caller->perception().lastPerception == PerceptionType::NotHeard;
     return Variable::ofInt(static_cast<int>(inaudible));
 }
 
-static Variable GetLastPerceptionSeen(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastPerceptionSeen(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto caller = checkCreature(getCaller(ctx));
     bool seen = caller->perception().lastPerception == PerceptionType::Seen;
     return Variable::ofInt(static_cast<int>(seen));
 }
 
-static Variable GetLastClosedBy(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastClosedBy(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto triggerrer = getTriggerrer(ctx);
     return Variable::ofObject(getObjectIdOrInvalid(triggerrer));
 }
 
-static Variable GetLastPerceptionVanished(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastPerceptionVanished(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto caller = checkCreature(getCaller(ctx));
     bool vanished = caller->perception().lastPerception == PerceptionType::NotSeen;
     return Variable::ofInt(static_cast<int>(vanished));
 }
 
-static Variable GetFirstInPersistentObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFirstInPersistentObject(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oPersistentObject = getObjectOrCaller(args, 0, ctx);
     auto nResidentObjectType = getIntOrElse(args, 1, 1);
@@ -2252,7 +2252,7 @@ static Variable GetFirstInPersistentObject(const std::vector<Variable> &args, co
     throw RoutineNotImplementedException("GetFirstInPersistentObject");
 }
 
-static Variable GetNextInPersistentObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetNextInPersistentObject(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oPersistentObject = getObjectOrCaller(args, 0, ctx);
     auto nResidentObjectType = getIntOrElse(args, 1, 1);
@@ -2264,7 +2264,7 @@ static Variable GetNextInPersistentObject(const std::vector<Variable> &args, con
     throw RoutineNotImplementedException("GetNextInPersistentObject");
 }
 
-static Variable GetAreaOfEffectCreator(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetAreaOfEffectCreator(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oAreaOfEffectObject = getObjectOrCaller(args, 0, ctx);
 
@@ -2274,12 +2274,12 @@ static Variable GetAreaOfEffectCreator(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("GetAreaOfEffectCreator");
 }
 
-static Variable ShowLevelUpGUI(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ShowLevelUpGUI(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("ShowLevelUpGUI");
 }
 
-static Variable SetItemNonEquippable(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetItemNonEquippable(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
     auto bNonEquippable = getInt(args, 1);
@@ -2290,12 +2290,12 @@ static Variable SetItemNonEquippable(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("SetItemNonEquippable");
 }
 
-static Variable GetButtonMashCheck(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetButtonMashCheck(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetButtonMashCheck");
 }
 
-static Variable SetButtonMashCheck(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetButtonMashCheck(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nCheck = getInt(args, 0);
 
@@ -2305,7 +2305,7 @@ static Variable SetButtonMashCheck(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("SetButtonMashCheck");
 }
 
-static Variable GiveItem(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GiveItem(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
     auto oGiveTo = getObject(args, 1, ctx);
@@ -2316,7 +2316,7 @@ static Variable GiveItem(const std::vector<Variable> &args, const RoutineContext
     throw RoutineNotImplementedException("GiveItem");
 }
 
-static Variable ObjectToString(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ObjectToString(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -2326,7 +2326,7 @@ static Variable ObjectToString(const std::vector<Variable> &args, const RoutineC
     return Variable::ofString(str(boost::format("%x") % oObject->id()));
 }
 
-static Variable GetIsImmune(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsImmune(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto nImmunityType = getInt(args, 1);
@@ -2338,7 +2338,7 @@ static Variable GetIsImmune(const std::vector<Variable> &args, const RoutineCont
     throw RoutineNotImplementedException("GetIsImmune");
 }
 
-static Variable GetEncounterActive(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetEncounterActive(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oEncounter = getObjectOrCaller(args, 0, ctx);
 
@@ -2348,7 +2348,7 @@ static Variable GetEncounterActive(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("GetEncounterActive");
 }
 
-static Variable SetEncounterActive(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetEncounterActive(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nNewValue = getInt(args, 0);
     auto oEncounter = getObjectOrCaller(args, 1, ctx);
@@ -2359,7 +2359,7 @@ static Variable SetEncounterActive(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("SetEncounterActive");
 }
 
-static Variable GetEncounterSpawnsMax(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetEncounterSpawnsMax(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oEncounter = getObjectOrCaller(args, 0, ctx);
 
@@ -2369,7 +2369,7 @@ static Variable GetEncounterSpawnsMax(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("GetEncounterSpawnsMax");
 }
 
-static Variable SetEncounterSpawnsMax(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetEncounterSpawnsMax(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nNewValue = getInt(args, 0);
     auto oEncounter = getObjectOrCaller(args, 1, ctx);
@@ -2380,7 +2380,7 @@ static Variable SetEncounterSpawnsMax(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("SetEncounterSpawnsMax");
 }
 
-static Variable GetEncounterSpawnsCurrent(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetEncounterSpawnsCurrent(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oEncounter = getObjectOrCaller(args, 0, ctx);
 
@@ -2390,7 +2390,7 @@ static Variable GetEncounterSpawnsCurrent(const std::vector<Variable> &args, con
     throw RoutineNotImplementedException("GetEncounterSpawnsCurrent");
 }
 
-static Variable SetEncounterSpawnsCurrent(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetEncounterSpawnsCurrent(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nNewValue = getInt(args, 0);
     auto oEncounter = getObjectOrCaller(args, 1, ctx);
@@ -2401,17 +2401,17 @@ static Variable SetEncounterSpawnsCurrent(const std::vector<Variable> &args, con
     throw RoutineNotImplementedException("SetEncounterSpawnsCurrent");
 }
 
-static Variable GetModuleItemAcquired(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetModuleItemAcquired(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetModuleItemAcquired");
 }
 
-static Variable GetModuleItemAcquiredFrom(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetModuleItemAcquiredFrom(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetModuleItemAcquiredFrom");
 }
 
-static Variable SetCustomToken(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetCustomToken(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nCustomTokenNumber = getInt(args, 0);
     auto sTokenValue = getString(args, 1);
@@ -2422,7 +2422,7 @@ static Variable SetCustomToken(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("SetCustomToken");
 }
 
-static Variable GetHasFeat(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetHasFeat(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nFeat = getInt(args, 0);
     auto oCreature = getObjectOrCaller(args, 1, ctx);
@@ -2436,7 +2436,7 @@ static Variable GetHasFeat(const std::vector<Variable> &args, const RoutineConte
     return Variable::ofInt(static_cast<int>(hasFeat));
 }
 
-static Variable GetHasSkill(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetHasSkill(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nSkill = getInt(args, 0);
     auto oCreature = getObjectOrCaller(args, 1, ctx);
@@ -2450,7 +2450,7 @@ static Variable GetHasSkill(const std::vector<Variable> &args, const RoutineCont
     return Variable::ofInt(static_cast<int>(hasSkill));
 }
 
-static Variable GetObjectSeen(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetObjectSeen(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
     auto oSource = getObjectOrCaller(args, 1, ctx);
@@ -2463,7 +2463,7 @@ static Variable GetObjectSeen(const std::vector<Variable> &args, const RoutineCo
     return Variable::ofInt(static_cast<int>(seen));
 }
 
-static Variable GetObjectHeard(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetObjectHeard(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
     auto oSource = getObjectOrCaller(args, 1, ctx);
@@ -2474,27 +2474,27 @@ static Variable GetObjectHeard(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("GetObjectHeard");
 }
 
-static Variable GetLastPlayerDied(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastPlayerDied(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLastPlayerDied");
 }
 
-static Variable GetModuleItemLost(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetModuleItemLost(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetModuleItemLost");
 }
 
-static Variable GetModuleItemLostBy(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetModuleItemLostBy(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetModuleItemLostBy");
 }
 
-static Variable EventConversation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EventConversation(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("EventConversation");
 }
 
-static Variable SetEncounterDifficulty(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetEncounterDifficulty(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nEncounterDifficulty = getInt(args, 0);
     auto oEncounter = getObjectOrCaller(args, 1, ctx);
@@ -2505,7 +2505,7 @@ static Variable SetEncounterDifficulty(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("SetEncounterDifficulty");
 }
 
-static Variable GetEncounterDifficulty(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetEncounterDifficulty(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oEncounter = getObjectOrCaller(args, 0, ctx);
 
@@ -2515,7 +2515,7 @@ static Variable GetEncounterDifficulty(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("GetEncounterDifficulty");
 }
 
-static Variable GetDistanceBetweenLocations(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetDistanceBetweenLocations(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto lLocationA = getLocationArgument(args, 0);
     auto lLocationB = getLocationArgument(args, 1);
@@ -2526,7 +2526,7 @@ static Variable GetDistanceBetweenLocations(const std::vector<Variable> &args, c
     throw RoutineNotImplementedException("GetDistanceBetweenLocations");
 }
 
-static Variable GetReflexAdjustedDamage(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetReflexAdjustedDamage(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nDamage = getInt(args, 0);
     auto oTarget = getObject(args, 1, ctx);
@@ -2540,7 +2540,7 @@ static Variable GetReflexAdjustedDamage(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("GetReflexAdjustedDamage");
 }
 
-static Variable PlayAnimation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable PlayAnimation(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nAnimation = getInt(args, 0);
     auto fSpeed = getFloatOrElse(args, 1, 1.0f);
@@ -2557,7 +2557,7 @@ static Variable PlayAnimation(const std::vector<Variable> &args, const RoutineCo
     return Variable::ofNull();
 }
 
-static Variable TalentSpell(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable TalentSpell(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nSpell = getInt(args, 0);
 
@@ -2567,7 +2567,7 @@ static Variable TalentSpell(const std::vector<Variable> &args, const RoutineCont
     return Variable::ofTalent(ctx.game.newTalent(TalentType::Spell, nSpell));
 }
 
-static Variable TalentFeat(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable TalentFeat(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nFeat = getInt(args, 0);
 
@@ -2577,7 +2577,7 @@ static Variable TalentFeat(const std::vector<Variable> &args, const RoutineConte
     return Variable::ofTalent(ctx.game.newTalent(TalentType::Feat, nFeat));
 }
 
-static Variable TalentSkill(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable TalentSkill(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nSkill = getInt(args, 0);
 
@@ -2587,7 +2587,7 @@ static Variable TalentSkill(const std::vector<Variable> &args, const RoutineCont
     throw RoutineNotImplementedException("TalentSkill");
 }
 
-static Variable GetHasSpellEffect(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetHasSpellEffect(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nSpell = getInt(args, 0);
     auto oObject = getObjectOrCaller(args, 1, ctx);
@@ -2598,7 +2598,7 @@ static Variable GetHasSpellEffect(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("GetHasSpellEffect");
 }
 
-static Variable GetEffectSpellId(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetEffectSpellId(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto eSpellEffect = getEffect(args, 0);
 
@@ -2608,7 +2608,7 @@ static Variable GetEffectSpellId(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("GetEffectSpellId");
 }
 
-static Variable GetCreatureHasTalent(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetCreatureHasTalent(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto tTalent = getTalent(args, 0);
     auto oCreature = getObjectOrCaller(args, 1, ctx);
@@ -2619,7 +2619,7 @@ static Variable GetCreatureHasTalent(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("GetCreatureHasTalent");
 }
 
-static Variable GetCreatureTalentRandom(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetCreatureTalentRandom(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nCategory = getInt(args, 0);
     auto oCreature = getObjectOrCaller(args, 1, ctx);
@@ -2631,7 +2631,7 @@ static Variable GetCreatureTalentRandom(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("GetCreatureTalentRandom");
 }
 
-static Variable GetCreatureTalentBest(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetCreatureTalentBest(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nCategory = getInt(args, 0);
     auto nCRMax = getInt(args, 1);
@@ -2646,7 +2646,7 @@ static Variable GetCreatureTalentBest(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("GetCreatureTalentBest");
 }
 
-static Variable GetGoldPieceValue(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetGoldPieceValue(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
 
@@ -2656,7 +2656,7 @@ static Variable GetGoldPieceValue(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("GetGoldPieceValue");
 }
 
-static Variable GetIsPlayableRacialType(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsPlayableRacialType(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -2666,7 +2666,7 @@ static Variable GetIsPlayableRacialType(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("GetIsPlayableRacialType");
 }
 
-static Variable JumpToLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable JumpToLocation(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto lDestination = getLocationArgument(args, 0);
 
@@ -2678,7 +2678,7 @@ static Variable JumpToLocation(const std::vector<Variable> &args, const RoutineC
     return Variable::ofNull();
 }
 
-static Variable GetSkillRank(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetSkillRank(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nSkill = getInt(args, 0);
     auto oTarget = getObjectOrCaller(args, 1, ctx);
@@ -2691,7 +2691,7 @@ static Variable GetSkillRank(const std::vector<Variable> &args, const RoutineCon
     return Variable::ofInt(target->attributes().getSkillRank(skill));
 }
 
-static Variable GetAttackTarget(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetAttackTarget(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObjectOrCaller(args, 0, ctx);
 
@@ -2703,7 +2703,7 @@ static Variable GetAttackTarget(const std::vector<Variable> &args, const Routine
     return Variable::ofObject(getObjectIdOrInvalid(target));
 }
 
-static Variable GetLastAttackType(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastAttackType(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObjectOrCaller(args, 0, ctx);
 
@@ -2713,7 +2713,7 @@ static Variable GetLastAttackType(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("GetLastAttackType");
 }
 
-static Variable GetLastAttackMode(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastAttackMode(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObjectOrCaller(args, 0, ctx);
 
@@ -2723,7 +2723,7 @@ static Variable GetLastAttackMode(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("GetLastAttackMode");
 }
 
-static Variable GetDistanceBetween2D(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetDistanceBetween2D(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObjectA = getObject(args, 0, ctx);
     auto oObjectB = getObject(args, 1, ctx);
@@ -2735,7 +2735,7 @@ static Variable GetDistanceBetween2D(const std::vector<Variable> &args, const Ro
     return Variable::ofFloat(distance);
 }
 
-static Variable GetIsInCombat(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsInCombat(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObjectOrCaller(args, 0, ctx);
     auto bOnlyCountReal = getIntOrElse(args, 1, 0);
@@ -2747,7 +2747,7 @@ static Variable GetIsInCombat(const std::vector<Variable> &args, const RoutineCo
     return Variable::ofInt(static_cast<int>(creature->isInCombat()));
 }
 
-static Variable GetLastAssociateCommand(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastAssociateCommand(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oAssociate = getObjectOrCaller(args, 0, ctx);
 
@@ -2757,7 +2757,7 @@ static Variable GetLastAssociateCommand(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("GetLastAssociateCommand");
 }
 
-static Variable GiveGoldToCreature(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GiveGoldToCreature(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto nGP = getInt(args, 1);
@@ -2770,7 +2770,7 @@ static Variable GiveGoldToCreature(const std::vector<Variable> &args, const Rout
     return Variable::ofNull();
 }
 
-static Variable SetIsDestroyable(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetIsDestroyable(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto bDestroyable = getInt(args, 0);
     auto bRaiseable = getIntOrElse(args, 1, 1);
@@ -2782,7 +2782,7 @@ static Variable SetIsDestroyable(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("SetIsDestroyable");
 }
 
-static Variable SetLocked(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetLocked(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
     auto bLocked = getInt(args, 1);
@@ -2796,7 +2796,7 @@ static Variable SetLocked(const std::vector<Variable> &args, const RoutineContex
     return Variable::ofNull();
 }
 
-static Variable GetLocked(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLocked(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
 
@@ -2807,12 +2807,12 @@ static Variable GetLocked(const std::vector<Variable> &args, const RoutineContex
     return Variable::ofInt(static_cast<int>(target->isLocked()));
 }
 
-static Variable GetClickingObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetClickingObject(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetClickingObject");
 }
 
-static Variable SetAssociateListenPatterns(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetAssociateListenPatterns(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObjectOrCaller(args, 0, ctx);
 
@@ -2822,7 +2822,7 @@ static Variable SetAssociateListenPatterns(const std::vector<Variable> &args, co
     throw RoutineNotImplementedException("SetAssociateListenPatterns");
 }
 
-static Variable GetLastWeaponUsed(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastWeaponUsed(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -2832,12 +2832,12 @@ static Variable GetLastWeaponUsed(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("GetLastWeaponUsed");
 }
 
-static Variable GetLastUsedBy(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastUsedBy(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLastUsedBy");
 }
 
-static Variable GetAbilityModifier(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetAbilityModifier(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nAbility = getInt(args, 0);
     auto oCreature = getObjectOrCaller(args, 1, ctx);
@@ -2848,7 +2848,7 @@ static Variable GetAbilityModifier(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("GetAbilityModifier");
 }
 
-static Variable GetIdentified(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIdentified(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
 
@@ -2858,7 +2858,7 @@ static Variable GetIdentified(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("GetIdentified");
 }
 
-static Variable SetIdentified(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetIdentified(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
     auto bIdentified = getInt(args, 1);
@@ -2869,7 +2869,7 @@ static Variable SetIdentified(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("SetIdentified");
 }
 
-static Variable GetDistanceBetweenLocations2D(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetDistanceBetweenLocations2D(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto lLocationA = getLocationArgument(args, 0);
     auto lLocationB = getLocationArgument(args, 1);
@@ -2880,7 +2880,7 @@ static Variable GetDistanceBetweenLocations2D(const std::vector<Variable> &args,
     throw RoutineNotImplementedException("GetDistanceBetweenLocations2D");
 }
 
-static Variable GetDistanceToObject2D(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetDistanceToObject2D(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -2892,12 +2892,12 @@ static Variable GetDistanceToObject2D(const std::vector<Variable> &args, const R
     return Variable::ofFloat(result);
 }
 
-static Variable GetBlockingDoor(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetBlockingDoor(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetBlockingDoor");
 }
 
-static Variable GetIsDoorActionPossible(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsDoorActionPossible(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTargetDoor = getObject(args, 0, ctx);
     auto nDoorAction = getInt(args, 1);
@@ -2908,7 +2908,7 @@ static Variable GetIsDoorActionPossible(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("GetIsDoorActionPossible");
 }
 
-static Variable DoDoorAction(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable DoDoorAction(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTargetDoor = getObject(args, 0, ctx);
     auto nDoorAction = getInt(args, 1);
@@ -2919,7 +2919,7 @@ static Variable DoDoorAction(const std::vector<Variable> &args, const RoutineCon
     throw RoutineNotImplementedException("DoDoorAction");
 }
 
-static Variable GetFirstItemInInventory(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFirstItemInInventory(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObjectOrCaller(args, 0, ctx);
 
@@ -2930,7 +2930,7 @@ static Variable GetFirstItemInInventory(const std::vector<Variable> &args, const
     return Variable::ofObject(getObjectIdOrInvalid(item));
 }
 
-static Variable GetNextItemInInventory(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetNextItemInInventory(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObjectOrCaller(args, 0, ctx);
 
@@ -2941,7 +2941,7 @@ static Variable GetNextItemInInventory(const std::vector<Variable> &args, const
     return Variable::ofObject(getObjectIdOrInvalid(item));
 }
 
-static Variable GetClassByPosition(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetClassByPosition(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nClassPosition = getInt(args, 0);
     auto oCreature = getObjectOrCaller(args, 1, ctx);
@@ -2954,7 +2954,7 @@ static Variable GetClassByPosition(const std::vector<Variable> &args, const Rout
     return Variable::ofInt(static_cast<int>(clazz));
 }
 
-static Variable GetLevelByPosition(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLevelByPosition(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nClassPosition = getInt(args, 0);
     auto oCreature = getObjectOrCaller(args, 1, ctx);
@@ -2967,7 +2967,7 @@ static Variable GetLevelByPosition(const std::vector<Variable> &args, const Rout
     return Variable::ofInt(level);
 }
 
-static Variable GetLevelByClass(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLevelByClass(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nClassType = getInt(args, 0);
     auto oCreature = getObjectOrCaller(args, 1, ctx);
@@ -2981,7 +2981,7 @@ static Variable GetLevelByClass(const std::vector<Variable> &args, const Routine
     return Variable::ofInt(level);
 }
 
-static Variable GetDamageDealtByType(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetDamageDealtByType(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nDamageType = getInt(args, 0);
 
@@ -2991,47 +2991,47 @@ static Variable GetDamageDealtByType(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("GetDamageDealtByType");
 }
 
-static Variable GetTotalDamageDealt(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetTotalDamageDealt(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetTotalDamageDealt");
 }
 
-static Variable GetLastDamager(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastDamager(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLastDamager");
 }
 
-static Variable GetLastDisarmed(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastDisarmed(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLastDisarmed");
 }
 
-static Variable GetLastDisturbed(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastDisturbed(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLastDisturbed");
 }
 
-static Variable GetLastLocked(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastLocked(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLastLocked");
 }
 
-static Variable GetLastUnlocked(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastUnlocked(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLastUnlocked");
 }
 
-static Variable GetInventoryDisturbType(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetInventoryDisturbType(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetInventoryDisturbType");
 }
 
-static Variable GetInventoryDisturbItem(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetInventoryDisturbItem(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetInventoryDisturbItem");
 }
 
-static Variable ShowUpgradeScreen(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ShowUpgradeScreen(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObjectOrNull(args, 0, ctx);
     auto oCharacter = getObjectOrNull(args, 1, ctx);
@@ -3045,7 +3045,7 @@ static Variable ShowUpgradeScreen(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("ShowUpgradeScreen");
 }
 
-static Variable VersusAlignmentEffect(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable VersusAlignmentEffect(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto eEffect = getEffect(args, 0);
     auto nLawChaos = getIntOrElse(args, 1, 0);
@@ -3057,7 +3057,7 @@ static Variable VersusAlignmentEffect(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("VersusAlignmentEffect");
 }
 
-static Variable VersusRacialTypeEffect(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable VersusRacialTypeEffect(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto eEffect = getEffect(args, 0);
     auto nRacialType = getInt(args, 1);
@@ -3068,7 +3068,7 @@ static Variable VersusRacialTypeEffect(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("VersusRacialTypeEffect");
 }
 
-static Variable VersusTrapEffect(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable VersusTrapEffect(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto eEffect = getEffect(args, 0);
 
@@ -3078,7 +3078,7 @@ static Variable VersusTrapEffect(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("VersusTrapEffect");
 }
 
-static Variable GetGender(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetGender(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -3089,7 +3089,7 @@ static Variable GetGender(const std::vector<Variable> &args, const RoutineContex
     return Variable::ofInt(static_cast<int>(creature->gender()));
 }
 
-static Variable GetIsTalentValid(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsTalentValid(const VariableSpan &args, const RoutineContext &ctx) {
     bool valid;
     try {
         auto tTalent = getTalent(args, 0);
@@ -3100,14 +3100,14 @@ static Variable GetIsTalentValid(const std::vector<Variable> &args, const Routin
     return Variable::ofInt(static_cast<int>(valid));
 }
 
-static Variable GetAttemptedAttackTarget(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetAttemptedAttackTarget(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto caller = checkCreature(getCaller(ctx));
     auto target = caller->getAttemptedAttackTarget();
     return Variable::ofObject(getObjectIdOrInvalid(target));
 }
 
-static Variable GetTypeFromTalent(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetTypeFromTalent(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto tTalent = getTalent(args, 0);
 
@@ -3117,7 +3117,7 @@ static Variable GetTypeFromTalent(const std::vector<Variable> &args, const Routi
     return Variable::ofInt(static_cast<int>(tTalent->type()));
 }
 
-static Variable GetIdFromTalent(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIdFromTalent(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto tTalent = getTalent(args, 0);
 
@@ -3127,7 +3127,7 @@ static Variable GetIdFromTalent(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("GetIdFromTalent");
 }
 
-static Variable PlayPazaak(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable PlayPazaak(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nOpponentPazaakDeck = getInt(args, 0);
     auto sEndScript = getString(args, 1);
@@ -3141,12 +3141,12 @@ static Variable PlayPazaak(const std::vector<Variable> &args, const RoutineConte
     throw RoutineNotImplementedException("PlayPazaak");
 }
 
-static Variable GetLastPazaakResult(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastPazaakResult(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLastPazaakResult");
 }
 
-static Variable DisplayFeedBackText(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable DisplayFeedBackText(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto nTextConstant = getInt(args, 1);
@@ -3157,7 +3157,7 @@ static Variable DisplayFeedBackText(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("DisplayFeedBackText");
 }
 
-static Variable AddJournalQuestEntry(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AddJournalQuestEntry(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto szPlotID = getString(args, 0);
     auto nState = getInt(args, 1);
@@ -3169,7 +3169,7 @@ static Variable AddJournalQuestEntry(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("AddJournalQuestEntry");
 }
 
-static Variable RemoveJournalQuestEntry(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable RemoveJournalQuestEntry(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto szPlotID = getString(args, 0);
 
@@ -3179,7 +3179,7 @@ static Variable RemoveJournalQuestEntry(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("RemoveJournalQuestEntry");
 }
 
-static Variable GetJournalEntry(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetJournalEntry(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto szPlotID = getString(args, 0);
 
@@ -3189,7 +3189,7 @@ static Variable GetJournalEntry(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("GetJournalEntry");
 }
 
-static Variable PlayRumblePattern(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable PlayRumblePattern(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nPattern = getInt(args, 0);
 
@@ -3199,7 +3199,7 @@ static Variable PlayRumblePattern(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("PlayRumblePattern");
 }
 
-static Variable StopRumblePattern(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable StopRumblePattern(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nPattern = getInt(args, 0);
 
@@ -3209,7 +3209,7 @@ static Variable StopRumblePattern(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("StopRumblePattern");
 }
 
-static Variable SendMessageToPC(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SendMessageToPC(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oPlayer = getObject(args, 0, ctx);
     auto szMessage = getString(args, 1);
@@ -3220,18 +3220,18 @@ static Variable SendMessageToPC(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("SendMessageToPC");
 }
 
-static Variable GetAttemptedSpellTarget(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetAttemptedSpellTarget(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetAttemptedSpellTarget");
 }
 
-static Variable GetLastOpenedBy(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastOpenedBy(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto triggerrer = getTriggerrer(ctx);
     return Variable::ofObject(getObjectIdOrInvalid(triggerrer));
 }
 
-static Variable GetHasSpell(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetHasSpell(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nSpell = getInt(args, 0);
     auto oCreature = getObjectOrCaller(args, 1, ctx);
@@ -3242,7 +3242,7 @@ static Variable GetHasSpell(const std::vector<Variable> &args, const RoutineCont
     throw RoutineNotImplementedException("GetHasSpell");
 }
 
-static Variable OpenStore(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable OpenStore(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oStore = getObject(args, 0, ctx);
     auto oPC = getObject(args, 1, ctx);
@@ -3255,7 +3255,7 @@ static Variable OpenStore(const std::vector<Variable> &args, const RoutineContex
     throw RoutineNotImplementedException("OpenStore");
 }
 
-static Variable GetFirstFactionMember(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFirstFactionMember(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oMemberOfFaction = getObject(args, 0, ctx);
     auto bPCOnly = getIntOrElse(args, 1, 1);
@@ -3266,7 +3266,7 @@ static Variable GetFirstFactionMember(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("GetFirstFactionMember");
 }
 
-static Variable GetNextFactionMember(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetNextFactionMember(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oMemberOfFaction = getObject(args, 0, ctx);
     auto bPCOnly = getIntOrElse(args, 1, 1);
@@ -3277,7 +3277,7 @@ static Variable GetNextFactionMember(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("GetNextFactionMember");
 }
 
-static Variable GetJournalQuestExperience(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetJournalQuestExperience(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto szPlotID = getString(args, 0);
 
@@ -3287,7 +3287,7 @@ static Variable GetJournalQuestExperience(const std::vector<Variable> &args, con
     throw RoutineNotImplementedException("GetJournalQuestExperience");
 }
 
-static Variable JumpToObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable JumpToObject(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oToJumpTo = getObject(args, 0, ctx);
     auto nWalkStraightLineToPoint = getIntOrElse(args, 1, 1);
@@ -3301,7 +3301,7 @@ static Variable JumpToObject(const std::vector<Variable> &args, const RoutineCon
     return Variable::ofNull();
 }
 
-static Variable SetMapPinEnabled(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetMapPinEnabled(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oMapPin = getObject(args, 0, ctx);
     auto nEnabled = getInt(args, 1);
@@ -3312,7 +3312,7 @@ static Variable SetMapPinEnabled(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("SetMapPinEnabled");
 }
 
-static Variable PopUpGUIPanel(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable PopUpGUIPanel(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oPC = getObject(args, 0, ctx);
     auto nGUIPanel = getInt(args, 1);
@@ -3323,7 +3323,7 @@ static Variable PopUpGUIPanel(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("PopUpGUIPanel");
 }
 
-static Variable AddMultiClass(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AddMultiClass(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nClassType = getInt(args, 0);
     auto oSource = getObject(args, 1, ctx);
@@ -3334,7 +3334,7 @@ static Variable AddMultiClass(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("AddMultiClass");
 }
 
-static Variable GetIsLinkImmune(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsLinkImmune(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
     auto eEffect = getEffect(args, 1);
@@ -3345,7 +3345,7 @@ static Variable GetIsLinkImmune(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("GetIsLinkImmune");
 }
 
-static Variable GiveXPToCreature(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GiveXPToCreature(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto nXpAmount = getInt(args, 1);
@@ -3358,7 +3358,7 @@ static Variable GiveXPToCreature(const std::vector<Variable> &args, const Routin
     return Variable::ofNull();
 }
 
-static Variable SetXP(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetXP(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto nXpAmount = getInt(args, 1);
@@ -3371,7 +3371,7 @@ static Variable SetXP(const std::vector<Variable> &args, const RoutineContext &c
     return Variable::ofNull();
 }
 
-static Variable GetXP(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetXP(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -3382,7 +3382,7 @@ static Variable GetXP(const std::vector<Variable> &args, const RoutineContext &c
     return Variable::ofInt(creature->xp());
 }
 
-static Variable IntToHexString(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable IntToHexString(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nInteger = getInt(args, 0);
 
@@ -3392,7 +3392,7 @@ static Variable IntToHexString(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("IntToHexString");
 }
 
-static Variable GetBaseItemType(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetBaseItemType(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
 
@@ -3403,7 +3403,7 @@ static Variable GetBaseItemType(const std::vector<Variable> &args, const Routine
     return Variable::ofInt(item->baseItemType());
 }
 
-static Variable GetItemHasItemProperty(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetItemHasItemProperty(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
     auto nProperty = getInt(args, 1);
@@ -3414,7 +3414,7 @@ static Variable GetItemHasItemProperty(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("GetItemHasItemProperty");
 }
 
-static Variable GetItemACValue(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetItemACValue(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
 
@@ -3424,7 +3424,7 @@ static Variable GetItemACValue(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("GetItemACValue");
 }
 
-static Variable ExploreAreaForPlayer(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ExploreAreaForPlayer(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
     auto oPlayer = getObject(args, 1, ctx);
@@ -3435,27 +3435,27 @@ static Variable ExploreAreaForPlayer(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("ExploreAreaForPlayer");
 }
 
-static Variable GetIsDay(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsDay(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetIsDay");
 }
 
-static Variable GetIsNight(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsNight(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetIsNight");
 }
 
-static Variable GetIsDawn(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsDawn(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetIsDawn");
 }
 
-static Variable GetIsDusk(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsDusk(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetIsDusk");
 }
 
-static Variable GetIsEncounterCreature(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsEncounterCreature(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObjectOrCaller(args, 0, ctx);
 
@@ -3465,17 +3465,17 @@ static Variable GetIsEncounterCreature(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("GetIsEncounterCreature");
 }
 
-static Variable GetLastPlayerDying(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastPlayerDying(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLastPlayerDying");
 }
 
-static Variable GetStartingLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetStartingLocation(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetStartingLocation");
 }
 
-static Variable ChangeToStandardFaction(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ChangeToStandardFaction(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreatureToChange = getObject(args, 0, ctx);
     auto nStandardFaction = getInt(args, 1);
@@ -3486,7 +3486,7 @@ static Variable ChangeToStandardFaction(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("ChangeToStandardFaction");
 }
 
-static Variable SoundObjectPlay(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SoundObjectPlay(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oSound = getObject(args, 0, ctx);
 
@@ -3498,7 +3498,7 @@ static Variable SoundObjectPlay(const std::vector<Variable> &args, const Routine
     return Variable::ofNull();
 }
 
-static Variable SoundObjectStop(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SoundObjectStop(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oSound = getObject(args, 0, ctx);
 
@@ -3510,7 +3510,7 @@ static Variable SoundObjectStop(const std::vector<Variable> &args, const Routine
     return Variable::ofNull();
 }
 
-static Variable SoundObjectSetVolume(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SoundObjectSetVolume(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oSound = getObject(args, 0, ctx);
     auto nVolume = getInt(args, 1);
@@ -3521,7 +3521,7 @@ static Variable SoundObjectSetVolume(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("SoundObjectSetVolume");
 }
 
-static Variable SoundObjectSetPosition(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SoundObjectSetPosition(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oSound = getObject(args, 0, ctx);
     auto vPosition = getVector(args, 1);
@@ -3532,7 +3532,7 @@ static Variable SoundObjectSetPosition(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("SoundObjectSetPosition");
 }
 
-static Variable SpeakOneLinerConversation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SpeakOneLinerConversation(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sDialogResRef = getStringOrElse(args, 0, "");
     auto oTokenTarget = getObjectOrNull(args, 1, ctx);
@@ -3543,7 +3543,7 @@ static Variable SpeakOneLinerConversation(const std::vector<Variable> &args, con
     throw RoutineNotImplementedException("SpeakOneLinerConversation");
 }
 
-static Variable GetGold(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetGold(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObjectOrCaller(args, 0, ctx);
 
@@ -3554,12 +3554,12 @@ static Variable GetGold(const std::vector<Variable> &args, const RoutineContext
     return Variable::ofInt(creature->gold());
 }
 
-static Variable GetLastRespawnButtonPresser(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastRespawnButtonPresser(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLastRespawnButtonPresser");
 }
 
-static Variable SetLightsaberPowered(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetLightsaberPowered(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto bOverride = getInt(args, 1);
@@ -3572,7 +3572,7 @@ static Variable SetLightsaberPowered(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("SetLightsaberPowered");
 }
 
-static Variable GetIsWeaponEffective(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsWeaponEffective(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oVersus = getObjectOrNull(args, 0, ctx);
     auto bOffHand = getIntOrElse(args, 1, 0);
@@ -3583,12 +3583,12 @@ static Variable GetIsWeaponEffective(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("GetIsWeaponEffective");
 }
 
-static Variable GetLastSpellHarmful(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastSpellHarmful(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLastSpellHarmful");
 }
 
-static Variable EventActivateItem(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EventActivateItem(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
     auto lTarget = getLocationArgument(args, 1);
@@ -3600,7 +3600,7 @@ static Variable EventActivateItem(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("EventActivateItem");
 }
 
-static Variable MusicBackgroundPlay(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable MusicBackgroundPlay(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
 
@@ -3610,7 +3610,7 @@ static Variable MusicBackgroundPlay(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("MusicBackgroundPlay");
 }
 
-static Variable MusicBackgroundStop(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable MusicBackgroundStop(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
 
@@ -3620,7 +3620,7 @@ static Variable MusicBackgroundStop(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("MusicBackgroundStop");
 }
 
-static Variable MusicBackgroundSetDelay(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable MusicBackgroundSetDelay(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
     auto nDelay = getInt(args, 1);
@@ -3631,7 +3631,7 @@ static Variable MusicBackgroundSetDelay(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("MusicBackgroundSetDelay");
 }
 
-static Variable MusicBackgroundChangeDay(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable MusicBackgroundChangeDay(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
     auto nTrack = getInt(args, 1);
@@ -3643,7 +3643,7 @@ static Variable MusicBackgroundChangeDay(const std::vector<Variable> &args, cons
     throw RoutineNotImplementedException("MusicBackgroundChangeDay");
 }
 
-static Variable MusicBackgroundChangeNight(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable MusicBackgroundChangeNight(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
     auto nTrack = getInt(args, 1);
@@ -3655,7 +3655,7 @@ static Variable MusicBackgroundChangeNight(const std::vector<Variable> &args, co
     throw RoutineNotImplementedException("MusicBackgroundChangeNight");
 }
 
-static Variable MusicBattlePlay(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable MusicBattlePlay(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
 
@@ -3665,7 +3665,7 @@ static Variable MusicBattlePlay(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("MusicBattlePlay");
 }
 
-static Variable MusicBattleStop(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable MusicBattleStop(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
 
@@ -3675,7 +3675,7 @@ static Variable MusicBattleStop(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("MusicBattleStop");
 }
 
-static Variable MusicBattleChange(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable MusicBattleChange(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
     auto nTrack = getInt(args, 1);
@@ -3686,7 +3686,7 @@ static Variable MusicBattleChange(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("MusicBattleChange");
 }
 
-static Variable AmbientSoundPlay(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AmbientSoundPlay(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
 
@@ -3696,7 +3696,7 @@ static Variable AmbientSoundPlay(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("AmbientSoundPlay");
 }
 
-static Variable AmbientSoundStop(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AmbientSoundStop(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
 
@@ -3706,7 +3706,7 @@ static Variable AmbientSoundStop(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("AmbientSoundStop");
 }
 
-static Variable AmbientSoundChangeDay(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AmbientSoundChangeDay(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
     auto nTrack = getInt(args, 1);
@@ -3717,7 +3717,7 @@ static Variable AmbientSoundChangeDay(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("AmbientSoundChangeDay");
 }
 
-static Variable AmbientSoundChangeNight(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AmbientSoundChangeNight(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
     auto nTrack = getInt(args, 1);
@@ -3728,37 +3728,37 @@ static Variable AmbientSoundChangeNight(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("AmbientSoundChangeNight");
 }
 
-static Variable GetLastKiller(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastKiller(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLastKiller");
 }
 
-static Variable GetSpellCastItem(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetSpellCastItem(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetSpellCastItem");
 }
 
-static Variable GetItemActivated(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetItemActivated(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetItemActivated");
 }
 
-static Variable GetItemActivator(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetItemActivator(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetItemActivator");
 }
 
-static Variable GetItemActivatedTargetLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetItemActivatedTargetLocation(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetItemActivatedTargetLocation");
 }
 
-static Variable GetItemActivatedTarget(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetItemActivatedTarget(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetItemActivatedTarget");
 }
 
-static Variable GetIsOpen(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsOpen(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -3768,7 +3768,7 @@ static Variable GetIsOpen(const std::vector<Variable> &args, const RoutineContex
     return Variable::ofInt(static_cast<int>(oObject->isOpen()));
 }
 
-static Variable TakeGoldFromCreature(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable TakeGoldFromCreature(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nAmount = getInt(args, 0);
     auto oCreatureToTakeFrom = getObject(args, 1, ctx);
@@ -3789,7 +3789,7 @@ static Variable TakeGoldFromCreature(const std::vector<Variable> &args, const Ro
     return Variable::ofNull();
 }
 
-static Variable GetIsInConversation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsInConversation(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -3799,7 +3799,7 @@ static Variable GetIsInConversation(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("GetIsInConversation");
 }
 
-static Variable GetPlotFlag(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetPlotFlag(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObjectOrCaller(args, 0, ctx);
 
@@ -3810,7 +3810,7 @@ static Variable GetPlotFlag(const std::vector<Variable> &args, const RoutineCont
     return Variable::ofInt(static_cast<int>(plotFlag));
 }
 
-static Variable SetPlotFlag(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetPlotFlag(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
     auto nPlotFlag = getInt(args, 1);
@@ -3823,7 +3823,7 @@ static Variable SetPlotFlag(const std::vector<Variable> &args, const RoutineCont
     return Variable::ofNull();
 }
 
-static Variable SetDialogPlaceableCamera(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetDialogPlaceableCamera(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nCameraId = getInt(args, 0);
 
@@ -3833,18 +3833,18 @@ static Variable SetDialogPlaceableCamera(const std::vector<Variable> &args, cons
     throw RoutineNotImplementedException("SetDialogPlaceableCamera");
 }
 
-static Variable GetSoloMode(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetSoloMode(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     bool solo = ctx.game.party().isSoloMode();
     return Variable::ofInt(static_cast<int>(solo));
 }
 
-static Variable GetMaxStealthXP(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetMaxStealthXP(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetMaxStealthXP");
 }
 
-static Variable SetMaxStealthXP(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetMaxStealthXP(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nMax = getInt(args, 0);
 
@@ -3855,13 +3855,13 @@ static Variable SetMaxStealthXP(const std::vector<Variable> &args, const Routine
     return Variable::ofNull();
 }
 
-static Variable GetCurrentStealthXP(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetCurrentStealthXP(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     int xp = ctx.game.module()->area()->currentStealthXP();
     return Variable::ofInt(xp);
 }
 
-static Variable GetNumStackedItems(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetNumStackedItems(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
 
@@ -3871,12 +3871,12 @@ static Variable GetNumStackedItems(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("GetNumStackedItems");
 }
 
-static Variable SurrenderToEnemies(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SurrenderToEnemies(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SurrenderToEnemies");
 }
 
-static Variable SetCurrentStealthXP(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetCurrentStealthXP(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nCurrent = getInt(args, 0);
 
@@ -3887,7 +3887,7 @@ static Variable SetCurrentStealthXP(const std::vector<Variable> &args, const Rou
     return Variable::ofNull();
 }
 
-static Variable GetCreatureSize(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetCreatureSize(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -3897,7 +3897,7 @@ static Variable GetCreatureSize(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("GetCreatureSize");
 }
 
-static Variable AwardStealthXP(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AwardStealthXP(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
 
@@ -3907,12 +3907,12 @@ static Variable AwardStealthXP(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("AwardStealthXP");
 }
 
-static Variable GetStealthXPEnabled(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetStealthXPEnabled(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetStealthXPEnabled");
 }
 
-static Variable SetStealthXPEnabled(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetStealthXPEnabled(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto bEnabled = getInt(args, 0);
 
@@ -3924,7 +3924,7 @@ static Variable SetStealthXPEnabled(const std::vector<Variable> &args, const Rou
     return Variable::ofNull();
 }
 
-static Variable GetLastTrapDetected(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastTrapDetected(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObjectOrCaller(args, 0, ctx);
 
@@ -3934,7 +3934,7 @@ static Variable GetLastTrapDetected(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("GetLastTrapDetected");
 }
 
-static Variable GetNearestTrapToObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetNearestTrapToObject(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObjectOrCaller(args, 0, ctx);
     auto nTrapDetected = getIntOrElse(args, 1, 1);
@@ -3945,12 +3945,12 @@ static Variable GetNearestTrapToObject(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("GetNearestTrapToObject");
 }
 
-static Variable GetAttemptedMovementTarget(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetAttemptedMovementTarget(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetAttemptedMovementTarget");
 }
 
-static Variable GetBlockingCreature(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetBlockingCreature(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObjectOrCaller(args, 0, ctx);
 
@@ -3960,7 +3960,7 @@ static Variable GetBlockingCreature(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("GetBlockingCreature");
 }
 
-static Variable GetFortitudeSavingThrow(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFortitudeSavingThrow(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
 
@@ -3970,7 +3970,7 @@ static Variable GetFortitudeSavingThrow(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("GetFortitudeSavingThrow");
 }
 
-static Variable GetWillSavingThrow(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetWillSavingThrow(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
 
@@ -3980,7 +3980,7 @@ static Variable GetWillSavingThrow(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("GetWillSavingThrow");
 }
 
-static Variable GetReflexSavingThrow(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetReflexSavingThrow(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
 
@@ -3990,7 +3990,7 @@ static Variable GetReflexSavingThrow(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("GetReflexSavingThrow");
 }
 
-static Variable GetChallengeRating(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetChallengeRating(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -4000,7 +4000,7 @@ static Variable GetChallengeRating(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("GetChallengeRating");
 }
 
-static Variable GetFoundEnemyCreature(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFoundEnemyCreature(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObjectOrCaller(args, 0, ctx);
 
@@ -4010,7 +4010,7 @@ static Variable GetFoundEnemyCreature(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("GetFoundEnemyCreature");
 }
 
-static Variable GetMovementRate(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetMovementRate(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -4020,7 +4020,7 @@ static Variable GetMovementRate(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("GetMovementRate");
 }
 
-static Variable GetSubRace(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetSubRace(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -4031,12 +4031,12 @@ static Variable GetSubRace(const std::vector<Variable> &args, const RoutineConte
     return Variable::ofInt(static_cast<int>(creature->subrace()));
 }
 
-static Variable GetStealthXPDecrement(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetStealthXPDecrement(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetStealthXPDecrement");
 }
 
-static Variable SetStealthXPDecrement(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetStealthXPDecrement(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nDecrement = getInt(args, 0);
 
@@ -4046,7 +4046,7 @@ static Variable SetStealthXPDecrement(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("SetStealthXPDecrement");
 }
 
-static Variable DuplicateHeadAppearance(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable DuplicateHeadAppearance(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oidCreatureToChange = getObject(args, 0, ctx);
     auto oidCreatureToMatch = getObject(args, 1, ctx);
@@ -4057,7 +4057,7 @@ static Variable DuplicateHeadAppearance(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("DuplicateHeadAppearance");
 }
 
-static Variable CutsceneAttack(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable CutsceneAttack(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
     auto nAnimation = getInt(args, 1);
@@ -4073,7 +4073,7 @@ static Variable CutsceneAttack(const std::vector<Variable> &args, const RoutineC
     return Variable::ofNull();
 }
 
-static Variable SetCameraMode(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetCameraMode(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oPlayer = getObject(args, 0, ctx);
     auto nCameraMode = getInt(args, 1);
@@ -4084,7 +4084,7 @@ static Variable SetCameraMode(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("SetCameraMode");
 }
 
-static Variable SetLockOrientationInDialog(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetLockOrientationInDialog(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto nValue = getInt(args, 1);
@@ -4095,7 +4095,7 @@ static Variable SetLockOrientationInDialog(const std::vector<Variable> &args, co
     throw RoutineNotImplementedException("SetLockOrientationInDialog");
 }
 
-static Variable SetLockHeadFollowInDialog(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetLockHeadFollowInDialog(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto nValue = getInt(args, 1);
@@ -4106,7 +4106,7 @@ static Variable SetLockHeadFollowInDialog(const std::vector<Variable> &args, con
     throw RoutineNotImplementedException("SetLockHeadFollowInDialog");
 }
 
-static Variable CutsceneMove(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable CutsceneMove(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto vPosition = getVector(args, 1);
@@ -4118,7 +4118,7 @@ static Variable CutsceneMove(const std::vector<Variable> &args, const RoutineCon
     throw RoutineNotImplementedException("CutsceneMove");
 }
 
-static Variable EnableVideoEffect(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EnableVideoEffect(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nEffectType = getInt(args, 0);
 
@@ -4128,7 +4128,7 @@ static Variable EnableVideoEffect(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("EnableVideoEffect");
 }
 
-static Variable StartNewModule(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable StartNewModule(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sModuleName = getString(args, 0);
     auto sWayPoint = getStringOrElse(args, 1, "");
@@ -4148,12 +4148,12 @@ static Variable StartNewModule(const std::vector<Variable> &args, const RoutineC
     return Variable::ofNull();
 }
 
-static Variable DisableVideoEffect(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable DisableVideoEffect(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("DisableVideoEffect");
 }
 
-static Variable GetWeaponRanged(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetWeaponRanged(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
 
@@ -4163,23 +4163,23 @@ static Variable GetWeaponRanged(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("GetWeaponRanged");
 }
 
-static Variable DoSinglePlayerAutoSave(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable DoSinglePlayerAutoSave(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("DoSinglePlayerAutoSave");
 }
 
-static Variable GetGameDifficulty(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetGameDifficulty(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetGameDifficulty");
 }
 
-static Variable GetUserActionsPending(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetUserActionsPending(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto caller = checkCreature(getCaller(ctx));
     return Variable::ofInt(static_cast<int>(caller->hasUserActionsPending()));
 }
 
-static Variable RevealMap(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable RevealMap(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto vPoint = getVectorOrElse(args, 0, glm::vec3(0.0f, 0.0f, 0.0f));
     auto nRadius = getIntOrElse(args, 1, -1);
@@ -4190,7 +4190,7 @@ static Variable RevealMap(const std::vector<Variable> &args, const RoutineContex
     throw RoutineNotImplementedException("RevealMap");
 }
 
-static Variable SetTutorialWindowsEnabled(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetTutorialWindowsEnabled(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto bEnabled = getInt(args, 0);
 
@@ -4200,7 +4200,7 @@ static Variable SetTutorialWindowsEnabled(const std::vector<Variable> &args, con
     throw RoutineNotImplementedException("SetTutorialWindowsEnabled");
 }
 
-static Variable ShowTutorialWindow(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ShowTutorialWindow(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nWindow = getInt(args, 0);
 
@@ -4210,7 +4210,7 @@ static Variable ShowTutorialWindow(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("ShowTutorialWindow");
 }
 
-static Variable StartCreditSequence(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable StartCreditSequence(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto bTransparentBackground = getInt(args, 0);
 
@@ -4220,12 +4220,12 @@ static Variable StartCreditSequence(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("StartCreditSequence");
 }
 
-static Variable IsCreditSequenceInProgress(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable IsCreditSequenceInProgress(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("IsCreditSequenceInProgress");
 }
 
-static Variable GetCurrentAction(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetCurrentAction(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObjectOrCaller(args, 0, ctx);
 
@@ -4236,12 +4236,12 @@ static Variable GetCurrentAction(const std::vector<Variable> &args, const Routin
     return Variable::ofInt(static_cast<int>(action ? action->type() : ActionType::QueueEmpty));
 }
 
-static Variable GetDifficultyModifier(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetDifficultyModifier(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetDifficultyModifier");
 }
 
-static Variable GetAppearanceType(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetAppearanceType(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -4251,7 +4251,7 @@ static Variable GetAppearanceType(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("GetAppearanceType");
 }
 
-static Variable FloatingTextStrRefOnCreature(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable FloatingTextStrRefOnCreature(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nStrRefToDisplay = getInt(args, 0);
     auto oCreatureToFloatAbove = getObject(args, 1, ctx);
@@ -4263,7 +4263,7 @@ static Variable FloatingTextStrRefOnCreature(const std::vector<Variable> &args,
     throw RoutineNotImplementedException("FloatingTextStrRefOnCreature");
 }
 
-static Variable FloatingTextStringOnCreature(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable FloatingTextStringOnCreature(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sStringToDisplay = getString(args, 0);
     auto oCreatureToFloatAbove = getObject(args, 1, ctx);
@@ -4275,7 +4275,7 @@ static Variable FloatingTextStringOnCreature(const std::vector<Variable> &args,
     throw RoutineNotImplementedException("FloatingTextStringOnCreature");
 }
 
-static Variable GetTrapDisarmable(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetTrapDisarmable(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTrapObject = getObject(args, 0, ctx);
 
@@ -4285,7 +4285,7 @@ static Variable GetTrapDisarmable(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("GetTrapDisarmable");
 }
 
-static Variable GetTrapDetectable(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetTrapDetectable(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTrapObject = getObject(args, 0, ctx);
 
@@ -4295,7 +4295,7 @@ static Variable GetTrapDetectable(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("GetTrapDetectable");
 }
 
-static Variable GetTrapDetectedBy(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetTrapDetectedBy(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTrapObject = getObject(args, 0, ctx);
     auto oCreature = getObject(args, 1, ctx);
@@ -4306,7 +4306,7 @@ static Variable GetTrapDetectedBy(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("GetTrapDetectedBy");
 }
 
-static Variable GetTrapFlagged(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetTrapFlagged(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTrapObject = getObject(args, 0, ctx);
 
@@ -4316,7 +4316,7 @@ static Variable GetTrapFlagged(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("GetTrapFlagged");
 }
 
-static Variable GetTrapBaseType(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetTrapBaseType(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTrapObject = getObject(args, 0, ctx);
 
@@ -4326,7 +4326,7 @@ static Variable GetTrapBaseType(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("GetTrapBaseType");
 }
 
-static Variable GetTrapOneShot(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetTrapOneShot(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTrapObject = getObject(args, 0, ctx);
 
@@ -4336,7 +4336,7 @@ static Variable GetTrapOneShot(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("GetTrapOneShot");
 }
 
-static Variable GetTrapCreator(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetTrapCreator(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTrapObject = getObject(args, 0, ctx);
 
@@ -4346,7 +4346,7 @@ static Variable GetTrapCreator(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("GetTrapCreator");
 }
 
-static Variable GetTrapKeyTag(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetTrapKeyTag(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTrapObject = getObject(args, 0, ctx);
 
@@ -4356,7 +4356,7 @@ static Variable GetTrapKeyTag(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("GetTrapKeyTag");
 }
 
-static Variable GetTrapDisarmDC(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetTrapDisarmDC(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTrapObject = getObject(args, 0, ctx);
 
@@ -4366,7 +4366,7 @@ static Variable GetTrapDisarmDC(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("GetTrapDisarmDC");
 }
 
-static Variable GetTrapDetectDC(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetTrapDetectDC(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTrapObject = getObject(args, 0, ctx);
 
@@ -4376,7 +4376,7 @@ static Variable GetTrapDetectDC(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("GetTrapDetectDC");
 }
 
-static Variable GetLockKeyRequired(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLockKeyRequired(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -4386,7 +4386,7 @@ static Variable GetLockKeyRequired(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("GetLockKeyRequired");
 }
 
-static Variable GetLockKeyTag(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLockKeyTag(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -4396,7 +4396,7 @@ static Variable GetLockKeyTag(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("GetLockKeyTag");
 }
 
-static Variable GetLockLockable(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLockLockable(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -4406,7 +4406,7 @@ static Variable GetLockLockable(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("GetLockLockable");
 }
 
-static Variable GetLockUnlockDC(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLockUnlockDC(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -4416,7 +4416,7 @@ static Variable GetLockUnlockDC(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("GetLockUnlockDC");
 }
 
-static Variable GetLockLockDC(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLockLockDC(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -4426,12 +4426,12 @@ static Variable GetLockLockDC(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("GetLockLockDC");
 }
 
-static Variable GetPCLevellingUp(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetPCLevellingUp(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetPCLevellingUp");
 }
 
-static Variable GetHasFeatEffect(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetHasFeatEffect(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nFeat = getInt(args, 0);
     auto oObject = getObjectOrCaller(args, 1, ctx);
@@ -4442,7 +4442,7 @@ static Variable GetHasFeatEffect(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("GetHasFeatEffect");
 }
 
-static Variable SetPlaceableIllumination(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetPlaceableIllumination(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oPlaceable = getObjectOrCaller(args, 0, ctx);
     auto bIlluminate = getIntOrElse(args, 1, 1);
@@ -4453,7 +4453,7 @@ static Variable SetPlaceableIllumination(const std::vector<Variable> &args, cons
     throw RoutineNotImplementedException("SetPlaceableIllumination");
 }
 
-static Variable GetPlaceableIllumination(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetPlaceableIllumination(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oPlaceable = getObjectOrCaller(args, 0, ctx);
 
@@ -4463,7 +4463,7 @@ static Variable GetPlaceableIllumination(const std::vector<Variable> &args, cons
     throw RoutineNotImplementedException("GetPlaceableIllumination");
 }
 
-static Variable GetIsPlaceableObjectActionPossible(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsPlaceableObjectActionPossible(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oPlaceable = getObject(args, 0, ctx);
     auto nPlaceableAction = getInt(args, 1);
@@ -4474,7 +4474,7 @@ static Variable GetIsPlaceableObjectActionPossible(const std::vector<Variable> &
     throw RoutineNotImplementedException("GetIsPlaceableObjectActionPossible");
 }
 
-static Variable DoPlaceableObjectAction(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable DoPlaceableObjectAction(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oPlaceable = getObject(args, 0, ctx);
     auto nPlaceableAction = getInt(args, 1);
@@ -4485,18 +4485,18 @@ static Variable DoPlaceableObjectAction(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("DoPlaceableObjectAction");
 }
 
-static Variable GetFirstPC(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFirstPC(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto player = ctx.game.party().player();
     return Variable::ofObject(getObjectIdOrInvalid(player));
 }
 
-static Variable GetNextPC(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetNextPC(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     return Variable::ofObject(kObjectInvalid);
 }
 
-static Variable SetTrapDetectedBy(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetTrapDetectedBy(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTrap = getObject(args, 0, ctx);
     auto oDetector = getObject(args, 1, ctx);
@@ -4507,7 +4507,7 @@ static Variable SetTrapDetectedBy(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("SetTrapDetectedBy");
 }
 
-static Variable GetIsTrapped(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsTrapped(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -4517,7 +4517,7 @@ static Variable GetIsTrapped(const std::vector<Variable> &args, const RoutineCon
     throw RoutineNotImplementedException("GetIsTrapped");
 }
 
-static Variable SetEffectIcon(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetEffectIcon(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto eEffect = getEffect(args, 0);
     auto nIcon = getInt(args, 1);
@@ -4528,7 +4528,7 @@ static Variable SetEffectIcon(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("SetEffectIcon");
 }
 
-static Variable FaceObjectAwayFromObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable FaceObjectAwayFromObject(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oFacer = getObject(args, 0, ctx);
     auto oObjectToFaceAwayFrom = getObject(args, 1, ctx);
@@ -4540,7 +4540,7 @@ static Variable FaceObjectAwayFromObject(const std::vector<Variable> &args, cons
     return Variable::ofNull();
 }
 
-static Variable PopUpDeathGUIPanel(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable PopUpDeathGUIPanel(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oPC = getObject(args, 0, ctx);
     auto bRespawnButtonEnabled = getIntOrElse(args, 1, 1);
@@ -4554,7 +4554,7 @@ static Variable PopUpDeathGUIPanel(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("PopUpDeathGUIPanel");
 }
 
-static Variable SetTrapDisabled(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetTrapDisabled(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTrap = getObject(args, 0, ctx);
 
@@ -4564,7 +4564,7 @@ static Variable SetTrapDisabled(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("SetTrapDisabled");
 }
 
-static Variable GetLastHostileActor(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastHostileActor(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oVictim = getObjectOrCaller(args, 0, ctx);
 
@@ -4574,12 +4574,12 @@ static Variable GetLastHostileActor(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("GetLastHostileActor");
 }
 
-static Variable ExportAllCharacters(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ExportAllCharacters(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("ExportAllCharacters");
 }
 
-static Variable MusicBackgroundGetDayTrack(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable MusicBackgroundGetDayTrack(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
 
@@ -4589,7 +4589,7 @@ static Variable MusicBackgroundGetDayTrack(const std::vector<Variable> &args, co
     throw RoutineNotImplementedException("MusicBackgroundGetDayTrack");
 }
 
-static Variable MusicBackgroundGetNightTrack(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable MusicBackgroundGetNightTrack(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
 
@@ -4599,7 +4599,7 @@ static Variable MusicBackgroundGetNightTrack(const std::vector<Variable> &args,
     throw RoutineNotImplementedException("MusicBackgroundGetNightTrack");
 }
 
-static Variable WriteTimestampedLogEntry(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable WriteTimestampedLogEntry(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sLogEntry = getString(args, 0);
 
@@ -4609,12 +4609,12 @@ static Variable WriteTimestampedLogEntry(const std::vector<Variable> &args, cons
     throw RoutineNotImplementedException("WriteTimestampedLogEntry");
 }
 
-static Variable GetModuleName(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetModuleName(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetModuleName");
 }
 
-static Variable GetFactionLeader(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFactionLeader(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oMemberOfFaction = getObject(args, 0, ctx);
 
@@ -4624,7 +4624,7 @@ static Variable GetFactionLeader(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("GetFactionLeader");
 }
 
-static Variable EndGame(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EndGame(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nShowEndGameGui = getIntOrElse(args, 0, 1);
 
@@ -4634,12 +4634,12 @@ static Variable EndGame(const std::vector<Variable> &args, const RoutineContext
     throw RoutineNotImplementedException("EndGame");
 }
 
-static Variable GetRunScriptVar(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetRunScriptVar(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     return Variable::ofInt(ctx.execution.scriptVar);
 }
 
-static Variable GetCreatureMovmentType(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetCreatureMovmentType(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oidCreature = getObject(args, 0, ctx);
 
@@ -4649,7 +4649,7 @@ static Variable GetCreatureMovmentType(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("GetCreatureMovmentType");
 }
 
-static Variable AmbientSoundSetDayVolume(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AmbientSoundSetDayVolume(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
     auto nVolume = getInt(args, 1);
@@ -4660,7 +4660,7 @@ static Variable AmbientSoundSetDayVolume(const std::vector<Variable> &args, cons
     throw RoutineNotImplementedException("AmbientSoundSetDayVolume");
 }
 
-static Variable AmbientSoundSetNightVolume(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AmbientSoundSetNightVolume(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
     auto nVolume = getInt(args, 1);
@@ -4671,7 +4671,7 @@ static Variable AmbientSoundSetNightVolume(const std::vector<Variable> &args, co
     throw RoutineNotImplementedException("AmbientSoundSetNightVolume");
 }
 
-static Variable MusicBackgroundGetBattleTrack(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable MusicBackgroundGetBattleTrack(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
 
@@ -4681,7 +4681,7 @@ static Variable MusicBackgroundGetBattleTrack(const std::vector<Variable> &args,
     throw RoutineNotImplementedException("MusicBackgroundGetBattleTrack");
 }
 
-static Variable GetHasInventory(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetHasInventory(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -4691,7 +4691,7 @@ static Variable GetHasInventory(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("GetHasInventory");
 }
 
-static Variable GetStrRefSoundDuration(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetStrRefSoundDuration(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nStrRef = getInt(args, 0);
 
@@ -4701,7 +4701,7 @@ static Variable GetStrRefSoundDuration(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("GetStrRefSoundDuration");
 }
 
-static Variable AddToParty(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AddToParty(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oPC = getObject(args, 0, ctx);
     auto oPartyLeader = getObject(args, 1, ctx);
@@ -4712,7 +4712,7 @@ static Variable AddToParty(const std::vector<Variable> &args, const RoutineConte
     throw RoutineNotImplementedException("AddToParty");
 }
 
-static Variable RemoveFromParty(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable RemoveFromParty(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oPC = getObject(args, 0, ctx);
 
@@ -4722,7 +4722,7 @@ static Variable RemoveFromParty(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("RemoveFromParty");
 }
 
-static Variable AddPartyMember(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AddPartyMember(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
     auto oCreature = getObject(args, 1, ctx);
@@ -4735,7 +4735,7 @@ static Variable AddPartyMember(const std::vector<Variable> &args, const RoutineC
     return Variable::ofInt(static_cast<int>(added));
 }
 
-static Variable RemovePartyMember(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable RemovePartyMember(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
 
@@ -4753,7 +4753,7 @@ static Variable RemovePartyMember(const std::vector<Variable> &args, const Routi
     return Variable::ofInt(static_cast<int>(removed));
 }
 
-static Variable IsObjectPartyMember(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable IsObjectPartyMember(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -4765,7 +4765,7 @@ static Variable IsObjectPartyMember(const std::vector<Variable> &args, const Rou
     return Variable::ofInt(static_cast<int>(member));
 }
 
-static Variable GetPartyMemberByIndex(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetPartyMemberByIndex(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nIndex = getInt(args, 0);
 
@@ -4776,7 +4776,7 @@ static Variable GetPartyMemberByIndex(const std::vector<Variable> &args, const R
     return Variable::ofObject(getObjectIdOrInvalid(member));
 }
 
-static Variable GetGlobalBoolean(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetGlobalBoolean(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sIdentifier = getString(args, 0);
 
@@ -4787,7 +4787,7 @@ static Variable GetGlobalBoolean(const std::vector<Variable> &args, const Routin
     return Variable::ofInt(static_cast<int>(value));
 }
 
-static Variable SetGlobalBoolean(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetGlobalBoolean(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sIdentifier = getString(args, 0);
     auto nValue = getInt(args, 1);
@@ -4799,7 +4799,7 @@ static Variable SetGlobalBoolean(const std::vector<Variable> &args, const Routin
     return Variable::ofNull();
 }
 
-static Variable GetGlobalNumber(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetGlobalNumber(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sIdentifier = getString(args, 0);
 
@@ -4810,7 +4810,7 @@ static Variable GetGlobalNumber(const std::vector<Variable> &args, const Routine
     return Variable::ofInt(value);
 }
 
-static Variable SetGlobalNumber(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetGlobalNumber(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sIdentifier = getString(args, 0);
     auto nValue = getInt(args, 1);
@@ -4822,7 +4822,7 @@ static Variable SetGlobalNumber(const std::vector<Variable> &args, const Routine
     return Variable::ofNull();
 }
 
-static Variable AurPostString(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AurPostString(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sString = getString(args, 0);
     auto nX = getInt(args, 1);
@@ -4835,7 +4835,7 @@ static Variable AurPostString(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("AurPostString");
 }
 
-static Variable AddJournalWorldEntry(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AddJournalWorldEntry(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nIndex = getInt(args, 0);
     auto szEntry = getString(args, 1);
@@ -4847,7 +4847,7 @@ static Variable AddJournalWorldEntry(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("AddJournalWorldEntry");
 }
 
-static Variable AddJournalWorldEntryStrref(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AddJournalWorldEntryStrref(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto strref = getInt(args, 0);
     auto strrefTitle = getInt(args, 1);
@@ -4858,7 +4858,7 @@ static Variable AddJournalWorldEntryStrref(const std::vector<Variable> &args, co
     throw RoutineNotImplementedException("AddJournalWorldEntryStrref");
 }
 
-static Variable BarkString(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable BarkString(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto strRef = getInt(args, 1);
@@ -4871,12 +4871,12 @@ static Variable BarkString(const std::vector<Variable> &args, const RoutineConte
     throw RoutineNotImplementedException("BarkString");
 }
 
-static Variable DeleteJournalWorldAllEntries(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable DeleteJournalWorldAllEntries(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("DeleteJournalWorldAllEntries");
 }
 
-static Variable DeleteJournalWorldEntry(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable DeleteJournalWorldEntry(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nIndex = getInt(args, 0);
 
@@ -4886,7 +4886,7 @@ static Variable DeleteJournalWorldEntry(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("DeleteJournalWorldEntry");
 }
 
-static Variable DeleteJournalWorldEntryStrref(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable DeleteJournalWorldEntryStrref(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto strref = getInt(args, 0);
 
@@ -4896,7 +4896,7 @@ static Variable DeleteJournalWorldEntryStrref(const std::vector<Variable> &args,
     throw RoutineNotImplementedException("DeleteJournalWorldEntryStrref");
 }
 
-static Variable PlayVisualAreaEffect(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable PlayVisualAreaEffect(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nEffectID = getInt(args, 0);
     auto lTarget = getLocationArgument(args, 1);
@@ -4907,7 +4907,7 @@ static Variable PlayVisualAreaEffect(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("PlayVisualAreaEffect");
 }
 
-static Variable SetJournalQuestEntryPicture(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetJournalQuestEntryPicture(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto szPlotID = getString(args, 0);
     auto oObject = getObject(args, 1, ctx);
@@ -4921,7 +4921,7 @@ static Variable SetJournalQuestEntryPicture(const std::vector<Variable> &args, c
     throw RoutineNotImplementedException("SetJournalQuestEntryPicture");
 }
 
-static Variable GetLocalBoolean(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLocalBoolean(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto nIndex = getInt(args, 1);
@@ -4933,7 +4933,7 @@ static Variable GetLocalBoolean(const std::vector<Variable> &args, const Routine
     return Variable::ofInt(static_cast<int>(value));
 }
 
-static Variable SetLocalBoolean(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetLocalBoolean(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto nIndex = getInt(args, 1);
@@ -4946,7 +4946,7 @@ static Variable SetLocalBoolean(const std::vector<Variable> &args, const Routine
     return Variable::ofNull();
 }
 
-static Variable GetLocalNumber(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLocalNumber(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto nIndex = getInt(args, 1);
@@ -4957,7 +4957,7 @@ static Variable GetLocalNumber(const std::vector<Variable> &args, const RoutineC
     return Variable::ofInt(oObject->getLocalNumber(nIndex));
 }
 
-static Variable SetLocalNumber(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetLocalNumber(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto nIndex = getInt(args, 1);
@@ -4970,7 +4970,7 @@ static Variable SetLocalNumber(const std::vector<Variable> &args, const RoutineC
     return Variable::ofNull();
 }
 
-static Variable SoundObjectGetPitchVariance(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SoundObjectGetPitchVariance(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oSound = getObject(args, 0, ctx);
 
@@ -4980,7 +4980,7 @@ static Variable SoundObjectGetPitchVariance(const std::vector<Variable> &args, c
     throw RoutineNotImplementedException("SoundObjectGetPitchVariance");
 }
 
-static Variable SoundObjectSetPitchVariance(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SoundObjectSetPitchVariance(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oSound = getObject(args, 0, ctx);
     auto fVariance = getFloat(args, 1);
@@ -4991,7 +4991,7 @@ static Variable SoundObjectSetPitchVariance(const std::vector<Variable> &args, c
     throw RoutineNotImplementedException("SoundObjectSetPitchVariance");
 }
 
-static Variable SoundObjectGetVolume(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SoundObjectGetVolume(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oSound = getObject(args, 0, ctx);
 
@@ -5001,7 +5001,7 @@ static Variable SoundObjectGetVolume(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("SoundObjectGetVolume");
 }
 
-static Variable GetGlobalLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetGlobalLocation(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sIdentifier = getString(args, 0);
 
@@ -5011,7 +5011,7 @@ static Variable GetGlobalLocation(const std::vector<Variable> &args, const Routi
     return Variable::ofLocation(ctx.game.getGlobalLocation(sIdentifier));
 }
 
-static Variable SetGlobalLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetGlobalLocation(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sIdentifier = getString(args, 0);
     auto lValue = getLocationArgument(args, 1);
@@ -5023,7 +5023,7 @@ static Variable SetGlobalLocation(const std::vector<Variable> &args, const Routi
     return Variable::ofNull();
 }
 
-static Variable AddAvailableNPCByObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AddAvailableNPCByObject(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
     auto oCreature = getObject(args, 1, ctx);
@@ -5034,7 +5034,7 @@ static Variable AddAvailableNPCByObject(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("AddAvailableNPCByObject");
 }
 
-static Variable RemoveAvailableNPC(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable RemoveAvailableNPC(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
 
@@ -5045,7 +5045,7 @@ static Variable RemoveAvailableNPC(const std::vector<Variable> &args, const Rout
     return Variable::ofInt(static_cast<int>(removed));
 }
 
-static Variable IsAvailableCreature(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable IsAvailableCreature(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
 
@@ -5056,7 +5056,7 @@ static Variable IsAvailableCreature(const std::vector<Variable> &args, const Rou
     return Variable::ofInt(static_cast<int>(available));
 }
 
-static Variable AddAvailableNPCByTemplate(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AddAvailableNPCByTemplate(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
     auto sTemplate = getString(args, 1);
@@ -5069,7 +5069,7 @@ static Variable AddAvailableNPCByTemplate(const std::vector<Variable> &args, con
     return Variable::ofInt(static_cast<int>(added));
 }
 
-static Variable SpawnAvailableNPC(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SpawnAvailableNPC(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
     auto lPosition = getLocationArgument(args, 1);
@@ -5080,7 +5080,7 @@ static Variable SpawnAvailableNPC(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("SpawnAvailableNPC");
 }
 
-static Variable IsNPCPartyMember(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable IsNPCPartyMember(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
 
@@ -5091,17 +5091,17 @@ static Variable IsNPCPartyMember(const std::vector<Variable> &args, const Routin
     return Variable::ofInt(static_cast<int>(member));
 }
 
-static Variable GetIsConversationActive(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsConversationActive(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetIsConversationActive");
 }
 
-static Variable GetPartyAIStyle(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetPartyAIStyle(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetPartyAIStyle");
 }
 
-static Variable GetNPCAIStyle(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetNPCAIStyle(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -5112,7 +5112,7 @@ static Variable GetNPCAIStyle(const std::vector<Variable> &args, const RoutineCo
     return Variable::ofInt(static_cast<int>(creature->aiStyle()));
 }
 
-static Variable SetPartyAIStyle(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetPartyAIStyle(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nStyle = getInt(args, 0);
 
@@ -5122,7 +5122,7 @@ static Variable SetPartyAIStyle(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("SetPartyAIStyle");
 }
 
-static Variable SetNPCAIStyle(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetNPCAIStyle(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto nStyle = getInt(args, 1);
@@ -5136,7 +5136,7 @@ static Variable SetNPCAIStyle(const std::vector<Variable> &args, const RoutineCo
     return Variable::ofNull();
 }
 
-static Variable SetNPCSelectability(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetNPCSelectability(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
     auto nSelectability = getInt(args, 1);
@@ -5147,7 +5147,7 @@ static Variable SetNPCSelectability(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("SetNPCSelectability");
 }
 
-static Variable GetNPCSelectability(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetNPCSelectability(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
 
@@ -5157,19 +5157,19 @@ static Variable GetNPCSelectability(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("GetNPCSelectability");
 }
 
-static Variable ClearAllEffects(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ClearAllEffects(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     auto caller = getCaller(ctx);
     caller->clearAllEffects();
     return Variable::ofNull();
 }
 
-static Variable GetLastConversation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastConversation(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLastConversation");
 }
 
-static Variable ShowPartySelectionGUI(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ShowPartySelectionGUI(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sExitScript = getStringOrElse(args, 0, "");
     auto nForceNPC1 = getIntOrElse(args, 1, -1);
@@ -5190,7 +5190,7 @@ static Variable ShowPartySelectionGUI(const std::vector<Variable> &args, const R
     return Variable::ofNull();
 }
 
-static Variable GetStandardFaction(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetStandardFaction(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -5201,7 +5201,7 @@ static Variable GetStandardFaction(const std::vector<Variable> &args, const Rout
     return Variable::ofInt(static_cast<int>(creature->faction()));
 }
 
-static Variable GivePlotXP(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GivePlotXP(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sPlotName = getString(args, 0);
     auto nPercentage = getInt(args, 1);
@@ -5212,7 +5212,7 @@ static Variable GivePlotXP(const std::vector<Variable> &args, const RoutineConte
     throw RoutineNotImplementedException("GivePlotXP");
 }
 
-static Variable GetMinOneHP(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetMinOneHP(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -5222,7 +5222,7 @@ static Variable GetMinOneHP(const std::vector<Variable> &args, const RoutineCont
     return Variable::ofInt(static_cast<int>(oObject->isMinOneHP()));
 }
 
-static Variable SetMinOneHP(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetMinOneHP(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto nMinOneHP = getInt(args, 1);
@@ -5235,7 +5235,7 @@ static Variable SetMinOneHP(const std::vector<Variable> &args, const RoutineCont
     return Variable::ofNull();
 }
 
-static Variable SetGlobalFadeIn(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetGlobalFadeIn(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto fWait = getFloatOrElse(args, 0, 0.0f);
     auto fLength = getFloatOrElse(args, 1, 0.0f);
@@ -5249,7 +5249,7 @@ static Variable SetGlobalFadeIn(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("SetGlobalFadeIn");
 }
 
-static Variable SetGlobalFadeOut(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetGlobalFadeOut(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto fWait = getFloatOrElse(args, 0, 0.0f);
     auto fLength = getFloatOrElse(args, 1, 0.0f);
@@ -5263,7 +5263,7 @@ static Variable SetGlobalFadeOut(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("SetGlobalFadeOut");
 }
 
-static Variable GetLastHostileTarget(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastHostileTarget(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oAttacker = getObjectOrCaller(args, 0, ctx);
 
@@ -5273,7 +5273,7 @@ static Variable GetLastHostileTarget(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("GetLastHostileTarget");
 }
 
-static Variable GetLastAttackObjectAction(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastAttackObjectAction(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oAttacker = getObjectOrCaller(args, 0, ctx);
 
@@ -5283,7 +5283,7 @@ static Variable GetLastAttackObjectAction(const std::vector<Variable> &args, con
     throw RoutineNotImplementedException("GetLastAttackObjectAction");
 }
 
-static Variable GetLastForcePowerUsed(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastForcePowerUsed(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oAttacker = getObjectOrCaller(args, 0, ctx);
 
@@ -5293,7 +5293,7 @@ static Variable GetLastForcePowerUsed(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("GetLastForcePowerUsed");
 }
 
-static Variable GetLastCombatFeatUsed(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastCombatFeatUsed(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oAttacker = getObjectOrCaller(args, 0, ctx);
 
@@ -5303,7 +5303,7 @@ static Variable GetLastCombatFeatUsed(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("GetLastCombatFeatUsed");
 }
 
-static Variable GetLastAttackResult(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastAttackResult(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oAttacker = getObjectOrCaller(args, 0, ctx);
 
@@ -5313,7 +5313,7 @@ static Variable GetLastAttackResult(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("GetLastAttackResult");
 }
 
-static Variable GetWasForcePowerSuccessful(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetWasForcePowerSuccessful(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oAttacker = getObjectOrCaller(args, 0, ctx);
 
@@ -5323,7 +5323,7 @@ static Variable GetWasForcePowerSuccessful(const std::vector<Variable> &args, co
     throw RoutineNotImplementedException("GetWasForcePowerSuccessful");
 }
 
-static Variable GetFirstAttacker(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFirstAttacker(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObjectOrCaller(args, 0, ctx);
 
@@ -5333,7 +5333,7 @@ static Variable GetFirstAttacker(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("GetFirstAttacker");
 }
 
-static Variable GetNextAttacker(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetNextAttacker(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObjectOrCaller(args, 0, ctx);
 
@@ -5343,7 +5343,7 @@ static Variable GetNextAttacker(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("GetNextAttacker");
 }
 
-static Variable SetFormation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetFormation(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oAnchor = getObject(args, 0, ctx);
     auto oCreature = getObject(args, 1, ctx);
@@ -5356,7 +5356,7 @@ static Variable SetFormation(const std::vector<Variable> &args, const RoutineCon
     throw RoutineNotImplementedException("SetFormation");
 }
 
-static Variable SetForcePowerUnsuccessful(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetForcePowerUnsuccessful(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nResult = getInt(args, 0);
     auto oCreature = getObjectOrCaller(args, 1, ctx);
@@ -5367,7 +5367,7 @@ static Variable SetForcePowerUnsuccessful(const std::vector<Variable> &args, con
     throw RoutineNotImplementedException("SetForcePowerUnsuccessful");
 }
 
-static Variable GetIsDebilitated(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsDebilitated(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObjectOrCaller(args, 0, ctx);
 
@@ -5378,7 +5378,7 @@ static Variable GetIsDebilitated(const std::vector<Variable> &args, const Routin
     return Variable::ofInt(static_cast<int>(creature->isDebilitated()));
 }
 
-static Variable PlayMovie(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable PlayMovie(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sMovie = getString(args, 0);
     auto nStreamingMusic = getIntOrElse(args, 1, 0);
@@ -5391,7 +5391,7 @@ static Variable PlayMovie(const std::vector<Variable> &args, const RoutineContex
     return Variable::ofNull();
 }
 
-static Variable SaveNPCState(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SaveNPCState(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
 
@@ -5401,7 +5401,7 @@ static Variable SaveNPCState(const std::vector<Variable> &args, const RoutineCon
     throw RoutineNotImplementedException("SaveNPCState");
 }
 
-static Variable GetCategoryFromTalent(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetCategoryFromTalent(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto tTalent = getTalent(args, 0);
 
@@ -5411,7 +5411,7 @@ static Variable GetCategoryFromTalent(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("GetCategoryFromTalent");
 }
 
-static Variable SurrenderByFaction(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SurrenderByFaction(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nFactionFrom = getInt(args, 0);
     auto nFactionTo = getInt(args, 1);
@@ -5422,7 +5422,7 @@ static Variable SurrenderByFaction(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("SurrenderByFaction");
 }
 
-static Variable ChangeFactionByFaction(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ChangeFactionByFaction(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nFactionFrom = getInt(args, 0);
     auto nFactionTo = getInt(args, 1);
@@ -5433,7 +5433,7 @@ static Variable ChangeFactionByFaction(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("ChangeFactionByFaction");
 }
 
-static Variable PlayRoomAnimation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable PlayRoomAnimation(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sRoom = getString(args, 0);
     auto nAnimation = getInt(args, 1);
@@ -5444,7 +5444,7 @@ static Variable PlayRoomAnimation(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("PlayRoomAnimation");
 }
 
-static Variable ShowGalaxyMap(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ShowGalaxyMap(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nPlanet = getInt(args, 0);
 
@@ -5454,7 +5454,7 @@ static Variable ShowGalaxyMap(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("ShowGalaxyMap");
 }
 
-static Variable SetPlanetSelectable(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetPlanetSelectable(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nPlanet = getInt(args, 0);
     auto bSelectable = getInt(args, 1);
@@ -5465,7 +5465,7 @@ static Variable SetPlanetSelectable(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("SetPlanetSelectable");
 }
 
-static Variable GetPlanetSelectable(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetPlanetSelectable(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nPlanet = getInt(args, 0);
 
@@ -5475,7 +5475,7 @@ static Variable GetPlanetSelectable(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("GetPlanetSelectable");
 }
 
-static Variable SetPlanetAvailable(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetPlanetAvailable(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nPlanet = getInt(args, 0);
     auto bAvailable = getInt(args, 1);
@@ -5486,7 +5486,7 @@ static Variable SetPlanetAvailable(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("SetPlanetAvailable");
 }
 
-static Variable GetPlanetAvailable(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetPlanetAvailable(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nPlanet = getInt(args, 0);
 
@@ -5496,12 +5496,12 @@ static Variable GetPlanetAvailable(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("GetPlanetAvailable");
 }
 
-static Variable GetSelectedPlanet(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetSelectedPlanet(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetSelectedPlanet");
 }
 
-static Variable SoundObjectFadeAndStop(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SoundObjectFadeAndStop(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oSound = getObject(args, 0, ctx);
     auto fSeconds = getFloat(args, 1);
@@ -5512,7 +5512,7 @@ static Variable SoundObjectFadeAndStop(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("SoundObjectFadeAndStop");
 }
 
-static Variable SetAreaFogColor(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetAreaFogColor(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
     auto fRed = getFloat(args, 1);
@@ -5525,7 +5525,7 @@ static Variable SetAreaFogColor(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("SetAreaFogColor");
 }
 
-static Variable ChangeItemCost(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ChangeItemCost(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sItem = getString(args, 0);
     auto fCostMultiplier = getFloat(args, 1);
@@ -5536,7 +5536,7 @@ static Variable ChangeItemCost(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("ChangeItemCost");
 }
 
-static Variable GetIsLiveContentAvailable(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsLiveContentAvailable(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nPkg = getInt(args, 0);
 
@@ -5546,12 +5546,12 @@ static Variable GetIsLiveContentAvailable(const std::vector<Variable> &args, con
     throw RoutineNotImplementedException("GetIsLiveContentAvailable");
 }
 
-static Variable ResetDialogState(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ResetDialogState(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("ResetDialogState");
 }
 
-static Variable SetGoodEvilValue(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetGoodEvilValue(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto nAlignment = getInt(args, 1);
@@ -5562,7 +5562,7 @@ static Variable SetGoodEvilValue(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("SetGoodEvilValue");
 }
 
-static Variable GetIsPoisoned(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsPoisoned(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -5572,7 +5572,7 @@ static Variable GetIsPoisoned(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("GetIsPoisoned");
 }
 
-static Variable GetSpellTarget(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetSpellTarget(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObjectOrCaller(args, 0, ctx);
 
@@ -5582,7 +5582,7 @@ static Variable GetSpellTarget(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("GetSpellTarget");
 }
 
-static Variable SetSoloMode(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetSoloMode(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto bActivate = getInt(args, 0);
 
@@ -5594,12 +5594,12 @@ static Variable SetSoloMode(const std::vector<Variable> &args, const RoutineCont
     return Variable::ofNull();
 }
 
-static Variable CancelPostDialogCharacterSwitch(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable CancelPostDialogCharacterSwitch(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("CancelPostDialogCharacterSwitch");
 }
 
-static Variable SetMaxHitPoints(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetMaxHitPoints(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto nMaxHP = getInt(args, 1);
@@ -5611,7 +5611,7 @@ static Variable SetMaxHitPoints(const std::vector<Variable> &args, const Routine
     return Variable::ofNull();
 }
 
-static Variable NoClicksFor(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable NoClicksFor(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto fDuration = getFloat(args, 0);
 
@@ -5621,22 +5621,22 @@ static Variable NoClicksFor(const std::vector<Variable> &args, const RoutineCont
     throw RoutineNotImplementedException("NoClicksFor");
 }
 
-static Variable HoldWorldFadeInForDialog(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable HoldWorldFadeInForDialog(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("HoldWorldFadeInForDialog");
 }
 
-static Variable ShipBuild(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ShipBuild(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     return Variable::ofInt(static_cast<int>(kShipBuild));
 }
 
-static Variable SurrenderRetainBuffs(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SurrenderRetainBuffs(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SurrenderRetainBuffs");
 }
 
-static Variable SuppressStatusSummaryEntry(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SuppressStatusSummaryEntry(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nNumEntries = getIntOrElse(args, 0, 1);
 
@@ -5646,7 +5646,7 @@ static Variable SuppressStatusSummaryEntry(const std::vector<Variable> &args, co
     throw RoutineNotImplementedException("SuppressStatusSummaryEntry");
 }
 
-static Variable GetCheatCode(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetCheatCode(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nCode = getInt(args, 0);
 
@@ -5656,7 +5656,7 @@ static Variable GetCheatCode(const std::vector<Variable> &args, const RoutineCon
     return Variable::ofInt(0);
 }
 
-static Variable SetMusicVolume(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetMusicVolume(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto fVolume = getFloatOrElse(args, 0, 1.0f);
 
@@ -5666,7 +5666,7 @@ static Variable SetMusicVolume(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("SetMusicVolume");
 }
 
-static Variable CreateItemOnFloor(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable CreateItemOnFloor(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sTemplate = getString(args, 0);
     auto lLocation = getLocationArgument(args, 1);
@@ -5678,7 +5678,7 @@ static Variable CreateItemOnFloor(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("CreateItemOnFloor");
 }
 
-static Variable SetAvailableNPCId(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetAvailableNPCId(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
     auto oidNPC = getObject(args, 1, ctx);
@@ -5689,7 +5689,7 @@ static Variable SetAvailableNPCId(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("SetAvailableNPCId");
 }
 
-static Variable GetScriptParameter(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetScriptParameter(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nIndex = getInt(args, 0);
 
@@ -5699,22 +5699,22 @@ static Variable GetScriptParameter(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("GetScriptParameter");
 }
 
-static Variable SetFadeUntilScript(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetFadeUntilScript(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SetFadeUntilScript");
 }
 
-static Variable GetItemComponent(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetItemComponent(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetItemComponent");
 }
 
-static Variable GetItemComponentPieceValue(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetItemComponentPieceValue(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetItemComponentPieceValue");
 }
 
-static Variable ShowChemicalUpgradeScreen(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ShowChemicalUpgradeScreen(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCharacter = getObject(args, 0, ctx);
 
@@ -5724,22 +5724,22 @@ static Variable ShowChemicalUpgradeScreen(const std::vector<Variable> &args, con
     throw RoutineNotImplementedException("ShowChemicalUpgradeScreen");
 }
 
-static Variable GetChemicals(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetChemicals(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetChemicals");
 }
 
-static Variable GetChemicalPieceValue(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetChemicalPieceValue(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetChemicalPieceValue");
 }
 
-static Variable GetSpellForcePointCost(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetSpellForcePointCost(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetSpellForcePointCost");
 }
 
-static Variable GetFeatAcquired(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFeatAcquired(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nFeat = getInt(args, 0);
     auto oCreature = getObjectOrCaller(args, 1, ctx);
@@ -5750,7 +5750,7 @@ static Variable GetFeatAcquired(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("GetFeatAcquired");
 }
 
-static Variable GetSpellAcquired(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetSpellAcquired(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nSpell = getInt(args, 0);
     auto oCreature = getObjectOrCaller(args, 1, ctx);
@@ -5761,12 +5761,12 @@ static Variable GetSpellAcquired(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("GetSpellAcquired");
 }
 
-static Variable ShowSwoopUpgradeScreen(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ShowSwoopUpgradeScreen(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("ShowSwoopUpgradeScreen");
 }
 
-static Variable GrantFeat(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GrantFeat(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nFeat = getInt(args, 0);
     auto oCreature = getObject(args, 1, ctx);
@@ -5777,7 +5777,7 @@ static Variable GrantFeat(const std::vector<Variable> &args, const RoutineContex
     throw RoutineNotImplementedException("GrantFeat");
 }
 
-static Variable GrantSpell(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GrantSpell(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nSpell = getInt(args, 0);
     auto oCreature = getObject(args, 1, ctx);
@@ -5788,7 +5788,7 @@ static Variable GrantSpell(const std::vector<Variable> &args, const RoutineConte
     throw RoutineNotImplementedException("GrantSpell");
 }
 
-static Variable SpawnMine(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SpawnMine(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nMineType = getInt(args, 0);
     auto lPoint = getLocationArgument(args, 1);
@@ -5802,7 +5802,7 @@ static Variable SpawnMine(const std::vector<Variable> &args, const RoutineContex
     throw RoutineNotImplementedException("SpawnMine");
 }
 
-static Variable SetFakeCombatState(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetFakeCombatState(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto nEnable = getInt(args, 1);
@@ -5813,7 +5813,7 @@ static Variable SetFakeCombatState(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("SetFakeCombatState");
 }
 
-static Variable GetOwnerDemolitionsSkill(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetOwnerDemolitionsSkill(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -5823,7 +5823,7 @@ static Variable GetOwnerDemolitionsSkill(const std::vector<Variable> &args, cons
     throw RoutineNotImplementedException("GetOwnerDemolitionsSkill");
 }
 
-static Variable SetOrientOnClick(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetOrientOnClick(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObjectOrCaller(args, 0, ctx);
     auto nState = getIntOrElse(args, 1, 1);
@@ -5834,7 +5834,7 @@ static Variable SetOrientOnClick(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("SetOrientOnClick");
 }
 
-static Variable GetInfluence(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetInfluence(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
 
@@ -5844,7 +5844,7 @@ static Variable GetInfluence(const std::vector<Variable> &args, const RoutineCon
     throw RoutineNotImplementedException("GetInfluence");
 }
 
-static Variable SetInfluence(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetInfluence(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
     auto nInfluence = getInt(args, 1);
@@ -5855,7 +5855,7 @@ static Variable SetInfluence(const std::vector<Variable> &args, const RoutineCon
     throw RoutineNotImplementedException("SetInfluence");
 }
 
-static Variable ModifyInfluence(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ModifyInfluence(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
     auto nModifier = getInt(args, 1);
@@ -5866,7 +5866,7 @@ static Variable ModifyInfluence(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("ModifyInfluence");
 }
 
-static Variable GetRacialSubType(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetRacialSubType(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
 
@@ -5876,7 +5876,7 @@ static Variable GetRacialSubType(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("GetRacialSubType");
 }
 
-static Variable IncrementGlobalNumber(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable IncrementGlobalNumber(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sIdentifier = getString(args, 0);
     auto nAmount = getInt(args, 1);
@@ -5887,7 +5887,7 @@ static Variable IncrementGlobalNumber(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("IncrementGlobalNumber");
 }
 
-static Variable DecrementGlobalNumber(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable DecrementGlobalNumber(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sIdentifier = getString(args, 0);
     auto nAmount = getInt(args, 1);
@@ -5898,7 +5898,7 @@ static Variable DecrementGlobalNumber(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("DecrementGlobalNumber");
 }
 
-static Variable SetBonusForcePoints(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetBonusForcePoints(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto nBonusFP = getInt(args, 1);
@@ -5909,7 +5909,7 @@ static Variable SetBonusForcePoints(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("SetBonusForcePoints");
 }
 
-static Variable AddBonusForcePoints(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AddBonusForcePoints(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto nBonusFP = getInt(args, 1);
@@ -5920,7 +5920,7 @@ static Variable AddBonusForcePoints(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("AddBonusForcePoints");
 }
 
-static Variable GetBonusForcePoints(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetBonusForcePoints(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -5930,12 +5930,12 @@ static Variable GetBonusForcePoints(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("GetBonusForcePoints");
 }
 
-static Variable IsMoviePlaying(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable IsMoviePlaying(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("IsMoviePlaying");
 }
 
-static Variable QueueMovie(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable QueueMovie(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sMovie = getString(args, 0);
     auto nSkippable = getIntOrElse(args, 1, 1);
@@ -5946,7 +5946,7 @@ static Variable QueueMovie(const std::vector<Variable> &args, const RoutineConte
     throw RoutineNotImplementedException("QueueMovie");
 }
 
-static Variable PlayMovieQueue(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable PlayMovieQueue(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nAllowSkips = getIntOrElse(args, 0, 1);
 
@@ -5956,7 +5956,7 @@ static Variable PlayMovieQueue(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("PlayMovieQueue");
 }
 
-static Variable YavinHackDoorClose(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable YavinHackDoorClose(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -5966,7 +5966,7 @@ static Variable YavinHackDoorClose(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("YavinHackDoorClose");
 }
 
-static Variable IsStealthed(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable IsStealthed(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -5976,7 +5976,7 @@ static Variable IsStealthed(const std::vector<Variable> &args, const RoutineCont
     throw RoutineNotImplementedException("IsStealthed");
 }
 
-static Variable IsMeditating(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable IsMeditating(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -5986,7 +5986,7 @@ static Variable IsMeditating(const std::vector<Variable> &args, const RoutineCon
     throw RoutineNotImplementedException("IsMeditating");
 }
 
-static Variable IsInTotalDefense(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable IsInTotalDefense(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -5996,7 +5996,7 @@ static Variable IsInTotalDefense(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("IsInTotalDefense");
 }
 
-static Variable SetHealTarget(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetHealTarget(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oidHealer = getObject(args, 0, ctx);
     auto oidTarget = getObject(args, 1, ctx);
@@ -6007,7 +6007,7 @@ static Variable SetHealTarget(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("SetHealTarget");
 }
 
-static Variable GetHealTarget(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetHealTarget(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oidHealer = getObject(args, 0, ctx);
 
@@ -6017,7 +6017,7 @@ static Variable GetHealTarget(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("GetHealTarget");
 }
 
-static Variable GetRandomDestination(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetRandomDestination(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto rangeLimit = getInt(args, 1);
@@ -6028,7 +6028,7 @@ static Variable GetRandomDestination(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("GetRandomDestination");
 }
 
-static Variable IsFormActive(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable IsFormActive(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto nFormID = getInt(args, 1);
@@ -6039,7 +6039,7 @@ static Variable IsFormActive(const std::vector<Variable> &args, const RoutineCon
     throw RoutineNotImplementedException("IsFormActive");
 }
 
-static Variable GetSpellFormMask(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetSpellFormMask(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nSpellID = getInt(args, 0);
 
@@ -6049,7 +6049,7 @@ static Variable GetSpellFormMask(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("GetSpellFormMask");
 }
 
-static Variable GetSpellBaseForcePointCost(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetSpellBaseForcePointCost(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nSpellID = getInt(args, 0);
 
@@ -6059,7 +6059,7 @@ static Variable GetSpellBaseForcePointCost(const std::vector<Variable> &args, co
     throw RoutineNotImplementedException("GetSpellBaseForcePointCost");
 }
 
-static Variable SetKeepStealthInDialog(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetKeepStealthInDialog(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nStealthState = getInt(args, 0);
 
@@ -6069,7 +6069,7 @@ static Variable SetKeepStealthInDialog(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("SetKeepStealthInDialog");
 }
 
-static Variable HasLineOfSight(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable HasLineOfSight(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto vSource = getVector(args, 0);
     auto vTarget = getVector(args, 1);
@@ -6082,7 +6082,7 @@ static Variable HasLineOfSight(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("HasLineOfSight");
 }
 
-static Variable ShowDemoScreen(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ShowDemoScreen(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto sTexture = getString(args, 0);
     auto nTimeout = getInt(args, 1);
@@ -6096,7 +6096,7 @@ static Variable ShowDemoScreen(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("ShowDemoScreen");
 }
 
-static Variable ForceHeartbeat(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ForceHeartbeat(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -6106,7 +6106,7 @@ static Variable ForceHeartbeat(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("ForceHeartbeat");
 }
 
-static Variable IsRunning(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable IsRunning(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -6116,7 +6116,7 @@ static Variable IsRunning(const std::vector<Variable> &args, const RoutineContex
     throw RoutineNotImplementedException("IsRunning");
 }
 
-static Variable SetForfeitConditions(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetForfeitConditions(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nForfeitFlags = getInt(args, 0);
 
@@ -6126,12 +6126,12 @@ static Variable SetForfeitConditions(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("SetForfeitConditions");
 }
 
-static Variable GetLastForfeitViolation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastForfeitViolation(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLastForfeitViolation");
 }
 
-static Variable ModifyReflexSavingThrowBase(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ModifyReflexSavingThrowBase(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto aObject = getObject(args, 0, ctx);
     auto aModValue = getInt(args, 1);
@@ -6142,7 +6142,7 @@ static Variable ModifyReflexSavingThrowBase(const std::vector<Variable> &args, c
     throw RoutineNotImplementedException("ModifyReflexSavingThrowBase");
 }
 
-static Variable ModifyFortitudeSavingThrowBase(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ModifyFortitudeSavingThrowBase(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto aObject = getObject(args, 0, ctx);
     auto aModValue = getInt(args, 1);
@@ -6153,7 +6153,7 @@ static Variable ModifyFortitudeSavingThrowBase(const std::vector<Variable> &args
     throw RoutineNotImplementedException("ModifyFortitudeSavingThrowBase");
 }
 
-static Variable ModifyWillSavingThrowBase(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ModifyWillSavingThrowBase(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto aObject = getObject(args, 0, ctx);
     auto aModValue = getInt(args, 1);
@@ -6164,12 +6164,12 @@ static Variable ModifyWillSavingThrowBase(const std::vector<Variable> &args, con
     throw RoutineNotImplementedException("ModifyWillSavingThrowBase");
 }
 
-static Variable GetScriptStringParameter(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetScriptStringParameter(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetScriptStringParameter");
 }
 
-static Variable GetObjectPersonalSpace(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetObjectPersonalSpace(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto aObject = getObject(args, 0, ctx);
 
@@ -6179,7 +6179,7 @@ static Variable GetObjectPersonalSpace(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("GetObjectPersonalSpace");
 }
 
-static Variable AdjustCreatureAttributes(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AdjustCreatureAttributes(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto nAttribute = getInt(args, 1);
@@ -6191,7 +6191,7 @@ static Variable AdjustCreatureAttributes(const std::vector<Variable> &args, cons
     throw RoutineNotImplementedException("AdjustCreatureAttributes");
 }
 
-static Variable SetCreatureAILevel(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetCreatureAILevel(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto nPriority = getInt(args, 1);
@@ -6202,7 +6202,7 @@ static Variable SetCreatureAILevel(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("SetCreatureAILevel");
 }
 
-static Variable ResetCreatureAILevel(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ResetCreatureAILevel(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -6212,7 +6212,7 @@ static Variable ResetCreatureAILevel(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("ResetCreatureAILevel");
 }
 
-static Variable AddAvailablePUPByTemplate(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AddAvailablePUPByTemplate(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nPUP = getInt(args, 0);
     auto sTemplate = getString(args, 1);
@@ -6223,7 +6223,7 @@ static Variable AddAvailablePUPByTemplate(const std::vector<Variable> &args, con
     throw RoutineNotImplementedException("AddAvailablePUPByTemplate");
 }
 
-static Variable AddAvailablePUPByObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AddAvailablePUPByObject(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nPUP = getInt(args, 0);
     auto oPuppet = getObject(args, 1, ctx);
@@ -6234,7 +6234,7 @@ static Variable AddAvailablePUPByObject(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("AddAvailablePUPByObject");
 }
 
-static Variable AssignPUP(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AssignPUP(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nPUP = getInt(args, 0);
     auto nNPC = getInt(args, 1);
@@ -6245,7 +6245,7 @@ static Variable AssignPUP(const std::vector<Variable> &args, const RoutineContex
     throw RoutineNotImplementedException("AssignPUP");
 }
 
-static Variable SpawnAvailablePUP(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SpawnAvailablePUP(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nPUP = getInt(args, 0);
     auto lLocation = getLocationArgument(args, 1);
@@ -6256,7 +6256,7 @@ static Variable SpawnAvailablePUP(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("SpawnAvailablePUP");
 }
 
-static Variable AddPartyPuppet(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AddPartyPuppet(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nPUP = getInt(args, 0);
     auto oidCreature = getObject(args, 1, ctx);
@@ -6267,7 +6267,7 @@ static Variable AddPartyPuppet(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("AddPartyPuppet");
 }
 
-static Variable GetPUPOwner(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetPUPOwner(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oPUP = getObjectOrCaller(args, 0, ctx);
 
@@ -6277,7 +6277,7 @@ static Variable GetPUPOwner(const std::vector<Variable> &args, const RoutineCont
     throw RoutineNotImplementedException("GetPUPOwner");
 }
 
-static Variable GetIsPuppet(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsPuppet(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oPUP = getObjectOrCaller(args, 0, ctx);
 
@@ -6287,7 +6287,7 @@ static Variable GetIsPuppet(const std::vector<Variable> &args, const RoutineCont
     throw RoutineNotImplementedException("GetIsPuppet");
 }
 
-static Variable GetIsPartyLeader(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsPartyLeader(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCharacter = getObjectOrCaller(args, 0, ctx);
 
@@ -6297,12 +6297,12 @@ static Variable GetIsPartyLeader(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("GetIsPartyLeader");
 }
 
-static Variable GetPartyLeader(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetPartyLeader(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetPartyLeader");
 }
 
-static Variable RemoveNPCFromPartyToBase(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable RemoveNPCFromPartyToBase(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
 
@@ -6312,7 +6312,7 @@ static Variable RemoveNPCFromPartyToBase(const std::vector<Variable> &args, cons
     throw RoutineNotImplementedException("RemoveNPCFromPartyToBase");
 }
 
-static Variable CreatureFlourishWeapon(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable CreatureFlourishWeapon(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -6322,7 +6322,7 @@ static Variable CreatureFlourishWeapon(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("CreatureFlourishWeapon");
 }
 
-static Variable ChangeObjectAppearance(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ChangeObjectAppearance(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObjectToChange = getObject(args, 0, ctx);
     auto nAppearance = getInt(args, 1);
@@ -6333,12 +6333,12 @@ static Variable ChangeObjectAppearance(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("ChangeObjectAppearance");
 }
 
-static Variable GetIsXBox(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsXBox(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetIsXBox");
 }
 
-static Variable PlayOverlayAnimation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable PlayOverlayAnimation(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
     auto nAnimation = getInt(args, 1);
@@ -6349,12 +6349,12 @@ static Variable PlayOverlayAnimation(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("PlayOverlayAnimation");
 }
 
-static Variable UnlockAllSongs(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable UnlockAllSongs(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("UnlockAllSongs");
 }
 
-static Variable DisableMap(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable DisableMap(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nFlag = getIntOrElse(args, 0, 0);
 
@@ -6364,7 +6364,7 @@ static Variable DisableMap(const std::vector<Variable> &args, const RoutineConte
     throw RoutineNotImplementedException("DisableMap");
 }
 
-static Variable DetonateMine(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable DetonateMine(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oMine = getObject(args, 0, ctx);
 
@@ -6374,7 +6374,7 @@ static Variable DetonateMine(const std::vector<Variable> &args, const RoutineCon
     throw RoutineNotImplementedException("DetonateMine");
 }
 
-static Variable DisableHealthRegen(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable DisableHealthRegen(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nFlag = getIntOrElse(args, 0, 0);
 
@@ -6384,7 +6384,7 @@ static Variable DisableHealthRegen(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("DisableHealthRegen");
 }
 
-static Variable SetCurrentForm(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetCurrentForm(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto nFormID = getInt(args, 1);
@@ -6395,7 +6395,7 @@ static Variable SetCurrentForm(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("SetCurrentForm");
 }
 
-static Variable SetDisableTransit(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetDisableTransit(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nFlag = getIntOrElse(args, 0, 0);
 
@@ -6405,7 +6405,7 @@ static Variable SetDisableTransit(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("SetDisableTransit");
 }
 
-static Variable SetInputClass(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetInputClass(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nClass = getInt(args, 0);
 
@@ -6415,7 +6415,7 @@ static Variable SetInputClass(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("SetInputClass");
 }
 
-static Variable SetForceAlwaysUpdate(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetForceAlwaysUpdate(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto nFlag = getInt(args, 1);
@@ -6426,7 +6426,7 @@ static Variable SetForceAlwaysUpdate(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("SetForceAlwaysUpdate");
 }
 
-static Variable EnableRain(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EnableRain(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nFlag = getInt(args, 0);
 
@@ -6436,7 +6436,7 @@ static Variable EnableRain(const std::vector<Variable> &args, const RoutineConte
     throw RoutineNotImplementedException("EnableRain");
 }
 
-static Variable DisplayMessageBox(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable DisplayMessageBox(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nStrRef = getInt(args, 0);
     auto sIcon = getStringOrElse(args, 1, "");
@@ -6447,7 +6447,7 @@ static Variable DisplayMessageBox(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("DisplayMessageBox");
 }
 
-static Variable DisplayDatapad(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable DisplayDatapad(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oDatapad = getObject(args, 0, ctx);
 
@@ -6457,7 +6457,7 @@ static Variable DisplayDatapad(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("DisplayDatapad");
 }
 
-static Variable RemoveHeartbeat(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable RemoveHeartbeat(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oPlaceable = getObject(args, 0, ctx);
 
@@ -6467,7 +6467,7 @@ static Variable RemoveHeartbeat(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("RemoveHeartbeat");
 }
 
-static Variable RemoveEffectByID(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable RemoveEffectByID(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto nEffectID = getInt(args, 1);
@@ -6478,7 +6478,7 @@ static Variable RemoveEffectByID(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("RemoveEffectByID");
 }
 
-static Variable RemoveEffectByExactMatch(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable RemoveEffectByExactMatch(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto eEffect = getEffect(args, 1);
@@ -6489,7 +6489,7 @@ static Variable RemoveEffectByExactMatch(const std::vector<Variable> &args, cons
     throw RoutineNotImplementedException("RemoveEffectByExactMatch");
 }
 
-static Variable AdjustCreatureSkills(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AdjustCreatureSkills(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto nSkill = getInt(args, 1);
@@ -6501,7 +6501,7 @@ static Variable AdjustCreatureSkills(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("AdjustCreatureSkills");
 }
 
-static Variable GetSkillRankBase(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetSkillRankBase(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nSkill = getInt(args, 0);
     auto oObject = getObjectOrCaller(args, 1, ctx);
@@ -6512,7 +6512,7 @@ static Variable GetSkillRankBase(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("GetSkillRankBase");
 }
 
-static Variable EnableRendering(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EnableRendering(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto bEnable = getInt(args, 1);
@@ -6523,7 +6523,7 @@ static Variable EnableRendering(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("EnableRendering");
 }
 
-static Variable GetCombatActionsPending(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetCombatActionsPending(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -6533,7 +6533,7 @@ static Variable GetCombatActionsPending(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("GetCombatActionsPending");
 }
 
-static Variable SaveNPCByObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SaveNPCByObject(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
     auto oidCharacter = getObject(args, 1, ctx);
@@ -6544,7 +6544,7 @@ static Variable SaveNPCByObject(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("SaveNPCByObject");
 }
 
-static Variable SavePUPByObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SavePUPByObject(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto nPUP = getInt(args, 0);
     auto oidPuppet = getObject(args, 1, ctx);
@@ -6555,7 +6555,7 @@ static Variable SavePUPByObject(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("SavePUPByObject");
 }
 
-static Variable GetIsPlayerMadeCharacter(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsPlayerMadeCharacter(const VariableSpan &args, const RoutineContext &ctx) {
     // Load
     auto oidCharacter = getObject(args, 0, ctx);
 
@@ -6565,1207 +6565,1207 @@ static Variable GetIsPlayerMadeCharacter(const std::vector<Variable> &args, cons
     throw RoutineNotImplementedException("GetIsPlayerMadeCharacter");
 }
 
-static Variable RebuildPartyTable(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable RebuildPartyTable(const VariableSpan &args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("RebuildPartyTable");
 }
 
 void Routines::registerMainKotorRoutines() {
-    insert(0, "Random", R_INT, {R_INT}, &Random);
-    insert(1, "PrintString", R_VOID, {R_STRING}, &PrintString);
-    insert(2, "PrintFloat", R_VOID, {R_FLOAT, R_INT, R_INT}, &PrintFloat);
-    insert(3, "FloatToString", R_STRING, {R_FLOAT, R_INT, R_INT}, &FloatToString);
-    insert(4, "PrintInteger", R_VOID, {R_INT}, &PrintInteger);
-    insert(5, "PrintObject", R_VOID, {R_OBJECT}, &PrintObject);
-    insert(6, "AssignCommand", R_VOID, {R_OBJECT, R_ACTION}, &AssignCommand);
-    insert(7, "DelayCommand", R_VOID, {R_FLOAT, R_ACTION}, &DelayCommand);
-    insert(8, "ExecuteScript", R_VOID, {R_STRING, R_OBJECT, R_INT}, &ExecuteScript);
-    insert(9, "ClearAllActions", R_VOID, {}, &ClearAllActions);
-    insert(10, "SetFacing", R_VOID, {R_FLOAT}, &SetFacing);
-    insert(11, "SwitchPlayerCharacter", R_INT, {R_INT}, &SwitchPlayerCharacter);
-    insert(12, "SetTime", R_VOID, {R_INT, R_INT, R_INT, R_INT}, &SetTime);
-    insert(13, "SetPartyLeader", R_INT, {R_INT}, &SetPartyLeader);
-    insert(14, "SetAreaUnescapable", R_VOID, {R_INT}, &SetAreaUnescapable);
-    insert(15, "GetAreaUnescapable", R_INT, {}, &GetAreaUnescapable);
-    insert(16, "GetTimeHour", R_INT, {}, &GetTimeHour);
-    insert(17, "GetTimeMinute", R_INT, {}, &GetTimeMinute);
-    insert(18, "GetTimeSecond", R_INT, {}, &GetTimeSecond);
-    insert(19, "GetTimeMillisecond", R_INT, {}, &GetTimeMillisecond);
-    insert(24, "GetArea", R_OBJECT, {R_OBJECT}, &GetArea);
-    insert(25, "GetEnteringObject", R_OBJECT, {}, &GetEnteringObject);
-    insert(26, "GetExitingObject", R_OBJECT, {}, &GetExitingObject);
-    insert(27, "GetPosition", R_VECTOR, {R_OBJECT}, &GetPosition);
-    insert(28, "GetFacing", R_FLOAT, {R_OBJECT}, &GetFacing);
-    insert(29, "GetItemPossessor", R_OBJECT, {R_OBJECT}, &GetItemPossessor);
-    insert(30, "GetItemPossessedBy", R_OBJECT, {R_OBJECT, R_STRING}, &GetItemPossessedBy);
-    insert(31, "CreateItemOnObject", R_OBJECT, {R_STRING, R_OBJECT, R_INT}, &CreateItemOnObject);
-    insert(36, "GetLastAttacker", R_OBJECT, {R_OBJECT}, &GetLastAttacker);
-    insert(38, "GetNearestCreature", R_OBJECT, {R_INT, R_INT, R_OBJECT, R_INT, R_INT, R_INT, R_INT, R_INT}, &GetNearestCreature);
-    insert(41, "GetDistanceToObject", R_FLOAT, {R_OBJECT}, &GetDistanceToObject);
-    insert(42, "GetIsObjectValid", R_INT, {R_OBJECT}, &GetIsObjectValid);
-    insert(45, "SetCameraFacing", R_VOID, {R_FLOAT}, &SetCameraFacing);
-    insert(46, "PlaySound", R_VOID, {R_STRING}, &PlaySound);
-    insert(47, "GetSpellTargetObject", R_OBJECT, {}, &GetSpellTargetObject);
-    insert(49, "GetCurrentHitPoints", R_INT, {R_OBJECT}, &GetCurrentHitPoints);
-    insert(50, "GetMaxHitPoints", R_INT, {R_OBJECT}, &GetMaxHitPoints);
-    insert(52, "GetLastItemEquipped", R_OBJECT, {}, &GetLastItemEquipped);
-    insert(53, "GetSubScreenID", R_INT, {}, &GetSubScreenID);
-    insert(54, "CancelCombat", R_VOID, {R_OBJECT}, &CancelCombat);
-    insert(55, "GetCurrentForcePoints", R_INT, {R_OBJECT}, &GetCurrentForcePoints);
-    insert(56, "GetMaxForcePoints", R_INT, {R_OBJECT}, &GetMaxForcePoints);
-    insert(57, "PauseGame", R_VOID, {R_INT}, &PauseGame);
-    insert(58, "SetPlayerRestrictMode", R_VOID, {R_INT}, &SetPlayerRestrictMode);
-    insert(59, "GetStringLength", R_INT, {R_STRING}, &GetStringLength);
-    insert(60, "GetStringUpperCase", R_STRING, {R_STRING}, &GetStringUpperCase);
-    insert(61, "GetStringLowerCase", R_STRING, {R_STRING}, &GetStringLowerCase);
-    insert(62, "GetStringRight", R_STRING, {R_STRING, R_INT}, &GetStringRight);
-    insert(63, "GetStringLeft", R_STRING, {R_STRING, R_INT}, &GetStringLeft);
-    insert(64, "InsertString", R_STRING, {R_STRING, R_STRING, R_INT}, &InsertString);
-    insert(65, "GetSubString", R_STRING, {R_STRING, R_INT, R_INT}, &GetSubString);
-    insert(66, "FindSubString", R_INT, {R_STRING, R_STRING}, &FindSubString);
-    insert(67, "fabs", R_FLOAT, {R_FLOAT}, &fabs);
-    insert(68, "cos", R_FLOAT, {R_FLOAT}, &cos);
-    insert(69, "sin", R_FLOAT, {R_FLOAT}, &sin);
-    insert(70, "tan", R_FLOAT, {R_FLOAT}, &tan);
-    insert(71, "acos", R_FLOAT, {R_FLOAT}, &acos);
-    insert(72, "asin", R_FLOAT, {R_FLOAT}, &asin);
-    insert(73, "atan", R_FLOAT, {R_FLOAT}, &atan);
-    insert(74, "log", R_FLOAT, {R_FLOAT}, &log);
-    insert(75, "pow", R_FLOAT, {R_FLOAT, R_FLOAT}, &pow);
-    insert(76, "sqrt", R_FLOAT, {R_FLOAT}, &sqrt);
-    insert(77, "abs", R_INT, {R_INT}, &abs);
-    insert(83, "GetPlayerRestrictMode", R_INT, {R_OBJECT}, &GetPlayerRestrictMode);
-    insert(84, "GetCasterLevel", R_INT, {R_OBJECT}, &GetCasterLevel);
-    insert(85, "GetFirstEffect", R_EFFECT, {R_OBJECT}, &GetFirstEffect);
-    insert(86, "GetNextEffect", R_EFFECT, {R_OBJECT}, &GetNextEffect);
-    insert(87, "RemoveEffect", R_VOID, {R_OBJECT, R_EFFECT}, &RemoveEffect);
-    insert(88, "GetIsEffectValid", R_INT, {R_EFFECT}, &GetIsEffectValid);
-    insert(89, "GetEffectDurationType", R_INT, {R_EFFECT}, &GetEffectDurationType);
-    insert(90, "GetEffectSubType", R_INT, {R_EFFECT}, &GetEffectSubType);
-    insert(91, "GetEffectCreator", R_OBJECT, {R_EFFECT}, &GetEffectCreator);
-    insert(92, "IntToString", R_STRING, {R_INT}, &IntToString);
-    insert(93, "GetFirstObjectInArea", R_OBJECT, {R_OBJECT, R_INT}, &GetFirstObjectInArea);
-    insert(94, "GetNextObjectInArea", R_OBJECT, {R_OBJECT, R_INT}, &GetNextObjectInArea);
-    insert(95, "d2", R_INT, {R_INT}, &d2);
-    insert(96, "d3", R_INT, {R_INT}, &d3);
-    insert(97, "d4", R_INT, {R_INT}, &d4);
-    insert(98, "d6", R_INT, {R_INT}, &d6);
-    insert(99, "d8", R_INT, {R_INT}, &d8);
-    insert(100, "d10", R_INT, {R_INT}, &d10);
-    insert(101, "d12", R_INT, {R_INT}, &d12);
-    insert(102, "d20", R_INT, {R_INT}, &d20);
-    insert(103, "d100", R_INT, {R_INT}, &d100);
-    insert(104, "VectorMagnitude", R_FLOAT, {R_VECTOR}, &VectorMagnitude);
-    insert(105, "GetMetaMagicFeat", R_INT, {}, &GetMetaMagicFeat);
-    insert(106, "GetObjectType", R_INT, {R_OBJECT}, &GetObjectType);
-    insert(107, "GetRacialType", R_INT, {R_OBJECT}, &GetRacialType);
-    insert(108, "FortitudeSave", R_INT, {R_OBJECT, R_INT, R_INT, R_OBJECT}, &FortitudeSave);
-    insert(109, "ReflexSave", R_INT, {R_OBJECT, R_INT, R_INT, R_OBJECT}, &ReflexSave);
-    insert(110, "WillSave", R_INT, {R_OBJECT, R_INT, R_INT, R_OBJECT}, &WillSave);
-    insert(111, "GetSpellSaveDC", R_INT, {}, &GetSpellSaveDC);
-    insert(112, "MagicalEffect", R_EFFECT, {R_EFFECT}, &MagicalEffect);
-    insert(113, "SupernaturalEffect", R_EFFECT, {R_EFFECT}, &SupernaturalEffect);
-    insert(114, "ExtraordinaryEffect", R_EFFECT, {R_EFFECT}, &ExtraordinaryEffect);
-    insert(116, "GetAC", R_INT, {R_OBJECT, R_INT}, &GetAC);
-    insert(121, "RoundsToSeconds", R_FLOAT, {R_INT}, &RoundsToSeconds);
-    insert(122, "HoursToSeconds", R_FLOAT, {R_INT}, &HoursToSeconds);
-    insert(123, "TurnsToSeconds", R_FLOAT, {R_INT}, &TurnsToSeconds);
-    insert(124, "SoundObjectSetFixedVariance", R_VOID, {R_OBJECT, R_FLOAT}, &SoundObjectSetFixedVariance);
-    insert(125, "GetGoodEvilValue", R_INT, {R_OBJECT}, &GetGoodEvilValue);
-    insert(126, "GetPartyMemberCount", R_INT, {}, &GetPartyMemberCount);
-    insert(127, "GetAlignmentGoodEvil", R_INT, {R_OBJECT}, &GetAlignmentGoodEvil);
-    insert(128, "GetFirstObjectInShape", R_OBJECT, {R_INT, R_FLOAT, R_LOCATION, R_INT, R_INT, R_VECTOR}, &GetFirstObjectInShape);
-    insert(129, "GetNextObjectInShape", R_OBJECT, {R_INT, R_FLOAT, R_LOCATION, R_INT, R_INT, R_VECTOR}, &GetNextObjectInShape);
-    insert(131, "SignalEvent", R_VOID, {R_OBJECT, R_EVENT}, &SignalEvent);
-    insert(132, "EventUserDefined", R_EVENT, {R_INT}, &EventUserDefined);
-    insert(137, "VectorNormalize", R_VECTOR, {R_VECTOR}, &VectorNormalize);
-    insert(138, "GetItemStackSize", R_INT, {R_OBJECT}, &GetItemStackSize);
-    insert(139, "GetAbilityScore", R_INT, {R_OBJECT, R_INT}, &GetAbilityScore);
-    insert(140, "GetIsDead", R_INT, {R_OBJECT}, &GetIsDead);
-    insert(141, "PrintVector", R_VOID, {R_VECTOR, R_INT}, &PrintVector);
-    insert(142, "Vector", R_VECTOR, {R_FLOAT, R_FLOAT, R_FLOAT}, &Vector);
-    insert(143, "SetFacingPoint", R_VOID, {R_VECTOR}, &SetFacingPoint);
-    insert(144, "AngleToVector", R_VECTOR, {R_FLOAT}, &AngleToVector);
-    insert(145, "VectorToAngle", R_FLOAT, {R_VECTOR}, &VectorToAngle);
-    insert(146, "TouchAttackMelee", R_INT, {R_OBJECT, R_INT}, &TouchAttackMelee);
-    insert(147, "TouchAttackRanged", R_INT, {R_OBJECT, R_INT}, &TouchAttackRanged);
-    insert(150, "SetItemStackSize", R_VOID, {R_OBJECT, R_INT}, &SetItemStackSize);
-    insert(151, "GetDistanceBetween", R_FLOAT, {R_OBJECT, R_OBJECT}, &GetDistanceBetween);
-    insert(152, "SetReturnStrref", R_VOID, {R_INT, R_INT, R_INT}, &SetReturnStrref);
-    insert(155, "GetItemInSlot", R_OBJECT, {R_INT, R_OBJECT}, &GetItemInSlot);
-    insert(160, "SetGlobalString", R_VOID, {R_STRING, R_STRING}, &SetGlobalString);
-    insert(162, "SetCommandable", R_VOID, {R_INT, R_OBJECT}, &SetCommandable);
-    insert(163, "GetCommandable", R_INT, {R_OBJECT}, &GetCommandable);
-    insert(166, "GetHitDice", R_INT, {R_OBJECT}, &GetHitDice);
-    insert(168, "GetTag", R_STRING, {R_OBJECT}, &GetTag);
-    insert(169, "ResistForce", R_INT, {R_OBJECT, R_OBJECT}, &ResistForce);
-    insert(170, "GetEffectType", R_INT, {R_EFFECT}, &GetEffectType);
-    insert(172, "GetFactionEqual", R_INT, {R_OBJECT, R_OBJECT}, &GetFactionEqual);
-    insert(173, "ChangeFaction", R_VOID, {R_OBJECT, R_OBJECT}, &ChangeFaction);
-    insert(174, "GetIsListening", R_INT, {R_OBJECT}, &GetIsListening);
-    insert(175, "SetListening", R_VOID, {R_OBJECT, R_INT}, &SetListening);
-    insert(176, "SetListenPattern", R_VOID, {R_OBJECT, R_STRING, R_INT}, &SetListenPattern);
-    insert(177, "TestStringAgainstPattern", R_INT, {R_STRING, R_STRING}, &TestStringAgainstPattern);
-    insert(178, "GetMatchedSubstring", R_STRING, {R_INT}, &GetMatchedSubstring);
-    insert(179, "GetMatchedSubstringsCount", R_INT, {}, &GetMatchedSubstringsCount);
-    insert(181, "GetFactionWeakestMember", R_OBJECT, {R_OBJECT, R_INT}, &GetFactionWeakestMember);
-    insert(182, "GetFactionStrongestMember", R_OBJECT, {R_OBJECT, R_INT}, &GetFactionStrongestMember);
-    insert(183, "GetFactionMostDamagedMember", R_OBJECT, {R_OBJECT, R_INT}, &GetFactionMostDamagedMember);
-    insert(184, "GetFactionLeastDamagedMember", R_OBJECT, {R_OBJECT, R_INT}, &GetFactionLeastDamagedMember);
-    insert(185, "GetFactionGold", R_INT, {R_OBJECT}, &GetFactionGold);
-    insert(186, "GetFactionAverageReputation", R_INT, {R_OBJECT, R_OBJECT}, &GetFactionAverageReputation);
-    insert(187, "GetFactionAverageGoodEvilAlignment", R_INT, {R_OBJECT}, &GetFactionAverageGoodEvilAlignment);
-    insert(188, "SoundObjectGetFixedVariance", R_FLOAT, {R_OBJECT}, &SoundObjectGetFixedVariance);
-    insert(189, "GetFactionAverageLevel", R_INT, {R_OBJECT}, &GetFactionAverageLevel);
-    insert(190, "GetFactionAverageXP", R_INT, {R_OBJECT}, &GetFactionAverageXP);
-    insert(191, "GetFactionMostFrequentClass", R_INT, {R_OBJECT}, &GetFactionMostFrequentClass);
-    insert(192, "GetFactionWorstAC", R_OBJECT, {R_OBJECT, R_INT}, &GetFactionWorstAC);
-    insert(193, "GetFactionBestAC", R_OBJECT, {R_OBJECT, R_INT}, &GetFactionBestAC);
-    insert(194, "GetGlobalString", R_STRING, {R_STRING}, &GetGlobalString);
-    insert(195, "GetListenPatternNumber", R_INT, {}, &GetListenPatternNumber);
-    insert(197, "GetWaypointByTag", R_OBJECT, {R_STRING}, &GetWaypointByTag);
-    insert(198, "GetTransitionTarget", R_OBJECT, {R_OBJECT}, &GetTransitionTarget);
-    insert(200, "GetObjectByTag", R_OBJECT, {R_STRING, R_INT}, &GetObjectByTag);
-    insert(201, "AdjustAlignment", R_VOID, {R_OBJECT, R_INT, R_INT}, &AdjustAlignment);
-    insert(203, "SetAreaTransitionBMP", R_VOID, {R_INT, R_STRING}, &SetAreaTransitionBMP);
-    insert(208, "GetReputation", R_INT, {R_OBJECT, R_OBJECT}, &GetReputation);
-    insert(209, "AdjustReputation", R_VOID, {R_OBJECT, R_OBJECT, R_INT}, &AdjustReputation);
-    insert(210, "GetModuleFileName", R_STRING, {}, &GetModuleFileName);
-    insert(211, "GetGoingToBeAttackedBy", R_OBJECT, {R_OBJECT}, &GetGoingToBeAttackedBy);
-    insert(213, "GetLocation", R_LOCATION, {R_OBJECT}, &GetLocation);
-    insert(215, "Location", R_LOCATION, {R_VECTOR, R_FLOAT}, &CreateLocation);
-    insert(216, "ApplyEffectAtLocation", R_VOID, {R_INT, R_EFFECT, R_LOCATION, R_FLOAT}, &ApplyEffectAtLocation);
-    insert(217, "GetIsPC", R_INT, {R_OBJECT}, &GetIsPC);
-    insert(218, "FeetToMeters", R_FLOAT, {R_FLOAT}, &FeetToMeters);
-    insert(219, "YardsToMeters", R_FLOAT, {R_FLOAT}, &YardsToMeters);
-    insert(220, "ApplyEffectToObject", R_VOID, {R_INT, R_EFFECT, R_OBJECT, R_FLOAT}, &ApplyEffectToObject);
-    insert(221, "SpeakString", R_VOID, {R_STRING, R_INT}, &SpeakString);
-    insert(222, "GetSpellTargetLocation", R_LOCATION, {}, &GetSpellTargetLocation);
-    insert(223, "GetPositionFromLocation", R_VECTOR, {R_LOCATION}, &GetPositionFromLocation);
-    insert(225, "GetFacingFromLocation", R_FLOAT, {R_LOCATION}, &GetFacingFromLocation);
-    insert(226, "GetNearestCreatureToLocation", R_OBJECT, {R_INT, R_INT, R_LOCATION, R_INT, R_INT, R_INT, R_INT, R_INT}, &GetNearestCreatureToLocation);
-    insert(227, "GetNearestObject", R_OBJECT, {R_INT, R_OBJECT, R_INT}, &GetNearestObject);
-    insert(228, "GetNearestObjectToLocation", R_OBJECT, {R_INT, R_LOCATION, R_INT}, &GetNearestObjectToLocation);
-    insert(229, "GetNearestObjectByTag", R_OBJECT, {R_STRING, R_OBJECT, R_INT}, &GetNearestObjectByTag);
-    insert(230, "IntToFloat", R_FLOAT, {R_INT}, &IntToFloat);
-    insert(231, "FloatToInt", R_INT, {R_FLOAT}, &FloatToInt);
-    insert(232, "StringToInt", R_INT, {R_STRING}, &StringToInt);
-    insert(233, "StringToFloat", R_FLOAT, {R_STRING}, &StringToFloat);
-    insert(235, "GetIsEnemy", R_INT, {R_OBJECT, R_OBJECT}, &GetIsEnemy);
-    insert(236, "GetIsFriend", R_INT, {R_OBJECT, R_OBJECT}, &GetIsFriend);
-    insert(237, "GetIsNeutral", R_INT, {R_OBJECT, R_OBJECT}, &GetIsNeutral);
-    insert(238, "GetPCSpeaker", R_OBJECT, {}, &GetPCSpeaker);
-    insert(239, "GetStringByStrRef", R_STRING, {R_INT}, &GetStringByStrRef);
-    insert(241, "DestroyObject", R_VOID, {R_OBJECT, R_FLOAT, R_INT, R_FLOAT}, &DestroyObject);
-    insert(242, "GetModule", R_OBJECT, {}, &GetModule);
-    insert(243, "CreateObject", R_OBJECT, {R_INT, R_STRING, R_LOCATION, R_INT}, &CreateObject);
-    insert(244, "EventSpellCastAt", R_EVENT, {R_OBJECT, R_INT, R_INT}, &EventSpellCastAt);
-    insert(245, "GetLastSpellCaster", R_OBJECT, {}, &GetLastSpellCaster);
-    insert(246, "GetLastSpell", R_INT, {}, &GetLastSpell);
-    insert(247, "GetUserDefinedEventNumber", R_INT, {}, &GetUserDefinedEventNumber);
-    insert(248, "GetSpellId", R_INT, {}, &GetSpellId);
-    insert(249, "RandomName", R_STRING, {}, &RandomName);
-    insert(251, "GetLoadFromSaveGame", R_INT, {}, &GetLoadFromSaveGame);
-    insert(253, "GetName", R_STRING, {R_OBJECT}, &GetName);
-    insert(254, "GetLastSpeaker", R_OBJECT, {}, &GetLastSpeaker);
-    insert(255, "BeginConversation", R_INT, {R_STRING, R_OBJECT}, &BeginConversation);
-    insert(256, "GetLastPerceived", R_OBJECT, {}, &GetLastPerceived);
-    insert(257, "GetLastPerceptionHeard", R_INT, {}, &GetLastPerceptionHeard);
-    insert(258, "GetLastPerceptionInaudible", R_INT, {}, &GetLastPerceptionInaudible);
-    insert(259, "GetLastPerceptionSeen", R_INT, {}, &GetLastPerceptionSeen);
-    insert(260, "GetLastClosedBy", R_OBJECT, {}, &GetLastClosedBy);
-    insert(261, "GetLastPerceptionVanished", R_INT, {}, &GetLastPerceptionVanished);
-    insert(262, "GetFirstInPersistentObject", R_OBJECT, {R_OBJECT, R_INT, R_INT}, &GetFirstInPersistentObject);
-    insert(263, "GetNextInPersistentObject", R_OBJECT, {R_OBJECT, R_INT, R_INT}, &GetNextInPersistentObject);
-    insert(264, "GetAreaOfEffectCreator", R_OBJECT, {R_OBJECT}, &GetAreaOfEffectCreator);
-    insert(265, "ShowLevelUpGUI", R_INT, {}, &ShowLevelUpGUI);
-    insert(266, "SetItemNonEquippable", R_VOID, {R_OBJECT, R_INT}, &SetItemNonEquippable);
-    insert(267, "GetButtonMashCheck", R_INT, {}, &GetButtonMashCheck);
-    insert(268, "SetButtonMashCheck", R_VOID, {R_INT}, &SetButtonMashCheck);
-    insert(271, "GiveItem", R_VOID, {R_OBJECT, R_OBJECT}, &GiveItem);
-    insert(272, "ObjectToString", R_STRING, {R_OBJECT}, &ObjectToString);
-    insert(274, "GetIsImmune", R_INT, {R_OBJECT, R_INT, R_OBJECT}, &GetIsImmune);
-    insert(276, "GetEncounterActive", R_INT, {R_OBJECT}, &GetEncounterActive);
-    insert(277, "SetEncounterActive", R_VOID, {R_INT, R_OBJECT}, &SetEncounterActive);
-    insert(278, "GetEncounterSpawnsMax", R_INT, {R_OBJECT}, &GetEncounterSpawnsMax);
-    insert(279, "SetEncounterSpawnsMax", R_VOID, {R_INT, R_OBJECT}, &SetEncounterSpawnsMax);
-    insert(280, "GetEncounterSpawnsCurrent", R_INT, {R_OBJECT}, &GetEncounterSpawnsCurrent);
-    insert(281, "SetEncounterSpawnsCurrent", R_VOID, {R_INT, R_OBJECT}, &SetEncounterSpawnsCurrent);
-    insert(282, "GetModuleItemAcquired", R_OBJECT, {}, &GetModuleItemAcquired);
-    insert(283, "GetModuleItemAcquiredFrom", R_OBJECT, {}, &GetModuleItemAcquiredFrom);
-    insert(284, "SetCustomToken", R_VOID, {R_INT, R_STRING}, &SetCustomToken);
-    insert(285, "GetHasFeat", R_INT, {R_INT, R_OBJECT}, &GetHasFeat);
-    insert(286, "GetHasSkill", R_INT, {R_INT, R_OBJECT}, &GetHasSkill);
-    insert(289, "GetObjectSeen", R_INT, {R_OBJECT, R_OBJECT}, &GetObjectSeen);
-    insert(290, "GetObjectHeard", R_INT, {R_OBJECT, R_OBJECT}, &GetObjectHeard);
-    insert(291, "GetLastPlayerDied", R_OBJECT, {}, &GetLastPlayerDied);
-    insert(292, "GetModuleItemLost", R_OBJECT, {}, &GetModuleItemLost);
-    insert(293, "GetModuleItemLostBy", R_OBJECT, {}, &GetModuleItemLostBy);
-    insert(295, "EventConversation", R_EVENT, {}, &EventConversation);
-    insert(296, "SetEncounterDifficulty", R_VOID, {R_INT, R_OBJECT}, &SetEncounterDifficulty);
-    insert(297, "GetEncounterDifficulty", R_INT, {R_OBJECT}, &GetEncounterDifficulty);
-    insert(298, "GetDistanceBetweenLocations", R_FLOAT, {R_LOCATION, R_LOCATION}, &GetDistanceBetweenLocations);
-    insert(299, "GetReflexAdjustedDamage", R_INT, {R_INT, R_OBJECT, R_INT, R_INT, R_OBJECT}, &GetReflexAdjustedDamage);
-    insert(300, "PlayAnimation", R_VOID, {R_INT, R_FLOAT, R_FLOAT}, &PlayAnimation);
-    insert(301, "TalentSpell", R_TALENT, {R_INT}, &TalentSpell);
-    insert(302, "TalentFeat", R_TALENT, {R_INT}, &TalentFeat);
-    insert(303, "TalentSkill", R_TALENT, {R_INT}, &TalentSkill);
-    insert(304, "GetHasSpellEffect", R_INT, {R_INT, R_OBJECT}, &GetHasSpellEffect);
-    insert(305, "GetEffectSpellId", R_INT, {R_EFFECT}, &GetEffectSpellId);
-    insert(306, "GetCreatureHasTalent", R_INT, {R_TALENT, R_OBJECT}, &GetCreatureHasTalent);
-    insert(307, "GetCreatureTalentRandom", R_TALENT, {R_INT, R_OBJECT, R_INT}, &GetCreatureTalentRandom);
-    insert(308, "GetCreatureTalentBest", R_TALENT, {R_INT, R_INT, R_OBJECT, R_INT, R_INT, R_INT}, &GetCreatureTalentBest);
-    insert(311, "GetGoldPieceValue", R_INT, {R_OBJECT}, &GetGoldPieceValue);
-    insert(312, "GetIsPlayableRacialType", R_INT, {R_OBJECT}, &GetIsPlayableRacialType);
-    insert(313, "JumpToLocation", R_VOID, {R_LOCATION}, &JumpToLocation);
-    insert(315, "GetSkillRank", R_INT, {R_INT, R_OBJECT}, &GetSkillRank);
-    insert(316, "GetAttackTarget", R_OBJECT, {R_OBJECT}, &GetAttackTarget);
-    insert(317, "GetLastAttackType", R_INT, {R_OBJECT}, &GetLastAttackType);
-    insert(318, "GetLastAttackMode", R_INT, {R_OBJECT}, &GetLastAttackMode);
-    insert(319, "GetDistanceBetween2D", R_FLOAT, {R_OBJECT, R_OBJECT}, &GetDistanceBetween2D);
-    insert(320, "GetIsInCombat", R_INT, {R_OBJECT}, &GetIsInCombat);
-    insert(321, "GetLastAssociateCommand", R_INT, {R_OBJECT}, &GetLastAssociateCommand);
-    insert(322, "GiveGoldToCreature", R_VOID, {R_OBJECT, R_INT}, &GiveGoldToCreature);
-    insert(323, "SetIsDestroyable", R_VOID, {R_INT, R_INT, R_INT}, &SetIsDestroyable);
-    insert(324, "SetLocked", R_VOID, {R_OBJECT, R_INT}, &SetLocked);
-    insert(325, "GetLocked", R_INT, {R_OBJECT}, &GetLocked);
-    insert(326, "GetClickingObject", R_OBJECT, {}, &GetClickingObject);
-    insert(327, "SetAssociateListenPatterns", R_VOID, {R_OBJECT}, &SetAssociateListenPatterns);
-    insert(328, "GetLastWeaponUsed", R_OBJECT, {R_OBJECT}, &GetLastWeaponUsed);
-    insert(330, "GetLastUsedBy", R_OBJECT, {}, &GetLastUsedBy);
-    insert(331, "GetAbilityModifier", R_INT, {R_INT, R_OBJECT}, &GetAbilityModifier);
-    insert(332, "GetIdentified", R_INT, {R_OBJECT}, &GetIdentified);
-    insert(333, "SetIdentified", R_VOID, {R_OBJECT, R_INT}, &SetIdentified);
-    insert(334, "GetDistanceBetweenLocations2D", R_FLOAT, {R_LOCATION, R_LOCATION}, &GetDistanceBetweenLocations2D);
-    insert(335, "GetDistanceToObject2D", R_FLOAT, {R_OBJECT}, &GetDistanceToObject2D);
-    insert(336, "GetBlockingDoor", R_OBJECT, {}, &GetBlockingDoor);
-    insert(337, "GetIsDoorActionPossible", R_INT, {R_OBJECT, R_INT}, &GetIsDoorActionPossible);
-    insert(338, "DoDoorAction", R_VOID, {R_OBJECT, R_INT}, &DoDoorAction);
-    insert(339, "GetFirstItemInInventory", R_OBJECT, {R_OBJECT}, &GetFirstItemInInventory);
-    insert(340, "GetNextItemInInventory", R_OBJECT, {R_OBJECT}, &GetNextItemInInventory);
-    insert(341, "GetClassByPosition", R_INT, {R_INT, R_OBJECT}, &GetClassByPosition);
-    insert(342, "GetLevelByPosition", R_INT, {R_INT, R_OBJECT}, &GetLevelByPosition);
-    insert(343, "GetLevelByClass", R_INT, {R_INT, R_OBJECT}, &GetLevelByClass);
-    insert(344, "GetDamageDealtByType", R_INT, {R_INT}, &GetDamageDealtByType);
-    insert(345, "GetTotalDamageDealt", R_INT, {}, &GetTotalDamageDealt);
-    insert(346, "GetLastDamager", R_OBJECT, {}, &GetLastDamager);
-    insert(347, "GetLastDisarmed", R_OBJECT, {}, &GetLastDisarmed);
-    insert(348, "GetLastDisturbed", R_OBJECT, {}, &GetLastDisturbed);
-    insert(349, "GetLastLocked", R_OBJECT, {}, &GetLastLocked);
-    insert(350, "GetLastUnlocked", R_OBJECT, {}, &GetLastUnlocked);
-    insert(352, "GetInventoryDisturbType", R_INT, {}, &GetInventoryDisturbType);
-    insert(353, "GetInventoryDisturbItem", R_OBJECT, {}, &GetInventoryDisturbItem);
-    insert(354, "ShowUpgradeScreen", R_VOID, {R_OBJECT}, &ShowUpgradeScreen);
-    insert(355, "VersusAlignmentEffect", R_EFFECT, {R_EFFECT, R_INT, R_INT}, &VersusAlignmentEffect);
-    insert(356, "VersusRacialTypeEffect", R_EFFECT, {R_EFFECT, R_INT}, &VersusRacialTypeEffect);
-    insert(357, "VersusTrapEffect", R_EFFECT, {R_EFFECT}, &VersusTrapEffect);
-    insert(358, "GetGender", R_INT, {R_OBJECT}, &GetGender);
-    insert(359, "GetIsTalentValid", R_INT, {R_TALENT}, &GetIsTalentValid);
-    insert(361, "GetAttemptedAttackTarget", R_OBJECT, {}, &GetAttemptedAttackTarget);
-    insert(362, "GetTypeFromTalent", R_INT, {R_TALENT}, &GetTypeFromTalent);
-    insert(363, "GetIdFromTalent", R_INT, {R_TALENT}, &GetIdFromTalent);
-    insert(364, "PlayPazaak", R_VOID, {R_INT, R_STRING, R_INT, R_INT, R_OBJECT}, &PlayPazaak);
-    insert(365, "GetLastPazaakResult", R_INT, {}, &GetLastPazaakResult);
-    insert(366, "DisplayFeedBackText", R_VOID, {R_OBJECT, R_INT}, &DisplayFeedBackText);
-    insert(367, "AddJournalQuestEntry", R_VOID, {R_STRING, R_INT, R_INT}, &AddJournalQuestEntry);
-    insert(368, "RemoveJournalQuestEntry", R_VOID, {R_STRING}, &RemoveJournalQuestEntry);
-    insert(369, "GetJournalEntry", R_INT, {R_STRING}, &GetJournalEntry);
-    insert(370, "PlayRumblePattern", R_INT, {R_INT}, &PlayRumblePattern);
-    insert(371, "StopRumblePattern", R_INT, {R_INT}, &StopRumblePattern);
-    insert(374, "SendMessageToPC", R_VOID, {R_OBJECT, R_STRING}, &SendMessageToPC);
-    insert(375, "GetAttemptedSpellTarget", R_OBJECT, {}, &GetAttemptedSpellTarget);
-    insert(376, "GetLastOpenedBy", R_OBJECT, {}, &GetLastOpenedBy);
-    insert(377, "GetHasSpell", R_INT, {R_INT, R_OBJECT}, &GetHasSpell);
-    insert(378, "OpenStore", R_VOID, {R_OBJECT, R_OBJECT, R_INT, R_INT}, &OpenStore);
-    insert(380, "GetFirstFactionMember", R_OBJECT, {R_OBJECT, R_INT}, &GetFirstFactionMember);
-    insert(381, "GetNextFactionMember", R_OBJECT, {R_OBJECT, R_INT}, &GetNextFactionMember);
-    insert(384, "GetJournalQuestExperience", R_INT, {R_STRING}, &GetJournalQuestExperience);
-    insert(385, "JumpToObject", R_VOID, {R_OBJECT, R_INT}, &JumpToObject);
-    insert(386, "SetMapPinEnabled", R_VOID, {R_OBJECT, R_INT}, &SetMapPinEnabled);
-    insert(388, "PopUpGUIPanel", R_VOID, {R_OBJECT, R_INT}, &PopUpGUIPanel);
-    insert(389, "AddMultiClass", R_VOID, {R_INT, R_OBJECT}, &AddMultiClass);
-    insert(390, "GetIsLinkImmune", R_INT, {R_OBJECT, R_EFFECT}, &GetIsLinkImmune);
-    insert(393, "GiveXPToCreature", R_VOID, {R_OBJECT, R_INT}, &GiveXPToCreature);
-    insert(394, "SetXP", R_VOID, {R_OBJECT, R_INT}, &SetXP);
-    insert(395, "GetXP", R_INT, {R_OBJECT}, &GetXP);
-    insert(396, "IntToHexString", R_STRING, {R_INT}, &IntToHexString);
-    insert(397, "GetBaseItemType", R_INT, {R_OBJECT}, &GetBaseItemType);
-    insert(398, "GetItemHasItemProperty", R_INT, {R_OBJECT, R_INT}, &GetItemHasItemProperty);
-    insert(401, "GetItemACValue", R_INT, {R_OBJECT}, &GetItemACValue);
-    insert(403, "ExploreAreaForPlayer", R_VOID, {R_OBJECT, R_OBJECT}, &ExploreAreaForPlayer);
-    insert(405, "GetIsDay", R_INT, {}, &GetIsDay);
-    insert(406, "GetIsNight", R_INT, {}, &GetIsNight);
-    insert(407, "GetIsDawn", R_INT, {}, &GetIsDawn);
-    insert(408, "GetIsDusk", R_INT, {}, &GetIsDusk);
-    insert(409, "GetIsEncounterCreature", R_INT, {R_OBJECT}, &GetIsEncounterCreature);
-    insert(410, "GetLastPlayerDying", R_OBJECT, {}, &GetLastPlayerDying);
-    insert(411, "GetStartingLocation", R_LOCATION, {}, &GetStartingLocation);
-    insert(412, "ChangeToStandardFaction", R_VOID, {R_OBJECT, R_INT}, &ChangeToStandardFaction);
-    insert(413, "SoundObjectPlay", R_VOID, {R_OBJECT}, &SoundObjectPlay);
-    insert(414, "SoundObjectStop", R_VOID, {R_OBJECT}, &SoundObjectStop);
-    insert(415, "SoundObjectSetVolume", R_VOID, {R_OBJECT, R_INT}, &SoundObjectSetVolume);
-    insert(416, "SoundObjectSetPosition", R_VOID, {R_OBJECT, R_VECTOR}, &SoundObjectSetPosition);
-    insert(417, "SpeakOneLinerConversation", R_VOID, {R_STRING, R_OBJECT}, &SpeakOneLinerConversation);
-    insert(418, "GetGold", R_INT, {R_OBJECT}, &GetGold);
-    insert(419, "GetLastRespawnButtonPresser", R_OBJECT, {}, &GetLastRespawnButtonPresser);
-    insert(421, "SetLightsaberPowered", R_VOID, {R_OBJECT, R_INT, R_INT, R_INT}, &SetLightsaberPowered);
-    insert(422, "GetIsWeaponEffective", R_INT, {R_OBJECT, R_INT}, &GetIsWeaponEffective);
-    insert(423, "GetLastSpellHarmful", R_INT, {}, &GetLastSpellHarmful);
-    insert(424, "EventActivateItem", R_EVENT, {R_OBJECT, R_LOCATION, R_OBJECT}, &EventActivateItem);
-    insert(425, "MusicBackgroundPlay", R_VOID, {R_OBJECT}, &MusicBackgroundPlay);
-    insert(426, "MusicBackgroundStop", R_VOID, {R_OBJECT}, &MusicBackgroundStop);
-    insert(427, "MusicBackgroundSetDelay", R_VOID, {R_OBJECT, R_INT}, &MusicBackgroundSetDelay);
-    insert(428, "MusicBackgroundChangeDay", R_VOID, {R_OBJECT, R_INT}, &MusicBackgroundChangeDay);
-    insert(429, "MusicBackgroundChangeNight", R_VOID, {R_OBJECT, R_INT}, &MusicBackgroundChangeNight);
-    insert(430, "MusicBattlePlay", R_VOID, {R_OBJECT}, &MusicBattlePlay);
-    insert(431, "MusicBattleStop", R_VOID, {R_OBJECT}, &MusicBattleStop);
-    insert(432, "MusicBattleChange", R_VOID, {R_OBJECT, R_INT}, &MusicBattleChange);
-    insert(433, "AmbientSoundPlay", R_VOID, {R_OBJECT}, &AmbientSoundPlay);
-    insert(434, "AmbientSoundStop", R_VOID, {R_OBJECT}, &AmbientSoundStop);
-    insert(435, "AmbientSoundChangeDay", R_VOID, {R_OBJECT, R_INT}, &AmbientSoundChangeDay);
-    insert(436, "AmbientSoundChangeNight", R_VOID, {R_OBJECT, R_INT}, &AmbientSoundChangeNight);
-    insert(437, "GetLastKiller", R_OBJECT, {}, &GetLastKiller);
-    insert(438, "GetSpellCastItem", R_OBJECT, {}, &GetSpellCastItem);
-    insert(439, "GetItemActivated", R_OBJECT, {}, &GetItemActivated);
-    insert(440, "GetItemActivator", R_OBJECT, {}, &GetItemActivator);
-    insert(441, "GetItemActivatedTargetLocation", R_LOCATION, {}, &GetItemActivatedTargetLocation);
-    insert(442, "GetItemActivatedTarget", R_OBJECT, {}, &GetItemActivatedTarget);
-    insert(443, "GetIsOpen", R_INT, {R_OBJECT}, &GetIsOpen);
-    insert(444, "TakeGoldFromCreature", R_VOID, {R_INT, R_OBJECT, R_INT}, &TakeGoldFromCreature);
-    insert(445, "GetIsInConversation", R_INT, {R_OBJECT}, &GetIsInConversation);
-    insert(455, "GetPlotFlag", R_INT, {R_OBJECT}, &GetPlotFlag);
-    insert(456, "SetPlotFlag", R_VOID, {R_OBJECT, R_INT}, &SetPlotFlag);
-    insert(461, "SetDialogPlaceableCamera", R_VOID, {R_INT}, &SetDialogPlaceableCamera);
-    insert(462, "GetSoloMode", R_INT, {}, &GetSoloMode);
-    insert(464, "GetMaxStealthXP", R_INT, {}, &GetMaxStealthXP);
-    insert(468, "SetMaxStealthXP", R_VOID, {R_INT}, &SetMaxStealthXP);
-    insert(474, "GetCurrentStealthXP", R_INT, {}, &GetCurrentStealthXP);
-    insert(475, "GetNumStackedItems", R_INT, {R_OBJECT}, &GetNumStackedItems);
-    insert(476, "SurrenderToEnemies", R_VOID, {}, &SurrenderToEnemies);
-    insert(478, "SetCurrentStealthXP", R_VOID, {R_INT}, &SetCurrentStealthXP);
-    insert(479, "GetCreatureSize", R_INT, {R_OBJECT}, &GetCreatureSize);
-    insert(480, "AwardStealthXP", R_VOID, {R_OBJECT}, &AwardStealthXP);
-    insert(481, "GetStealthXPEnabled", R_INT, {}, &GetStealthXPEnabled);
-    insert(482, "SetStealthXPEnabled", R_VOID, {R_INT}, &SetStealthXPEnabled);
-    insert(486, "GetLastTrapDetected", R_OBJECT, {R_OBJECT}, &GetLastTrapDetected);
-    insert(488, "GetNearestTrapToObject", R_OBJECT, {R_OBJECT, R_INT}, &GetNearestTrapToObject);
-    insert(489, "GetAttemptedMovementTarget", R_OBJECT, {}, &GetAttemptedMovementTarget);
-    insert(490, "GetBlockingCreature", R_OBJECT, {R_OBJECT}, &GetBlockingCreature);
-    insert(491, "GetFortitudeSavingThrow", R_INT, {R_OBJECT}, &GetFortitudeSavingThrow);
-    insert(492, "GetWillSavingThrow", R_INT, {R_OBJECT}, &GetWillSavingThrow);
-    insert(493, "GetReflexSavingThrow", R_INT, {R_OBJECT}, &GetReflexSavingThrow);
-    insert(494, "GetChallengeRating", R_FLOAT, {R_OBJECT}, &GetChallengeRating);
-    insert(495, "GetFoundEnemyCreature", R_OBJECT, {R_OBJECT}, &GetFoundEnemyCreature);
-    insert(496, "GetMovementRate", R_INT, {R_OBJECT}, &GetMovementRate);
-    insert(497, "GetSubRace", R_INT, {R_OBJECT}, &GetSubRace);
-    insert(498, "GetStealthXPDecrement", R_INT, {}, &GetStealthXPDecrement);
-    insert(499, "SetStealthXPDecrement", R_VOID, {R_INT}, &SetStealthXPDecrement);
-    insert(500, "DuplicateHeadAppearance", R_VOID, {R_OBJECT, R_OBJECT}, &DuplicateHeadAppearance);
-    insert(503, "CutsceneAttack", R_VOID, {R_OBJECT, R_INT, R_INT, R_INT}, &CutsceneAttack);
-    insert(504, "SetCameraMode", R_VOID, {R_OBJECT, R_INT}, &SetCameraMode);
-    insert(505, "SetLockOrientationInDialog", R_VOID, {R_OBJECT, R_INT}, &SetLockOrientationInDialog);
-    insert(506, "SetLockHeadFollowInDialog", R_VOID, {R_OBJECT, R_INT}, &SetLockHeadFollowInDialog);
-    insert(507, "CutsceneMove", R_VOID, {R_OBJECT, R_VECTOR, R_INT}, &CutsceneMove);
-    insert(508, "EnableVideoEffect", R_VOID, {R_INT}, &EnableVideoEffect);
-    insert(509, "StartNewModule", R_VOID, {R_STRING, R_STRING, R_STRING, R_STRING, R_STRING, R_STRING, R_STRING, R_STRING}, &StartNewModule);
-    insert(510, "DisableVideoEffect", R_VOID, {}, &DisableVideoEffect);
-    insert(511, "GetWeaponRanged", R_INT, {R_OBJECT}, &GetWeaponRanged);
-    insert(512, "DoSinglePlayerAutoSave", R_VOID, {}, &DoSinglePlayerAutoSave);
-    insert(513, "GetGameDifficulty", R_INT, {}, &GetGameDifficulty);
-    insert(514, "GetUserActionsPending", R_INT, {}, &GetUserActionsPending);
-    insert(515, "RevealMap", R_VOID, {R_VECTOR, R_INT}, &RevealMap);
-    insert(516, "SetTutorialWindowsEnabled", R_VOID, {R_INT}, &SetTutorialWindowsEnabled);
-    insert(517, "ShowTutorialWindow", R_VOID, {R_INT}, &ShowTutorialWindow);
-    insert(518, "StartCreditSequence", R_VOID, {R_INT}, &StartCreditSequence);
-    insert(519, "IsCreditSequenceInProgress", R_INT, {}, &IsCreditSequenceInProgress);
-    insert(522, "GetCurrentAction", R_INT, {R_OBJECT}, &GetCurrentAction);
-    insert(523, "GetDifficultyModifier", R_FLOAT, {}, &GetDifficultyModifier);
-    insert(524, "GetAppearanceType", R_INT, {R_OBJECT}, &GetAppearanceType);
-    insert(525, "FloatingTextStrRefOnCreature", R_VOID, {R_INT, R_OBJECT, R_INT}, &FloatingTextStrRefOnCreature);
-    insert(526, "FloatingTextStringOnCreature", R_VOID, {R_STRING, R_OBJECT, R_INT}, &FloatingTextStringOnCreature);
-    insert(527, "GetTrapDisarmable", R_INT, {R_OBJECT}, &GetTrapDisarmable);
-    insert(528, "GetTrapDetectable", R_INT, {R_OBJECT}, &GetTrapDetectable);
-    insert(529, "GetTrapDetectedBy", R_INT, {R_OBJECT, R_OBJECT}, &GetTrapDetectedBy);
-    insert(530, "GetTrapFlagged", R_INT, {R_OBJECT}, &GetTrapFlagged);
-    insert(531, "GetTrapBaseType", R_INT, {R_OBJECT}, &GetTrapBaseType);
-    insert(532, "GetTrapOneShot", R_INT, {R_OBJECT}, &GetTrapOneShot);
-    insert(533, "GetTrapCreator", R_OBJECT, {R_OBJECT}, &GetTrapCreator);
-    insert(534, "GetTrapKeyTag", R_STRING, {R_OBJECT}, &GetTrapKeyTag);
-    insert(535, "GetTrapDisarmDC", R_INT, {R_OBJECT}, &GetTrapDisarmDC);
-    insert(536, "GetTrapDetectDC", R_INT, {R_OBJECT}, &GetTrapDetectDC);
-    insert(537, "GetLockKeyRequired", R_INT, {R_OBJECT}, &GetLockKeyRequired);
-    insert(538, "GetLockKeyTag", R_INT, {R_OBJECT}, &GetLockKeyTag);
-    insert(539, "GetLockLockable", R_INT, {R_OBJECT}, &GetLockLockable);
-    insert(540, "GetLockUnlockDC", R_INT, {R_OBJECT}, &GetLockUnlockDC);
-    insert(541, "GetLockLockDC", R_INT, {R_OBJECT}, &GetLockLockDC);
-    insert(542, "GetPCLevellingUp", R_OBJECT, {}, &GetPCLevellingUp);
-    insert(543, "GetHasFeatEffect", R_INT, {R_INT, R_OBJECT}, &GetHasFeatEffect);
-    insert(544, "SetPlaceableIllumination", R_VOID, {R_OBJECT, R_INT}, &SetPlaceableIllumination);
-    insert(545, "GetPlaceableIllumination", R_INT, {R_OBJECT}, &GetPlaceableIllumination);
-    insert(546, "GetIsPlaceableObjectActionPossible", R_INT, {R_OBJECT, R_INT}, &GetIsPlaceableObjectActionPossible);
-    insert(547, "DoPlaceableObjectAction", R_VOID, {R_OBJECT, R_INT}, &DoPlaceableObjectAction);
-    insert(548, "GetFirstPC", R_OBJECT, {}, &GetFirstPC);
-    insert(549, "GetNextPC", R_OBJECT, {}, &GetNextPC);
-    insert(550, "SetTrapDetectedBy", R_INT, {R_OBJECT, R_OBJECT}, &SetTrapDetectedBy);
-    insert(551, "GetIsTrapped", R_INT, {R_OBJECT}, &GetIsTrapped);
-    insert(552, "SetEffectIcon", R_EFFECT, {R_EFFECT, R_INT}, &SetEffectIcon);
-    insert(553, "FaceObjectAwayFromObject", R_VOID, {R_OBJECT, R_OBJECT}, &FaceObjectAwayFromObject);
-    insert(554, "PopUpDeathGUIPanel", R_VOID, {R_OBJECT, R_INT, R_INT, R_INT, R_STRING}, &PopUpDeathGUIPanel);
-    insert(555, "SetTrapDisabled", R_VOID, {R_OBJECT}, &SetTrapDisabled);
-    insert(556, "GetLastHostileActor", R_OBJECT, {R_OBJECT}, &GetLastHostileActor);
-    insert(557, "ExportAllCharacters", R_VOID, {}, &ExportAllCharacters);
-    insert(558, "MusicBackgroundGetDayTrack", R_INT, {R_OBJECT}, &MusicBackgroundGetDayTrack);
-    insert(559, "MusicBackgroundGetNightTrack", R_INT, {R_OBJECT}, &MusicBackgroundGetNightTrack);
-    insert(560, "WriteTimestampedLogEntry", R_VOID, {R_STRING}, &WriteTimestampedLogEntry);
-    insert(561, "GetModuleName", R_STRING, {}, &GetModuleName);
-    insert(562, "GetFactionLeader", R_OBJECT, {R_OBJECT}, &GetFactionLeader);
-    insert(564, "EndGame", R_VOID, {R_INT}, &EndGame);
-    insert(565, "GetRunScriptVar", R_INT, {}, &GetRunScriptVar);
-    insert(566, "GetCreatureMovmentType", R_INT, {R_OBJECT}, &GetCreatureMovmentType);
-    insert(567, "AmbientSoundSetDayVolume", R_VOID, {R_OBJECT, R_INT}, &AmbientSoundSetDayVolume);
-    insert(568, "AmbientSoundSetNightVolume", R_VOID, {R_OBJECT, R_INT}, &AmbientSoundSetNightVolume);
-    insert(569, "MusicBackgroundGetBattleTrack", R_INT, {R_OBJECT}, &MusicBackgroundGetBattleTrack);
-    insert(570, "GetHasInventory", R_INT, {R_OBJECT}, &GetHasInventory);
-    insert(571, "GetStrRefSoundDuration", R_FLOAT, {R_INT}, &GetStrRefSoundDuration);
-    insert(572, "AddToParty", R_VOID, {R_OBJECT, R_OBJECT}, &AddToParty);
-    insert(573, "RemoveFromParty", R_VOID, {R_OBJECT}, &RemoveFromParty);
-    insert(574, "AddPartyMember", R_INT, {R_INT, R_OBJECT}, &AddPartyMember);
-    insert(575, "RemovePartyMember", R_INT, {R_INT}, &RemovePartyMember);
-    insert(576, "IsObjectPartyMember", R_INT, {R_OBJECT}, &IsObjectPartyMember);
-    insert(577, "GetPartyMemberByIndex", R_OBJECT, {R_INT}, &GetPartyMemberByIndex);
-    insert(578, "GetGlobalBoolean", R_INT, {R_STRING}, &GetGlobalBoolean);
-    insert(579, "SetGlobalBoolean", R_VOID, {R_STRING, R_INT}, &SetGlobalBoolean);
-    insert(580, "GetGlobalNumber", R_INT, {R_STRING}, &GetGlobalNumber);
-    insert(581, "SetGlobalNumber", R_VOID, {R_STRING, R_INT}, &SetGlobalNumber);
-    insert(582, "AurPostString", R_VOID, {R_STRING, R_INT, R_INT, R_FLOAT}, &AurPostString);
-    insert(669, "AddJournalWorldEntry", R_VOID, {R_INT, R_STRING, R_STRING}, &AddJournalWorldEntry);
-    insert(670, "AddJournalWorldEntryStrref", R_VOID, {R_INT, R_INT}, &AddJournalWorldEntryStrref);
-    insert(671, "BarkString", R_VOID, {R_OBJECT, R_INT}, &BarkString);
-    insert(672, "DeleteJournalWorldAllEntries", R_VOID, {}, &DeleteJournalWorldAllEntries);
-    insert(673, "DeleteJournalWorldEntry", R_VOID, {R_INT}, &DeleteJournalWorldEntry);
-    insert(674, "DeleteJournalWorldEntryStrref", R_VOID, {R_INT}, &DeleteJournalWorldEntryStrref);
-    insert(677, "PlayVisualAreaEffect", R_VOID, {R_INT, R_LOCATION}, &PlayVisualAreaEffect);
-    insert(678, "SetJournalQuestEntryPicture", R_VOID, {R_STRING, R_OBJECT, R_INT, R_INT, R_INT}, &SetJournalQuestEntryPicture);
-    insert(679, "GetLocalBoolean", R_INT, {R_OBJECT, R_INT}, &GetLocalBoolean);
-    insert(680, "SetLocalBoolean", R_VOID, {R_OBJECT, R_INT, R_INT}, &SetLocalBoolean);
-    insert(681, "GetLocalNumber", R_INT, {R_OBJECT, R_INT}, &GetLocalNumber);
-    insert(682, "SetLocalNumber", R_VOID, {R_OBJECT, R_INT, R_INT}, &SetLocalNumber);
-    insert(689, "SoundObjectGetPitchVariance", R_FLOAT, {R_OBJECT}, &SoundObjectGetPitchVariance);
-    insert(690, "SoundObjectSetPitchVariance", R_VOID, {R_OBJECT, R_FLOAT}, &SoundObjectSetPitchVariance);
-    insert(691, "SoundObjectGetVolume", R_INT, {R_OBJECT}, &SoundObjectGetVolume);
-    insert(692, "GetGlobalLocation", R_LOCATION, {R_STRING}, &GetGlobalLocation);
-    insert(693, "SetGlobalLocation", R_VOID, {R_STRING, R_LOCATION}, &SetGlobalLocation);
-    insert(694, "AddAvailableNPCByObject", R_INT, {R_INT, R_OBJECT}, &AddAvailableNPCByObject);
-    insert(695, "RemoveAvailableNPC", R_INT, {R_INT}, &RemoveAvailableNPC);
-    insert(696, "IsAvailableCreature", R_INT, {R_INT}, &IsAvailableCreature);
-    insert(697, "AddAvailableNPCByTemplate", R_INT, {R_INT, R_STRING}, &AddAvailableNPCByTemplate);
-    insert(698, "SpawnAvailableNPC", R_OBJECT, {R_INT, R_LOCATION}, &SpawnAvailableNPC);
-    insert(699, "IsNPCPartyMember", R_INT, {R_INT}, &IsNPCPartyMember);
-    insert(701, "GetIsConversationActive", R_INT, {}, &GetIsConversationActive);
-    insert(704, "GetPartyAIStyle", R_INT, {}, &GetPartyAIStyle);
-    insert(705, "GetNPCAIStyle", R_INT, {R_OBJECT}, &GetNPCAIStyle);
-    insert(706, "SetPartyAIStyle", R_VOID, {R_INT}, &SetPartyAIStyle);
-    insert(707, "SetNPCAIStyle", R_VOID, {R_OBJECT, R_INT}, &SetNPCAIStyle);
-    insert(708, "SetNPCSelectability", R_VOID, {R_INT, R_INT}, &SetNPCSelectability);
-    insert(709, "GetNPCSelectability", R_INT, {R_INT}, &GetNPCSelectability);
-    insert(710, "ClearAllEffects", R_VOID, {}, &ClearAllEffects);
-    insert(711, "GetLastConversation", R_STRING, {}, &GetLastConversation);
-    insert(712, "ShowPartySelectionGUI", R_VOID, {R_STRING, R_INT, R_INT}, &ShowPartySelectionGUI);
-    insert(713, "GetStandardFaction", R_INT, {R_OBJECT}, &GetStandardFaction);
-    insert(714, "GivePlotXP", R_VOID, {R_STRING, R_INT}, &GivePlotXP);
-    insert(715, "GetMinOneHP", R_INT, {R_OBJECT}, &GetMinOneHP);
-    insert(716, "SetMinOneHP", R_VOID, {R_OBJECT, R_INT}, &SetMinOneHP);
-    insert(719, "SetGlobalFadeIn", R_VOID, {R_FLOAT, R_FLOAT, R_FLOAT, R_FLOAT, R_FLOAT}, &SetGlobalFadeIn);
-    insert(720, "SetGlobalFadeOut", R_VOID, {R_FLOAT, R_FLOAT, R_FLOAT, R_FLOAT, R_FLOAT}, &SetGlobalFadeOut);
-    insert(721, "GetLastHostileTarget", R_OBJECT, {R_OBJECT}, &GetLastHostileTarget);
-    insert(722, "GetLastAttackObjectAction", R_INT, {R_OBJECT}, &GetLastAttackObjectAction);
-    insert(723, "GetLastForcePowerUsed", R_INT, {R_OBJECT}, &GetLastForcePowerUsed);
-    insert(724, "GetLastCombatFeatUsed", R_INT, {R_OBJECT}, &GetLastCombatFeatUsed);
-    insert(725, "GetLastAttackResult", R_INT, {R_OBJECT}, &GetLastAttackResult);
-    insert(726, "GetWasForcePowerSuccessful", R_INT, {R_OBJECT}, &GetWasForcePowerSuccessful);
-    insert(727, "GetFirstAttacker", R_OBJECT, {R_OBJECT}, &GetFirstAttacker);
-    insert(728, "GetNextAttacker", R_OBJECT, {R_OBJECT}, &GetNextAttacker);
-    insert(729, "SetFormation", R_VOID, {R_OBJECT, R_OBJECT, R_INT, R_INT}, &SetFormation);
-    insert(731, "SetForcePowerUnsuccessful", R_VOID, {R_INT, R_OBJECT}, &SetForcePowerUnsuccessful);
-    insert(732, "GetIsDebilitated", R_INT, {R_OBJECT}, &GetIsDebilitated);
-    insert(733, "PlayMovie", R_VOID, {R_STRING}, &PlayMovie);
-    insert(734, "SaveNPCState", R_VOID, {R_INT}, &SaveNPCState);
-    insert(735, "GetCategoryFromTalent", R_INT, {R_TALENT}, &GetCategoryFromTalent);
-    insert(736, "SurrenderByFaction", R_VOID, {R_INT, R_INT}, &SurrenderByFaction);
-    insert(737, "ChangeFactionByFaction", R_VOID, {R_INT, R_INT}, &ChangeFactionByFaction);
-    insert(738, "PlayRoomAnimation", R_VOID, {R_STRING, R_INT}, &PlayRoomAnimation);
-    insert(739, "ShowGalaxyMap", R_VOID, {R_INT}, &ShowGalaxyMap);
-    insert(740, "SetPlanetSelectable", R_VOID, {R_INT, R_INT}, &SetPlanetSelectable);
-    insert(741, "GetPlanetSelectable", R_INT, {R_INT}, &GetPlanetSelectable);
-    insert(742, "SetPlanetAvailable", R_VOID, {R_INT, R_INT}, &SetPlanetAvailable);
-    insert(743, "GetPlanetAvailable", R_INT, {R_INT}, &GetPlanetAvailable);
-    insert(744, "GetSelectedPlanet", R_INT, {}, &GetSelectedPlanet);
-    insert(745, "SoundObjectFadeAndStop", R_VOID, {R_OBJECT, R_FLOAT}, &SoundObjectFadeAndStop);
-    insert(746, "SetAreaFogColor", R_VOID, {R_OBJECT, R_FLOAT, R_FLOAT, R_FLOAT}, &SetAreaFogColor);
-    insert(747, "ChangeItemCost", R_VOID, {R_STRING, R_FLOAT}, &ChangeItemCost);
-    insert(748, "GetIsLiveContentAvailable", R_INT, {R_INT}, &GetIsLiveContentAvailable);
-    insert(749, "ResetDialogState", R_VOID, {}, &ResetDialogState);
-    insert(750, "SetGoodEvilValue", R_VOID, {R_OBJECT, R_INT}, &SetGoodEvilValue);
-    insert(751, "GetIsPoisoned", R_INT, {R_OBJECT}, &GetIsPoisoned);
-    insert(752, "GetSpellTarget", R_OBJECT, {R_OBJECT}, &GetSpellTarget);
-    insert(753, "SetSoloMode", R_VOID, {R_INT}, &SetSoloMode);
-    insert(757, "CancelPostDialogCharacterSwitch", R_VOID, {}, &CancelPostDialogCharacterSwitch);
-    insert(758, "SetMaxHitPoints", R_VOID, {R_OBJECT, R_INT}, &SetMaxHitPoints);
-    insert(759, "NoClicksFor", R_VOID, {R_FLOAT}, &NoClicksFor);
-    insert(760, "HoldWorldFadeInForDialog", R_VOID, {}, &HoldWorldFadeInForDialog);
-    insert(761, "ShipBuild", R_INT, {}, &ShipBuild);
-    insert(762, "SurrenderRetainBuffs", R_VOID, {}, &SurrenderRetainBuffs);
-    insert(763, "SuppressStatusSummaryEntry", R_VOID, {R_INT}, &SuppressStatusSummaryEntry);
-    insert(764, "GetCheatCode", R_INT, {R_INT}, &GetCheatCode);
-    insert(765, "SetMusicVolume", R_VOID, {R_FLOAT}, &SetMusicVolume);
-    insert(766, "CreateItemOnFloor", R_OBJECT, {R_STRING, R_LOCATION, R_INT}, &CreateItemOnFloor);
-    insert(767, "SetAvailableNPCId", R_VOID, {R_INT, R_OBJECT}, &SetAvailableNPCId);
-    insert(768, "IsMoviePlaying", R_INT, {}, &IsMoviePlaying);
-    insert(769, "QueueMovie", R_VOID, {R_STRING, R_INT}, &QueueMovie);
-    insert(770, "PlayMovieQueue", R_VOID, {R_INT}, &PlayMovieQueue);
-    insert(771, "YavinHackCloseDoor", R_VOID, {R_OBJECT}, &YavinHackDoorClose);
+    insert(0, "Random", R_INT, {R_INT}, &thunk<&Random>);
+    insert(1, "PrintString", R_VOID, {R_STRING}, &thunk<&PrintString>);
+    insert(2, "PrintFloat", R_VOID, {R_FLOAT, R_INT, R_INT}, &thunk<&PrintFloat>);
+    insert(3, "FloatToString", R_STRING, {R_FLOAT, R_INT, R_INT}, &thunk<&FloatToString>);
+    insert(4, "PrintInteger", R_VOID, {R_INT}, &thunk<&PrintInteger>);
+    insert(5, "PrintObject", R_VOID, {R_OBJECT}, &thunk<&PrintObject>);
+    insert(6, "AssignCommand", R_VOID, {R_OBJECT, R_ACTION}, &thunk<&AssignCommand>);
+    insert(7, "DelayCommand", R_VOID, {R_FLOAT, R_ACTION}, &thunk<&DelayCommand>);
+    insert(8, "ExecuteScript", R_VOID, {R_STRING, R_OBJECT, R_INT}, &thunk<&ExecuteScript>);
+    insert(9, "ClearAllActions", R_VOID, {}, &thunk<&ClearAllActions>);
+    insert(10, "SetFacing", R_VOID, {R_FLOAT}, &thunk<&SetFacing>);
+    insert(11, "SwitchPlayerCharacter", R_INT, {R_INT}, &thunk<&SwitchPlayerCharacter>);
+    insert(12, "SetTime", R_VOID, {R_INT, R_INT, R_INT, R_INT}, &thunk<&SetTime>);
+    insert(13, "SetPartyLeader", R_INT, {R_INT}, &thunk<&SetPartyLeader>);
+    insert(14, "SetAreaUnescapable", R_VOID, {R_INT}, &thunk<&SetAreaUnescapable>);
+    insert(15, "GetAreaUnescapable", R_INT, {}, &thunk<&GetAreaUnescapable>);
+    insert(16, "GetTimeHour", R_INT, {}, &thunk<&GetTimeHour>);
+    insert(17, "GetTimeMinute", R_INT, {}, &thunk<&GetTimeMinute>);
+    insert(18, "GetTimeSecond", R_INT, {}, &thunk<&GetTimeSecond>);
+    insert(19, "GetTimeMillisecond", R_INT, {}, &thunk<&GetTimeMillisecond>);
+    insert(24, "GetArea", R_OBJECT, {R_OBJECT}, &thunk<&GetArea>);
+    insert(25, "GetEnteringObject", R_OBJECT, {}, &thunk<&GetEnteringObject>);
+    insert(26, "GetExitingObject", R_OBJECT, {}, &thunk<&GetExitingObject>);
+    insert(27, "GetPosition", R_VECTOR, {R_OBJECT}, &thunk<&GetPosition>);
+    insert(28, "GetFacing", R_FLOAT, {R_OBJECT}, &thunk<&GetFacing>);
+    insert(29, "GetItemPossessor", R_OBJECT, {R_OBJECT}, &thunk<&GetItemPossessor>);
+    insert(30, "GetItemPossessedBy", R_OBJECT, {R_OBJECT, R_STRING}, &thunk<&GetItemPossessedBy>);
+    insert(31, "CreateItemOnObject", R_OBJECT, {R_STRING, R_OBJECT, R_INT}, &thunk<&CreateItemOnObject>);
+    insert(36, "GetLastAttacker", R_OBJECT, {R_OBJECT}, &thunk<&GetLastAttacker>);
+    insert(38, "GetNearestCreature", R_OBJECT, {R_INT, R_INT, R_OBJECT, R_INT, R_INT, R_INT, R_INT, R_INT}, &thunk<&GetNearestCreature>);
+    insert(41, "GetDistanceToObject", R_FLOAT, {R_OBJECT}, &thunk<&GetDistanceToObject>);
+    insert(42, "GetIsObjectValid", R_INT, {R_OBJECT}, &thunk<&GetIsObjectValid>);
+    insert(45, "SetCameraFacing", R_VOID, {R_FLOAT}, &thunk<&SetCameraFacing>);
+    insert(46, "PlaySound", R_VOID, {R_STRING}, &thunk<&PlaySound>);
+    insert(47, "GetSpellTargetObject", R_OBJECT, {}, &thunk<&GetSpellTargetObject>);
+    insert(49, "GetCurrentHitPoints", R_INT, {R_OBJECT}, &thunk<&GetCurrentHitPoints>);
+    insert(50, "GetMaxHitPoints", R_INT, {R_OBJECT}, &thunk<&GetMaxHitPoints>);
+    insert(52, "GetLastItemEquipped", R_OBJECT, {}, &thunk<&GetLastItemEquipped>);
+    insert(53, "GetSubScreenID", R_INT, {}, &thunk<&GetSubScreenID>);
+    insert(54, "CancelCombat", R_VOID, {R_OBJECT}, &thunk<&CancelCombat>);
+    insert(55, "GetCurrentForcePoints", R_INT, {R_OBJECT}, &thunk<&GetCurrentForcePoints>);
+    insert(56, "GetMaxForcePoints", R_INT, {R_OBJECT}, &thunk<&GetMaxForcePoints>);
+    insert(57, "PauseGame", R_VOID, {R_INT}, &thunk<&PauseGame>);
+    insert(58, "SetPlayerRestrictMode", R_VOID, {R_INT}, &thunk<&SetPlayerRestrictMode>);
+    insert(59, "GetStringLength", R_INT, {R_STRING}, &thunk<&GetStringLength>);
+    insert(60, "GetStringUpperCase", R_STRING, {R_STRING}, &thunk<&GetStringUpperCase>);
+    insert(61, "GetStringLowerCase", R_STRING, {R_STRING}, &thunk<&GetStringLowerCase>);
+    insert(62, "GetStringRight", R_STRING, {R_STRING, R_INT}, &thunk<&GetStringRight>);
+    insert(63, "GetStringLeft", R_STRING, {R_STRING, R_INT}, &thunk<&GetStringLeft>);
+    insert(64, "InsertString", R_STRING, {R_STRING, R_STRING, R_INT}, &thunk<&InsertString>);
+    insert(65, "GetSubString", R_STRING, {R_STRING, R_INT, R_INT}, &thunk<&GetSubString>);
+    insert(66, "FindSubString", R_INT, {R_STRING, R_STRING}, &thunk<&FindSubString>);
+    insert(67, "fabs", R_FLOAT, {R_FLOAT}, &thunk<&fabs>);
+    insert(68, "cos", R_FLOAT, {R_FLOAT}, &thunk<&cos>);
+    insert(69, "sin", R_FLOAT, {R_FLOAT}, &thunk<&sin>);
+    insert(70, "tan", R_FLOAT, {R_FLOAT}, &thunk<&tan>);
+    insert(71, "acos", R_FLOAT, {R_FLOAT}, &thunk<&acos>);
+    insert(72, "asin", R_FLOAT, {R_FLOAT}, &thunk<&asin>);
+    insert(73, "atan", R_FLOAT, {R_FLOAT}, &thunk<&atan>);
+    insert(74, "log", R_FLOAT, {R_FLOAT}, &thunk<&log>);
+    insert(75, "pow", R_FLOAT, {R_FLOAT, R_FLOAT}, &thunk<&pow>);
+    insert(76, "sqrt", R_FLOAT, {R_FLOAT}, &thunk<&sqrt>);
+    insert(77, "abs", R_INT, {R_INT}, &thunk<&abs>);
+    insert(83, "GetPlayerRestrictMode", R_INT, {R_OBJECT}, &thunk<&GetPlayerRestrictMode>);
+    insert(84, "GetCasterLevel", R_INT, {R_OBJECT}, &thunk<&GetCasterLevel>);
+    insert(85, "GetFirstEffect", R_EFFECT, {R_OBJECT}, &thunk<&GetFirstEffect>);
+    insert(86, "GetNextEffect", R_EFFECT, {R_OBJECT}, &thunk<&GetNextEffect>);
+    insert(87, "RemoveEffect", R_VOID, {R_OBJECT, R_EFFECT}, &thunk<&RemoveEffect>);
+    insert(88, "GetIsEffectValid", R_INT, {R_EFFECT}, &thunk<&GetIsEffectValid>);
+    insert(89, "GetEffectDurationType", R_INT, {R_EFFECT}, &thunk<&GetEffectDurationType>);
+    insert(90, "GetEffectSubType", R_INT, {R_EFFECT}, &thunk<&GetEffectSubType>);
+    insert(91, "GetEffectCreator", R_OBJECT, {R_EFFECT}, &thunk<&GetEffectCreator>);
+    insert(92, "IntToString", R_STRING, {R_INT}, &thunk<&IntToString>);
+    insert(93, "GetFirstObjectInArea", R_OBJECT, {R_OBJECT, R_INT}, &thunk<&GetFirstObjectInArea>);
+    insert(94, "GetNextObjectInArea", R_OBJECT, {R_OBJECT, R_INT}, &thunk<&GetNextObjectInArea>);
+    insert(95, "d2", R_INT, {R_INT}, &thunk<&d2>);
+    insert(96, "d3", R_INT, {R_INT}, &thunk<&d3>);
+    insert(97, "d4", R_INT, {R_INT}, &thunk<&d4>);
+    insert(98, "d6", R_INT, {R_INT}, &thunk<&d6>);
+    insert(99, "d8", R_INT, {R_INT}, &thunk<&d8>);
+    insert(100, "d10", R_INT, {R_INT}, &thunk<&d10>);
+    insert(101, "d12", R_INT, {R_INT}, &thunk<&d12>);
+    insert(102, "d20", R_INT, {R_INT}, &thunk<&d20>);
+    insert(103, "d100", R_INT, {R_INT}, &thunk<&d100>);
+    insert(104, "VectorMagnitude", R_FLOAT, {R_VECTOR}, &thunk<&VectorMagnitude>);
+    insert(105, "GetMetaMagicFeat", R_INT, {}, &thunk<&GetMetaMagicFeat>);
+    insert(106, "GetObjectType", R_INT, {R_OBJECT}, &thunk<&GetObjectType>);
+    insert(107, "GetRacialType", R_INT, {R_OBJECT}, &thunk<&GetRacialType>);
+    insert(108, "FortitudeSave", R_INT, {R_OBJECT, R_INT, R_INT, R_OBJECT}, &thunk<&FortitudeSave>);
+    insert(109, "ReflexSave", R_INT, {R_OBJECT, R_INT, R_INT, R_OBJECT}, &thunk<&ReflexSave>);
+    insert(110, "WillSave", R_INT, {R_OBJECT, R_INT, R_INT, R_OBJECT}, &thunk<&WillSave>);
+    insert(111, "GetSpellSaveDC", R_INT, {}, &thunk<&GetSpellSaveDC>);
+    insert(112, "MagicalEffect", R_EFFECT, {R_EFFECT}, &thunk<&MagicalEffect>);
+    insert(113, "SupernaturalEffect", R_EFFECT, {R_EFFECT}, &thunk<&SupernaturalEffect>);
+    insert(114, "ExtraordinaryEffect", R_EFFECT, {R_EFFECT}, &thunk<&ExtraordinaryEffect>);
+    insert(116, "GetAC", R_INT, {R_OBJECT, R_INT}, &thunk<&GetAC>);
+    insert(121, "RoundsToSeconds", R_FLOAT, {R_INT}, &thunk<&RoundsToSeconds>);
+    insert(122, "HoursToSeconds", R_FLOAT, {R_INT}, &thunk<&HoursToSeconds>);
+    insert(123, "TurnsToSeconds", R_FLOAT, {R_INT}, &thunk<&TurnsToSeconds>);
+    insert(124, "SoundObjectSetFixedVariance", R_VOID, {R_OBJECT, R_FLOAT}, &thunk<&SoundObjectSetFixedVariance>);
+    insert(125, "GetGoodEvilValue", R_INT, {R_OBJECT}, &thunk<&GetGoodEvilValue>);
+    insert(126, "GetPartyMemberCount", R_INT, {}, &thunk<&GetPartyMemberCount>);
+    insert(127, "GetAlignmentGoodEvil", R_INT, {R_OBJECT}, &thunk<&GetAlignmentGoodEvil>);
+    insert(128, "GetFirstObjectInShape", R_OBJECT, {R_INT, R_FLOAT, R_LOCATION, R_INT, R_INT, R_VECTOR}, &thunk<&GetFirstObjectInShape>);
+    insert(129, "GetNextObjectInShape", R_OBJECT, {R_INT, R_FLOAT, R_LOCATION, R_INT, R_INT, R_VECTOR}, &thunk<&GetNextObjectInShape>);
+    insert(131, "SignalEvent", R_VOID, {R_OBJECT, R_EVENT}, &thunk<&SignalEvent>);
+    insert(132, "EventUserDefined", R_EVENT, {R_INT}, &thunk<&EventUserDefined>);
+    insert(137, "VectorNormalize", R_VECTOR, {R_VECTOR}, &thunk<&VectorNormalize>);
+    insert(138, "GetItemStackSize", R_INT, {R_OBJECT}, &thunk<&GetItemStackSize>);
+    insert(139, "GetAbilityScore", R_INT, {R_OBJECT, R_INT}, &thunk<&GetAbilityScore>);
+    insert(140, "GetIsDead", R_INT, {R_OBJECT}, &thunk<&GetIsDead>);
+    insert(141, "PrintVector", R_VOID, {R_VECTOR, R_INT}, &thunk<&PrintVector>);
+    insert(142, "Vector", R_VECTOR, {R_FLOAT, R_FLOAT, R_FLOAT}, &thunk<&Vector>);
+    insert(143, "SetFacingPoint", R_VOID, {R_VECTOR}, &thunk<&SetFacingPoint>);
+    insert(144, "AngleToVector", R_VECTOR, {R_FLOAT}, &thunk<&AngleToVector>);
+    insert(145, "VectorToAngle", R_FLOAT, {R_VECTOR}, &thunk<&VectorToAngle>);
+    insert(146, "TouchAttackMelee", R_INT, {R_OBJECT, R_INT}, &thunk<&TouchAttackMelee>);
+    insert(147, "TouchAttackRanged", R_INT, {R_OBJECT, R_INT}, &thunk<&TouchAttackRanged>);
+    insert(150, "SetItemStackSize", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetItemStackSize>);
+    insert(151, "GetDistanceBetween", R_FLOAT, {R_OBJECT, R_OBJECT}, &thunk<&GetDistanceBetween>);
+    insert(152, "SetReturnStrref", R_VOID, {R_INT, R_INT, R_INT}, &thunk<&SetReturnStrref>);
+    insert(155, "GetItemInSlot", R_OBJECT, {R_INT, R_OBJECT}, &thunk<&GetItemInSlot>);
+    insert(160, "SetGlobalString", R_VOID, {R_STRING, R_STRING}, &thunk<&SetGlobalString>);
+    insert(162, "SetCommandable", R_VOID, {R_INT, R_OBJECT}, &thunk<&SetCommandable>);
+    insert(163, "GetCommandable", R_INT, {R_OBJECT}, &thunk<&GetCommandable>);
+    insert(166, "GetHitDice", R_INT, {R_OBJECT}, &thunk<&GetHitDice>);
+    insert(168, "GetTag", R_STRING, {R_OBJECT}, &thunk<&GetTag>);
+    insert(169, "ResistForce", R_INT, {R_OBJECT, R_OBJECT}, &thunk<&ResistForce>);
+    insert(170, "GetEffectType", R_INT, {R_EFFECT}, &thunk<&GetEffectType>);
+    insert(172, "GetFactionEqual", R_INT, {R_OBJECT, R_OBJECT}, &thunk<&GetFactionEqual>);
+    insert(173, "ChangeFaction", R_VOID, {R_OBJECT, R_OBJECT}, &thunk<&ChangeFaction>);
+    insert(174, "GetIsListening", R_INT, {R_OBJECT}, &thunk<&GetIsListening>);
+    insert(175, "SetListening", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetListening>);
+    insert(176, "SetListenPattern", R_VOID, {R_OBJECT, R_STRING, R_INT}, &thunk<&SetListenPattern>);
+    insert(177, "TestStringAgainstPattern", R_INT, {R_STRING, R_STRING}, &thunk<&TestStringAgainstPattern>);
+    insert(178, "GetMatchedSubstring", R_STRING, {R_INT}, &thunk<&GetMatchedSubstring>);
+    insert(179, "GetMatchedSubstringsCount", R_INT, {}, &thunk<&GetMatchedSubstringsCount>);
+    insert(181, "GetFactionWeakestMember", R_OBJECT, {R_OBJECT, R_INT}, &thunk<&GetFactionWeakestMember>);
+    insert(182, "GetFactionStrongestMember", R_OBJECT, {R_OBJECT, R_INT}, &thunk<&GetFactionStrongestMember>);
+    insert(183, "GetFactionMostDamagedMember", R_OBJECT, {R_OBJECT, R_INT}, &thunk<&GetFactionMostDamagedMember>);
+    insert(184, "GetFactionLeastDamagedMember", R_OBJECT, {R_OBJECT, R_INT}, &thunk<&GetFactionLeastDamagedMember>);
+    insert(185, "GetFactionGold", R_INT, {R_OBJECT}, &thunk<&GetFactionGold>);
+    insert(186, "GetFactionAverageReputation", R_INT, {R_OBJECT, R_OBJECT}, &thunk<&GetFactionAverageReputation>);
+    insert(187, "GetFactionAverageGoodEvilAlignment", R_INT, {R_OBJECT}, &thunk<&GetFactionAverageGoodEvilAlignment>);
+    insert(188, "SoundObjectGetFixedVariance", R_FLOAT, {R_OBJECT}, &thunk<&SoundObjectGetFixedVariance>);
+    insert(189, "GetFactionAverageLevel", R_INT, {R_OBJECT}, &thunk<&GetFactionAverageLevel>);
+    insert(190, "GetFactionAverageXP", R_INT, {R_OBJECT}, &thunk<&GetFactionAverageXP>);
+    insert(191, "GetFactionMostFrequentClass", R_INT, {R_OBJECT}, &thunk<&GetFactionMostFrequentClass>);
+    insert(192, "GetFactionWorstAC", R_OBJECT, {R_OBJECT, R_INT}, &thunk<&GetFactionWorstAC>);
+    insert(193, "GetFactionBestAC", R_OBJECT, {R_OBJECT, R_INT}, &thunk<&GetFactionBestAC>);
+    insert(194, "GetGlobalString", R_STRING, {R_STRING}, &thunk<&GetGlobalString>);
+    insert(195, "GetListenPatternNumber", R_INT, {}, &thunk<&GetListenPatternNumber>);
+    insert(197, "GetWaypointByTag", R_OBJECT, {R_STRING}, &thunk<&GetWaypointByTag>);
+    insert(198, "GetTransitionTarget", R_OBJECT, {R_OBJECT}, &thunk<&GetTransitionTarget>);
+    insert(200, "GetObjectByTag", R_OBJECT, {R_STRING, R_INT}, &thunk<&GetObjectByTag>);
+    insert(201, "AdjustAlignment", R_VOID, {R_OBJECT, R_INT, R_INT}, &thunk<&AdjustAlignment>);
+    insert(203, "SetAreaTransitionBMP", R_VOID, {R_INT, R_STRING}, &thunk<&SetAreaTransitionBMP>);
+    insert(208, "GetReputation", R_INT, {R_OBJECT, R_OBJECT}, &thunk<&GetReputation>);
+    insert(209, "AdjustReputation", R_VOID, {R_OBJECT, R_OBJECT, R_INT}, &thunk<&AdjustReputation>);
+    insert(210, "GetModuleFileName", R_STRING, {}, &thunk<&GetModuleFileName>);
+    insert(211, "GetGoingToBeAttackedBy", R_OBJECT, {R_OBJECT}, &thunk<&GetGoingToBeAttackedBy>);
+    insert(213, "GetLocation", R_LOCATION, {R_OBJECT}, &thunk<&GetLocation>);
+    insert(215, "Location", R_LOCATION, {R_VECTOR, R_FLOAT}, &thunk<&CreateLocation>);
+    insert(216, "ApplyEffectAtLocation", R_VOID, {R_INT, R_EFFECT, R_LOCATION, R_FLOAT}, &thunk<&ApplyEffectAtLocation>);
+    insert(217, "GetIsPC", R_INT, {R_OBJECT}, &thunk<&GetIsPC>);
+    insert(218, "FeetToMeters", R_FLOAT, {R_FLOAT}, &thunk<&FeetToMeters>);
+    insert(219, "YardsToMeters", R_FLOAT, {R_FLOAT}, &thunk<&YardsToMeters>);
+    insert(220, "ApplyEffectToObject", R_VOID, {R_INT, R_EFFECT, R_OBJECT, R_FLOAT}, &thunk<&ApplyEffectToObject>);
+    insert(221, "SpeakString", R_VOID, {R_STRING, R_INT}, &thunk<&SpeakString>);
+    insert(222, "GetSpellTargetLocation", R_LOCATION, {}, &thunk<&GetSpellTargetLocation>);
+    insert(223, "GetPositionFromLocation", R_VECTOR, {R_LOCATION}, &thunk<&GetPositionFromLocation>);
+    insert(225, "GetFacingFromLocation", R_FLOAT, {R_LOCATION}, &thunk<&GetFacingFromLocation>);
+    insert(226, "GetNearestCreatureToLocation", R_OBJECT, {R_INT, R_INT, R_LOCATION, R_INT, R_INT, R_INT, R_INT, R_INT}, &thunk<&GetNearestCreatureToLocation>);
+    insert(227, "GetNearestObject", R_OBJECT, {R_INT, R_OBJECT, R_INT}, &thunk<&GetNearestObject>);
+    insert(228, "GetNearestObjectToLocation", R_OBJECT, {R_INT, R_LOCATION, R_INT}, &thunk<&GetNearestObjectToLocation>);
+    insert(229, "GetNearestObjectByTag", R_OBJECT, {R_STRING, R_OBJECT, R_INT}, &thunk<&GetNearestObjectByTag>);
+    insert(230, "IntToFloat", R_FLOAT, {R_INT}, &thunk<&IntToFloat>);
+    insert(231, "FloatToInt", R_INT, {R_FLOAT}, &thunk<&FloatToInt>);
+    insert(232, "StringToInt", R_INT, {R_STRING}, &thunk<&StringToInt>);
+    insert(233, "StringToFloat", R_FLOAT, {R_STRING}, &thunk<&StringToFloat>);
+    insert(235, "GetIsEnemy", R_INT, {R_OBJECT, R_OBJECT}, &thunk<&GetIsEnemy>);
+    insert(236, "GetIsFriend", R_INT, {R_OBJECT, R_OBJECT}, &thunk<&GetIsFriend>);
+    insert(237, "GetIsNeutral", R_INT, {R_OBJECT, R_OBJECT}, &thunk<&GetIsNeutral>);
+    insert(238, "GetPCSpeaker", R_OBJECT, {}, &thunk<&GetPCSpeaker>);
+    insert(239, "GetStringByStrRef", R_STRING, {R_INT}, &thunk<&GetStringByStrRef>);
+    insert(241, "DestroyObject", R_VOID, {R_OBJECT, R_FLOAT, R_INT, R_FLOAT}, &thunk<&DestroyObject>);
+    insert(242, "GetModule", R_OBJECT, {}, &thunk<&GetModule>);
+    insert(243, "CreateObject", R_OBJECT, {R_INT, R_STRING, R_LOCATION, R_INT}, &thunk<&CreateObject>);
+    insert(244, "EventSpellCastAt", R_EVENT, {R_OBJECT, R_INT, R_INT}, &thunk<&EventSpellCastAt>);
+    insert(245, "GetLastSpellCaster", R_OBJECT, {}, &thunk<&GetLastSpellCaster>);
+    insert(246, "GetLastSpell", R_INT, {}, &thunk<&GetLastSpell>);
+    insert(247, "GetUserDefinedEventNumber", R_INT, {}, &thunk<&GetUserDefinedEventNumber>);
+    insert(248, "GetSpellId", R_INT, {}, &thunk<&GetSpellId>);
+    insert(249, "RandomName", R_STRING, {}, &thunk<&RandomName>);
+    insert(251, "GetLoadFromSaveGame", R_INT, {}, &thunk<&GetLoadFromSaveGame>);
+    insert(253, "GetName", R_STRING, {R_OBJECT}, &thunk<&GetName>);
+    insert(254, "GetLastSpeaker", R_OBJECT, {}, &thunk<&GetLastSpeaker>);
+    insert(255, "BeginConversation", R_INT, {R_STRING, R_OBJECT}, &thunk<&BeginConversation>);
+    insert(256, "GetLastPerceived", R_OBJECT, {}, &thunk<&GetLastPerceived>);
+    insert(257, "GetLastPerceptionHeard", R_INT, {}, &thunk<&GetLastPerceptionHeard>);
+    insert(258, "GetLastPerceptionInaudible", R_INT, {}, &thunk<&GetLastPerceptionInaudible>);
+    insert(259, "GetLastPerceptionSeen", R_INT, {}, &thunk<&GetLastPerceptionSeen>);
+    insert(260, "GetLastClosedBy", R_OBJECT, {}, &thunk<&GetLastClosedBy>);
+    insert(261, "GetLastPerceptionVanished", R_INT, {}, &thunk<&GetLastPerceptionVanished>);
+    insert(262, "GetFirstInPersistentObject", R_OBJECT, {R_OBJECT, R_INT, R_INT}, &thunk<&GetFirstInPersistentObject>);
+    insert(263, "GetNextInPersistentObject", R_OBJECT, {R_OBJECT, R_INT, R_INT}, &thunk<&GetNextInPersistentObject>);
+    insert(264, "GetAreaOfEffectCreator", R_OBJECT, {R_OBJECT}, &thunk<&GetAreaOfEffectCreator>);
+    insert(265, "ShowLevelUpGUI", R_INT, {}, &thunk<&ShowLevelUpGUI>);
+    insert(266, "SetItemNonEquippable", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetItemNonEquippable>);
+    insert(267, "GetButtonMashCheck", R_INT, {}, &thunk<&GetButtonMashCheck>);
+    insert(268, "SetButtonMashCheck", R_VOID, {R_INT}, &thunk<&SetButtonMashCheck>);
+    insert(271, "GiveItem", R_VOID, {R_OBJECT, R_OBJECT}, &thunk<&GiveItem>);
+    insert(272, "ObjectToString", R_STRING, {R_OBJECT}, &thunk<&ObjectToString>);
+    insert(274, "GetIsImmune", R_INT, {R_OBJECT, R_INT, R_OBJECT}, &thunk<&GetIsImmune>);
+    insert(276, "GetEncounterActive", R_INT, {R_OBJECT}, &thunk<&GetEncounterActive>);
+    insert(277, "SetEncounterActive", R_VOID, {R_INT, R_OBJECT}, &thunk<&SetEncounterActive>);
+    insert(278, "GetEncounterSpawnsMax", R_INT, {R_OBJECT}, &thunk<&GetEncounterSpawnsMax>);
+    insert(279, "SetEncounterSpawnsMax", R_VOID, {R_INT, R_OBJECT}, &thunk<&SetEncounterSpawnsMax>);
+    insert(280, "GetEncounterSpawnsCurrent", R_INT, {R_OBJECT}, &thunk<&GetEncounterSpawnsCurrent>);
+    insert(281, "SetEncounterSpawnsCurrent", R_VOID, {R_INT, R_OBJECT}, &thunk<&SetEncounterSpawnsCurrent>);
+    insert(282, "GetModuleItemAcquired", R_OBJECT, {}, &thunk<&GetModuleItemAcquired>);
+    insert(283, "GetModuleItemAcquiredFrom", R_OBJECT, {}, &thunk<&GetModuleItemAcquiredFrom>);
+    insert(284, "SetCustomToken", R_VOID, {R_INT, R_STRING}, &thunk<&SetCustomToken>);
+    insert(285, "GetHasFeat", R_INT, {R_INT, R_OBJECT}, &thunk<&GetHasFeat>);
+    insert(286, "GetHasSkill", R_INT, {R_INT, R_OBJECT}, &thunk<&GetHasSkill>);
+    insert(289, "GetObjectSeen", R_INT, {R_OBJECT, R_OBJECT}, &thunk<&GetObjectSeen>);
+    insert(290, "GetObjectHeard", R_INT, {R_OBJECT, R_OBJECT}, &thunk<&GetObjectHeard>);
+    insert(291, "GetLastPlayerDied", R_OBJECT, {}, &thunk<&GetLastPlayerDied>);
+    insert(292, "GetModuleItemLost", R_OBJECT, {}, &thunk<&GetModuleItemLost>);
+    insert(293, "GetModuleItemLostBy", R_OBJECT, {}, &thunk<&GetModuleItemLostBy>);
+    insert(295, "EventConversation", R_EVENT, {}, &thunk<&EventConversation>);
+    insert(296, "SetEncounterDifficulty", R_VOID, {R_INT, R_OBJECT}, &thunk<&SetEncounterDifficulty>);
+    insert(297, "GetEncounterDifficulty", R_INT, {R_OBJECT}, &thunk<&GetEncounterDifficulty>);
+    insert(298, "GetDistanceBetweenLocations", R_FLOAT, {R_LOCATION, R_LOCATION}, &thunk<&GetDistanceBetweenLocations>);
+    insert(299, "GetReflexAdjustedDamage", R_INT, {R_INT, R_OBJECT, R_INT, R_INT, R_OBJECT}, &thunk<&GetReflexAdjustedDamage>);
+    insert(300, "PlayAnimation", R_VOID, {R_INT, R_FLOAT, R_FLOAT}, &thunk<&PlayAnimation>);
+    insert(301, "TalentSpell", R_TALENT, {R_INT}, &thunk<&TalentSpell>);
+    insert(302, "TalentFeat", R_TALENT, {R_INT}, &thunk<&TalentFeat>);
+    insert(303, "TalentSkill", R_TALENT, {R_INT}, &thunk<&TalentSkill>);
+    insert(304, "GetHasSpellEffect", R_INT, {R_INT, R_OBJECT}, &thunk<&GetHasSpellEffect>);
+    insert(305, "GetEffectSpellId", R_INT, {R_EFFECT}, &thunk<&GetEffectSpellId>);
+    insert(306, "GetCreatureHasTalent", R_INT, {R_TALENT, R_OBJECT}, &thunk<&GetCreatureHasTalent>);
+    insert(307, "GetCreatureTalentRandom", R_TALENT, {R_INT, R_OBJECT, R_INT}, &thunk<&GetCreatureTalentRandom>);
+    insert(308, "GetCreatureTalentBest", R_TALENT, {R_INT, R_INT, R_OBJECT, R_INT, R_INT, R_INT}, &thunk<&GetCreatureTalentBest>);
+    insert(311, "GetGoldPieceValue", R_INT, {R_OBJECT}, &thunk<&GetGoldPieceValue>);
+    insert(312, "GetIsPlayableRacialType", R_INT, {R_OBJECT}, &thunk<&GetIsPlayableRacialType>);
+    insert(313, "JumpToLocation", R_VOID, {R_LOCATION}, &thunk<&JumpToLocation>);
+    insert(315, "GetSkillRank", R_INT, {R_INT, R_OBJECT}, &thunk<&GetSkillRank>);
+    insert(316, "GetAttackTarget", R_OBJECT, {R_OBJECT}, &thunk<&GetAttackTarget>);
+    insert(317, "GetLastAttackType", R_INT, {R_OBJECT}, &thunk<&GetLastAttackType>);
+    insert(318, "GetLastAttackMode", R_INT, {R_OBJECT}, &thunk<&GetLastAttackMode>);
+    insert(319, "GetDistanceBetween2D", R_FLOAT, {R_OBJECT, R_OBJECT}, &thunk<&GetDistanceBetween2D>);
+    insert(320, "GetIsInCombat", R_INT, {R_OBJECT}, &thunk<&GetIsInCombat>);
+    insert(321, "GetLastAssociateCommand", R_INT, {R_OBJECT}, &thunk<&GetLastAssociateCommand>);
+    insert(322, "GiveGoldToCreature", R_VOID, {R_OBJECT, R_INT}, &thunk<&GiveGoldToCreature>);
+    insert(323, "SetIsDestroyable", R_VOID, {R_INT, R_INT, R_INT}, &thunk<&SetIsDestroyable>);
+    insert(324, "SetLocked", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetLocked>);
+    insert(325, "GetLocked", R_INT, {R_OBJECT}, &thunk<&GetLocked>);
+    insert(326, "GetClickingObject", R_OBJECT, {}, &thunk<&GetClickingObject>);
+    insert(327, "SetAssociateListenPatterns", R_VOID, {R_OBJECT}, &thunk<&SetAssociateListenPatterns>);
+    insert(328, "GetLastWeaponUsed", R_OBJECT, {R_OBJECT}, &thunk<&GetLastWeaponUsed>);
+    insert(330, "GetLastUsedBy", R_OBJECT, {}, &thunk<&GetLastUsedBy>);
+    insert(331, "GetAbilityModifier", R_INT, {R_INT, R_OBJECT}, &thunk<&GetAbilityModifier>);
+    insert(332, "GetIdentified", R_INT, {R_OBJECT}, &thunk<&GetIdentified>);
+    insert(333, "SetIdentified", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetIdentified>);
+    insert(334, "GetDistanceBetweenLocations2D", R_FLOAT, {R_LOCATION, R_LOCATION}, &thunk<&GetDistanceBetweenLocations2D>);
+    insert(335, "GetDistanceToObject2D", R_FLOAT, {R_OBJECT}, &thunk<&GetDistanceToObject2D>);
+    insert(336, "GetBlockingDoor", R_OBJECT, {}, &thunk<&GetBlockingDoor>);
+    insert(337, "GetIsDoorActionPossible", R_INT, {R_OBJECT, R_INT}, &thunk<&GetIsDoorActionPossible>);
+    insert(338, "DoDoorAction", R_VOID, {R_OBJECT, R_INT}, &thunk<&DoDoorAction>);
+    insert(339, "GetFirstItemInInventory", R_OBJECT, {R_OBJECT}, &thunk<&GetFirstItemInInventory>);
+    insert(340, "GetNextItemInInventory", R_OBJECT, {R_OBJECT}, &thunk<&GetNextItemInInventory>);
+    insert(341, "GetClassByPosition", R_INT, {R_INT, R_OBJECT}, &thunk<&GetClassByPosition>);
+    insert(342, "GetLevelByPosition", R_INT, {R_INT, R_OBJECT}, &thunk<&GetLevelByPosition>);
+    insert(343, "GetLevelByClass", R_INT, {R_INT, R_OBJECT}, &thunk<&GetLevelByClass>);
+    insert(344, "GetDamageDealtByType", R_INT, {R_INT}, &thunk<&GetDamageDealtByType>);
+    insert(345, "GetTotalDamageDealt", R_INT, {}, &thunk<&GetTotalDamageDealt>);
+    insert(346, "GetLastDamager", R_OBJECT, {}, &thunk<&GetLastDamager>);
+    insert(347, "GetLastDisarmed", R_OBJECT, {}, &thunk<&GetLastDisarmed>);
+    insert(348, "GetLastDisturbed", R_OBJECT, {}, &thunk<&GetLastDisturbed>);
+    insert(349, "GetLastLocked", R_OBJECT, {}, &thunk<&GetLastLocked>);
+    insert(350, "GetLastUnlocked", R_OBJECT, {}, &thunk<&GetLastUnlocked>);
+    insert(352, "GetInventoryDisturbType", R_INT, {}, &thunk<&GetInventoryDisturbType>);
+    insert(353, "GetInventoryDisturbItem", R_OBJECT, {}, &thunk<&GetInventoryDisturbItem>);
+    insert(354, "ShowUpgradeScreen", R_VOID, {R_OBJECT}, &thunk<&ShowUpgradeScreen>);
+    insert(355, "VersusAlignmentEffect", R_EFFECT, {R_EFFECT, R_INT, R_INT}, &thunk<&VersusAlignmentEffect>);
+    insert(356, "VersusRacialTypeEffect", R_EFFECT, {R_EFFECT, R_INT}, &thunk<&VersusRacialTypeEffect>);
+    insert(357, "VersusTrapEffect", R_EFFECT, {R_EFFECT}, &thunk<&VersusTrapEffect>);
+    insert(358, "GetGender", R_INT, {R_OBJECT}, &thunk<&GetGender>);
+    insert(359, "GetIsTalentValid", R_INT, {R_TALENT}, &thunk<&GetIsTalentValid>);
+    insert(361, "GetAttemptedAttackTarget", R_OBJECT, {}, &thunk<&GetAttemptedAttackTarget>);
+    insert(362, "GetTypeFromTalent", R_INT, {R_TALENT}, &thunk<&GetTypeFromTalent>);
+    insert(363, "GetIdFromTalent", R_INT, {R_TALENT}, &thunk<&GetIdFromTalent>);
+    insert(364, "PlayPazaak", R_VOID, {R_INT, R_STRING, R_INT, R_INT, R_OBJECT}, &thunk<&PlayPazaak>);
+    insert(365, "GetLastPazaakResult", R_INT, {}, &thunk<&GetLastPazaakResult>);
+    insert(366, "DisplayFeedBackText", R_VOID, {R_OBJECT, R_INT}, &thunk<&DisplayFeedBackText>);
+    insert(367, "AddJournalQuestEntry", R_VOID, {R_STRING, R_INT, R_INT}, &thunk<&AddJournalQuestEntry>);
+    insert(368, "RemoveJournalQuestEntry", R_VOID, {R_STRING}, &thunk<&RemoveJournalQuestEntry>);
+    insert(369, "GetJournalEntry", R_INT, {R_STRING}, &thunk<&GetJournalEntry>);
+    insert(370, "PlayRumblePattern", R_INT, {R_INT}, &thunk<&PlayRumblePattern>);
+    insert(371, "StopRumblePattern", R_INT, {R_INT}, &thunk<&StopRumblePattern>);
+    insert(374, "SendMessageToPC", R_VOID, {R_OBJECT, R_STRING}, &thunk<&SendMessageToPC>);
+    insert(375, "GetAttemptedSpellTarget", R_OBJECT, {}, &thunk<&GetAttemptedSpellTarget>);
+    insert(376, "GetLastOpenedBy", R_OBJECT, {}, &thunk<&GetLastOpenedBy>);
+    insert(377, "GetHasSpell", R_INT, {R_INT, R_OBJECT}, &thunk<&GetHasSpell>);
+    insert(378, "OpenStore", R_VOID, {R_OBJECT, R_OBJECT, R_INT, R_INT}, &thunk<&OpenStore>);
+    insert(380, "GetFirstFactionMember", R_OBJECT, {R_OBJECT, R_INT}, &thunk<&GetFirstFactionMember>);
+    insert(381, "GetNextFactionMember", R_OBJECT, {R_OBJECT, R_INT}, &thunk<&GetNextFactionMember>);
+    insert(384, "GetJournalQuestExperience", R_INT, {R_STRING}, &thunk<&GetJournalQuestExperience>);
+    insert(385, "JumpToObject", R_VOID, {R_OBJECT, R_INT}, &thunk<&JumpToObject>);
+    insert(386, "SetMapPinEnabled", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetMapPinEnabled>);
+    insert(388, "PopUpGUIPanel", R_VOID, {R_OBJECT, R_INT}, &thunk<&PopUpGUIPanel>);
+    insert(389, "AddMultiClass", R_VOID, {R_INT, R_OBJECT}, &thunk<&AddMultiClass>);
+    insert(390, "GetIsLinkImmune", R_INT, {R_OBJECT, R_EFFECT}, &thunk<&GetIsLinkImmune>);
+    insert(393, "GiveXPToCreature", R_VOID, {R_OBJECT, R_INT}, &thunk<&GiveXPToCreature>);
+    insert(394, "SetXP", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetXP>);
+    insert(395, "GetXP", R_INT, {R_OBJECT}, &thunk<&GetXP>);
+    insert(396, "IntToHexString", R_STRING, {R_INT}, &thunk<&IntToHexString>);
+    insert(397, "GetBaseItemType", R_INT, {R_OBJECT}, &thunk<&GetBaseItemType>);
+    insert(398, "GetItemHasItemProperty", R_INT, {R_OBJECT, R_INT}, &thunk<&GetItemHasItemProperty>);
+    insert(401, "GetItemACValue", R_INT, {R_OBJECT}, &thunk<&GetItemACValue>);
+    insert(403, "ExploreAreaForPlayer", R_VOID, {R_OBJECT, R_OBJECT}, &thunk<&ExploreAreaForPlayer>);
+    insert(405, "GetIsDay", R_INT, {}, &thunk<&GetIsDay>);
+    insert(406, "GetIsNight", R_INT, {}, &thunk<&GetIsNight>);
+    insert(407, "GetIsDawn", R_INT, {}, &thunk<&GetIsDawn>);
+    insert(408, "GetIsDusk", R_INT, {}, &thunk<&GetIsDusk>);
+    insert(409, "GetIsEncounterCreature", R_INT, {R_OBJECT}, &thunk<&GetIsEncounterCreature>);
+    insert(410, "GetLastPlayerDying", R_OBJECT, {}, &thunk<&GetLastPlayerDying>);
+    insert(411, "GetStartingLocation", R_LOCATION, {}, &thunk<&GetStartingLocation>);
+    insert(412, "ChangeToStandardFaction", R_VOID, {R_OBJECT, R_INT}, &thunk<&ChangeToStandardFaction>);
+    insert(413, "SoundObjectPlay", R_VOID, {R_OBJECT}, &thunk<&SoundObjectPlay>);
+    insert(414, "SoundObjectStop", R_VOID, {R_OBJECT}, &thunk<&SoundObjectStop>);
+    insert(415, "SoundObjectSetVolume", R_VOID, {R_OBJECT, R_INT}, &thunk<&SoundObjectSetVolume>);
+    insert(416, "SoundObjectSetPosition", R_VOID, {R_OBJECT, R_VECTOR}, &thunk<&SoundObjectSetPosition>);
+    insert(417, "SpeakOneLinerConversation", R_VOID, {R_STRING, R_OBJECT}, &thunk<&SpeakOneLinerConversation>);
+    insert(418, "GetGold", R_INT, {R_OBJECT}, &thunk<&GetGold>);
+    insert(419, "GetLastRespawnButtonPresser", R_OBJECT, {}, &thunk<&GetLastRespawnButtonPresser>);
+    insert(421, "SetLightsaberPowered", R_VOID, {R_OBJECT, R_INT, R_INT, R_INT}, &thunk<&SetLightsaberPowered>);
+    insert(422, "GetIsWeaponEffective", R_INT, {R_OBJECT, R_INT}, &thunk<&GetIsWeaponEffective>);
+    insert(423, "GetLastSpellHarmful", R_INT, {}, &thunk<&GetLastSpellHarmful>);
+    insert(424, "EventActivateItem", R_EVENT, {R_OBJECT, R_LOCATION, R_OBJECT}, &thunk<&EventActivateItem>);
+    insert(425, "MusicBackgroundPlay", R_VOID, {R_OBJECT}, &thunk<&MusicBackgroundPlay>);
+    insert(426, "MusicBackgroundStop", R_VOID, {R_OBJECT}, &thunk<&MusicBackgroundStop>);
+    insert(427, "MusicBackgroundSetDelay", R_VOID, {R_OBJECT, R_INT}, &thunk<&MusicBackgroundSetDelay>);
+    insert(428, "MusicBackgroundChangeDay", R_VOID, {R_OBJECT, R_INT}, &thunk<&MusicBackgroundChangeDay>);
+    insert(429, "MusicBackgroundChangeNight", R_VOID, {R_OBJECT, R_INT}, &thunk<&MusicBackgroundChangeNight>);
+    insert(430, "MusicBattlePlay", R_VOID, {R_OBJECT}, &thunk<&MusicBattlePlay>);
+    insert(431, "MusicBattleStop", R_VOID, {R_OBJECT}, &thunk<&MusicBattleStop>);
+    insert(432, "MusicBattleChange", R_VOID, {R_OBJECT, R_INT}, &thunk<&MusicBattleChange>);
+    insert(433, "AmbientSoundPlay", R_VOID, {R_OBJECT}, &thunk<&AmbientSoundPlay>);
+    insert(434, "AmbientSoundStop", R_VOID, {R_OBJECT}, &thunk<&AmbientSoundStop>);
+    insert(435, "AmbientSoundChangeDay", R_VOID, {R_OBJECT, R_INT}, &thunk<&AmbientSoundChangeDay>);
+    insert(436, "AmbientSoundChangeNight", R_VOID, {R_OBJECT, R_INT}, &thunk<&AmbientSoundChangeNight>);
+    insert(437, "GetLastKiller", R_OBJECT, {}, &thunk<&GetLastKiller>);
+    insert(438, "GetSpellCastItem", R_OBJECT, {}, &thunk<&GetSpellCastItem>);
+    insert(439, "GetItemActivated", R_OBJECT, {}, &thunk<&GetItemActivated>);
+    insert(440, "GetItemActivator", R_OBJECT, {}, &thunk<&GetItemActivator>);
+    insert(441, "GetItemActivatedTargetLocation", R_LOCATION, {}, &thunk<&GetItemActivatedTargetLocation>);
+    insert(442, "GetItemActivatedTarget", R_OBJECT, {}, &thunk<&GetItemActivatedTarget>);
+    insert(443, "GetIsOpen", R_INT, {R_OBJECT}, &thunk<&GetIsOpen>);
+    insert(444, "TakeGoldFromCreature", R_VOID, {R_INT, R_OBJECT, R_INT}, &thunk<&TakeGoldFromCreature>);
+    insert(445, "GetIsInConversation", R_INT, {R_OBJECT}, &thunk<&GetIsInConversation>);
+    insert(455, "GetPlotFlag", R_INT, {R_OBJECT}, &thunk<&GetPlotFlag>);
+    insert(456, "SetPlotFlag", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetPlotFlag>);
+    insert(461, "SetDialogPlaceableCamera", R_VOID, {R_INT}, &thunk<&SetDialogPlaceableCamera>);
+    insert(462, "GetSoloMode", R_INT, {}, &thunk<&GetSoloMode>);
+    insert(464, "GetMaxStealthXP", R_INT, {}, &thunk<&GetMaxStealthXP>);
+    insert(468, "SetMaxStealthXP", R_VOID, {R_INT}, &thunk<&SetMaxStealthXP>);
+    insert(474, "GetCurrentStealthXP", R_INT, {}, &thunk<&GetCurrentStealthXP>);
+    insert(475, "GetNumStackedItems", R_INT, {R_OBJECT}, &thunk<&GetNumStackedItems>);
+    insert(476, "SurrenderToEnemies", R_VOID, {}, &thunk<&SurrenderToEnemies>);
+    insert(478, "SetCurrentStealthXP", R_VOID, {R_INT}, &thunk<&SetCurrentStealthXP>);
+    insert(479, "GetCreatureSize", R_INT, {R_OBJECT}, &thunk<&GetCreatureSize>);
+    insert(480, "AwardStealthXP", R_VOID, {R_OBJECT}, &thunk<&AwardStealthXP>);
+    insert(481, "GetStealthXPEnabled", R_INT, {}, &thunk<&GetStealthXPEnabled>);
+    insert(482, "SetStealthXPEnabled", R_VOID, {R_INT}, &thunk<&SetStealthXPEnabled>);
+    insert(486, "GetLastTrapDetected", R_OBJECT, {R_OBJECT}, &thunk<&GetLastTrapDetected>);
+    insert(488, "GetNearestTrapToObject", R_OBJECT, {R_OBJECT, R_INT}, &thunk<&GetNearestTrapToObject>);
+    insert(489, "GetAttemptedMovementTarget", R_OBJECT, {}, &thunk<&GetAttemptedMovementTarget>);
+    insert(490, "GetBlockingCreature", R_OBJECT, {R_OBJECT}, &thunk<&GetBlockingCreature>);
+    insert(491, "GetFortitudeSavingThrow", R_INT, {R_OBJECT}, &thunk<&GetFortitudeSavingThrow>);
+    insert(492, "GetWillSavingThrow", R_INT, {R_OBJECT}, &thunk<&GetWillSavingThrow>);
+    insert(493, "GetReflexSavingThrow", R_INT, {R_OBJECT}, &thunk<&GetReflexSavingThrow>);
+    insert(494, "GetChallengeRating", R_FLOAT, {R_OBJECT}, &thunk<&GetChallengeRating>);
+    insert(495, "GetFoundEnemyCreature", R_OBJECT, {R_OBJECT}, &thunk<&GetFoundEnemyCreature>);
+    insert(496, "GetMovementRate", R_INT, {R_OBJECT}, &thunk<&GetMovementRate>);
+    insert(497, "GetSubRace", R_INT, {R_OBJECT}, &thunk<&GetSubRace>);
+    insert(498, "GetStealthXPDecrement", R_INT, {}, &thunk<&GetStealthXPDecrement>);
+    insert(499, "SetStealthXPDecrement", R_VOID, {R_INT}, &thunk<&SetStealthXPDecrement>);
+    insert(500, "DuplicateHeadAppearance", R_VOID, {R_OBJECT, R_OBJECT}, &thunk<&DuplicateHeadAppearance>);
+    insert(503, "CutsceneAttack", R_VOID, {R_OBJECT, R_INT, R_INT, R_INT}, &thunk<&CutsceneAttack>);
+    insert(504, "SetCameraMode", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetCameraMode>);
+    insert(505, "SetLockOrientationInDialog", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetLockOrientationInDialog>);
+    insert(506, "SetLockHeadFollowInDialog", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetLockHeadFollowInDialog>);
+    insert(507, "CutsceneMove", R_VOID, {R_OBJECT, R_VECTOR, R_INT}, &thunk<&CutsceneMove>);
+    insert(508, "EnableVideoEffect", R_VOID, {R_INT}, &thunk<&EnableVideoEffect>);
+    insert(509, "StartNewModule", R_VOID, {R_STRING, R_STRING, R_STRING, R_STRING, R_STRING, R_STRING, R_STRING, R_STRING}, &thunk<&StartNewModule>);
+    insert(510, "DisableVideoEffect", R_VOID, {}, &thunk<&DisableVideoEffect>);
+    insert(511, "GetWeaponRanged", R_INT, {R_OBJECT}, &thunk<&GetWeaponRanged>);
+    insert(512, "DoSinglePlayerAutoSave", R_VOID, {}, &thunk<&DoSinglePlayerAutoSave>);
+    insert(513, "GetGameDifficulty", R_INT, {}, &thunk<&GetGameDifficulty>);
+    insert(514, "GetUserActionsPending", R_INT, {}, &thunk<&GetUserActionsPending>);
+    insert(515, "RevealMap", R_VOID, {R_VECTOR, R_INT}, &thunk<&RevealMap>);
+    insert(516, "SetTutorialWindowsEnabled", R_VOID, {R_INT}, &thunk<&SetTutorialWindowsEnabled>);
+    insert(517, "ShowTutorialWindow", R_VOID, {R_INT}, &thunk<&ShowTutorialWindow>);
+    insert(518, "StartCreditSequence", R_VOID, {R_INT}, &thunk<&StartCreditSequence>);
+    insert(519, "IsCreditSequenceInProgress", R_INT, {}, &thunk<&IsCreditSequenceInProgress>);
+    insert(522, "GetCurrentAction", R_INT, {R_OBJECT}, &thunk<&GetCurrentAction>);
+    insert(523, "GetDifficultyModifier", R_FLOAT, {}, &thunk<&GetDifficultyModifier>);
+    insert(524, "GetAppearanceType", R_INT, {R_OBJECT}, &thunk<&GetAppearanceType>);
+    insert(525, "FloatingTextStrRefOnCreature", R_VOID, {R_INT, R_OBJECT, R_INT}, &thunk<&FloatingTextStrRefOnCreature>);
+    insert(526, "FloatingTextStringOnCreature", R_VOID, {R_STRING, R_OBJECT, R_INT}, &thunk<&FloatingTextStringOnCreature>);
+    insert(527, "GetTrapDisarmable", R_INT, {R_OBJECT}, &thunk<&GetTrapDisarmable>);
+    insert(528, "GetTrapDetectable", R_INT, {R_OBJECT}, &thunk<&GetTrapDetectable>);
+    insert(529, "GetTrapDetectedBy", R_INT, {R_OBJECT, R_OBJECT}, &thunk<&GetTrapDetectedBy>);
+    insert(530, "GetTrapFlagged", R_INT, {R_OBJECT}, &thunk<&GetTrapFlagged>);
+    insert(531, "GetTrapBaseType", R_INT, {R_OBJECT}, &thunk<&GetTrapBaseType>);
+    insert(532, "GetTrapOneShot", R_INT, {R_OBJECT}, &thunk<&GetTrapOneShot>);
+    insert(533, "GetTrapCreator", R_OBJECT, {R_OBJECT}, &thunk<&GetTrapCreator>);
+    insert(534, "GetTrapKeyTag", R_STRING, {R_OBJECT}, &thunk<&GetTrapKeyTag>);
+    insert(535, "GetTrapDisarmDC", R_INT, {R_OBJECT}, &thunk<&GetTrapDisarmDC>);
+    insert(536, "GetTrapDetectDC", R_INT, {R_OBJECT}, &thunk<&GetTrapDetectDC>);
+    insert(537, "GetLockKeyRequired", R_INT, {R_OBJECT}, &thunk<&GetLockKeyRequired>);
+    insert(538, "GetLockKeyTag", R_INT, {R_OBJECT}, &thunk<&GetLockKeyTag>);
+    insert(539, "GetLockLockable", R_INT, {R_OBJECT}, &thunk<&GetLockLockable>);
+    insert(540, "GetLockUnlockDC", R_INT, {R_OBJECT}, &thunk<&GetLockUnlockDC>);
+    insert(541, "GetLockLockDC", R_INT, {R_OBJECT}, &thunk<&GetLockLockDC>);
+    insert(542, "GetPCLevellingUp", R_OBJECT, {}, &thunk<&GetPCLevellingUp>);
+    insert(543, "GetHasFeatEffect", R_INT, {R_INT, R_OBJECT}, &thunk<&GetHasFeatEffect>);
+    insert(544, "SetPlaceableIllumination", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetPlaceableIllumination>);
+    insert(545, "GetPlaceableIllumination", R_INT, {R_OBJECT}, &thunk<&GetPlaceableIllumination>);
+    insert(546, "GetIsPlaceableObjectActionPossible", R_INT, {R_OBJECT, R_INT}, &thunk<&GetIsPlaceableObjectActionPossible>);
+    insert(547, "DoPlaceableObjectAction", R_VOID, {R_OBJECT, R_INT}, &thunk<&DoPlaceableObjectAction>);
+    insert(548, "GetFirstPC", R_OBJECT, {}, &thunk<&GetFirstPC>);
+    insert(549, "GetNextPC", R_OBJECT, {}, &thunk<&GetNextPC>);
+    insert(550, "SetTrapDetectedBy", R_INT, {R_OBJECT, R_OBJECT}, &thunk<&SetTrapDetectedBy>);
+    insert(551, "GetIsTrapped", R_INT, {R_OBJECT}, &thunk<&GetIsTrapped>);
+    insert(552, "SetEffectIcon", R_EFFECT, {R_EFFECT, R_INT}, &thunk<&SetEffectIcon>);
+    insert(553, "FaceObjectAwayFromObject", R_VOID, {R_OBJECT, R_OBJECT}, &thunk<&FaceObjectAwayFromObject>);
+    insert(554, "PopUpDeathGUIPanel", R_VOID, {R_OBJECT, R_INT, R_INT, R_INT, R_STRING}, &thunk<&PopUpDeathGUIPanel>);
+    insert(555, "SetTrapDisabled", R_VOID, {R_OBJECT}, &thunk<&SetTrapDisabled>);
+    insert(556, "GetLastHostileActor", R_OBJECT, {R_OBJECT}, &thunk<&GetLastHostileActor>);
+    insert(557, "ExportAllCharacters", R_VOID, {}, &thunk<&ExportAllCharacters>);
+    insert(558, "MusicBackgroundGetDayTrack", R_INT, {R_OBJECT}, &thunk<&MusicBackgroundGetDayTrack>);
+    insert(559, "MusicBackgroundGetNightTrack", R_INT, {R_OBJECT}, &thunk<&MusicBackgroundGetNightTrack>);
+    insert(560, "WriteTimestampedLogEntry", R_VOID, {R_STRING}, &thunk<&WriteTimestampedLogEntry>);
+    insert(561, "GetModuleName", R_STRING, {}, &thunk<&GetModuleName>);
+    insert(562, "GetFactionLeader", R_OBJECT, {R_OBJECT}, &thunk<&GetFactionLeader>);
+    insert(564, "EndGame", R_VOID, {R_INT}, &thunk<&EndGame>);
+    insert(565, "GetRunScriptVar", R_INT, {}, &thunk<&GetRunScriptVar>);
+    insert(566, "GetCreatureMovmentType", R_INT, {R_OBJECT}, &thunk<&GetCreatureMovmentType>);
+    insert(567, "AmbientSoundSetDayVolume", R_VOID, {R_OBJECT, R_INT}, &thunk<&AmbientSoundSetDayVolume>);
+    insert(568, "AmbientSoundSetNightVolume", R_VOID, {R_OBJECT, R_INT}, &thunk<&AmbientSoundSetNightVolume>);
+    insert(569, "MusicBackgroundGetBattleTrack", R_INT, {R_OBJECT}, &thunk<&MusicBackgroundGetBattleTrack>);
+    insert(570, "GetHasInventory", R_INT, {R_OBJECT}, &thunk<&GetHasInventory>);
+    insert(571, "GetStrRefSoundDuration", R_FLOAT, {R_INT}, &thunk<&GetStrRefSoundDuration>);
+    insert(572, "AddToParty", R_VOID, {R_OBJECT, R_OBJECT}, &thunk<&AddToParty>);
+    insert(573, "RemoveFromParty", R_VOID, {R_OBJECT}, &thunk<&RemoveFromParty>);
+    insert(574, "AddPartyMember", R_INT, {R_INT, R_OBJECT}, &thunk<&AddPartyMember>);
+    insert(575, "RemovePartyMember", R_INT, {R_INT}, &thunk<&RemovePartyMember>);
+    insert(576, "IsObjectPartyMember", R_INT, {R_OBJECT}, &thunk<&IsObjectPartyMember>);
+    insert(577, "GetPartyMemberByIndex", R_OBJECT, {R_INT}, &thunk<&GetPartyMemberByIndex>);
+    insert(578, "GetGlobalBoolean", R_INT, {R_STRING}, &thunk<&GetGlobalBoolean>);
+    insert(579, "SetGlobalBoolean", R_VOID, {R_STRING, R_INT}, &thunk<&SetGlobalBoolean>);
+    insert(580, "GetGlobalNumber", R_INT, {R_STRING}, &thunk<&GetGlobalNumber>);
+    insert(581, "SetGlobalNumber", R_VOID, {R_STRING, R_INT}, &thunk<&SetGlobalNumber>);
+    insert(582, "AurPostString", R_VOID, {R_STRING, R_INT, R_INT, R_FLOAT}, &thunk<&AurPostString>);
+    insert(669, "AddJournalWorldEntry", R_VOID, {R_INT, R_STRING, R_STRING}, &thunk<&AddJournalWorldEntry>);
+    insert(670, "AddJournalWorldEntryStrref", R_VOID, {R_INT, R_INT}, &thunk<&AddJournalWorldEntryStrref>);
+    insert(671, "BarkString", R_VOID, {R_OBJECT, R_INT}, &thunk<&BarkString>);
+    insert(672, "DeleteJournalWorldAllEntries", R_VOID, {}, &thunk<&DeleteJournalWorldAllEntries>);
+    insert(673, "DeleteJournalWorldEntry", R_VOID, {R_INT}, &thunk<&DeleteJournalWorldEntry>);
+    insert(674, "DeleteJournalWorldEntryStrref", R_VOID, {R_INT}, &thunk<&DeleteJournalWorldEntryStrref>);
+    insert(677, "PlayVisualAreaEffect", R_VOID, {R_INT, R_LOCATION}, &thunk<&PlayVisualAreaEffect>);
+    insert(678, "SetJournalQuestEntryPicture", R_VOID, {R_STRING, R_OBJECT, R_INT, R_INT, R_INT}, &thunk<&SetJournalQuestEntryPicture>);
+    insert(679, "GetLocalBoolean", R_INT, {R_OBJECT, R_INT}, &thunk<&GetLocalBoolean>);
+    insert(680, "SetLocalBoolean", R_VOID, {R_OBJECT, R_INT, R_INT}, &thunk<&SetLocalBoolean>);
+    insert(681, "GetLocalNumber", R_INT, {R_OBJECT, R_INT}, &thunk<&GetLocalNumber>);
+    insert(682, "SetLocalNumber", R_VOID, {R_OBJECT, R_INT, R_INT}, &thunk<&SetLocalNumber>);
+    insert(689, "SoundObjectGetPitchVariance", R_FLOAT, {R_OBJECT}, &thunk<&SoundObjectGetPitchVariance>);
+    insert(690, "SoundObjectSetPitchVariance", R_VOID, {R_OBJECT, R_FLOAT}, &thunk<&SoundObjectSetPitchVariance>);
+    insert(691, "SoundObjectGetVolume", R_INT, {R_OBJECT}, &thunk<&SoundObjectGetVolume>);
+    insert(692, "GetGlobalLocation", R_LOCATION, {R_STRING}, &thunk<&GetGlobalLocation>);
+    insert(693, "SetGlobalLocation", R_VOID, {R_STRING, R_LOCATION}, &thunk<&SetGlobalLocation>);
+    insert(694, "AddAvailableNPCByObject", R_INT, {R_INT, R_OBJECT}, &thunk<&AddAvailableNPCByObject>);
+    insert(695, "RemoveAvailableNPC", R_INT, {R_INT}, &thunk<&RemoveAvailableNPC>);
+    insert(696, "IsAvailableCreature", R_INT, {R_INT}, &thunk<&IsAvailableCreature>);
+    insert(697, "AddAvailableNPCByTemplate", R_INT, {R_INT, R_STRING}, &thunk<&AddAvailableNPCByTemplate>);
+    insert(698, "SpawnAvailableNPC", R_OBJECT, {R_INT, R_LOCATION}, &thunk<&SpawnAvailableNPC>);
+    insert(699, "IsNPCPartyMember", R_INT, {R_INT}, &thunk<&IsNPCPartyMember>);
+    insert(701, "GetIsConversationActive", R_INT, {}, &thunk<&GetIsConversationActive>);
+    insert(704, "GetPartyAIStyle", R_INT, {}, &thunk<&GetPartyAIStyle>);
+    insert(705, "GetNPCAIStyle", R_INT, {R_OBJECT}, &thunk<&GetNPCAIStyle>);
+    insert(706, "SetPartyAIStyle", R_VOID, {R_INT}, &thunk<&SetPartyAIStyle>);
+    insert(707, "SetNPCAIStyle", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetNPCAIStyle>);
+    insert(708, "SetNPCSelectability", R_VOID, {R_INT, R_INT}, &thunk<&SetNPCSelectability>);
+    insert(709, "GetNPCSelectability", R_INT, {R_INT}, &thunk<&GetNPCSelectability>);
+    insert(710, "ClearAllEffects", R_VOID, {}, &thunk<&ClearAllEffects>);
+    insert(711, "GetLastConversation", R_STRING, {}, &thunk<&GetLastConversation>);
+    insert(712, "ShowPartySelectionGUI", R_VOID, {R_STRING, R_INT, R_INT}, &thunk<&ShowPartySelectionGUI>);
+    insert(713, "GetStandardFaction", R_INT, {R_OBJECT}, &thunk<&GetStandardFaction>);
+    insert(714, "GivePlotXP", R_VOID, {R_STRING, R_INT}, &thunk<&GivePlotXP>);
+    insert(715, "GetMinOneHP", R_INT, {R_OBJECT}, &thunk<&GetMinOneHP>);
+    insert(716, "SetMinOneHP", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetMinOneHP>);
+    insert(719, "SetGlobalFadeIn", R_VOID, {R_FLOAT, R_FLOAT, R_FLOAT, R_FLOAT, R_FLOAT}, &thunk<&SetGlobalFadeIn>);
+    insert(720, "SetGlobalFadeOut", R_VOID, {R_FLOAT, R_FLOAT, R_FLOAT, R_FLOAT, R_FLOAT}, &thunk<&SetGlobalFadeOut>);
+    insert(721, "GetLastHostileTarget", R_OBJECT, {R_OBJECT}, &thunk<&GetLastHostileTarget>);
+    insert(722, "GetLastAttackObjectAction", R_INT, {R_OBJECT}, &thunk<&GetLastAttackObjectAction>);
+    insert(723, "GetLastForcePowerUsed", R_INT, {R_OBJECT}, &thunk<&GetLastForcePowerUsed>);
+    insert(724, "GetLastCombatFeatUsed", R_INT, {R_OBJECT}, &thunk<&GetLastCombatFeatUsed>);
+    insert(725, "GetLastAttackResult", R_INT, {R_OBJECT}, &thunk<&GetLastAttackResult>);
+    insert(726, "GetWasForcePowerSuccessful", R_INT, {R_OBJECT}, &thunk<&GetWasForcePowerSuccessful>);
+    insert(727, "GetFirstAttacker", R_OBJECT, {R_OBJECT}, &thunk<&GetFirstAttacker>);
+    insert(728, "GetNextAttacker", R_OBJECT, {R_OBJECT}, &thunk<&GetNextAttacker>);
+    insert(729, "SetFormation", R_VOID, {R_OBJECT, R_OBJECT, R_INT, R_INT}, &thunk<&SetFormation>);
+    insert(731, "SetForcePowerUnsuccessful", R_VOID, {R_INT, R_OBJECT}, &thunk<&SetForcePowerUnsuccessful>);
+    insert(732, "GetIsDebilitated", R_INT, {R_OBJECT}, &thunk<&GetIsDebilitated>);
+    insert(733, "PlayMovie", R_VOID, {R_STRING}, &thunk<&PlayMovie>);
+    insert(734, "SaveNPCState", R_VOID, {R_INT}, &thunk<&SaveNPCState>);
+    insert(735, "GetCategoryFromTalent", R_INT, {R_TALENT}, &thunk<&GetCategoryFromTalent>);
+    insert(736, "SurrenderByFaction", R_VOID, {R_INT, R_INT}, &thunk<&SurrenderByFaction>);
+    insert(737, "ChangeFactionByFaction", R_VOID, {R_INT, R_INT}, &thunk<&ChangeFactionByFaction>);
+    insert(738, "PlayRoomAnimation", R_VOID, {R_STRING, R_INT}, &thunk<&PlayRoomAnimation>);
+    insert(739, "ShowGalaxyMap", R_VOID, {R_INT}, &thunk<&ShowGalaxyMap>);
+    insert(740, "SetPlanetSelectable", R_VOID, {R_INT, R_INT}, &thunk<&SetPlanetSelectable>);
+    insert(741, "GetPlanetSelectable", R_INT, {R_INT}, &thunk<&GetPlanetSelectable>);
+    insert(742, "SetPlanetAvailable", R_VOID, {R_INT, R_INT}, &thunk<&SetPlanetAvailable>);
+    insert(743, "GetPlanetAvailable", R_INT, {R_INT}, &thunk<&GetPlanetAvailable>);
+    insert(744, "GetSelectedPlanet", R_INT, {}, &thunk<&GetSelectedPlanet>);
+    insert(745, "SoundObjectFadeAndStop", R_VOID, {R_OBJECT, R_FLOAT}, &thunk<&SoundObjectFadeAndStop>);
+    insert(746, "SetAreaFogColor", R_VOID, {R_OBJECT, R_FLOAT, R_FLOAT, R_FLOAT}, &thunk<&SetAreaFogColor>);
+    insert(747, "ChangeItemCost", R_VOID, {R_STRING, R_FLOAT}, &thunk<&ChangeItemCost>);
+    insert(748, "GetIsLiveContentAvailable", R_INT, {R_INT}, &thunk<&GetIsLiveContentAvailable>);
+    insert(749, "ResetDialogState", R_VOID, {}, &thunk<&ResetDialogState>);
+    insert(750, "SetGoodEvilValue", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetGoodEvilValue>);
+    insert(751, "GetIsPoisoned", R_INT, {R_OBJECT}, &thunk<&GetIsPoisoned>);
+    insert(752, "GetSpellTarget", R_OBJECT, {R_OBJECT}, &thunk<&GetSpellTarget>);
+    insert(753, "SetSoloMode", R_VOID, {R_INT}, &thunk<&SetSoloMode>);
+    insert(757, "CancelPostDialogCharacterSwitch", R_VOID, {}, &thunk<&CancelPostDialogCharacterSwitch>);
+    insert(758, "SetMaxHitPoints", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetMaxHitPoints>);
+    insert(759, "NoClicksFor", R_VOID, {R_FLOAT}, &thunk<&NoClicksFor>);
+    insert(760, "HoldWorldFadeInForDialog", R_VOID, {}, &thunk<&HoldWorldFadeInForDialog>);
+    insert(761, "ShipBuild", R_INT, {}, &thunk<&ShipBuild>);
+    insert(762, "SurrenderRetainBuffs", R_VOID, {}, &thunk<&SurrenderRetainBuffs>);
+    insert(763, "SuppressStatusSummaryEntry", R_VOID, {R_INT}, &thunk<&SuppressStatusSummaryEntry>);
+    insert(764, "GetCheatCode", R_INT, {R_INT}, &thunk<&GetCheatCode>);
+    insert(765, "SetMusicVolume", R_VOID, {R_FLOAT}, &thunk<&SetMusicVolume>);
+    insert(766, "CreateItemOnFloor", R_OBJECT, {R_STRING, R_LOCATION, R_INT}, &thunk<&CreateItemOnFloor>);
+    insert(767, "SetAvailableNPCId", R_VOID, {R_INT, R_OBJECT}, &thunk<&SetAvailableNPCId>);
+    insert(768, "IsMoviePlaying", R_INT, {}, &thunk<&IsMoviePlaying>);
+    insert(769, "QueueMovie", R_VOID, {R_STRING, R_INT}, &thunk<&QueueMovie>);
+    insert(770, "PlayMovieQueue", R_VOID, {R_INT}, &thunk<&PlayMovieQueue>);
+    insert(771, "YavinHackCloseDoor", R_VOID, {R_OBJECT}, &thunk<&YavinHackDoorClose>);
 }
 
 void Routines::registerMainTslRoutines() {
-    insert(0, "Random", R_INT, {R_INT}, &Random);
-    insert(1, "PrintString", R_VOID, {R_STRING}, &PrintString);
-    insert(2, "PrintFloat", R_VOID, {R_FLOAT, R_INT, R_INT}, &PrintFloat);
-    insert(3, "FloatToString", R_STRING, {R_FLOAT, R_INT, R_INT}, &FloatToString);
-    insert(4, "PrintInteger", R_VOID, {R_INT}, &PrintInteger);
-    insert(5, "PrintObject", R_VOID, {R_OBJECT}, &PrintObject);
-    insert(6, "AssignCommand", R_VOID, {R_OBJECT, R_ACTION}, &AssignCommand);
-    insert(7, "DelayCommand", R_VOID, {R_FLOAT, R_ACTION}, &DelayCommand);
-    insert(8, "ExecuteScript", R_VOID, {R_STRING, R_OBJECT, R_INT}, &ExecuteScript);
-    insert(9, "ClearAllActions", R_VOID, {}, &ClearAllActions);
-    insert(10, "SetFacing", R_VOID, {R_FLOAT}, &SetFacing);
-    insert(11, "SwitchPlayerCharacter", R_INT, {R_INT}, &SwitchPlayerCharacter);
-    insert(12, "SetTime", R_VOID, {R_INT, R_INT, R_INT, R_INT}, &SetTime);
-    insert(13, "SetPartyLeader", R_INT, {R_INT}, &SetPartyLeader);
-    insert(14, "SetAreaUnescapable", R_VOID, {R_INT}, &SetAreaUnescapable);
-    insert(15, "GetAreaUnescapable", R_INT, {}, &GetAreaUnescapable);
-    insert(16, "GetTimeHour", R_INT, {}, &GetTimeHour);
-    insert(17, "GetTimeMinute", R_INT, {}, &GetTimeMinute);
-    insert(18, "GetTimeSecond", R_INT, {}, &GetTimeSecond);
-    insert(19, "GetTimeMillisecond", R_INT, {}, &GetTimeMillisecond);
-    insert(24, "GetArea", R_OBJECT, {R_OBJECT}, &GetArea);
-    insert(25, "GetEnteringObject", R_OBJECT, {}, &GetEnteringObject);
-    insert(26, "GetExitingObject", R_OBJECT, {}, &GetExitingObject);
-    insert(27, "GetPosition", R_VECTOR, {R_OBJECT}, &GetPosition);
-    insert(28, "GetFacing", R_FLOAT, {R_OBJECT}, &GetFacing);
-    insert(29, "GetItemPossessor", R_OBJECT, {R_OBJECT}, &GetItemPossessor);
-    insert(30, "GetItemPossessedBy", R_OBJECT, {R_OBJECT, R_STRING}, &GetItemPossessedBy);
-    insert(31, "CreateItemOnObject", R_OBJECT, {R_STRING, R_OBJECT, R_INT, R_INT}, &CreateItemOnObject);
-    insert(36, "GetLastAttacker", R_OBJECT, {R_OBJECT}, &GetLastAttacker);
-    insert(38, "GetNearestCreature", R_OBJECT, {R_INT, R_INT, R_OBJECT, R_INT, R_INT, R_INT, R_INT, R_INT}, &GetNearestCreature);
-    insert(41, "GetDistanceToObject", R_FLOAT, {R_OBJECT}, &GetDistanceToObject);
-    insert(42, "GetIsObjectValid", R_INT, {R_OBJECT}, &GetIsObjectValid);
-    insert(45, "SetCameraFacing", R_VOID, {R_FLOAT}, &SetCameraFacing);
-    insert(46, "PlaySound", R_VOID, {R_STRING}, &PlaySound);
-    insert(47, "GetSpellTargetObject", R_OBJECT, {}, &GetSpellTargetObject);
-    insert(49, "GetCurrentHitPoints", R_INT, {R_OBJECT}, &GetCurrentHitPoints);
-    insert(50, "GetMaxHitPoints", R_INT, {R_OBJECT}, &GetMaxHitPoints);
-    insert(52, "GetLastItemEquipped", R_OBJECT, {}, &GetLastItemEquipped);
-    insert(53, "GetSubScreenID", R_INT, {}, &GetSubScreenID);
-    insert(54, "CancelCombat", R_VOID, {R_OBJECT}, &CancelCombat);
-    insert(55, "GetCurrentForcePoints", R_INT, {R_OBJECT}, &GetCurrentForcePoints);
-    insert(56, "GetMaxForcePoints", R_INT, {R_OBJECT}, &GetMaxForcePoints);
-    insert(57, "PauseGame", R_VOID, {R_INT}, &PauseGame);
-    insert(58, "SetPlayerRestrictMode", R_VOID, {R_INT}, &SetPlayerRestrictMode);
-    insert(59, "GetStringLength", R_INT, {R_STRING}, &GetStringLength);
-    insert(60, "GetStringUpperCase", R_STRING, {R_STRING}, &GetStringUpperCase);
-    insert(61, "GetStringLowerCase", R_STRING, {R_STRING}, &GetStringLowerCase);
-    insert(62, "GetStringRight", R_STRING, {R_STRING, R_INT}, &GetStringRight);
-    insert(63, "GetStringLeft", R_STRING, {R_STRING, R_INT}, &GetStringLeft);
-    insert(64, "InsertString", R_STRING, {R_STRING, R_STRING, R_INT}, &InsertString);
-    insert(65, "GetSubString", R_STRING, {R_STRING, R_INT, R_INT}, &GetSubString);
-    insert(66, "FindSubString", R_INT, {R_STRING, R_STRING}, &FindSubString);
-    insert(67, "fabs", R_FLOAT, {R_FLOAT}, &fabs);
-    insert(68, "cos", R_FLOAT, {R_FLOAT}, &cos);
-    insert(69, "sin", R_FLOAT, {R_FLOAT}, &sin);
-    insert(70, "tan", R_FLOAT, {R_FLOAT}, &tan);
-    insert(71, "acos", R_FLOAT, {R_FLOAT}, &acos);
-    insert(72, "asin", R_FLOAT, {R_FLOAT}, &asin);
-    insert(73, "atan", R_FLOAT, {R_FLOAT}, &atan);
-    insert(74, "log", R_FLOAT, {R_FLOAT}, &log);
-    insert(75, "pow", R_FLOAT, {R_FLOAT, R_FLOAT}, &pow);
-    insert(76, "sqrt", R_FLOAT, {R_FLOAT}, &sqrt);
-    insert(77, "abs", R_INT, {R_INT}, &abs);
-    insert(83, "GetPlayerRestrictMode", R_INT, {R_OBJECT}, &GetPlayerRestrictMode);
-    insert(84, "GetCasterLevel", R_INT, {R_OBJECT}, &GetCasterLevel);
-    insert(85, "GetFirstEffect", R_EFFECT, {R_OBJECT}, &GetFirstEffect);
-    insert(86, "GetNextEffect", R_EFFECT, {R_OBJECT}, &GetNextEffect);
-    insert(87, "RemoveEffect", R_VOID, {R_OBJECT, R_EFFECT}, &RemoveEffect);
-    insert(88, "GetIsEffectValid", R_INT, {R_EFFECT}, &GetIsEffectValid);
-    insert(89, "GetEffectDurationType", R_INT, {R_EFFECT}, &GetEffectDurationType);
-    insert(90, "GetEffectSubType", R_INT, {R_EFFECT}, &GetEffectSubType);
-    insert(91, "GetEffectCreator", R_OBJECT, {R_EFFECT}, &GetEffectCreator);
-    insert(92, "IntToString", R_STRING, {R_INT}, &IntToString);
-    insert(93, "GetFirstObjectInArea", R_OBJECT, {R_OBJECT, R_INT}, &GetFirstObjectInArea);
-    insert(94, "GetNextObjectInArea", R_OBJECT, {R_OBJECT, R_INT}, &GetNextObjectInArea);
-    insert(95, "d2", R_INT, {R_INT}, &d2);
-    insert(96, "d3", R_INT, {R_INT}, &d3);
-    insert(97, "d4", R_INT, {R_INT}, &d4);
-    insert(98, "d6", R_INT, {R_INT}, &d6);
-    insert(99, "d8", R_INT, {R_INT}, &d8);
-    insert(100, "d10", R_INT, {R_INT}, &d10);
-    insert(101, "d12", R_INT, {R_INT}, &d12);
-    insert(102, "d20", R_INT, {R_INT}, &d20);
-    insert(103, "d100", R_INT, {R_INT}, &d100);
-    insert(104, "VectorMagnitude", R_FLOAT, {R_VECTOR}, &VectorMagnitude);
-    insert(105, "GetMetaMagicFeat", R_INT, {}, &GetMetaMagicFeat);
-    insert(106, "GetObjectType", R_INT, {R_OBJECT}, &GetObjectType);
-    insert(107, "GetRacialType", R_INT, {R_OBJECT}, &GetRacialType);
-    insert(108, "FortitudeSave", R_INT, {R_OBJECT, R_INT, R_INT, R_OBJECT}, &FortitudeSave);
-    insert(109, "ReflexSave", R_INT, {R_OBJECT, R_INT, R_INT, R_OBJECT}, &ReflexSave);
-    insert(110, "WillSave", R_INT, {R_OBJECT, R_INT, R_INT, R_OBJECT}, &WillSave);
-    insert(111, "GetSpellSaveDC", R_INT, {}, &GetSpellSaveDC);
-    insert(112, "MagicalEffect", R_EFFECT, {R_EFFECT}, &MagicalEffect);
-    insert(113, "SupernaturalEffect", R_EFFECT, {R_EFFECT}, &SupernaturalEffect);
-    insert(114, "ExtraordinaryEffect", R_EFFECT, {R_EFFECT}, &ExtraordinaryEffect);
-    insert(116, "GetAC", R_INT, {R_OBJECT, R_INT}, &GetAC);
-    insert(121, "RoundsToSeconds", R_FLOAT, {R_INT}, &RoundsToSeconds);
-    insert(122, "HoursToSeconds", R_FLOAT, {R_INT}, &HoursToSeconds);
-    insert(123, "TurnsToSeconds", R_FLOAT, {R_INT}, &TurnsToSeconds);
-    insert(124, "SoundObjectSetFixedVariance", R_VOID, {R_OBJECT, R_FLOAT}, &SoundObjectSetFixedVariance);
-    insert(125, "GetGoodEvilValue", R_INT, {R_OBJECT}, &GetGoodEvilValue);
-    insert(126, "GetPartyMemberCount", R_INT, {}, &GetPartyMemberCount);
-    insert(127, "GetAlignmentGoodEvil", R_INT, {R_OBJECT}, &GetAlignmentGoodEvil);
-    insert(128, "GetFirstObjectInShape", R_OBJECT, {R_INT, R_FLOAT, R_LOCATION, R_INT, R_INT, R_VECTOR}, &GetFirstObjectInShape);
-    insert(129, "GetNextObjectInShape", R_OBJECT, {R_INT, R_FLOAT, R_LOCATION, R_INT, R_INT, R_VECTOR}, &GetNextObjectInShape);
-    insert(131, "SignalEvent", R_VOID, {R_OBJECT, R_EVENT}, &SignalEvent);
-    insert(132, "EventUserDefined", R_EVENT, {R_INT}, &EventUserDefined);
-    insert(137, "VectorNormalize", R_VECTOR, {R_VECTOR}, &VectorNormalize);
-    insert(138, "GetItemStackSize", R_INT, {R_OBJECT}, &GetItemStackSize);
-    insert(139, "GetAbilityScore", R_INT, {R_OBJECT, R_INT}, &GetAbilityScore);
-    insert(140, "GetIsDead", R_INT, {R_OBJECT}, &GetIsDead);
-    insert(141, "PrintVector", R_VOID, {R_VECTOR, R_INT}, &PrintVector);
-    insert(142, "Vector", R_VECTOR, {R_FLOAT, R_FLOAT, R_FLOAT}, &Vector);
-    insert(143, "SetFacingPoint", R_VOID, {R_VECTOR}, &SetFacingPoint);
-    insert(144, "AngleToVector", R_VECTOR, {R_FLOAT}, &AngleToVector);
-    insert(145, "VectorToAngle", R_FLOAT, {R_VECTOR}, &VectorToAngle);
-    insert(146, "TouchAttackMelee", R_INT, {R_OBJECT, R_INT}, &TouchAttackMelee);
-    insert(147, "TouchAttackRanged", R_INT, {R_OBJECT, R_INT}, &TouchAttackRanged);
-    insert(150, "SetItemStackSize", R_VOID, {R_OBJECT, R_INT}, &SetItemStackSize);
-    insert(151, "GetDistanceBetween", R_FLOAT, {R_OBJECT, R_OBJECT}, &GetDistanceBetween);
-    insert(152, "SetReturnStrref", R_VOID, {R_INT, R_INT, R_INT}, &SetReturnStrref);
-    insert(155, "GetItemInSlot", R_OBJECT, {R_INT, R_OBJECT}, &GetItemInSlot);
-    insert(160, "SetGlobalString", R_VOID, {R_STRING, R_STRING}, &SetGlobalString);
-    insert(162, "SetCommandable", R_VOID, {R_INT, R_OBJECT}, &SetCommandable);
-    insert(163, "GetCommandable", R_INT, {R_OBJECT}, &GetCommandable);
-    insert(166, "GetHitDice", R_INT, {R_OBJECT}, &GetHitDice);
-    insert(168, "GetTag", R_STRING, {R_OBJECT}, &GetTag);
-    insert(169, "ResistForce", R_INT, {R_OBJECT, R_OBJECT}, &ResistForce);
-    insert(170, "GetEffectType", R_INT, {R_EFFECT}, &GetEffectType);
-    insert(172, "GetFactionEqual", R_INT, {R_OBJECT, R_OBJECT}, &GetFactionEqual);
-    insert(173, "ChangeFaction", R_VOID, {R_OBJECT, R_OBJECT}, &ChangeFaction);
-    insert(174, "GetIsListening", R_INT, {R_OBJECT}, &GetIsListening);
-    insert(175, "SetListening", R_VOID, {R_OBJECT, R_INT}, &SetListening);
-    insert(176, "SetListenPattern", R_VOID, {R_OBJECT, R_STRING, R_INT}, &SetListenPattern);
-    insert(177, "TestStringAgainstPattern", R_INT, {R_STRING, R_STRING}, &TestStringAgainstPattern);
-    insert(178, "GetMatchedSubstring", R_STRING, {R_INT}, &GetMatchedSubstring);
-    insert(179, "GetMatchedSubstringsCount", R_INT, {}, &GetMatchedSubstringsCount);
-    insert(181, "GetFactionWeakestMember", R_OBJECT, {R_OBJECT, R_INT}, &GetFactionWeakestMember);
-    insert(182, "GetFactionStrongestMember", R_OBJECT, {R_OBJECT, R_INT}, &GetFactionStrongestMember);
-    insert(183, "GetFactionMostDamagedMember", R_OBJECT, {R_OBJECT, R_INT}, &GetFactionMostDamagedMember);
-    insert(184, "GetFactionLeastDamagedMember", R_OBJECT, {R_OBJECT, R_INT}, &GetFactionLeastDamagedMember);
-    insert(185, "GetFactionGold", R_INT, {R_OBJECT}, &GetFactionGold);
-    insert(186, "GetFactionAverageReputation", R_INT, {R_OBJECT, R_OBJECT}, &GetFactionAverageReputation);
-    insert(187, "GetFactionAverageGoodEvilAlignment", R_INT, {R_OBJECT}, &GetFactionAverageGoodEvilAlignment);
-    insert(188, "SoundObjectGetFixedVariance", R_FLOAT, {R_OBJECT}, &SoundObjectGetFixedVariance);
-    insert(189, "GetFactionAverageLevel", R_INT, {R_OBJECT}, &GetFactionAverageLevel);
-    insert(190, "GetFactionAverageXP", R_INT, {R_OBJECT}, &GetFactionAverageXP);
-    insert(191, "GetFactionMostFrequentClass", R_INT, {R_OBJECT}, &GetFactionMostFrequentClass);
-    insert(192, "GetFactionWorstAC", R_OBJECT, {R_OBJECT, R_INT}, &GetFactionWorstAC);
-    insert(193, "GetFactionBestAC", R_OBJECT, {R_OBJECT, R_INT}, &GetFactionBestAC);
-    insert(194, "GetGlobalString", R_STRING, {R_STRING}, &GetGlobalString);
-    insert(195, "GetListenPatternNumber", R_INT, {}, &GetListenPatternNumber);
-    insert(197, "GetWaypointByTag", R_OBJECT, {R_STRING}, &GetWaypointByTag);
-    insert(198, "GetTransitionTarget", R_OBJECT, {R_OBJECT}, &GetTransitionTarget);
-    insert(200, "GetObjectByTag", R_OBJECT, {R_STRING, R_INT}, &GetObjectByTag);
-    insert(201, "AdjustAlignment", R_VOID, {R_OBJECT, R_INT, R_INT, R_INT}, &AdjustAlignment);
-    insert(203, "SetAreaTransitionBMP", R_VOID, {R_INT, R_STRING}, &SetAreaTransitionBMP);
-    insert(208, "GetReputation", R_INT, {R_OBJECT, R_OBJECT}, &GetReputation);
-    insert(209, "AdjustReputation", R_VOID, {R_OBJECT, R_OBJECT, R_INT}, &AdjustReputation);
-    insert(210, "GetModuleFileName", R_STRING, {}, &GetModuleFileName);
-    insert(211, "GetGoingToBeAttackedBy", R_OBJECT, {R_OBJECT}, &GetGoingToBeAttackedBy);
-    insert(213, "GetLocation", R_LOCATION, {R_OBJECT}, &GetLocation);
-    insert(215, "Location", R_LOCATION, {R_VECTOR, R_FLOAT}, &CreateLocation);
-    insert(216, "ApplyEffectAtLocation", R_VOID, {R_INT, R_EFFECT, R_LOCATION, R_FLOAT}, &ApplyEffectAtLocation);
-    insert(217, "GetIsPC", R_INT, {R_OBJECT}, &GetIsPC);
-    insert(218, "FeetToMeters", R_FLOAT, {R_FLOAT}, &FeetToMeters);
-    insert(219, "YardsToMeters", R_FLOAT, {R_FLOAT}, &YardsToMeters);
-    insert(220, "ApplyEffectToObject", R_VOID, {R_INT, R_EFFECT, R_OBJECT, R_FLOAT}, &ApplyEffectToObject);
-    insert(221, "SpeakString", R_VOID, {R_STRING, R_INT}, &SpeakString);
-    insert(222, "GetSpellTargetLocation", R_LOCATION, {}, &GetSpellTargetLocation);
-    insert(223, "GetPositionFromLocation", R_VECTOR, {R_LOCATION}, &GetPositionFromLocation);
-    insert(225, "GetFacingFromLocation", R_FLOAT, {R_LOCATION}, &GetFacingFromLocation);
-    insert(226, "GetNearestCreatureToLocation", R_OBJECT, {R_INT, R_INT, R_LOCATION, R_INT, R_INT, R_INT, R_INT, R_INT}, &GetNearestCreatureToLocation);
-    insert(227, "GetNearestObject", R_OBJECT, {R_INT, R_OBJECT, R_INT}, &GetNearestObject);
-    insert(228, "GetNearestObjectToLocation", R_OBJECT, {R_INT, R_LOCATION, R_INT}, &GetNearestObjectToLocation);
-    insert(229, "GetNearestObjectByTag", R_OBJECT, {R_STRING, R_OBJECT, R_INT}, &GetNearestObjectByTag);
-    insert(230, "IntToFloat", R_FLOAT, {R_INT}, &IntToFloat);
-    insert(231, "FloatToInt", R_INT, {R_FLOAT}, &FloatToInt);
-    insert(232, "StringToInt", R_INT, {R_STRING}, &StringToInt);
-    insert(233, "StringToFloat", R_FLOAT, {R_STRING}, &StringToFloat);
-    insert(235, "GetIsEnemy", R_INT, {R_OBJECT, R_OBJECT}, &GetIsEnemy);
-    insert(236, "GetIsFriend", R_INT, {R_OBJECT, R_OBJECT}, &GetIsFriend);
-    insert(237, "GetIsNeutral", R_INT, {R_OBJECT, R_OBJECT}, &GetIsNeutral);
-    insert(238, "GetPCSpeaker", R_OBJECT, {}, &GetPCSpeaker);
-    insert(239, "GetStringByStrRef", R_STRING, {R_INT}, &GetStringByStrRef);
-    insert(241, "DestroyObject", R_VOID, {R_OBJECT, R_FLOAT, R_INT, R_FLOAT, R_INT}, &DestroyObject);
-    insert(242, "GetModule", R_OBJECT, {}, &GetModule);
-    insert(243, "CreateObject", R_OBJECT, {R_INT, R_STRING, R_LOCATION, R_INT}, &CreateObject);
-    insert(244, "EventSpellCastAt", R_EVENT, {R_OBJECT, R_INT, R_INT}, &EventSpellCastAt);
-    insert(245, "GetLastSpellCaster", R_OBJECT, {}, &GetLastSpellCaster);
-    insert(246, "GetLastSpell", R_INT, {}, &GetLastSpell);
-    insert(247, "GetUserDefinedEventNumber", R_INT, {}, &GetUserDefinedEventNumber);
-    insert(248, "GetSpellId", R_INT, {}, &GetSpellId);
-    insert(249, "RandomName", R_STRING, {}, &RandomName);
-    insert(251, "GetLoadFromSaveGame", R_INT, {}, &GetLoadFromSaveGame);
-    insert(253, "GetName", R_STRING, {R_OBJECT}, &GetName);
-    insert(254, "GetLastSpeaker", R_OBJECT, {}, &GetLastSpeaker);
-    insert(255, "BeginConversation", R_INT, {R_STRING, R_OBJECT}, &BeginConversation);
-    insert(256, "GetLastPerceived", R_OBJECT, {}, &GetLastPerceived);
-    insert(257, "GetLastPerceptionHeard", R_INT, {}, &GetLastPerceptionHeard);
-    insert(258, "GetLastPerceptionInaudible", R_INT, {}, &GetLastPerceptionInaudible);
-    insert(259, "GetLastPerceptionSeen", R_INT, {}, &GetLastPerceptionSeen);
-    insert(260, "GetLastClosedBy", R_OBJECT, {}, &GetLastClosedBy);
-    insert(261, "GetLastPerceptionVanished", R_INT, {}, &GetLastPerceptionVanished);
-    insert(262, "GetFirstInPersistentObject", R_OBJECT, {R_OBJECT, R_INT, R_INT}, &GetFirstInPersistentObject);
-    insert(263, "GetNextInPersistentObject", R_OBJECT, {R_OBJECT, R_INT, R_INT}, &GetNextInPersistentObject);
-    insert(264, "GetAreaOfEffectCreator", R_OBJECT, {R_OBJECT}, &GetAreaOfEffectCreator);
-    insert(265, "ShowLevelUpGUI", R_INT, {}, &ShowLevelUpGUI);
-    insert(266, "SetItemNonEquippable", R_VOID, {R_OBJECT, R_INT}, &SetItemNonEquippable);
-    insert(267, "GetButtonMashCheck", R_INT, {}, &GetButtonMashCheck);
-    insert(268, "SetButtonMashCheck", R_VOID, {R_INT}, &SetButtonMashCheck);
-    insert(271, "GiveItem", R_VOID, {R_OBJECT, R_OBJECT}, &GiveItem);
-    insert(272, "ObjectToString", R_STRING, {R_OBJECT}, &ObjectToString);
-    insert(274, "GetIsImmune", R_INT, {R_OBJECT, R_INT, R_OBJECT}, &GetIsImmune);
-    insert(276, "GetEncounterActive", R_INT, {R_OBJECT}, &GetEncounterActive);
-    insert(277, "SetEncounterActive", R_VOID, {R_INT, R_OBJECT}, &SetEncounterActive);
-    insert(278, "GetEncounterSpawnsMax", R_INT, {R_OBJECT}, &GetEncounterSpawnsMax);
-    insert(279, "SetEncounterSpawnsMax", R_VOID, {R_INT, R_OBJECT}, &SetEncounterSpawnsMax);
-    insert(280, "GetEncounterSpawnsCurrent", R_INT, {R_OBJECT}, &GetEncounterSpawnsCurrent);
-    insert(281, "SetEncounterSpawnsCurrent", R_VOID, {R_INT, R_OBJECT}, &SetEncounterSpawnsCurrent);
-    insert(282, "GetModuleItemAcquired", R_OBJECT, {}, &GetModuleItemAcquired);
-    insert(283, "GetModuleItemAcquiredFrom", R_OBJECT, {}, &GetModuleItemAcquiredFrom);
-    insert(284, "SetCustomToken", R_VOID, {R_INT, R_STRING}, &SetCustomToken);
-    insert(285, "GetHasFeat", R_INT, {R_INT, R_OBJECT}, &GetHasFeat);
-    insert(286, "GetHasSkill", R_INT, {R_INT, R_OBJECT}, &GetHasSkill);
-    insert(289, "GetObjectSeen", R_INT, {R_OBJECT, R_OBJECT}, &GetObjectSeen);
-    insert(290, "GetObjectHeard", R_INT, {R_OBJECT, R_OBJECT}, &GetObjectHeard);
-    insert(291, "GetLastPlayerDied", R_OBJECT, {}, &GetLastPlayerDied);
-    insert(292, "GetModuleItemLost", R_OBJECT, {}, &GetModuleItemLost);
-    insert(293, "GetModuleItemLostBy", R_OBJECT, {}, &GetModuleItemLostBy);
-    insert(295, "EventConversation", R_EVENT, {}, &EventConversation);
-    insert(296, "SetEncounterDifficulty", R_VOID, {R_INT, R_OBJECT}, &SetEncounterDifficulty);
-    insert(297, "GetEncounterDifficulty", R_INT, {R_OBJECT}, &GetEncounterDifficulty);
-    insert(298, "GetDistanceBetweenLocations", R_FLOAT, {R_LOCATION, R_LOCATION}, &GetDistanceBetweenLocations);
-    insert(299, "GetReflexAdjustedDamage", R_INT, {R_INT, R_OBJECT, R_INT, R_INT, R_OBJECT}, &GetReflexAdjustedDamage);
-    insert(300, "PlayAnimation", R_VOID, {R_INT, R_FLOAT, R_FLOAT}, &PlayAnimation);
-    insert(301, "TalentSpell", R_TALENT, {R_INT}, &TalentSpell);
-    insert(302, "TalentFeat", R_TALENT, {R_INT}, &TalentFeat);
-    insert(303, "TalentSkill", R_TALENT, {R_INT}, &TalentSkill);
-    insert(304, "GetHasSpellEffect", R_INT, {R_INT, R_OBJECT}, &GetHasSpellEffect);
-    insert(305, "GetEffectSpellId", R_INT, {R_EFFECT}, &GetEffectSpellId);
-    insert(306, "GetCreatureHasTalent", R_INT, {R_TALENT, R_OBJECT}, &GetCreatureHasTalent);
-    insert(307, "GetCreatureTalentRandom", R_TALENT, {R_INT, R_OBJECT, R_INT}, &GetCreatureTalentRandom);
-    insert(308, "GetCreatureTalentBest", R_TALENT, {R_INT, R_INT, R_OBJECT, R_INT, R_INT, R_INT}, &GetCreatureTalentBest);
-    insert(311, "GetGoldPieceValue", R_INT, {R_OBJECT}, &GetGoldPieceValue);
-    insert(312, "GetIsPlayableRacialType", R_INT, {R_OBJECT}, &GetIsPlayableRacialType);
-    insert(313, "JumpToLocation", R_VOID, {R_LOCATION}, &JumpToLocation);
-    insert(315, "GetSkillRank", R_INT, {R_INT, R_OBJECT}, &GetSkillRank);
-    insert(316, "GetAttackTarget", R_OBJECT, {R_OBJECT}, &GetAttackTarget);
-    insert(317, "GetLastAttackType", R_INT, {R_OBJECT}, &GetLastAttackType);
-    insert(318, "GetLastAttackMode", R_INT, {R_OBJECT}, &GetLastAttackMode);
-    insert(319, "GetDistanceBetween2D", R_FLOAT, {R_OBJECT, R_OBJECT}, &GetDistanceBetween2D);
-    insert(320, "GetIsInCombat", R_INT, {R_OBJECT, R_INT}, &GetIsInCombat);
-    insert(321, "GetLastAssociateCommand", R_INT, {R_OBJECT}, &GetLastAssociateCommand);
-    insert(322, "GiveGoldToCreature", R_VOID, {R_OBJECT, R_INT}, &GiveGoldToCreature);
-    insert(323, "SetIsDestroyable", R_VOID, {R_INT, R_INT, R_INT}, &SetIsDestroyable);
-    insert(324, "SetLocked", R_VOID, {R_OBJECT, R_INT}, &SetLocked);
-    insert(325, "GetLocked", R_INT, {R_OBJECT}, &GetLocked);
-    insert(326, "GetClickingObject", R_OBJECT, {}, &GetClickingObject);
-    insert(327, "SetAssociateListenPatterns", R_VOID, {R_OBJECT}, &SetAssociateListenPatterns);
-    insert(328, "GetLastWeaponUsed", R_OBJECT, {R_OBJECT}, &GetLastWeaponUsed);
-    insert(330, "GetLastUsedBy", R_OBJECT, {}, &GetLastUsedBy);
-    insert(331, "GetAbilityModifier", R_INT, {R_INT, R_OBJECT}, &GetAbilityModifier);
-    insert(332, "GetIdentified", R_INT, {R_OBJECT}, &GetIdentified);
-    insert(333, "SetIdentified", R_VOID, {R_OBJECT, R_INT}, &SetIdentified);
-    insert(334, "GetDistanceBetweenLocations2D", R_FLOAT, {R_LOCATION, R_LOCATION}, &GetDistanceBetweenLocations2D);
-    insert(335, "GetDistanceToObject2D", R_FLOAT, {R_OBJECT}, &GetDistanceToObject2D);
-    insert(336, "GetBlockingDoor", R_OBJECT, {}, &GetBlockingDoor);
-    insert(337, "GetIsDoorActionPossible", R_INT, {R_OBJECT, R_INT}, &GetIsDoorActionPossible);
-    insert(338, "DoDoorAction", R_VOID, {R_OBJECT, R_INT}, &DoDoorAction);
-    insert(339, "GetFirstItemInInventory", R_OBJECT, {R_OBJECT}, &GetFirstItemInInventory);
-    insert(340, "GetNextItemInInventory", R_OBJECT, {R_OBJECT}, &GetNextItemInInventory);
-    insert(341, "GetClassByPosition", R_INT, {R_INT, R_OBJECT}, &GetClassByPosition);
-    insert(342, "GetLevelByPosition", R_INT, {R_INT, R_OBJECT}, &GetLevelByPosition);
-    insert(343, "GetLevelByClass", R_INT, {R_INT, R_OBJECT}, &GetLevelByClass);
-    insert(344, "GetDamageDealtByType", R_INT, {R_INT}, &GetDamageDealtByType);
-    insert(345, "GetTotalDamageDealt", R_INT, {}, &GetTotalDamageDealt);
-    insert(346, "GetLastDamager", R_OBJECT, {}, &GetLastDamager);
-    insert(347, "GetLastDisarmed", R_OBJECT, {}, &GetLastDisarmed);
-    insert(348, "GetLastDisturbed", R_OBJECT, {}, &GetLastDisturbed);
-    insert(349, "GetLastLocked", R_OBJECT, {}, &GetLastLocked);
-    insert(350, "GetLastUnlocked", R_OBJECT, {}, &GetLastUnlocked);
-    insert(352, "GetInventoryDisturbType", R_INT, {}, &GetInventoryDisturbType);
-    insert(353, "GetInventoryDisturbItem", R_OBJECT, {}, &GetInventoryDisturbItem);
-    insert(354, "ShowUpgradeScreen", R_VOID, {R_OBJECT, R_OBJECT, R_INT, R_INT, R_STRING}, &ShowUpgradeScreen);
-    insert(355, "VersusAlignmentEffect", R_EFFECT, {R_EFFECT, R_INT, R_INT}, &VersusAlignmentEffect);
-    insert(356, "VersusRacialTypeEffect", R_EFFECT, {R_EFFECT, R_INT}, &VersusRacialTypeEffect);
-    insert(357, "VersusTrapEffect", R_EFFECT, {R_EFFECT}, &VersusTrapEffect);
-    insert(358, "GetGender", R_INT, {R_OBJECT}, &GetGender);
-    insert(359, "GetIsTalentValid", R_INT, {R_TALENT}, &GetIsTalentValid);
-    insert(361, "GetAttemptedAttackTarget", R_OBJECT, {}, &GetAttemptedAttackTarget);
-    insert(362, "GetTypeFromTalent", R_INT, {R_TALENT}, &GetTypeFromTalent);
-    insert(363, "GetIdFromTalent", R_INT, {R_TALENT}, &GetIdFromTalent);
-    insert(364, "PlayPazaak", R_VOID, {R_INT, R_STRING, R_INT, R_INT, R_OBJECT}, &PlayPazaak);
-    insert(365, "GetLastPazaakResult", R_INT, {}, &GetLastPazaakResult);
-    insert(366, "DisplayFeedBackText", R_VOID, {R_OBJECT, R_INT}, &DisplayFeedBackText);
-    insert(367, "AddJournalQuestEntry", R_VOID, {R_STRING, R_INT, R_INT}, &AddJournalQuestEntry);
-    insert(368, "RemoveJournalQuestEntry", R_VOID, {R_STRING}, &RemoveJournalQuestEntry);
-    insert(369, "GetJournalEntry", R_INT, {R_STRING}, &GetJournalEntry);
-    insert(370, "PlayRumblePattern", R_INT, {R_INT}, &PlayRumblePattern);
-    insert(371, "StopRumblePattern", R_INT, {R_INT}, &StopRumblePattern);
-    insert(374, "SendMessageToPC", R_VOID, {R_OBJECT, R_STRING}, &SendMessageToPC);
-    insert(375, "GetAttemptedSpellTarget", R_OBJECT, {}, &GetAttemptedSpellTarget);
-    insert(376, "GetLastOpenedBy", R_OBJECT, {}, &GetLastOpenedBy);
-    insert(377, "GetHasSpell", R_INT, {R_INT, R_OBJECT}, &GetHasSpell);
-    insert(378, "OpenStore", R_VOID, {R_OBJECT, R_OBJECT, R_INT, R_INT}, &OpenStore);
-    insert(380, "GetFirstFactionMember", R_OBJECT, {R_OBJECT, R_INT}, &GetFirstFactionMember);
-    insert(381, "GetNextFactionMember", R_OBJECT, {R_OBJECT, R_INT}, &GetNextFactionMember);
-    insert(384, "GetJournalQuestExperience", R_INT, {R_STRING}, &GetJournalQuestExperience);
-    insert(385, "JumpToObject", R_VOID, {R_OBJECT, R_INT}, &JumpToObject);
-    insert(386, "SetMapPinEnabled", R_VOID, {R_OBJECT, R_INT}, &SetMapPinEnabled);
-    insert(388, "PopUpGUIPanel", R_VOID, {R_OBJECT, R_INT}, &PopUpGUIPanel);
-    insert(389, "AddMultiClass", R_VOID, {R_INT, R_OBJECT}, &AddMultiClass);
-    insert(390, "GetIsLinkImmune", R_INT, {R_OBJECT, R_EFFECT}, &GetIsLinkImmune);
-    insert(393, "GiveXPToCreature", R_VOID, {R_OBJECT, R_INT}, &GiveXPToCreature);
-    insert(394, "SetXP", R_VOID, {R_OBJECT, R_INT}, &SetXP);
-    insert(395, "GetXP", R_INT, {R_OBJECT}, &GetXP);
-    insert(396, "IntToHexString", R_STRING, {R_INT}, &IntToHexString);
-    insert(397, "GetBaseItemType", R_INT, {R_OBJECT}, &GetBaseItemType);
-    insert(398, "GetItemHasItemProperty", R_INT, {R_OBJECT, R_INT}, &GetItemHasItemProperty);
-    insert(401, "GetItemACValue", R_INT, {R_OBJECT}, &GetItemACValue);
-    insert(403, "ExploreAreaForPlayer", R_VOID, {R_OBJECT, R_OBJECT}, &ExploreAreaForPlayer);
-    insert(405, "GetIsDay", R_INT, {}, &GetIsDay);
-    insert(406, "GetIsNight", R_INT, {}, &GetIsNight);
-    insert(407, "GetIsDawn", R_INT, {}, &GetIsDawn);
-    insert(408, "GetIsDusk", R_INT, {}, &GetIsDusk);
-    insert(409, "GetIsEncounterCreature", R_INT, {R_OBJECT}, &GetIsEncounterCreature);
-    insert(410, "GetLastPlayerDying", R_OBJECT, {}, &GetLastPlayerDying);
-    insert(411, "GetStartingLocation", R_LOCATION, {}, &GetStartingLocation);
-    insert(412, "ChangeToStandardFaction", R_VOID, {R_OBJECT, R_INT}, &ChangeToStandardFaction);
-    insert(413, "SoundObjectPlay", R_VOID, {R_OBJECT}, &SoundObjectPlay);
-    insert(414, "SoundObjectStop", R_VOID, {R_OBJECT}, &SoundObjectStop);
-    insert(415, "SoundObjectSetVolume", R_VOID, {R_OBJECT, R_INT}, &SoundObjectSetVolume);
-    insert(416, "SoundObjectSetPosition", R_VOID, {R_OBJECT, R_VECTOR}, &SoundObjectSetPosition);
-    insert(417, "SpeakOneLinerConversation", R_VOID, {R_STRING, R_OBJECT}, &SpeakOneLinerConversation);
-    insert(418, "GetGold", R_INT, {R_OBJECT}, &GetGold);
-    insert(419, "GetLastRespawnButtonPresser", R_OBJECT, {}, &GetLastRespawnButtonPresser);
-    insert(421, "SetLightsaberPowered", R_VOID, {R_OBJECT, R_INT, R_INT, R_INT}, &SetLightsaberPowered);
-    insert(422, "GetIsWeaponEffective", R_INT, {R_OBJECT, R_INT}, &GetIsWeaponEffective);
-    insert(423, "GetLastSpellHarmful", R_INT, {}, &GetLastSpellHarmful);
-    insert(424, "EventActivateItem", R_EVENT, {R_OBJECT, R_LOCATION, R_OBJECT}, &EventActivateItem);
-    insert(425, "MusicBackgroundPlay", R_VOID, {R_OBJECT}, &MusicBackgroundPlay);
-    insert(426, "MusicBackgroundStop", R_VOID, {R_OBJECT}, &MusicBackgroundStop);
-    insert(427, "MusicBackgroundSetDelay", R_VOID, {R_OBJECT, R_INT}, &MusicBackgroundSetDelay);
-    insert(428, "MusicBackgroundChangeDay", R_VOID, {R_OBJECT, R_INT, R_INT}, &MusicBackgroundChangeDay);
-    insert(429, "MusicBackgroundChangeNight", R_VOID, {R_OBJECT, R_INT, R_INT}, &MusicBackgroundChangeNight);
-    insert(430, "MusicBattlePlay", R_VOID, {R_OBJECT}, &MusicBattlePlay);
-    insert(431, "MusicBattleStop", R_VOID, {R_OBJECT}, &MusicBattleStop);
-    insert(432, "MusicBattleChange", R_VOID, {R_OBJECT, R_INT}, &MusicBattleChange);
-    insert(433, "AmbientSoundPlay", R_VOID, {R_OBJECT}, &AmbientSoundPlay);
-    insert(434, "AmbientSoundStop", R_VOID, {R_OBJECT}, &AmbientSoundStop);
-    insert(435, "AmbientSoundChangeDay", R_VOID, {R_OBJECT, R_INT}, &AmbientSoundChangeDay);
-    insert(436, "AmbientSoundChangeNight", R_VOID, {R_OBJECT, R_INT}, &AmbientSoundChangeNight);
-    insert(437, "GetLastKiller", R_OBJECT, {}, &GetLastKiller);
-    insert(438, "GetSpellCastItem", R_OBJECT, {}, &GetSpellCastItem);
-    insert(439, "GetItemActivated", R_OBJECT, {}, &GetItemActivated);
-    insert(440, "GetItemActivator", R_OBJECT, {}, &GetItemActivator);
-    insert(441, "GetItemActivatedTargetLocation", R_LOCATION, {}, &GetItemActivatedTargetLocation);
-    insert(442, "GetItemActivatedTarget", R_OBJECT, {}, &GetItemActivatedTarget);
-    insert(443, "GetIsOpen", R_INT, {R_OBJECT}, &GetIsOpen);
-    insert(444, "TakeGoldFromCreature", R_VOID, {R_INT, R_OBJECT, R_INT}, &TakeGoldFromCreature);
-    insert(445, "GetIsInConversation", R_INT, {R_OBJECT}, &GetIsInConversation);
-    insert(455, "GetPlotFlag", R_INT, {R_OBJECT}, &GetPlotFlag);
-    insert(456, "SetPlotFlag", R_VOID, {R_OBJECT, R_INT}, &SetPlotFlag);
-    insert(461, "SetDialogPlaceableCamera", R_VOID, {R_INT}, &SetDialogPlaceableCamera);
-    insert(462, "GetSoloMode", R_INT, {}, &GetSoloMode);
-    insert(464, "GetMaxStealthXP", R_INT, {}, &GetMaxStealthXP);
-    insert(468, "SetMaxStealthXP", R_VOID, {R_INT}, &SetMaxStealthXP);
-    insert(474, "GetCurrentStealthXP", R_INT, {}, &GetCurrentStealthXP);
-    insert(475, "GetNumStackedItems", R_INT, {R_OBJECT}, &GetNumStackedItems);
-    insert(476, "SurrenderToEnemies", R_VOID, {}, &SurrenderToEnemies);
-    insert(478, "SetCurrentStealthXP", R_VOID, {R_INT}, &SetCurrentStealthXP);
-    insert(479, "GetCreatureSize", R_INT, {R_OBJECT}, &GetCreatureSize);
-    insert(480, "AwardStealthXP", R_VOID, {R_OBJECT}, &AwardStealthXP);
-    insert(481, "GetStealthXPEnabled", R_INT, {}, &GetStealthXPEnabled);
-    insert(482, "SetStealthXPEnabled", R_VOID, {R_INT}, &SetStealthXPEnabled);
-    insert(486, "GetLastTrapDetected", R_OBJECT, {R_OBJECT}, &GetLastTrapDetected);
-    insert(488, "GetNearestTrapToObject", R_OBJECT, {R_OBJECT, R_INT}, &GetNearestTrapToObject);
-    insert(489, "GetAttemptedMovementTarget", R_OBJECT, {}, &GetAttemptedMovementTarget);
-    insert(490, "GetBlockingCreature", R_OBJECT, {R_OBJECT}, &GetBlockingCreature);
-    insert(491, "GetFortitudeSavingThrow", R_INT, {R_OBJECT}, &GetFortitudeSavingThrow);
-    insert(492, "GetWillSavingThrow", R_INT, {R_OBJECT}, &GetWillSavingThrow);
-    insert(493, "GetReflexSavingThrow", R_INT, {R_OBJECT}, &GetReflexSavingThrow);
-    insert(494, "GetChallengeRating", R_FLOAT, {R_OBJECT}, &GetChallengeRating);
-    insert(495, "GetFoundEnemyCreature", R_OBJECT, {R_OBJECT}, &GetFoundEnemyCreature);
-    insert(496, "GetMovementRate", R_INT, {R_OBJECT}, &GetMovementRate);
-    insert(497, "GetSubRace", R_INT, {R_OBJECT}, &GetSubRace);
-    insert(498, "GetStealthXPDecrement", R_INT, {}, &GetStealthXPDecrement);
-    insert(499, "SetStealthXPDecrement", R_VOID, {R_INT}, &SetStealthXPDecrement);
-    insert(500, "DuplicateHeadAppearance", R_VOID, {R_OBJECT, R_OBJECT}, &DuplicateHeadAppearance);
-    insert(503, "CutsceneAttack", R_VOID, {R_OBJECT, R_INT, R_INT, R_INT}, &CutsceneAttack);
-    insert(504, "SetCameraMode", R_VOID, {R_OBJECT, R_INT}, &SetCameraMode);
-    insert(505, "SetLockOrientationInDialog", R_VOID, {R_OBJECT, R_INT}, &SetLockOrientationInDialog);
-    insert(506, "SetLockHeadFollowInDialog", R_VOID, {R_OBJECT, R_INT}, &SetLockHeadFollowInDialog);
-    insert(507, "CutsceneMove", R_VOID, {R_OBJECT, R_VECTOR, R_INT}, &CutsceneMove);
-    insert(508, "EnableVideoEffect", R_VOID, {R_INT}, &EnableVideoEffect);
-    insert(509, "StartNewModule", R_VOID, {R_STRING, R_STRING, R_STRING, R_STRING, R_STRING, R_STRING, R_STRING, R_STRING}, &StartNewModule);
-    insert(510, "DisableVideoEffect", R_VOID, {}, &DisableVideoEffect);
-    insert(511, "GetWeaponRanged", R_INT, {R_OBJECT}, &GetWeaponRanged);
-    insert(512, "DoSinglePlayerAutoSave", R_VOID, {}, &DoSinglePlayerAutoSave);
-    insert(513, "GetGameDifficulty", R_INT, {}, &GetGameDifficulty);
-    insert(514, "GetUserActionsPending", R_INT, {}, &GetUserActionsPending);
-    insert(515, "RevealMap", R_VOID, {R_VECTOR, R_INT}, &RevealMap);
-    insert(516, "SetTutorialWindowsEnabled", R_VOID, {R_INT}, &SetTutorialWindowsEnabled);
-    insert(517, "ShowTutorialWindow", R_VOID, {R_INT}, &ShowTutorialWindow);
-    insert(518, "StartCreditSequence", R_VOID, {R_INT}, &StartCreditSequence);
-    insert(519, "IsCreditSequenceInProgress", R_INT, {}, &IsCreditSequenceInProgress);
-    insert(522, "GetCurrentAction", R_INT, {R_OBJECT}, &GetCurrentAction);
-    insert(523, "GetDifficultyModifier", R_FLOAT, {}, &GetDifficultyModifier);
-    insert(524, "GetAppearanceType", R_INT, {R_OBJECT}, &GetAppearanceType);
-    insert(525, "FloatingTextStrRefOnCreature", R_VOID, {R_INT, R_OBJECT, R_INT}, &FloatingTextStrRefOnCreature);
-    insert(526, "FloatingTextStringOnCreature", R_VOID, {R_STRING, R_OBJECT, R_INT}, &FloatingTextStringOnCreature);
-    insert(527, "GetTrapDisarmable", R_INT, {R_OBJECT}, &GetTrapDisarmable);
-    insert(528, "GetTrapDetectable", R_INT, {R_OBJECT}, &GetTrapDetectable);
-    insert(529, "GetTrapDetectedBy", R_INT, {R_OBJECT, R_OBJECT}, &GetTrapDetectedBy);
-    insert(530, "GetTrapFlagged", R_INT, {R_OBJECT}, &GetTrapFlagged);
-    insert(531, "GetTrapBaseType", R_INT, {R_OBJECT}, &GetTrapBaseType);
-    insert(532, "GetTrapOneShot", R_INT, {R_OBJECT}, &GetTrapOneShot);
-    insert(533, "GetTrapCreator", R_OBJECT, {R_OBJECT}, &GetTrapCreator);
-    insert(534, "GetTrapKeyTag", R_STRING, {R_OBJECT}, &GetTrapKeyTag);
-    insert(535, "GetTrapDisarmDC", R_INT, {R_OBJECT}, &GetTrapDisarmDC);
-    insert(536, "GetTrapDetectDC", R_INT, {R_OBJECT}, &GetTrapDetectDC);
-    insert(537, "GetLockKeyRequired", R_INT, {R_OBJECT}, &GetLockKeyRequired);
-    insert(538, "GetLockKeyTag", R_INT, {R_OBJECT}, &GetLockKeyTag);
-    insert(539, "GetLockLockable", R_INT, {R_OBJECT}, &GetLockLockable);
-    insert(540, "GetLockUnlockDC", R_INT, {R_OBJECT}, &GetLockUnlockDC);
-    insert(541, "GetLockLockDC", R_INT, {R_OBJECT}, &GetLockLockDC);
-    insert(542, "GetPCLevellingUp", R_OBJECT, {}, &GetPCLevellingUp);
-    insert(543, "GetHasFeatEffect", R_INT, {R_INT, R_OBJECT}, &GetHasFeatEffect);
-    insert(544, "SetPlaceableIllumination", R_VOID, {R_OBJECT, R_INT}, &SetPlaceableIllumination);
-    insert(545, "GetPlaceableIllumination", R_INT, {R_OBJECT}, &GetPlaceableIllumination);
-    insert(546, "GetIsPlaceableObjectActionPossible", R_INT, {R_OBJECT, R_INT}, &GetIsPlaceableObjectActionPossible);
-    insert(547, "DoPlaceableObjectAction", R_VOID, {R_OBJECT, R_INT}, &DoPlaceableObjectAction);
-    insert(548, "GetFirstPC", R_OBJECT, {}, &GetFirstPC);
-    insert(549, "GetNextPC", R_OBJECT, {}, &GetNextPC);
-    insert(550, "SetTrapDetectedBy", R_INT, {R_OBJECT, R_OBJECT}, &SetTrapDetectedBy);
-    insert(551, "GetIsTrapped", R_INT, {R_OBJECT}, &GetIsTrapped);
-    insert(552, "SetEffectIcon", R_EFFECT, {R_EFFECT, R_INT}, &SetEffectIcon);
-    insert(553, "FaceObjectAwayFromObject", R_VOID, {R_OBJECT, R_OBJECT}, &FaceObjectAwayFromObject);
-    insert(554, "PopUpDeathGUIPanel", R_VOID, {R_OBJECT, R_INT, R_INT, R_INT, R_STRING}, &PopUpDeathGUIPanel);
-    insert(555, "SetTrapDisabled", R_VOID, {R_OBJECT}, &SetTrapDisabled);
-    insert(556, "GetLastHostileActor", R_OBJECT, {R_OBJECT}, &GetLastHostileActor);
-    insert(557, "ExportAllCharacters", R_VOID, {}, &ExportAllCharacters);
-    insert(558, "MusicBackgroundGetDayTrack", R_INT, {R_OBJECT}, &MusicBackgroundGetDayTrack);
-    insert(559, "MusicBackgroundGetNightTrack", R_INT, {R_OBJECT}, &MusicBackgroundGetNightTrack);
-    insert(560, "WriteTimestampedLogEntry", R_VOID, {R_STRING}, &WriteTimestampedLogEntry);
-    insert(561, "GetModuleName", R_STRING, {}, &GetModuleName);
-    insert(562, "GetFactionLeader", R_OBJECT, {R_OBJECT}, &GetFactionLeader);
-    insert(564, "EndGame", R_VOID, {R_INT}, &EndGame);
-    insert(565, "GetRunScriptVar", R_INT, {}, &GetRunScriptVar);
-    insert(566, "GetCreatureMovmentType", R_INT, {R_OBJECT}, &GetCreatureMovmentType);
-    insert(567, "AmbientSoundSetDayVolume", R_VOID, {R_OBJECT, R_INT}, &AmbientSoundSetDayVolume);
-    insert(568, "AmbientSoundSetNightVolume", R_VOID, {R_OBJECT, R_INT}, &AmbientSoundSetNightVolume);
-    insert(569, "MusicBackgroundGetBattleTrack", R_INT, {R_OBJECT}, &MusicBackgroundGetBattleTrack);
-    insert(570, "GetHasInventory", R_INT, {R_OBJECT}, &GetHasInventory);
-    insert(571, "GetStrRefSoundDuration", R_FLOAT, {R_INT}, &GetStrRefSoundDuration);
-    insert(572, "AddToParty", R_VOID, {R_OBJECT, R_OBJECT}, &AddToParty);
-    insert(573, "RemoveFromParty", R_VOID, {R_OBJECT}, &RemoveFromParty);
-    insert(574, "AddPartyMember", R_INT, {R_INT, R_OBJECT}, &AddPartyMember);
-    insert(575, "RemovePartyMember", R_INT, {R_INT}, &RemovePartyMember);
-    insert(576, "IsObjectPartyMember", R_INT, {R_OBJECT}, &IsObjectPartyMember);
-    insert(577, "GetPartyMemberByIndex", R_OBJECT, {R_INT}, &GetPartyMemberByIndex);
-    insert(578, "GetGlobalBoolean", R_INT, {R_STRING}, &GetGlobalBoolean);
-    insert(579, "SetGlobalBoolean", R_VOID, {R_STRING, R_INT}, &SetGlobalBoolean);
-    insert(580, "GetGlobalNumber", R_INT, {R_STRING}, &GetGlobalNumber);
-    insert(581, "SetGlobalNumber", R_VOID, {R_STRING, R_INT}, &SetGlobalNumber);
-    insert(582, "AurPostString", R_VOID, {R_STRING, R_INT, R_INT, R_FLOAT}, &AurPostString);
-    insert(669, "AddJournalWorldEntry", R_VOID, {R_INT, R_STRING, R_STRING}, &AddJournalWorldEntry);
-    insert(670, "AddJournalWorldEntryStrref", R_VOID, {R_INT, R_INT}, &AddJournalWorldEntryStrref);
-    insert(671, "BarkString", R_VOID, {R_OBJECT, R_INT, R_INT, R_INT}, &BarkString);
-    insert(672, "DeleteJournalWorldAllEntries", R_VOID, {}, &DeleteJournalWorldAllEntries);
-    insert(673, "DeleteJournalWorldEntry", R_VOID, {R_INT}, &DeleteJournalWorldEntry);
-    insert(674, "DeleteJournalWorldEntryStrref", R_VOID, {R_INT}, &DeleteJournalWorldEntryStrref);
-    insert(677, "PlayVisualAreaEffect", R_VOID, {R_INT, R_LOCATION}, &PlayVisualAreaEffect);
-    insert(678, "SetJournalQuestEntryPicture", R_VOID, {R_STRING, R_OBJECT, R_INT, R_INT, R_INT}, &SetJournalQuestEntryPicture);
-    insert(679, "GetLocalBoolean", R_INT, {R_OBJECT, R_INT}, &GetLocalBoolean);
-    insert(680, "SetLocalBoolean", R_VOID, {R_OBJECT, R_INT, R_INT}, &SetLocalBoolean);
-    insert(681, "GetLocalNumber", R_INT, {R_OBJECT, R_INT}, &GetLocalNumber);
-    insert(682, "SetLocalNumber", R_VOID, {R_OBJECT, R_INT, R_INT}, &SetLocalNumber);
-    insert(689, "SoundObjectGetPitchVariance", R_FLOAT, {R_OBJECT}, &SoundObjectGetPitchVariance);
-    insert(690, "SoundObjectSetPitchVariance", R_VOID, {R_OBJECT, R_FLOAT}, &SoundObjectSetPitchVariance);
-    insert(691, "SoundObjectGetVolume", R_INT, {R_OBJECT}, &SoundObjectGetVolume);
-    insert(692, "GetGlobalLocation", R_LOCATION, {R_STRING}, &GetGlobalLocation);
-    insert(693, "SetGlobalLocation", R_VOID, {R_STRING, R_LOCATION}, &SetGlobalLocation);
-    insert(694, "AddAvailableNPCByObject", R_INT, {R_INT, R_OBJECT}, &AddAvailableNPCByObject);
-    insert(695, "RemoveAvailableNPC", R_INT, {R_INT}, &RemoveAvailableNPC);
-    insert(696, "IsAvailableCreature", R_INT, {R_INT}, &IsAvailableCreature);
-    insert(697, "AddAvailableNPCByTemplate", R_INT, {R_INT, R_STRING}, &AddAvailableNPCByTemplate);
-    insert(698, "SpawnAvailableNPC", R_OBJECT, {R_INT, R_LOCATION}, &SpawnAvailableNPC);
-    insert(699, "IsNPCPartyMember", R_INT, {R_INT}, &IsNPCPartyMember);
-    insert(701, "GetIsConversationActive", R_INT, {}, &GetIsConversationActive);
-    insert(704, "GetPartyAIStyle", R_INT, {}, &GetPartyAIStyle);
-    insert(705, "GetNPCAIStyle", R_INT, {R_OBJECT}, &GetNPCAIStyle);
-    insert(706, "SetPartyAIStyle", R_VOID, {R_INT}, &SetPartyAIStyle);
-    insert(707, "SetNPCAIStyle", R_VOID, {R_OBJECT, R_INT}, &SetNPCAIStyle);
-    insert(708, "SetNPCSelectability", R_VOID, {R_INT, R_INT}, &SetNPCSelectability);
-    insert(709, "GetNPCSelectability", R_INT, {R_INT}, &GetNPCSelectability);
-    insert(710, "ClearAllEffects", R_VOID, {}, &ClearAllEffects);
-    insert(711, "GetLastConversation", R_STRING, {}, &GetLastConversation);
-    insert(712, "ShowPartySelectionGUI", R_VOID, {R_STRING, R_INT, R_INT, R_INT}, &ShowPartySelectionGUI);
-    insert(713, "GetStandardFaction", R_INT, {R_OBJECT}, &GetStandardFaction);
-    insert(714, "GivePlotXP", R_VOID, {R_STRING, R_INT}, &GivePlotXP);
-    insert(715, "GetMinOneHP", R_INT, {R_OBJECT}, &GetMinOneHP);
-    insert(716, "SetMinOneHP", R_VOID, {R_OBJECT, R_INT}, &SetMinOneHP);
-    insert(719, "SetGlobalFadeIn", R_VOID, {R_FLOAT, R_FLOAT, R_FLOAT, R_FLOAT, R_FLOAT}, &SetGlobalFadeIn);
-    insert(720, "SetGlobalFadeOut", R_VOID, {R_FLOAT, R_FLOAT, R_FLOAT, R_FLOAT, R_FLOAT}, &SetGlobalFadeOut);
-    insert(721, "GetLastHostileTarget", R_OBJECT, {R_OBJECT}, &GetLastHostileTarget);
-    insert(722, "GetLastAttackObjectAction", R_INT, {R_OBJECT}, &GetLastAttackObjectAction);
-    insert(723, "GetLastForcePowerUsed", R_INT, {R_OBJECT}, &GetLastForcePowerUsed);
-    insert(724, "GetLastCombatFeatUsed", R_INT, {R_OBJECT}, &GetLastCombatFeatUsed);
-    insert(725, "GetLastAttackResult", R_INT, {R_OBJECT}, &GetLastAttackResult);
-    insert(726, "GetWasForcePowerSuccessful", R_INT, {R_OBJECT}, &GetWasForcePowerSuccessful);
-    insert(727, "GetFirstAttacker", R_OBJECT, {R_OBJECT}, &GetFirstAttacker);
-    insert(728, "GetNextAttacker", R_OBJECT, {R_OBJECT}, &GetNextAttacker);
-    insert(729, "SetFormation", R_VOID, {R_OBJECT, R_OBJECT, R_INT, R_INT}, &SetFormation);
-    insert(731, "SetForcePowerUnsuccessful", R_VOID, {R_INT, R_OBJECT}, &SetForcePowerUnsuccessful);
-    insert(732, "GetIsDebilitated", R_INT, {R_OBJECT}, &GetIsDebilitated);
-    insert(733, "PlayMovie", R_VOID, {R_STRING, R_INT}, &PlayMovie);
-    insert(734, "SaveNPCState", R_VOID, {R_INT}, &SaveNPCState);
-    insert(735, "GetCategoryFromTalent", R_INT, {R_TALENT}, &GetCategoryFromTalent);
-    insert(736, "SurrenderByFaction", R_VOID, {R_INT, R_INT}, &SurrenderByFaction);
-    insert(737, "ChangeFactionByFaction", R_VOID, {R_INT, R_INT}, &ChangeFactionByFaction);
-    insert(738, "PlayRoomAnimation", R_VOID, {R_STRING, R_INT}, &PlayRoomAnimation);
-    insert(739, "ShowGalaxyMap", R_VOID, {R_INT}, &ShowGalaxyMap);
-    insert(740, "SetPlanetSelectable", R_VOID, {R_INT, R_INT}, &SetPlanetSelectable);
-    insert(741, "GetPlanetSelectable", R_INT, {R_INT}, &GetPlanetSelectable);
-    insert(742, "SetPlanetAvailable", R_VOID, {R_INT, R_INT}, &SetPlanetAvailable);
-    insert(743, "GetPlanetAvailable", R_INT, {R_INT}, &GetPlanetAvailable);
-    insert(744, "GetSelectedPlanet", R_INT, {}, &GetSelectedPlanet);
-    insert(745, "SoundObjectFadeAndStop", R_VOID, {R_OBJECT, R_FLOAT}, &SoundObjectFadeAndStop);
-    insert(746, "SetAreaFogColor", R_VOID, {R_OBJECT, R_FLOAT, R_FLOAT, R_FLOAT}, &SetAreaFogColor);
-    insert(747, "ChangeItemCost", R_VOID, {R_STRING, R_FLOAT}, &ChangeItemCost);
-    insert(748, "GetIsLiveContentAvailable", R_INT, {R_INT}, &GetIsLiveContentAvailable);
-    insert(749, "ResetDialogState", R_VOID, {}, &ResetDialogState);
-    insert(750, "SetGoodEvilValue", R_VOID, {R_OBJECT, R_INT}, &SetGoodEvilValue);
-    insert(751, "GetIsPoisoned", R_INT, {R_OBJECT}, &GetIsPoisoned);
-    insert(752, "GetSpellTarget", R_OBJECT, {R_OBJECT}, &GetSpellTarget);
-    insert(753, "SetSoloMode", R_VOID, {R_INT}, &SetSoloMode);
-    insert(757, "CancelPostDialogCharacterSwitch", R_VOID, {}, &CancelPostDialogCharacterSwitch);
-    insert(758, "SetMaxHitPoints", R_VOID, {R_OBJECT, R_INT}, &SetMaxHitPoints);
-    insert(759, "NoClicksFor", R_VOID, {R_FLOAT}, &NoClicksFor);
-    insert(760, "HoldWorldFadeInForDialog", R_VOID, {}, &HoldWorldFadeInForDialog);
-    insert(761, "ShipBuild", R_INT, {}, &ShipBuild);
-    insert(762, "SurrenderRetainBuffs", R_VOID, {}, &SurrenderRetainBuffs);
-    insert(763, "SuppressStatusSummaryEntry", R_VOID, {R_INT}, &SuppressStatusSummaryEntry);
-    insert(764, "GetCheatCode", R_INT, {R_INT}, &GetCheatCode);
-    insert(765, "SetMusicVolume", R_VOID, {R_FLOAT}, &SetMusicVolume);
-    insert(766, "CreateItemOnFloor", R_OBJECT, {R_STRING, R_LOCATION, R_INT}, &CreateItemOnFloor);
-    insert(767, "SetAvailableNPCId", R_VOID, {R_INT, R_OBJECT}, &SetAvailableNPCId);
-    insert(768, "GetScriptParameter", R_INT, {R_INT}, &GetScriptParameter);
-    insert(769, "SetFadeUntilScript", R_VOID, {}, &SetFadeUntilScript);
-    insert(771, "GetItemComponent", R_INT, {}, &GetItemComponent);
-    insert(772, "GetItemComponentPieceValue", R_INT, {}, &GetItemComponentPieceValue);
-    insert(773, "ShowChemicalUpgradeScreen", R_VOID, {R_OBJECT}, &ShowChemicalUpgradeScreen);
-    insert(774, "GetChemicals", R_INT, {}, &GetChemicals);
-    insert(775, "GetChemicalPieceValue", R_INT, {}, &GetChemicalPieceValue);
-    insert(776, "GetSpellForcePointCost", R_INT, {}, &GetSpellForcePointCost);
-    insert(783, "GetFeatAcquired", R_INT, {R_INT, R_OBJECT}, &GetFeatAcquired);
-    insert(784, "GetSpellAcquired", R_INT, {R_INT, R_OBJECT}, &GetSpellAcquired);
-    insert(785, "ShowSwoopUpgradeScreen", R_VOID, {}, &ShowSwoopUpgradeScreen);
-    insert(786, "GrantFeat", R_VOID, {R_INT, R_OBJECT}, &GrantFeat);
-    insert(787, "GrantSpell", R_VOID, {R_INT, R_OBJECT}, &GrantSpell);
-    insert(788, "SpawnMine", R_VOID, {R_INT, R_LOCATION, R_INT, R_INT, R_OBJECT}, &SpawnMine);
-    insert(791, "SetFakeCombatState", R_VOID, {R_OBJECT, R_INT}, &SetFakeCombatState);
-    insert(793, "GetOwnerDemolitionsSkill", R_INT, {R_OBJECT}, &GetOwnerDemolitionsSkill);
-    insert(794, "SetOrientOnClick", R_VOID, {R_OBJECT, R_INT}, &SetOrientOnClick);
-    insert(795, "GetInfluence", R_INT, {R_INT}, &GetInfluence);
-    insert(796, "SetInfluence", R_VOID, {R_INT, R_INT}, &SetInfluence);
-    insert(797, "ModifyInfluence", R_VOID, {R_INT, R_INT}, &ModifyInfluence);
-    insert(798, "GetRacialSubType", R_INT, {R_OBJECT}, &GetRacialSubType);
-    insert(799, "IncrementGlobalNumber", R_VOID, {R_STRING, R_INT}, &IncrementGlobalNumber);
-    insert(800, "DecrementGlobalNumber", R_VOID, {R_STRING, R_INT}, &DecrementGlobalNumber);
-    insert(801, "SetBonusForcePoints", R_VOID, {R_OBJECT, R_INT}, &SetBonusForcePoints);
-    insert(802, "AddBonusForcePoints", R_VOID, {R_OBJECT, R_INT}, &AddBonusForcePoints);
-    insert(803, "GetBonusForcePoints", R_VOID, {R_OBJECT}, &GetBonusForcePoints);
-    insert(805, "IsMoviePlaying", R_INT, {}, &IsMoviePlaying);
-    insert(806, "QueueMovie", R_VOID, {R_STRING, R_INT}, &QueueMovie);
-    insert(807, "PlayMovieQueue", R_VOID, {R_INT}, &PlayMovieQueue);
-    insert(808, "YavinHackDoorClose", R_VOID, {R_OBJECT}, &YavinHackDoorClose);
-    insert(810, "IsStealthed", R_INT, {R_OBJECT}, &IsStealthed);
-    insert(811, "IsMeditating", R_INT, {R_OBJECT}, &IsMeditating);
-    insert(812, "IsInTotalDefense", R_INT, {R_OBJECT}, &IsInTotalDefense);
-    insert(813, "SetHealTarget", R_VOID, {R_OBJECT, R_OBJECT}, &SetHealTarget);
-    insert(814, "GetHealTarget", R_OBJECT, {R_OBJECT}, &GetHealTarget);
-    insert(815, "GetRandomDestination", R_VECTOR, {R_OBJECT, R_INT}, &GetRandomDestination);
-    insert(816, "IsFormActive", R_INT, {R_OBJECT, R_INT}, &IsFormActive);
-    insert(817, "GetSpellFormMask", R_INT, {R_INT}, &GetSpellFormMask);
-    insert(818, "GetSpellBaseForcePointCost", R_INT, {R_INT}, &GetSpellBaseForcePointCost);
-    insert(819, "SetKeepStealthInDialog", R_VOID, {R_INT}, &SetKeepStealthInDialog);
-    insert(820, "HasLineOfSight", R_INT, {R_VECTOR, R_VECTOR, R_OBJECT, R_OBJECT}, &HasLineOfSight);
-    insert(821, "ShowDemoScreen", R_INT, {R_STRING, R_INT, R_INT, R_INT, R_INT}, &ShowDemoScreen);
-    insert(822, "ForceHeartbeat", R_VOID, {R_OBJECT}, &ForceHeartbeat);
-    insert(824, "IsRunning", R_INT, {R_OBJECT}, &IsRunning);
-    insert(826, "SetForfeitConditions", R_VOID, {R_INT}, &SetForfeitConditions);
-    insert(827, "GetLastForfeitViolation", R_INT, {}, &GetLastForfeitViolation);
-    insert(828, "ModifyReflexSavingThrowBase", R_VOID, {R_OBJECT, R_INT}, &ModifyReflexSavingThrowBase);
-    insert(829, "ModifyFortitudeSavingThrowBase", R_VOID, {R_OBJECT, R_INT}, &ModifyFortitudeSavingThrowBase);
-    insert(830, "ModifyWillSavingThrowBase", R_VOID, {R_OBJECT, R_INT}, &ModifyWillSavingThrowBase);
-    insert(831, "GetScriptStringParameter", R_STRING, {}, &GetScriptStringParameter);
-    insert(832, "GetObjectPersonalSpace", R_FLOAT, {R_OBJECT}, &GetObjectPersonalSpace);
-    insert(833, "AdjustCreatureAttributes", R_VOID, {R_OBJECT, R_INT, R_INT}, &AdjustCreatureAttributes);
-    insert(834, "SetCreatureAILevel", R_VOID, {R_OBJECT, R_INT}, &SetCreatureAILevel);
-    insert(835, "ResetCreatureAILevel", R_VOID, {R_OBJECT}, &ResetCreatureAILevel);
-    insert(836, "AddAvailablePUPByTemplate", R_INT, {R_INT, R_STRING}, &AddAvailablePUPByTemplate);
-    insert(837, "AddAvailablePUPByObject", R_INT, {R_INT, R_OBJECT}, &AddAvailablePUPByObject);
-    insert(838, "AssignPUP", R_INT, {R_INT, R_INT}, &AssignPUP);
-    insert(839, "SpawnAvailablePUP", R_OBJECT, {R_INT, R_LOCATION}, &SpawnAvailablePUP);
-    insert(840, "AddPartyPuppet", R_INT, {R_INT, R_OBJECT}, &AddPartyPuppet);
-    insert(841, "GetPUPOwner", R_OBJECT, {R_OBJECT}, &GetPUPOwner);
-    insert(842, "GetIsPuppet", R_INT, {R_OBJECT}, &GetIsPuppet);
-    insert(844, "GetIsPartyLeader", R_INT, {R_OBJECT}, &GetIsPartyLeader);
-    insert(845, "GetPartyLeader", R_OBJECT, {}, &GetPartyLeader);
-    insert(846, "RemoveNPCFromPartyToBase", R_INT, {R_INT}, &RemoveNPCFromPartyToBase);
-    insert(847, "CreatureFlourishWeapon", R_VOID, {R_OBJECT}, &CreatureFlourishWeapon);
-    insert(850, "ChangeObjectAppearance", R_VOID, {R_OBJECT, R_INT}, &ChangeObjectAppearance);
-    insert(851, "GetIsXBox", R_INT, {}, &GetIsXBox);
-    insert(854, "PlayOverlayAnimation", R_VOID, {R_OBJECT, R_INT}, &PlayOverlayAnimation);
-    insert(855, "UnlockAllSongs", R_VOID, {}, &UnlockAllSongs);
-    insert(856, "DisableMap", R_VOID, {R_INT}, &DisableMap);
-    insert(857, "DetonateMine", R_VOID, {R_OBJECT}, &DetonateMine);
-    insert(858, "DisableHealthRegen", R_VOID, {R_INT}, &DisableHealthRegen);
-    insert(859, "SetCurrentForm", R_VOID, {R_OBJECT, R_INT}, &SetCurrentForm);
-    insert(860, "SetDisableTransit", R_VOID, {R_INT}, &SetDisableTransit);
-    insert(861, "SetInputClass", R_VOID, {R_INT}, &SetInputClass);
-    insert(862, "SetForceAlwaysUpdate", R_VOID, {R_OBJECT, R_INT}, &SetForceAlwaysUpdate);
-    insert(863, "EnableRain", R_VOID, {R_INT}, &EnableRain);
-    insert(864, "DisplayMessageBox", R_VOID, {R_INT, R_STRING}, &DisplayMessageBox);
-    insert(865, "DisplayDatapad", R_VOID, {R_OBJECT}, &DisplayDatapad);
-    insert(866, "RemoveHeartbeat", R_VOID, {R_OBJECT}, &RemoveHeartbeat);
-    insert(867, "RemoveEffectByID", R_VOID, {R_OBJECT, R_INT}, &RemoveEffectByID);
-    insert(868, "RemoveEffectByExactMatch", R_VOID, {R_OBJECT, R_EFFECT}, &RemoveEffectByExactMatch);
-    insert(869, "AdjustCreatureSkills", R_VOID, {R_OBJECT, R_INT, R_INT}, &AdjustCreatureSkills);
-    insert(870, "GetSkillRankBase", R_INT, {R_INT, R_OBJECT}, &GetSkillRankBase);
-    insert(871, "EnableRendering", R_VOID, {R_OBJECT, R_INT}, &EnableRendering);
-    insert(872, "GetCombatActionsPending", R_INT, {R_OBJECT}, &GetCombatActionsPending);
-    insert(873, "SaveNPCByObject", R_VOID, {R_INT, R_OBJECT}, &SaveNPCByObject);
-    insert(874, "SavePUPByObject", R_VOID, {R_INT, R_OBJECT}, &SavePUPByObject);
-    insert(875, "GetIsPlayerMadeCharacter", R_INT, {R_OBJECT}, &GetIsPlayerMadeCharacter);
-    insert(876, "RebuildPartyTable", R_VOID, {}, &RebuildPartyTable);
+    insert(0, "Random", R_INT, {R_INT}, &thunk<&Random>);
+    insert(1, "PrintString", R_VOID, {R_STRING}, &thunk<&PrintString>);
+    insert(2, "PrintFloat", R_VOID, {R_FLOAT, R_INT, R_INT}, &thunk<&PrintFloat>);
+    insert(3, "FloatToString", R_STRING, {R_FLOAT, R_INT, R_INT}, &thunk<&FloatToString>);
+    insert(4, "PrintInteger", R_VOID, {R_INT}, &thunk<&PrintInteger>);
+    insert(5, "PrintObject", R_VOID, {R_OBJECT}, &thunk<&PrintObject>);
+    insert(6, "AssignCommand", R_VOID, {R_OBJECT, R_ACTION}, &thunk<&AssignCommand>);
+    insert(7, "DelayCommand", R_VOID, {R_FLOAT, R_ACTION}, &thunk<&DelayCommand>);
+    insert(8, "ExecuteScript", R_VOID, {R_STRING, R_OBJECT, R_INT}, &thunk<&ExecuteScript>);
+    insert(9, "ClearAllActions", R_VOID, {}, &thunk<&ClearAllActions>);
+    insert(10, "SetFacing", R_VOID, {R_FLOAT}, &thunk<&SetFacing>);
+    insert(11, "SwitchPlayerCharacter", R_INT, {R_INT}, &thunk<&SwitchPlayerCharacter>);
+    insert(12, "SetTime", R_VOID, {R_INT, R_INT, R_INT, R_INT}, &thunk<&SetTime>);
+    insert(13, "SetPartyLeader", R_INT, {R_INT}, &thunk<&SetPartyLeader>);
+    insert(14, "SetAreaUnescapable", R_VOID, {R_INT}, &thunk<&SetAreaUnescapable>);
+    insert(15, "GetAreaUnescapable", R_INT, {}, &thunk<&GetAreaUnescapable>);
+    insert(16, "GetTimeHour", R_INT, {}, &thunk<&GetTimeHour>);
+    insert(17, "GetTimeMinute", R_INT, {}, &thunk<&GetTimeMinute>);
+    insert(18, "GetTimeSecond", R_INT, {}, &thunk<&GetTimeSecond>);
+    insert(19, "GetTimeMillisecond", R_INT, {}, &thunk<&GetTimeMillisecond>);
+    insert(24, "GetArea", R_OBJECT, {R_OBJECT}, &thunk<&GetArea>);
+    insert(25, "GetEnteringObject", R_OBJECT, {}, &thunk<&GetEnteringObject>);
+    insert(26, "GetExitingObject", R_OBJECT, {}, &thunk<&GetExitingObject>);
+    insert(27, "GetPosition", R_VECTOR, {R_OBJECT}, &thunk<&GetPosition>);
+    insert(28, "GetFacing", R_FLOAT, {R_OBJECT}, &thunk<&GetFacing>);
+    insert(29, "GetItemPossessor", R_OBJECT, {R_OBJECT}, &thunk<&GetItemPossessor>);
+    insert(30, "GetItemPossessedBy", R_OBJECT, {R_OBJECT, R_STRING}, &thunk<&GetItemPossessedBy>);
+    insert(31, "CreateItemOnObject", R_OBJECT, {R_STRING, R_OBJECT, R_INT, R_INT}, &thunk<&CreateItemOnObject>);
+    insert(36, "GetLastAttacker", R_OBJECT, {R_OBJECT}, &thunk<&GetLastAttacker>);
+    insert(38, "GetNearestCreature", R_OBJECT, {R_INT, R_INT, R_OBJECT, R_INT, R_INT, R_INT, R_INT, R_INT}, &thunk<&GetNearestCreature>);
+    insert(41, "GetDistanceToObject", R_FLOAT, {R_OBJECT}, &thunk<&GetDistanceToObject>);
+    insert(42, "GetIsObjectValid", R_INT, {R_OBJECT}, &thunk<&GetIsObjectValid>);
+    insert(45, "SetCameraFacing", R_VOID, {R_FLOAT}, &thunk<&SetCameraFacing>);
+    insert(46, "PlaySound", R_VOID, {R_STRING}, &thunk<&PlaySound>);
+    insert(47, "GetSpellTargetObject", R_OBJECT, {}, &thunk<&GetSpellTargetObject>);
+    insert(49, "GetCurrentHitPoints", R_INT, {R_OBJECT}, &thunk<&GetCurrentHitPoints>);
+    insert(50, "GetMaxHitPoints", R_INT, {R_OBJECT}, &thunk<&GetMaxHitPoints>);
+    insert(52, "GetLastItemEquipped", R_OBJECT, {}, &thunk<&GetLastItemEquipped>);
+    insert(53, "GetSubScreenID", R_INT, {}, &thunk<&GetSubScreenID>);
+    insert(54, "CancelCombat", R_VOID, {R_OBJECT}, &thunk<&CancelCombat>);
+    insert(55, "GetCurrentForcePoints", R_INT, {R_OBJECT}, &thunk<&GetCurrentForcePoints>);
+    insert(56, "GetMaxForcePoints", R_INT, {R_OBJECT}, &thunk<&GetMaxForcePoints>);
+    insert(57, "PauseGame", R_VOID, {R_INT}, &thunk<&PauseGame>);
+    insert(58, "SetPlayerRestrictMode", R_VOID, {R_INT}, &thunk<&SetPlayerRestrictMode>);
+    insert(59, "GetStringLength", R_INT, {R_STRING}, &thunk<&GetStringLength>);
+    insert(60, "GetStringUpperCase", R_STRING, {R_STRING}, &thunk<&GetStringUpperCase>);
+    insert(61, "GetStringLowerCase", R_STRING, {R_STRING}, &thunk<&GetStringLowerCase>);
+    insert(62, "GetStringRight", R_STRING, {R_STRING, R_INT}, &thunk<&GetStringRight>);
+    insert(63, "GetStringLeft", R_STRING, {R_STRING, R_INT}, &thunk<&GetStringLeft>);
+    insert(64, "InsertString", R_STRING, {R_STRING, R_STRING, R_INT}, &thunk<&InsertString>);
+    insert(65, "GetSubString", R_STRING, {R_STRING, R_INT, R_INT}, &thunk<&GetSubString>);
+    insert(66, "FindSubString", R_INT, {R_STRING, R_STRING}, &thunk<&FindSubString>);
+    insert(67, "fabs", R_FLOAT, {R_FLOAT}, &thunk<&fabs>);
+    insert(68, "cos", R_FLOAT, {R_FLOAT}, &thunk<&cos>);
+    insert(69, "sin", R_FLOAT, {R_FLOAT}, &thunk<&sin>);
+    insert(70, "tan", R_FLOAT, {R_FLOAT}, &thunk<&tan>);
+    insert(71, "acos", R_FLOAT, {R_FLOAT}, &thunk<&acos>);
+    insert(72, "asin", R_FLOAT, {R_FLOAT}, &thunk<&asin>);
+    insert(73, "atan", R_FLOAT, {R_FLOAT}, &thunk<&atan>);
+    insert(74, "log", R_FLOAT, {R_FLOAT}, &thunk<&log>);
+    insert(75, "pow", R_FLOAT, {R_FLOAT, R_FLOAT}, &thunk<&pow>);
+    insert(76, "sqrt", R_FLOAT, {R_FLOAT}, &thunk<&sqrt>);
+    insert(77, "abs", R_INT, {R_INT}, &thunk<&abs>);
+    insert(83, "GetPlayerRestrictMode", R_INT, {R_OBJECT}, &thunk<&GetPlayerRestrictMode>);
+    insert(84, "GetCasterLevel", R_INT, {R_OBJECT}, &thunk<&GetCasterLevel>);
+    insert(85, "GetFirstEffect", R_EFFECT, {R_OBJECT}, &thunk<&GetFirstEffect>);
+    insert(86, "GetNextEffect", R_EFFECT, {R_OBJECT}, &thunk<&GetNextEffect>);
+    insert(87, "RemoveEffect", R_VOID, {R_OBJECT, R_EFFECT}, &thunk<&RemoveEffect>);
+    insert(88, "GetIsEffectValid", R_INT, {R_EFFECT}, &thunk<&GetIsEffectValid>);
+    insert(89, "GetEffectDurationType", R_INT, {R_EFFECT}, &thunk<&GetEffectDurationType>);
+    insert(90, "GetEffectSubType", R_INT, {R_EFFECT}, &thunk<&GetEffectSubType>);
+    insert(91, "GetEffectCreator", R_OBJECT, {R_EFFECT}, &thunk<&GetEffectCreator>);
+    insert(92, "IntToString", R_STRING, {R_INT}, &thunk<&IntToString>);
+    insert(93, "GetFirstObjectInArea", R_OBJECT, {R_OBJECT, R_INT}, &thunk<&GetFirstObjectInArea>);
+    insert(94, "GetNextObjectInArea", R_OBJECT, {R_OBJECT, R_INT}, &thunk<&GetNextObjectInArea>);
+    insert(95, "d2", R_INT, {R_INT}, &thunk<&d2>);
+    insert(96, "d3", R_INT, {R_INT}, &thunk<&d3>);
+    insert(97, "d4", R_INT, {R_INT}, &thunk<&d4>);
+    insert(98, "d6", R_INT, {R_INT}, &thunk<&d6>);
+    insert(99, "d8", R_INT, {R_INT}, &thunk<&d8>);
+    insert(100, "d10", R_INT, {R_INT}, &thunk<&d10>);
+    insert(101, "d12", R_INT, {R_INT}, &thunk<&d12>);
+    insert(102, "d20", R_INT, {R_INT}, &thunk<&d20>);
+    insert(103, "d100", R_INT, {R_INT}, &thunk<&d100>);
+    insert(104, "VectorMagnitude", R_FLOAT, {R_VECTOR}, &thunk<&VectorMagnitude>);
+    insert(105, "GetMetaMagicFeat", R_INT, {}, &thunk<&GetMetaMagicFeat>);
+    insert(106, "GetObjectType", R_INT, {R_OBJECT}, &thunk<&GetObjectType>);
+    insert(107, "GetRacialType", R_INT, {R_OBJECT}, &thunk<&GetRacialType>);
+    insert(108, "FortitudeSave", R_INT, {R_OBJECT, R_INT, R_INT, R_OBJECT}, &thunk<&FortitudeSave>);
+    insert(109, "ReflexSave", R_INT, {R_OBJECT, R_INT, R_INT, R_OBJECT}, &thunk<&ReflexSave>);
+    insert(110, "WillSave", R_INT, {R_OBJECT, R_INT, R_INT, R_OBJECT}, &thunk<&WillSave>);
+    insert(111, "GetSpellSaveDC", R_INT, {}, &thunk<&GetSpellSaveDC>);
+    insert(112, "MagicalEffect", R_EFFECT, {R_EFFECT}, &thunk<&MagicalEffect>);
+    insert(113, "SupernaturalEffect", R_EFFECT, {R_EFFECT}, &thunk<&SupernaturalEffect>);
+    insert(114, "ExtraordinaryEffect", R_EFFECT, {R_EFFECT}, &thunk<&ExtraordinaryEffect>);
+    insert(116, "GetAC", R_INT, {R_OBJECT, R_INT}, &thunk<&GetAC>);
+    insert(121, "RoundsToSeconds", R_FLOAT, {R_INT}, &thunk<&RoundsToSeconds>);
+    insert(122, "HoursToSeconds", R_FLOAT, {R_INT}, &thunk<&HoursToSeconds>);
+    insert(123, "TurnsToSeconds", R_FLOAT, {R_INT}, &thunk<&TurnsToSeconds>);
+    insert(124, "SoundObjectSetFixedVariance", R_VOID, {R_OBJECT, R_FLOAT}, &thunk<&SoundObjectSetFixedVariance>);
+    insert(125, "GetGoodEvilValue", R_INT, {R_OBJECT}, &thunk<&GetGoodEvilValue>);
+    insert(126, "GetPartyMemberCount", R_INT, {}, &thunk<&GetPartyMemberCount>);
+    insert(127, "GetAlignmentGoodEvil", R_INT, {R_OBJECT}, &thunk<&GetAlignmentGoodEvil>);
+    insert(128, "GetFirstObjectInShape", R_OBJECT, {R_INT, R_FLOAT, R_LOCATION, R_INT, R_INT, R_VECTOR}, &thunk<&GetFirstObjectInShape>);
+    insert(129, "GetNextObjectInShape", R_OBJECT, {R_INT, R_FLOAT, R_LOCATION, R_INT, R_INT, R_VECTOR}, &thunk<&GetNextObjectInShape>);
+    insert(131, "SignalEvent", R_VOID, {R_OBJECT, R_EVENT}, &thunk<&SignalEvent>);
+    insert(132, "EventUserDefined", R_EVENT, {R_INT}, &thunk<&EventUserDefined>);
+    insert(137, "VectorNormalize", R_VECTOR, {R_VECTOR}, &thunk<&VectorNormalize>);
+    insert(138, "GetItemStackSize", R_INT, {R_OBJECT}, &thunk<&GetItemStackSize>);
+    insert(139, "GetAbilityScore", R_INT, {R_OBJECT, R_INT}, &thunk<&GetAbilityScore>);
+    insert(140, "GetIsDead", R_INT, {R_OBJECT}, &thunk<&GetIsDead>);
+    insert(141, "PrintVector", R_VOID, {R_VECTOR, R_INT}, &thunk<&PrintVector>);
+    insert(142, "Vector", R_VECTOR, {R_FLOAT, R_FLOAT, R_FLOAT}, &thunk<&Vector>);
+    insert(143, "SetFacingPoint", R_VOID, {R_VECTOR}, &thunk<&SetFacingPoint>);
+    insert(144, "AngleToVector", R_VECTOR, {R_FLOAT}, &thunk<&AngleToVector>);
+    insert(145, "VectorToAngle", R_FLOAT, {R_VECTOR}, &thunk<&VectorToAngle>);
+    insert(146, "TouchAttackMelee", R_INT, {R_OBJECT, R_INT}, &thunk<&TouchAttackMelee>);
+    insert(147, "TouchAttackRanged", R_INT, {R_OBJECT, R_INT}, &thunk<&TouchAttackRanged>);
+    insert(150, "SetItemStackSize", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetItemStackSize>);
+    insert(151, "GetDistanceBetween", R_FLOAT, {R_OBJECT, R_OBJECT}, &thunk<&GetDistanceBetween>);
+    insert(152, "SetReturnStrref", R_VOID, {R_INT, R_INT, R_INT}, &thunk<&SetReturnStrref>);
+    insert(155, "GetItemInSlot", R_OBJECT, {R_INT, R_OBJECT}, &thunk<&GetItemInSlot>);
+    insert(160, "SetGlobalString", R_VOID, {R_STRING, R_STRING}, &thunk<&SetGlobalString>);
+    insert(162, "SetCommandable", R_VOID, {R_INT, R_OBJECT}, &thunk<&SetCommandable>);
+    insert(163, "GetCommandable", R_INT, {R_OBJECT}, &thunk<&GetCommandable>);
+    insert(166, "GetHitDice", R_INT, {R_OBJECT}, &thunk<&GetHitDice>);
+    insert(168, "GetTag", R_STRING, {R_OBJECT}, &thunk<&GetTag>);
+    insert(169, "ResistForce", R_INT, {R_OBJECT, R_OBJECT}, &thunk<&ResistForce>);
+    insert(170, "GetEffectType", R_INT, {R_EFFECT}, &thunk<&GetEffectType>);
+    insert(172, "GetFactionEqual", R_INT, {R_OBJECT, R_OBJECT}, &thunk<&GetFactionEqual>);
+    insert(173, "ChangeFaction", R_VOID, {R_OBJECT, R_OBJECT}, &thunk<&ChangeFaction>);
+    insert(174, "GetIsListening", R_INT, {R_OBJECT}, &thunk<&GetIsListening>);
+    insert(175, "SetListening", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetListening>);
+    insert(176, "SetListenPattern", R_VOID, {R_OBJECT, R_STRING, R_INT}, &thunk<&SetListenPattern>);
+    insert(177, "TestStringAgainstPattern", R_INT, {R_STRING, R_STRING}, &thunk<&TestStringAgainstPattern>);
+    insert(178, "GetMatchedSubstring", R_STRING, {R_INT}, &thunk<&GetMatchedSubstring>);
+    insert(179, "GetMatchedSubstringsCount", R_INT, {}, &thunk<&GetMatchedSubstringsCount>);
+    insert(181, "GetFactionWeakestMember", R_OBJECT, {R_OBJECT, R_INT}, &thunk<&GetFactionWeakestMember>);
+    insert(182, "GetFactionStrongestMember", R_OBJECT, {R_OBJECT, R_INT}, &thunk<&GetFactionStrongestMember>);
+    insert(183, "GetFactionMostDamagedMember", R_OBJECT, {R_OBJECT, R_INT}, &thunk<&GetFactionMostDamagedMember>);
+    insert(184, "GetFactionLeastDamagedMember", R_OBJECT, {R_OBJECT, R_INT}, &thunk<&GetFactionLeastDamagedMember>);
+    insert(185, "GetFactionGold", R_INT, {R_OBJECT}, &thunk<&GetFactionGold>);
+    insert(186, "GetFactionAverageReputation", R_INT, {R_OBJECT, R_OBJECT}, &thunk<&GetFactionAverageReputation>);
+    insert(187, "GetFactionAverageGoodEvilAlignment", R_INT, {R_OBJECT}, &thunk<&GetFactionAverageGoodEvilAlignment>);
+    insert(188, "SoundObjectGetFixedVariance", R_FLOAT, {R_OBJECT}, &thunk<&SoundObjectGetFixedVariance>);
+    insert(189, "GetFactionAverageLevel", R_INT, {R_OBJECT}, &thunk<&GetFactionAverageLevel>);
+    insert(190, "GetFactionAverageXP", R_INT, {R_OBJECT}, &thunk<&GetFactionAverageXP>);
+    insert(191, "GetFactionMostFrequentClass", R_INT, {R_OBJECT}, &thunk<&GetFactionMostFrequentClass>);
+    insert(192, "GetFactionWorstAC", R_OBJECT, {R_OBJECT, R_INT}, &thunk<&GetFactionWorstAC>);
+    insert(193, "GetFactionBestAC", R_OBJECT, {R_OBJECT, R_INT}, &thunk<&GetFactionBestAC>);
+    insert(194, "GetGlobalString", R_STRING, {R_STRING}, &thunk<&GetGlobalString>);
+    insert(195, "GetListenPatternNumber", R_INT, {}, &thunk<&GetListenPatternNumber>);
+    insert(197, "GetWaypointByTag", R_OBJECT, {R_STRING}, &thunk<&GetWaypointByTag>);
+    insert(198, "GetTransitionTarget", R_OBJECT, {R_OBJECT}, &thunk<&GetTransitionTarget>);
+    insert(200, "GetObjectByTag", R_OBJECT, {R_STRING, R_INT}, &thunk<&GetObjectByTag>);
+    insert(201, "AdjustAlignment", R_VOID, {R_OBJECT, R_INT, R_INT, R_INT}, &thunk<&AdjustAlignment>);
+    insert(203, "SetAreaTransitionBMP", R_VOID, {R_INT, R_STRING}, &thunk<&SetAreaTransitionBMP>);
+    insert(208, "GetReputation", R_INT, {R_OBJECT, R_OBJECT}, &thunk<&GetReputation>);
+    insert(209, "AdjustReputation", R_VOID, {R_OBJECT, R_OBJECT, R_INT}, &thunk<&AdjustReputation>);
+    insert(210, "GetModuleFileName", R_STRING, {}, &thunk<&GetModuleFileName>);
+    insert(211, "GetGoingToBeAttackedBy", R_OBJECT, {R_OBJECT}, &thunk<&GetGoingToBeAttackedBy>);
+    insert(213, "GetLocation", R_LOCATION, {R_OBJECT}, &thunk<&GetLocation>);
+    insert(215, "Location", R_LOCATION, {R_VECTOR, R_FLOAT}, &thunk<&CreateLocation>);
+    insert(216, "ApplyEffectAtLocation", R_VOID, {R_INT, R_EFFECT, R_LOCATION, R_FLOAT}, &thunk<&ApplyEffectAtLocation>);
+    insert(217, "GetIsPC", R_INT, {R_OBJECT}, &thunk<&GetIsPC>);
+    insert(218, "FeetToMeters", R_FLOAT, {R_FLOAT}, &thunk<&FeetToMeters>);
+    insert(219, "YardsToMeters", R_FLOAT, {R_FLOAT}, &thunk<&YardsToMeters>);
+    insert(220, "ApplyEffectToObject", R_VOID, {R_INT, R_EFFECT, R_OBJECT, R_FLOAT}, &thunk<&ApplyEffectToObject>);
+    insert(221, "SpeakString", R_VOID, {R_STRING, R_INT}, &thunk<&SpeakString>);
+    insert(222, "GetSpellTargetLocation", R_LOCATION, {}, &thunk<&GetSpellTargetLocation>);
+    insert(223, "GetPositionFromLocation", R_VECTOR, {R_LOCATION}, &thunk<&GetPositionFromLocation>);
+    insert(225, "GetFacingFromLocation", R_FLOAT, {R_LOCATION}, &thunk<&GetFacingFromLocation>);
+    insert(226, "GetNearestCreatureToLocation", R_OBJECT, {R_INT, R_INT, R_LOCATION, R_INT, R_INT, R_INT, R_INT, R_INT}, &thunk<&GetNearestCreatureToLocation>);
+    insert(227, "GetNearestObject", R_OBJECT, {R_INT, R_OBJECT, R_INT}, &thunk<&GetNearestObject>);
+    insert(228, "GetNearestObjectToLocation", R_OBJECT, {R_INT, R_LOCATION, R_INT}, &thunk<&GetNearestObjectToLocation>);
+    insert(229, "GetNearestObjectByTag", R_OBJECT, {R_STRING, R_OBJECT, R_INT}, &thunk<&GetNearestObjectByTag>);
+    insert(230, "IntToFloat", R_FLOAT, {R_INT}, &thunk<&IntToFloat>);
+    insert(231, "FloatToInt", R_INT, {R_FLOAT}, &thunk<&FloatToInt>);
+    insert(232, "StringToInt", R_INT, {R_STRING}, &thunk<&StringToInt>);
+    insert(233, "StringToFloat", R_FLOAT, {R_STRING}, &thunk<&StringToFloat>);
+    insert(235, "GetIsEnemy", R_INT, {R_OBJECT, R_OBJECT}, &thunk<&GetIsEnemy>);
+    insert(236, "GetIsFriend", R_INT, {R_OBJECT, R_OBJECT}, &thunk<&GetIsFriend>);
+    insert(237, "GetIsNeutral", R_INT, {R_OBJECT, R_OBJECT}, &thunk<&GetIsNeutral>);
+    insert(238, "GetPCSpeaker", R_OBJECT, {}, &thunk<&GetPCSpeaker>);
+    insert(239, "GetStringByStrRef", R_STRING, {R_INT}, &thunk<&GetStringByStrRef>);
+    insert(241, "DestroyObject", R_VOID, {R_OBJECT, R_FLOAT, R_INT, R_FLOAT, R_INT}, &thunk<&DestroyObject>);
+    insert(242, "GetModule", R_OBJECT, {}, &thunk<&GetModule>);
+    insert(243, "CreateObject", R_OBJECT, {R_INT, R_STRING, R_LOCATION, R_INT}, &thunk<&CreateObject>);
+    insert(244, "EventSpellCastAt", R_EVENT, {R_OBJECT, R_INT, R_INT}, &thunk<&EventSpellCastAt>);
+    insert(245, "GetLastSpellCaster", R_OBJECT, {}, &thunk<&GetLastSpellCaster>);
+    insert(246, "GetLastSpell", R_INT, {}, &thunk<&GetLastSpell>);
+    insert(247, "GetUserDefinedEventNumber", R_INT, {}, &thunk<&GetUserDefinedEventNumber>);
+    insert(248, "GetSpellId", R_INT, {}, &thunk<&GetSpellId>);
+    insert(249, "RandomName", R_STRING, {}, &thunk<&RandomName>);
+    insert(251, "GetLoadFromSaveGame", R_INT, {}, &thunk<&GetLoadFromSaveGame>);
+    insert(253, "GetName", R_STRING, {R_OBJECT}, &thunk<&GetName>);
+    insert(254, "GetLastSpeaker", R_OBJECT, {}, &thunk<&GetLastSpeaker>);
+    insert(255, "BeginConversation", R_INT, {R_STRING, R_OBJECT}, &thunk<&BeginConversation>);
+    insert(256, "GetLastPerceived", R_OBJECT, {}, &thunk<&GetLastPerceived>);
+    insert(257, "GetLastPerceptionHeard", R_INT, {}, &thunk<&GetLastPerceptionHeard>);
+    insert(258, "GetLastPerceptionInaudible", R_INT, {}, &thunk<&GetLastPerceptionInaudible>);
+    insert(259, "GetLastPerceptionSeen", R_INT, {}, &thunk<&GetLastPerceptionSeen>);
+    insert(260, "GetLastClosedBy", R_OBJECT, {}, &thunk<&GetLastClosedBy>);
+    insert(261, "GetLastPerceptionVanished", R_INT, {}, &thunk<&GetLastPerceptionVanished>);
+    insert(262, "GetFirstInPersistentObject", R_OBJECT, {R_OBJECT, R_INT, R_INT}, &thunk<&GetFirstInPersistentObject>);
+    insert(263, "GetNextInPersistentObject", R_OBJECT, {R_OBJECT, R_INT, R_INT}, &thunk<&GetNextInPersistentObject>);
+    insert(264, "GetAreaOfEffectCreator", R_OBJECT, {R_OBJECT}, &thunk<&GetAreaOfEffectCreator>);
+    insert(265, "ShowLevelUpGUI", R_INT, {}, &thunk<&ShowLevelUpGUI>);
+    insert(266, "SetItemNonEquippable", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetItemNonEquippable>);
+    insert(267, "GetButtonMashCheck", R_INT, {}, &thunk<&GetButtonMashCheck>);
+    insert(268, "SetButtonMashCheck", R_VOID, {R_INT}, &thunk<&SetButtonMashCheck>);
+    insert(271, "GiveItem", R_VOID, {R_OBJECT, R_OBJECT}, &thunk<&GiveItem>);
+    insert(272, "ObjectToString", R_STRING, {R_OBJECT}, &thunk<&ObjectToString>);
+    insert(274, "GetIsImmune", R_INT, {R_OBJECT, R_INT, R_OBJECT}, &thunk<&GetIsImmune>);
+    insert(276, "GetEncounterActive", R_INT, {R_OBJECT}, &thunk<&GetEncounterActive>);
+    insert(277, "SetEncounterActive", R_VOID, {R_INT, R_OBJECT}, &thunk<&SetEncounterActive>);
+    insert(278, "GetEncounterSpawnsMax", R_INT, {R_OBJECT}, &thunk<&GetEncounterSpawnsMax>);
+    insert(279, "SetEncounterSpawnsMax", R_VOID, {R_INT, R_OBJECT}, &thunk<&SetEncounterSpawnsMax>);
+    insert(280, "GetEncounterSpawnsCurrent", R_INT, {R_OBJECT}, &thunk<&GetEncounterSpawnsCurrent>);
+    insert(281, "SetEncounterSpawnsCurrent", R_VOID, {R_INT, R_OBJECT}, &thunk<&SetEncounterSpawnsCurrent>);
+    insert(282, "GetModuleItemAcquired", R_OBJECT, {}, &thunk<&GetModuleItemAcquired>);
+    insert(283, "GetModuleItemAcquiredFrom", R_OBJECT, {}, &thunk<&GetModuleItemAcquiredFrom>);
+    insert(284, "SetCustomToken", R_VOID, {R_INT, R_STRING}, &thunk<&SetCustomToken>);
+    insert(285, "GetHasFeat", R_INT, {R_INT, R_OBJECT}, &thunk<&GetHasFeat>);
+    insert(286, "GetHasSkill", R_INT, {R_INT, R_OBJECT}, &thunk<&GetHasSkill>);
+    insert(289, "GetObjectSeen", R_INT, {R_OBJECT, R_OBJECT}, &thunk<&GetObjectSeen>);
+    insert(290, "GetObjectHeard", R_INT, {R_OBJECT, R_OBJECT}, &thunk<&GetObjectHeard>);
+    insert(291, "GetLastPlayerDied", R_OBJECT, {}, &thunk<&GetLastPlayerDied>);
+    insert(292, "GetModuleItemLost", R_OBJECT, {}, &thunk<&GetModuleItemLost>);
+    insert(293, "GetModuleItemLostBy", R_OBJECT, {}, &thunk<&GetModuleItemLostBy>);
+    insert(295, "EventConversation", R_EVENT, {}, &thunk<&EventConversation>);
+    insert(296, "SetEncounterDifficulty", R_VOID, {R_INT, R_OBJECT}, &thunk<&SetEncounterDifficulty>);
+    insert(297, "GetEncounterDifficulty", R_INT, {R_OBJECT}, &thunk<&GetEncounterDifficulty>);
+    insert(298, "GetDistanceBetweenLocations", R_FLOAT, {R_LOCATION, R_LOCATION}, &thunk<&GetDistanceBetweenLocations>);
+    insert(299, "GetReflexAdjustedDamage", R_INT, {R_INT, R_OBJECT, R_INT, R_INT, R_OBJECT}, &thunk<&GetReflexAdjustedDamage>);
+    insert(300, "PlayAnimation", R_VOID, {R_INT, R_FLOAT, R_FLOAT}, &thunk<&PlayAnimation>);
+    insert(301, "TalentSpell", R_TALENT, {R_INT}, &thunk<&TalentSpell>);
+    insert(302, "TalentFeat", R_TALENT, {R_INT}, &thunk<&TalentFeat>);
+    insert(303, "TalentSkill", R_TALENT, {R_INT}, &thunk<&TalentSkill>);
+    insert(304, "GetHasSpellEffect", R_INT, {R_INT, R_OBJECT}, &thunk<&GetHasSpellEffect>);
+    insert(305, "GetEffectSpellId", R_INT, {R_EFFECT}, &thunk<&GetEffectSpellId>);
+    insert(306, "GetCreatureHasTalent", R_INT, {R_TALENT, R_OBJECT}, &thunk<&GetCreatureHasTalent>);
+    insert(307, "GetCreatureTalentRandom", R_TALENT, {R_INT, R_OBJECT, R_INT}, &thunk<&GetCreatureTalentRandom>);
+    insert(308, "GetCreatureTalentBest", R_TALENT, {R_INT, R_INT, R_OBJECT, R_INT, R_INT, R_INT}, &thunk<&GetCreatureTalentBest>);
+    insert(311, "GetGoldPieceValue", R_INT, {R_OBJECT}, &thunk<&GetGoldPieceValue>);
+    insert(312, "GetIsPlayableRacialType", R_INT, {R_OBJECT}, &thunk<&GetIsPlayableRacialType>);
+    insert(313, "JumpToLocation", R_VOID, {R_LOCATION}, &thunk<&JumpToLocation>);
+    insert(315, "GetSkillRank", R_INT, {R_INT, R_OBJECT}, &thunk<&GetSkillRank>);
+    insert(316, "GetAttackTarget", R_OBJECT, {R_OBJECT}, &thunk<&GetAttackTarget>);
+    insert(317, "GetLastAttackType", R_INT, {R_OBJECT}, &thunk<&GetLastAttackType>);
+    insert(318, "GetLastAttackMode", R_INT, {R_OBJECT}, &thunk<&GetLastAttackMode>);
+    insert(319, "GetDistanceBetween2D", R_FLOAT, {R_OBJECT, R_OBJECT}, &thunk<&GetDistanceBetween2D>);
+    insert(320, "GetIsInCombat", R_INT, {R_OBJECT, R_INT}, &thunk<&GetIsInCombat>);
+    insert(321, "GetLastAssociateCommand", R_INT, {R_OBJECT}, &thunk<&GetLastAssociateCommand>);
+    insert(322, "GiveGoldToCreature", R_VOID, {R_OBJECT, R_INT}, &thunk<&GiveGoldToCreature>);
+    insert(323, "SetIsDestroyable", R_VOID, {R_INT, R_INT, R_INT}, &thunk<&SetIsDestroyable>);
+    insert(324, "SetLocked", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetLocked>);
+    insert(325, "GetLocked", R_INT, {R_OBJECT}, &thunk<&GetLocked>);
+    insert(326, "GetClickingObject", R_OBJECT, {}, &thunk<&GetClickingObject>);
+    insert(327, "SetAssociateListenPatterns", R_VOID, {R_OBJECT}, &thunk<&SetAssociateListenPatterns>);
+    insert(328, "GetLastWeaponUsed", R_OBJECT, {R_OBJECT}, &thunk<&GetLastWeaponUsed>);
+    insert(330, "GetLastUsedBy", R_OBJECT, {}, &thunk<&GetLastUsedBy>);
+    insert(331, "GetAbilityModifier", R_INT, {R_INT, R_OBJECT}, &thunk<&GetAbilityModifier>);
+    insert(332, "GetIdentified", R_INT, {R_OBJECT}, &thunk<&GetIdentified>);
+    insert(333, "SetIdentified", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetIdentified>);
+    insert(334, "GetDistanceBetweenLocations2D", R_FLOAT, {R_LOCATION, R_LOCATION}, &thunk<&GetDistanceBetweenLocations2D>);
+    insert(335, "GetDistanceToObject2D", R_FLOAT, {R_OBJECT}, &thunk<&GetDistanceToObject2D>);
+    insert(336, "GetBlockingDoor", R_OBJECT, {}, &thunk<&GetBlockingDoor>);
+    insert(337, "GetIsDoorActionPossible", R_INT, {R_OBJECT, R_INT}, &thunk<&GetIsDoorActionPossible>);
+    insert(338, "DoDoorAction", R_VOID, {R_OBJECT, R_INT}, &thunk<&DoDoorAction>);
+    insert(339, "GetFirstItemInInventory", R_OBJECT, {R_OBJECT}, &thunk<&GetFirstItemInInventory>);
+    insert(340, "GetNextItemInInventory", R_OBJECT, {R_OBJECT}, &thunk<&GetNextItemInInventory>);
+    insert(341, "GetClassByPosition", R_INT, {R_INT, R_OBJECT}, &thunk<&GetClassByPosition>);
+    insert(342, "GetLevelByPosition", R_INT, {R_INT, R_OBJECT}, &thunk<&GetLevelByPosition>);
+    insert(343, "GetLevelByClass", R_INT, {R_INT, R_OBJECT}, &thunk<&GetLevelByClass>);
+    insert(344, "GetDamageDealtByType", R_INT, {R_INT}, &thunk<&GetDamageDealtByType>);
+    insert(345, "GetTotalDamageDealt", R_INT, {}, &thunk<&GetTotalDamageDealt>);
+    insert(346, "GetLastDamager", R_OBJECT, {}, &thunk<&GetLastDamager>);
+    insert(347, "GetLastDisarmed", R_OBJECT, {}, &thunk<&GetLastDisarmed>);
+    insert(348, "GetLastDisturbed", R_OBJECT, {}, &thunk<&GetLastDisturbed>);
+    insert(349, "GetLastLocked", R_OBJECT, {}, &thunk<&GetLastLocked>);
+    insert(350, "GetLastUnlocked", R_OBJECT, {}, &thunk<&GetLastUnlocked>);
+    insert(352, "GetInventoryDisturbType", R_INT, {}, &thunk<&GetInventoryDisturbType>);
+    insert(353, "GetInventoryDisturbItem", R_OBJECT, {}, &thunk<&GetInventoryDisturbItem>);
+    insert(354, "ShowUpgradeScreen", R_VOID, {R_OBJECT, R_OBJECT, R_INT, R_INT, R_STRING}, &thunk<&ShowUpgradeScreen>);
+    insert(355, "VersusAlignmentEffect", R_EFFECT, {R_EFFECT, R_INT, R_INT}, &thunk<&VersusAlignmentEffect>);
+    insert(356, "VersusRacialTypeEffect", R_EFFECT, {R_EFFECT, R_INT}, &thunk<&VersusRacialTypeEffect>);
+    insert(357, "VersusTrapEffect", R_EFFECT, {R_EFFECT}, &thunk<&VersusTrapEffect>);
+    insert(358, "GetGender", R_INT, {R_OBJECT}, &thunk<&GetGender>);
+    insert(359, "GetIsTalentValid", R_INT, {R_TALENT}, &thunk<&GetIsTalentValid>);
+    insert(361, "GetAttemptedAttackTarget", R_OBJECT, {}, &thunk<&GetAttemptedAttackTarget>);
+    insert(362, "GetTypeFromTalent", R_INT, {R_TALENT}, &thunk<&GetTypeFromTalent>);
+    insert(363, "GetIdFromTalent", R_INT, {R_TALENT}, &thunk<&GetIdFromTalent>);
+    insert(364, "PlayPazaak", R_VOID, {R_INT, R_STRING, R_INT, R_INT, R_OBJECT}, &thunk<&PlayPazaak>);
+    insert(365, "GetLastPazaakResult", R_INT, {}, &thunk<&GetLastPazaakResult>);
+    insert(366, "DisplayFeedBackText", R_VOID, {R_OBJECT, R_INT}, &thunk<&DisplayFeedBackText>);
+    insert(367, "AddJournalQuestEntry", R_VOID, {R_STRING, R_INT, R_INT}, &thunk<&AddJournalQuestEntry>);
+    insert(368, "RemoveJournalQuestEntry", R_VOID, {R_STRING}, &thunk<&RemoveJournalQuestEntry>);
+    insert(369, "GetJournalEntry", R_INT, {R_STRING}, &thunk<&GetJournalEntry>);
+    insert(370, "PlayRumblePattern", R_INT, {R_INT}, &thunk<&PlayRumblePattern>);
+    insert(371, "StopRumblePattern", R_INT, {R_INT}, &thunk<&StopRumblePattern>);
+    insert(374, "SendMessageToPC", R_VOID, {R_OBJECT, R_STRING}, &thunk<&SendMessageToPC>);
+    insert(375, "GetAttemptedSpellTarget", R_OBJECT, {}, &thunk<&GetAttemptedSpellTarget>);
+    insert(376, "GetLastOpenedBy", R_OBJECT, {}, &thunk<&GetLastOpenedBy>);
+    insert(377, "GetHasSpell", R_INT, {R_INT, R_OBJECT}, &thunk<&GetHasSpell>);
+    insert(378, "OpenStore", R_VOID, {R_OBJECT, R_OBJECT, R_INT, R_INT}, &thunk<&OpenStore>);
+    insert(380, "GetFirstFactionMember", R_OBJECT, {R_OBJECT, R_INT}, &thunk<&GetFirstFactionMember>);
+    insert(381, "GetNextFactionMember", R_OBJECT, {R_OBJECT, R_INT}, &thunk<&GetNextFactionMember>);
+    insert(384, "GetJournalQuestExperience", R_INT, {R_STRING}, &thunk<&GetJournalQuestExperience>);
+    insert(385, "JumpToObject", R_VOID, {R_OBJECT, R_INT}, &thunk<&JumpToObject>);
+    insert(386, "SetMapPinEnabled", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetMapPinEnabled>);
+    insert(388, "PopUpGUIPanel", R_VOID, {R_OBJECT, R_INT}, &thunk<&PopUpGUIPanel>);
+    insert(389, "AddMultiClass", R_VOID, {R_INT, R_OBJECT}, &thunk<&AddMultiClass>);
+    insert(390, "GetIsLinkImmune", R_INT, {R_OBJECT, R_EFFECT}, &thunk<&GetIsLinkImmune>);
+    insert(393, "GiveXPToCreature", R_VOID, {R_OBJECT, R_INT}, &thunk<&GiveXPToCreature>);
+    insert(394, "SetXP", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetXP>);
+    insert(395, "GetXP", R_INT, {R_OBJECT}, &thunk<&GetXP>);
+    insert(396, "IntToHexString", R_STRING, {R_INT}, &thunk<&IntToHexString>);
+    insert(397, "GetBaseItemType", R_INT, {R_OBJECT}, &thunk<&GetBaseItemType>);
+    insert(398, "GetItemHasItemProperty", R_INT, {R_OBJECT, R_INT}, &thunk<&GetItemHasItemProperty>);
+    insert(401, "GetItemACValue", R_INT, {R_OBJECT}, &thunk<&GetItemACValue>);
+    insert(403, "ExploreAreaForPlayer", R_VOID, {R_OBJECT, R_OBJECT}, &thunk<&ExploreAreaForPlayer>);
+    insert(405, "GetIsDay", R_INT, {}, &thunk<&GetIsDay>);
+    insert(406, "GetIsNight", R_INT, {}, &thunk<&GetIsNight>);
+    insert(407, "GetIsDawn", R_INT, {}, &thunk<&GetIsDawn>);
+    insert(408, "GetIsDusk", R_INT, {}, &thunk<&GetIsDusk>);
+    insert(409, "GetIsEncounterCreature", R_INT, {R_OBJECT}, &thunk<&GetIsEncounterCreature>);
+    insert(410, "GetLastPlayerDying", R_OBJECT, {}, &thunk<&GetLastPlayerDying>);
+    insert(411, "GetStartingLocation", R_LOCATION, {}, &thunk<&GetStartingLocation>);
+    insert(412, "ChangeToStandardFaction", R_VOID, {R_OBJECT, R_INT}, &thunk<&ChangeToStandardFaction>);
+    insert(413, "SoundObjectPlay", R_VOID, {R_OBJECT}, &thunk<&SoundObjectPlay>);
+    insert(414, "SoundObjectStop", R_VOID, {R_OBJECT}, &thunk<&SoundObjectStop>);
+    insert(415, "SoundObjectSetVolume", R_VOID, {R_OBJECT, R_INT}, &thunk<&SoundObjectSetVolume>);
+    insert(416, "SoundObjectSetPosition", R_VOID, {R_OBJECT, R_VECTOR}, &thunk<&SoundObjectSetPosition>);
+    insert(417, "SpeakOneLinerConversation", R_VOID, {R_STRING, R_OBJECT}, &thunk<&SpeakOneLinerConversation>);
+    insert(418, "GetGold", R_INT, {R_OBJECT}, &thunk<&GetGold>);
+    insert(419, "GetLastRespawnButtonPresser", R_OBJECT, {}, &thunk<&GetLastRespawnButtonPresser>);
+    insert(421, "SetLightsaberPowered", R_VOID, {R_OBJECT, R_INT, R_INT, R_INT}, &thunk<&SetLightsaberPowered>);
+    insert(422, "GetIsWeaponEffective", R_INT, {R_OBJECT, R_INT}, &thunk<&GetIsWeaponEffective>);
+    insert(423, "GetLastSpellHarmful", R_INT, {}, &thunk<&GetLastSpellHarmful>);
+    insert(424, "EventActivateItem", R_EVENT, {R_OBJECT, R_LOCATION, R_OBJECT}, &thunk<&EventActivateItem>);
+    insert(425, "MusicBackgroundPlay", R_VOID, {R_OBJECT}, &thunk<&MusicBackgroundPlay>);
+    insert(426, "MusicBackgroundStop", R_VOID, {R_OBJECT}, &thunk<&MusicBackgroundStop>);
+    insert(427, "MusicBackgroundSetDelay", R_VOID, {R_OBJECT, R_INT}, &thunk<&MusicBackgroundSetDelay>);
+    insert(428, "MusicBackgroundChangeDay", R_VOID, {R_OBJECT, R_INT, R_INT}, &thunk<&MusicBackgroundChangeDay>);
+    insert(429, "MusicBackgroundChangeNight", R_VOID, {R_OBJECT, R_INT, R_INT}, &thunk<&MusicBackgroundChangeNight>);
+    insert(430, "MusicBattlePlay", R_VOID, {R_OBJECT}, &thunk<&MusicBattlePlay>);
+    insert(431, "MusicBattleStop", R_VOID, {R_OBJECT}, &thunk<&MusicBattleStop>);
+    insert(432, "MusicBattleChange", R_VOID, {R_OBJECT, R_INT}, &thunk<&MusicBattleChange>);
+    insert(433, "AmbientSoundPlay", R_VOID, {R_OBJECT}, &thunk<&AmbientSoundPlay>);
+    insert(434, "AmbientSoundStop", R_VOID, {R_OBJECT}, &thunk<&AmbientSoundStop>);
+    insert(435, "AmbientSoundChangeDay", R_VOID, {R_OBJECT, R_INT}, &thunk<&AmbientSoundChangeDay>);
+    insert(436, "AmbientSoundChangeNight", R_VOID, {R_OBJECT, R_INT}, &thunk<&AmbientSoundChangeNight>);
+    insert(437, "GetLastKiller", R_OBJECT, {}, &thunk<&GetLastKiller>);
+    insert(438, "GetSpellCastItem", R_OBJECT, {}, &thunk<&GetSpellCastItem>);
+    insert(439, "GetItemActivated", R_OBJECT, {}, &thunk<&GetItemActivated>);
+    insert(440, "GetItemActivator", R_OBJECT, {}, &thunk<&GetItemActivator>);
+    insert(441, "GetItemActivatedTargetLocation", R_LOCATION, {}, &thunk<&GetItemActivatedTargetLocation>);
+    insert(442, "GetItemActivatedTarget", R_OBJECT, {}, &thunk<&GetItemActivatedTarget>);
+    insert(443, "GetIsOpen", R_INT, {R_OBJECT}, &thunk<&GetIsOpen>);
+    insert(444, "TakeGoldFromCreature", R_VOID, {R_INT, R_OBJECT, R_INT}, &thunk<&TakeGoldFromCreature>);
+    insert(445, "GetIsInConversation", R_INT, {R_OBJECT}, &thunk<&GetIsInConversation>);
+    insert(455, "GetPlotFlag", R_INT, {R_OBJECT}, &thunk<&GetPlotFlag>);
+    insert(456, "SetPlotFlag", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetPlotFlag>);
+    insert(461, "SetDialogPlaceableCamera", R_VOID, {R_INT}, &thunk<&SetDialogPlaceableCamera>);
+    insert(462, "GetSoloMode", R_INT, {}, &thunk<&GetSoloMode>);
+    insert(464, "GetMaxStealthXP", R_INT, {}, &thunk<&GetMaxStealthXP>);
+    insert(468, "SetMaxStealthXP", R_VOID, {R_INT}, &thunk<&SetMaxStealthXP>);
+    insert(474, "GetCurrentStealthXP", R_INT, {}, &thunk<&GetCurrentStealthXP>);
+    insert(475, "GetNumStackedItems", R_INT, {R_OBJECT}, &thunk<&GetNumStackedItems>);
+    insert(476, "SurrenderToEnemies", R_VOID, {}, &thunk<&SurrenderToEnemies>);
+    insert(478, "SetCurrentStealthXP", R_VOID, {R_INT}, &thunk<&SetCurrentStealthXP>);
+    insert(479, "GetCreatureSize", R_INT, {R_OBJECT}, &thunk<&GetCreatureSize>);
+    insert(480, "AwardStealthXP", R_VOID, {R_OBJECT}, &thunk<&AwardStealthXP>);
+    insert(481, "GetStealthXPEnabled", R_INT, {}, &thunk<&GetStealthXPEnabled>);
+    insert(482, "SetStealthXPEnabled", R_VOID, {R_INT}, &thunk<&SetStealthXPEnabled>);
+    insert(486, "GetLastTrapDetected", R_OBJECT, {R_OBJECT}, &thunk<&GetLastTrapDetected>);
+    insert(488, "GetNearestTrapToObject", R_OBJECT, {R_OBJECT, R_INT}, &thunk<&GetNearestTrapToObject>);
+    insert(489, "GetAttemptedMovementTarget", R_OBJECT, {}, &thunk<&GetAttemptedMovementTarget>);
+    insert(490, "GetBlockingCreature", R_OBJECT, {R_OBJECT}, &thunk<&GetBlockingCreature>);
+    insert(491, "GetFortitudeSavingThrow", R_INT, {R_OBJECT}, &thunk<&GetFortitudeSavingThrow>);
+    insert(492, "GetWillSavingThrow", R_INT, {R_OBJECT}, &thunk<&GetWillSavingThrow>);
+    insert(493, "GetReflexSavingThrow", R_INT, {R_OBJECT}, &thunk<&GetReflexSavingThrow>);
+    insert(494, "GetChallengeRating", R_FLOAT, {R_OBJECT}, &thunk<&GetChallengeRating>);
+    insert(495, "GetFoundEnemyCreature", R_OBJECT, {R_OBJECT}, &thunk<&GetFoundEnemyCreature>);
+    insert(496, "GetMovementRate", R_INT, {R_OBJECT}, &thunk<&GetMovementRate>);
+    insert(497, "GetSubRace", R_INT, {R_OBJECT}, &thunk<&GetSubRace>);
+    insert(498, "GetStealthXPDecrement", R_INT, {}, &thunk<&GetStealthXPDecrement>);
+    insert(499, "SetStealthXPDecrement", R_VOID, {R_INT}, &thunk<&SetStealthXPDecrement>);
+    insert(500, "DuplicateHeadAppearance", R_VOID, {R_OBJECT, R_OBJECT}, &thunk<&DuplicateHeadAppearance>);
+    insert(503, "CutsceneAttack", R_VOID, {R_OBJECT, R_INT, R_INT, R_INT}, &thunk<&CutsceneAttack>);
+    insert(504, "SetCameraMode", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetCameraMode>);
+    insert(505, "SetLockOrientationInDialog", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetLockOrientationInDialog>);
+    insert(506, "SetLockHeadFollowInDialog", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetLockHeadFollowInDialog>);
+    insert(507, "CutsceneMove", R_VOID, {R_OBJECT, R_VECTOR, R_INT}, &thunk<&CutsceneMove>);
+    insert(508, "EnableVideoEffect", R_VOID, {R_INT}, &thunk<&EnableVideoEffect>);
+    insert(509, "StartNewModule", R_VOID, {R_STRING, R_STRING, R_STRING, R_STRING, R_STRING, R_STRING, R_STRING, R_STRING}, &thunk<&StartNewModule>);
+    insert(510, "DisableVideoEffect", R_VOID, {}, &thunk<&DisableVideoEffect>);
+    insert(511, "GetWeaponRanged", R_INT, {R_OBJECT}, &thunk<&GetWeaponRanged>);
+    insert(512, "DoSinglePlayerAutoSave", R_VOID, {}, &thunk<&DoSinglePlayerAutoSave>);
+    insert(513, "GetGameDifficulty", R_INT, {}, &thunk<&GetGameDifficulty>);
+    insert(514, "GetUserActionsPending", R_INT, {}, &thunk<&GetUserActionsPending>);
+    insert(515, "RevealMap", R_VOID, {R_VECTOR, R_INT}, &thunk<&RevealMap>);
+    insert(516, "SetTutorialWindowsEnabled", R_VOID, {R_INT}, &thunk<&SetTutorialWindowsEnabled>);
+    insert(517, "ShowTutorialWindow", R_VOID, {R_INT}, &thunk<&ShowTutorialWindow>);
+    insert(518, "StartCreditSequence", R_VOID, {R_INT}, &thunk<&StartCreditSequence>);
+    insert(519, "IsCreditSequenceInProgress", R_INT, {}, &thunk<&IsCreditSequenceInProgress>);
+    insert(522, "GetCurrentAction", R_INT, {R_OBJECT}, &thunk<&GetCurrentAction>);
+    insert(523, "GetDifficultyModifier", R_FLOAT, {}, &thunk<&GetDifficultyModifier>);
+    insert(524, "GetAppearanceType", R_INT, {R_OBJECT}, &thunk<&GetAppearanceType>);
+    insert(525, "FloatingTextStrRefOnCreature", R_VOID, {R_INT, R_OBJECT, R_INT}, &thunk<&FloatingTextStrRefOnCreature>);
+    insert(526, "FloatingTextStringOnCreature", R_VOID, {R_STRING, R_OBJECT, R_INT}, &thunk<&FloatingTextStringOnCreature>);
+    insert(527, "GetTrapDisarmable", R_INT, {R_OBJECT}, &thunk<&GetTrapDisarmable>);
+    insert(528, "GetTrapDetectable", R_INT, {R_OBJECT}, &thunk<&GetTrapDetectable>);
+    insert(529, "GetTrapDetectedBy", R_INT, {R_OBJECT, R_OBJECT}, &thunk<&GetTrapDetectedBy>);
+    insert(530, "GetTrapFlagged", R_INT, {R_OBJECT}, &thunk<&GetTrapFlagged>);
+    insert(531, "GetTrapBaseType", R_INT, {R_OBJECT}, &thunk<&GetTrapBaseType>);
+    insert(532, "GetTrapOneShot", R_INT, {R_OBJECT}, &thunk<&GetTrapOneShot>);
+    insert(533, "GetTrapCreator", R_OBJECT, {R_OBJECT}, &thunk<&GetTrapCreator>);
+    insert(534, "GetTrapKeyTag", R_STRING, {R_OBJECT}, &thunk<&GetTrapKeyTag>);
+    insert(535, "GetTrapDisarmDC", R_INT, {R_OBJECT}, &thunk<&GetTrapDisarmDC>);
+    insert(536, "GetTrapDetectDC", R_INT, {R_OBJECT}, &thunk<&GetTrapDetectDC>);
+    insert(537, "GetLockKeyRequired", R_INT, {R_OBJECT}, &thunk<&GetLockKeyRequired>);
+    insert(538, "GetLockKeyTag", R_INT, {R_OBJECT}, &thunk<&GetLockKeyTag>);
+    insert(539, "GetLockLockable", R_INT, {R_OBJECT}, &thunk<&GetLockLockable>);
+    insert(540, "GetLockUnlockDC", R_INT, {R_OBJECT}, &thunk<&GetLockUnlockDC>);
+    insert(541, "GetLockLockDC", R_INT, {R_OBJECT}, &thunk<&GetLockLockDC>);
+    insert(542, "GetPCLevellingUp", R_OBJECT, {}, &thunk<&GetPCLevellingUp>);
+    insert(543, "GetHasFeatEffect", R_INT, {R_INT, R_OBJECT}, &thunk<&GetHasFeatEffect>);
+    insert(544, "SetPlaceableIllumination", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetPlaceableIllumination>);
+    insert(545, "GetPlaceableIllumination", R_INT, {R_OBJECT}, &thunk<&GetPlaceableIllumination>);
+    insert(546, "GetIsPlaceableObjectActionPossible", R_INT, {R_OBJECT, R_INT}, &thunk<&GetIsPlaceableObjectActionPossible>);
+    insert(547, "DoPlaceableObjectAction", R_VOID, {R_OBJECT, R_INT}, &thunk<&DoPlaceableObjectAction>);
+    insert(548, "GetFirstPC", R_OBJECT, {}, &thunk<&GetFirstPC>);
+    insert(549, "GetNextPC", R_OBJECT, {}, &thunk<&GetNextPC>);
+    insert(550, "SetTrapDetectedBy", R_INT, {R_OBJECT, R_OBJECT}, &thunk<&SetTrapDetectedBy>);
+    insert(551, "GetIsTrapped", R_INT, {R_OBJECT}, &thunk<&GetIsTrapped>);
+    insert(552, "SetEffectIcon", R_EFFECT, {R_EFFECT, R_INT}, &thunk<&SetEffectIcon>);
+    insert(553, "FaceObjectAwayFromObject", R_VOID, {R_OBJECT, R_OBJECT}, &thunk<&FaceObjectAwayFromObject>);
+    insert(554, "PopUpDeathGUIPanel", R_VOID, {R_OBJECT, R_INT, R_INT, R_INT, R_STRING}, &thunk<&PopUpDeathGUIPanel>);
+    insert(555, "SetTrapDisabled", R_VOID, {R_OBJECT}, &thunk<&SetTrapDisabled>);
+    insert(556, "GetLastHostileActor", R_OBJECT, {R_OBJECT}, &thunk<&GetLastHostileActor>);
+    insert(557, "ExportAllCharacters", R_VOID, {}, &thunk<&ExportAllCharacters>);
+    insert(558, "MusicBackgroundGetDayTrack", R_INT, {R_OBJECT}, &thunk<&MusicBackgroundGetDayTrack>);
+    insert(559, "MusicBackgroundGetNightTrack", R_INT, {R_OBJECT}, &thunk<&MusicBackgroundGetNightTrack>);
+    insert(560, "WriteTimestampedLogEntry", R_VOID, {R_STRING}, &thunk<&WriteTimestampedLogEntry>);
+    insert(561, "GetModuleName", R_STRING, {}, &thunk<&GetModuleName>);
+    insert(562, "GetFactionLeader", R_OBJECT, {R_OBJECT}, &thunk<&GetFactionLeader>);
+    insert(564, "EndGame", R_VOID, {R_INT}, &thunk<&EndGame>);
+    insert(565, "GetRunScriptVar", R_INT, {}, &thunk<&GetRunScriptVar>);
+    insert(566, "GetCreatureMovmentType", R_INT, {R_OBJECT}, &thunk<&GetCreatureMovmentType>);
+    insert(567, "AmbientSoundSetDayVolume", R_VOID, {R_OBJECT, R_INT}, &thunk<&AmbientSoundSetDayVolume>);
+    insert(568, "AmbientSoundSetNightVolume", R_VOID, {R_OBJECT, R_INT}, &thunk<&AmbientSoundSetNightVolume>);
+    insert(569, "MusicBackgroundGetBattleTrack", R_INT, {R_OBJECT}, &thunk<&MusicBackgroundGetBattleTrack>);
+    insert(570, "GetHasInventory", R_INT, {R_OBJECT}, &thunk<&GetHasInventory>);
+    insert(571, "GetStrRefSoundDuration", R_FLOAT, {R_INT}, &thunk<&GetStrRefSoundDuration>);
+    insert(572, "AddToParty", R_VOID, {R_OBJECT, R_OBJECT}, &thunk<&AddToParty>);
+    insert(573, "RemoveFromParty", R_VOID, {R_OBJECT}, &thunk<&RemoveFromParty>);
+    insert(574, "AddPartyMember", R_INT, {R_INT, R_OBJECT}, &thunk<&AddPartyMember>);
+    insert(575, "RemovePartyMember", R_INT, {R_INT}, &thunk<&RemovePartyMember>);
+    insert(576, "IsObjectPartyMember", R_INT, {R_OBJECT}, &thunk<&IsObjectPartyMember>);
+    insert(577, "GetPartyMemberByIndex", R_OBJECT, {R_INT}, &thunk<&GetPartyMemberByIndex>);
+    insert(578, "GetGlobalBoolean", R_INT, {R_STRING}, &thunk<&GetGlobalBoolean>);
+    insert(579, "SetGlobalBoolean", R_VOID, {R_STRING, R_INT}, &thunk<&SetGlobalBoolean>);
+    insert(580, "GetGlobalNumber", R_INT, {R_STRING}, &thunk<&GetGlobalNumber>);
+    insert(581, "SetGlobalNumber", R_VOID, {R_STRING, R_INT}, &thunk<&SetGlobalNumber>);
+    insert(582, "AurPostString", R_VOID, {R_STRING, R_INT, R_INT, R_FLOAT}, &thunk<&AurPostString>);
+    insert(669, "AddJournalWorldEntry", R_VOID, {R_INT, R_STRING, R_STRING}, &thunk<&AddJournalWorldEntry>);
+    insert(670, "AddJournalWorldEntryStrref", R_VOID, {R_INT, R_INT}, &thunk<&AddJournalWorldEntryStrref>);
+    insert(671, "BarkString", R_VOID, {R_OBJECT, R_INT, R_INT, R_INT}, &thunk<&BarkString>);
+    insert(672, "DeleteJournalWorldAllEntries", R_VOID, {}, &thunk<&DeleteJournalWorldAllEntries>);
+    insert(673, "DeleteJournalWorldEntry", R_VOID, {R_INT}, &thunk<&DeleteJournalWorldEntry>);
+    insert(674, "DeleteJournalWorldEntryStrref", R_VOID, {R_INT}, &thunk<&DeleteJournalWorldEntryStrref>);
+    insert(677, "PlayVisualAreaEffect", R_VOID, {R_INT, R_LOCATION}, &thunk<&PlayVisualAreaEffect>);
+    insert(678, "SetJournalQuestEntryPicture", R_VOID, {R_STRING, R_OBJECT, R_INT, R_INT, R_INT}, &thunk<&SetJournalQuestEntryPicture>);
+    insert(679, "GetLocalBoolean", R_INT, {R_OBJECT, R_INT}, &thunk<&GetLocalBoolean>);
+    insert(680, "SetLocalBoolean", R_VOID, {R_OBJECT, R_INT, R_INT}, &thunk<&SetLocalBoolean>);
+    insert(681, "GetLocalNumber", R_INT, {R_OBJECT, R_INT}, &thunk<&GetLocalNumber>);
+    insert(682, "SetLocalNumber", R_VOID, {R_OBJECT, R_INT, R_INT}, &thunk<&SetLocalNumber>);
+    insert(689, "SoundObjectGetPitchVariance", R_FLOAT, {R_OBJECT}, &thunk<&SoundObjectGetPitchVariance>);
+    insert(690, "SoundObjectSetPitchVariance", R_VOID, {R_OBJECT, R_FLOAT}, &thunk<&SoundObjectSetPitchVariance>);
+    insert(691, "SoundObjectGetVolume", R_INT, {R_OBJECT}, &thunk<&SoundObjectGetVolume>);
+    insert(692, "GetGlobalLocation", R_LOCATION, {R_STRING}, &thunk<&GetGlobalLocation>);
+    insert(693, "SetGlobalLocation", R_VOID, {R_STRING, R_LOCATION}, &thunk<&SetGlobalLocation>);
+    insert(694, "AddAvailableNPCByObject", R_INT, {R_INT, R_OBJECT}, &thunk<&AddAvailableNPCByObject>);
+    insert(695, "RemoveAvailableNPC", R_INT, {R_INT}, &thunk<&RemoveAvailableNPC>);
+    insert(696, "IsAvailableCreature", R_INT, {R_INT}, &thunk<&IsAvailableCreature>);
+    insert(697, "AddAvailableNPCByTemplate", R_INT, {R_INT, R_STRING}, &thunk<&AddAvailableNPCByTemplate>);
+    insert(698, "SpawnAvailableNPC", R_OBJECT, {R_INT, R_LOCATION}, &thunk<&SpawnAvailableNPC>);
+    insert(699, "IsNPCPartyMember", R_INT, {R_INT}, &thunk<&IsNPCPartyMember>);
+    insert(701, "GetIsConversationActive", R_INT, {}, &thunk<&GetIsConversationActive>);
+    insert(704, "GetPartyAIStyle", R_INT, {}, &thunk<&GetPartyAIStyle>);
+    insert(705, "GetNPCAIStyle", R_INT, {R_OBJECT}, &thunk<&GetNPCAIStyle>);
+    insert(706, "SetPartyAIStyle", R_VOID, {R_INT}, &thunk<&SetPartyAIStyle>);
+    insert(707, "SetNPCAIStyle", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetNPCAIStyle>);
+    insert(708, "SetNPCSelectability", R_VOID, {R_INT, R_INT}, &thunk<&SetNPCSelectability>);
+    insert(709, "GetNPCSelectability", R_INT, {R_INT}, &thunk<&GetNPCSelectability>);
+    insert(710, "ClearAllEffects", R_VOID, {}, &thunk<&ClearAllEffects>);
+    insert(711, "GetLastConversation", R_STRING, {}, &thunk<&GetLastConversation>);
+    insert(712, "ShowPartySelectionGUI", R_VOID, {R_STRING, R_INT, R_INT, R_INT}, &thunk<&ShowPartySelectionGUI>);
+    insert(713, "GetStandardFaction", R_INT, {R_OBJECT}, &thunk<&GetStandardFaction>);
+    insert(714, "GivePlotXP", R_VOID, {R_STRING, R_INT}, &thunk<&GivePlotXP>);
+    insert(715, "GetMinOneHP", R_INT, {R_OBJECT}, &thunk<&GetMinOneHP>);
+    insert(716, "SetMinOneHP", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetMinOneHP>);
+    insert(719, "SetGlobalFadeIn", R_VOID, {R_FLOAT, R_FLOAT, R_FLOAT, R_FLOAT, R_FLOAT}, &thunk<&SetGlobalFadeIn>);
+    insert(720, "SetGlobalFadeOut", R_VOID, {R_FLOAT, R_FLOAT, R_FLOAT, R_FLOAT, R_FLOAT}, &thunk<&SetGlobalFadeOut>);
+    insert(721, "GetLastHostileTarget", R_OBJECT, {R_OBJECT}, &thunk<&GetLastHostileTarget>);
+    insert(722, "GetLastAttackObjectAction", R_INT, {R_OBJECT}, &thunk<&GetLastAttackObjectAction>);
+    insert(723, "GetLastForcePowerUsed", R_INT, {R_OBJECT}, &thunk<&GetLastForcePowerUsed>);
+    insert(724, "GetLastCombatFeatUsed", R_INT, {R_OBJECT}, &thunk<&GetLastCombatFeatUsed>);
+    insert(725, "GetLastAttackResult", R_INT, {R_OBJECT}, &thunk<&GetLastAttackResult>);
+    insert(726, "GetWasForcePowerSuccessful", R_INT, {R_OBJECT}, &thunk<&GetWasForcePowerSuccessful>);
+    insert(727, "GetFirstAttacker", R_OBJECT, {R_OBJECT}, &thunk<&GetFirstAttacker>);
+    insert(728, "GetNextAttacker", R_OBJECT, {R_OBJECT}, &thunk<&GetNextAttacker>);
+    insert(729, "SetFormation", R_VOID, {R_OBJECT, R_OBJECT, R_INT, R_INT}, &thunk<&SetFormation>);
+    insert(731, "SetForcePowerUnsuccessful", R_VOID, {R_INT, R_OBJECT}, &thunk<&SetForcePowerUnsuccessful>);
+    insert(732, "GetIsDebilitated", R_INT, {R_OBJECT}, &thunk<&GetIsDebilitated>);
+    insert(733, "PlayMovie", R_VOID, {R_STRING, R_INT}, &thunk<&PlayMovie>);
+    insert(734, "SaveNPCState", R_VOID, {R_INT}, &thunk<&SaveNPCState>);
+    insert(735, "GetCategoryFromTalent", R_INT, {R_TALENT}, &thunk<&GetCategoryFromTalent>);
+    insert(736, "SurrenderByFaction", R_VOID, {R_INT, R_INT}, &thunk<&SurrenderByFaction>);
+    insert(737, "ChangeFactionByFaction", R_VOID, {R_INT, R_INT}, &thunk<&ChangeFactionByFaction>);
+    insert(738, "PlayRoomAnimation", R_VOID, {R_STRING, R_INT}, &thunk<&PlayRoomAnimation>);
+    insert(739, "ShowGalaxyMap", R_VOID, {R_INT}, &thunk<&ShowGalaxyMap>);
+    insert(740, "SetPlanetSelectable", R_VOID, {R_INT, R_INT}, &thunk<&SetPlanetSelectable>);
+    insert(741, "GetPlanetSelectable", R_INT, {R_INT}, &thunk<&GetPlanetSelectable>);
+    insert(742, "SetPlanetAvailable", R_VOID, {R_INT, R_INT}, &thunk<&SetPlanetAvailable>);
+    insert(743, "GetPlanetAvailable", R_INT, {R_INT}, &thunk<&GetPlanetAvailable>);
+    insert(744, "GetSelectedPlanet", R_INT, {}, &thunk<&GetSelectedPlanet>);
+    insert(745, "SoundObjectFadeAndStop", R_VOID, {R_OBJECT, R_FLOAT}, &thunk<&SoundObjectFadeAndStop>);
+    insert(746, "SetAreaFogColor", R_VOID, {R_OBJECT, R_FLOAT, R_FLOAT, R_FLOAT}, &thunk<&SetAreaFogColor>);
+    insert(747, "ChangeItemCost", R_VOID, {R_STRING, R_FLOAT}, &thunk<&ChangeItemCost>);
+    insert(748, "GetIsLiveContentAvailable", R_INT, {R_INT}, &thunk<&GetIsLiveContentAvailable>);
+    insert(749, "ResetDialogState", R_VOID, {}, &thunk<&ResetDialogState>);
+    insert(750, "SetGoodEvilValue", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetGoodEvilValue>);
+    insert(751, "GetIsPoisoned", R_INT, {R_OBJECT}, &thunk<&GetIsPoisoned>);
+    insert(752, "GetSpellTarget", R_OBJECT, {R_OBJECT}, &thunk<&GetSpellTarget>);
+    insert(753, "SetSoloMode", R_VOID, {R_INT}, &thunk<&SetSoloMode>);
+    insert(757, "CancelPostDialogCharacterSwitch", R_VOID, {}, &thunk<&CancelPostDialogCharacterSwitch>);
+    insert(758, "SetMaxHitPoints", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetMaxHitPoints>);
+    insert(759, "NoClicksFor", R_VOID, {R_FLOAT}, &thunk<&NoClicksFor>);
+    insert(760, "HoldWorldFadeInForDialog", R_VOID, {}, &thunk<&HoldWorldFadeInForDialog>);
+    insert(761, "ShipBuild", R_INT, {}, &thunk<&ShipBuild>);
+    insert(762, "SurrenderRetainBuffs", R_VOID, {}, &thunk<&SurrenderRetainBuffs>);
+    insert(763, "SuppressStatusSummaryEntry", R_VOID, {R_INT}, &thunk<&SuppressStatusSummaryEntry>);
+    insert(764, "GetCheatCode", R_INT, {R_INT}, &thunk<&GetCheatCode>);
+    insert(765, "SetMusicVolume", R_VOID, {R_FLOAT}, &thunk<&SetMusicVolume>);
+    insert(766, "CreateItemOnFloor", R_OBJECT, {R_STRING, R_LOCATION, R_INT}, &thunk<&CreateItemOnFloor>);
+    insert(767, "SetAvailableNPCId", R_VOID, {R_INT, R_OBJECT}, &thunk<&SetAvailableNPCId>);
+    insert(768, "GetScriptParameter", R_INT, {R_INT}, &thunk<&GetScriptParameter>);
+    insert(769, "SetFadeUntilScript", R_VOID, {}, &thunk<&SetFadeUntilScript>);
+    insert(771, "GetItemComponent", R_INT, {}, &thunk<&GetItemComponent>);
+    insert(772, "GetItemComponentPieceValue", R_INT, {}, &thunk<&GetItemComponentPieceValue>);
+    insert(773, "ShowChemicalUpgradeScreen", R_VOID, {R_OBJECT}, &thunk<&ShowChemicalUpgradeScreen>);
+    insert(774, "GetChemicals", R_INT, {}, &thunk<&GetChemicals>);
+    insert(775, "GetChemicalPieceValue", R_INT, {}, &thunk<&GetChemicalPieceValue>);
+    insert(776, "GetSpellForcePointCost", R_INT, {}, &thunk<&GetSpellForcePointCost>);
+    insert(783, "GetFeatAcquired", R_INT, {R_INT, R_OBJECT}, &thunk<&GetFeatAcquired>);
+    insert(784, "GetSpellAcquired", R_INT, {R_INT, R_OBJECT}, &thunk<&GetSpellAcquired>);
+    insert(785, "ShowSwoopUpgradeScreen", R_VOID, {}, &thunk<&ShowSwoopUpgradeScreen>);
+    insert(786, "GrantFeat", R_VOID, {R_INT, R_OBJECT}, &thunk<&GrantFeat>);
+    insert(787, "GrantSpell", R_VOID, {R_INT, R_OBJECT}, &thunk<&GrantSpell>);
+    insert(788, "SpawnMine", R_VOID, {R_INT, R_LOCATION, R_INT, R_INT, R_OBJECT}, &thunk<&SpawnMine>);
+    insert(791, "SetFakeCombatState", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetFakeCombatState>);
+    insert(793, "GetOwnerDemolitionsSkill", R_INT, {R_OBJECT}, &thunk<&GetOwnerDemolitionsSkill>);
+    insert(794, "SetOrientOnClick", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetOrientOnClick>);
+    insert(795, "GetInfluence", R_INT, {R_INT}, &thunk<&GetInfluence>);
+    insert(796, "SetInfluence", R_VOID, {R_INT, R_INT}, &thunk<&SetInfluence>);
+    insert(797, "ModifyInfluence", R_VOID, {R_INT, R_INT}, &thunk<&ModifyInfluence>);
+    insert(798, "GetRacialSubType", R_INT, {R_OBJECT}, &thunk<&GetRacialSubType>);
+    insert(799, "IncrementGlobalNumber", R_VOID, {R_STRING, R_INT}, &thunk<&IncrementGlobalNumber>);
+    insert(800, "DecrementGlobalNumber", R_VOID, {R_STRING, R_INT}, &thunk<&DecrementGlobalNumber>);
+    insert(801, "SetBonusForcePoints", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetBonusForcePoints>);
+    insert(802, "AddBonusForcePoints", R_VOID, {R_OBJECT, R_INT}, &thunk<&AddBonusForcePoints>);
+    insert(803, "GetBonusForcePoints", R_VOID, {R_OBJECT}, &thunk<&GetBonusForcePoints>);
+    insert(805, "IsMoviePlaying", R_INT, {}, &thunk<&IsMoviePlaying>);
+    insert(806, "QueueMovie", R_VOID, {R_STRING, R_INT}, &thunk<&QueueMovie>);
+    insert(807, "PlayMovieQueue", R_VOID, {R_INT}, &thunk<&PlayMovieQueue>);
+    insert(808, "YavinHackDoorClose", R_VOID, {R_OBJECT}, &thunk<&YavinHackDoorClose>);
+    insert(810, "IsStealthed", R_INT, {R_OBJECT}, &thunk<&IsStealthed>);
+    insert(811, "IsMeditating", R_INT, {R_OBJECT}, &thunk<&IsMeditating>);
+    insert(812, "IsInTotalDefense", R_INT, {R_OBJECT}, &thunk<&IsInTotalDefense>);
+    insert(813, "SetHealTarget", R_VOID, {R_OBJECT, R_OBJECT}, &thunk<&SetHealTarget>);
+    insert(814, "GetHealTarget", R_OBJECT, {R_OBJECT}, &thunk<&GetHealTarget>);
+    insert(815, "GetRandomDestination", R_VECTOR, {R_OBJECT, R_INT}, &thunk<&GetRandomDestination>);
+    insert(816, "IsFormActive", R_INT, {R_OBJECT, R_INT}, &thunk<&IsFormActive>);
+    insert(817, "GetSpellFormMask", R_INT, {R_INT}, &thunk<&GetSpellFormMask>);
+    insert(818, "GetSpellBaseForcePointCost", R_INT, {R_INT}, &thunk<&GetSpellBaseForcePointCost>);
+    insert(819, "SetKeepStealthInDialog", R_VOID, {R_INT}, &thunk<&SetKeepStealthInDialog>);
+    insert(820, "HasLineOfSight", R_INT, {R_VECTOR, R_VECTOR, R_OBJECT, R_OBJECT}, &thunk<&HasLineOfSight>);
+    insert(821, "ShowDemoScreen", R_INT, {R_STRING, R_INT, R_INT, R_INT, R_INT}, &thunk<&ShowDemoScreen>);
+    insert(822, "ForceHeartbeat", R_VOID, {R_OBJECT}, &thunk<&ForceHeartbeat>);
+    insert(824, "IsRunning", R_INT, {R_OBJECT}, &thunk<&IsRunning>);
+    insert(826, "SetForfeitConditions", R_VOID, {R_INT}, &thunk<&SetForfeitConditions>);
+    insert(827, "GetLastForfeitViolation", R_INT, {}, &thunk<&GetLastForfeitViolation>);
+    insert(828, "ModifyReflexSavingThrowBase", R_VOID, {R_OBJECT, R_INT}, &thunk<&ModifyReflexSavingThrowBase>);
+    insert(829, "ModifyFortitudeSavingThrowBase", R_VOID, {R_OBJECT, R_INT}, &thunk<&ModifyFortitudeSavingThrowBase>);
+    insert(830, "ModifyWillSavingThrowBase", R_VOID, {R_OBJECT, R_INT}, &thunk<&ModifyWillSavingThrowBase>);
+    insert(831, "GetScriptStringParameter", R_STRING, {}, &thunk<&GetScriptStringParameter>);
+    insert(832, "GetObjectPersonalSpace", R_FLOAT, {R_OBJECT}, &thunk<&GetObjectPersonalSpace>);
+    insert(833, "AdjustCreatureAttributes", R_VOID, {R_OBJECT, R_INT, R_INT}, &thunk<&AdjustCreatureAttributes>);
+    insert(834, "SetCreatureAILevel", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetCreatureAILevel>);
+    insert(835, "ResetCreatureAILevel", R_VOID, {R_OBJECT}, &thunk<&ResetCreatureAILevel>);
+    insert(836, "AddAvailablePUPByTemplate", R_INT, {R_INT, R_STRING}, &thunk<&AddAvailablePUPByTemplate>);
+    insert(837, "AddAvailablePUPByObject", R_INT, {R_INT, R_OBJECT}, &thunk<&AddAvailablePUPByObject>);
+    insert(838, "AssignPUP", R_INT, {R_INT, R_INT}, &thunk<&AssignPUP>);
+    insert(839, "SpawnAvailablePUP", R_OBJECT, {R_INT, R_LOCATION}, &thunk<&SpawnAvailablePUP>);
+    insert(840, "AddPartyPuppet", R_INT, {R_INT, R_OBJECT}, &thunk<&AddPartyPuppet>);
+    insert(841, "GetPUPOwner", R_OBJECT, {R_OBJECT}, &thunk<&GetPUPOwner>);
+    insert(842, "GetIsPuppet", R_INT, {R_OBJECT}, &thunk<&GetIsPuppet>);
+    insert(844, "GetIsPartyLeader", R_INT, {R_OBJECT}, &thunk<&GetIsPartyLeader>);
+    insert(845, "GetPartyLeader", R_OBJECT, {}, &thunk<&GetPartyLeader>);
+    insert(846, "RemoveNPCFromPartyToBase", R_INT, {R_INT}, &thunk<&RemoveNPCFromPartyToBase>);
+    insert(847, "CreatureFlourishWeapon", R_VOID, {R_OBJECT}, &thunk<&CreatureFlourishWeapon>);
+    insert(850, "ChangeObjectAppearance", R_VOID, {R_OBJECT, R_INT}, &thunk<&ChangeObjectAppearance>);
+    insert(851, "GetIsXBox", R_INT, {}, &thunk<&GetIsXBox>);
+    insert(854, "PlayOverlayAnimation", R_VOID, {R_OBJECT, R_INT}, &thunk<&PlayOverlayAnimation>);
+    insert(855, "UnlockAllSongs", R_VOID, {}, &thunk<&UnlockAllSongs>);
+    insert(856, "DisableMap", R_VOID, {R_INT}, &thunk<&DisableMap>);
+    insert(857, "DetonateMine", R_VOID, {R_OBJECT}, &thunk<&DetonateMine>);
+    insert(858, "DisableHealthRegen", R_VOID, {R_INT}, &thunk<&DisableHealthRegen>);
+    insert(859, "SetCurrentForm", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetCurrentForm>);
+    insert(860, "SetDisableTransit", R_VOID, {R_INT}, &thunk<&SetDisableTransit>);
+    insert(861, "SetInputClass", R_VOID, {R_INT}, &thunk<&SetInputClass>);
+    insert(862, "SetForceAlwaysUpdate", R_VOID, {R_OBJECT, R_INT}, &thunk<&SetForceAlwaysUpdate>);
+    insert(863, "EnableRain", R_VOID, {R_INT}, &thunk<&EnableRain>);
+    insert(864, "DisplayMessageBox", R_VOID, {R_INT, R_STRING}, &thunk<&DisplayMessageBox>);
+    insert(865, "DisplayDatapad", R_VOID, {R_OBJECT}, &thunk<&DisplayDatapad>);
+    insert(866, "RemoveHeartbeat", R_VOID, {R_OBJECT}, &thunk<&RemoveHeartbeat>);
+    insert(867, "RemoveEffectByID", R_VOID, {R_OBJECT, R_INT}, &thunk<&RemoveEffectByID>);
+    insert(868, "RemoveEffectByExactMatch", R_VOID, {R_OBJECT, R_EFFECT}, &thunk<&RemoveEffectByExactMatch>);
+    insert(869, "AdjustCreatureSkills", R_VOID, {R_OBJECT, R_INT, R_INT}, &thunk<&AdjustCreatureSkills>);
+    insert(870, "GetSkillRankBase", R_INT, {R_INT, R_OBJECT}, &thunk<&GetSkillRankBase>);
+    insert(871, "EnableRendering", R_VOID, {R_OBJECT, R_INT}, &thunk<&EnableRendering>);
+    insert(872, "GetCombatActionsPending", R_INT, {R_OBJECT}, &thunk<&GetCombatActionsPending>);
+    insert(873, "SaveNPCByObject", R_VOID, {R_INT, R_OBJECT}, &thunk<&SaveNPCByObject>);
+    insert(874, "SavePUPByObject", R_VOID, {R_INT, R_OBJECT}, &thunk<&SavePUPByObject>);
+    insert(875, "GetIsPlayerMadeCharacter", R_INT, {R_OBJECT}, &thunk<&GetIsPlayerMadeCharacter>);
+    insert(876, "RebuildPartyTable", R_VOID, {}, &thunk<&RebuildPartyTable>);
 }
 
 } // namespace game
@@ -73,7 +73,7 @@ void Routines::insert(
     std::string name,
     VariableType retType,
     std::vector<VariableType> argTypes,
-    Variable (*fn)(const std::vector<Variable> &args, const RoutineContext &ctx)) {
+    RoutineFunc fn) {
 
     Variable defRetValue;
     defRetValue.type = retType;
@@ -93,10 +93,7 @@ void Routines::insert(
         retType,
         std::move(defRetValue),
         std::move(argTypes),
-        [this, fn](auto &args, auto &execution) {
-            RoutineContext ctx(*_game, *_services, execution);
-            return fn(args, std::move(ctx));
-        });
+        fn);
 }
 
 } // namespace game
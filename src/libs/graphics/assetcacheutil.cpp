@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/graphics/assetcacheutil.h"
+
+#include "reone/graphics/texture.h"
+#include "reone/graphics/textureutil.h"
+#include "reone/graphics/walkmesh.h"
+#include "reone/system/binaryreader.h"
+#include "reone/system/binarywriter.h"
+#include "reone/system/stream/memoryinput.h"
+#include "reone/system/stream/memoryoutput.h"
+
+namespace reone {
+
+namespace graphics {
+
+static void writeString(BinaryWriter &writer, const std::string &s) {
+    writer.writeUint32(static_cast<uint32_t>(s.size()));
+    writer.writeString(s);
+}
+
+static void writeVec3(BinaryWriter &writer, const glm::vec3 &v) {
+    writer.writeFloat(v.x);
+    writer.writeFloat(v.y);
+    writer.writeFloat(v.z);
+}
+
+static void writeVec3Array(BinaryWriter &writer, const std::vector<glm::vec3> &values) {
+    writer.writeUint32(static_cast<uint32_t>(values.size()));
+    for (auto &value : values) {
+        writeVec3(writer, value);
+    }
+}
+
+static std::string readString(BinaryReader &reader) {
+    int len = static_cast<int>(reader.readUint32());
+    return reader.readString(len);
+}
+
+static glm::vec3 readVec3(BinaryReader &reader) {
+    glm::vec3 v;
+    reader.readFloatArray(&v[0], 3);
+    return v;
+}
+
+static std::vector<glm::vec3> readVec3Array(BinaryReader &reader) {
+    std::vector<glm::vec3> values(reader.readUint32());
+    if (!values.empty()) {
+        reader.readFloatArray(&values[0][0], 3 * static_cast<int>(values.size()));
+    }
+    return values;
+}
+
+ByteBuffer writeTextureBlob(const Texture &texture) {
+    ByteBuffer blob;
+    auto stream = MemoryOutputStream(blob);
+    auto writer = BinaryWriter(stream);
+
+    writer.writeInt32(texture.width());
+    writer.writeInt32(texture.height());
+    writer.writeInt32(static_cast<int>(texture.pixelFormat()));
+    writer.writeUint32(static_cast<uint32_t>(texture.layers().size()));
+    for (auto &layer : texture.layers()) {
+        writer.writeInt32(layer.pixels ? static_cast<int>(layer.pixels->size()) : -1);
+        if (layer.pixels) {
+            writer.write(*layer.pixels);
+        }
+    }
+
+    auto &features = texture.features();
+    writer.writeInt32(static_cast<int>(features.blending));
+    writer.writeFloat(features.waterAlpha);
+    writer.writeByte(features.cube ? 1 : 0);
+    writeString(writer, features.envmapTexture);
+    writeString(writer, features.bumpyShinyTexture);
+    writeString(writer, features.bumpmapTexture);
+    writer.writeFloat(features.bumpMapScaling);
+    writer.writeInt32(features.numChars);
+    writer.writeFloat(features.fontHeight);
+    writeVec3Array(writer, features.upperLeftCoords);
+    writeVec3Array(writer, features.lowerRightCoords);
+    writer.writeInt32(static_cast<int>(features.procedureType));
+    writer.writeInt32(features.numX);
+    writer.writeInt32(features.numY);
+    writer.writeInt32(features.fps);
+
+    return blob;
+}
+
+std::shared_ptr<Texture> readTextureBlob(ByteBuffer &blob, std::string name, TextureUsage usage) {
+    auto stream = MemoryInputStream(blob);
+    auto reader = BinaryReader(stream);
+
+    int width = reader.readInt32();
+    int height = reader.readInt32();
+    auto format = static_cast<PixelFormat>(reader.readInt32());
+    std::vector<Texture::Layer> layers(reader.readUint32());
+    for (auto &layer : layers) {
+        int size = reader.readInt32();
+        if (size != -1) {
+            layer.pixels = std::make_shared<ByteBuffer>(reader.readBytes(size));
+        }
+    }
+
+    Texture::Features features;
+    features.blending = static_cast<Texture::Blending>(reader.readInt32());
+    features.waterAlpha = reader.readFloat();
+    features.cube = reader.readByte() != 0;
+    features.envmapTexture = readString(reader);
+    features.bumpyShinyTexture = readString(reader);
+    features.bumpmapTexture = readString(reader);
+    features.bumpMapScaling = reader.readFloat();
+    features.numChars = reader.readInt32();
+    features.fontHeight = reader.readFloat();
+    features.upperLeftCoords = readVec3Array(reader);
+    features.lowerRightCoords = readVec3Array(reader);
+    features.procedureType = static_cast<Texture::ProcedureType>(reader.readInt32());
+    features.numX = reader.readInt32();
+    features.numY = reader.readInt32();
+    features.fps = reader.readInt32();
+
+    auto texture = std::make_shared<Texture>(std::move(name), getTextureProperties(usage));
+    texture->setPixels(width, height, format, std::move(layers));
+    texture->setFeatures(std::move(features));
+
+    return texture;
+}
+
+static void flattenWalkmeshAABB(const Walkmesh::AABB &aabb, std::vector<const Walkmesh::AABB *> &nodes) {
+    nodes.push_back(&aabb);
+    if (aabb.left) {
+        flattenWalkmeshAABB(*aabb.left, nodes);
+    }
+    if (aabb.right) {
+        flattenWalkmeshAABB(*aabb.right, nodes);
+    }
+}
+
+ByteBuffer writeWalkmeshBlob(const Walkmesh &walkmesh) {
+    ByteBuffer blob;
+    auto stream = MemoryOutputStream(blob);
+    auto writer = BinaryWriter(stream);
+
+    writer.writeByte(walkmesh.isAreaWalkmesh() ? 1 : 0);
+    writer.writeUint32(static_cast<uint32_t>(walkmesh.faces().size()));
+    for (auto &face : walkmesh.faces()) {
+        writer.writeInt32(face.index);
+        writer.writeUint32(face.material);
+        writeVec3Array(writer, face.vertices);
+        writeVec3(writer, face.normal);
+    }
+
+    // Tree nodes in depth-first order, children referenced by index
+
+    std::vector<const Walkmesh::AABB *> nodes;
+    if (walkmesh.rootAABB()) {
+        flattenWalkmeshAABB(*walkmesh.rootAABB(), nodes);
+    }
+    std::unordered_map<const Walkmesh::AABB *, int> indices;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        indices[nodes[i]] = static_cast<int>(i);
+    }
+    writer.writeUint32(static_cast<uint32_t>(nodes.size()));
+    for (auto node : nodes) {
+        writeVec3(writer, node->value.min());
+        writeVec3(writer, node->value.max());
+        writer.writeInt32(node->faceIdx);
+        writer.writeInt32(node->left ? indices.at(node->left.get()) : -1);
+        writer.writeInt32(node->right ? indices.at(node->right.get()) : -1);
+    }
+
+    return blob;
+}
+
+std::shared_ptr<Walkmesh> readWalkmeshBlob(ByteBuffer &blob) {
+    auto stream = MemoryInputStream(blob);
+    auto reader = BinaryReader(stream);
+
+    auto walkmesh = std::make_shared<Walkmesh>();
+    walkmesh->setAreaWalkmesh(reader.readByte() != 0);
+    int numFaces = static_cast<int>(reader.readUint32());
+    for (int i = 0; i < numFaces; ++i) {
+        Walkmesh::Face face;
+        face.index = reader.readInt32();
+        face.material = reader.readUint32();
+        face.vertices = readVec3Array(reader);
+        face.normal = readVec3(reader);
+        walkmesh->add(std::move(face));
+    }
+
+    int numNodes = static_cast<int>(reader.readUint32());
+    std::vector<std::shared_ptr<Walkmesh::AABB>> nodes(numNodes);
+    std::vector<std::pair<int, int>> children(numNodes);
+    for (int i = 0; i < numNodes; ++i) {
+        nodes[i] = std::make_shared<Walkmesh::AABB>();
+        glm::vec3 min(readVec3(reader));
+        glm::vec3 max(readVec3(reader));
+        nodes[i]->value = AABB(min, max);
+        nodes[i]->faceIdx = reader.readInt32();
+        children[i].first = reader.readInt32();
+        children[i].second = reader.readInt32();
+    }
+    for (int i = 0; i < numNodes; ++i) {
+        if (children[i].first != -1) {
+            nodes[i]->left = nodes.at(children[i].first);
+        }
+        if (children[i].second != -1) {
+            nodes[i]->right = nodes.at(children[i].second);
+        }
+    }
+    if (!nodes.empty()) {
+        walkmesh->setRootAABB(nodes.front());
+    }
+
+    return walkmesh;
+}
+
+} // namespace graphics
+
+} // namespace reone
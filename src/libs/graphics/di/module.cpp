@@ -25,13 +25,14 @@ void GraphicsModule::init() {
     _window = newWindow();
     _context = std::make_unique<GraphicsContext>(_options);
     _meshes = std::make_unique<Meshes>();
-    _textures = std::make_unique<Textures>(_options, _resource.resources());
+    _textures = std::make_unique<Textures>(_options, _resource.resources(), _resource.assetCache());
     _models = std::make_unique<Models>(*_textures, _resource.resources());
-    _walkmeshes = std::make_unique<Walkmeshes>(_resource.resources());
+    _walkmeshes = std::make_unique<Walkmeshes>(_resource.resources(), _resource.assetCache());
     _lips = std::make_unique<Lips>(_resource.resources());
     _uniforms = std::make_unique<Uniforms>();
     _shaders = std::make_unique<Shaders>(_options);
-    _fonts = std::make_unique<Fonts>(*_context, *_meshes, *_shaders, *_textures, *_uniforms);
+    _spriteBatch = std::make_unique<SpriteBatch>(*_context, *_shaders, *_textures, *_uniforms, *_window);
+    _fonts = std::make_unique<Fonts>(*_spriteBatch, *_textures);
     _pipeline = std::make_unique<Pipeline>(_options, *_context, *_meshes, *_shaders, *_textures, *_uniforms);
 
     _services = std::make_unique<GraphicsServices>(
@@ -42,6 +43,7 @@ void GraphicsModule::init() {
         *_models,
         *_pipeline,
         *_shaders,
+        *_spriteBatch,
         *_textures,
         *_uniforms,
         *_walkmeshes,
@@ -53,12 +55,14 @@ void GraphicsModule::init() {
     _uniforms->init();
     _shaders->init();
     _pipeline->init();
+    _spriteBatch->init();
 }
 
 void GraphicsModule::deinit() {
     _services.reset();
 
     _pipeline.reset();
+    _spriteBatch.reset();
     _shaders.reset();
     _uniforms.reset();
     _textures.reset();
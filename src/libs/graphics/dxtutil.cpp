@@ -21,176 +21,141 @@ namespace reone {
 
 namespace graphics {
 
-static uint32_t packRGBA(uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
-    return ((r << 24) | (g << 16) | (b << 8) | a);
+template <class T>
+static T readLE(const uint8_t *data) {
+    T value;
+    memcpy(&value, data, sizeof(T));
+    return value;
 }
 
-static void decompressDXT1Block(uint32_t x, uint32_t y, uint32_t width, const uint8_t *blockStorage, uint32_t *image) {
-    uint16_t color0 = *reinterpret_cast<const uint16_t *>(blockStorage + 0);
-    uint16_t color1 = *reinterpret_cast<const uint16_t *>(blockStorage + 2);
-    uint32_t colorCodes = *reinterpret_cast<const uint32_t *>(blockStorage + 4);
-
+static void unpackRGB565(uint16_t color, uint8_t &r, uint8_t &g, uint8_t &b) {
     uint32_t temp;
+    temp = (color >> 11) * 255 + 16;
+    r = static_cast<uint8_t>((temp / 32 + temp) / 32);
+    temp = ((color & 0x07e0) >> 5) * 255 + 32;
+    g = static_cast<uint8_t>((temp / 64 + temp) / 64);
+    temp = (color & 0x001f) * 255 + 16;
+    b = static_cast<uint8_t>((temp / 32 + temp) / 32);
+}
 
-    temp = (color0 >> 11) * 255 + 16;
-    uint8_t r0 = static_cast<uint8_t>((temp / 32 + temp) / 32);
-    temp = ((color0 & 0x07e0) >> 5) * 255 + 32;
-    uint8_t g0 = static_cast<uint8_t>((temp / 64 + temp) / 64);
-    temp = (color0 & 0x001f) * 255 + 16;
-    uint8_t b0 = static_cast<uint8_t>((temp / 32 + temp) / 32);
-
-    temp = (color1 >> 11) * 255 + 16;
-    uint8_t r1 = static_cast<uint8_t>((temp / 32 + temp) / 32);
-    temp = ((color1 & 0x07e0) >> 5) * 255 + 32;
-    uint8_t g1 = static_cast<uint8_t>((temp / 64 + temp) / 64);
-    temp = (color1 & 0x001f) * 255 + 16;
-    uint8_t b1 = static_cast<uint8_t>((temp / 32 + temp) / 32);
-
-    for (int j = 0; j < 4; j++) {
-        for (int i = 0; i < 4; i++) {
-            int colorCodeIdx = 2 * (4 * j + i);
-            uint8_t colorCode = (colorCodes >> colorCodeIdx) & 0x03;
-            uint32_t finalColor = 0;
-
-            if (color0 > color1) {
-                switch (colorCode) {
-                case 0:
-                    finalColor = packRGBA(r0, g0, b0, 255);
-                    break;
-                case 1:
-                    finalColor = packRGBA(r1, g1, b1, 255);
-                    break;
-                case 2:
-                    finalColor = packRGBA((2 * r0 + r1) / 3, (2 * g0 + g1) / 3, (2 * b0 + b1) / 3, 255);
-                    break;
-                case 3:
-                    finalColor = packRGBA((r0 + 2 * r1) / 3, (g0 + 2 * g1) / 3, (b0 + 2 * b1) / 3, 255);
-                    break;
-                }
-            } else {
-                switch (colorCode) {
-                case 0:
-                    finalColor = packRGBA(r0, g0, b0, 255);
-                    break;
-                case 1:
-                    finalColor = packRGBA(r1, g1, b1, 255);
-                    break;
-                case 2:
-                    finalColor = packRGBA((r0 + r1) / 2, (g0 + g1) / 2, (b0 + b1) / 2, 255);
-                    break;
-                case 3:
-                    finalColor = packRGBA(0, 0, 0, 255);
-                    break;
-                }
-            }
-
-            if (x + i < width) {
-                image[(y + j) * width + (x + i)] = finalColor;
-            }
+/**
+ * Computes four block colors, with channels in destination order and alpha of 255.
+ */
+template <bool Bgr>
+static void decodeColorPalette(const uint8_t *block, bool allowTransparent, uint8_t palette[4][4]) {
+    uint16_t color0 = readLE<uint16_t>(block + 0);
+    uint16_t color1 = readLE<uint16_t>(block + 2);
+
+    uint8_t rgb[4][3];
+    unpackRGB565(color0, rgb[0][0], rgb[0][1], rgb[0][2]);
+    unpackRGB565(color1, rgb[1][0], rgb[1][1], rgb[1][2]);
+    for (int c = 0; c < 3; ++c) {
+        if (!allowTransparent || color0 > color1) {
+            rgb[2][c] = (2 * rgb[0][c] + rgb[1][c]) / 3;
+            rgb[3][c] = (rgb[0][c] + 2 * rgb[1][c]) / 3;
+        } else {
+            rgb[2][c] = (rgb[0][c] + rgb[1][c]) / 2;
+            rgb[3][c] = 0;
         }
     }
+    for (int i = 0; i < 4; ++i) {
+        palette[i][0] = Bgr ? rgb[i][2] : rgb[i][0];
+        palette[i][1] = rgb[i][1];
+        palette[i][2] = Bgr ? rgb[i][0] : rgb[i][2];
+        palette[i][3] = 255;
+    }
 }
 
-void decompressDXT1(uint32_t width, uint32_t height, const uint8_t *blockStorage, uint32_t *image) {
-    uint32_t blockCountX = (width + 3) / 4;
-    uint32_t blockCountY = (height + 3) / 4;
-    uint32_t blockWidth = (width < 4) ? width : 4;
-    uint32_t blockHeight = (height < 4) ? height : 4;
-
-    for (uint32_t j = 0; j < blockCountY; j++) {
-        for (uint32_t i = 0; i < blockCountX; i++) {
-            decompressDXT1Block(i * 4, j * 4, width, blockStorage + i * 8, image);
+static void decodeAlphaPalette(const uint8_t *block, uint8_t palette[8]) {
+    uint8_t alpha0 = block[0];
+    uint8_t alpha1 = block[1];
+    palette[0] = alpha0;
+    palette[1] = alpha1;
+    if (alpha0 > alpha1) {
+        for (int code = 2; code < 8; ++code) {
+            palette[code] = ((8 - code) * alpha0 + (code - 1) * alpha1) / 7;
         }
-        blockStorage += blockCountX * 8;
+    } else {
+        for (int code = 2; code < 6; ++code) {
+            palette[code] = ((6 - code) * alpha0 + (code - 1) * alpha1) / 5;
+        }
+        palette[6] = 0;
+        palette[7] = 255;
     }
 }
 
-static void decompressDXT5Block(uint32_t x, uint32_t y, uint32_t width, const uint8_t *blockStorage, uint32_t *image) {
-    uint8_t alpha0 = *(blockStorage + 0);
-    uint8_t alpha1 = *(blockStorage + 1);
-    uint64_t alphaCodes = *reinterpret_cast<const uint64_t *>(blockStorage + 2);
-
-    uint16_t color0 = *reinterpret_cast<const uint16_t *>(blockStorage + 8);
-    uint16_t color1 = *reinterpret_cast<const uint16_t *>(blockStorage + 10);
-    uint32_t colorCodes = *reinterpret_cast<const uint32_t *>(blockStorage + 12);
-
-    uint32_t temp;
-
-    temp = (color0 >> 11) * 255 + 16;
-    uint8_t r0 = static_cast<uint8_t>((temp / 32 + temp) / 32);
-    temp = ((color0 & 0x07e0) >> 5) * 255 + 32;
-    uint8_t g0 = static_cast<uint8_t>((temp / 64 + temp) / 64);
-    temp = (color0 & 0x001f) * 255 + 16;
-    uint8_t b0 = static_cast<uint8_t>((temp / 32 + temp) / 32);
-
-    temp = (color1 >> 11) * 255 + 16;
-    uint8_t r1 = static_cast<uint8_t>((temp / 32 + temp) / 32);
-    temp = ((color1 & 0x07e0) >> 5) * 255 + 32;
-    uint8_t g1 = static_cast<uint8_t>((temp / 64 + temp) / 64);
-    temp = (color1 & 0x001f) * 255 + 16;
-    uint8_t b1 = static_cast<uint8_t>((temp / 32 + temp) / 32);
-
-    for (int j = 0; j < 4; j++) {
-        for (int i = 0; i < 4; i++) {
-            int alphaCodeIdx = 3 * (4 * j + i);
-            int alphaCode = (alphaCodes >> alphaCodeIdx) & 0x07;
-            uint8_t finalAlpha;
-            if (alphaCode == 0) {
-                finalAlpha = alpha0;
-            } else if (alphaCode == 1) {
-                finalAlpha = alpha1;
-            } else {
-                if (alpha0 > alpha1) {
-                    finalAlpha = ((8 - alphaCode) * alpha0 + (alphaCode - 1) * alpha1) / 7;
-                } else {
-                    if (alphaCode == 6)
-                        finalAlpha = 0;
-                    else if (alphaCode == 7)
-                        finalAlpha = 255;
-                    else
-                        finalAlpha = ((6 - alphaCode) * alpha0 + (alphaCode - 1) * alpha1) / 5;
+/**
+ * Decodes every block into destination pixels. Palettes are computed once per
+ * block, so that every pixel is a table lookup followed by a fixed-size copy.
+ */
+template <int Bpp, bool Bgr, bool Dxt5>
+static void decompressBlocks(int width, int height, const uint8_t *blocks, uint8_t *pixels) {
+    constexpr int kBlockSize = Dxt5 ? 16 : 8;
+    constexpr int kColorOffset = Dxt5 ? 8 : 0;
+
+    int blockCountX = (width + 3) / 4;
+    int blockCountY = (height + 3) / 4;
+    uint8_t colors[4][4];
+    uint8_t alphas[8];
+
+    for (int by = 0; by < blockCountY; ++by) {
+        int blockHeight = std::min(4, height - 4 * by);
+        for (int bx = 0; bx < blockCountX; ++bx) {
+            int blockWidth = std::min(4, width - 4 * bx);
+            const uint8_t *block = blocks + (static_cast<size_t>(by) * blockCountX + bx) * kBlockSize;
+
+            decodeColorPalette<Bgr>(block + kColorOffset, !Dxt5, colors);
+            uint32_t colorCodes = readLE<uint32_t>(block + kColorOffset + 4);
+            uint64_t alphaCodes = 0;
+            if (Dxt5) {
+                decodeAlphaPalette(block, alphas);
+                for (int i = 0; i < 6; ++i) {
+                    alphaCodes |= static_cast<uint64_t>(block[2 + i]) << (8 * i);
                 }
             }
 
-            int colorCodeIdx = 2 * (4 * j + i);
-            uint8_t colorCode = (colorCodes >> colorCodeIdx) & 0x03;
-            uint32_t finalColor;
-            switch (colorCode) {
-            case 0:
-                finalColor = packRGBA(r0, g0, b0, finalAlpha);
-                break;
-            case 1:
-                finalColor = packRGBA(r1, g1, b1, finalAlpha);
-                break;
-            case 2:
-                finalColor = packRGBA((2 * r0 + r1) / 3, (2 * g0 + g1) / 3, (2 * b0 + b1) / 3, finalAlpha);
-                break;
-            case 3:
-                finalColor = packRGBA((r0 + 2 * r1) / 3, (g0 + 2 * g1) / 3, (b0 + 2 * b1) / 3, finalAlpha);
-                break;
-            }
-
-            if (x + i < width) {
-                image[(y + j) * width + (x + i)] = finalColor;
+            for (int j = 0; j < blockHeight; ++j) {
+                uint8_t *row = pixels + ((static_cast<size_t>(4 * by + j) * width) + 4 * bx) * Bpp;
+                for (int i = 0; i < blockWidth; ++i) {
+                    int code = 4 * j + i;
+                    memcpy(row + i * Bpp, colors[(colorCodes >> (2 * code)) & 0x03], Bpp);
+                    if (Dxt5 && Bpp == 4) {
+                        row[i * Bpp + 3] = alphas[(alphaCodes >> (3 * code)) & 0x07];
+                    }
+                }
             }
         }
     }
 }
 
-void decompressDXT5(uint32_t width, uint32_t height, const uint8_t *blockStorage, uint32_t *image) {
-    uint32_t blockCountX = (width + 3) / 4;
-    uint32_t blockCountY = (height + 3) / 4;
-    uint32_t blockWidth = (width < 4) ? width : 4;
-    uint32_t blockHeight = (height < 4) ? height : 4;
-
-    for (uint32_t j = 0; j < blockCountY; j++) {
-        for (uint32_t i = 0; i < blockCountX; i++) {
-            decompressDXT5Block(i * 4, j * 4, width, blockStorage + i * 16, image);
-        }
-        blockStorage += blockCountX * 16;
+template <bool Dxt5>
+static void decompress(int width, int height, const uint8_t *blocks, PixelFormat dstFormat, uint8_t *pixels) {
+    switch (dstFormat) {
+    case PixelFormat::RGB8:
+        decompressBlocks<3, false, Dxt5>(width, height, blocks, pixels);
+        break;
+    case PixelFormat::RGBA8:
+        decompressBlocks<4, false, Dxt5>(width, height, blocks, pixels);
+        break;
+    case PixelFormat::BGR8:
+        decompressBlocks<3, true, Dxt5>(width, height, blocks, pixels);
+        break;
+    case PixelFormat::BGRA8:
+        decompressBlocks<4, true, Dxt5>(width, height, blocks, pixels);
+        break;
+    default:
+        throw std::invalid_argument("Unsupported destination pixel format: " + std::to_string(static_cast<int>(dstFormat)));
     }
 }
 
+void decompressDXT1(int width, int height, const uint8_t *blocks, PixelFormat dstFormat, uint8_t *pixels) {
+    decompress<false>(width, height, blocks, dstFormat, pixels);
+}
+
+void decompressDXT5(int width, int height, const uint8_t *blocks, PixelFormat dstFormat, uint8_t *pixels) {
+    decompress<true>(width, height, blocks, dstFormat, pixels);
+}
+
 } // namespace graphics
 
 } // namespace reone
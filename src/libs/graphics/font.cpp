@@ -17,13 +17,7 @@
 
 #include "reone/graphics/font.h"
 
-#include "reone/graphics/context.h"
-#include "reone/graphics/mesh.h"
-#include "reone/graphics/meshes.h"
-#include "reone/graphics/shaders.h"
 #include "reone/graphics/texture.h"
-#include "reone/graphics/textures.h"
-#include "reone/graphics/uniforms.h"
 
 namespace reone {
 
@@ -56,39 +50,37 @@ void Font::draw(const std::string &text, const glm::vec3 &position, const glm::v
     if (text.empty()) {
         return;
     }
+    _glyphSprites.clear();
+    layout(text, position, color, gravity, _glyphSprites);
+    draw(_glyphSprites);
+}
 
-    _shaders.use(ShaderProgramId::Text);
-    _textures.bind(*_texture);
-
-    _uniforms.setGeneral([this, &color](auto &general) {
-        general.resetLocals();
-        general.color = glm::vec4(color, 1.0f);
-    });
+void Font::draw(const std::vector<Sprite> &glyphs) {
+    if (glyphs.empty()) {
+        return;
+    }
+    _spriteBatch.draw(SpriteMaterial(*_texture), glyphs);
+}
 
-    int numBlocks = static_cast<int>(text.size()) / kMaxTextChars;
-    if (text.size() % kMaxTextChars > 0) {
-        ++numBlocks;
+void Font::layout(const std::string &text, const glm::vec3 &position, const glm::vec3 &color, TextGravity gravity, std::vector<Sprite> &glyphs) const {
+    if (text.empty()) {
+        return;
     }
-    glm::vec3 textOffset(getTextOffset(text, gravity), 0.0f);
-    for (int i = 0; i < numBlocks; ++i) {
-        int numChars = glm::min(kMaxTextChars, static_cast<int>(text.size()) - i * kMaxTextChars);
-        _uniforms.setText([this, &text, &position, &textOffset, &i, &numChars](auto &uniforms) {
-            for (int j = 0; j < numChars; ++j) {
-                const Glyph &glyph = _glyphs[static_cast<unsigned char>(text[i * kMaxTextChars + j])];
-
-                glm::vec4 posScale;
-                posScale[0] = position.x + textOffset.x;
-                posScale[1] = position.y + textOffset.y;
-                posScale[2] = glyph.size.x;
-                posScale[3] = glyph.size.y;
-
-                uniforms.chars[j].posScale = std::move(posScale);
-                uniforms.chars[j].uv = glm::vec4(glyph.ul.x, glyph.lr.y, glyph.lr.x - glyph.ul.x, glyph.ul.y - glyph.lr.y);
-
-                textOffset.x += glyph.size.x;
-            }
-        });
-        _meshes.quad().drawInstanced(numChars);
+    glm::vec2 textOffset(getTextOffset(text, gravity));
+    glm::vec4 glyphColor(color, 1.0f);
+    for (auto &ch : text) {
+        const Glyph &glyph = _glyphs[static_cast<unsigned char>(ch)];
+
+        Sprite sprite(
+            glm::vec4(position.x + textOffset.x, position.y + textOffset.y, glyph.size.x, glyph.size.y),
+            glyphColor);
+        sprite.uv[0] = glm::vec2(glyph.ul.x, glyph.ul.y);
+        sprite.uv[1] = glm::vec2(glyph.lr.x, glyph.ul.y);
+        sprite.uv[2] = glm::vec2(glyph.lr.x, glyph.lr.y);
+        sprite.uv[3] = glm::vec2(glyph.ul.x, glyph.lr.y);
+        glyphs.push_back(std::move(sprite));
+
+        textOffset.x += glyph.size.x;
     }
 }
 
@@ -17,11 +17,7 @@
 
 #include "reone/graphics/fonts.h"
 
-#include "reone/graphics/context.h"
-#include "reone/graphics/meshes.h"
-#include "reone/graphics/shaders.h"
 #include "reone/graphics/textures.h"
-#include "reone/graphics/window.h"
 
 using namespace reone::resource;
 
@@ -41,7 +37,7 @@ std::shared_ptr<Font> Fonts::doGet(std::string resRef) {
     if (!texture)
         return nullptr;
 
-    auto font = std::make_shared<Font>(_graphicsContext, _meshes, _shaders, _textures, _uniforms);
+    auto font = std::make_shared<Font>(_spriteBatch);
     font->load(texture);
 
     return font;
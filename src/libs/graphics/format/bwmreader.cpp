@@ -95,44 +95,22 @@ void BwmReader::load() {
 
 void BwmReader::loadVertices() {
     _bwm.seek(_offVertices);
-    _vertices.reserve(3 * _numVertices);
-
-    for (uint32_t i = 0; i < _numVertices; ++i) {
-        _vertices.push_back(_bwm.readFloat());
-        _vertices.push_back(_bwm.readFloat());
-        _vertices.push_back(_bwm.readFloat());
-    }
+    _vertices = _bwm.readFloatArray(3 * _numVertices);
 }
 
 void BwmReader::loadIndices() {
     _bwm.seek(_offIndices);
-    _indices.reserve(3 * _numFaces);
-
-    for (uint32_t i = 0; i < _numFaces; ++i) {
-        _indices.push_back(_bwm.readUint32());
-        _indices.push_back(_bwm.readUint32());
-        _indices.push_back(_bwm.readUint32());
-    }
+    _indices = _bwm.readUint32Array(3 * _numFaces);
 }
 
 void BwmReader::loadMaterials() {
     _bwm.seek(_offMaterials);
-    _materials.reserve(_numFaces);
-
-    for (uint32_t i = 0; i < _numFaces; ++i) {
-        _materials.push_back(_bwm.readUint32());
-    }
+    _materials = _bwm.readUint32Array(_numFaces);
 }
 
 void BwmReader::loadNormals() {
     _bwm.seek(_offNormals);
-    _normals.reserve(3 * _numFaces);
-
-    for (uint32_t i = 0; i < _numFaces; ++i) {
-        _normals.push_back(_bwm.readFloat());
-        _normals.push_back(_bwm.readFloat());
-        _normals.push_back(_bwm.readFloat());
-    }
+    _normals = _bwm.readFloatArray(3 * _numFaces);
 }
 
 void BwmReader::loadAABB() {
@@ -145,7 +123,8 @@ void BwmReader::loadAABB() {
     aabbChildren.resize(_numAabb);
 
     for (uint32_t i = 0; i < _numAabb; ++i) {
-        std::vector<float> bounds(_bwm.readFloatArray(6));
+        float bounds[6];
+        _bwm.readFloatArray(bounds, 6);
         int faceIdx = _bwm.readInt32();
         _bwm.skipBytes(4); // unknown
         uint32_t mostSignificantPlane = _bwm.readUint32();
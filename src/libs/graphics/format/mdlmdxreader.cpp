@@ -401,11 +401,14 @@ std::shared_ptr<ModelNode::TriangleMesh> MdlMdxReader::readMesh(int flags) {
         // Faces
         _mdl.seek(kMdlDataOffset + faceArrayDef.offset);
         for (uint32_t i = 0; i < faceArrayDef.count; ++i) {
-            std::vector<float> normalValues(_mdl.readFloatArray(3));
+            float normalValues[3];
+            _mdl.readFloatArray(normalValues, 3);
             float distance = _mdl.readFloat();
             uint32_t material = _mdl.readUint32();
-            std::vector<uint16_t> adjacentFaces(_mdl.readUint16Array(3));
-            std::vector<uint16_t> faceIndices(_mdl.readUint16Array(3));
+            uint16_t adjacentFaces[3];
+            _mdl.readUint16Array(adjacentFaces, 3);
+            uint16_t faceIndices[3];
+            _mdl.readUint16Array(faceIndices, 3);
 
             Mesh::Face face;
             face.indices[0] = faceIndices[0];
@@ -414,7 +417,7 @@ std::shared_ptr<ModelNode::TriangleMesh> MdlMdxReader::readMesh(int flags) {
             face.adjacentFaces[0] = adjacentFaces[0];
             face.adjacentFaces[1] = adjacentFaces[1];
             face.adjacentFaces[2] = adjacentFaces[2];
-            face.normal = glm::make_vec3(&normalValues[0]);
+            face.normal = glm::make_vec3(normalValues);
             face.material = material;
             faces[i] = std::move(face);
         }
@@ -440,7 +443,9 @@ std::shared_ptr<ModelNode::TriangleMesh> MdlMdxReader::readMesh(int flags) {
         faces.emplace_back(10, 7, 11);
     }
 
-    auto mesh = std::make_unique<Mesh>(std::move(vertices), std::move(faces), spec);
+    // Only AABB meshes are queried on CPU, e.g. when placing grass
+    auto residency = (flags & MdlNodeFlags::aabb) ? Mesh::Residency::Queryable : Mesh::Residency::GpuOnly;
+    auto mesh = std::make_unique<Mesh>(std::move(vertices), std::move(faces), spec, residency);
 
     ModelNode::UVAnimation uvAnimation;
     if (animateUV) {
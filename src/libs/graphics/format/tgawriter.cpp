@@ -136,31 +136,14 @@ std::vector<uint8_t> TgaWriter::getTexturePixels(bool compress, TGADataType &dat
         case PixelFormat::BGRA8:
             memcpy(pixels, layerPixelsPtr, 4ll * numPixels);
             break;
-        case PixelFormat::DXT1: {
-            std::vector<uint32_t> decompPixels(numPixels);
-            decompressDXT1(_texture->width(), _texture->height(), layerPixelsPtr, &decompPixels[0]);
-            uint32_t *decompPtr = &decompPixels[0];
-            for (int j = 0; j < numPixels; ++j) {
-                uint32_t rgb = *(decompPtr++);
-                *(pixels++) = (rgb >> 8) & 0xff;
-                *(pixels++) = (rgb >> 16) & 0xff;
-                *(pixels++) = (rgb >> 24) & 0xff;
-            }
+        case PixelFormat::DXT1:
+            decompressDXT1(_texture->width(), _texture->height(), layerPixelsPtr, PixelFormat::BGR8, pixels);
+            pixels += 3ll * numPixels;
             break;
-        }
-        case PixelFormat::DXT5: {
-            std::vector<uint32_t> decompPixels(numPixels);
-            decompressDXT5(_texture->width(), _texture->height(), layerPixelsPtr, &decompPixels[0]);
-            uint32_t *decompPtr = &decompPixels[0];
-            for (int j = 0; j < numPixels; ++j) {
-                uint32_t rgba = *(decompPtr++);
-                *(pixels++) = (rgba >> 8) & 0xff;
-                *(pixels++) = (rgba >> 16) & 0xff;
-                *(pixels++) = (rgba >> 24) & 0xff;
-                *(pixels++) = rgba & 0xff;
-            }
+        case PixelFormat::DXT5:
+            decompressDXT5(_texture->width(), _texture->height(), layerPixelsPtr, PixelFormat::BGRA8, pixels);
+            pixels += 4ll * numPixels;
             break;
-        }
         default:
             break;
         }
@@ -58,6 +58,14 @@ void TpcReader::load() {
         _dataSize = getMipMapDataSize(w, h);
     }
 
+    if (_maxBaseSize > 0) {
+        int w, h;
+        getMipMapSize(_mipLevel, w, h);
+        while (_mipLevel < numMipMaps() - 1 && std::max(w, h) > _maxBaseSize) {
+            getMipMapSize(++_mipLevel, w, h);
+        }
+    }
+
     loadLayers();
     loadFeatures();
     loadTexture();
@@ -69,13 +77,18 @@ void TpcReader::loadLayers() {
     _layers.reserve(_numLayers);
 
     for (int i = 0; i < _numLayers; ++i) {
-        auto pixels = std::make_shared<ByteBuffer>(_tpc.readBytes(_dataSize));
+        std::shared_ptr<ByteBuffer> pixels;
 
-        // Ignore mip maps
-        for (int j = 1; j < _numMipMaps; ++j) {
+        // Skip all mip maps but one
+        for (int j = 0; j < numMipMaps(); ++j) {
             int w, h;
             getMipMapSize(j, w, h);
-            _tpc.skipBytes(getMipMapDataSize(w, h));
+            int size = j == 0 ? _dataSize : getMipMapDataSize(w, h);
+            if (j == _mipLevel) {
+                pixels = std::make_shared<ByteBuffer>(_tpc.readBytes(size));
+            } else {
+                _tpc.skipBytes(size);
+            }
         }
 
         _layers.push_back(Texture::Layer {std::move(pixels)});
@@ -99,7 +112,9 @@ void TpcReader::loadFeatures() {
 
 void TpcReader::loadTexture() {
     _texture = std::make_shared<Texture>(_resRef, getTextureProperties(_usage));
-    _texture->setPixels(_width, _height, getPixelFormat(), _layers);
+    int w, h;
+    getMipMapSize(_mipLevel, w, h);
+    _texture->setPixels(w, h, getPixelFormat(), _layers);
     _texture->setFeatures(_features);
 }
 
@@ -57,7 +57,7 @@ void Framebuffer::configure() {
     }
     if (_depth) {
         if (_depth->isTexture()) {
-            attachTexture(static_cast<Texture &>(*_depth), Attachment::Depth);
+            attachTexture(static_cast<Texture &>(*_depth), Attachment::Depth, 0, _depthLayer);
         } else if (_depth->isRenderbuffer()) {
             attachRenderbuffer(static_cast<Renderbuffer &>(*_depth), Attachment::Depth);
         }
@@ -83,9 +83,13 @@ static GLenum getAttachmentGL(Framebuffer::Attachment attachment, int index = 0)
     throw std::invalid_argument("Invalid framebuffer attachment: " + std::to_string(static_cast<int>(attachment)));
 }
 
-void Framebuffer::attachTexture(const Texture &texture, Attachment attachment, int index) const {
+void Framebuffer::attachTexture(const Texture &texture, Attachment attachment, int index, int layer) const {
     auto attachmentGL = getAttachmentGL(attachment, index);
-    if (texture.isCubemap() || texture.is2DArray()) {
+    if (layer != -1 && texture.isCubemap()) {
+        glFramebufferTexture2D(GL_FRAMEBUFFER, attachmentGL, GL_TEXTURE_CUBE_MAP_POSITIVE_X + layer, texture.nameGL(), 0);
+    } else if (layer != -1 && texture.is2DArray()) {
+        glFramebufferTextureLayer(GL_FRAMEBUFFER, attachmentGL, texture.nameGL(), 0, layer);
+    } else if (texture.isCubemap() || texture.is2DArray()) {
         glFramebufferTexture(GL_FRAMEBUFFER, attachmentGL, texture.nameGL(), 0);
     } else {
         glFramebufferTexture2D(GL_FRAMEBUFFER, attachmentGL, GL_TEXTURE_2D, texture.nameGL(), 0);
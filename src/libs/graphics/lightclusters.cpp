@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "reone/graphics/lightclusters.h"
+
+#include "reone/graphics/camera.h"
+#include "reone/graphics/uniforms.h"
+
+namespace reone {
+
+namespace graphics {
+
+static_assert(kMaxLights == 64, "Cluster bit masks must have one bit per light");
+
+static constexpr float kMinClusterNear = 0.1f;
+static constexpr float kMaxClusterFar = 100.0f; /**< last depth slice extends to the far plane */
+
+static bool intersectSphereAABB(const glm::vec3 &center, float radius, const AABB &aabb) {
+    glm::vec3 closest(glm::clamp(center, aabb.min(), aabb.max()));
+    return glm::distance2(closest, center) <= radius * radius;
+}
+
+static void addClusterLight(LightingUniforms &lighting, int clusterIdx, int lightIdx) {
+    auto &masks = lighting.clusters[clusterIdx / 2];
+    int word = 2 * (clusterIdx % 2) + lightIdx / 32;
+    masks[word] |= 1u << (lightIdx % 32);
+}
+
+void LightClusters::assign(const Camera &camera, LightingUniforms &lighting) {
+    if (_bounds.empty() || _projection != camera.projection() || _zNear != camera.zNear() || _zFar != camera.zFar()) {
+        computeBounds(camera);
+    }
+    std::fill(std::begin(lighting.clusters), std::end(lighting.clusters), glm::uvec4(0u));
+    lighting.clusterNear = _clusterNear;
+    lighting.clusterScale = _clusterScale;
+
+    for (int i = 0; i < lighting.numLights; ++i) {
+        auto &light = lighting.lights[i];
+        if (light.position.w == 0.0f) {
+            // Directional lights affect every cluster
+            for (int clusterIdx = 0; clusterIdx < kNumLightClusters; ++clusterIdx) {
+                addClusterLight(lighting, clusterIdx, i);
+            }
+            continue;
+        }
+        // Light is cut off at squared radius, see lighting.glsl
+        glm::vec3 center(camera.view() * glm::vec4(glm::vec3(light.position), 1.0f));
+        float radius = light.radius * light.radius;
+        float minDepth = -center.z - radius;
+        float maxDepth = -center.z + radius;
+        if (maxDepth < _zNear || minDepth > _zFar) {
+            continue;
+        }
+        // Only test clusters in depth slices, that the light sphere overlaps
+        int minSlice = getSlice(minDepth);
+        int maxSlice = getSlice(maxDepth);
+        for (int clusterIdx = minSlice * kNumLightClustersX * kNumLightClustersY;
+             clusterIdx < (maxSlice + 1) * kNumLightClustersX * kNumLightClustersY;
+             ++clusterIdx) {
+            if (intersectSphereAABB(center, radius, _bounds[clusterIdx])) {
+                addClusterLight(lighting, clusterIdx, i);
+            }
+        }
+    }
+}
+
+void LightClusters::computeBounds(const Camera &camera) {
+    _projection = camera.projection();
+    _zNear = camera.zNear();
+    _zFar = camera.zFar();
+    _clusterNear = std::max(kMinClusterNear, _zNear);
+    float clusterFar = std::max(2.0f * _clusterNear, std::min(kMaxClusterFar, _zFar));
+    _clusterScale = kNumLightClustersZ / glm::log(clusterFar / _clusterNear);
+
+    // Unproject tile corners onto near and far planes
+    auto projectionInv = glm::inverse(_projection);
+    std::vector<std::pair<glm::vec3, glm::vec3>> corners;
+    for (int y = 0; y <= kNumLightClustersY; ++y) {
+        for (int x = 0; x <= kNumLightClustersX; ++x) {
+            glm::vec2 ndc(-1.0f + 2.0f * x / kNumLightClustersX, -1.0f + 2.0f * y / kNumLightClustersY);
+            auto nearPt = projectionInv * glm::vec4(ndc, -1.0f, 1.0f);
+            auto farPt = projectionInv * glm::vec4(ndc, 1.0f, 1.0f);
+            corners.push_back(std::make_pair(glm::vec3(nearPt) / nearPt.w, glm::vec3(farPt) / farPt.w));
+        }
+    }
+    auto pointAtDepth = [](const std::pair<glm::vec3, glm::vec3> &corner, float depth) {
+        float t = (-depth - corner.first.z) / (corner.second.z - corner.first.z);
+        return glm::mix(corner.first, corner.second, t);
+    };
+
+    _bounds.resize(kNumLightClusters);
+    for (int z = 0; z < kNumLightClustersZ; ++z) {
+        float sliceNear = z == 0 ? _zNear : _clusterNear * glm::exp(z / _clusterScale);
+        float sliceFar = z == kNumLightClustersZ - 1 ? _zFar : _clusterNear * glm::exp((z + 1) / _clusterScale);
+        for (int y = 0; y < kNumLightClustersY; ++y) {
+            for (int x = 0; x < kNumLightClustersX; ++x) {
+                AABB bounds;
+                for (int cornerY = y; cornerY <= y + 1; ++cornerY) {
+                    for (int cornerX = x; cornerX <= x + 1; ++cornerX) {
+                        auto &corner = corners[cornerY * (kNumLightClustersX + 1) + cornerX];
+                        bounds.expand(pointAtDepth(corner, sliceNear));
+                        bounds.expand(pointAtDepth(corner, sliceFar));
+                    }
+                }
+                _bounds[(z * kNumLightClustersY + y) * kNumLightClustersX + x] = std::move(bounds);
+            }
+        }
+    }
+}
+
+int LightClusters::getSlice(float depth) const {
+    if (depth <= _clusterNear) {
+        return 0;
+    }
+    return std::min(kNumLightClustersZ - 1, static_cast<int>(glm::log(depth / _clusterNear) * _clusterScale));
+}
+
+} // namespace graphics
+
+} // namespace reone
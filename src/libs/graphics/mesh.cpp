@@ -30,6 +30,9 @@ void Mesh::init() {
         return;
     }
     checkMainThread();
+    if (_vertices.empty() && _numIndices > 0) {
+        throw std::logic_error("Mesh vertex data has been released and cannot be uploaded again");
+    }
 
     std::vector<uint16_t> indices;
     indices.reserve(3 * _faces.size());
@@ -97,9 +100,18 @@ void Mesh::init() {
 
     // END OpenGL
 
+    releaseCpuData();
+
     _inited = true;
 }
 
+void Mesh::releaseCpuData() {
+    std::vector<float>().swap(_vertices);
+    if (_residency == Residency::GpuOnly) {
+        std::vector<Face>().swap(_faces);
+    }
+}
+
 void Mesh::deinit() {
     if (!_inited) {
         return;
@@ -116,7 +128,7 @@ void Mesh::draw() {
         init();
     }
     glBindVertexArray(_vaoId);
-    glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(3 * _faces.size()), GL_UNSIGNED_SHORT, nullptr);
+    glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(_numIndices), GL_UNSIGNED_SHORT, nullptr);
 }
 
 void Mesh::drawInstanced(int count) {
@@ -124,7 +136,29 @@ void Mesh::drawInstanced(int count) {
         init();
     }
     glBindVertexArray(_vaoId);
-    glDrawElementsInstanced(GL_TRIANGLES, static_cast<GLsizei>(3 * _faces.size()), GL_UNSIGNED_SHORT, nullptr, count);
+    glDrawElementsInstanced(GL_TRIANGLES, static_cast<GLsizei>(_numIndices), GL_UNSIGNED_SHORT, nullptr, count);
+}
+
+void Mesh::copyQueryableData() {
+    auto valsPerVert = _spec.stride / sizeof(float);
+    auto numVerts = _vertices.size() / valsPerVert;
+    _positions.reserve(numVerts);
+    if (_spec.offUV1 != -1) {
+        _uv1.reserve(numVerts);
+    }
+    if (_spec.offUV2 != -1) {
+        _uv2.reserve(numVerts);
+    }
+    for (size_t i = 0; i < numVerts; ++i) {
+        auto vertPtr = &_vertices[i * valsPerVert];
+        _positions.push_back(glm::make_vec3(&vertPtr[_spec.offCoords / sizeof(float)]));
+        if (_spec.offUV1 != -1) {
+            _uv1.push_back(glm::make_vec2(&vertPtr[_spec.offUV1 / sizeof(float)]));
+        }
+        if (_spec.offUV2 != -1) {
+            _uv2.push_back(glm::make_vec2(&vertPtr[_spec.offUV2 / sizeof(float)]));
+        }
+    }
 }
 
 void Mesh::computeFaceData() {
@@ -159,28 +193,17 @@ void Mesh::computeAABB() {
 std::vector<glm::vec3> Mesh::getVertexCoords(const Face &face) const {
     std::vector<glm::vec3> coords(3);
     for (int i = 0; i < 3; ++i) {
-        auto vertPtr = &_vertices[face.indices[i] * (_spec.stride / sizeof(float))];
-        coords[i] = glm::make_vec3(&vertPtr[_spec.offCoords / sizeof(float)]);
+        coords[i] = _positions[face.indices[i]];
     }
     return coords;
 }
 
 glm::vec2 Mesh::getUV1(const Face &face, const glm::vec3 &baryPosition) const {
-    std::vector<glm::vec2> uv(3);
-    for (int i = 0; i < 3; ++i) {
-        auto vertPtr = &_vertices[face.indices[i] * (_spec.stride / sizeof(float))];
-        uv[i] = glm::make_vec2(&vertPtr[_spec.offUV1 / sizeof(float)]);
-    }
-    return barycentricToCartesian(uv[0], uv[1], uv[2], baryPosition);
+    return barycentricToCartesian(_uv1[face.indices[0]], _uv1[face.indices[1]], _uv1[face.indices[2]], baryPosition);
 }
 
 glm::vec2 Mesh::getUV2(const Face &face, const glm::vec3 &baryPosition) const {
-    std::vector<glm::vec2> uv(3);
-    for (int i = 0; i < 3; ++i) {
-        auto vertPtr = &_vertices[face.indices[i] * (_spec.stride / sizeof(float))];
-        uv[i] = glm::make_vec2(&vertPtr[_spec.offUV2 / sizeof(float)]);
-    }
-    return barycentricToCartesian(uv[0], uv[1], uv[2], baryPosition);
+    return barycentricToCartesian(_uv2[face.indices[0]], _uv2[face.indices[1]], _uv2[face.indices[2]], baryPosition);
 }
 
 } // namespace graphics
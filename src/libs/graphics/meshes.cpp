@@ -146,7 +146,7 @@ static const Mesh::VertexSpec g_cubemapSpec {8 * sizeof(float), 0, 3 * sizeof(fl
 // END Boxes
 
 static std::unique_ptr<Mesh> getMesh(std::vector<float> vertices, std::vector<Mesh::Face> faces, Mesh::VertexSpec spec) {
-    return std::make_unique<Mesh>(std::move(vertices), std::move(faces), std::move(spec));
+    return std::make_unique<Mesh>(std::move(vertices), std::move(faces), std::move(spec), Mesh::Residency::GpuOnly);
 }
 
 void Meshes::init() {
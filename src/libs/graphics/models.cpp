@@ -45,17 +45,13 @@ std::shared_ptr<Model> Models::get(const std::string &resRef) {
     }
 
     auto lcResRef = boost::to_lower_copy(resRef);
-    auto maybeModel = _cache.find(lcResRef);
-    if (maybeModel != _cache.end()) {
-        return maybeModel->second;
-    }
-
-    auto inserted = _cache.insert(std::make_pair(lcResRef, doGet(lcResRef)));
-    return inserted.first->second;
+    return _cache.getOrAdd(lcResRef, [this, &lcResRef]() { return doGet(lcResRef); });
 }
 
 std::shared_ptr<Model> Models::doGet(const std::string &resRef) {
-    debug("Load model " + resRef, LogChannel::Graphics);
+    if (isLogEnabled(LogSeverity::Debug, LogChannel::Graphics)) {
+        debug("Load model " + resRef, LogChannel::Graphics);
+    }
 
     auto mdlRes = _resources.find(ResourceId(resRef, ResourceType::Mdl));
     auto mdxRes = _resources.find(ResourceId(resRef, ResourceType::Mdx));
@@ -31,6 +31,7 @@
 #include "reone/graphics/uniforms.h"
 #include "reone/graphics/window.h"
 #include "reone/scene/node/light.h"
+#include "reone/system/profiler.h"
 #include "reone/system/randomutil.h"
 #include "reone/system/threadutil.h"
 
@@ -85,6 +86,17 @@ static std::vector<glm::vec4> computeFrustumCornersWorldSpace(const glm::mat4 &p
     return corners;
 }
 
+static std::vector<std::shared_ptr<Framebuffer>> initLayerFramebuffers(const std::shared_ptr<Texture> &depth, int numLayers) {
+    std::vector<std::shared_ptr<Framebuffer>> framebuffers;
+    for (int i = 0; i < numLayers; ++i) {
+        auto framebuffer = std::make_shared<Framebuffer>();
+        framebuffer->attachDepthLayer(depth, i);
+        framebuffer->init();
+        framebuffers.push_back(std::move(framebuffer));
+    }
+    return framebuffers;
+}
+
 static glm::mat4 computeDirectionalLightSpaceMatrix(
     float fov,
     float aspect,
@@ -236,6 +248,22 @@ void Pipeline::initAttachments(glm::ivec2 dim) {
     attachments.fbPointLightShadows->attachDepth(attachments.dbPointLightShadows);
     attachments.fbPointLightShadows->init();
 
+    // Static shadows framebuffer, point lights only
+
+    attachments.dbPointLightShadowsStatic = std::make_unique<Texture>("point_light_shadows_static", getTextureProperties(TextureUsage::DepthBuffer));
+    attachments.dbPointLightShadowsStatic->setCubemap(true);
+    attachments.dbPointLightShadowsStatic->clear(_options.shadowResolution, _options.shadowResolution, PixelFormat::Depth32F);
+    attachments.dbPointLightShadowsStatic->init();
+
+    attachments.fbPointLightShadowsStatic = std::make_shared<Framebuffer>();
+    attachments.fbPointLightShadowsStatic->attachDepth(attachments.dbPointLightShadowsStatic);
+    attachments.fbPointLightShadowsStatic->init();
+
+    // Per-layer shadows framebuffers, used to copy static shadows
+
+    attachments.fbPointLightShadowsLayers = initLayerFramebuffers(attachments.dbPointLightShadows, kNumCubeFaces);
+    attachments.fbPointLightShadowsStaticLayers = initLayerFramebuffers(attachments.dbPointLightShadowsStatic, kNumCubeFaces);
+
     // G-Buffer framebuffer
 
     attachments.cbGBufferDiffuse = std::make_unique<Texture>("gbuffer_color_diffuse", getTextureProperties(TextureUsage::ColorBuffer));
@@ -348,6 +376,8 @@ void Pipeline::initAttachments(glm::ivec2 dim) {
 }
 
 std::shared_ptr<Texture> Pipeline::draw(IScene &scene, const glm::ivec2 &dim) {
+    PROFILE_ZONE("Pipeline::draw");
+
     if (!scene.camera()) {
         return nullptr;
     }
@@ -430,12 +460,57 @@ void Pipeline::drawShadows(IScene &scene, Attachments &attachments) {
         }
     });
 
-    auto framebuffer = scene.isShadowLightDirectional() ? attachments.fbDirectionalLightShadows : attachments.fbPointLightShadows;
-    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, framebuffer->nameGL());
+    if (scene.isShadowLightDirectional()) {
+        // Shadow cascades follow the camera, therefore static shadows cannot be cached
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, attachments.fbDirectionalLightShadows->nameGL());
+        glDrawBuffer(GL_NONE);
+        _graphicsContext.withViewport(glm::ivec4(0, 0, _options.shadowResolution, _options.shadowResolution), [this, &scene]() {
+            _graphicsContext.clearDepth();
+            scene.drawShadows(_shadowLightSpace, kNumShadowCascades, ShadowCasters::All);
+        });
+        return;
+    }
+
+    drawStaticShadows(scene, attachments);
+
+    // Copy static shadows into the shadow map, then draw dynamic casters on top
+
+    for (int i = 0; i < kNumCubeFaces; ++i) {
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, attachments.fbPointLightShadowsStaticLayers[i]->nameGL());
+        glReadBuffer(GL_NONE);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, attachments.fbPointLightShadowsLayers[i]->nameGL());
+        glDrawBuffer(GL_NONE);
+        glBlitFramebuffer(
+            0, 0, _options.shadowResolution, _options.shadowResolution,
+            0, 0, _options.shadowResolution, _options.shadowResolution,
+            GL_DEPTH_BUFFER_BIT, GL_NEAREST);
+    }
+
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, attachments.fbPointLightShadows->nameGL());
+    glDrawBuffer(GL_NONE);
+    _graphicsContext.withViewport(glm::ivec4(0, 0, _options.shadowResolution, _options.shadowResolution), [this, &scene]() {
+        scene.drawShadows(_shadowLightSpace, kNumCubeFaces, ShadowCasters::Dynamic);
+    });
+}
+
+void Pipeline::drawStaticShadows(IScene &scene, Attachments &attachments) {
+    // Static shadows only need to be redrawn when either light space or static casters change
+    auto &cache = attachments.staticShadows;
+    bool valid = cache.scene == &scene &&
+                 cache.revision == scene.staticShadowsRevision() &&
+                 std::equal(cache.lightSpace, cache.lightSpace + kNumCubeFaces, _shadowLightSpace);
+    if (valid) {
+        return;
+    }
+    cache.scene = &scene;
+    cache.revision = scene.staticShadowsRevision();
+    std::copy(_shadowLightSpace, _shadowLightSpace + kNumCubeFaces, cache.lightSpace);
+
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, attachments.fbPointLightShadowsStatic->nameGL());
     glDrawBuffer(GL_NONE);
     _graphicsContext.withViewport(glm::ivec4(0, 0, _options.shadowResolution, _options.shadowResolution), [this, &scene]() {
         _graphicsContext.clearDepth();
-        scene.drawShadows();
+        scene.drawShadows(_shadowLightSpace, kNumCubeFaces, ShadowCasters::Static);
     });
 }
 
@@ -551,6 +626,8 @@ void Pipeline::drawCombineOpaque(IScene &scene, Attachments &attachments, Frameb
     _uniforms.setGeneral([this, &scene, &camera](auto &general) {
         general.resetGlobals();
         general.resetLocals();
+        general.projection = camera->projection();
+        general.view = camera->view();
         general.viewInv = glm::inverse(camera->view());
         general.cameraPosition = glm::vec4(camera->position(), 1.0f);
         general.worldAmbientColor = glm::vec4(scene.ambientLightColor(), 1.0f);
@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/graphics/renderqueue.h"
+
+#include "reone/graphics/mesh.h"
+#include "reone/graphics/texture.h"
+#include "reone/graphics/textures.h"
+
+namespace reone {
+
+namespace graphics {
+
+static constexpr int kNumTextureUnits = TextureUnits::shadowMapArray + 1;
+
+static constexpr int kPassBits = 4;
+static constexpr int kProgramBits = 8;
+static constexpr int kTextureSetBits = 20;
+static constexpr int kMeshBits = 16;
+static constexpr int kDepthBits = 16;
+
+static_assert(kPassBits + kProgramBits + kTextureSetBits + kMeshBits + kDepthBits == 64, "Sort key must be 64 bits long");
+
+static uint64_t truncateHash(size_t hash, int bits) {
+    return (static_cast<uint64_t>(hash) ^ (static_cast<uint64_t>(hash) >> bits)) & ((1ull << bits) - 1);
+}
+
+static bool isSameMaterial(const DrawLocals &left, const DrawLocals &right) {
+    return left.uv == right.uv &&
+           left.selfIllumColor == right.selfIllumColor &&
+           left.heightMapFrameBounds == right.heightMapFrameBounds &&
+           left.alpha == right.alpha &&
+           left.waterAlpha == right.waterAlpha &&
+           left.heightMapScaling == right.heightMapScaling &&
+           left.featureMask == right.featureMask &&
+           left.shadowLayerMask == right.shadowLayerMask;
+}
+
+static bool isInstanceOf(const DrawCommand &command, const DrawCommand &other) {
+    if (command.pass != other.pass ||
+        command.program != other.program ||
+        command.mesh != other.mesh ||
+        command.numBones > 0 ||
+        other.numBones > 0) {
+        return false;
+    }
+    for (int i = 0; i < kMaxDrawTextures; ++i) {
+        if (command.textures[i].texture != other.textures[i].texture ||
+            command.textures[i].unit != other.textures[i].unit) {
+            return false;
+        }
+    }
+    return isSameMaterial(command.locals, other.locals);
+}
+
+void DrawLocals::apply(GeneralUniforms &general) const {
+    general.resetLocals();
+    general.model = model;
+    general.modelInv = modelInv;
+    general.uv = uv;
+    general.selfIllumColor = selfIllumColor;
+    general.heightMapFrameBounds = heightMapFrameBounds;
+    general.alpha = alpha;
+    general.waterAlpha = waterAlpha;
+    general.heightMapScaling = heightMapScaling;
+    general.featureMask = featureMask;
+    general.shadowLayerMask = shadowLayerMask;
+}
+
+void RenderBackend::useProgram(ShaderProgramId program) {
+    _shaders.use(program);
+}
+
+void RenderBackend::bindTexture(Texture &texture, int unit) {
+    _textures.bind(texture, unit);
+}
+
+void RenderBackend::setLocals(const DrawLocals &locals) {
+    _uniforms.setGeneral([&locals](auto &general) {
+        locals.apply(general);
+    });
+}
+
+void RenderBackend::setBones(const glm::mat4 *bones, int count) {
+    _uniforms.setSkeletal([bones, count](auto &skeletal) {
+        std::copy(bones, bones + count, skeletal.bones);
+    });
+}
+
+void RenderBackend::setInstances(const glm::mat4 *models, const glm::mat4 *modelsInv, int count) {
+    _uniforms.setInstances([models, modelsInv, count](auto &instances) {
+        std::copy(models, models + count, instances.models);
+        std::copy(modelsInv, modelsInv + count, instances.modelsInv);
+    });
+}
+
+void RenderBackend::drawMesh(Mesh &mesh) {
+    mesh.draw();
+}
+
+void RenderBackend::drawMeshInstanced(Mesh &mesh, int count) {
+    mesh.drawInstanced(count);
+}
+
+void RenderQueue::clear() {
+    _commands.clear();
+    _bones.clear();
+    _entries.clear();
+}
+
+void RenderQueue::add(const DrawCommand &command, const glm::mat4 *bones) {
+    auto entry = Entry();
+    entry.key = makeKey(command);
+    entry.command = static_cast<uint32_t>(_commands.size());
+    entry.bones = static_cast<uint32_t>(_bones.size());
+    _entries.push_back(std::move(entry));
+    _commands.push_back(command);
+    if (bones && command.numBones > 0) {
+        _bones.insert(_bones.end(), bones, bones + command.numBones);
+    }
+}
+
+void RenderQueue::sort() {
+    std::stable_sort(_entries.begin(), _entries.end(), [](auto &left, auto &right) {
+        return left.key < right.key;
+    });
+}
+
+int RenderQueue::submit(RenderPass pass, IRenderBackend &backend) const {
+    auto program = ShaderProgramId::None;
+    Texture *boundTextures[kNumTextureUnits] {nullptr};
+    glm::mat4 models[kMaxInstances];
+    glm::mat4 modelsInv[kMaxInstances];
+    int numDrawCalls = 0;
+
+    for (size_t i = 0; i < _entries.size();) {
+        auto &entry = _entries[i];
+        auto &command = _commands[entry.command];
+        if (command.pass != pass) {
+            ++i;
+            continue;
+        }
+        size_t end = i + 1;
+        while (end < _entries.size() && end - i < kMaxInstances && isInstanceOf(command, _commands[_entries[end].command])) {
+            ++end;
+        }
+        int numInstances = static_cast<int>(end - i);
+
+        for (auto &texture : command.textures) {
+            if (!texture.texture || boundTextures[texture.unit] == texture.texture) {
+                continue;
+            }
+            backend.bindTexture(*texture.texture, texture.unit);
+            boundTextures[texture.unit] = texture.texture;
+        }
+        if (numInstances > 1) {
+            for (int j = 0; j < numInstances; ++j) {
+                auto &locals = _commands[_entries[i + j].command].locals;
+                models[j] = locals.model;
+                modelsInv[j] = locals.modelInv;
+            }
+            backend.setInstances(models, modelsInv, numInstances);
+            auto locals = command.locals;
+            locals.featureMask |= UniformsFeatureFlags::instanced;
+            backend.setLocals(locals);
+        } else {
+            backend.setLocals(command.locals);
+            if (command.numBones > 0) {
+                backend.setBones(&_bones[entry.bones], command.numBones);
+            }
+        }
+        if (program != command.program) {
+            backend.useProgram(command.program);
+            program = command.program;
+        }
+        if (numInstances > 1) {
+            backend.drawMeshInstanced(*command.mesh, numInstances);
+        } else {
+            backend.drawMesh(*command.mesh);
+        }
+        ++numDrawCalls;
+        i = end;
+    }
+
+    return numDrawCalls;
+}
+
+void RenderQueue::submit(const DrawCommand &command, const glm::mat4 *bones, IRenderBackend &backend) {
+    for (auto &texture : command.textures) {
+        if (texture.texture) {
+            backend.bindTexture(*texture.texture, texture.unit);
+        }
+    }
+    backend.setLocals(command.locals);
+    if (bones && command.numBones > 0) {
+        backend.setBones(bones, command.numBones);
+    }
+    backend.useProgram(command.program);
+    backend.drawMesh(*command.mesh);
+}
+
+uint64_t RenderQueue::makeKey(const DrawCommand &command) {
+    size_t textureSet = 0;
+    for (auto &texture : command.textures) {
+        boost::hash_combine(textureSet, texture.texture);
+    }
+    auto mesh = std::hash<Mesh *>()(command.mesh);
+    auto depth = static_cast<uint64_t>(glm::clamp(command.depth, 0.0f, 1.0f) * ((1 << kDepthBits) - 1));
+
+    uint64_t key = static_cast<uint64_t>(command.pass);
+    key = (key << kProgramBits) | static_cast<uint64_t>(command.program);
+    key = (key << kTextureSetBits) | truncateHash(textureSet, kTextureSetBits);
+    key = (key << kMeshBits) | truncateHash(mesh, kMeshBits);
+    key = (key << kDepthBits) | depth;
+    return key;
+}
+
+} // namespace graphics
+
+} // namespace reone
@@ -40,12 +40,12 @@ static const std::string kResRefShadowMap = "shadowmap";
 
 static const std::string kResRefUniformsGeneral = "u_general";
 static const std::string kResRefUniformsGrass = "u_grass";
+static const std::string kResRefUniformsInstances = "u_instances";
 static const std::string kResRefUniformsLighting = "u_lighting";
 static const std::string kResRefUniformsParticle = "u_particle";
 static const std::string kResRefUniformsPoints = "u_points";
 static const std::string kResRefUniformsSkeletal = "u_skeletal";
 static const std::string kResRefUniformsSSAO = "u_ssao";
-static const std::string kResRefUniformsText = "u_text";
 static const std::string kResRefUniformsWalkmesh = "u_walkmesh";
 
 static const std::string kResRefVertexBillboard = "v_billboard";
@@ -56,7 +56,7 @@ static const std::string kResRefVertexObjectSpace = "v_objectspace";
 static const std::string kResRefVertexParticle = "v_particle";
 static const std::string kResRefVertexPoints = "v_points";
 static const std::string kResRefVertexShadows = "v_shadows";
-static const std::string kResRefVertexText = "v_text";
+static const std::string kResRefVertexSprite = "v_sprite";
 static const std::string kResRefVertexWalkmesh = "v_walkmesh";
 
 static const std::string kResRefGeometryDirLightShadows = "g_dirlightshadow";
@@ -81,9 +81,9 @@ static const std::string kResRefFragmentModelTransparent = "f_modeltransp";
 static const std::string kResRefFragmentParticle = "f_particle";
 static const std::string kResRefFragmentPointLightShadows = "f_ptlightshadow";
 static const std::string kResRefFragmentSharpen = "f_sharpen";
+static const std::string kResRefFragmentSprite = "f_sprite";
 static const std::string kResRefFragmentSSAO = "f_ssao";
 static const std::string kResRefFragmentSSR = "f_ssr";
-static const std::string kResRefFragmentText = "f_text";
 static const std::string kResRefFragmentTexture = "f_texture";
 static const std::string kResRefFragmentWalkmesh = "f_walkmesh";
 
@@ -103,20 +103,20 @@ void Shaders::init() {
     // Shaders
     auto vsObjectSpace = initShader(ShaderType::Vertex, {kResRefVertexObjectSpace});
     auto vsClipSpace = initShader(ShaderType::Vertex, {kResRefUniformsGeneral, kResRefVertexClipSpace});
-    auto vsShadows = initShader(ShaderType::Vertex, {kResRefUniformsGeneral, kResRefVertexShadows});
-    auto vsModel = initShader(ShaderType::Vertex, {kResRefUniformsGeneral, kResRefUniformsSkeletal, kResRefVertexModel});
+    auto vsShadows = initShader(ShaderType::Vertex, {kResRefUniformsGeneral, kResRefUniformsInstances, kResRefVertexShadows});
+    auto vsModel = initShader(ShaderType::Vertex, {kResRefUniformsGeneral, kResRefUniformsSkeletal, kResRefUniformsInstances, kResRefVertexModel});
     auto vsWalkmesh = initShader(ShaderType::Vertex, {kResRefUniformsGeneral, kResRefUniformsWalkmesh, kResRefVertexWalkmesh});
     auto vsBillboard = initShader(ShaderType::Vertex, {kResRefUniformsGeneral, kResRefVertexBillboard});
     auto vsParticle = initShader(ShaderType::Vertex, {kResRefUniformsGeneral, kResRefUniformsParticle, kResRefVertexParticle});
     auto vsGrass = initShader(ShaderType::Vertex, {kResRefUniformsGeneral, kResRefUniformsGrass, kResRefVertexGrass});
-    auto vsText = initShader(ShaderType::Vertex, {kResRefUniformsGeneral, kResRefUniformsText, kResRefVertexText});
+    auto vsSprite = initShader(ShaderType::Vertex, {kResRefUniformsGeneral, kResRefVertexSprite});
     auto vsPoints = initShader(ShaderType::Vertex, {kResRefUniformsGeneral, kResRefUniformsPoints, kResRefVertexPoints});
     auto gsPointLightShadows = initShader(ShaderType::Geometry, {kResRefUniformsGeneral, kResRefGeometryPointLightShadows});
     auto gsDirectionalLightShadows = initShader(ShaderType::Geometry, {kResRefUniformsGeneral, kResRefGeometryDirLightShadows});
     auto fsColor = initShader(ShaderType::Fragment, {kResRefUniformsGeneral, kResRefFragmentColor});
     auto fsTexture = initShader(ShaderType::Fragment, {kResRefUniformsGeneral, kResRefFragmentTexture});
     auto fsGUI = initShader(ShaderType::Fragment, {kResRefUniformsGeneral, kResRefFragmentGUI});
-    auto fsText = initShader(ShaderType::Fragment, {kResRefUniformsGeneral, kResRefUniformsText, kResRefFragmentText});
+    auto fsSprite = initShader(ShaderType::Fragment, {kResRefUniformsGeneral, kResRefFragmentSprite});
     auto fsPointLightShadows = initShader(ShaderType::Fragment, {kResRefUniformsGeneral, kResRefFragmentPointLightShadows});
     auto fsDirectionalLightShadows = initShader(ShaderType::Fragment, {kResRefFragmentDirLightShadows});
     auto fsModelOpaque = initShader(ShaderType::Fragment, {kResRefUniformsGeneral, kResRefMath, kResRefHash, kResRefHashedAlphaTest, kResRefEnvMap, kResRefNormalMap, kResRefFragmentModelOpaque});
@@ -142,7 +142,7 @@ void Shaders::init() {
     _spSimpleColor = initShaderProgram({vsClipSpace, fsColor});
     _spSimpleTexture = initShaderProgram({vsClipSpace, fsTexture});
     _spGUI = initShaderProgram({vsClipSpace, fsGUI});
-    _spText = initShaderProgram({vsText, fsText});
+    _spSprite = initShaderProgram({vsSprite, fsSprite});
     _spPoints = initShaderProgram({vsPoints, fsColor});
     _spPointLightShadows = initShaderProgram({vsShadows, gsPointLightShadows, fsPointLightShadows});
     _spDirectionalLightShadows = initShaderProgram({vsShadows, gsDirectionalLightShadows, fsDirectionalLightShadows});
@@ -176,7 +176,7 @@ void Shaders::deinit() {
     _spSimpleColor.reset();
     _spSimpleTexture.reset();
     _spGUI.reset();
-    _spText.reset();
+    _spSprite.reset();
     _spPoints.reset();
     _spPointLightShadows.reset();
     _spDirectionalLightShadows.reset();
@@ -272,8 +272,8 @@ std::shared_ptr<ShaderProgram> Shaders::initShaderProgram(std::vector<std::share
     program->setUniform("sShadowMap", TextureUnits::shadowMapArray);
 
     // Uniform Blocks
-    program->bindUniformBlock("General", UniformBlockBindingPoints::general);
-    program->bindUniformBlock("Text", UniformBlockBindingPoints::text);
+    program->bindUniformBlock("Globals", UniformBlockBindingPoints::general);
+    program->bindUniformBlock("Locals", UniformBlockBindingPoints::locals);
     program->bindUniformBlock("Lighting", UniformBlockBindingPoints::lighting);
     program->bindUniformBlock("Skeletal", UniformBlockBindingPoints::skeletal);
     program->bindUniformBlock("Particles", UniformBlockBindingPoints::particles);
@@ -281,6 +281,7 @@ std::shared_ptr<ShaderProgram> Shaders::initShaderProgram(std::vector<std::share
     program->bindUniformBlock("SSAO", UniformBlockBindingPoints::ssao);
     program->bindUniformBlock("Walkmesh", UniformBlockBindingPoints::walkmesh);
     program->bindUniformBlock("Points", UniformBlockBindingPoints::points);
+    program->bindUniformBlock("Instances", UniformBlockBindingPoints::instances);
 
     return program;
 }
@@ -293,8 +294,8 @@ ShaderProgram &Shaders::getProgram(ShaderProgramId id) {
         return *_spSimpleTexture;
     case ShaderProgramId::GUI:
         return *_spGUI;
-    case ShaderProgramId::Text:
-        return *_spText;
+    case ShaderProgramId::Sprite:
+        return *_spSprite;
     case ShaderProgramId::Points:
         return *_spPoints;
     case ShaderProgramId::PointLightShadows:
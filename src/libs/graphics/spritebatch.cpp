@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/graphics/spritebatch.h"
+
+#include "reone/graphics/context.h"
+#include "reone/graphics/shaders.h"
+#include "reone/graphics/textures.h"
+#include "reone/graphics/uniforms.h"
+#include "reone/graphics/window.h"
+#include "reone/system/threadutil.h"
+
+namespace reone {
+
+namespace graphics {
+
+void Sprite::transformUV(const glm::mat3x4 &transform) {
+    for (auto &corner : uv) {
+        corner = glm::vec2(transform * glm::vec3(corner, 1.0f));
+    }
+}
+
+void SpriteBatch::init() {
+    if (_inited) {
+        return;
+    }
+    checkMainThread();
+
+    std::vector<uint16_t> indices;
+    indices.reserve(6 * kMaxSprites);
+    for (int i = 0; i < kMaxSprites; ++i) {
+        auto base = static_cast<uint16_t>(4 * i);
+        indices.push_back(base + 0);
+        indices.push_back(base + 1);
+        indices.push_back(base + 2);
+        indices.push_back(base + 2);
+        indices.push_back(base + 3);
+        indices.push_back(base + 0);
+    }
+
+    glGenBuffers(1, &_vboId);
+    glGenBuffers(1, &_iboId);
+    glGenVertexArrays(1, &_vaoId);
+    glBindVertexArray(_vaoId);
+    glBindBuffer(GL_ARRAY_BUFFER, _vboId);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _iboId);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(uint16_t), &indices[0], GL_STATIC_DRAW);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<void *>(offsetof(Vertex, position)));
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<void *>(offsetof(Vertex, uv)));
+    glEnableVertexAttribArray(3);
+    glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<void *>(offsetof(Vertex, color)));
+    glBindVertexArray(0);
+
+    _inited = true;
+}
+
+void SpriteBatch::deinit() {
+    if (!_inited) {
+        return;
+    }
+    checkMainThread();
+    glDeleteVertexArrays(1, &_vaoId);
+    glDeleteBuffers(1, &_iboId);
+    glDeleteBuffers(1, &_vboId);
+    _inited = false;
+}
+
+void SpriteBatch::begin() {
+    ++_depth;
+}
+
+void SpriteBatch::end() {
+    if (_depth == 0) {
+        throw std::logic_error("Sprite batch has not begun");
+    }
+    if (--_depth == 0) {
+        flush();
+    }
+}
+
+void SpriteBatch::draw(const SpriteMaterial &material, const Sprite &sprite) {
+    append(material, sprite);
+    if (_depth == 0) {
+        flush();
+    }
+}
+
+void SpriteBatch::draw(const SpriteMaterial &material, const std::vector<Sprite> &sprites) {
+    for (auto &sprite : sprites) {
+        append(material, sprite);
+    }
+    if (_depth == 0) {
+        flush();
+    }
+}
+
+void SpriteBatch::append(const SpriteMaterial &material, const Sprite &sprite) {
+    if (!material.texture) {
+        throw std::invalid_argument("material texture must not be null");
+    }
+    if (numPendingSprites() == kMaxSprites) {
+        flush();
+    }
+    if (_segments.empty() || _segments.back().material != material) {
+        Segment segment;
+        segment.material = material;
+        segment.firstSprite = numPendingSprites();
+        _segments.push_back(std::move(segment));
+    }
+    ++_segments.back().numSprites;
+
+    float left = sprite.bounds[0];
+    float top = sprite.bounds[1];
+    float right = left + sprite.bounds[2];
+    float bottom = top + sprite.bounds[3];
+    _vertices.push_back(Vertex {glm::vec2(left, top), sprite.uv[0], sprite.color});
+    _vertices.push_back(Vertex {glm::vec2(right, top), sprite.uv[1], sprite.color});
+    _vertices.push_back(Vertex {glm::vec2(right, bottom), sprite.uv[2], sprite.color});
+    _vertices.push_back(Vertex {glm::vec2(left, bottom), sprite.uv[3], sprite.color});
+}
+
+void SpriteBatch::flush() {
+    if (_segments.empty()) {
+        return;
+    }
+    init();
+
+    glBindVertexArray(_vaoId);
+    glBindBuffer(GL_ARRAY_BUFFER, _vboId);
+    glBufferData(GL_ARRAY_BUFFER, _vertices.size() * sizeof(Vertex), &_vertices[0], GL_STREAM_DRAW);
+
+    _shaders.use(ShaderProgramId::Sprite);
+    auto projection = _window.getOrthoProjection();
+    for (auto &segment : _segments) {
+        auto &material = segment.material;
+        _textures.bind(*material.texture);
+        _uniforms.setGeneral([&projection, &material](auto &general) {
+            general.resetLocals();
+            general.projection = projection;
+            general.featureMask = material.discard ? UniformsFeatureFlags::discard : 0;
+            general.discardColor = glm::vec4(material.discardColor, 1.0f);
+        });
+        _graphicsContext.withBlending(material.blendMode, [&segment]() {
+            glDrawElements(
+                GL_TRIANGLES,
+                6 * segment.numSprites,
+                GL_UNSIGNED_SHORT,
+                reinterpret_cast<void *>(6 * segment.firstSprite * sizeof(uint16_t)));
+        });
+    }
+    glBindVertexArray(0);
+
+    _vertices.clear();
+    _segments.clear();
+}
+
+} // namespace graphics
+
+} // namespace reone
@@ -135,6 +135,7 @@ void Texture::bind() {
         init();
     }
     glBindTexture(getTargetGL(), _nameGL);
+    _bound = true;
 }
 
 void Texture::unbind() {
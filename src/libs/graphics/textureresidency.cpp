@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/graphics/textureresidency.h"
+
+namespace reone {
+
+namespace graphics {
+
+int TextureResidency::add(int size, std::vector<size_t> levelSizes, int residentLevel) {
+    if (levelSizes.empty()) {
+        throw std::invalid_argument("levelSizes must not be empty");
+    }
+    if (residentLevel < 0 || residentLevel >= static_cast<int>(levelSizes.size())) {
+        throw std::out_of_range("residentLevel out of range: " + std::to_string(residentLevel));
+    }
+    Entry entry;
+    entry.size = size;
+    entry.chainSizes.resize(levelSizes.size());
+    size_t chainSize = 0;
+    for (int i = static_cast<int>(levelSizes.size()) - 1; i >= 0; --i) {
+        chainSize += levelSizes[i];
+        entry.chainSizes[i] = chainSize;
+    }
+    entry.minResidentLevel = residentLevel;
+    entry.residentLevel = residentLevel;
+    entry.wantedLevel = residentLevel;
+    entry.lastRequestFrame = _frame;
+
+    int id = _nextId++;
+    _entries[id] = std::move(entry);
+    return id;
+}
+
+void TextureResidency::remove(int id) {
+    _entries.erase(id);
+}
+
+void TextureResidency::request(int id, float screenSize) {
+    auto &entry = _entries.at(id);
+    entry.screenSize = std::max(entry.screenSize, screenSize);
+    entry.requested = true;
+}
+
+void TextureResidency::requestFullResolution(int id) {
+    request(id, static_cast<float>(_entries.at(id).size));
+}
+
+std::vector<TextureResidency::Transition> TextureResidency::update() {
+    ++_frame;
+
+    size_t committed = 0;
+    size_t releasing = 0;
+    int numPending = 0;
+    std::vector<std::pair<int, Entry *>> upgrades;
+    std::vector<std::pair<int, Entry *>> evictions;
+
+    for (auto &[id, entry] : _entries) {
+        entry.wantedLevel = getWantedLevel(entry);
+        if (entry.requested) {
+            entry.lastRequestFrame = _frame;
+        }
+        entry.screenSize = 0.0f;
+        entry.requested = false;
+
+        committed += entry.committedBytes();
+        if (entry.pendingLevel != -1) {
+            ++numPending;
+            if (entry.pendingLevel > entry.residentLevel) {
+                releasing += entry.chainSizes[entry.residentLevel] - entry.chainSizes[entry.pendingLevel];
+            }
+        } else if (entry.wantedLevel < entry.residentLevel) {
+            upgrades.push_back(std::make_pair(id, &entry));
+        } else if (entry.wantedLevel > entry.residentLevel) {
+            evictions.push_back(std::make_pair(id, &entry));
+        }
+    }
+
+    std::stable_sort(upgrades.begin(), upgrades.end(), [](auto &left, auto &right) {
+        int leftMissing = left.second->residentLevel - left.second->wantedLevel;
+        int rightMissing = right.second->residentLevel - right.second->wantedLevel;
+        if (leftMissing != rightMissing) {
+            return leftMissing > rightMissing;
+        }
+        return left.second->size >> left.second->wantedLevel > right.second->size >> right.second->wantedLevel;
+    });
+    std::stable_sort(evictions.begin(), evictions.end(), [](auto &left, auto &right) {
+        if (left.second->lastRequestFrame != right.second->lastRequestFrame) {
+            return left.second->lastRequestFrame < right.second->lastRequestFrame;
+        }
+        return left.second->wantedLevel - left.second->residentLevel > right.second->wantedLevel - right.second->residentLevel;
+    });
+
+    std::vector<Transition> transitions;
+
+    // Upgrade to the finest level that fits into the budget. Textures that do
+    // not fit make room for themselves by evicting others.
+
+    size_t unmet = 0;
+    for (auto &[id, entry] : upgrades) {
+        if (numPending >= _maxPendingTransitions) {
+            break;
+        }
+        size_t resident = entry->chainSizes[entry->residentLevel];
+        int level = entry->wantedLevel;
+        while (level < entry->residentLevel && committed - resident + entry->chainSizes[level] > _budget) {
+            ++level;
+        }
+        if (level < entry->residentLevel) {
+            committed += entry->chainSizes[level] - resident;
+            entry->pendingLevel = level;
+            transitions.push_back(Transition {id, level});
+            ++numPending;
+        }
+        unmet += entry->chainSizes[entry->wantedLevel] - entry->chainSizes[level];
+    }
+
+    // Evict until pending evictions release enough memory to satisfy all
+    // upgrades, or the excess of textures added at their minimum level
+
+    size_t excess = committed + unmet > _budget ? committed + unmet - _budget : 0;
+    for (auto &[id, entry] : evictions) {
+        if (releasing >= excess || numPending >= _maxPendingTransitions) {
+            break;
+        }
+        releasing += entry->chainSizes[entry->residentLevel] - entry->chainSizes[entry->wantedLevel];
+        entry->pendingLevel = entry->wantedLevel;
+        transitions.push_back(Transition {id, entry->wantedLevel});
+        ++numPending;
+    }
+
+    return transitions;
+}
+
+void TextureResidency::complete(int id, int level) {
+    auto it = _entries.find(id);
+    if (it == _entries.end()) {
+        return;
+    }
+    it->second.residentLevel = level;
+    it->second.pendingLevel = -1;
+}
+
+void TextureResidency::cancel(int id) {
+    auto it = _entries.find(id);
+    if (it == _entries.end()) {
+        return;
+    }
+    it->second.pendingLevel = -1;
+}
+
+int TextureResidency::residentLevel(int id) const {
+    return _entries.at(id).residentLevel;
+}
+
+int TextureResidency::pendingLevel(int id) const {
+    return _entries.at(id).pendingLevel;
+}
+
+size_t TextureResidency::committedBytes() const {
+    size_t bytes = 0;
+    for (auto &[_, entry] : _entries) {
+        bytes += entry.committedBytes();
+    }
+    return bytes;
+}
+
+int TextureResidency::numPendingTransitions() const {
+    return static_cast<int>(std::count_if(_entries.begin(), _entries.end(), [](auto &pair) {
+        return pair.second.pendingLevel != -1;
+    }));
+}
+
+int TextureResidency::getWantedLevel(const Entry &entry) const {
+    if (!entry.requested) {
+        return entry.minResidentLevel;
+    }
+    int level = 0;
+    float size = static_cast<float>(entry.size);
+    while (level < entry.minResidentLevel && 0.5f * size >= entry.screenSize) {
+        size *= 0.5f;
+        ++level;
+    }
+    return level;
+}
+
+} // namespace graphics
+
+} // namespace reone
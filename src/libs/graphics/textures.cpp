@@ -17,6 +17,7 @@
 
 #include "reone/graphics/textures.h"
 
+#include "reone/graphics/assetcacheutil.h"
 #include "reone/graphics/format/curreader.h"
 #include "reone/graphics/format/tgareader.h"
 #include "reone/graphics/format/tpcreader.h"
@@ -25,7 +26,9 @@
 #include "reone/graphics/texture.h"
 #include "reone/graphics/textureutil.h"
 #include "reone/graphics/types.h"
+#include "reone/resource/assetcache.h"
 #include "reone/resource/resources.h"
+#include "reone/system/binaryreader.h"
 #include "reone/system/logutil.h"
 #include "reone/system/randomutil.h"
 #include "reone/system/stream/memoryinput.h"
@@ -37,9 +40,34 @@ namespace reone {
 
 namespace graphics {
 
+static constexpr int kStreamingMinResidentSize = 64;
+static constexpr int kMaxPendingStreamingLoads = 4;
+
+static bool isStreamable(TextureUsage usage) {
+    return usage == TextureUsage::Diffuse || usage == TextureUsage::Lightmap;
+}
+
+static bool isCubemapTpc(ByteBuffer &tpcBytes) {
+    if (tpcBytes.size() < 12) {
+        return false;
+    }
+    auto tpc = MemoryInputStream(tpcBytes);
+    auto reader = BinaryReader(tpc);
+    reader.seek(8);
+    uint16_t width = reader.readUint16();
+    uint16_t height = reader.readUint16();
+    return width > 0 && height / width == kNumCubeFaces;
+}
+
 void Textures::init() {
     checkMainThread();
 
+    if (_options.textureStreamingBudget > 0) {
+        size_t budget = static_cast<size_t>(_options.textureStreamingBudget) * 1024 * 1024;
+        _residency = std::make_unique<TextureResidency>(budget, kMaxPendingStreamingLoads);
+        _streamingPool.init();
+    }
+
     _default2DRGB = std::make_shared<Texture>("default_rgb", getTextureProperties(TextureUsage::Default));
     _default2DRGB->clear(1, 1, PixelFormat::RGB8);
     _default2DRGB->init();
@@ -94,9 +122,88 @@ void Textures::init() {
 }
 
 void Textures::clear() {
+    cancelStreaming();
     _cache.clear();
 }
 
+void Textures::cancelStreaming() {
+    if (!_residency) {
+        return;
+    }
+    checkMainThread();
+
+    for (auto &[id, task] : _streamingTasks) {
+        task->cancel();
+    }
+    // Wait for the load in progress, canceled loads are reported on next update
+    std::lock_guard<std::mutex> lock(_streamingMutex);
+}
+
+void Textures::update() {
+    if (!_residency) {
+        return;
+    }
+    checkMainThread();
+
+    std::vector<StreamedLevel> loadedLevels;
+    {
+        std::lock_guard<std::mutex> lock(_loadedLevelsMutex);
+        loadedLevels.swap(_loadedLevels);
+    }
+
+    std::lock_guard<std::mutex> lock(_streamedMutex);
+
+    for (auto &loaded : loadedLevels) {
+        _streamingTasks.erase(loaded.id);
+        auto it = _streamed.find(loaded.id);
+        if (it == _streamed.end()) {
+            continue;
+        }
+        if (loaded.canceled) {
+            _residency->cancel(loaded.id);
+            continue;
+        }
+        auto texture = it->second.texture.lock();
+        if (!texture || !loaded.texture) {
+            _residency->remove(loaded.id);
+            _streamed.erase(it);
+            continue;
+        }
+        texture->setPixels(
+            loaded.texture->width(),
+            loaded.texture->height(),
+            loaded.texture->pixelFormat(),
+            std::move(loaded.texture->layers()));
+        // Texture is uploaded again when next bound
+        texture->deinit();
+        _residency->complete(loaded.id, loaded.level);
+    }
+
+    for (auto it = _streamed.begin(); it != _streamed.end();) {
+        auto texture = it->second.texture.lock();
+        if (!texture) {
+            _residency->remove(it->first);
+            it = _streamed.erase(it);
+            continue;
+        }
+        if (texture->requestedScreenSize() > 0.0f) {
+            _residency->request(it->first, texture->requestedScreenSize());
+        } else if (texture->isBound()) {
+            _residency->requestFullResolution(it->first);
+        }
+        texture->resetUsage();
+        ++it;
+    }
+
+    for (auto &transition : _residency->update()) {
+        auto &streamed = _streamed.at(transition.id);
+        int maxBaseSize = std::max(1, streamed.size >> transition.level);
+        _streamingTasks[transition.id] = _streamingPool.enqueue([this, id = transition.id, resRef = streamed.resRef, usage = streamed.usage, maxBaseSize](auto &canceled) {
+            loadStreamedLevel(id, resRef, usage, maxBaseSize, canceled);
+        });
+    }
+}
+
 void Textures::bind(Texture &texture, int unit) {
     if (_activeUnit != unit) {
         glActiveTexture(GL_TEXTURE0 + unit);
@@ -131,14 +238,8 @@ std::shared_ptr<Texture> Textures::get(const std::string &resRef, TextureUsage u
     if (resRef.empty()) {
         return nullptr;
     }
-    auto maybeTexture = _cache.find(resRef);
-    if (maybeTexture != _cache.end()) {
-        return maybeTexture->second;
-    }
     std::string lcResRef(boost::to_lower_copy(resRef));
-    auto inserted = _cache.insert(std::make_pair(lcResRef, doGet(lcResRef, usage)));
-
-    return inserted.first->second;
+    return _cache.getOrAdd(lcResRef, [this, &lcResRef, usage]() { return doGet(lcResRef, usage); });
 }
 
 std::shared_ptr<Texture> Textures::doGet(const std::string &resRef, TextureUsage usage) {
@@ -146,18 +247,35 @@ std::shared_ptr<Texture> Textures::doGet(const std::string &resRef, TextureUsage
 
     auto tgaRes = _resources.find(ResourceId(resRef, ResourceType::Tga));
     if (tgaRes) {
-        auto tga = MemoryInputStream(tgaRes->data);
-        auto tgaReader = TgaReader(tga, resRef, usage);
-        tgaReader.load();
-        texture = tgaReader.texture();
-
-        if (texture) {
-            auto txiRes = _resources.find(ResourceId(resRef, ResourceType::Txi));
+        auto txiRes = _resources.find(ResourceId(resRef, ResourceType::Txi));
+        auto tgaId = ResourceId(resRef, ResourceType::Tga);
+        uint64_t hash = 0;
+        if (_assetCache.isEnabled()) {
+            hash = hashBytes(tgaRes->data);
             if (txiRes) {
-                auto txi = MemoryInputStream(txiRes->data);
-                auto txiReader = TxiReader();
-                txiReader.load(txi);
-                texture->setFeatures(txiReader.features());
+                hash = hashBytes(txiRes->data, hash);
+            }
+            texture = findCached(tgaId, hash, usage);
+        }
+        if (!texture) {
+            auto tga = MemoryInputStream(tgaRes->data);
+            auto tgaReader = TgaReader(tga, resRef, usage);
+            tgaReader.load();
+            texture = tgaReader.texture();
+
+            if (texture) {
+                if (txiRes) {
+                    auto txi = MemoryInputStream(txiRes->data);
+                    auto txiReader = TxiReader();
+                    txiReader.load(txi);
+                    texture->setFeatures(txiReader.features());
+                }
+                if (texture->isCubemap()) {
+                    prepareCubemap(*texture);
+                }
+                if (_assetCache.isEnabled()) {
+                    _assetCache.add(tgaId, hash, writeTextureBlob(*texture));
+                }
             }
         }
     }
@@ -165,17 +283,34 @@ std::shared_ptr<Texture> Textures::doGet(const std::string &resRef, TextureUsage
     if (!texture) {
         auto tpcRes = _resources.find(ResourceId(resRef, ResourceType::Tpc));
         if (tpcRes) {
-            auto tpc = MemoryInputStream(tpcRes->data);
-            auto tpcReader = TpcReader(tpc, resRef, usage);
-            tpcReader.load();
-            texture = tpcReader.texture();
+            // Only cubemaps are cached, as other TPC textures need no processing
+            auto tpcId = ResourceId(resRef, ResourceType::Tpc);
+            bool cacheable = _assetCache.isEnabled() && isCubemapTpc(tpcRes->data);
+            uint64_t hash = 0;
+            if (cacheable) {
+                hash = hashBytes(tpcRes->data);
+                texture = findCached(tpcId, hash, usage);
+            }
+            if (!texture) {
+                bool streamed = _residency && isStreamable(usage);
+                auto tpc = MemoryInputStream(tpcRes->data);
+                auto tpcReader = TpcReader(tpc, resRef, usage, streamed ? kStreamingMinResidentSize : 0);
+                tpcReader.load();
+                texture = tpcReader.texture();
+                if (streamed && tpcReader.mipLevel() > 0) {
+                    addStreamed(tpcReader, usage);
+                }
+                if (texture->isCubemap()) {
+                    prepareCubemap(*texture);
+                    if (cacheable && tpcReader.mipLevel() == 0) {
+                        _assetCache.add(tpcId, hash, writeTextureBlob(*texture));
+                    }
+                }
+            }
         }
     }
 
     if (texture) {
-        if (texture->isCubemap()) {
-            prepareCubemap(*texture);
-        }
         float anisotropy = std::max(1.0f, exp2f(_options.anisotropicFiltering));
         texture->setAnisotropy(anisotropy);
     } else {
@@ -185,6 +320,65 @@ std::shared_ptr<Texture> Textures::doGet(const std::string &resRef, TextureUsage
     return texture;
 }
 
+std::shared_ptr<Texture> Textures::findCached(const ResourceId &id, uint64_t sourceHash, TextureUsage usage) {
+    auto blob = _assetCache.find(id, sourceHash);
+    if (!blob) {
+        return nullptr;
+    }
+    try {
+        return readTextureBlob(*blob, id.resRef, usage);
+    } catch (const std::exception &e) {
+        warn(boost::format("Error reading cached texture %s: %s") % id.string() % std::string(e.what()), LogChannel::Graphics);
+        return nullptr;
+    }
+}
+
+void Textures::addStreamed(const TpcReader &tpc, TextureUsage usage) {
+    auto texture = tpc.texture();
+    int numLayers = static_cast<int>(texture->layers().size());
+    std::vector<size_t> levelSizes;
+    for (int i = 0; i < tpc.numMipMaps(); ++i) {
+        int width = std::max(1, tpc.width() >> i);
+        int height = std::max(1, tpc.height() >> i);
+        levelSizes.push_back(numLayers * getPixelDataSize(width, height, texture->pixelFormat()));
+    }
+    int size = std::max(tpc.width(), tpc.height());
+
+    std::lock_guard<std::mutex> lock(_streamedMutex);
+    int id = _residency->add(size, std::move(levelSizes), tpc.mipLevel());
+    _streamed[id] = StreamedTexture {texture, texture->name(), usage, size};
+}
+
+void Textures::loadStreamedLevel(int id, std::string resRef, TextureUsage usage, int maxBaseSize, const std::atomic_bool &canceled) {
+    StreamedLevel loaded;
+    loaded.id = id;
+
+    std::lock_guard<std::mutex> streamingLock(_streamingMutex);
+    if (canceled) {
+        loaded.canceled = true;
+        std::lock_guard<std::mutex> lock(_loadedLevelsMutex);
+        _loadedLevels.push_back(std::move(loaded));
+        return;
+    }
+    try {
+        auto tpcRes = _resources.find(ResourceId(resRef, ResourceType::Tpc));
+        if (tpcRes) {
+            auto tpc = MemoryInputStream(tpcRes->data);
+            auto tpcReader = TpcReader(tpc, resRef, usage, maxBaseSize);
+            tpcReader.load();
+            loaded.level = tpcReader.mipLevel();
+            loaded.texture = tpcReader.texture();
+            if (loaded.texture->isCubemap()) {
+                prepareCubemap(*loaded.texture);
+            }
+        }
+    } catch (const std::exception &e) {
+        error(boost::format("Error streaming texture %s: %s") % resRef % std::string(e.what()), LogChannel::Graphics);
+    }
+    std::lock_guard<std::mutex> lock(_loadedLevelsMutex);
+    _loadedLevels.push_back(std::move(loaded));
+}
+
 } // namespace graphics
 
 } // namespace reone
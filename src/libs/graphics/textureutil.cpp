@@ -23,6 +23,8 @@ namespace reone {
 
 namespace graphics {
 
+static constexpr size_t kRotationTileSize = 32;
+
 static void decompressLayer(int width, int height, Texture::Layer &layer, PixelFormat srcFormat, PixelFormat &dstFormat) {
     if (!isCompressed(srcFormat)) {
         throw std::invalid_argument("format must be either DXT1 or DXT5");
@@ -30,61 +32,92 @@ static void decompressLayer(int width, int height, Texture::Layer &layer, PixelF
 
     size_t numPixels = static_cast<size_t>(width) * height;
     const uint8_t *srcPixels = reinterpret_cast<const uint8_t *>(layer.pixels->data());
-    std::vector<uint32_t> decompPixels(numPixels);
-    uint32_t *decompPixelsPtr = &decompPixels[0];
-    bool alpha;
+    bool alpha = srcFormat == PixelFormat::DXT5;
+    dstFormat = alpha ? PixelFormat::RGBA8 : PixelFormat::RGB8;
 
-    if (srcFormat == PixelFormat::DXT5) {
-        decompressDXT5(width, height, srcPixels, decompPixelsPtr);
-        alpha = true;
+    auto destPixels = std::make_shared<ByteBuffer>((alpha ? 4ll : 3ll) * numPixels, '\0');
+    uint8_t *destPixelsPtr = reinterpret_cast<uint8_t *>(destPixels->data());
+    if (alpha) {
+        decompressDXT5(width, height, srcPixels, dstFormat, destPixelsPtr);
     } else {
-        decompressDXT1(width, height, srcPixels, decompPixelsPtr);
-        alpha = false;
+        decompressDXT1(width, height, srcPixels, dstFormat, destPixelsPtr);
     }
 
-    auto destPixels = std::make_shared<ByteBuffer>((alpha ? 4ll : 3ll) * numPixels, '\0');
-    uint8_t *destPixelsPtr = reinterpret_cast<uint8_t *>(destPixels->data());
-    decompPixelsPtr = &decompPixels[0];
-
-    for (size_t i = 0; i < numPixels; ++i) {
-        unsigned long pixel = *(decompPixelsPtr++);
-        *(destPixelsPtr++) = (pixel >> 24) & 0xff;
-        *(destPixelsPtr++) = (pixel >> 16) & 0xff;
-        *(destPixelsPtr++) = (pixel >> 8) & 0xff;
-        if (alpha) {
-            *(destPixelsPtr++) = pixel & 0xff;
+    layer.pixels = std::move(destPixels);
+}
+
+/**
+ * Rotates a square image clockwise by the specified number of quarter turns in a single
+ * out-of-place pass. Destination is traversed in tiles to keep source reads cache friendly.
+ */
+template <int Bpp, int QuarterTurns>
+static void rotatePixels(size_t n, const uint8_t *src, uint8_t *dst) {
+    for (size_t tileY = 0; tileY < n; tileY += kRotationTileSize) {
+        size_t maxY = std::min(n, tileY + kRotationTileSize);
+        for (size_t tileX = 0; tileX < n; tileX += kRotationTileSize) {
+            size_t maxX = std::min(n, tileX + kRotationTileSize);
+            for (size_t y = tileY; y < maxY; ++y) {
+                for (size_t x = tileX; x < maxX; ++x) {
+                    size_t srcIdx;
+                    if (QuarterTurns == 1) {
+                        srcIdx = (n - 1 - x) * n + y;
+                    } else if (QuarterTurns == 2) {
+                        srcIdx = (n - 1 - y) * n + (n - 1 - x);
+                    } else {
+                        srcIdx = x * n + (n - 1 - y);
+                    }
+                    memcpy(dst + (y * n + x) * Bpp, src + srcIdx * Bpp, Bpp);
+                }
+            }
         }
     }
+}
 
-    layer.pixels = std::move(destPixels);
-    dstFormat = alpha ? PixelFormat::RGBA8 : PixelFormat::RGB8;
+template <int Bpp>
+static void rotatePixels(size_t n, int quarterTurns, const uint8_t *src, uint8_t *dst) {
+    switch (quarterTurns) {
+    case 1:
+        rotatePixels<Bpp, 1>(n, src, dst);
+        break;
+    case 2:
+        rotatePixels<Bpp, 2>(n, src, dst);
+        break;
+    case 3:
+        rotatePixels<Bpp, 3>(n, src, dst);
+        break;
+    default:
+        break;
+    }
 }
 
-static void rotateLayer90(int width, int height, Texture::Layer &layer, int bpp) {
+static void rotateLayer(int width, int height, Texture::Layer &layer, int bpp, int quarterTurns) {
     if (width != height) {
         throw std::invalid_argument(str(boost::format("Invalid texture size: width=%d, height=%d") % width % height));
     }
+    quarterTurns %= 4;
+    if (quarterTurns == 0) {
+        return;
+    }
     size_t n = width;
-    size_t w = n / 2;
-    size_t h = (n + 1) / 2;
-    uint8_t *pixels = reinterpret_cast<uint8_t *>(layer.pixels->data());
-
-    for (size_t x = 0; x < w; ++x) {
-        for (size_t y = 0; y < h; ++y) {
-            const size_t d0 = (y * n + x) * bpp;
-            const size_t d1 = ((n - 1 - x) * n + y) * bpp;
-            const size_t d2 = ((n - 1 - y) * n + (n - 1 - x)) * bpp;
-            const size_t d3 = (x * n + (n - 1 - y)) * bpp;
-
-            for (size_t p = 0; p < static_cast<size_t>(bpp); ++p) {
-                uint8_t tmp = pixels[d0 + p];
-                pixels[d0 + p] = pixels[d1 + p];
-                pixels[d1 + p] = pixels[d2 + p];
-                pixels[d2 + p] = pixels[d3 + p];
-                pixels[d3 + p] = tmp;
-            }
-        }
+    auto rotated = std::make_shared<ByteBuffer>(layer.pixels->size());
+    auto src = reinterpret_cast<const uint8_t *>(layer.pixels->data());
+    auto dst = reinterpret_cast<uint8_t *>(rotated->data());
+
+    switch (bpp) {
+    case 1:
+        rotatePixels<1>(n, quarterTurns, src, dst);
+        break;
+    case 3:
+        rotatePixels<3>(n, quarterTurns, src, dst);
+        break;
+    case 4:
+        rotatePixels<4>(n, quarterTurns, src, dst);
+        break;
+    default:
+        throw std::invalid_argument("Unsupported bytes per pixel: " + std::to_string(bpp));
     }
+
+    layer.pixels = std::move(rotated);
 }
 
 static int getBitsPerPixel(PixelFormat format) {
@@ -102,6 +135,17 @@ static int getBitsPerPixel(PixelFormat format) {
     }
 }
 
+int getPixelDataSize(int width, int height, PixelFormat format) {
+    switch (format) {
+    case PixelFormat::DXT1:
+        return std::max(8, ((width + 3) / 4) * ((height + 3) / 4) * 8);
+    case PixelFormat::DXT5:
+        return std::max(16, ((width + 3) / 4) * ((height + 3) / 4) * 16);
+    default:
+        return width * height * getBitsPerPixel(format);
+    }
+}
+
 void prepareCubemap(Texture &texture) {
     static constexpr int rotations[] = {1, 3, 0, 2, 2, 0};
 
@@ -122,9 +166,7 @@ void prepareCubemap(Texture &texture) {
                 decompressLayer(texture.width(), texture.height(), layer, srcFormat, dstFormat);
                 texture.setPixelFormat(dstFormat);
             }
-            for (int j = 0; j < rotations[i]; ++j) {
-                rotateLayer90(texture.width(), texture.height(), layer, getBitsPerPixel(dstFormat));
-            }
+            rotateLayer(texture.width(), texture.height(), layer, getBitsPerPixel(dstFormat), rotations[i]);
         }
     } else {
         throw std::invalid_argument(str(boost::format("Texture '%s' has %d layers, %d expected") % texture.name() % numLayers % kNumCubeFaces));
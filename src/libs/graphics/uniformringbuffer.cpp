@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/graphics/uniformringbuffer.h"
+
+#include "reone/system/threadutil.h"
+
+namespace reone {
+
+namespace graphics {
+
+void UniformRingBuffer::init() {
+    if (_inited) {
+        return;
+    }
+    checkMainThread();
+    GLint alignment = 0;
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+    if (alignment > 0) {
+        _alignment = alignment;
+    }
+    glGenBuffers(1, &_nameGL);
+    glBindBuffer(GL_UNIFORM_BUFFER, _nameGL);
+    glBufferData(GL_UNIFORM_BUFFER, _capacity, nullptr, GL_STREAM_DRAW);
+    _offset = 0;
+    _inited = true;
+}
+
+void UniformRingBuffer::deinit() {
+    if (!_inited) {
+        return;
+    }
+    checkMainThread();
+    glDeleteBuffers(1, &_nameGL);
+    _inited = false;
+}
+
+void UniformRingBuffer::write(int bindingPoint, const void *data, ptrdiff_t size) {
+    if (size > _capacity) {
+        throw std::invalid_argument("size must not exceed capacity");
+    }
+    glBindBuffer(GL_UNIFORM_BUFFER, _nameGL);
+    if (_offset + size > _capacity) {
+        glBufferData(GL_UNIFORM_BUFFER, _capacity, nullptr, GL_STREAM_DRAW);
+        _offset = 0;
+    }
+    glBufferSubData(GL_UNIFORM_BUFFER, _offset, size, data);
+    glBindBufferRange(GL_UNIFORM_BUFFER, bindingPoint, _nameGL, _offset, size);
+    _offset += ((size + _alignment - 1) / _alignment) * _alignment;
+}
+
+} // namespace graphics
+
+} // namespace reone
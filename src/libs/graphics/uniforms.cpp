@@ -21,13 +21,20 @@ namespace reone {
 
 namespace graphics {
 
+static constexpr ptrdiff_t kLocalsRingCapacity = 2 * 1024 * 1024;
+
+static const ptrdiff_t kGeneralLocalsOffset = offsetof(GeneralUniforms, screenProjection);
+static const ptrdiff_t kGeneralLocalsSize = sizeof(GeneralUniforms) - kGeneralLocalsOffset;
+
+static_assert(offsetof(GeneralUniforms, screenProjection) % 16 == 0, "General uniform locals must be 16 byte aligned");
+static_assert(sizeof(GeneralUniforms) % 16 == 0, "General uniforms size must be a multiple of 16");
+
 void Uniforms::init() {
     if (_inited) {
         return;
     }
 
     static GeneralUniforms defaultsGeneral;
-    static TextUniforms defaultsText;
     static LightingUniforms defaultsLighting;
     static SkeletalUniforms defaultsSkeletal;
     static ParticlesUniforms defaultsParticles;
@@ -35,9 +42,9 @@ void Uniforms::init() {
     static SSAOUniforms defaultsSSAO;
     static WalkmeshUniforms defaultsWalkmesh;
     static PointsUniforms defaultsPoints;
+    static InstancesUniforms defaultsInstances;
 
-    _ubGeneral = initBuffer(&defaultsGeneral, sizeof(GeneralUniforms));
-    _ubText = initBuffer(&defaultsText, sizeof(TextUniforms));
+    _ubGeneral = initBuffer(&defaultsGeneral, kGeneralLocalsOffset);
     _ubLighting = initBuffer(&defaultsLighting, sizeof(LightingUniforms));
     _ubSkeletal = initBuffer(&defaultsSkeletal, sizeof(SkeletalUniforms));
     _ubParticles = initBuffer(&defaultsParticles, sizeof(ParticlesUniforms));
@@ -45,6 +52,14 @@ void Uniforms::init() {
     _ubSSAO = initBuffer(&defaultsSSAO, sizeof(SSAOUniforms));
     _ubWalkmesh = initBuffer(&defaultsWalkmesh, sizeof(WalkmeshUniforms));
     _ubPoints = initBuffer(&defaultsPoints, sizeof(PointsUniforms));
+    _ubInstances = initBuffer(&defaultsInstances, sizeof(InstancesUniforms));
+
+    _rbLocals = std::make_unique<UniformRingBuffer>(kLocalsRingCapacity);
+    _rbLocals->init();
+    _rbLocals->write(UniformBlockBindingPoints::locals, reinterpret_cast<const uint8_t *>(&defaultsGeneral) + kGeneralLocalsOffset, kGeneralLocalsSize);
+
+    _general = defaultsGeneral;
+    _uploadedGeneral = defaultsGeneral;
 
     _inited = true;
 }
@@ -55,7 +70,6 @@ void Uniforms::deinit() {
     }
 
     _ubGeneral.reset();
-    _ubText.reset();
     _ubLighting.reset();
     _ubSkeletal.reset();
     _ubParticles.reset();
@@ -63,18 +77,37 @@ void Uniforms::deinit() {
     _ubSSAO.reset();
     _ubWalkmesh.reset();
     _ubPoints.reset();
+    _ubInstances.reset();
+    _rbLocals.reset();
 
     _inited = false;
 }
 
+void Uniforms::beginFrame() {
+    _prevFrameStats = _frameStats;
+    _frameStats = UniformsStats();
+}
+
 void Uniforms::setGeneral(const std::function<void(GeneralUniforms &)> &block) {
     block(_general);
-    refreshBuffer(*_ubGeneral, UniformBlockBindingPoints::general, &_general, sizeof(GeneralUniforms));
-}
 
-void Uniforms::setText(const std::function<void(TextUniforms &)> &block) {
-    block(_text);
-    refreshBuffer(*_ubText, UniformBlockBindingPoints::text, &_text, sizeof(TextUniforms));
+    // Globals rarely change between draw calls, only upload them when they do
+    auto general = reinterpret_cast<const uint8_t *>(&_general);
+    auto uploaded = reinterpret_cast<uint8_t *>(&_uploadedGeneral);
+    if (std::memcmp(general, uploaded, kGeneralLocalsOffset) != 0) {
+        refreshBuffer(*_ubGeneral, UniformBlockBindingPoints::general, general, kGeneralLocalsOffset);
+        std::memcpy(uploaded, general, kGeneralLocalsOffset);
+    }
+
+    // Locals are appended to the ring buffer, so that previous draw calls keep their own copy
+    auto locals = general + kGeneralLocalsOffset;
+    auto uploadedLocals = uploaded + kGeneralLocalsOffset;
+    if (std::memcmp(locals, uploadedLocals, kGeneralLocalsSize) != 0) {
+        _rbLocals->write(UniformBlockBindingPoints::locals, locals, kGeneralLocalsSize);
+        std::memcpy(uploadedLocals, locals, kGeneralLocalsSize);
+        _frameStats.bytesUploaded += kGeneralLocalsSize;
+        ++_frameStats.numUploads;
+    }
 }
 
 void Uniforms::setLighting(const std::function<void(LightingUniforms &)> &block) {
@@ -112,6 +145,11 @@ void Uniforms::setPoints(const std::function<void(PointsUniforms &)> &block) {
     refreshBuffer(*_ubPoints, UniformBlockBindingPoints::points, &_points, sizeof(PointsUniforms));
 }
 
+void Uniforms::setInstances(const std::function<void(InstancesUniforms &)> &block) {
+    block(_instances);
+    refreshBuffer(*_ubInstances, UniformBlockBindingPoints::instances, &_instances, sizeof(InstancesUniforms));
+}
+
 std::unique_ptr<UniformBuffer> Uniforms::initBuffer(const void *data, ptrdiff_t size) {
     auto buf = std::make_unique<UniformBuffer>();
     buf->setData(data, size);
@@ -122,6 +160,8 @@ std::unique_ptr<UniformBuffer> Uniforms::initBuffer(const void *data, ptrdiff_t
 void Uniforms::refreshBuffer(UniformBuffer &buffer, int bindingPoint, const void *data, ptrdiff_t size) {
     buffer.bind(bindingPoint);
     buffer.setData(data, size, true);
+    _frameStats.bytesUploaded += size;
+    ++_frameStats.numUploads;
 }
 
 } // namespace graphics
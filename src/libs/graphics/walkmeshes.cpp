@@ -17,8 +17,11 @@
 
 #include "reone/graphics/walkmeshes.h"
 
+#include "reone/graphics/assetcacheutil.h"
 #include "reone/graphics/format/bwmreader.h"
+#include "reone/resource/assetcache.h"
 #include "reone/resource/resources.h"
+#include "reone/system/logutil.h"
 #include "reone/system/stream/memoryinput.h"
 
 using namespace reone::resource;
@@ -27,8 +30,9 @@ namespace reone {
 
 namespace graphics {
 
-Walkmeshes::Walkmeshes(Resources &resources) :
-    _resources(resources) {
+Walkmeshes::Walkmeshes(Resources &resources, AssetCache &assetCache) :
+    _resources(resources),
+    _assetCache(assetCache) {
 }
 
 void Walkmeshes::clear() {
@@ -37,25 +41,35 @@ void Walkmeshes::clear() {
 
 std::shared_ptr<Walkmesh> Walkmeshes::get(const std::string &resRef, ResourceType type) {
     auto lcResRef = boost::to_lower_copy(resRef);
-
-    auto maybeWalkmesh = _cache.find(lcResRef);
-    if (maybeWalkmesh != _cache.end()) {
-        return maybeWalkmesh->second;
-    }
-    auto inserted = _cache.insert(std::make_pair(lcResRef, doGet(lcResRef, type)));
-
-    return inserted.first->second;
+    return _cache.getOrAdd(lcResRef, [this, &lcResRef, type]() { return doGet(lcResRef, type); });
 }
 
 std::shared_ptr<Walkmesh> Walkmeshes::doGet(const std::string &resRef, ResourceType type) {
-    auto res = _resources.find(ResourceId(resRef, type));
+    auto id = ResourceId(resRef, type);
+    auto res = _resources.find(id);
     if (!res) {
         return nullptr;
     }
+    uint64_t hash = 0;
+    if (_assetCache.isEnabled()) {
+        hash = hashBytes(res->data);
+        auto blob = _assetCache.find(id, hash);
+        if (blob) {
+            try {
+                return readWalkmeshBlob(*blob);
+            } catch (const std::exception &e) {
+                warn(boost::format("Error reading cached walkmesh %s: %s") % id.string() % std::string(e.what()), LogChannel::Graphics);
+            }
+        }
+    }
     auto bwm = MemoryInputStream(res->data);
     auto reader = BwmReader(bwm);
     reader.load();
-    return reader.walkmesh();
+    auto walkmesh = reader.walkmesh();
+    if (walkmesh && _assetCache.isEnabled()) {
+        _assetCache.add(id, hash, writeWalkmeshBlob(*walkmesh));
+    }
+    return walkmesh;
 }
 
 } // namespace graphics
@@ -209,6 +209,9 @@ void Control::draw(const glm::ivec2 &screenSize, const glm::ivec2 &offset, const
     if (_sceneName.empty()) {
         return;
     }
+    // Scene preview is drawn immediately, on top of everything batched so far
+    _graphicsSvc.spriteBatch.flush();
+
     std::shared_ptr<Texture> output;
     _graphicsSvc.context.withBlending(BlendMode::None, [this, &output]() {
         output = _graphicsSvc.pipeline.draw(_sceneGraphs.get(_sceneName), {_extent.width, _extent.height});
@@ -236,79 +239,48 @@ void Control::draw(const glm::ivec2 &screenSize, const glm::ivec2 &offset, const
 }
 
 void Control::drawBorder(const Border &border, const glm::ivec2 &offset, const glm::ivec2 &size) {
-    _graphicsSvc.shaders.use(ShaderProgramId::GUI);
-
-    glm::vec3 color(getBorderColor());
-    glm::mat4 transform(1.0f);
+    auto &spriteBatch = _graphicsSvc.spriteBatch;
+    glm::vec4 color(getBorderColor(), 1.0f);
 
     if (border.fill) {
-        _graphicsSvc.textures.bind(*border.fill);
-
         int x = _extent.left + border.dimension + offset.x;
         int y = _extent.top + border.dimension + offset.y;
         int w = size.x - 2 * border.dimension;
         int h = size.y - 2 * border.dimension;
 
-        transform = glm::translate(glm::vec3(x, y, 0.0f));
-        transform *= glm::scale(glm::vec3(w, h, 1.0f));
-
-        _graphicsSvc.uniforms.setGeneral([this, &transform](auto &general) {
-            general.resetLocals();
-            general.featureMask = _discardEnabled ? UniformsFeatureFlags::discard : 0;
-            general.projection = _graphicsSvc.window.getOrthoProjection();
-            general.model = transform;
-            general.discardColor = glm::vec4(_discardColor, 1.0f);
-        });
-
         auto blendMode = border.fill->features().blending == Texture::Blending::Additive ? BlendMode::Additive : BlendMode::Normal;
-        _graphicsSvc.context.withBlending(blendMode, [this, &border]() {
-            _graphicsSvc.meshes.quad().draw();
-        });
+        SpriteMaterial material(*border.fill, blendMode);
+        material.discard = _discardEnabled;
+        material.discardColor = _discardColor;
+
+        spriteBatch.draw(material, Sprite(glm::vec4(x, y, w, h)));
     }
 
     if (border.edge) {
         int width = size.x - 2 * border.dimension;
         int height = size.y - 2 * border.dimension;
 
-        _graphicsSvc.textures.bind(*border.edge);
+        SpriteMaterial material(*border.edge);
 
         if (height > 0.0f) {
             int x = _extent.left + offset.x;
             int y = _extent.top + border.dimension + offset.y;
 
             // Left edge
-            transform = glm::translate(glm::vec3(x, y, 0.0f));
-            transform *= glm::scale(glm::vec3(border.dimension, height, 1.0f));
-
-            _graphicsSvc.uniforms.setGeneral([this, &transform, &color](auto &general) {
-                general.resetLocals();
-                general.projection = _graphicsSvc.window.getOrthoProjection();
-                general.model = transform;
-                general.uv = glm::mat3x4(
-                    glm::vec4(0.0f, -1.0f, 0.0f, 0.0f),
-                    glm::vec4(1.0f, 0.0f, 0.0f, 0.0f),
-                    glm::vec4(0.0f, 1.0f, 0.0f, 0.0f));
-                general.color = glm::vec4(color, 1.0f);
-            });
-
-            _graphicsSvc.meshes.quad().draw();
+            Sprite left(glm::vec4(x, y, border.dimension, height), color);
+            left.transformUV(glm::mat3x4(
+                glm::vec4(0.0f, -1.0f, 0.0f, 0.0f),
+                glm::vec4(1.0f, 0.0f, 0.0f, 0.0f),
+                glm::vec4(0.0f, 1.0f, 0.0f, 0.0f)));
+            spriteBatch.draw(material, left);
 
             // Right edge
-            transform = glm::translate(glm::vec3(x + size.x - border.dimension, y, 0.0f));
-            transform *= glm::scale(glm::vec3(border.dimension, height, 1.0f));
-
-            _graphicsSvc.uniforms.setGeneral([this, &transform, &color](auto &general) {
-                general.resetLocals();
-                general.projection = _graphicsSvc.window.getOrthoProjection();
-                general.model = transform;
-                general.uv = glm::mat3x4(
-                    glm::vec4(0.0f, 1.0f, 0.0f, 0.0f),
-                    glm::vec4(1.0f, 0.0f, 0.0f, 0.0f),
-                    glm::vec4(0.0f, 0.0f, 0.0f, 0.0f));
-                general.color = glm::vec4(color, 1.0f);
-            });
-
-            _graphicsSvc.meshes.quad().draw();
+            Sprite right(glm::vec4(x + size.x - border.dimension, y, border.dimension, height), color);
+            right.transformUV(glm::mat3x4(
+                glm::vec4(0.0f, 1.0f, 0.0f, 0.0f),
+                glm::vec4(1.0f, 0.0f, 0.0f, 0.0f),
+                glm::vec4(0.0f, 0.0f, 0.0f, 0.0f)));
+            spriteBatch.draw(material, right);
         }
 
         if (width > 0.0f) {
@@ -316,34 +288,15 @@ void Control::drawBorder(const Border &border, const glm::ivec2 &offset, const g
             int y = _extent.top + offset.y;
 
             // Top edge
-            transform = glm::translate(glm::vec3(x, y, 0.0f));
-            transform *= glm::scale(glm::vec3(width, border.dimension, 1.0f));
-
-            _graphicsSvc.uniforms.setGeneral([this, &transform, &color](auto &general) {
-                general.resetLocals();
-                general.projection = _graphicsSvc.window.getOrthoProjection();
-                general.model = transform;
-                general.color = glm::vec4(color, 1.0f);
-            });
-
-            _graphicsSvc.meshes.quad().draw();
+            spriteBatch.draw(material, Sprite(glm::vec4(x, y, width, border.dimension), color));
 
             // Bottom edge
-            transform = glm::translate(glm::vec3(x, y + size.y - border.dimension, 0.0f));
-            transform *= glm::scale(glm::vec3(width, border.dimension, 1.0f));
-
-            _graphicsSvc.uniforms.setGeneral([this, &transform, &color](auto &general) {
-                general.resetLocals();
-                general.projection = _graphicsSvc.window.getOrthoProjection();
-                general.model = transform;
-                general.uv = glm::mat3x4(
-                    glm::vec4(1.0f, 0.0f, 0.0f, 0.0f),
-                    glm::vec4(0.0f, -1.0f, 0.0f, 0.0f),
-                    glm::vec4(0.0f, 1.0f, 0.0f, 0.0f));
-                general.color = glm::vec4(color, 1.0f);
-            });
-
-            _graphicsSvc.meshes.quad().draw();
+            Sprite bottom(glm::vec4(x, y + size.y - border.dimension, width, border.dimension), color);
+            bottom.transformUV(glm::mat3x4(
+                glm::vec4(1.0f, 0.0f, 0.0f, 0.0f),
+                glm::vec4(0.0f, -1.0f, 0.0f, 0.0f),
+                glm::vec4(0.0f, 1.0f, 0.0f, 0.0f)));
+            spriteBatch.draw(material, bottom);
         }
     }
 
@@ -351,71 +304,34 @@ void Control::drawBorder(const Border &border, const glm::ivec2 &offset, const g
         int x = _extent.left + offset.x;
         int y = _extent.top + offset.y;
 
-        _graphicsSvc.textures.bind(*border.corner);
+        SpriteMaterial material(*border.corner);
 
         // Top left corner
-        transform = glm::translate(glm::vec3(x, y, 0.0f));
-        transform *= glm::scale(glm::vec3(border.dimension, border.dimension, 1.0f));
-
-        _graphicsSvc.uniforms.setGeneral([this, &transform, &color](auto &general) {
-            general.resetLocals();
-            general.projection = _graphicsSvc.window.getOrthoProjection();
-            general.model = transform;
-            general.color = glm::vec4(color, 1.0f);
-        });
-
-        _graphicsSvc.meshes.quad().draw();
+        spriteBatch.draw(material, Sprite(glm::vec4(x, y, border.dimension, border.dimension), color));
 
         // Bottom left corner
-        transform = glm::translate(glm::vec3(x, y + size.y - border.dimension, 0.0f));
-        transform *= glm::scale(glm::vec3(border.dimension, border.dimension, 1.0f));
-
-        _graphicsSvc.uniforms.setGeneral([this, &transform, &color](auto &general) {
-            general.resetLocals();
-            general.projection = _graphicsSvc.window.getOrthoProjection();
-            general.model = transform;
-            general.uv = glm::mat3x4(
-                glm::vec4(1.0f, 0.0f, 0.0f, 0.0f),
-                glm::vec4(0.0f, -1.0f, 0.0f, 0.0f),
-                glm::vec4(0.0f, 1.0f, 0.0f, 0.0f));
-            general.color = glm::vec4(color, 1.0f);
-        });
-
-        _graphicsSvc.meshes.quad().draw();
+        Sprite bottomLeft(glm::vec4(x, y + size.y - border.dimension, border.dimension, border.dimension), color);
+        bottomLeft.transformUV(glm::mat3x4(
+            glm::vec4(1.0f, 0.0f, 0.0f, 0.0f),
+            glm::vec4(0.0f, -1.0f, 0.0f, 0.0f),
+            glm::vec4(0.0f, 1.0f, 0.0f, 0.0f)));
+        spriteBatch.draw(material, bottomLeft);
 
         // Top right corner
-        transform = glm::translate(glm::vec3(x + size.x - border.dimension, y, 0.0f));
-        transform *= glm::scale(glm::vec3(border.dimension, border.dimension, 1.0f));
-
-        _graphicsSvc.uniforms.setGeneral([this, &transform, &color](auto &general) {
-            general.resetLocals();
-            general.projection = _graphicsSvc.window.getOrthoProjection();
-            general.model = transform;
-            general.uv = glm::mat3x4(
-                glm::vec4(-1.0f, 0.0f, 0.0f, 0.0f),
-                glm::vec4(0.0f, 1.0f, 0.0f, 0.0f),
-                glm::vec4(1.0f, 0.0f, 0.0f, 0.0f));
-            general.color = glm::vec4(color, 1.0f);
-        });
-
-        _graphicsSvc.meshes.quad().draw();
+        Sprite topRight(glm::vec4(x + size.x - border.dimension, y, border.dimension, border.dimension), color);
+        topRight.transformUV(glm::mat3x4(
+            glm::vec4(-1.0f, 0.0f, 0.0f, 0.0f),
+            glm::vec4(0.0f, 1.0f, 0.0f, 0.0f),
+            glm::vec4(1.0f, 0.0f, 0.0f, 0.0f)));
+        spriteBatch.draw(material, topRight);
 
         // Bottom right corner
-        transform = glm::translate(glm::vec3(x + size.x - border.dimension, y + size.y - border.dimension, 0.0f));
-        transform *= glm::scale(glm::vec3(border.dimension, border.dimension, 1.0f));
-
-        _graphicsSvc.uniforms.setGeneral([this, &transform, &color](auto &general) {
-            general.resetLocals();
-            general.projection = _graphicsSvc.window.getOrthoProjection();
-            general.model = transform;
-            general.uv = glm::mat3x4(
-                glm::vec4(-1.0f, 0.0f, 0.0f, 0.0f),
-                glm::vec4(0.0f, -1.0f, 0.0f, 0.0f),
-                glm::vec4(1.0f, 1.0f, 0.0f, 0.0f));
-            general.color = glm::vec4(color, 1.0f);
-        });
-
-        _graphicsSvc.meshes.quad().draw();
+        Sprite bottomRight(glm::vec4(x + size.x - border.dimension, y + size.y - border.dimension, border.dimension, border.dimension), color);
+        bottomRight.transformUV(glm::mat3x4(
+            glm::vec4(-1.0f, 0.0f, 0.0f, 0.0f),
+            glm::vec4(0.0f, -1.0f, 0.0f, 0.0f),
+            glm::vec4(1.0f, 1.0f, 0.0f, 0.0f)));
+        spriteBatch.draw(material, bottomRight);
     }
 }
 
@@ -427,19 +343,42 @@ const glm::vec3 &Control::getBorderColor() const {
 }
 
 void Control::drawText(const std::vector<std::string> &lines, const glm::ivec2 &offset, const glm::ivec2 &size) {
-    glm::ivec2 position;
-    TextGravity gravity;
-    getTextPosition(position, static_cast<int>(lines.size()), size, gravity);
-
-    glm::vec3 linePosition(0.0f);
+    glm::ivec4 extent(_extent.left, _extent.top, _extent.width, _extent.height);
     glm::vec3 color((_focus && _hilight) ? _hilight->color : _text.color);
 
-    for (auto &line : lines) {
-        linePosition.x = static_cast<float>(position.x + offset.x);
-        linePosition.y = static_cast<float>(position.y + offset.y);
-        _text.font->draw(line, linePosition, color, gravity);
-        position.y += static_cast<int>(_text.font->height());
+    bool layoutChanged =
+        _textLayout.font != _text.font.get() ||
+        _textLayout.extent != extent ||
+        _textLayout.offset != offset ||
+        _textLayout.size != size ||
+        _textLayout.color != color ||
+        _textLayout.align != _text.align ||
+        _textLayout.lines != lines;
+
+    if (layoutChanged) {
+        _textLayout.font = _text.font.get();
+        _textLayout.extent = extent;
+        _textLayout.offset = offset;
+        _textLayout.size = size;
+        _textLayout.color = color;
+        _textLayout.align = _text.align;
+        _textLayout.lines = lines;
+        _textLayout.glyphs.clear();
+
+        glm::ivec2 position;
+        TextGravity gravity;
+        getTextPosition(position, static_cast<int>(lines.size()), size, gravity);
+
+        glm::vec3 linePosition(0.0f);
+        for (auto &line : lines) {
+            linePosition.x = static_cast<float>(position.x + offset.x);
+            linePosition.y = static_cast<float>(position.y + offset.y);
+            _text.font->layout(line, linePosition, color, gravity, _textLayout.glyphs);
+            position.y += static_cast<int>(_text.font->height());
+        }
     }
+
+    _text.font->draw(_textLayout.glyphs);
 }
 
 void Control::getTextPosition(glm::ivec2 &position, int lineCount, const glm::ivec2 &size, TextGravity &gravity) const {
@@ -87,37 +87,12 @@ void ImageButton::drawIcon(
         color = _border->color;
     }
 
+    glm::vec4 iconBounds(offset.x + _extent.left, offset.y + _extent.top, _extent.height, _extent.height);
     if (iconFrame) {
-        _graphicsSvc.textures.bind(*iconFrame);
-
-        glm::mat4 transform(1.0f);
-        transform = glm::translate(transform, glm::vec3(offset.x + _extent.left, offset.y + _extent.top, 0.0f));
-        transform = glm::scale(transform, glm::vec3(_extent.height, _extent.height, 1.0f));
-
-        _graphicsSvc.uniforms.setGeneral([this, transform, &color](auto &general) {
-            general.resetLocals();
-            general.projection = _graphicsSvc.window.getOrthoProjection();
-            general.model = std::move(transform);
-            general.color = glm::vec4(color, 1.0f);
-        });
-        _graphicsSvc.shaders.use(ShaderProgramId::GUI);
-        _graphicsSvc.meshes.quad().draw();
+        _graphicsSvc.spriteBatch.draw(SpriteMaterial(*iconFrame), Sprite(iconBounds, glm::vec4(color, 1.0f)));
     }
-
     if (iconTexture) {
-        glm::mat4 transform(1.0f);
-        transform = glm::translate(transform, glm::vec3(offset.x + _extent.left, offset.y + _extent.top, 0.0f));
-        transform = glm::scale(transform, glm::vec3(_extent.height, _extent.height, 1.0f));
-
-        _graphicsSvc.textures.bind(*iconTexture);
-
-        _graphicsSvc.uniforms.setGeneral([this, transform](auto &general) {
-            general.resetLocals();
-            general.projection = _graphicsSvc.window.getOrthoProjection();
-            general.model = std::move(transform);
-        });
-        _graphicsSvc.shaders.use(ShaderProgramId::GUI);
-        _graphicsSvc.meshes.quad().draw();
+        _graphicsSvc.spriteBatch.draw(SpriteMaterial(*iconTexture), Sprite(iconBounds));
     }
 
     if (!iconText.empty()) {
@@ -49,21 +49,10 @@ void ProgressBar::draw(const glm::ivec2 &screenSize, const glm::ivec2 &offset, c
     if (_value == 0 || !_progress.fill) {
         return;
     }
-    _graphicsSvc.textures.bind(*_progress.fill);
-
     float w = _extent.width * _value / 100.0f;
-
-    glm::mat4 transform(1.0f);
-    transform = glm::translate(transform, glm::vec3(_extent.left + offset.x, _extent.top + offset.y, 0.0f));
-    transform = glm::scale(transform, glm::vec3(w, _extent.height, 1.0f));
-
-    _graphicsSvc.uniforms.setGeneral([this, transform](auto &general) {
-        general.resetLocals();
-        general.projection = _graphicsSvc.window.getOrthoProjection();
-        general.model = std::move(transform);
-    });
-    _graphicsSvc.shaders.use(ShaderProgramId::GUI);
-    _graphicsSvc.meshes.quad().draw();
+    _graphicsSvc.spriteBatch.draw(
+        SpriteMaterial(*_progress.fill),
+        Sprite(glm::vec4(_extent.left + offset.x, _extent.top + offset.y, w, _extent.height)));
 }
 
 void ProgressBar::setValue(int value) {
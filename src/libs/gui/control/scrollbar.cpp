@@ -62,48 +62,28 @@ void ScrollBar::drawThumb(const glm::ivec2 &offset) {
         return;
     }
 
-    _graphicsSvc.shaders.use(ShaderProgramId::GUI);
-    _graphicsSvc.textures.bind(*_thumb.image);
+    SpriteMaterial material(*_thumb.image);
+    std::vector<Sprite> sprites;
 
     // Top edge
-    _graphicsSvc.uniforms.setGeneral([this, &offset](auto &general) {
-        general.resetLocals();
-        general.projection = _graphicsSvc.window.getOrthoProjection();
-        general.model = glm::translate(glm::vec3(_extent.left + offset.x, _extent.top + _extent.width + offset.y, 0.0f));
-        general.model *= glm::scale(glm::vec3(_extent.width, 1.0f, 1.0f));
-    });
-    _graphicsSvc.meshes.quad().draw();
+    sprites.push_back(Sprite(glm::vec4(_extent.left + offset.x, _extent.top + _extent.width + offset.y, _extent.width, 1.0f)));
 
     // Left edge
-    _graphicsSvc.uniforms.setGeneral([this, &offset](auto &general) {
-        general.model = glm::translate(glm::vec3(_extent.left + offset.x, _extent.top + _extent.width + offset.y, 0.0f));
-        general.model *= glm::scale(glm::vec3(1.0f, _extent.height - 2.0f * _extent.width, 1.0f));
-    });
-    _graphicsSvc.meshes.quad().draw();
+    sprites.push_back(Sprite(glm::vec4(_extent.left + offset.x, _extent.top + _extent.width + offset.y, 1.0f, _extent.height - 2.0f * _extent.width)));
 
     // Right edge
-    _graphicsSvc.uniforms.setGeneral([this, &offset](auto &general) {
-        general.model = glm::translate(glm::vec3(_extent.left + _extent.width - 1.0f + offset.x, _extent.top + _extent.width + offset.y, 0.0f));
-        general.model *= glm::scale(glm::vec3(1.0f, _extent.height - 2.0f * _extent.width, 1.0f));
-    });
-    _graphicsSvc.meshes.quad().draw();
+    sprites.push_back(Sprite(glm::vec4(_extent.left + _extent.width - 1.0f + offset.x, _extent.top + _extent.width + offset.y, 1.0f, _extent.height - 2.0f * _extent.width)));
 
     // Bottom edge
-    _graphicsSvc.uniforms.setGeneral([this, &offset](auto &general) {
-        general.model = glm::translate(glm::vec3(_extent.left + offset.x, _extent.top + _extent.height - _extent.width - 1.0f + offset.y, 0.0f));
-        general.model *= glm::scale(glm::vec3(_extent.width, 1.0f, 1.0f));
-    });
-    _graphicsSvc.meshes.quad().draw();
+    sprites.push_back(Sprite(glm::vec4(_extent.left + offset.x, _extent.top + _extent.height - _extent.width - 1.0f + offset.y, _extent.width, 1.0f)));
 
     // Thumb
     float frameHeight = _extent.height - 2.0f * _extent.width - 4.0f;
     float thumbHeight = frameHeight * _state.numVisible / static_cast<float>(_state.count);
     float y = glm::mix(0.0f, frameHeight - thumbHeight, _state.offset / static_cast<float>(_state.count - _state.numVisible));
-    _graphicsSvc.uniforms.setGeneral([this, &offset, &thumbHeight, &y](auto &general) {
-        general.model = glm::translate(glm::vec3(_extent.left + 2.0f + offset.x, _extent.top + _extent.width + 2.0f + offset.y + y, 0.0f));
-        general.model *= glm::scale(glm::vec3(_extent.width - 4.0f, thumbHeight, 1.0f));
-    });
-    _graphicsSvc.meshes.quad().draw();
+    sprites.push_back(Sprite(glm::vec4(_extent.left + 2.0f + offset.x, _extent.top + _extent.width + 2.0f + offset.y + y, _extent.width - 4.0f, thumbHeight)));
+
+    _graphicsSvc.spriteBatch.draw(material, sprites);
 }
 
 void ScrollBar::drawArrows(const glm::ivec2 &offset) {
@@ -115,8 +95,6 @@ void ScrollBar::drawArrows(const glm::ivec2 &offset) {
     if (!canScrollUp && !canScrollDown)
         return;
 
-    _graphicsSvc.textures.bind(*_dir.image);
-
     if (canScrollUp) {
         drawUpArrow(offset);
     }
@@ -126,32 +104,17 @@ void ScrollBar::drawArrows(const glm::ivec2 &offset) {
 }
 
 void ScrollBar::drawUpArrow(const glm::ivec2 &offset) {
-    glm::mat4 transform(1.0f);
-    transform = glm::translate(transform, glm::vec3(_extent.left + offset.x, _extent.top + offset.y, 0.0f));
-    transform = glm::scale(transform, glm::vec3(_extent.width, _extent.width, 1.0f));
-
-    _graphicsSvc.uniforms.setGeneral([this, transform](auto &general) {
-        general.resetLocals();
-        general.projection = _graphicsSvc.window.getOrthoProjection();
-        general.model = std::move(transform);
-    });
-    _graphicsSvc.shaders.use(ShaderProgramId::GUI);
-    _graphicsSvc.meshes.quad().draw();
+    _graphicsSvc.spriteBatch.draw(
+        SpriteMaterial(*_dir.image),
+        Sprite(glm::vec4(_extent.left + offset.x, _extent.top + offset.y, _extent.width, _extent.width)));
 }
 
 void ScrollBar::drawDownArrow(const glm::ivec2 &offset) {
-    glm::mat4 transform(1.0f);
-    transform = glm::translate(transform, glm::vec3(_extent.left + offset.x, _extent.top + _extent.height + offset.y, 0.0f));
-    transform = glm::scale(transform, glm::vec3(_extent.width, _extent.width, 1.0f));
-    transform = glm::rotate(transform, glm::pi<float>(), glm::vec3(1.0f, 0.0f, 0.0f));
-
-    _graphicsSvc.uniforms.setGeneral([this, transform](auto &general) {
-        general.resetLocals();
-        general.projection = _graphicsSvc.window.getOrthoProjection();
-        general.model = std::move(transform);
-    });
-    _graphicsSvc.shaders.use(ShaderProgramId::GUI);
-    _graphicsSvc.meshes.quad().draw();
+    // Up arrow, flipped vertically
+    Sprite sprite(glm::vec4(_extent.left + offset.x, _extent.top + _extent.height - _extent.width + offset.y, _extent.width, _extent.width));
+    std::swap(sprite.uv[0], sprite.uv[3]);
+    std::swap(sprite.uv[1], sprite.uv[2]);
+    _graphicsSvc.spriteBatch.draw(SpriteMaterial(*_dir.image), sprite);
 }
 
 void ScrollBar::setScrollState(ScrollState state) {
@@ -224,6 +224,7 @@ void GUI::update(float dt) {
 
 void GUI::draw() {
     _graphicsSvc.context.withBlending(BlendMode::Normal, [this]() {
+        _graphicsSvc.spriteBatch.begin();
         if (_background) {
             drawBackground();
         }
@@ -236,23 +237,14 @@ void GUI::draw() {
             }
             control->draw({_options.width, _options.height}, _controlOffset, control->textLines());
         }
+        _graphicsSvc.spriteBatch.end();
     });
 }
 
 void GUI::drawBackground() {
-    _graphicsSvc.textures.bind(*_background);
-
-    glm::mat4 transform(1.0f);
-    transform = glm::translate(transform, glm::vec3(0.0f, 0.0f, 0.0));
-    transform = glm::scale(transform, glm::vec3(_options.width, _options.height, 1.0f));
-
-    _graphicsSvc.uniforms.setGeneral([this, transform](auto &general) {
-        general.resetLocals();
-        general.projection = _graphicsSvc.window.getOrthoProjection();
-        general.model = std::move(transform);
-    });
-    _graphicsSvc.shaders.use(ShaderProgramId::GUI);
-    _graphicsSvc.meshes.quad().draw();
+    _graphicsSvc.spriteBatch.draw(
+        SpriteMaterial(*_background),
+        Sprite(glm::vec4(0.0f, 0.0f, _options.width, _options.height)));
 }
 
 void GUI::resetFocus() {
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/resource/assetcache.h"
+
+#include "reone/system/binaryreader.h"
+#include "reone/system/binarywriter.h"
+#include "reone/system/logutil.h"
+#include "reone/system/stream/fileinput.h"
+#include "reone/system/stream/fileoutput.h"
+
+namespace reone {
+
+namespace resource {
+
+static const std::string kSignature("RAC ");
+static constexpr int kHeaderSize = 16;
+static constexpr uint64_t kFnvPrime = 0x100000001b3ull;
+
+void AssetCache::init() {
+    if (!isEnabled()) {
+        return;
+    }
+    try {
+        std::filesystem::create_directories(_path);
+        for (auto &entry : std::filesystem::directory_iterator(_path)) {
+            if (entry.is_regular_file()) {
+                _filenames.insert(entry.path().filename().string());
+            }
+        }
+    } catch (const std::filesystem::filesystem_error &e) {
+        warn(boost::format("Asset cache disabled: %s") % std::string(e.what()), LogChannel::Resources);
+        _filenames.clear();
+        _path.clear();
+    }
+}
+
+std::shared_ptr<ByteBuffer> AssetCache::find(const ResourceId &id, uint64_t sourceHash) {
+    if (!isEnabled()) {
+        return nullptr;
+    }
+    auto filename = id.string();
+    {
+        std::lock_guard<std::mutex> lock(_filenamesMutex);
+        if (_filenames.count(filename) == 0) {
+            return nullptr;
+        }
+    }
+    try {
+        auto stream = FileInputStream(_path / filename);
+        size_t length = stream.length();
+        if (length < kHeaderSize) {
+            return nullptr;
+        }
+        auto reader = BinaryReader(stream);
+        if (reader.readString(4) != kSignature ||
+            reader.readUint32() != kAssetCacheVersion ||
+            reader.readUint64() != sourceHash) {
+            return nullptr;
+        }
+        return std::make_shared<ByteBuffer>(reader.readBytes(static_cast<int>(length - kHeaderSize)));
+    } catch (const std::exception &e) {
+        warn(boost::format("Error reading cached %s: %s") % filename % std::string(e.what()), LogChannel::Resources);
+        return nullptr;
+    }
+}
+
+void AssetCache::add(const ResourceId &id, uint64_t sourceHash, const ByteBuffer &blob) {
+    if (!isEnabled()) {
+        return;
+    }
+    auto filename = id.string();
+
+    // Write to a temporary file first, so that incomplete blobs are never read
+    auto tmpPath = _path / (filename + "." + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + ".tmp");
+    try {
+        {
+            auto stream = FileOutputStream(tmpPath);
+            auto writer = BinaryWriter(stream);
+            writer.writeString(kSignature);
+            writer.writeUint32(kAssetCacheVersion);
+            writer.writeInt64(static_cast<int64_t>(sourceHash));
+            writer.write(blob);
+        }
+        std::filesystem::rename(tmpPath, _path / filename);
+    } catch (const std::exception &e) {
+        warn(boost::format("Error caching %s: %s") % filename % std::string(e.what()), LogChannel::Resources);
+        std::error_code ec;
+        std::filesystem::remove(tmpPath, ec);
+        return;
+    }
+    std::lock_guard<std::mutex> lock(_filenamesMutex);
+    _filenames.insert(std::move(filename));
+}
+
+uint64_t hashBytes(const ByteBuffer &bytes, uint64_t seed) {
+    uint64_t hash = seed;
+    size_t numWords = bytes.size() / sizeof(uint64_t);
+    for (size_t i = 0; i < numWords; ++i) {
+        uint64_t word;
+        std::memcpy(&word, &bytes[i * sizeof(uint64_t)], sizeof(uint64_t));
+        boost::endian::little_to_native_inplace(word);
+        hash = (hash ^ word) * kFnvPrime;
+    }
+    for (size_t i = numWords * sizeof(uint64_t); i < bytes.size(); ++i) {
+        hash = (hash ^ static_cast<uint8_t>(bytes[i])) * kFnvPrime;
+    }
+    return hash;
+}
+
+} // namespace resource
+
+} // namespace reone
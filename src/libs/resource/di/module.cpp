@@ -22,6 +22,7 @@ namespace reone {
 namespace resource {
 
 void ResourceModule::init() {
+    _assetCache = std::make_unique<AssetCache>(_cachePath);
     _resources = std::make_unique<Resources>();
     _strings = std::make_unique<Strings>();
     _twoDas = std::make_unique<TwoDas>(*_resources);
@@ -29,6 +30,7 @@ void ResourceModule::init() {
 
     _services = std::make_unique<ResourceServices>(*_gffs, *_resources, *_strings, *_twoDas);
 
+    _assetCache->init();
     _strings->init(_gamePath);
 }
 
@@ -39,6 +41,7 @@ void ResourceModule::deinit() {
     _twoDas.reset();
     _strings.reset();
     _resources.reset();
+    _assetCache.reset();
 }
 
 } // namespace resource
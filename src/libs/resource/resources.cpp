@@ -23,6 +23,7 @@
 #include "reone/resource/provider/folder.h"
 #include "reone/resource/provider/keybif.h"
 #include "reone/resource/provider/rim.h"
+#include "reone/system/profiler.h"
 
 namespace reone {
 
@@ -31,31 +32,31 @@ namespace resource {
 void Resources::addKEY(const std::filesystem::path &path) {
     auto provider = std::make_unique<KeyBifResourceProvider>(path);
     provider->init();
-    _providers.push_front(ResourceProviderLocalPair {std::move(provider), false});
+    add(std::move(provider), false);
 }
 
 void Resources::addERF(const std::filesystem::path &path, bool local) {
     auto provider = std::make_unique<ErfResourceProvider>(path);
     provider->init();
-    _providers.push_front(ResourceProviderLocalPair {std::move(provider), local});
+    add(std::move(provider), local);
 }
 
 void Resources::addRIM(const std::filesystem::path &path, bool local) {
     auto provider = std::make_unique<RimResourceProvider>(path);
     provider->init();
-    _providers.push_front(ResourceProviderLocalPair {std::move(provider), local});
+    add(std::move(provider), local);
 }
 
 void Resources::addEXE(const std::filesystem::path &path) {
     auto provider = std::make_unique<ExeResourceProvider>(path);
     provider->init();
-    _providers.push_front(ResourceProviderLocalPair {std::move(provider), false});
+    add(std::move(provider), false);
 }
 
 void Resources::addFolder(const std::filesystem::path &path) {
     auto provider = std::make_unique<Folder>(path);
     provider->init();
-    _providers.push_front(ResourceProviderLocalPair {std::move(provider), false});
+    add(std::move(provider), false);
 }
 
 Resource Resources::get(const ResourceId &id) {
@@ -67,6 +68,9 @@ Resource Resources::get(const ResourceId &id) {
 }
 
 std::optional<Resource> Resources::find(const ResourceId &id) {
+    PROFILE_ZONE("Resources::find");
+    std::lock_guard<std::mutex> lock(_providersMutex);
+
     for (auto &[provider, local] : _providers) {
         auto data = provider->findResourceData(id);
         if (data) {
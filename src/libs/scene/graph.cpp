@@ -38,6 +38,7 @@
 #include "reone/scene/node/sound.h"
 #include "reone/scene/node/trigger.h"
 #include "reone/scene/node/walkmesh.h"
+#include "reone/system/profiler.h"
 
 using namespace reone::graphics;
 
@@ -60,12 +61,69 @@ static constexpr float kMaxCollisionDistanceWalk2 = kMaxCollisionDistanceWalk *
 static constexpr float kMaxCollisionDistanceLineOfSight = 16.0f;
 static constexpr float kMaxCollisionDistanceLineOfSight2 = kMaxCollisionDistanceLineOfSight * kMaxCollisionDistanceLineOfSight;
 
+static std::atomic<uint32_t> g_staticShadowsRevision {0};
+
+/**
+ * @return bitmask of shadow map layers, whose light space frusta intersect the specified local AABB
+ */
+static int getShadowLayerMask(const AABB &aabb, const glm::mat4 &transform, const glm::mat4 *lightSpace, int numLayers) {
+    if (aabb.isEmpty()) {
+        return kShadowLayerMaskAll;
+    }
+    auto &min = aabb.min();
+    auto &max = aabb.max();
+    int mask = 0;
+    for (int i = 0; i < numLayers; ++i) {
+        glm::mat4 mvp(lightSpace[i] * transform);
+        // AABB is outside of the frustum if all of its corners are outside of the same clip plane
+        int outside[6] {0};
+        for (int corner = 0; corner < 8; ++corner) {
+            glm::vec4 pos(
+                (corner & 1) ? max.x : min.x,
+                (corner & 2) ? max.y : min.y,
+                (corner & 4) ? max.z : min.z,
+                1.0f);
+            glm::vec4 clip(mvp * pos);
+            outside[0] += clip.x < -clip.w ? 1 : 0;
+            outside[1] += clip.x > clip.w ? 1 : 0;
+            outside[2] += clip.y < -clip.w ? 1 : 0;
+            outside[3] += clip.y > clip.w ? 1 : 0;
+            outside[4] += clip.z < -clip.w ? 1 : 0;
+            outside[5] += clip.z > clip.w ? 1 : 0;
+        }
+        if (std::none_of(std::begin(outside), std::end(outside), [](int count) { return count == 8; })) {
+            mask |= 1 << i;
+        }
+    }
+    return mask;
+}
+
 void SceneGraph::clear() {
     _modelRoots.clear();
     _walkmeshRoots.clear();
     _soundRoots.clear();
     _grassRoots.clear();
     _activeLights.clear();
+
+    _opaqueMeshes.clear();
+    _transparentMeshes.clear();
+    _shadowMeshes.clear();
+    _lights.clear();
+    _emitters.clear();
+    _leafsByModel.clear();
+    _opaqueLeafs.clear();
+    _transparentLeafs.clear();
+    _flareLights.clear();
+
+    // Render queues reference meshes and textures of the previous frame
+    _renderQueue.clear();
+    _shadowQueue.clear();
+
+    _activeCamera = nullptr;
+    _shadowLight = nullptr;
+    _shadowActive = false;
+    _shadowStrength = 0.0f;
+    _staticShadowsDirty = true;
 }
 
 void SceneGraph::addRoot(std::shared_ptr<ModelSceneNode> node) {
@@ -93,6 +151,8 @@ void SceneGraph::addRoot(std::shared_ptr<SoundSceneNode> node) {
 }
 
 void SceneGraph::removeRoot(ModelSceneNode &node) {
+    removeModelLeafs(node);
+
     for (auto it = _activeLights.begin(); it != _activeLights.end();) {
         if (&(*it)->model() == &node) {
             it = _activeLights.erase(it);
@@ -141,6 +201,8 @@ void SceneGraph::removeRoot(SoundSceneNode &node) {
 }
 
 void SceneGraph::update(float dt) {
+    PROFILE_ZONE("SceneGraph::update");
+
     if (_updateRoots) {
         for (auto &root : _modelRoots) {
             root->update(dt);
@@ -159,10 +221,12 @@ void SceneGraph::update(float dt) {
     refresh();
     updateLighting();
     updateShadowLight(dt);
+    updateStaticShadows();
     updateFlareLights();
     updateSounds();
     prepareOpaqueLeafs();
     prepareTransparentLeafs();
+    prepareRenderQueue();
 }
 
 void SceneGraph::cullRoots() {
@@ -173,6 +237,14 @@ void SceneGraph::cullRoots() {
             (root->isCullable() && !_activeCamera->isInFrustum(*root));
 
         root->setCulled(culled);
+
+        // Only update render lists of roots, whose visibility has changed
+        bool visible = _leafsByModel.count(root.get()) > 0;
+        if (culled && visible) {
+            removeModelLeafs(*root);
+        } else if (!culled && !visible) {
+            addModelLeafs(*root);
+        }
     }
 }
 
@@ -240,6 +312,15 @@ void SceneGraph::updateShadowLight(float dt) {
     }
 }
 
+void SceneGraph::updateStaticShadows() {
+    // Static shadows are cached by the pipeline until static shadow casters change
+    if (!_staticShadowsDirty) {
+        return;
+    }
+    _staticShadowsRevision = ++g_staticShadowsRevision;
+    _staticShadowsDirty = false;
+}
+
 void SceneGraph::updateFlareLights() {
     _flareLights = computeClosestLights(kMaxFlareLights, [](auto &light, float distance2) {
         if (light.modelNode().light()->flares.empty()) {
@@ -291,59 +372,110 @@ void SceneGraph::updateSounds() {
 }
 
 void SceneGraph::refresh() {
-    _opaqueMeshes.clear();
-    _transparentMeshes.clear();
-    _shadowMeshes.clear();
-    _lights.clear();
-    _emitters.clear();
-
-    for (auto &root : _modelRoots) {
-        refreshFromNode(*root);
+    // Render lists are maintained incrementally, only close holes left by removed leafs
+    _opaqueMeshes.compact();
+    _transparentMeshes.compact();
+    _shadowMeshes.compact();
+    _lights.compact();
+    _emitters.compact();
+}
+
+void SceneGraph::addModelLeafs(ModelSceneNode &model) {
+    ModelLeafs leafs;
+    collectModelLeafs(model, leafs);
+
+    for (auto &mesh : leafs.meshes) {
+        // Determine whether mesh should be rendered and cast shadows
+        if (mesh->shouldRender()) {
+            // Sort meshes into transparent and opaque
+            if (mesh->isTransparent()) {
+                _transparentMeshes.add(*mesh);
+            } else {
+                _opaqueMeshes.add(*mesh);
+            }
+        }
+        if (mesh->shouldCastShadows() && _shadowMeshes.add(*mesh) && mesh->isStaticShadowCaster()) {
+            _staticShadowsDirty = true;
+        }
+    }
+    for (auto &light : leafs.lights) {
+        _lights.add(*light);
+    }
+    for (auto &emitter : leafs.emitters) {
+        _emitters.add(*emitter);
     }
+
+    _leafsByModel[&model] = std::move(leafs);
 }
 
-void SceneGraph::refreshFromNode(SceneNode &node) {
-    bool propagate = true;
+void SceneGraph::removeModelLeafs(ModelSceneNode &model) {
+    auto maybeLeafs = _leafsByModel.find(&model);
+    if (maybeLeafs == _leafsByModel.end()) {
+        return;
+    }
+    auto &leafs = maybeLeafs->second;
+    for (auto &mesh : leafs.meshes) {
+        _opaqueMeshes.remove(*mesh);
+        _transparentMeshes.remove(*mesh);
+        if (_shadowMeshes.remove(*mesh) && mesh->isStaticShadowCaster()) {
+            _staticShadowsDirty = true;
+        }
+    }
+    for (auto &light : leafs.lights) {
+        _lights.remove(*light);
+    }
+    for (auto &emitter : leafs.emitters) {
+        _emitters.remove(*emitter);
+    }
+    _leafsByModel.erase(maybeLeafs);
+}
 
+void SceneGraph::collectModelLeafs(SceneNode &node, ModelLeafs &leafs) {
     switch (node.type()) {
-    case SceneNodeType::Model: {
+    case SceneNodeType::Model:
         // Ignore models that have been culled
-        auto &model = static_cast<ModelSceneNode &>(node);
-        if (model.isCulled()) {
-            propagate = false;
+        if (static_cast<ModelSceneNode &>(node).isCulled()) {
+            return;
         }
         break;
-    }
-    case SceneNodeType::Mesh: {
-        // For model nodes, determine whether they should be rendered and cast shadows
-        auto &modelNode = static_cast<MeshSceneNode &>(node);
-        if (modelNode.shouldRender()) {
-            // Sort model nodes into transparent and opaque
-            if (modelNode.isTransparent()) {
-                _transparentMeshes.push_back(&modelNode);
-            } else {
-                _opaqueMeshes.push_back(&modelNode);
-            }
-        }
-        if (modelNode.shouldCastShadows()) {
-            _shadowMeshes.push_back(&modelNode);
-        }
+    case SceneNodeType::Mesh:
+        leafs.meshes.push_back(static_cast<MeshSceneNode *>(&node));
         break;
-    }
     case SceneNodeType::Light:
-        _lights.push_back(static_cast<LightSceneNode *>(&node));
+        leafs.lights.push_back(static_cast<LightSceneNode *>(&node));
         break;
     case SceneNodeType::Emitter:
-        _emitters.push_back(static_cast<EmitterSceneNode *>(&node));
+        leafs.emitters.push_back(static_cast<EmitterSceneNode *>(&node));
         break;
     default:
         break;
     }
+    for (auto &child : node.children()) {
+        collectModelLeafs(*child, leafs);
+    }
+}
 
-    if (propagate) {
-        for (auto &child : node.children()) {
-            refreshFromNode(*child);
-        }
+void SceneGraph::onModelChanged(ModelSceneNode &model) {
+    SceneNode *root = &model;
+    while (root->parent()) {
+        root = root->parent();
+    }
+    if (root->type() != SceneNodeType::Model) {
+        return;
+    }
+    auto &rootModel = static_cast<ModelSceneNode &>(*root);
+    if (_leafsByModel.count(&rootModel) == 0) {
+        return;
+    }
+    removeModelLeafs(rootModel);
+    addModelLeafs(rootModel);
+}
+
+void SceneGraph::onMeshTransparencyChanged(MeshSceneNode &mesh) {
+    auto &from = mesh.isTransparent() ? _opaqueMeshes : _transparentMeshes;
+    auto &to = mesh.isTransparent() ? _transparentMeshes : _opaqueMeshes;
+    if (from.remove(mesh)) {
+        to.add(mesh);
     }
 }
 
@@ -430,14 +562,54 @@ void SceneGraph::prepareTransparentLeafs() {
     }
 }
 
-void SceneGraph::drawShadows() {
-    if (!_activeCamera) {
+void SceneGraph::prepareRenderQueue() {
+    _renderQueue.clear();
+
+    auto camera = _activeCamera->camera();
+    float zFar = camera->zFar();
+
+    // On-screen size of an object of unit size at unit distance, in pixels
+    float pixelsPerUnit = camera->type() == CameraType::Perspective ? 0.5f * camera->projection()[1][1] * _graphicsOpt.height : 0.0f;
+    glm::vec3 cameraPos(_activeCamera->getOrigin());
+
+    for (auto &mesh : _opaqueMeshes) {
+        float depth = zFar > 0.0f ? glm::sqrt(mesh->getSquareDistanceTo(*_activeCamera)) / zFar : 0.0f;
+        mesh->enqueue(_renderQueue, depth);
+
+        // Let texture streaming know how much detail this mesh needs
+        auto modelMesh = mesh->modelNode().mesh();
+        if (pixelsPerUnit > 0.0f && modelMesh) {
+            auto aabb = modelMesh->mesh->aabb() * mesh->absoluteTransform();
+            float distance = glm::distance(cameraPos, glm::clamp(cameraPos, aabb.min(), aabb.max()));
+            float screenSize = pixelsPerUnit * glm::length(aabb.size()) / glm::max(distance, camera->zNear());
+            mesh->requestTextureScreenSize(screenSize);
+        }
+    }
+
+    _renderQueue.sort();
+}
+
+void SceneGraph::drawShadows(const glm::mat4 *lightSpace, int numLayers, ShadowCasters casters) {
+    if (!_activeCamera || !_shadowLight) {
         return;
     }
-    _graphicsSvc.context.withFaceCulling(CullFaceMode::Front, [this]() {
-        for (auto &mesh : _shadowMeshes) {
-            mesh->drawShadow();
+    _shadowQueue.clear();
+    for (auto &mesh : _shadowMeshes) {
+        if (casters != ShadowCasters::All && mesh->isStaticShadowCaster() != (casters == ShadowCasters::Static)) {
+            continue;
         }
+        auto &aabb = mesh->modelNode().mesh()->mesh->aabb();
+        int layerMask = getShadowLayerMask(aabb, mesh->absoluteTransform(), lightSpace, numLayers);
+        if (layerMask == 0) {
+            continue;
+        }
+        mesh->enqueueShadow(_shadowQueue, layerMask);
+    }
+    _shadowQueue.sort();
+
+    auto backend = RenderBackend(_graphicsSvc.shaders, _graphicsSvc.textures, _graphicsSvc.uniforms);
+    _graphicsSvc.context.withFaceCulling(CullFaceMode::Front, [this, &backend]() {
+        _shadowQueue.submit(RenderPass::Shadows, backend);
     });
 }
 
@@ -455,9 +627,10 @@ void SceneGraph::drawOpaque() {
     }
 
     // Draw opaque meshes
-    for (auto &mesh : _opaqueMeshes) {
-        mesh->draw();
-    }
+    auto backend = RenderBackend(_graphicsSvc.shaders, _graphicsSvc.textures, _graphicsSvc.uniforms);
+    _graphicsSvc.context.withFaceCulling(CullFaceMode::Back, [this, &backend]() {
+        _renderQueue.submit(RenderPass::Opaque, backend);
+    });
     // Draw opaque leafs
     for (auto &[node, leafs] : _opaqueLeafs) {
         node->drawLeafs(leafs);
@@ -519,8 +692,9 @@ std::vector<LightSceneNode *> SceneGraph::computeClosestLights(int count, const
         distances.push_back(std::make_pair(light, distance2));
     }
 
-    // Sort lights by distance to the camera. Directional lights are prioritizied
-    sort(distances.begin(), distances.end(), [](auto &a, auto &b) {
+    // Partially sort lights by distance to the camera. Directional lights are prioritizied
+    auto numLights = std::min(static_cast<size_t>(count), distances.size());
+    std::partial_sort(distances.begin(), distances.begin() + numLights, distances.end(), [](auto &a, auto &b) {
         auto aLight = a.first;
         auto bLight = b.first;
         if (aLight->isDirectional() && !bLight->isDirectional()) {
@@ -535,13 +709,9 @@ std::vector<LightSceneNode *> SceneGraph::computeClosestLights(int count, const
     });
 
     // Keep up to maximum number of lights
-    if (distances.size() > count) {
-        distances.erase(distances.begin() + count, distances.end());
-    }
-
     std::vector<LightSceneNode *> lights;
-    for (auto &light : distances) {
-        lights.push_back(light.first);
+    for (size_t i = 0; i < numLights; ++i) {
+        lights.push_back(distances[i].first);
     }
     return lights;
 }
@@ -696,6 +866,9 @@ void SceneGraph::fillLightingUniforms() {
             shaderLight.ambientOnly = static_cast<int>(_activeLights[i]->modelNode().light()->ambientOnly);
             shaderLight.dynamicType = _activeLights[i]->modelNode().light()->dynamicType;
         }
+        if (_activeCamera) {
+            _lightClusters.assign(*_activeCamera->camera(), lighting);
+        }
     });
 }
 
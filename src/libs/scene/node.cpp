@@ -23,40 +23,27 @@ namespace scene {
 
 void SceneNode::addChild(SceneNode &node) {
     node._parent = this;
-    node.computeAbsoluteTransforms();
-    _children.insert(&node);
-}
-
-void SceneNode::computeAbsoluteTransforms() {
-    if (_parent) {
-        _absTransform = _parent->_absTransform * _localTransform;
-    } else {
-        _absTransform = _localTransform;
-    }
-    _absTransformInv = glm::inverse(_absTransform);
-
-    for (auto &child : _children) {
-        child->computeAbsoluteTransforms();
+    node.invalidateAbsoluteTransforms();
+    if (std::find(_children.begin(), _children.end(), &node) == _children.end()) {
+        _children.push_back(&node);
     }
-
-    onAbsoluteTransformChanged();
 }
 
 void SceneNode::removeChild(SceneNode &node) {
-    auto maybeChild = _children.find(&node);
+    auto maybeChild = std::find(_children.begin(), _children.end(), &node);
     if (maybeChild == _children.end()) {
         return;
     }
     auto child = *maybeChild;
     child->_parent = nullptr;
-    child->computeAbsoluteTransforms();
+    child->invalidateAbsoluteTransforms();
     _children.erase(maybeChild);
 }
 
 void SceneNode::removeAllChildren() {
     for (auto &child : _children) {
         child->_parent = nullptr;
-        child->computeAbsoluteTransforms();
+        child->invalidateAbsoluteTransforms();
     }
     _children.clear();
 }
@@ -68,11 +55,11 @@ void SceneNode::update(float dt) {
 }
 
 glm::vec3 SceneNode::getOrigin() const {
-    return glm::vec3(_absTransform[3]);
+    return glm::vec3(absoluteTransform()[3]);
 }
 
 glm::vec2 SceneNode::getOrigin2D() const {
-    return glm::vec2(_absTransform[3]);
+    return glm::vec2(absoluteTransform()[3]);
 }
 
 float SceneNode::getDistanceTo(const glm::vec3 &point) const {
@@ -96,12 +83,52 @@ float SceneNode::getSquareDistanceTo2D(const glm::vec2 &point) const {
 }
 
 glm::vec3 SceneNode::getWorldCenterOfAABB() const {
-    return _absTransform * glm::vec4(_aabb.center(), 1.0f);
+    return absoluteTransform() * glm::vec4(_aabb.center(), 1.0f);
 }
 
 void SceneNode::setLocalTransform(glm::mat4 transform) {
     _localTransform = std::move(transform);
-    computeAbsoluteTransforms();
+    invalidateAbsoluteTransforms();
+}
+
+const glm::mat4 &SceneNode::absoluteTransform() const {
+    if (_absTransformDirty) {
+        computeAbsoluteTransform();
+    }
+    return _absTransform;
+}
+
+const glm::mat4 &SceneNode::absoluteTransformInverse() const {
+    if (_absTransformDirty) {
+        computeAbsoluteTransform();
+    }
+    if (_absTransformInvDirty) {
+        _absTransformInv = glm::inverse(_absTransform);
+        _absTransformInvDirty = false;
+    }
+    return _absTransformInv;
+}
+
+void SceneNode::invalidateAbsoluteTransforms() {
+    // Descendants of a dirty node are always dirty, so there is nothing left to do
+    if (_absTransformDirty) {
+        return;
+    }
+    _absTransformDirty = true;
+    for (auto &child : _children) {
+        child->invalidateAbsoluteTransforms();
+    }
+    onAbsoluteTransformChanged();
+}
+
+void SceneNode::computeAbsoluteTransform() const {
+    if (_parent) {
+        _absTransform = _parent->absoluteTransform() * _localTransform;
+    } else {
+        _absTransform = _localTransform;
+    }
+    _absTransformDirty = false;
+    _absTransformInvDirty = true;
 }
 
 } // namespace scene
@@ -185,7 +185,7 @@ void EmitterSceneNode::spawnLightningParticles() {
     float halfW = 0.005f * _size.x;
     float halfH = 0.005f * _size.y;
     glm::vec3 origin(randomFloat(-halfW, halfW), randomFloat(-halfH, halfH), 0.0f);
-    glm::vec3 emitterSpaceRefPos(_absTransformInv * glm::vec4((*ref)->getOrigin(), 1.0f));
+    glm::vec3 emitterSpaceRefPos(absoluteTransformInverse() * glm::vec4((*ref)->getOrigin(), 1.0f));
     glm::vec3 refToOrigin(emitterSpaceRefPos - origin);
     float distance = glm::abs(refToOrigin.z);
     float segmentLength = distance / static_cast<float>(_lightningSubDiv + 1);
@@ -228,7 +228,7 @@ void EmitterSceneNode::spawnLightningParticles() {
         glm::vec3 endToStart(segment.second - segment.first);
         glm::vec3 center(0.5f * (segment.first + segment.second));
         particle->setLocalTransform(glm::translate(center));
-        particle->setDir(_absTransform * glm::vec4(glm::normalize(endToStart), 0.0f));
+        particle->setDir(absoluteTransform() * glm::vec4(glm::normalize(endToStart), 0.0f));
         particle->setSize(glm::vec2(_lightningScale, glm::length(endToStart)));
 
         addChild(*particle);
@@ -248,9 +248,9 @@ void EmitterSceneNode::drawLeafs(const std::vector<SceneNode *> &leafs) {
     if (!texture) {
         return;
     }
-    auto emitterRight = glm::vec3(_absTransform[0]);
-    auto emitterUp = glm::vec3(_absTransform[1]);
-    auto emitterForward = glm::vec3(_absTransform[2]);
+    auto emitterRight = glm::vec3(absoluteTransform()[0]);
+    auto emitterUp = glm::vec3(absoluteTransform()[1]);
+    auto emitterForward = glm::vec3(absoluteTransform()[2]);
 
     auto view = _sceneGraph.activeCamera()->camera()->view();
     auto cameraRight = glm::vec3(view[0][0], view[1][0], view[2][0]);
@@ -44,15 +44,47 @@ static constexpr float kGrassDensityFactor = 0.25f;
 static constexpr float kMaxClusterDistance = 32.0f;
 static constexpr float kMaxClusterDistance2 = kMaxClusterDistance * kMaxClusterDistance;
 
+static constexpr float kGridCellSize = 8.0f;
+static constexpr float kMinCameraMovement2 = 0.25f;
+
 void GrassSceneNode::init() {
     // Compute grass faces
-    auto faces = _aabbNode.mesh()->mesh->faces();
+    auto &faces = _aabbNode.mesh()->mesh->faces();
+    std::vector<int> grassFaces;
+    glm::vec2 gridMin(std::numeric_limits<float>::max());
+    glm::vec2 gridMax(std::numeric_limits<float>::lowest());
     for (size_t faceIdx = 0; faceIdx < faces.size(); ++faceIdx) {
         auto &face = faces[faceIdx];
         if (_properties.materials.count(face.material) == 0) {
             continue;
         }
-        _grassFaces.push_back(static_cast<int>(faceIdx));
+        grassFaces.push_back(static_cast<int>(faceIdx));
+        gridMin = glm::min(gridMin, glm::vec2(face.centroid));
+        gridMax = glm::max(gridMax, glm::vec2(face.centroid));
+    }
+    _faceMaterialized.resize(faces.size(), false);
+
+    // Bucket grass faces into a uniform grid over face centroids
+    if (!grassFaces.empty()) {
+        _gridOrigin = gridMin;
+        _gridSize = glm::ivec2((gridMax - gridMin) / kGridCellSize) + 1;
+        std::vector<int> cellByFace;
+        cellByFace.reserve(grassFaces.size());
+        _cellOffsets.resize(_gridSize.x * _gridSize.y + 1, 0);
+        for (auto faceIdx : grassFaces) {
+            auto cell = getCell(glm::vec2(faces[faceIdx].centroid));
+            int cellIdx = cell.y * _gridSize.x + cell.x;
+            cellByFace.push_back(cellIdx);
+            ++_cellOffsets[cellIdx + 1];
+        }
+        for (size_t i = 1; i < _cellOffsets.size(); ++i) {
+            _cellOffsets[i] += _cellOffsets[i - 1];
+        }
+        _cellFaces.resize(grassFaces.size());
+        auto cellFill = _cellOffsets;
+        for (size_t i = 0; i < grassFaces.size(); ++i) {
+            _cellFaces[cellFill[cellByFace[i]]++] = grassFaces[i];
+        }
     }
 
     // Pre-allocate grass clusters
@@ -62,7 +94,7 @@ void GrassSceneNode::init() {
 }
 
 void GrassSceneNode::update(float dt) {
-    if (!_enabled) {
+    if (!_enabled || _cellFaces.empty()) {
         return;
     }
     auto camera = _sceneGraph.activeCamera();
@@ -72,59 +104,57 @@ void GrassSceneNode::update(float dt) {
     auto mesh = _aabbNode.mesh()->mesh;
     auto &faces = mesh->faces();
     auto cameraPos = camera->getOrigin();
-    glm::vec3 meshSpaceCameraPos(_absTransformInv * glm::vec4(cameraPos, 1.0f));
+    glm::vec3 meshSpaceCameraPos(absoluteTransformInverse() * glm::vec4(cameraPos, 1.0f));
 
-    // Return grass clusters in out-of-distance faces, to the pool
-    std::set<int> outOfDistance;
-    for (auto &pair : _materializedClusters) {
-        auto faceIdx = pair.first;
-        auto &face = faces[faceIdx];
-        float distance2 = glm::distance2(face.centroid, meshSpaceCameraPos);
-        if (distance2 <= kMaxClusterDistance2) {
-            continue;
-        }
-        outOfDistance.insert(faceIdx);
-    }
-    for (auto &faceIdx : outOfDistance) {
-        auto &clusters = _materializedClusters.find(faceIdx)->second;
-        for (auto &cluster : clusters) {
-            _children.erase(cluster);
-            _clusterPool.push(cluster);
-        }
-        _materializedClusters.erase(faceIdx);
+    // Distance bands only change when the camera moves
+    if (!_refreshPending && glm::distance2(meshSpaceCameraPos, _lastCameraPos) < kMinCameraMovement2) {
+        return;
     }
+    _lastCameraPos = meshSpaceCameraPos;
+    _refreshPending = false;
+
+    retireOutOfDistanceFaces(faces, meshSpaceCameraPos);
 
     // Cannot materialize any more grass clusters
     if (_clusterPool.empty()) {
         return;
     }
 
-    // Sort grass faces by distance to camera
-    std::multimap<float, int> closestFaces;
-    for (size_t faceIdx = 0; faceIdx < faces.size(); ++faceIdx) {
-        auto &face = faces[faceIdx];
-        if (_properties.materials.count(face.material) == 0) {
-            continue;
-        }
-        float distance2 = glm::distance2(face.centroid, meshSpaceCameraPos);
-        if (distance2 > kMaxClusterDistance2) {
-            continue;
+    // Sort grass faces in cells within distance by distance to camera
+    std::vector<std::pair<float, int>> closestFaces;
+    auto minCell = getCell(glm::vec2(meshSpaceCameraPos) - kMaxClusterDistance);
+    auto maxCell = getCell(glm::vec2(meshSpaceCameraPos) + kMaxClusterDistance);
+    for (int y = minCell.y; y <= maxCell.y; ++y) {
+        for (int x = minCell.x; x <= maxCell.x; ++x) {
+            int cellIdx = y * _gridSize.x + x;
+            for (int i = _cellOffsets[cellIdx]; i < _cellOffsets[cellIdx + 1]; ++i) {
+                int faceIdx = _cellFaces[i];
+                if (_faceMaterialized[faceIdx]) {
+                    continue;
+                }
+                float distance2 = glm::distance2(faces[faceIdx].centroid, meshSpaceCameraPos);
+                if (distance2 > kMaxClusterDistance2) {
+                    continue;
+                }
+                closestFaces.push_back(std::make_pair(distance2, faceIdx));
+            }
         }
-        closestFaces.insert(std::make_pair(distance2, static_cast<int>(faceIdx)));
     }
+    std::sort(closestFaces.begin(), closestFaces.end());
 
     // Materialize grass clusters in closest faces, from the pool
     for (auto &pair : closestFaces) {
         auto faceIdx = pair.second;
-        if (_materializedClusters.count(faceIdx) > 0) {
-            continue;
-        }
         auto &face = faces[faceIdx];
         auto verts = mesh->getVertexCoords(face);
-        for (int i = 0; i < getNumClustersInFace(face.area); ++i) {
-            if (_clusterPool.empty()) {
-                return;
-            }
+        int numClusters = getNumClustersInFace(face.area);
+        if (numClusters == 0) {
+            continue;
+        }
+        MaterializedFace materialized;
+        materialized.faceIdx = faceIdx;
+        materialized.clusters.reserve(numClusters);
+        for (int i = 0; i < numClusters && !_clusterPool.empty(); ++i) {
             glm::vec3 baryPosition(getRandomBarycentric());
             glm::vec3 position(barycentricToCartesian(verts[0], verts[1], verts[2], baryPosition));
             glm::vec2 lightmapUV(mesh->getUV2(face, baryPosition));
@@ -134,11 +164,40 @@ void GrassSceneNode::update(float dt) {
             cluster->setVariant(getRandomGrassVariant());
             cluster->setLightmapUV(std::move(lightmapUV));
             addChild(*cluster);
-            _materializedClusters[faceIdx].push_back(cluster);
+            materialized.clusters.push_back(cluster);
+        }
+        _faceMaterialized[faceIdx] = true;
+        _materializedFaces.push_back(std::move(materialized));
+        if (_clusterPool.empty()) {
+            return;
         }
     }
 }
 
+void GrassSceneNode::retireOutOfDistanceFaces(const std::vector<Mesh::Face> &faces, const glm::vec3 &cameraPos) {
+    // Return grass clusters in out-of-distance faces, to the pool
+    for (size_t i = 0; i < _materializedFaces.size();) {
+        auto &materialized = _materializedFaces[i];
+        float distance2 = glm::distance2(faces[materialized.faceIdx].centroid, cameraPos);
+        if (distance2 <= kMaxClusterDistance2) {
+            ++i;
+            continue;
+        }
+        for (auto &cluster : materialized.clusters) {
+            removeChild(*cluster);
+            _clusterPool.push(cluster);
+        }
+        _faceMaterialized[materialized.faceIdx] = false;
+        materialized = std::move(_materializedFaces.back());
+        _materializedFaces.pop_back();
+    }
+}
+
+glm::ivec2 GrassSceneNode::getCell(const glm::vec2 &position) const {
+    glm::ivec2 cell(glm::floor((position - _gridOrigin) / kGridCellSize));
+    return glm::clamp(cell, glm::ivec2(0), _gridSize - 1);
+}
+
 void GrassSceneNode::drawLeafs(const std::vector<SceneNode *> &leafs) {
     if (leafs.empty()) {
         return;
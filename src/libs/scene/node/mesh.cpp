@@ -21,6 +21,7 @@
 #include "reone/graphics/di/services.h"
 #include "reone/graphics/lumautil.h"
 #include "reone/graphics/mesh.h"
+#include "reone/graphics/renderqueue.h"
 #include "reone/graphics/shaders.h"
 #include "reone/graphics/texture.h"
 #include "reone/graphics/textures.h"
@@ -49,6 +50,7 @@ void MeshSceneNode::init() {
     _selfIllumColor = _modelNode.selfIllumColor().getByFrameOrElse(0, glm::vec3(0.0f));
 
     initTextures();
+    _transparent = computeTransparent();
 }
 
 void MeshSceneNode::initTextures() {
@@ -134,7 +136,7 @@ bool MeshSceneNode::shouldCastShadows() const {
     }
 }
 
-bool MeshSceneNode::isTransparent() const {
+bool MeshSceneNode::computeTransparent() const {
     if (!_nodeTextures.diffuse) {
         return false;
     }
@@ -159,6 +161,15 @@ bool MeshSceneNode::isTransparent() const {
     return hasAlphaChannel(_nodeTextures.diffuse->pixelFormat());
 }
 
+void MeshSceneNode::refreshTransparency() {
+    bool transparent = computeTransparent();
+    if (_transparent == transparent) {
+        return;
+    }
+    _transparent = transparent;
+    _sceneGraph.onMeshTransparencyChanged(*this);
+}
+
 static bool isLightingEnabledByUsage(ModelUsage usage) {
     return usage != ModelUsage::Projectile;
 }
@@ -168,137 +179,168 @@ static bool isReceivingShadows(const ModelSceneNode &model, const MeshSceneNode
 }
 
 void MeshSceneNode::draw() {
+    DrawCommand command;
+    glm::mat4 bones[kMaxBones];
+    if (!prepareDraw(command, bones)) {
+        return;
+    }
+    auto backend = RenderBackend(_graphicsSvc.shaders, _graphicsSvc.textures, _graphicsSvc.uniforms);
+    _graphicsSvc.context.withFaceCulling(CullFaceMode::Back, [&command, &bones, &backend]() {
+        RenderQueue::submit(command, bones, backend);
+    });
+}
+
+void MeshSceneNode::enqueue(RenderQueue &queue, float depth) {
+    DrawCommand command;
+    glm::mat4 bones[kMaxBones];
+    if (!prepareDraw(command, bones)) {
+        return;
+    }
+    command.depth = depth;
+    queue.add(command, bones);
+}
+
+void MeshSceneNode::enqueueShadow(RenderQueue &queue, int layerMask) {
+    std::shared_ptr<ModelNode::TriangleMesh> mesh(_modelNode.mesh());
+    if (!mesh) {
+        return;
+    }
+    DrawCommand command;
+    command.pass = RenderPass::Shadows;
+    command.program = _sceneGraph.isShadowLightDirectional() ? ShaderProgramId::DirectionalLightShadows : ShaderProgramId::PointLightShadows;
+    command.mesh = mesh->mesh.get();
+    command.locals.model = absoluteTransform();
+    command.locals.modelInv = absoluteTransformInverse();
+    command.locals.alpha = _alpha;
+    command.locals.shadowLayerMask = layerMask;
+    queue.add(command);
+}
+
+void MeshSceneNode::requestTextureScreenSize(float size) {
+    if (_nodeTextures.diffuse) {
+        _nodeTextures.diffuse->requestScreenSize(size);
+    }
+    if (_nodeTextures.lightmap) {
+        _nodeTextures.lightmap->requestScreenSize(size);
+    }
+}
+
+bool MeshSceneNode::isStaticShadowCaster() const {
+    return _model.usage() == ModelUsage::Placeable && _model.isAnimationFinished();
+}
+
+bool MeshSceneNode::prepareDraw(DrawCommand &command, glm::mat4 *bones) const {
     auto mesh = _modelNode.mesh();
     if (!mesh || !_nodeTextures.diffuse) {
-        return;
+        return false;
     }
-    bool transparent = isTransparent();
-
-    _graphicsSvc.uniforms.setGeneral([this, &mesh](auto &general) {
-        general.resetLocals();
-        general.model = _absTransform;
-        general.modelInv = _absTransformInv;
-        general.uv = glm::mat3x4(
-            glm::vec4(1.0f, 0.0f, 0.0f, 0.0f),
-            glm::vec4(0.0f, 1.0f, 0.0f, 0.0f),
-            glm::vec4(_uvOffset.x, _uvOffset.y, 0.0f, 0.0f));
-        general.selfIllumColor = glm::vec4(_selfIllumColor, 1.0f);
-        general.alpha = _alpha;
-
-        _graphicsSvc.textures.bind(*_nodeTextures.diffuse);
-        switch (_nodeTextures.diffuse->features().blending) {
-        case Texture::Blending::PunchThrough:
-            general.featureMask |= UniformsFeatureFlags::hashedalphatest;
-            break;
-        case Texture::Blending::Additive:
-            if (!_nodeTextures.envmap) {
-                general.featureMask |= UniformsFeatureFlags::premulalpha;
-            }
-            break;
-        default:
-            break;
-        }
-        float waterAlpha = _nodeTextures.diffuse->features().waterAlpha;
-        if (waterAlpha != -1.0f) {
-            general.featureMask |= UniformsFeatureFlags::water;
-            general.waterAlpha = waterAlpha;
+    command.pass = RenderPass::Opaque;
+    command.program = isTransparent() ? ShaderProgramId::ModelTransparent : ShaderProgramId::ModelOpaque;
+    command.mesh = mesh->mesh.get();
+
+    auto &locals = command.locals;
+    locals.model = absoluteTransform();
+    locals.modelInv = absoluteTransformInverse();
+    locals.uv = glm::mat3x4(
+        glm::vec4(1.0f, 0.0f, 0.0f, 0.0f),
+        glm::vec4(0.0f, 1.0f, 0.0f, 0.0f),
+        glm::vec4(_uvOffset.x, _uvOffset.y, 0.0f, 0.0f));
+    locals.selfIllumColor = glm::vec4(_selfIllumColor, 1.0f);
+    locals.alpha = _alpha;
+
+    command.textures[0] = DrawTexture {_nodeTextures.diffuse, TextureUnits::mainTex};
+    switch (_nodeTextures.diffuse->features().blending) {
+    case Texture::Blending::PunchThrough:
+        locals.featureMask |= UniformsFeatureFlags::hashedalphatest;
+        break;
+    case Texture::Blending::Additive:
+        if (!_nodeTextures.envmap) {
+            locals.featureMask |= UniformsFeatureFlags::premulalpha;
         }
+        break;
+    default:
+        break;
+    }
+    float waterAlpha = _nodeTextures.diffuse->features().waterAlpha;
+    if (waterAlpha != -1.0f) {
+        locals.featureMask |= UniformsFeatureFlags::water;
+        locals.waterAlpha = waterAlpha;
+    }
 
-        if (_nodeTextures.lightmap) {
-            general.featureMask |= UniformsFeatureFlags::lightmap;
-            _graphicsSvc.textures.bind(*_nodeTextures.lightmap, TextureUnits::lightmap);
-        }
-        if (_nodeTextures.envmap) {
-            general.featureMask |= UniformsFeatureFlags::envmap;
-            if (_nodeTextures.envmap->isCubemap()) {
-                general.featureMask |= UniformsFeatureFlags::envmapcube;
-                _graphicsSvc.textures.bind(*_nodeTextures.envmap, TextureUnits::environmentMapCube);
-            } else {
-                _graphicsSvc.textures.bind(*_nodeTextures.envmap, TextureUnits::environmentMap);
-            }
+    if (_nodeTextures.lightmap) {
+        locals.featureMask |= UniformsFeatureFlags::lightmap;
+        command.textures[1] = DrawTexture {_nodeTextures.lightmap, TextureUnits::lightmap};
+    }
+    if (_nodeTextures.envmap) {
+        locals.featureMask |= UniformsFeatureFlags::envmap;
+        if (_nodeTextures.envmap->isCubemap()) {
+            locals.featureMask |= UniformsFeatureFlags::envmapcube;
+            command.textures[2] = DrawTexture {_nodeTextures.envmap, TextureUnits::environmentMapCube};
+        } else {
+            command.textures[2] = DrawTexture {_nodeTextures.envmap, TextureUnits::environmentMap};
         }
-        if (_nodeTextures.bumpmap) {
-            if (_nodeTextures.bumpmap->isGrayscale()) {
-                general.featureMask |= UniformsFeatureFlags::heightmap;
-                general.heightMapScaling = _nodeTextures.bumpmap->features().bumpMapScaling;
-                int bumpmapW = _nodeTextures.bumpmap->width();
-                int bumpmapH = _nodeTextures.bumpmap->height();
-                if (_nodeTextures.bumpmap->features().procedureType == Texture::ProcedureType::Cycle) {
-                    int gridX = _nodeTextures.bumpmap->features().numX;
-                    int gridY = _nodeTextures.bumpmap->features().numY;
-                    int frameW = bumpmapW / gridX;
-                    int frameH = bumpmapH / gridY;
-                    general.heightMapFrameBounds = glm::vec4(
-                        static_cast<float>(frameW * (_bumpmapCycleFrame % gridX)),
-                        static_cast<float>(frameH * (_bumpmapCycleFrame / gridX)),
-                        static_cast<float>(frameW),
-                        static_cast<float>(frameH));
-                } else {
-                    general.heightMapFrameBounds = glm::ivec4(
-                        0.0f,
-                        0.0f,
-                        static_cast<float>(bumpmapW),
-                        static_cast<float>(bumpmapH));
-                }
+    }
+    if (_nodeTextures.bumpmap) {
+        if (_nodeTextures.bumpmap->isGrayscale()) {
+            locals.featureMask |= UniformsFeatureFlags::heightmap;
+            locals.heightMapScaling = _nodeTextures.bumpmap->features().bumpMapScaling;
+            int bumpmapW = _nodeTextures.bumpmap->width();
+            int bumpmapH = _nodeTextures.bumpmap->height();
+            if (_nodeTextures.bumpmap->features().procedureType == Texture::ProcedureType::Cycle) {
+                int gridX = _nodeTextures.bumpmap->features().numX;
+                int gridY = _nodeTextures.bumpmap->features().numY;
+                int frameW = bumpmapW / gridX;
+                int frameH = bumpmapH / gridY;
+                locals.heightMapFrameBounds = glm::vec4(
+                    static_cast<float>(frameW * (_bumpmapCycleFrame % gridX)),
+                    static_cast<float>(frameH * (_bumpmapCycleFrame / gridX)),
+                    static_cast<float>(frameW),
+                    static_cast<float>(frameH));
             } else {
-                general.featureMask |= UniformsFeatureFlags::normalmap;
+                locals.heightMapFrameBounds = glm::ivec4(
+                    0.0f,
+                    0.0f,
+                    static_cast<float>(bumpmapW),
+                    static_cast<float>(bumpmapH));
             }
-            _graphicsSvc.textures.bind(*_nodeTextures.bumpmap, TextureUnits::bumpMap);
-        }
-        if (mesh->skin) {
-            general.featureMask |= UniformsFeatureFlags::skeletal;
-        }
-        bool receivesShadows = isReceivingShadows(_model, *this);
-        if (receivesShadows && _sceneGraph.hasShadowLight()) {
-            general.featureMask |= UniformsFeatureFlags::shadows;
+        } else {
+            locals.featureMask |= UniformsFeatureFlags::normalmap;
         }
-        if (_sceneGraph.isFogEnabled() && _model.model().isAffectedByFog()) {
-            general.featureMask |= UniformsFeatureFlags::fog;
-        }
-    });
+        command.textures[3] = DrawTexture {_nodeTextures.bumpmap, TextureUnits::bumpMap};
+    }
+    if (mesh->skin) {
+        locals.featureMask |= UniformsFeatureFlags::skeletal;
+    }
+    bool receivesShadows = isReceivingShadows(_model, *this);
+    if (receivesShadows && _sceneGraph.hasShadowLight()) {
+        locals.featureMask |= UniformsFeatureFlags::shadows;
+    }
+    if (_sceneGraph.isFogEnabled() && _model.model().isAffectedByFog()) {
+        locals.featureMask |= UniformsFeatureFlags::fog;
+    }
 
     auto &skin = mesh->skin;
     if (skin) {
-        _graphicsSvc.uniforms.setSkeletal([this, &skin](auto &skeletal) {
-            for (size_t i = 0; i < kMaxBones; ++i) {
-                if (i >= skin->boneNodeNumber.size()) {
-                    break;
-                }
-                auto nodeNumber = skin->boneNodeNumber[i];
-                if (nodeNumber == 0xffff) {
-                    continue;
-                }
-                auto bone = _model.getNodeByNumber(nodeNumber);
-                if (!bone) {
-                    continue;
-                }
-                skeletal.bones[i] = _modelNode.absoluteTransformInverse() *
-                                    _model.absoluteTransformInverse() *
-                                    bone->absoluteTransform() *
-                                    skin->boneMatrices[skin->boneSerial[i]];
+        int numBones = static_cast<int>(std::min(skin->boneNodeNumber.size(), static_cast<size_t>(kMaxBones)));
+        for (int i = 0; i < numBones; ++i) {
+            bones[i] = glm::mat4(1.0f);
+            auto nodeNumber = skin->boneNodeNumber[i];
+            if (nodeNumber == 0xffff) {
+                continue;
             }
-        });
+            auto bone = _model.getNodeByNumber(nodeNumber);
+            if (!bone) {
+                continue;
+            }
+            bones[i] = _modelNode.absoluteTransformInverse() *
+                       _model.absoluteTransformInverse() *
+                       bone->absoluteTransform() *
+                       skin->boneMatrices[skin->boneSerial[i]];
+        }
+        command.numBones = numBones;
     }
 
-    _graphicsSvc.shaders.use(transparent ? ShaderProgramId::ModelTransparent : ShaderProgramId::ModelOpaque);
-    _graphicsSvc.context.withFaceCulling(CullFaceMode::Back, [&mesh]() {
-        mesh->mesh->draw();
-    });
-}
-
-void MeshSceneNode::drawShadow() {
-    std::shared_ptr<ModelNode::TriangleMesh> mesh(_modelNode.mesh());
-    if (!mesh) {
-        return;
-    }
-    _graphicsSvc.uniforms.setGeneral([this](auto &general) {
-        general.resetLocals();
-        general.model = _absTransform;
-        general.modelInv = _absTransformInv;
-        general.alpha = _alpha;
-    });
-    _graphicsSvc.shaders.use(_sceneGraph.isShadowLightDirectional() ? ShaderProgramId::DirectionalLightShadows : ShaderProgramId::PointLightShadows);
-    mesh->mesh->draw();
+    return true;
 }
 
 bool MeshSceneNode::isLightingEnabled() const {
@@ -316,11 +358,29 @@ void MeshSceneNode::setDiffuseMap(Texture *texture) {
     ModelNodeSceneNode::setDiffuseMap(texture);
     _nodeTextures.diffuse = texture;
     refreshAdditionalTextures();
+    refreshTransparency();
 }
 
 void MeshSceneNode::setEnvironmentMap(Texture *texture) {
     ModelNodeSceneNode::setEnvironmentMap(texture);
     _nodeTextures.envmap = std::move(texture);
+    refreshTransparency();
+}
+
+void MeshSceneNode::setAlpha(float alpha) {
+    if (_alpha == alpha) {
+        return;
+    }
+    _alpha = alpha;
+    refreshTransparency();
+}
+
+void MeshSceneNode::setSelfIllumColor(glm::vec3 color) {
+    if (_selfIllumColor == color) {
+        return;
+    }
+    _selfIllumColor = std::move(color);
+    refreshTransparency();
 }
 
 } // namespace scene
@@ -60,7 +60,7 @@ ModelSceneNode::ModelSceneNode(
 }
 
 void ModelSceneNode::init() {
-    if (!_nodeByNumber.empty()) {
+    if (!_nodes.empty()) {
         return;
     }
     buildNodeTree(*_model->rootNode(), *this);
@@ -90,6 +90,10 @@ void ModelSceneNode::buildNodeTree(ModelNode &node, SceneNode &parent) {
         sceneNode->setLocalTransform(node.localTransform());
         parent.addChild(*sceneNode);
     }
+    _nodes.push_back(sceneNode.get());
+    if (node.number() >= _nodeByNumber.size()) {
+        _nodeByNumber.resize(node.number() + 1, nullptr);
+    }
     _nodeByNumber[node.number()] = sceneNode.get();
     _nodeByName[node.name()] = sceneNode.get();
 
@@ -106,13 +110,33 @@ void ModelSceneNode::buildNodeTree(ModelNode &node, SceneNode &parent) {
     }
 }
 
+void ModelSceneNode::computeNodeTransforms() {
+    // Parents precede their children, so each absolute transform is computed once
+    for (auto &node : _nodes) {
+        node->absoluteTransform();
+    }
+}
+
 void ModelSceneNode::update(float dt) {
     // Optimization: skip invisible models
     if (!_enabled) {
         return;
     }
     SceneNode::update(dt);
+
+    bool animationFinished = isAnimationFinished();
     updateAnimations(dt);
+
+    // Meshes of placeables cast static shadows once their animation is finished
+    if (_usage == ModelUsage::Placeable && isAnimationFinished() != animationFinished) {
+        _sceneGraph.invalidateStaticShadows();
+    }
+}
+
+void ModelSceneNode::onAbsoluteTransformChanged() {
+    if (_usage == ModelUsage::Placeable) {
+        _sceneGraph.invalidateStaticShadows();
+    }
 }
 
 void ModelSceneNode::drawLeafs(const std::vector<SceneNode *> &leafs) {
@@ -125,7 +149,7 @@ void ModelSceneNode::drawAABB() {
     _graphicsSvc.context.withPolygonMode(PolygonMode::Line, [this]() {
         _graphicsSvc.uniforms.setGeneral([this](auto &u) {
             u.resetLocals();
-            u.model = _absTransform;
+            u.model = absoluteTransform();
             u.model *= glm::translate(_aabb.center());
             u.model *= glm::scale(0.5f * _aabb.size());
             u.modelInv = glm::inverse(u.model);
@@ -138,9 +162,9 @@ void ModelSceneNode::drawAABB() {
 void ModelSceneNode::computeAABB() {
     _aabb.reset();
 
-    for (auto &node : _nodeByNumber) {
-        if (node.second->type() == SceneNodeType::Mesh) {
-            auto &modelNode = node.second->modelNode();
+    for (auto &node : _nodes) {
+        if (node->type() == SceneNodeType::Mesh) {
+            auto &modelNode = node->modelNode();
             auto mesh = modelNode.mesh();
             if (!mesh || !mesh->mesh) {
                 continue;
@@ -152,7 +176,7 @@ void ModelSceneNode::computeAABB() {
 
     for (auto &attachment : _attachments) {
         if (attachment.second->type() == SceneNodeType::Model) {
-            AABB modelSpaceAABB(attachment.second->aabb() * attachment.second->absoluteTransform() * _absTransformInv);
+            AABB modelSpaceAABB(attachment.second->aabb() * attachment.second->absoluteTransform() * absoluteTransformInverse());
             _aabb.expand(modelSpaceAABB);
         }
     }
@@ -160,9 +184,9 @@ void ModelSceneNode::computeAABB() {
 
 void ModelSceneNode::signalEvent(const std::string &name) {
     if (name == "detonate") {
-        for (auto &node : _nodeByNumber) {
-            if (node.second->type() == SceneNodeType::Emitter) {
-                static_cast<EmitterSceneNode *>(node.second)->detonate();
+        for (auto &node : _nodes) {
+            if (node->type() == SceneNodeType::Emitter) {
+                static_cast<EmitterSceneNode *>(node)->detonate();
             }
         }
     } else if (_animEventListener) {
@@ -181,11 +205,11 @@ void ModelSceneNode::attach(const std::string &parentName, SceneNode &node) {
     _attachments.insert(std::make_pair(parentName, &node));
 
     computeAABB();
+    _sceneGraph.onModelChanged(*this);
 }
 
 ModelNodeSceneNode *ModelSceneNode::getNodeByNumber(uint16_t number) {
-    auto it = _nodeByNumber.find(number);
-    return it != _nodeByNumber.end() ? it->second : nullptr;
+    return number < _nodeByNumber.size() ? _nodeByNumber[number] : nullptr;
 }
 
 ModelNodeSceneNode *ModelSceneNode::getNodeByName(const std::string &name) {
@@ -329,6 +353,7 @@ void ModelSceneNode::updateAnimations(float dt) {
     // Apply states and compute bone transforms only when this model is not culled
     if (!_culled) {
         applyAnimationStates(*_model->rootNode());
+        computeNodeTransforms();
     }
 }
 
@@ -460,9 +485,8 @@ void ModelSceneNode::computeAnimationStates(AnimationChannel &channel, float tim
 }
 
 void ModelSceneNode::applyAnimationStates(const ModelNode &modelNode) {
-    auto maybeSceneNode = _nodeByNumber.find(modelNode.number());
-    if (maybeSceneNode != _nodeByNumber.end()) {
-        auto sceneNode = maybeSceneNode->second;
+    auto sceneNode = getNodeByNumber(modelNode.number());
+    if (sceneNode) {
         AnimationState combined;
 
         switch (_animBlendMode) {
@@ -581,6 +605,7 @@ void ModelSceneNode::setModel(Model &model) {
 
     _model = &model;
 
+    _nodes.clear();
     _nodeByName.clear();
     _nodeByNumber.clear();
     _attachments.clear();
@@ -590,6 +615,7 @@ void ModelSceneNode::setModel(Model &model) {
 
     buildNodeTree(*_model->rootNode(), *this);
     computeAABB();
+    _sceneGraph.onModelChanged(*this);
 }
 
 } // namespace scene
@@ -97,7 +97,7 @@ void TriggerSceneNode::init() {
 void TriggerSceneNode::draw() {
     _graphicsSvc.uniforms.setGeneral([this](auto &general) {
         general.resetLocals();
-        general.model = _absTransform;
+        general.model = absoluteTransform();
     });
     _graphicsSvc.shaders.use(ShaderProgramId::Walkmesh);
     _graphicsSvc.context.withFaceCulling(CullFaceMode::Back, [this]() {
@@ -108,7 +108,7 @@ void TriggerSceneNode::draw() {
 bool TriggerSceneNode::isIn(const glm::vec2 &pt) const {
     static glm::vec3 down(0.0f, 0.0f, -1.0f);
 
-    auto pointObjSpace = glm::vec3(_absTransformInv * glm::vec4(pt, 1000.0f, 1.0f));
+    auto pointObjSpace = glm::vec3(absoluteTransformInverse() * glm::vec4(pt, 1000.0f, 1.0f));
     auto intersection = glm::vec2(0.0f);
     float distance = 0.0f;
 
@@ -60,13 +60,13 @@ void WalkmeshSceneNode::init() {
     spec.offNormals = 3 * sizeof(float);
     spec.offMaterial = 6 * sizeof(float);
 
-    _mesh = std::make_unique<Mesh>(std::move(vertices), std::move(faces), std::move(spec));
+    _mesh = std::make_unique<Mesh>(std::move(vertices), std::move(faces), std::move(spec), Mesh::Residency::GpuOnly);
 }
 
 void WalkmeshSceneNode::draw() {
     _graphicsSvc.uniforms.setGeneral([this](auto &general) {
         general.resetLocals();
-        general.model = _absTransform;
+        general.model = absoluteTransform();
     });
     _graphicsSvc.shaders.use(ShaderProgramId::Walkmesh);
     _graphicsSvc.context.withFaceCulling(CullFaceMode::Back, [this]() {
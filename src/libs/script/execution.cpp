@@ -24,6 +24,7 @@
 #include "reone/script/routines.h"
 #include "reone/script/variable.h"
 #include "reone/system/logutil.h"
+#include "reone/system/profiler.h"
 
 namespace reone {
 
@@ -137,6 +138,26 @@ ScriptExecution::ScriptExecution(std::shared_ptr<ScriptProgram> program, std::un
 }
 
 int ScriptExecution::run() {
+    PROFILE_ZONE("ScriptExecution::run");
+
+    // Native scripts never store state, so resuming one is always interpreted
+    auto native = _program->native();
+    if (native && !_context->savedState) {
+        if (isLogEnabled(LogSeverity::Debug, LogChannel::Script)) {
+            debug(boost::format("Run native '%s': caller=%u, triggerrer=%u") %
+                      _program->name() %
+                      _context->callerId %
+                      _context->triggererId,
+                  LogChannel::Script);
+        }
+        try {
+            return native(*_context);
+        } catch (const std::exception &ex) {
+            debug(boost::format("Halt '%s'") % _program->name(), LogChannel::Script);
+            return -1;
+        }
+    }
+
     uint32_t insOff = kStartInstructionOffset;
 
     if (_context->savedState) {
@@ -150,12 +171,14 @@ int ScriptExecution::run() {
         insOff = _context->savedState->insOffset;
     }
 
-    debug(boost::format("Run '%s': offset=%04x, caller=%u, triggerrer=%u") %
-              _program->name() %
-              insOff %
-              _context->callerId %
-              _context->triggererId,
-          LogChannel::Script);
+    if (isLogEnabled(LogSeverity::Debug, LogChannel::Script)) {
+        debug(boost::format("Run '%s': offset=%04x, caller=%u, triggerrer=%u") %
+                  _program->name() %
+                  insOff %
+                  _context->callerId %
+                  _context->triggererId,
+              LogChannel::Script);
+    }
 
     while (insOff < _program->length()) {
         const Instruction &ins = _program->getInstruction(insOff);
@@ -167,7 +190,7 @@ int ScriptExecution::run() {
         }
         _nextInstruction = ins.nextOffset;
 
-        if (isLogChannelEnabled(LogChannel::Script3)) {
+        if (isLogEnabled(LogSeverity::Debug, LogChannel::Script3)) {
             debug(boost::format("Instruction: %s") % describeInstruction(ins, *_context->routines), LogChannel::Script3);
         }
         try {
@@ -261,40 +284,64 @@ void ScriptExecution::executeACTION(const Instruction &ins) {
         throw std::invalid_argument("Too many routine arguments");
     }
 
-    std::vector<Variable> args;
-    for (int i = 0; i < ins.argCount; ++i) {
-        VariableType type = routine.getArgumentType(i);
-        switch (type) {
-        case VariableType::Vector:
-            args.push_back(Variable::ofVector(getVectorFromStack()));
-            break;
-
-        case VariableType::Action: {
-            auto ctx = std::make_shared<ExecutionContext>(*_context);
-            ctx->savedState = std::make_shared<ExecutionState>(_savedState);
-            args.push_back(Variable::ofAction(std::move(ctx)));
-            break;
+    // Arguments are pushed in reverse order, so that the first one is on top
+    // of the stack. Unless there are vector or action arguments, routine
+    // reads them in place, and they are popped after the call.
+    bool stackArgs = routine.hasStackArguments();
+    VariableSpan args;
+    if (stackArgs) {
+        if (ins.argCount > static_cast<int>(_stack.size())) {
+            throw std::runtime_error("Stack underflow");
         }
-        default:
-            Variable var(_stack.back());
-            if (var.type != type) {
+        for (int i = 0; i < ins.argCount; ++i) {
+            if (_stack[_stack.size() - 1 - i].type != routine.getArgumentType(i)) {
                 throw std::runtime_error("Invalid argument variable type");
             }
-            args.push_back(std::move(var));
-            _stack.pop_back();
-            break;
         }
+        if (ins.argCount > 0) {
+            args = VariableSpan(&_stack.back(), ins.argCount, -1);
+        }
+    } else {
+        _routineArgs.clear();
+        for (int i = 0; i < ins.argCount; ++i) {
+            VariableType type = routine.getArgumentType(i);
+            switch (type) {
+            case VariableType::Vector:
+                _routineArgs.push_back(Variable::ofVector(getVectorFromStack()));
+                break;
+
+            case VariableType::Action: {
+                auto ctx = std::make_shared<ExecutionContext>(*_context);
+                ctx->savedState = std::make_shared<ExecutionState>(_savedState);
+                _routineArgs.push_back(Variable::ofAction(std::move(ctx)));
+                break;
+            }
+            default:
+                if (_stack.back().type != type) {
+                    throw std::runtime_error("Invalid argument variable type");
+                }
+                _routineArgs.push_back(std::move(_stack.back()));
+                _stack.pop_back();
+                break;
+            }
+        }
+        args = VariableSpan(_routineArgs);
     }
 
     Variable retValue = routine.invoke(args, *_context);
-    if (isLogChannelEnabled(LogChannel::Script2)) {
+    if (isLogEnabled(LogSeverity::Debug, LogChannel::Script2)) {
         std::vector<std::string> argStrings;
-        for (auto &arg : args) {
-            argStrings.push_back(arg.toString());
+        for (size_t i = 0; i < args.size(); ++i) {
+            argStrings.push_back(args[i].toString());
         }
         std::string argsString(boost::join(argStrings, ", "));
         debug(boost::format("Action: %04x %s(%s) -> %s") % ins.offset % routine.name() % argsString % retValue.toString(), LogChannel::Script2);
     }
+    if (stackArgs) {
+        _stack.erase(_stack.end() - ins.argCount, _stack.end());
+    } else {
+        _routineArgs.clear();
+    }
     switch (routine.returnType()) {
     case VariableType::Void:
         break;
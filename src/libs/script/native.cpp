@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/script/native.h"
+
+namespace reone {
+
+namespace script {
+
+void NativeScripts::add(std::string resRef, uint32_t hash, NativeScriptFunc func) {
+    _scripts[std::move(resRef)].push_back(NativeScript {hash, func});
+}
+
+NativeScriptFunc NativeScripts::find(const std::string &resRef, uint32_t hash) const {
+    auto maybeScripts = _scripts.find(resRef);
+    if (maybeScripts == _scripts.end()) {
+        return nullptr;
+    }
+    for (auto &script : maybeScripts->second) {
+        if (script.hash == hash) {
+            return script.func;
+        }
+    }
+    return nullptr;
+}
+
+uint32_t hashScriptBytes(const char *bytes, size_t size) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= static_cast<uint8_t>(bytes[i]);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+} // namespace script
+
+} // namespace reone
@@ -27,7 +27,7 @@ namespace reone {
 
 namespace script {
 
-Variable Routine::invoke(const std::vector<Variable> &args, ExecutionContext &ctx) {
+Variable Routine::invoke(const VariableSpan &args, ExecutionContext &ctx) {
     try {
         return _func(args, ctx);
     } catch (const RoutineNotImplementedException &ex) {
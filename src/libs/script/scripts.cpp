@@ -35,7 +35,12 @@ std::shared_ptr<ScriptProgram> Scripts::doGet(std::string resRef) {
     auto stream = MemoryInputStream(res->data);
     auto reader = NcsReader(stream, resRef);
     reader.load();
-    return reader.program();
+    auto program = reader.program();
+    if (!_natives.empty()) {
+        auto hash = hashScriptBytes(res->data.data(), res->data.size());
+        program->setNative(_natives.find(resRef, hash));
+    }
+    return program;
 }
 
 } // namespace script
@@ -20,6 +20,13 @@
 
 namespace reone {
 
+template <class T>
+static void reverseByteOrder(T *values, int count) {
+    for (int i = 0; i < count; ++i) {
+        values[i] = boost::endian::endian_reverse(values[i]);
+    }
+}
+
 uint8_t BinaryReader::readByte() {
     return static_cast<uint8_t>(_stream.readByte());
 }
@@ -139,4 +146,42 @@ ByteBuffer BinaryReader::readBytes(int count) {
     return buf;
 }
 
+void BinaryReader::readUint16Array(uint16_t *out, int count) {
+    readBulk(reinterpret_cast<char *>(out), count * sizeof(uint16_t));
+    if (_endianess != boost::endian::order::native) {
+        reverseByteOrder(out, count);
+    }
+}
+
+void BinaryReader::readUint32Array(uint32_t *out, int count) {
+    readBulk(reinterpret_cast<char *>(out), count * sizeof(uint32_t));
+    if (_endianess != boost::endian::order::native) {
+        reverseByteOrder(out, count);
+    }
+}
+
+void BinaryReader::readInt32Array(int32_t *out, int count) {
+    readBulk(reinterpret_cast<char *>(out), count * sizeof(int32_t));
+    if (_endianess != boost::endian::order::native) {
+        reverseByteOrder(reinterpret_cast<uint32_t *>(out), count);
+    }
+}
+
+void BinaryReader::readFloatArray(float *out, int count) {
+    static_assert(sizeof(float) == sizeof(uint32_t), "Unsupported float size");
+    readBulk(reinterpret_cast<char *>(out), count * sizeof(float));
+    if (_endianess != boost::endian::order::native) {
+        reverseByteOrder(reinterpret_cast<uint32_t *>(out), count);
+    }
+}
+
+void BinaryReader::readBulk(char *out, size_t size) {
+    if (size == 0) {
+        return;
+    }
+    if (_stream.read(out, static_cast<int>(size)) != static_cast<int>(size)) {
+        throw EndOfStreamException();
+    }
+}
+
 } // namespace reone
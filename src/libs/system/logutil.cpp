@@ -17,90 +17,175 @@
 
 #include "reone/system/logutil.h"
 
-#include <boost/log/expressions.hpp>
-#include <boost/log/sources/record_ostream.hpp>
-#include <boost/log/sources/severity_channel_logger.hpp>
-#include <boost/log/utility/setup.hpp>
+#include "reone/system/mpscringbuffer.h"
 
 namespace reone {
 
-BOOST_LOG_ATTRIBUTE_KEYWORD(channel, "Channel", LogChannel)
-BOOST_LOG_ATTRIBUTE_KEYWORD(severity, "Severity", LogSeverity)
-
-using SeverityChannelLogger = boost::log::sources::severity_channel_logger_mt<LogSeverity, LogChannel>;
-
-static const std::unordered_map<LogSeverity, std::string> kSeverityToName {
-    {LogSeverity::Error, "ERROR"},
-    {LogSeverity::Warn, "WARN"},
-    {LogSeverity::Info, "INFO"},
-    {LogSeverity::Debug, "DEBUG"}};
-
-static const std::unordered_map<LogChannel, std::string> kChannelToName {
-    {LogChannel::Global, "global"},
-    {LogChannel::Resources, "resources"},
-    {LogChannel::Resources2, "resources"},
-    {LogChannel::Graphics, "graphics"},
-    {LogChannel::Audio, "audio"},
-    {LogChannel::GUI, "gui"},
-    {LogChannel::Perception, "perception"},
-    {LogChannel::Conversation, "conversation"},
-    {LogChannel::Combat, "combat"},
-    {LogChannel::Script, "script"},
-    {LogChannel::Script2, "script"},
-    {LogChannel::Script3, "script"}};
-
-static LogSeverity g_minSeverity = LogSeverity::None;
-static std::set<LogChannel> g_enabledChannels;
-
-static std::unordered_map<LogChannel, SeverityChannelLogger> g_channelToLogger {
-    {LogChannel::Global, SeverityChannelLogger {boost::log::keywords::channel = LogChannel::Global}},             //
-    {LogChannel::Resources, SeverityChannelLogger {boost::log::keywords::channel = LogChannel::Resources}},       //
-    {LogChannel::Resources2, SeverityChannelLogger {boost::log::keywords::channel = LogChannel::Resources2}},     //
-    {LogChannel::Graphics, SeverityChannelLogger {boost::log::keywords::channel = LogChannel::Graphics}},         //
-    {LogChannel::Audio, SeverityChannelLogger {boost::log::keywords::channel = LogChannel::Audio}},               //
-    {LogChannel::GUI, SeverityChannelLogger {boost::log::keywords::channel = LogChannel::GUI}},                   //
-    {LogChannel::Perception, SeverityChannelLogger {boost::log::keywords::channel = LogChannel::Perception}},     //
-    {LogChannel::Conversation, SeverityChannelLogger {boost::log::keywords::channel = LogChannel::Conversation}}, //
-    {LogChannel::Combat, SeverityChannelLogger {boost::log::keywords::channel = LogChannel::Combat}},             //
-    {LogChannel::Script, SeverityChannelLogger {boost::log::keywords::channel = LogChannel::Script}},             //
-    {LogChannel::Script2, SeverityChannelLogger {boost::log::keywords::channel = LogChannel::Script2}},           //
-    {LogChannel::Script3, SeverityChannelLogger {boost::log::keywords::channel = LogChannel::Script3}}            //
+static constexpr size_t kLogBufferCapacity = 4096;
+static constexpr std::chrono::milliseconds kLogWriterIdleTimeout {10};
+
+struct LogMessage {
+    LogSeverity severity {LogSeverity::Info};
+    LogChannel channel {LogChannel::Global};
+    std::string text;
 };
 
-static std::ostream &operator<<(std::ostream &stream, LogSeverity severity) {
-    stream << kSeverityToName.at(severity);
-    return stream;
+static const char *getSeverityName(LogSeverity severity) {
+    switch (severity) {
+    case LogSeverity::Error:
+        return "ERROR";
+    case LogSeverity::Warn:
+        return "WARN";
+    case LogSeverity::Info:
+        return "INFO";
+    case LogSeverity::Debug:
+        return "DEBUG";
+    default:
+        return "";
+    }
 }
 
-static std::ostream &operator<<(std::ostream &stream, LogChannel channel) {
-    stream << kChannelToName.at(channel);
-    return stream;
+static const char *getChannelName(LogChannel channel) {
+    switch (channel) {
+    case LogChannel::Global:
+        return "global";
+    case LogChannel::Resources:
+    case LogChannel::Resources2:
+        return "resources";
+    case LogChannel::Graphics:
+        return "graphics";
+    case LogChannel::Audio:
+        return "audio";
+    case LogChannel::GUI:
+        return "gui";
+    case LogChannel::Perception:
+        return "perception";
+    case LogChannel::Conversation:
+        return "conversation";
+    case LogChannel::Combat:
+        return "combat";
+    case LogChannel::Script:
+    case LogChannel::Script2:
+    case LogChannel::Script3:
+        return "script";
+    default:
+        return "";
+    }
 }
 
+/**
+ * Drains log messages, submitted from any thread, on a background thread.
+ */
+class LogWriter : boost::noncopyable {
+public:
+    ~LogWriter() {
+        deinit();
+    }
+
+    void init(std::string filename) {
+        deinit();
+        if (!filename.empty()) {
+            _file = std::make_unique<std::ofstream>(filename);
+        }
+        _running = true;
+        _thread = std::thread([this]() { run(); });
+    }
+
+    void deinit() {
+        if (!_thread.joinable()) {
+            return;
+        }
+        _running = false;
+        _condVar.notify_one();
+        _thread.join();
+        _file.reset();
+    }
+
+    void submit(LogSeverity severity, LogChannel channel, std::string text) {
+        auto message = LogMessage {severity, channel, std::move(text)};
+        // Block the producer, rather than lose a message, while the buffer is
+        // full. Once the writer has stopped, nothing drains the buffer, so the
+        // message is dropped instead.
+        while (!_messages.tryPush(std::move(message))) {
+            if (!_running) {
+                return;
+            }
+            _condVar.notify_one();
+            std::this_thread::yield();
+        }
+        if (severity >= LogSeverity::Warn) {
+            _condVar.notify_one();
+        }
+    }
+
+private:
+    MpscRingBuffer<LogMessage> _messages {kLogBufferCapacity};
+
+    std::thread _thread;
+    std::atomic_bool _running {false};
+    std::mutex _mutex;
+    std::condition_variable _condVar;
+
+    std::unique_ptr<std::ofstream> _file;
+
+    void run() {
+        auto &stream = _file ? static_cast<std::ostream &>(*_file) : std::clog;
+        LogMessage message;
+        while (true) {
+            bool running = _running;
+            bool written = false;
+            while (_messages.tryPop(message)) {
+                stream << getSeverityName(message.severity) << " [" << getChannelName(message.channel) << "] " << message.text << "\n";
+                written = true;
+            }
+            if (written) {
+                stream.flush();
+            }
+            if (!running) {
+                return;
+            }
+            std::unique_lock<std::mutex> lock(_mutex);
+            _condVar.wait_for(lock, kLogWriterIdleTimeout);
+        }
+    }
+};
+
+static std::atomic<int> g_minSeverity {static_cast<int>(LogSeverity::None)};
+static std::atomic<int> g_enabledChannels {0};
+
+static LogWriter g_writer;
+
 void initLog(LogSeverity minSeverity,
              std::set<LogChannel> enabledChannels,
              std::string filename) {
-    g_minSeverity = minSeverity;
-    g_enabledChannels = enabledChannels;
-
-    boost::log::core::get()->set_filter(severity >= minSeverity);
-    if (!filename.empty()) {
-        boost::log::add_file_log(
-            boost::log::keywords::file_name = filename,
-            boost::log::keywords::format = (boost::log::expressions::stream << severity << " [" << channel << "] " << boost::log::expressions::smessage));
-    } else {
-        boost::log::add_console_log(
-            std::clog,
-            boost::log::keywords::format = (boost::log::expressions::stream << severity << " [" << channel << "] " << boost::log::expressions::smessage));
+    int channelMask = 0;
+    for (auto &channel : enabledChannels) {
+        channelMask |= static_cast<int>(channel);
     }
-    boost::log::add_common_attributes();
+    g_writer.init(std::move(filename));
+    g_minSeverity = static_cast<int>(minSeverity);
+    g_enabledChannels = channelMask;
+}
+
+void deinitLog() {
+    g_minSeverity = static_cast<int>(LogSeverity::None);
+    g_enabledChannels = 0;
+    g_writer.deinit();
 }
 
 static void log(LogSeverity severity, const std::string &s, LogChannel channel) {
-    if (!isLogChannelEnabled(channel)) {
+    if (!isLogEnabled(severity, channel)) {
+        return;
+    }
+    g_writer.submit(severity, channel, s);
+}
+
+static void log(LogSeverity severity, const boost::format &s, LogChannel channel) {
+    // Skip formatting of filtered out messages
+    if (!isLogEnabled(severity, channel)) {
         return;
     }
-    BOOST_LOG_SEV(g_channelToLogger.at(channel), severity) << s;
+    g_writer.submit(severity, channel, str(s));
 }
 
 void error(const std::string &s, LogChannel channel) {
@@ -108,7 +193,7 @@ void error(const std::string &s, LogChannel channel) {
 }
 
 void error(const boost::format &s, LogChannel channel) {
-    log(LogSeverity::Error, str(s), channel);
+    log(LogSeverity::Error, s, channel);
 }
 
 void warn(const std::string &s, LogChannel channel) {
@@ -116,7 +201,7 @@ void warn(const std::string &s, LogChannel channel) {
 }
 
 void warn(const boost::format &s, LogChannel channel) {
-    log(LogSeverity::Warn, str(s), channel);
+    log(LogSeverity::Warn, s, channel);
 }
 
 void info(const std::string &s, LogChannel channel) {
@@ -124,7 +209,7 @@ void info(const std::string &s, LogChannel channel) {
 }
 
 void info(const boost::format &s, LogChannel channel) {
-    log(LogSeverity::Info, str(s), channel);
+    log(LogSeverity::Info, s, channel);
 }
 
 void debug(const std::string &s, LogChannel channel) {
@@ -132,11 +217,15 @@ void debug(const std::string &s, LogChannel channel) {
 }
 
 void debug(const boost::format &s, LogChannel channel) {
-    return debug(str(s), channel);
+    log(LogSeverity::Debug, s, channel);
 }
 
 bool isLogChannelEnabled(LogChannel channel) {
-    return g_enabledChannels.count(channel) > 0;
+    return (g_enabledChannels.load(std::memory_order_relaxed) & static_cast<int>(channel)) != 0;
+}
+
+bool isLogSeverityEnabled(LogSeverity severity) {
+    return static_cast<int>(severity) >= g_minSeverity.load(std::memory_order_relaxed);
 }
 
 } // namespace reone
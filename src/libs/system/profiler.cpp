@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/system/profiler.h"
+
+#include "reone/system/textwriter.h"
+
+namespace reone {
+
+static constexpr size_t kRingCapacity = 1 << 16;
+
+static const std::chrono::steady_clock::time_point g_epoch = std::chrono::steady_clock::now();
+
+static std::atomic_bool g_enabled {false};
+
+static std::mutex g_ringsMutex;
+static std::vector<std::shared_ptr<ProfileEventRing>> g_rings;
+
+std::vector<ProfileEvent> ProfileEventRing::snapshot() const {
+    uint64_t head = _head.load(std::memory_order_acquire);
+    uint64_t numSlots = _events.size();
+    uint64_t begin = head + 1 > numSlots ? head + 1 - numSlots : 0;
+
+    auto events = std::vector<ProfileEvent>();
+    events.reserve(static_cast<size_t>(head - begin));
+    for (uint64_t i = begin; i < head; ++i) {
+        events.push_back(_events[i % numSlots]);
+    }
+
+    // Drop events that the owning thread has overwritten while we were copying.
+    // Slot of the event at newHead may be in the middle of being written.
+    uint64_t newHead = _head.load(std::memory_order_acquire);
+    if (newHead + 1 > begin + numSlots) {
+        size_t numOverwritten = static_cast<size_t>(std::min(newHead + 1 - numSlots - begin, head - begin));
+        events.erase(events.begin(), events.begin() + numOverwritten);
+    }
+
+    return events;
+}
+
+static ProfileEventRing &threadRing() {
+    thread_local std::shared_ptr<ProfileEventRing> ring;
+    if (!ring) {
+        std::lock_guard<std::mutex> lock {g_ringsMutex};
+        ring = std::make_shared<ProfileEventRing>(static_cast<uint32_t>(g_rings.size() + 1), kRingCapacity);
+        g_rings.push_back(ring);
+    }
+    return *ring;
+}
+
+static std::vector<std::shared_ptr<ProfileEventRing>> allRings() {
+    std::lock_guard<std::mutex> lock {g_ringsMutex};
+    return g_rings;
+}
+
+void setProfilingEnabled(bool enabled) {
+    g_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool isProfilingEnabled() {
+    return g_enabled.load(std::memory_order_relaxed);
+}
+
+uint64_t profileTimestamp() {
+    auto elapsed = std::chrono::steady_clock::now() - g_epoch;
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+}
+
+void profileEvent(const char *name, uint64_t startNs, uint64_t endNs) {
+    threadRing().push(ProfileEvent {name, startNs, endNs});
+}
+
+std::vector<ProfileZoneStats> profileZoneStats(uint64_t startNs, uint64_t endNs) {
+    auto statsByName = std::map<std::string, ProfileZoneStats>();
+    for (auto &ring : allRings()) {
+        for (auto &event : ring->snapshot()) {
+            if (event.startNs < startNs || event.startNs >= endNs) {
+                continue;
+            }
+            auto &stats = statsByName[event.name];
+            stats.name = event.name;
+            ++stats.count;
+            stats.totalNs += event.endNs - event.startNs;
+        }
+    }
+    auto stats = std::vector<ProfileZoneStats>();
+    for (auto &[_, zoneStats] : statsByName) {
+        stats.push_back(zoneStats);
+    }
+    std::sort(stats.begin(), stats.end(), [](auto &l, auto &r) { return l.totalNs > r.totalNs; });
+    return stats;
+}
+
+static std::string escapeJson(const char *s) {
+    auto escaped = std::string();
+    for (const char *ch = s; *ch; ++ch) {
+        if (*ch == '"' || *ch == '\\') {
+            escaped.push_back('\\');
+        }
+        escaped.push_back(*ch);
+    }
+    return escaped;
+}
+
+void writeChromeTrace(IOutputStream &stream) {
+    auto writer = TextWriter(stream);
+    writer.writeLine("{\"displayTimeUnit\": \"ms\", \"traceEvents\": [");
+    bool first = true;
+    for (auto &ring : allRings()) {
+        for (auto &event : ring->snapshot()) {
+            auto line = str(boost::format("{\"name\": \"%s\", \"ph\": \"X\", \"pid\": 1, \"tid\": %u, \"ts\": %.3f, \"dur\": %.3f}") %
+                            escapeJson(event.name) %
+                            ring->threadId() %
+                            (event.startNs / 1000.0) %
+                            ((event.endNs - event.startNs) / 1000.0));
+            writer.write(first ? "  " : ",\n  ");
+            writer.write(line);
+            first = false;
+        }
+    }
+    writer.writeLine("");
+    writer.writeLine("]}");
+}
+
+} // namespace reone
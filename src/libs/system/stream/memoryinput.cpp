@@ -20,15 +20,14 @@
 namespace reone {
 
 int MemoryInputStream::read(char *outData, int length) {
+    if (_position >= _length || length <= 0) {
+        return 0;
+    }
     size_t available = _length - _position;
     size_t numRead = std::min(available, static_cast<size_t>(length));
     std::memcpy(outData, &_data[_position], numRead);
-    if (numRead < length) {
-        _position = _length;
-    } else {
-        _position += length;
-    }
-    return numRead;
+    _position += numRead;
+    return static_cast<int>(numRead);
 }
 
 } // namespace reone
@@ -21,12 +21,12 @@ namespace reone {
 
 void ThreadPool::init() {
     if (_numThreads == -1) {
-        _numThreads = static_cast<int>(std::thread::hardware_concurrency());
+        _numThreads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
     }
+    _running = true;
     for (auto i = 0; i < _numThreads; ++i) {
         _threads.emplace_back(std::bind(&ThreadPool::workerThreadFunc, this));
     }
-    _running = true;
 }
 
 void ThreadPool::deinit() {
@@ -43,4 +43,34 @@ void ThreadPool::deinit() {
     _threads.clear();
 }
 
+void parallelFor(IThreadPool &pool, size_t count, const std::function<void(size_t)> &func) {
+    size_t numCompleted = 0;
+    std::exception_ptr firstException;
+    std::mutex mutex;
+    std::condition_variable completed;
+
+    for (size_t i = 0; i < count; ++i) {
+        pool.enqueue([&, i](auto &) {
+            std::exception_ptr exception;
+            try {
+                func(i);
+            } catch (...) {
+                exception = std::current_exception();
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            if (exception && !firstException) {
+                firstException = exception;
+            }
+            ++numCompleted;
+            completed.notify_one();
+        });
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+    completed.wait(lock, [&]() { return numCompleted == count; });
+    if (firstException) {
+        std::rethrow_exception(firstException);
+    }
+}
+
 } // namespace reone
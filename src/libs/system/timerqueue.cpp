@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/system/timerqueue.h"
+
+namespace reone {
+
+uint32_t TimerQueue::schedule(float delay, Callback callback) {
+    uint32_t id = _nextId++;
+    if (_nextId == 0) {
+        _nextId = 1;
+    }
+    Entry entry;
+    entry.due = _time + std::max(0.0f, delay);
+    entry.id = id;
+    entry.callback = std::move(callback);
+    _heap.push_back(std::move(entry));
+    std::push_heap(_heap.begin(), _heap.end(), EntryLater());
+    _pending.insert(id);
+    return id;
+}
+
+bool TimerQueue::cancel(uint32_t id) {
+    // Entry stays in the heap and is skipped once it becomes due
+    return _pending.erase(id) > 0;
+}
+
+void TimerQueue::update(float dt) {
+    _time += dt;
+
+    std::vector<Entry> due;
+    while (!_heap.empty() && _heap.front().due <= _time) {
+        std::pop_heap(_heap.begin(), _heap.end(), EntryLater());
+        if (_pending.erase(_heap.back().id) > 0) {
+            due.push_back(std::move(_heap.back()));
+        }
+        _heap.pop_back();
+    }
+    for (auto &entry : due) {
+        entry.callback();
+    }
+}
+
+void TimerQueue::clear() {
+    _heap.clear();
+    _pending.clear();
+}
+
+} // namespace reone
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/tools/batch.h"
+
+#include "reone/system/threadpool.h"
+
+namespace reone {
+
+static std::optional<std::string> invokeItem(const BatchExecutor::ItemFunc &func, const std::filesystem::path &path) {
+    try {
+        func(path);
+        return std::nullopt;
+    } catch (const std::exception &e) {
+        return std::string(e.what());
+    } catch (...) {
+        return std::string("Unknown error");
+    }
+}
+
+std::vector<BatchError> BatchExecutor::execute(const std::vector<std::filesystem::path> &input,
+                                               const ItemFunc &func,
+                                               const ProgressFunc &progress) {
+    int numWorkers = _numWorkers;
+    if (numWorkers == -1) {
+        numWorkers = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+    numWorkers = std::min(numWorkers, static_cast<int>(input.size()));
+    if (numWorkers <= 1) {
+        return executeSequential(input, func, progress);
+    } else {
+        return executeParallel(numWorkers, input, func, progress);
+    }
+}
+
+std::vector<BatchError> BatchExecutor::executeSequential(const std::vector<std::filesystem::path> &input,
+                                                         const ItemFunc &func,
+                                                         const ProgressFunc &progress) {
+    std::vector<BatchError> errors;
+    for (size_t i = 0; i < input.size(); ++i) {
+        if (progress) {
+            progress(i, input.size());
+        }
+        auto error = invokeItem(func, input[i]);
+        if (error) {
+            errors.emplace_back(input[i], std::move(*error));
+        }
+    }
+    if (progress) {
+        progress(input.size(), input.size());
+    }
+    return errors;
+}
+
+std::vector<BatchError> BatchExecutor::executeParallel(int numWorkers,
+                                                       const std::vector<std::filesystem::path> &input,
+                                                       const ItemFunc &func,
+                                                       const ProgressFunc &progress) {
+    // Slot per input path, so that errors can be reported in input order
+    std::vector<std::optional<std::string>> itemErrors(input.size());
+
+    std::atomic_size_t nextItem {0};
+    size_t numProcessed = 0;
+    std::mutex mutex;
+    std::condition_variable processed;
+
+    ThreadPool pool(numWorkers);
+    pool.init();
+    for (int i = 0; i < numWorkers; ++i) {
+        pool.enqueue([&](auto &) {
+            for (size_t idx = nextItem++; idx < input.size(); idx = nextItem++) {
+                itemErrors[idx] = invokeItem(func, input[idx]);
+                std::lock_guard<std::mutex> lock(mutex);
+                ++numProcessed;
+                processed.notify_one();
+            }
+        });
+    }
+
+    size_t numReported = 0;
+    if (progress) {
+        progress(0, input.size());
+    }
+    while (numReported < input.size()) {
+        std::unique_lock<std::mutex> lock(mutex);
+        processed.wait(lock, [&]() { return numProcessed > numReported; });
+        numReported = numProcessed;
+        lock.unlock();
+        if (progress) {
+            progress(numReported, input.size());
+        }
+    }
+    pool.deinit();
+
+    std::vector<BatchError> errors;
+    for (size_t i = 0; i < input.size(); ++i) {
+        if (itemErrors[i]) {
+            errors.emplace_back(input[i], std::move(*itemErrors[i]));
+        }
+    }
+    return errors;
+}
+
+} // namespace reone
@@ -50,7 +50,7 @@ void GffTool::invokeBatch(
     const std::filesystem::path &outputDir,
     const std::filesystem::path &gamePath) {
 
-    return doInvokeBatch(input, outputDir, [this, &operation](auto &path, auto &outDir) {
+    doInvokeBatch(input, outputDir, [this, &operation](auto &path, auto &outDir) {
         switch (operation) {
         case Operation::ToXML:
             toXML(path, outDir);
@@ -55,7 +55,7 @@ void NcsTool::invokeBatch(
     auto routines = Routines(_gameId, nullptr, nullptr);
     routines.init();
 
-    return doInvokeBatch(input, outputDir, [this, &operation, &routines](auto &path, auto &outDir) {
+    doInvokeBatch(input, outputDir, [this, &operation, &routines](auto &path, auto &outDir) {
         if (operation == Operation::ToPCODE) {
             toPCODE(path, outDir, routines);
         } else if (operation == Operation::ToNCS) {
@@ -225,7 +225,7 @@ void ExpressionTreeOptimizer::compact(ExpressionTree &tree, OptimizationContext
                     continue;
                 }
                 auto &paramEvents = ctx.parameters[paramExpr];
-                if (!paramEvents.writes.empty()) {
+                if (_compactVariables && !paramEvents.writes.empty()) {
                     auto &write = paramEvents.writes.front();
                     if (write.writeExpr->type == ExpressionType::Assign) {
                         debug(boost::format("Write-once variable declaration at %08x merged with initialization") % paramExpr->offset);
@@ -292,7 +292,7 @@ void ExpressionTreeOptimizer::compact(ExpressionTree &tree, OptimizationContext
                         continue;
                     }
                     auto &paramEvents = ctx.parameters[leftParam];
-                    if (paramEvents.writes.size() == 1ll && paramEvents.reads.size() == 1ll) {
+                    if (_compactVariables && paramEvents.writes.size() == 1ll && paramEvents.reads.size() == 1ll) {
                         auto &read = paramEvents.reads.front();
                         auto &write = paramEvents.writes.front();
                         if (!write.value) {
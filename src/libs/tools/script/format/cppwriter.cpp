@@ -0,0 +1,667 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/tools/script/format/cppwriter.h"
+
+#include "reone/script/routine.h"
+#include "reone/script/routines.h"
+#include "reone/script/variableutil.h"
+#include "reone/system/exception/notimplemented.h"
+#include "reone/system/stream/memoryoutput.h"
+#include "reone/system/textwriter.h"
+
+namespace reone {
+
+namespace script {
+
+void CppWriter::save(const std::string &className, IOutputStream &stream) {
+    const Function *mainFunc = nullptr;
+    for (auto &function : _program.functions()) {
+        if (function->name == "__start" || function->name == "__globals") {
+            throw std::invalid_argument("Expression tree must be optimized");
+        }
+        if (function->name == "main" || function->name == "StartingConditional") {
+            mainFunc = function.get();
+        }
+    }
+    if (!mainFunc) {
+        throw std::invalid_argument("Main function not found");
+    }
+    if (!mainFunc->arguments.empty()) {
+        throw NotImplementedException("Main function with arguments");
+    }
+    if (mainFunc->returnType != VariableType::Void && mainFunc->returnType != VariableType::Int) {
+        throw NotImplementedException("Main function returning " + describeVariableType(mainFunc->returnType));
+    }
+
+    auto globals = std::map<std::string, VariableType>();
+    for (auto &function : _program.functions()) {
+        auto locals = std::map<std::string, VariableType>();
+        collectParameters(*function, locals, globals);
+    }
+    auto globalValues = std::map<std::string, std::string>();
+    for (auto &global : _program.globals()) {
+        if (global.value.type == VariableType::Void) {
+            throw NotImplementedException(str(boost::format("Global variable at %08x has no constant initializer") % global.param->offset));
+        }
+        auto name = describeParameter(*global.param);
+        globals[name] = global.param->variableType;
+        globalValues[name] = describeConstant(global.value);
+    }
+
+    // Lowering may fail half way, so only write to the stream on success
+    auto bytes = ByteBuffer();
+    auto memory = MemoryOutputStream(bytes);
+    auto writer = TextWriter(memory);
+
+    writer.writeLine(str(boost::format("class %s {") % className));
+    writer.writeLine("public:");
+    writer.writeLine(str(boost::format("    %s(ExecutionContext &ctx) :") % className));
+    writer.writeLine("        _ctx(ctx) {");
+    writer.writeLine("    }");
+    writer.write("\n");
+    writer.writeLine("    static int run(ExecutionContext &ctx) {");
+    writer.writeLine(str(boost::format("        auto script = %s(ctx);") % className));
+    if (mainFunc->returnType == VariableType::Int) {
+        writer.writeLine(str(boost::format("        return script.%s();") % describeFunction(*mainFunc)));
+    } else {
+        writer.writeLine(str(boost::format("        script.%s();") % describeFunction(*mainFunc)));
+        writer.writeLine("        return -1;");
+    }
+    writer.writeLine("    }");
+    for (auto &function : _program.functions()) {
+        writer.write("\n");
+        writeFunction(*function, writer);
+    }
+    writer.write("\n");
+    writer.writeLine("private:");
+    writer.writeLine("    ExecutionContext &_ctx;");
+    for (auto &[name, type] : globals) {
+        auto maybeValue = globalValues.find(name);
+        auto value = maybeValue != globalValues.end() ? maybeValue->second : describeDefaultValue(type);
+        writer.writeLine(str(boost::format("    %s %s {%s};") % describeType(type) % name % value));
+    }
+    writer.writeLine("};");
+
+    stream.write(bytes.data(), static_cast<int>(bytes.size()));
+}
+
+void CppWriter::writeFunction(const Function &function, TextWriter &writer) {
+    auto params = std::vector<std::string>();
+    for (auto &argument : function.arguments) {
+        auto type = describeType(argument.type);
+        if (argument.pointer) {
+            params.push_back(str(boost::format("%s &arg_%08x") % type % argument.stackOffset));
+        } else {
+            params.push_back(str(boost::format("%s arg_%08x") % type % argument.stackOffset));
+        }
+    }
+    auto returnType = describeType(function.returnType);
+    auto name = describeFunction(function);
+    writer.writeLine(str(boost::format("    %s %s(%s) {") % returnType % name % boost::join(params, ", ")));
+
+    // Declaring all locals upfront keeps gotos from jumping over initialization
+    auto locals = std::map<std::string, VariableType>();
+    auto globals = std::map<std::string, VariableType>();
+    collectParameters(function, locals, globals);
+    for (auto &[localName, type] : locals) {
+        writer.writeLine(str(boost::format("        %s %s {%s};") % describeType(type) % localName % describeDefaultValue(type)));
+    }
+
+    auto ctx = WriteContext();
+    ctx.function = &function;
+    writeBlock(2, *function.block, ctx, writer);
+    writer.writeLine("    }");
+}
+
+void CppWriter::writeBlock(int level, const BlockExpression &block, WriteContext &ctx, TextWriter &writer) {
+    for (auto &expr : block.expressions) {
+        writeStatement(level, *expr, ctx, writer);
+    }
+}
+
+void CppWriter::writeStatement(int level, const Expression &expression, WriteContext &ctx, TextWriter &writer) {
+    auto indent = indentAtLevel(level);
+
+    if (expression.type == ExpressionType::Label) {
+        auto &labelExpr = static_cast<const LabelExpression &>(expression);
+        auto name = describeLabel(labelExpr);
+        if (ctx.writtenLabels.count(name) > 0) {
+            throw NotImplementedException("Label reachable from more than one block: " + name);
+        }
+        ctx.writtenLabels.insert(name);
+        writer.writeLine(indent + name + ":;");
+
+    } else if (expression.type == ExpressionType::Goto) {
+        auto &gotoExpr = static_cast<const GotoExpression &>(expression);
+        writer.writeLine(indent + "goto " + describeLabel(*gotoExpr.label) + ";");
+
+    } else if (expression.type == ExpressionType::Return) {
+        auto &returnExpr = static_cast<const ReturnExpression &>(expression);
+        if (returnExpr.value) {
+            writer.write(indent + "return ");
+            writeExpression(*returnExpr.value, writer);
+            writer.writeLine(";");
+        } else if (ctx.function->returnType == VariableType::Void) {
+            writer.writeLine(indent + "return;");
+        } else {
+            throw std::invalid_argument(str(boost::format("Return without value at %08x") % returnExpr.offset));
+        }
+
+    } else if (expression.type == ExpressionType::Parameter) {
+        // Standalone parameter reserves a stack variable, resetting it to default value
+        auto &paramExpr = static_cast<const ParameterExpression &>(expression);
+        if (paramExpr.locality == ParameterLocality::Local || paramExpr.locality == ParameterLocality::ReturnValue) {
+            auto name = describeParameter(paramExpr);
+            writer.writeLine(str(boost::format("%s%s = %s;") % indent % name % describeDefaultValue(paramExpr.variableType)));
+        }
+
+    } else if (expression.type == ExpressionType::Conditional) {
+        auto &condExpr = static_cast<const ConditionalExpression &>(expression);
+        writer.write(indent + "if (");
+        writeExpression(*condExpr.test, writer);
+        writer.writeLine(") {");
+        if (condExpr.ifTrue) {
+            auto &last = condExpr.ifTrue->expressions;
+            if (last.empty() || (last.back()->type != ExpressionType::Return && last.back()->type != ExpressionType::Goto)) {
+                throw NotImplementedException(str(boost::format("Block at %08x does not end with return or goto") % condExpr.ifTrue->offset));
+            }
+            writeBlock(level + 1, *condExpr.ifTrue, ctx, writer);
+        }
+        if (condExpr.ifFalse) {
+            writer.writeLine(indent + "} else {");
+            writeBlock(level + 1, *condExpr.ifFalse, ctx, writer);
+        }
+        writer.writeLine(indent + "}");
+
+    } else if (expression.type == ExpressionType::Block) {
+        writer.writeLine(indent + "{");
+        writeBlock(level + 1, static_cast<const BlockExpression &>(expression), ctx, writer);
+        writer.writeLine(indent + "}");
+
+    } else if (expression.type == ExpressionType::Assign) {
+        auto &assignExpr = static_cast<const BinaryExpression &>(expression);
+        if (assignExpr.left->type != ExpressionType::Parameter) {
+            throw std::invalid_argument("Left of assign expression must be parameter");
+        }
+        // Structure comparisons are decompiled into a chain reading the
+        // result before it is initialized
+        if ((assignExpr.right->type == ExpressionType::LogicalAnd || assignExpr.right->type == ExpressionType::LogicalOr) &&
+            static_cast<const BinaryExpression *>(assignExpr.right)->left == assignExpr.left) {
+            throw NotImplementedException(str(boost::format("Structure comparison at %08x") % assignExpr.offset));
+        }
+        writer.write(indent + describeParameter(*static_cast<const ParameterExpression *>(assignExpr.left)) + " = ");
+        writeExpression(*assignExpr.right, writer);
+        writer.writeLine(";");
+
+    } else if (expression.type == ExpressionType::Action) {
+        writer.write(indent);
+        writeAction(static_cast<const ActionExpression &>(expression), false, writer);
+        writer.writeLine(";");
+
+    } else if (expression.type == ExpressionType::Call) {
+        writer.write(indent);
+        writeExpression(expression, writer);
+        writer.writeLine(";");
+
+    } else if (expression.type == ExpressionType::Increment ||
+               expression.type == ExpressionType::Decrement) {
+        auto &unaryExpr = static_cast<const UnaryExpression &>(expression);
+        if (unaryExpr.operand->type != ExpressionType::Parameter) {
+            throw std::invalid_argument("Unary expression operand must be parameter");
+        }
+        auto name = describeParameter(*static_cast<const ParameterExpression *>(unaryExpr.operand));
+        writer.writeLine(indent + name + (expression.type == ExpressionType::Increment ? "++;" : "--;"));
+
+    } else {
+        writer.write(indent + "static_cast<void>(");
+        writeExpression(expression, writer);
+        writer.writeLine(");");
+    }
+}
+
+void CppWriter::writeExpression(const Expression &expression, TextWriter &writer) {
+    if (expression.type == ExpressionType::Constant) {
+        auto &constExpr = static_cast<const ConstantExpression &>(expression);
+        writer.write(describeConstant(constExpr.value));
+
+    } else if (expression.type == ExpressionType::Parameter) {
+        auto &paramExpr = static_cast<const ParameterExpression &>(expression);
+        writer.write(describeParameter(paramExpr));
+
+    } else if (expression.type == ExpressionType::Action) {
+        writeAction(static_cast<const ActionExpression &>(expression), true, writer);
+
+    } else if (expression.type == ExpressionType::Call) {
+        auto &callExpr = static_cast<const CallExpression &>(expression);
+        writer.write(describeFunction(*callExpr.function) + "(");
+        for (size_t i = 0; i < callExpr.arguments.size(); ++i) {
+            if (i > 0) {
+                writer.write(", ");
+            }
+            auto argExpr = callExpr.arguments[i];
+            if (callExpr.function->arguments[i].pointer && argExpr->type != ExpressionType::Parameter) {
+                throw std::invalid_argument(str(boost::format("Argument %d in function call at %08x must be parameter") % i % callExpr.offset));
+            }
+            writeExpression(*argExpr, writer);
+        }
+        writer.write(")");
+
+    } else if (expression.type == ExpressionType::Vector) {
+        auto &vecExpr = static_cast<const VectorExpression &>(expression);
+        auto xComp = describeParameter(*vecExpr.components[0]);
+        auto yComp = describeParameter(*vecExpr.components[1]);
+        auto zComp = describeParameter(*vecExpr.components[2]);
+        writer.write(str(boost::format("glm::vec3(%s, %s, %s)") % xComp % yComp % zComp));
+
+    } else if (expression.type == ExpressionType::VectorIndex) {
+        auto &indexExpr = static_cast<const VectorIndexExpression &>(expression);
+        auto name = describeParameter(*indexExpr.vector);
+        writer.write(str(boost::format("%s[%d]") % name % indexExpr.index));
+
+    } else if (expression.type == ExpressionType::Negate ||
+               expression.type == ExpressionType::Not ||
+               expression.type == ExpressionType::OnesComplement) {
+        auto &unaryExpr = static_cast<const UnaryExpression &>(expression);
+        if (expression.type == ExpressionType::Negate) {
+            writer.write("-");
+        } else if (expression.type == ExpressionType::Not) {
+            writer.write("!");
+        } else {
+            writer.write("~");
+        }
+        writeOperand(*unaryExpr.operand, writer);
+
+    } else if (ExpressionTree::isBinaryExpression(expression.type) && expression.type != ExpressionType::Assign) {
+        auto &binaryExpr = static_cast<const BinaryExpression &>(expression);
+        auto leftType = expressionType(*binaryExpr.left);
+        auto rightType = expressionType(*binaryExpr.right);
+
+        std::string function;
+        if (expression.type == ExpressionType::Divide && leftType != VariableType::Vector && rightType == VariableType::Float) {
+            function = "nativeDivide";
+        } else if (expression.type == ExpressionType::Equal && leftType == VariableType::Float && rightType == VariableType::Float) {
+            function = "nativeEqual";
+        } else if (expression.type == ExpressionType::RightShift) {
+            function = "nativeShiftRight";
+        }
+        if (!function.empty()) {
+            writer.write(function + "(");
+            writeExpression(*binaryExpr.left, writer);
+            writer.write(", ");
+            writeExpression(*binaryExpr.right, writer);
+            writer.write(")");
+            return;
+        }
+        if (expression.type == ExpressionType::RightShiftUnsigned) {
+            writer.write("static_cast<int32_t>(static_cast<uint32_t>(");
+            writeExpression(*binaryExpr.left, writer);
+            writer.write(") >> ");
+            writeOperand(*binaryExpr.right, writer);
+            writer.write(")");
+            return;
+        }
+
+        std::string operation;
+        if (expression.type == ExpressionType::Add) {
+            operation = "+";
+        } else if (expression.type == ExpressionType::Subtract) {
+            operation = "-";
+        } else if (expression.type == ExpressionType::Multiply) {
+            operation = "*";
+        } else if (expression.type == ExpressionType::Divide) {
+            operation = "/";
+        } else if (expression.type == ExpressionType::Modulo) {
+            operation = "%";
+        } else if (expression.type == ExpressionType::LogicalAnd) {
+            operation = "&&";
+        } else if (expression.type == ExpressionType::LogicalOr) {
+            operation = "||";
+        } else if (expression.type == ExpressionType::BitwiseOr) {
+            operation = "|";
+        } else if (expression.type == ExpressionType::BitwiseExlusiveOr) {
+            operation = "^";
+        } else if (expression.type == ExpressionType::BitwiseAnd) {
+            operation = "&";
+        } else if (expression.type == ExpressionType::LeftShift) {
+            operation = "<<";
+        } else if (expression.type == ExpressionType::Equal) {
+            operation = "==";
+        } else if (expression.type == ExpressionType::NotEqual) {
+            operation = "!=";
+        } else if (expression.type == ExpressionType::GreaterThanOrEqual) {
+            operation = ">=";
+        } else if (expression.type == ExpressionType::GreaterThan) {
+            operation = ">";
+        } else if (expression.type == ExpressionType::LessThan) {
+            operation = "<";
+        } else if (expression.type == ExpressionType::LessThanOrEqual) {
+            operation = "<=";
+        }
+        writeOperand(*binaryExpr.left, writer);
+        writer.write(str(boost::format(" %s ") % operation));
+        writeOperand(*binaryExpr.right, writer);
+
+    } else {
+        throw NotImplementedException("Cannot write expression of type: " + std::to_string(static_cast<int>(expression.type)));
+    }
+}
+
+void CppWriter::writeOperand(const Expression &expression, TextWriter &writer) {
+    bool parenthesize = ExpressionTree::isUnaryExpression(expression.type) ||
+                        ExpressionTree::isBinaryExpression(expression.type) ||
+                        (expression.type == ExpressionType::Constant &&
+                         boost::starts_with(describeConstant(static_cast<const ConstantExpression &>(expression).value), "-"));
+    if (parenthesize) {
+        writer.write("(");
+    }
+    writeExpression(expression, writer);
+    if (parenthesize) {
+        writer.write(")");
+    }
+}
+
+void CppWriter::writeAction(const ActionExpression &actionExpr, bool result, TextWriter &writer) {
+    auto numRoutines = _routines.getNumRoutines();
+    if (actionExpr.action >= numRoutines) {
+        throw std::invalid_argument(str(boost::format("Action number out of bounds: %d/%d") % actionExpr.action % numRoutines));
+    }
+    auto &routine = _routines.get(actionExpr.action);
+    writer.write(str(boost::format("callRoutine(_ctx, %d, {") % actionExpr.action));
+    for (size_t i = 0; i < actionExpr.arguments.size(); ++i) {
+        if (i > 0) {
+            writer.write(", ");
+        }
+        auto argExpr = actionExpr.arguments[i];
+        auto argType = routine.getArgumentType(static_cast<int>(i));
+        if (argType == VariableType::Action || argExpr->type == ExpressionType::Block) {
+            throw NotImplementedException(str(boost::format("Action argument in call to %s at %08x") % routine.name() % actionExpr.offset));
+        }
+        std::string builder;
+        if (argType == VariableType::Int) {
+            builder = "Variable::ofInt";
+        } else if (argType == VariableType::Float) {
+            builder = "Variable::ofFloat";
+        } else if (argType == VariableType::String) {
+            builder = "Variable::ofString";
+        } else if (argType == VariableType::Vector) {
+            builder = "Variable::ofVector";
+        } else if (argType == VariableType::Object) {
+            builder = "Variable::ofObject";
+        } else if (argType == VariableType::Effect) {
+            builder = "Variable::ofEffect";
+        } else if (argType == VariableType::Event) {
+            builder = "Variable::ofEvent";
+        } else if (argType == VariableType::Location) {
+            builder = "Variable::ofLocation";
+        } else if (argType == VariableType::Talent) {
+            builder = "Variable::ofTalent";
+        } else {
+            throw NotImplementedException("Routine argument of type " + describeVariableType(argType));
+        }
+        writer.write(builder + "(");
+        writeExpression(*argExpr, writer);
+        writer.write(")");
+    }
+    writer.write("})");
+    if (!result) {
+        return;
+    }
+    auto returnType = routine.returnType();
+    if (returnType == VariableType::Int) {
+        writer.write(".intValue");
+    } else if (returnType == VariableType::Float) {
+        writer.write(".floatValue");
+    } else if (returnType == VariableType::String) {
+        writer.write(".strValue");
+    } else if (returnType == VariableType::Vector) {
+        writer.write(".vecValue");
+    } else if (returnType == VariableType::Object) {
+        writer.write(".objectId");
+    } else if (returnType == VariableType::Effect ||
+               returnType == VariableType::Event ||
+               returnType == VariableType::Location ||
+               returnType == VariableType::Talent) {
+        writer.write(".engineType");
+    } else {
+        throw NotImplementedException("Routine result of type " + describeVariableType(returnType));
+    }
+}
+
+void CppWriter::collectParameters(const Function &function,
+                                  std::map<std::string, VariableType> &locals,
+                                  std::map<std::string, VariableType> &globals) {
+    auto visited = std::set<const Expression *>();
+    auto exprToVisit = std::stack<const Expression *>();
+    exprToVisit.push(function.block);
+    while (!exprToVisit.empty()) {
+        auto expr = exprToVisit.top();
+        exprToVisit.pop();
+        if (!expr || visited.count(expr) > 0) {
+            continue;
+        }
+        visited.insert(expr);
+
+        if (expr->type == ExpressionType::Block) {
+            for (auto &nestedExpr : static_cast<const BlockExpression *>(expr)->expressions) {
+                exprToVisit.push(nestedExpr);
+            }
+        } else if (expr->type == ExpressionType::Parameter) {
+            auto paramExpr = static_cast<const ParameterExpression *>(expr);
+            std::map<std::string, VariableType> *params;
+            if (paramExpr->locality == ParameterLocality::Local || paramExpr->locality == ParameterLocality::ReturnValue) {
+                params = &locals;
+            } else if (paramExpr->locality == ParameterLocality::Global) {
+                params = &globals;
+            } else {
+                continue;
+            }
+            auto name = describeParameter(*paramExpr);
+            auto maybeParam = params->find(name);
+            if (maybeParam == params->end()) {
+                params->insert(std::make_pair(name, paramExpr->variableType));
+            } else if (maybeParam->second != paramExpr->variableType) {
+                throw NotImplementedException("Conflicting types of variable " + name);
+            }
+        } else if (expr->type == ExpressionType::Return) {
+            exprToVisit.push(static_cast<const ReturnExpression *>(expr)->value);
+        } else if (expr->type == ExpressionType::Conditional) {
+            auto condExpr = static_cast<const ConditionalExpression *>(expr);
+            exprToVisit.push(condExpr->test);
+            exprToVisit.push(condExpr->ifTrue);
+            exprToVisit.push(condExpr->ifFalse);
+        } else if (expr->type == ExpressionType::Action) {
+            for (auto &arg : static_cast<const ActionExpression *>(expr)->arguments) {
+                exprToVisit.push(arg);
+            }
+        } else if (expr->type == ExpressionType::Call) {
+            for (auto &arg : static_cast<const CallExpression *>(expr)->arguments) {
+                exprToVisit.push(arg);
+            }
+        } else if (expr->type == ExpressionType::Vector) {
+            for (auto &component : static_cast<const VectorExpression *>(expr)->components) {
+                exprToVisit.push(component);
+            }
+        } else if (expr->type == ExpressionType::VectorIndex) {
+            exprToVisit.push(static_cast<const VectorIndexExpression *>(expr)->vector);
+        } else if (ExpressionTree::isUnaryExpression(expr->type)) {
+            exprToVisit.push(static_cast<const UnaryExpression *>(expr)->operand);
+        } else if (ExpressionTree::isBinaryExpression(expr->type)) {
+            auto binaryExpr = static_cast<const BinaryExpression *>(expr);
+            exprToVisit.push(binaryExpr->left);
+            exprToVisit.push(binaryExpr->right);
+        }
+    }
+}
+
+VariableType CppWriter::expressionType(const Expression &expression) {
+    if (expression.type == ExpressionType::Constant) {
+        return static_cast<const ConstantExpression &>(expression).value.type;
+    } else if (expression.type == ExpressionType::Parameter) {
+        return static_cast<const ParameterExpression &>(expression).variableType;
+    } else if (expression.type == ExpressionType::Action) {
+        return _routines.get(static_cast<const ActionExpression &>(expression).action).returnType();
+    } else if (expression.type == ExpressionType::Call) {
+        return static_cast<const CallExpression &>(expression).function->returnType;
+    } else if (expression.type == ExpressionType::Vector) {
+        return VariableType::Vector;
+    } else if (expression.type == ExpressionType::VectorIndex) {
+        return VariableType::Float;
+    } else if (expression.type == ExpressionType::Not) {
+        return VariableType::Int;
+    } else if (ExpressionTree::isUnaryExpression(expression.type)) {
+        return expressionType(*static_cast<const UnaryExpression &>(expression).operand);
+    } else if (expression.type == ExpressionType::Assign) {
+        return expressionType(*static_cast<const BinaryExpression &>(expression).left);
+    } else if (expression.type == ExpressionType::Add ||
+               expression.type == ExpressionType::Subtract ||
+               expression.type == ExpressionType::Multiply ||
+               expression.type == ExpressionType::Divide) {
+        auto &binaryExpr = static_cast<const BinaryExpression &>(expression);
+        auto leftType = expressionType(*binaryExpr.left);
+        auto rightType = expressionType(*binaryExpr.right);
+        if (leftType == VariableType::Vector || rightType == VariableType::Vector) {
+            return VariableType::Vector;
+        }
+        if (leftType == VariableType::Float || rightType == VariableType::Float) {
+            return VariableType::Float;
+        }
+        return leftType;
+    } else if (ExpressionTree::isBinaryExpression(expression.type)) {
+        return VariableType::Int;
+    }
+    return VariableType::Void;
+}
+
+std::string CppWriter::indentAtLevel(int level) {
+    return std::string(4 * level, ' ');
+}
+
+std::string CppWriter::describeFunction(const Function &function) {
+    return !function.name.empty() ? function.name : str(boost::format("fun_%08x") % function.start);
+}
+
+std::string CppWriter::describeLabel(const LabelExpression &labelExpr) {
+    return str(boost::format("loc_%08x") % labelExpr.offset);
+}
+
+std::string CppWriter::describeParameter(const ParameterExpression &paramExpr) {
+    if (paramExpr.locality == ParameterLocality::Global) {
+        return str(boost::format("glob_%08x") % paramExpr.offset);
+    } else if (paramExpr.locality == ParameterLocality::Local) {
+        if (!paramExpr.suffix.empty()) {
+            return str(boost::format("var_%08x_%s") % paramExpr.offset % paramExpr.suffix);
+        } else {
+            return str(boost::format("var_%08x") % paramExpr.offset);
+        }
+    } else if (paramExpr.locality == ParameterLocality::Argument) {
+        return str(boost::format("arg_%08x") % paramExpr.outerStackOffset);
+    } else if (paramExpr.locality == ParameterLocality::ReturnValue) {
+        return str(boost::format("ret_%08x") % paramExpr.outerStackOffset);
+    } else {
+        throw std::invalid_argument("Unsupported parameter locality: " + std::to_string(static_cast<int>(paramExpr.locality)));
+    }
+}
+
+std::string CppWriter::describeConstant(const Variable &value) {
+    if (value.type == VariableType::Int) {
+        if (value.intValue == std::numeric_limits<int32_t>::min()) {
+            return "(-2147483647 - 1)";
+        }
+        return std::to_string(value.intValue);
+    } else if (value.type == VariableType::Float) {
+        if (std::isnan(value.floatValue)) {
+            return "std::numeric_limits<float>::quiet_NaN()";
+        }
+        if (std::isinf(value.floatValue)) {
+            return value.floatValue > 0.0f ? "std::numeric_limits<float>::infinity()" : "-std::numeric_limits<float>::infinity()";
+        }
+        auto described = str(boost::format("%.9g") % value.floatValue);
+        if (described.find_first_of(".e") == std::string::npos) {
+            described += ".0";
+        }
+        return described + "f";
+    } else if (value.type == VariableType::String) {
+        std::string escaped;
+        for (auto ch : value.strValue) {
+            auto byte = static_cast<uint8_t>(ch);
+            if (ch == '"' || ch == '\\') {
+                escaped.push_back('\\');
+                escaped.push_back(ch);
+            } else if (byte < 0x20 || byte >= 0x7f) {
+                escaped += str(boost::format("\\%03o") % static_cast<int>(byte));
+            } else {
+                escaped.push_back(ch);
+            }
+        }
+        return "std::string(\"" + escaped + "\")";
+    } else if (value.type == VariableType::Object) {
+        return std::to_string(value.objectId) + "u";
+    } else {
+        throw std::invalid_argument("Cannot describe constant expression of type: " + std::to_string(static_cast<int>(value.type)));
+    }
+}
+
+std::string CppWriter::describeType(VariableType type) {
+    switch (type) {
+    case VariableType::Void:
+        return "void";
+    case VariableType::Int:
+        return "int32_t";
+    case VariableType::Float:
+        return "float";
+    case VariableType::String:
+        return "std::string";
+    case VariableType::Object:
+        return "uint32_t";
+    case VariableType::Vector:
+        return "glm::vec3";
+    case VariableType::Effect:
+    case VariableType::Event:
+    case VariableType::Location:
+    case VariableType::Talent:
+        return "std::shared_ptr<EngineType>";
+    default:
+        throw NotImplementedException("Variable of type " + describeVariableType(type));
+    }
+}
+
+std::string CppWriter::describeDefaultValue(VariableType type) {
+    switch (type) {
+    case VariableType::Int:
+        return "0";
+    case VariableType::Float:
+        return "0.0f";
+    case VariableType::String:
+        return "std::string()";
+    case VariableType::Object:
+        return "kObjectInvalid";
+    case VariableType::Vector:
+        return "glm::vec3(0.0f)";
+    case VariableType::Effect:
+    case VariableType::Event:
+    case VariableType::Location:
+    case VariableType::Talent:
+        return "nullptr";
+    default:
+        throw NotImplementedException("Variable of type " + describeVariableType(type));
+    }
+}
+
+} // namespace script
+
+} // namespace reone
@@ -47,7 +47,7 @@ void SsfTool::invokeBatch(
     const std::filesystem::path &outputDir,
     const std::filesystem::path &gamePath) {
 
-    return doInvokeBatch(input, outputDir, [this, &operation](auto &path, auto &outDir) {
+    doInvokeBatch(input, outputDir, [this, &operation](auto &path, auto &outDir) {
         if (operation == Operation::ToXML) {
             toXML(path, outDir);
         } else if (operation == Operation::ToSSF) {
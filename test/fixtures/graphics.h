@@ -26,7 +26,9 @@
 #include "reone/graphics/meshes.h"
 #include "reone/graphics/models.h"
 #include "reone/graphics/pipeline.h"
+#include "reone/graphics/renderqueue.h"
 #include "reone/graphics/shaders.h"
+#include "reone/graphics/spritebatch.h"
 #include "reone/graphics/textures.h"
 #include "reone/graphics/uniforms.h"
 #include "reone/graphics/walkmeshes.h"
@@ -84,14 +86,36 @@ public:
     MOCK_METHOD(std::shared_ptr<Texture>, draw, (IScene & scene, const glm::ivec2 &dim), (override));
 };
 
+class MockRenderBackend : public IRenderBackend, boost::noncopyable {
+public:
+    MOCK_METHOD(void, useProgram, (ShaderProgramId program), (override));
+    MOCK_METHOD(void, bindTexture, (Texture & texture, int unit), (override));
+    MOCK_METHOD(void, setLocals, (const DrawLocals &locals), (override));
+    MOCK_METHOD(void, setBones, (const glm::mat4 *bones, int count), (override));
+    MOCK_METHOD(void, setInstances, (const glm::mat4 *models, const glm::mat4 *modelsInv, int count), (override));
+    MOCK_METHOD(void, drawMesh, (Mesh & mesh), (override));
+    MOCK_METHOD(void, drawMeshInstanced, (Mesh & mesh, int count), (override));
+};
+
 class MockShaders : public IShaders, boost::noncopyable {
 public:
     MOCK_METHOD(void, use, (ShaderProgramId programId), (override));
 };
 
+class MockSpriteBatch : public ISpriteBatch, boost::noncopyable {
+public:
+    MOCK_METHOD(void, begin, (), (override));
+    MOCK_METHOD(void, end, (), (override));
+    MOCK_METHOD(void, draw, (const SpriteMaterial &material, const Sprite &sprite), (override));
+    MOCK_METHOD(void, draw, (const SpriteMaterial &material, const std::vector<Sprite> &sprites), (override));
+    MOCK_METHOD(void, flush, (), (override));
+};
+
 class MockTextures : public ITextures, boost::noncopyable {
 public:
     MOCK_METHOD(void, clear, (), (override));
+    MOCK_METHOD(void, cancelStreaming, (), (override));
+    MOCK_METHOD(void, update, (), (override));
 
     MOCK_METHOD(void, bind, (Texture & texture, int unit), (override));
     MOCK_METHOD(void, bindBuiltIn, (), (override));
@@ -114,8 +138,10 @@ public:
 
 class MockUniforms : public IUniforms, boost::noncopyable {
 public:
+    MOCK_METHOD(void, beginFrame, (), (override));
+    MOCK_METHOD(const UniformsStats &, frameStats, (), (const override));
+
     MOCK_METHOD(void, setGeneral, (const std::function<void(GeneralUniforms &)> &block), (override));
-    MOCK_METHOD(void, setText, (const std::function<void(TextUniforms &)> &block), (override));
     MOCK_METHOD(void, setLighting, (const std::function<void(LightingUniforms &)> &block), (override));
     MOCK_METHOD(void, setSkeletal, (const std::function<void(SkeletalUniforms &)> &block), (override));
     MOCK_METHOD(void, setParticles, (const std::function<void(ParticlesUniforms &)> &block), (override));
@@ -123,6 +149,7 @@ public:
     MOCK_METHOD(void, setSSAO, (const std::function<void(SSAOUniforms &)> &block), (override));
     MOCK_METHOD(void, setWalkmesh, (const std::function<void(WalkmeshUniforms &)> &block), (override));
     MOCK_METHOD(void, setPoints, (const std::function<void(PointsUniforms &)> &block), (override));
+    MOCK_METHOD(void, setInstances, (const std::function<void(InstancesUniforms &)> &block), (override));
 };
 
 class MockWalkmeshes : public IWalkmeshes, boost::noncopyable {
@@ -154,6 +181,7 @@ public:
         _models = std::make_unique<MockModels>();
         _pipeline = std::make_unique<MockPipeline>();
         _shaders = std::make_unique<MockShaders>();
+        _spriteBatch = std::make_unique<MockSpriteBatch>();
         _textures = std::make_unique<MockTextures>();
         _uniforms = std::make_unique<MockUniforms>();
         _walkmeshes = std::make_unique<MockWalkmeshes>();
@@ -167,6 +195,7 @@ public:
             *_models,
             *_pipeline,
             *_shaders,
+            *_spriteBatch,
             *_textures,
             *_uniforms,
             *_walkmeshes,
@@ -197,6 +226,7 @@ private:
     std::unique_ptr<MockModels> _models;
     std::unique_ptr<MockPipeline> _pipeline;
     std::unique_ptr<MockShaders> _shaders;
+    std::unique_ptr<MockSpriteBatch> _spriteBatch;
     std::unique_ptr<MockTextures> _textures;
     std::unique_ptr<MockUniforms> _uniforms;
     std::unique_ptr<MockWalkmeshes> _walkmeshes;
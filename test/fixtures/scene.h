@@ -79,7 +79,7 @@ public:
     MOCK_METHOD(std::shared_ptr<GrassSceneNode>, newGrass, (GrassProperties properties, graphics::ModelNode &aabbNode), (override));
     MOCK_METHOD(std::shared_ptr<GrassClusterSceneNode>, newGrassCluster, (GrassSceneNode & grass), (override));
 
-    MOCK_METHOD(void, drawShadows, (), (override));
+    MOCK_METHOD(void, drawShadows, (const glm::mat4 *lightSpace, int numLayers, graphics::ShadowCasters casters), (override));
     MOCK_METHOD(void, drawOpaque, (), (override));
     MOCK_METHOD(void, drawTransparent, (), (override));
     MOCK_METHOD(void, drawLensFlares, (), (override));
@@ -101,6 +101,7 @@ public:
     MOCK_METHOD(glm::vec3, shadowLightPosition, (), (const override));
     MOCK_METHOD(float, shadowStrength, (), (const override));
     MOCK_METHOD(float, shadowRadius, (), (const override));
+    MOCK_METHOD(uint32_t, staticShadowsRevision, (), (const override));
 };
 
 class MockSceneGraphs : public ISceneGraphs, boost::noncopyable {
@@ -43,12 +43,17 @@ public:
             retType,
             retValue,
             std::move(argTypes),
-            [retValue](auto &args, auto &ctx) { return retValue; }) {
+            nullptr),
+        _retValue(std::move(retValue)) {
     }
 
-    Variable invoke(const std::vector<Variable> &args, ExecutionContext &ctx) override {
-        _invokeInvocations.push_back(std::make_tuple(args, ctx));
-        return Routine::invoke(args, ctx);
+    Variable invoke(const VariableSpan &args, ExecutionContext &ctx) override {
+        std::vector<Variable> argsCopy;
+        for (size_t i = 0; i < args.size(); ++i) {
+            argsCopy.push_back(args[i]);
+        }
+        _invokeInvocations.push_back(std::make_tuple(std::move(argsCopy), ctx));
+        return _retValue;
     }
 
     const std::vector<InvokeInvocation> &invokeInvocations() const {
@@ -56,6 +61,7 @@ public:
     }
 
 private:
+    Variable _retValue;
     std::vector<InvokeInvocation> _invokeInvocations;
 };
 
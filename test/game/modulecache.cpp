@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/game/game.h"
+#include "reone/game/modulecache.h"
+#include "reone/game/object/area.h"
+#include "reone/game/object/module.h"
+
+#include "../fixtures/engine.h"
+
+using namespace reone;
+using namespace reone::game;
+
+TEST(module_cache, should_restore_area_and_module_locals_from_snapshot) {
+    // given
+
+    auto engine = TestEngine();
+    engine.init();
+
+    auto game = Game(GameID::KotOR, "", engine.options(), engine.services());
+
+    auto module = Module(1, game, engine.services());
+    auto area = Area(2, "", game, engine.services());
+    module.setLocalBoolean(0, true);
+    module.setLocalNumber(1, 10);
+    area.setLocalBoolean(2, true);
+    area.setLocalNumber(3, 20);
+
+    auto snapshot = ModuleCache::takeSnapshot(module, area);
+
+    auto reloadedModule = Module(3, game, engine.services());
+    auto reloadedArea = Area(4, "", game, engine.services());
+
+    // when
+
+    ModuleCache::applySnapshot(snapshot, reloadedModule, reloadedArea);
+
+    // then
+
+    EXPECT_EQ(module.localBooleans(), reloadedModule.localBooleans());
+    EXPECT_EQ(module.localNumbers(), reloadedModule.localNumbers());
+    EXPECT_EQ(area.localBooleans(), reloadedArea.localBooleans());
+    EXPECT_EQ(area.localNumbers(), reloadedArea.localNumbers());
+    EXPECT_TRUE(reloadedArea.localBooleans().at(2));
+    EXPECT_EQ(10, reloadedModule.localNumbers().at(1));
+}
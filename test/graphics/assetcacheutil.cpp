@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/graphics/assetcacheutil.h"
+#include "reone/graphics/texture.h"
+#include "reone/graphics/walkmesh.h"
+
+using namespace reone;
+using namespace reone::graphics;
+
+TEST(asset_cache_util, should_round_trip_texture_blob) {
+    // given
+    auto texture = Texture("some_texture", Texture::Properties());
+    auto pixels = std::make_shared<ByteBuffer>(ByteBuffer {'\x01', '\x02', '\x03', '\x04'});
+    texture.setPixels(1, 1, PixelFormat::RGBA8, Texture::Layer {pixels});
+    auto features = Texture::Features();
+    features.cube = true;
+    features.bumpmapTexture = "some_bumpmap";
+    features.upperLeftCoords.push_back(glm::vec3(1.0f, 2.0f, 3.0f));
+    texture.setFeatures(features);
+
+    // when
+    auto blob = writeTextureBlob(texture);
+    auto cached = readTextureBlob(blob, "some_texture", TextureUsage::Diffuse);
+
+    // then
+    EXPECT_EQ(std::string("some_texture"), cached->name());
+    EXPECT_EQ(1, cached->width());
+    EXPECT_EQ(1, cached->height());
+    EXPECT_EQ(PixelFormat::RGBA8, cached->pixelFormat());
+    EXPECT_EQ(1ll, cached->layers().size());
+    EXPECT_EQ(*pixels, *cached->layers()[0].pixels);
+    EXPECT_TRUE(cached->isCubemap());
+    EXPECT_EQ(std::string("some_bumpmap"), cached->features().bumpmapTexture);
+    EXPECT_EQ(1ll, cached->features().upperLeftCoords.size());
+    EXPECT_EQ(glm::vec3(1.0f, 2.0f, 3.0f), cached->features().upperLeftCoords[0]);
+}
+
+TEST(asset_cache_util, should_round_trip_walkmesh_blob) {
+    // given
+    auto walkmesh = Walkmesh();
+    walkmesh.setAreaWalkmesh(true);
+    auto face = Walkmesh::Face();
+    face.index = 0;
+    face.material = 1;
+    face.vertices = std::vector<glm::vec3> {
+        glm::vec3(0.0f, 0.0f, 0.0f),
+        glm::vec3(1.0f, 0.0f, 0.0f),
+        glm::vec3(0.0f, 1.0f, 0.0f)};
+    face.normal = glm::vec3(0.0f, 0.0f, 1.0f);
+    walkmesh.add(std::move(face));
+    auto leaf = std::make_shared<Walkmesh::AABB>();
+    leaf->value = AABB(glm::vec3(0.0f, 0.0f, -0.1f), glm::vec3(1.0f, 1.0f, 0.1f));
+    leaf->faceIdx = 0;
+    auto root = std::make_shared<Walkmesh::AABB>();
+    root->value = leaf->value;
+    root->left = leaf;
+    walkmesh.setRootAABB(root);
+
+    // when
+    auto blob = writeWalkmeshBlob(walkmesh);
+    auto cached = readWalkmeshBlob(blob);
+
+    // then
+    EXPECT_TRUE(cached->isAreaWalkmesh());
+    EXPECT_EQ(1ll, cached->faces().size());
+    EXPECT_EQ(1u, cached->faces()[0].material);
+    EXPECT_EQ(glm::vec3(1.0f, 0.0f, 0.0f), cached->faces()[0].vertices[1]);
+    auto &cachedRoot = cached->rootAABB();
+    EXPECT_TRUE(static_cast<bool>(cachedRoot));
+    EXPECT_EQ(-1, cachedRoot->faceIdx);
+    EXPECT_FALSE(static_cast<bool>(cachedRoot->right));
+    EXPECT_TRUE(static_cast<bool>(cachedRoot->left));
+    EXPECT_EQ(0, cachedRoot->left->faceIdx);
+    float distance;
+    EXPECT_EQ(&cached->faces()[0], cached->raycast(std::set<uint32_t> {1}, glm::vec3(0.25f, 0.25f, 1.0f), glm::vec3(0.0f, 0.0f, -1.0f), 2.0f, distance));
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/graphics/dxtutil.h"
+
+using namespace reone;
+using namespace reone::graphics;
+
+TEST(dxt_util, should_decompress_dxt1_block_into_rgb) {
+    // given
+    auto block = std::vector<uint8_t> {
+        0x00, 0xf8,            // red
+        0x1f, 0x00,            // blue
+        0xe4, 0x00, 0x00, 0x00 // codes 0, 1, 2, 3 in the first row
+    };
+    auto pixels = std::vector<uint8_t>(3 * 16);
+
+    // when
+    decompressDXT1(4, 4, block.data(), PixelFormat::RGB8, pixels.data());
+
+    // then
+    auto firstRow = std::vector<uint8_t>(pixels.begin(), pixels.begin() + 12);
+    EXPECT_EQ((std::vector<uint8_t> {255, 0, 0, 0, 0, 255, 170, 0, 85, 85, 0, 170}), firstRow);
+    auto secondRow = std::vector<uint8_t>(pixels.begin() + 12, pixels.begin() + 15);
+    EXPECT_EQ((std::vector<uint8_t> {255, 0, 0}), secondRow);
+}
+
+TEST(dxt_util, should_decompress_dxt5_block_into_bgra) {
+    // given
+    auto block = std::vector<uint8_t> {
+        0xff, 0x00,                         // alpha 255 and 0
+        0x88, 0x00, 0x00, 0x00, 0x00, 0x00, // alpha codes 0, 1, 2 in the first row
+        0x00, 0xf8,                         // red
+        0x1f, 0x00,                         // blue
+        0x24, 0x00, 0x00, 0x00              // codes 0, 1, 2 in the first row
+    };
+    auto pixels = std::vector<uint8_t>(4 * 16);
+
+    // when
+    decompressDXT5(4, 4, block.data(), PixelFormat::BGRA8, pixels.data());
+
+    // then
+    auto firstRow = std::vector<uint8_t>(pixels.begin(), pixels.begin() + 12);
+    EXPECT_EQ((std::vector<uint8_t> {0, 0, 255, 255, 255, 0, 0, 0, 85, 0, 170, 218}), firstRow);
+}
+
+TEST(dxt_util, should_clip_blocks_of_images_smaller_than_block) {
+    // given
+    auto block = std::vector<uint8_t> {0x00, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00};
+    auto pixels = std::vector<uint8_t>(3 * 4 + 1, 0xcd);
+
+    // when
+    decompressDXT1(2, 2, block.data(), PixelFormat::RGB8, pixels.data());
+
+    // then
+    EXPECT_EQ((std::vector<uint8_t> {255, 0, 0, 255, 0, 0, 255, 0, 0, 255, 0, 0, 0xcd}), pixels);
+}
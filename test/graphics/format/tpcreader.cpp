@@ -55,3 +55,39 @@ TEST(tpc_reader, should_load_tpc) {
     auto pixels = reinterpret_cast<unsigned char *>(texture->layers()[0].pixels->data());
     EXPECT_EQ(255, pixels[0]);
 }
+
+TEST(tpc_reader, should_load_mip_level_not_larger_than_max_base_size) {
+    // given
+    auto tpcBytes = StringBuilder()
+                        // Header
+                        .append("\x00\x00\x00\x00", 4) // data size
+                        .append("\x00\x00\x00\x00", 4) // unknown
+                        .append("\x04\x00", 2)         // width
+                        .append("\x04\x00", 2)         // height
+                        .append("\x01", 1)             // encoding
+                        .append("\x03", 1)             // number of mip maps
+                        .append('\x00', 114)           // padding
+                        // Mip Map 1
+                        .append('\x01', 16)
+                        // Mip Map 2
+                        .append('\x02', 4)
+                        // Mip Map 3
+                        .append('\x03', 1)
+                        .string();
+    auto tpc = MemoryInputStream(tpcBytes);
+    auto reader = TpcReader(tpc, "some_texture", TextureUsage::Diffuse, 2);
+
+    // when
+    reader.load();
+
+    // then
+    auto texture = reader.texture();
+    EXPECT_EQ(1, reader.mipLevel());
+    EXPECT_EQ(3, reader.numMipMaps());
+    EXPECT_EQ(4, reader.width());
+    EXPECT_EQ(2, texture->width());
+    EXPECT_EQ(2, texture->height());
+    EXPECT_EQ(4ll, texture->layers()[0].pixels->size());
+    auto pixels = reinterpret_cast<unsigned char *>(texture->layers()[0].pixels->data());
+    EXPECT_EQ(2, pixels[0]);
+}
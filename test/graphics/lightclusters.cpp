@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include "reone/graphics/camera/perspective.h"
+#include "reone/graphics/lightclusters.h"
+#include "reone/graphics/uniforms.h"
+
+using namespace reone;
+using namespace reone::graphics;
+
+static bool isClusterLight(const LightingUniforms &lighting, int x, int y, int z, int lightIdx) {
+    int clusterIdx = (z * kNumLightClustersY + y) * kNumLightClustersX + x;
+    uint32_t mask = lighting.clusters[clusterIdx / 2][2 * (clusterIdx % 2) + lightIdx / 32];
+    return (mask & (1u << (lightIdx % 32))) != 0;
+}
+
+TEST(light_clusters, should_assign_lights_to_overlapping_clusters) {
+    // given
+    auto camera = PerspectiveCamera();
+    camera.setProjection(glm::radians(90.0f), 2.0f, 0.1f, 1000.0f);
+    camera.setView(glm::mat4(1.0f));
+
+    auto lighting = std::make_unique<LightingUniforms>();
+    lighting->numLights = 2;
+    lighting->lights[0].position = glm::vec4(-10.0f, 0.0f, -10.0f, 1.0f);
+    lighting->lights[0].radius = 1.0f;
+    lighting->lights[1].position = glm::vec4(0.0f, 0.0f, 1.0f, 0.0f);
+
+    auto clusters = LightClusters();
+
+    // when
+    clusters.assign(camera, *lighting);
+
+    // then
+    EXPECT_NEAR(0.1f, lighting->clusterNear, 1e-5f);
+    EXPECT_TRUE(isClusterLight(*lighting, 4, 4, 5, 0));
+    EXPECT_FALSE(isClusterLight(*lighting, 12, 4, 5, 0));
+    EXPECT_FALSE(isClusterLight(*lighting, 4, 4, 0, 0));
+    EXPECT_TRUE(isClusterLight(*lighting, 4, 4, 5, 1));
+    EXPECT_TRUE(isClusterLight(*lighting, 12, 4, 0, 1));
+}
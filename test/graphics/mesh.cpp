@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/graphics/mesh.h"
+
+using namespace reone;
+using namespace reone::graphics;
+
+static Mesh::VertexSpec newSpecWithUV2() {
+    auto spec = Mesh::VertexSpec();
+    spec.stride = 8 * sizeof(float);
+    spec.offCoords = 0;
+    spec.offNormals = 3 * sizeof(float);
+    spec.offUV2 = 6 * sizeof(float);
+    return spec;
+}
+
+static std::vector<float> newTriangleVertices() {
+    return std::vector<float> {
+        0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, //
+        2.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, //
+        0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 1.0f  //
+    };
+}
+
+TEST(mesh, should_compute_face_data_for_queryable_mesh) {
+    // given
+    auto mesh = Mesh(newTriangleVertices(), std::vector<Mesh::Face> {Mesh::Face(0, 1, 2)}, newSpecWithUV2(), Mesh::Residency::Queryable);
+
+    // when
+    auto &face = mesh.faces()[0];
+    auto coords = mesh.getVertexCoords(face);
+    auto uv2 = mesh.getUV2(face, glm::vec3(0.0f, 0.5f, 0.5f));
+
+    // then
+    EXPECT_TRUE(mesh.hasVertexData());
+    EXPECT_EQ(glm::vec3(2.0f, 0.0f, 0.0f), coords[1]);
+    EXPECT_NEAR(2.0f, face.area, 1e-5);
+    EXPECT_NEAR(1.0f, glm::normalize(face.normal).z, 1e-5);
+    EXPECT_NEAR(0.5f, uv2.x, 1e-5);
+    EXPECT_NEAR(0.5f, uv2.y, 1e-5);
+    EXPECT_EQ(glm::vec3(2.0f, 2.0f, 0.0f), mesh.aabb().max());
+}
+
+TEST(mesh, should_compute_only_aabb_for_gpu_only_mesh) {
+    // given
+    auto mesh = Mesh(newTriangleVertices(), std::vector<Mesh::Face> {Mesh::Face(0, 1, 2)}, newSpecWithUV2(), Mesh::Residency::GpuOnly);
+
+    // when
+    auto &aabb = mesh.aabb();
+
+    // then
+    EXPECT_TRUE(mesh.hasVertexData());
+    EXPECT_EQ(Mesh::Residency::GpuOnly, mesh.residency());
+    EXPECT_EQ(0.0f, mesh.faces()[0].area);
+    EXPECT_EQ(glm::vec3(0.0f), aabb.min());
+    EXPECT_EQ(glm::vec3(2.0f, 2.0f, 0.0f), aabb.max());
+}
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/graphics/mesh.h"
+#include "reone/graphics/renderqueue.h"
+#include "reone/graphics/texture.h"
+
+#include "../fixtures/graphics.h"
+
+using namespace reone;
+using namespace reone::graphics;
+
+using testing::_;
+using testing::InSequence;
+using testing::Ref;
+
+static std::unique_ptr<Mesh> newMesh() {
+    auto spec = Mesh::VertexSpec();
+    spec.stride = 3 * sizeof(float);
+    return std::make_unique<Mesh>(std::vector<float>(), std::vector<Mesh::Face>(), spec, Mesh::Residency::GpuOnly);
+}
+
+static DrawCommand newDrawCommand(ShaderProgramId program, Mesh &mesh, Texture &diffuse, float depth = 0.0f) {
+    auto command = DrawCommand();
+    command.program = program;
+    command.mesh = &mesh;
+    command.textures[0] = DrawTexture {&diffuse, TextureUnits::mainTex};
+    command.depth = depth;
+    return command;
+}
+
+TEST(render_queue, should_group_draws_by_state_and_skip_redundant_changes) {
+    // given
+    auto mesh1 = newMesh();
+    auto mesh2 = newMesh();
+    auto mesh3 = newMesh();
+    auto texture1 = Texture("texture1", Texture::Properties());
+    auto texture2 = Texture("texture2", Texture::Properties());
+
+    auto queue = RenderQueue();
+    queue.add(newDrawCommand(ShaderProgramId::ModelOpaque, *mesh1, texture1));
+    queue.add(newDrawCommand(ShaderProgramId::ModelTransparent, *mesh2, texture2));
+    queue.add(newDrawCommand(ShaderProgramId::ModelOpaque, *mesh3, texture1));
+    queue.sort();
+
+    auto backend = MockRenderBackend();
+    {
+        InSequence seq;
+        EXPECT_CALL(backend, bindTexture(Ref(texture1), TextureUnits::mainTex)).Times(1);
+        EXPECT_CALL(backend, setLocals(_)).Times(1);
+        EXPECT_CALL(backend, useProgram(ShaderProgramId::ModelOpaque)).Times(1);
+        EXPECT_CALL(backend, drawMesh(_)).Times(1);
+        EXPECT_CALL(backend, setLocals(_)).Times(1);
+        EXPECT_CALL(backend, drawMesh(_)).Times(1);
+        EXPECT_CALL(backend, bindTexture(Ref(texture2), TextureUnits::mainTex)).Times(1);
+        EXPECT_CALL(backend, setLocals(_)).Times(1);
+        EXPECT_CALL(backend, useProgram(ShaderProgramId::ModelTransparent)).Times(1);
+        EXPECT_CALL(backend, drawMesh(Ref(*mesh2))).Times(1);
+    }
+    EXPECT_CALL(backend, setBones(_, _)).Times(0);
+
+    // when
+    queue.submit(RenderPass::Opaque, backend);
+
+    // then
+    EXPECT_EQ(3, queue.size());
+}
+
+TEST(render_queue, should_submit_only_commands_of_pass_front_to_back) {
+    // given
+    auto mesh = newMesh();
+    auto texture = Texture("texture", Texture::Properties());
+    auto nearCommand = newDrawCommand(ShaderProgramId::ModelOpaque, *mesh, texture, 0.25f);
+    nearCommand.locals.alpha = 0.25f;
+    auto farCommand = newDrawCommand(ShaderProgramId::ModelOpaque, *mesh, texture, 0.75f);
+    farCommand.locals.alpha = 0.75f;
+    auto shadow = DrawCommand();
+    shadow.pass = RenderPass::Shadows;
+    shadow.program = ShaderProgramId::PointLightShadows;
+    shadow.mesh = mesh.get();
+
+    auto queue = RenderQueue();
+    queue.add(shadow);
+    queue.add(farCommand);
+    queue.add(nearCommand);
+    queue.sort();
+
+    auto backend = MockRenderBackend();
+    auto alphas = std::vector<float>();
+    ON_CALL(backend, setLocals(_)).WillByDefault([&alphas](auto &locals) {
+        alphas.push_back(locals.alpha);
+    });
+    EXPECT_CALL(backend, useProgram(ShaderProgramId::ModelOpaque)).Times(1);
+    EXPECT_CALL(backend, useProgram(ShaderProgramId::PointLightShadows)).Times(0);
+    EXPECT_CALL(backend, bindTexture(_, _)).Times(1);
+    EXPECT_CALL(backend, setLocals(_)).Times(2);
+    EXPECT_CALL(backend, drawMesh(_)).Times(2);
+
+    // when
+    queue.submit(RenderPass::Opaque, backend);
+
+    // then
+    EXPECT_EQ((std::vector<float> {0.25f, 0.75f}), alphas);
+}
+
+TEST(render_queue, should_instance_draws_of_same_mesh_and_material) {
+    // given
+    auto mesh = newMesh();
+    auto texture = Texture("texture", Texture::Properties());
+
+    auto queue = RenderQueue();
+    for (int i = 0; i < 3; ++i) {
+        auto command = newDrawCommand(ShaderProgramId::ModelOpaque, *mesh, texture);
+        command.locals.model = glm::translate(glm::vec3(static_cast<float>(i), 0.0f, 0.0f));
+        queue.add(command);
+    }
+    auto skinned = newDrawCommand(ShaderProgramId::ModelOpaque, *mesh, texture);
+    auto bones = glm::mat4(1.0f);
+    skinned.numBones = 1;
+    queue.add(skinned, &bones);
+    queue.sort();
+
+    auto backend = MockRenderBackend();
+    auto featureMasks = std::vector<int>();
+    ON_CALL(backend, setLocals(_)).WillByDefault([&featureMasks](auto &locals) {
+        featureMasks.push_back(locals.featureMask);
+    });
+    EXPECT_CALL(backend, setInstances(_, _, 3)).Times(1);
+    EXPECT_CALL(backend, drawMeshInstanced(Ref(*mesh), 3)).Times(1);
+    EXPECT_CALL(backend, setBones(_, 1)).Times(1);
+    EXPECT_CALL(backend, drawMesh(Ref(*mesh))).Times(1);
+    EXPECT_CALL(backend, setLocals(_)).Times(2);
+
+    // when
+    int numDrawCalls = queue.submit(RenderPass::Opaque, backend);
+
+    // then
+    EXPECT_EQ(2, numDrawCalls);
+    EXPECT_EQ((std::vector<int> {UniformsFeatureFlags::instanced, 0}), featureMasks);
+}
+
+TEST(render_queue, should_not_instance_shadow_draws_of_different_layers) {
+    // given
+    auto mesh = newMesh();
+
+    auto queue = RenderQueue();
+    for (int i = 0; i < 2; ++i) {
+        auto command = DrawCommand();
+        command.pass = RenderPass::Shadows;
+        command.program = ShaderProgramId::PointLightShadows;
+        command.mesh = mesh.get();
+        command.locals.model = glm::translate(glm::vec3(static_cast<float>(i), 0.0f, 0.0f));
+        command.locals.shadowLayerMask = 1 << i;
+        queue.add(command);
+    }
+    queue.sort();
+
+    auto backend = MockRenderBackend();
+    auto layerMasks = std::vector<int>();
+    ON_CALL(backend, setLocals(_)).WillByDefault([&layerMasks](auto &locals) {
+        layerMasks.push_back(locals.shadowLayerMask);
+    });
+    EXPECT_CALL(backend, drawMeshInstanced(_, _)).Times(0);
+    EXPECT_CALL(backend, drawMesh(Ref(*mesh))).Times(2);
+    EXPECT_CALL(backend, setLocals(_)).Times(2);
+
+    // when
+    int numDrawCalls = queue.submit(RenderPass::Shadows, backend);
+
+    // then
+    EXPECT_EQ(2, numDrawCalls);
+    std::sort(layerMasks.begin(), layerMasks.end());
+    EXPECT_EQ((std::vector<int> {1, 2}), layerMasks);
+}
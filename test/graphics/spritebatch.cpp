@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/graphics/spritebatch.h"
+#include "reone/graphics/texture.h"
+
+#include "../fixtures/graphics.h"
+
+using namespace reone;
+using namespace reone::graphics;
+
+TEST(sprite_batch, should_merge_consecutive_sprites_sharing_material) {
+    // given
+    auto context = MockGraphicsContext();
+    auto shaders = MockShaders();
+    auto textures = MockTextures();
+    auto uniforms = MockUniforms();
+    auto window = MockWindow();
+    auto texture1 = Texture("texture1", Texture::Properties());
+    auto texture2 = Texture("texture2", Texture::Properties());
+    auto additive = SpriteMaterial(texture1, BlendMode::Additive);
+    auto discard = SpriteMaterial(texture1);
+    discard.discard = true;
+
+    auto batch = SpriteBatch(context, shaders, textures, uniforms, window);
+    batch.begin();
+
+    // when
+    batch.draw(SpriteMaterial(texture1), Sprite(glm::vec4(0.0f, 0.0f, 10.0f, 10.0f)));
+    batch.draw(SpriteMaterial(texture1), std::vector<Sprite> {Sprite(), Sprite()});
+    batch.draw(SpriteMaterial(texture2), Sprite());
+    batch.draw(SpriteMaterial(texture1), Sprite());
+    batch.draw(additive, Sprite());
+    batch.draw(discard, Sprite());
+    batch.draw(discard, Sprite());
+
+    // then
+    EXPECT_EQ(8, batch.numPendingSprites());
+    EXPECT_EQ(5, batch.numPendingSegments());
+}
+
+TEST(sprite_batch, should_only_flush_when_outermost_batch_ends) {
+    // given
+    auto context = MockGraphicsContext();
+    auto shaders = MockShaders();
+    auto textures = MockTextures();
+    auto uniforms = MockUniforms();
+    auto window = MockWindow();
+    auto texture = Texture("texture", Texture::Properties());
+
+    auto batch = SpriteBatch(context, shaders, textures, uniforms, window);
+    batch.begin();
+    batch.begin();
+
+    // when
+    batch.draw(SpriteMaterial(texture), Sprite());
+    batch.end();
+
+    // then
+    EXPECT_EQ(1, batch.numPendingSprites());
+    EXPECT_EQ(1, batch.numPendingSegments());
+}
+
+TEST(sprite_batch, should_throw_when_ending_batch_that_has_not_begun) {
+    // given
+    auto context = MockGraphicsContext();
+    auto shaders = MockShaders();
+    auto textures = MockTextures();
+    auto uniforms = MockUniforms();
+    auto window = MockWindow();
+
+    auto batch = SpriteBatch(context, shaders, textures, uniforms, window);
+
+    // expect
+    EXPECT_THROW(batch.end(), std::logic_error);
+}
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/graphics/textureresidency.h"
+
+using namespace reone;
+using namespace reone::graphics;
+
+static std::vector<size_t> getLevelSizes(int size) {
+    std::vector<size_t> sizes;
+    for (; size > 0; size >>= 1) {
+        sizes.push_back(static_cast<size_t>(size) * size);
+    }
+    return sizes;
+}
+
+/**
+ * Advances a frame, completing all transitions immediately.
+ */
+static void simulateFrame(TextureResidency &residency) {
+    for (auto &transition : residency.update()) {
+        residency.complete(transition.id, transition.level);
+    }
+}
+
+TEST(texture_residency, should_upgrade_texture_to_level_matching_screen_size) {
+    // given
+    auto residency = TextureResidency(1024 * 1024, 4);
+    int id = residency.add(256, getLevelSizes(256), 2);
+    residency.request(id, 100.0f);
+
+    // when
+    auto transitions = residency.update();
+
+    // then
+    EXPECT_EQ(1ll, transitions.size());
+    EXPECT_EQ(id, transitions[0].id);
+    EXPECT_EQ(1, transitions[0].level);
+    EXPECT_EQ(1, residency.pendingLevel(id));
+    EXPECT_EQ(2, residency.residentLevel(id));
+}
+
+TEST(texture_residency, should_keep_unrequested_texture_at_minimum_level) {
+    // given
+    auto residency = TextureResidency(1024 * 1024, 4);
+    int id = residency.add(256, getLevelSizes(256), 2);
+
+    // when
+    simulateFrame(residency);
+    simulateFrame(residency);
+
+    // then
+    EXPECT_EQ(2, residency.residentLevel(id));
+    EXPECT_EQ(64ll * 64 + 32 * 32 + 16 * 16 + 8 * 8 + 4 * 4 + 2 * 2 + 1, residency.committedBytes());
+}
+
+TEST(texture_residency, should_stay_within_budget_when_demand_exceeds_it) {
+    // given
+    size_t budget = 300 * 1000;
+    auto residency = TextureResidency(budget, 4);
+    int near = residency.add(512, getLevelSizes(512), 3);
+    int far = residency.add(512, getLevelSizes(512), 3);
+
+    // when
+    for (int i = 0; i < 4; ++i) {
+        residency.request(near, 1000.0f);
+        residency.request(far, 200.0f);
+        simulateFrame(residency);
+        EXPECT_LE(residency.committedBytes(), budget);
+    }
+
+    // then
+    EXPECT_EQ(1, residency.residentLevel(near));
+    EXPECT_EQ(1, residency.residentLevel(far));
+}
+
+TEST(texture_residency, should_evict_least_recently_requested_texture_to_make_room) {
+    // given
+    size_t budget = 400 * 1000;
+    auto residency = TextureResidency(budget, 4);
+    int first = residency.add(512, getLevelSizes(512), 3);
+    int second = residency.add(512, getLevelSizes(512), 3);
+    residency.requestFullResolution(first);
+    simulateFrame(residency);
+
+    // when
+    residency.requestFullResolution(second);
+    simulateFrame(residency);
+    residency.requestFullResolution(second);
+    simulateFrame(residency);
+
+    // then
+    EXPECT_EQ(3, residency.residentLevel(first));
+    EXPECT_EQ(0, residency.residentLevel(second));
+    EXPECT_LE(residency.committedBytes(), budget);
+}
+
+TEST(texture_residency, should_limit_number_of_pending_transitions) {
+    // given
+    auto residency = TextureResidency(1024 * 1024 * 1024, 2);
+    std::vector<int> ids;
+    for (int i = 0; i < 4; ++i) {
+        int id = residency.add(256, getLevelSizes(256), 2);
+        residency.requestFullResolution(id);
+        ids.push_back(id);
+    }
+
+    // when
+    auto transitions = residency.update();
+
+    // then
+    EXPECT_EQ(2ll, transitions.size());
+    EXPECT_EQ(2, residency.numPendingTransitions());
+}
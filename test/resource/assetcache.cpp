@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/resource/assetcache.h"
+
+using namespace reone;
+using namespace reone::resource;
+
+TEST(asset_cache, should_find_blob_processed_from_same_source) {
+    // given
+
+    auto tmpPath = std::filesystem::temp_directory_path();
+    tmpPath.append("reone_test_asset_cache");
+    std::filesystem::remove_all(tmpPath);
+
+    auto source = ByteBuffer {'s', 'o', 'u', 'r', 'c', 'e'};
+    auto blob = ByteBuffer {'b', 'l', 'o', 'b'};
+    auto id = ResourceId("some_texture", ResourceType::Tpc);
+
+    auto cache = AssetCache(tmpPath);
+    cache.init();
+    cache.add(id, hashBytes(source), blob);
+
+    // when
+
+    auto reopenedCache = AssetCache(tmpPath);
+    reopenedCache.init();
+    auto cachedBlob = reopenedCache.find(id, hashBytes(source));
+
+    // then
+
+    EXPECT_TRUE(static_cast<bool>(cachedBlob));
+    EXPECT_EQ(blob, *cachedBlob);
+
+    // cleanup
+
+    std::filesystem::remove_all(tmpPath);
+}
+
+TEST(asset_cache, should_not_find_blob_processed_from_modified_source) {
+    // given
+
+    auto tmpPath = std::filesystem::temp_directory_path();
+    tmpPath.append("reone_test_asset_cache_modified");
+    std::filesystem::remove_all(tmpPath);
+
+    auto source = ByteBuffer {'s', 'o', 'u', 'r', 'c', 'e', '_', '1'};
+    auto modifiedSource = ByteBuffer {'s', 'o', 'u', 'r', 'c', 'e', '_', '2'};
+    auto id = ResourceId("some_texture", ResourceType::Tpc);
+
+    auto cache = AssetCache(tmpPath);
+    cache.init();
+    cache.add(id, hashBytes(source), ByteBuffer {'b', 'l', 'o', 'b'});
+
+    // when
+
+    auto cachedBlob = cache.find(id, hashBytes(modifiedSource));
+
+    // then
+
+    EXPECT_FALSE(static_cast<bool>(cachedBlob));
+
+    // cleanup
+
+    std::filesystem::remove_all(tmpPath);
+}
+
+TEST(asset_cache, should_not_find_blobs_when_disabled) {
+    // given
+    auto cache = AssetCache(std::filesystem::path());
+    auto id = ResourceId("some_texture", ResourceType::Tpc);
+    cache.init();
+    cache.add(id, 1, ByteBuffer {'b', 'l', 'o', 'b'});
+
+    // when
+    auto cachedBlob = cache.find(id, 1);
+
+    // then
+    EXPECT_FALSE(cache.isEnabled());
+    EXPECT_FALSE(static_cast<bool>(cachedBlob));
+}
+
+TEST(asset_cache, should_disable_itself_when_directory_cannot_be_created) {
+    // given
+
+    auto tmpPath = std::filesystem::temp_directory_path();
+    tmpPath.append("reone_test_asset_cache_file");
+    std::filesystem::remove_all(tmpPath);
+    std::ofstream(tmpPath.string()) << "not a directory";
+
+    auto cache = AssetCache(tmpPath / "cache");
+
+    // when
+
+    cache.init();
+
+    // then
+
+    EXPECT_FALSE(cache.isEnabled());
+
+    // cleanup
+
+    std::filesystem::remove_all(tmpPath);
+}
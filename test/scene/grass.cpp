@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/graphics/mesh.h"
+#include "reone/graphics/modelnode.h"
+#include "reone/graphics/options.h"
+#include "reone/scene/graphs.h"
+#include "reone/scene/node/camera.h"
+#include "reone/scene/node/grass.h"
+
+#include "../fixtures/audio.h"
+#include "../fixtures/graphics.h"
+
+using namespace reone;
+using namespace reone::audio;
+using namespace reone::graphics;
+using namespace reone::scene;
+
+static std::shared_ptr<Mesh> makeGrassMesh() {
+    // Two grass triangles, 100 units apart, with position and lightmap UV per vertex
+    auto vertices = std::vector<float> {
+        0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+        4.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+        0.0f, 4.0f, 0.0f, 0.0f, 1.0f,
+        100.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+        104.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+        100.0f, 4.0f, 0.0f, 0.0f, 1.0f};
+    auto faces = std::vector<Mesh::Face> {Mesh::Face(0, 1, 2), Mesh::Face(3, 4, 5)};
+    auto spec = Mesh::VertexSpec();
+    spec.stride = 5 * sizeof(float);
+    spec.offCoords = 0;
+    spec.offUV2 = 3 * sizeof(float);
+    return std::make_shared<Mesh>(std::move(vertices), std::move(faces), spec);
+}
+
+TEST(grass_scene_node, should_materialize_clusters_near_camera_only) {
+    // given
+    auto graphicsOpt = GraphicsOptions();
+
+    auto graphicsModule = TestGraphicsModule();
+    graphicsModule.init();
+
+    auto audioModule = TestAudioModule();
+    audioModule.init();
+
+    auto scene = std::make_unique<SceneGraph>("test", graphicsOpt, graphicsModule.services(), audioModule.services());
+
+    auto aabbMesh = std::make_shared<ModelNode::TriangleMesh>();
+    aabbMesh->mesh = makeGrassMesh();
+    auto aabbNode = std::make_shared<ModelNode>(0, "aabb_node", glm::vec3(0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), true, nullptr);
+    aabbNode->setMesh(aabbMesh);
+
+    auto properties = GrassProperties();
+    properties.density = 1.0f;
+    properties.probabilities = glm::vec4(1.0f, 0.0f, 0.0f, 0.0f);
+    properties.materials.insert(0);
+    auto grass = scene->newGrass(properties, *aabbNode);
+
+    auto camera = scene->newCamera();
+    camera->setLocalTransform(glm::translate(glm::vec3(1.0f, 1.0f, 2.0f)));
+    scene->setActiveCamera(camera.get());
+
+    // when
+    grass->update(0.0f);
+
+    // then
+    EXPECT_EQ(2ll, grass->children().size());
+    for (auto &cluster : grass->children()) {
+        EXPECT_GT(10.0f, cluster->getOrigin().x);
+    }
+
+    // when
+    camera->setLocalTransform(glm::translate(glm::vec3(101.0f, 1.0f, 2.0f)));
+    grass->update(0.0f);
+
+    // then
+    EXPECT_EQ(2ll, grass->children().size());
+    for (auto &cluster : grass->children()) {
+        EXPECT_LT(90.0f, cluster->getOrigin().x);
+    }
+}
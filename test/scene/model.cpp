@@ -95,6 +95,47 @@ TEST(model_scene_node, should_build_from_model) {
     EXPECT_EQ(static_cast<int>(SceneNodeType::Emitter), static_cast<int>(emitterSceneNode->type()));
 }
 
+TEST(model_scene_node, should_propagate_absolute_transforms_to_nodes) {
+    // given
+    auto graphicsOpt = GraphicsOptions();
+
+    auto graphicsModule = TestGraphicsModule();
+    graphicsModule.init();
+
+    auto audioModule = TestAudioModule();
+    audioModule.init();
+
+    auto scene = std::make_unique<SceneGraph>("test", graphicsOpt, graphicsModule.services(), audioModule.services());
+
+    auto rootNode = std::make_shared<ModelNode>(0, "root_node", glm::vec3(0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), true, nullptr);
+    auto childNode = std::make_shared<ModelNode>(2, "child_node", glm::vec3(1.0f, 0.0f, 0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), true, rootNode.get());
+    rootNode->addChild(childNode);
+
+    auto model = Model("some_model", 0, rootNode, std::vector<std::shared_ptr<Animation>>(), nullptr, 1.0f);
+    auto modelSceneNode = std::make_shared<ModelSceneNode>(
+        model,
+        ModelUsage::Creature,
+        *scene,
+        graphicsModule.services(),
+        audioModule.services());
+    modelSceneNode->init();
+
+    // when
+    modelSceneNode->setLocalTransform(glm::translate(glm::vec3(0.0f, 2.0f, 0.0f)));
+
+    // then
+    EXPECT_EQ(nullptr, modelSceneNode->getNodeByNumber(1));
+    auto childSceneNode = modelSceneNode->getNodeByNumber(2);
+    EXPECT_TRUE(static_cast<bool>(childSceneNode));
+    auto childOrigin = childSceneNode->getOrigin();
+    EXPECT_NEAR(1.0f, childOrigin.x, 1e-5);
+    EXPECT_NEAR(2.0f, childOrigin.y, 1e-5);
+    EXPECT_NEAR(0.0f, childOrigin.z, 1e-5);
+    auto childOriginInv = childSceneNode->absoluteTransformInverse()[3];
+    EXPECT_NEAR(-1.0f, childOriginInv.x, 1e-5);
+    EXPECT_NEAR(-2.0f, childOriginInv.y, 1e-5);
+}
+
 TEST(model_scene_node, should_play_single_fire_forget_animation) {
     // given
     auto graphicsOpt = GraphicsOptions();
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include "reone/scene/nodelist.h"
+
+using namespace reone;
+using namespace reone::scene;
+
+TEST(node_list, should_preserve_order_of_nodes_after_removal) {
+    // given
+    int nodes[4] {0, 1, 2, 3};
+    auto list = NodeList<int>();
+    for (auto &node : nodes) {
+        list.add(node);
+    }
+
+    // when
+    bool addedTwice = list.add(nodes[0]);
+    bool removed = list.remove(nodes[1]);
+    bool removedTwice = list.remove(nodes[1]);
+    list.compact();
+    list.add(nodes[1]);
+    list.remove(nodes[2]);
+    list.compact();
+
+    // then
+    EXPECT_FALSE(addedTwice);
+    EXPECT_TRUE(removed);
+    EXPECT_FALSE(removedTwice);
+    EXPECT_EQ(3ll, list.size());
+    EXPECT_TRUE(list.contains(nodes[1]));
+    EXPECT_FALSE(list.contains(nodes[2]));
+    auto values = std::vector<int>();
+    for (auto &node : list) {
+        values.push_back(*node);
+    }
+    EXPECT_EQ((std::vector<int> {0, 3, 1}), values);
+}
@@ -235,6 +235,38 @@ TEST(script_execution, should_run_script_program__action) {
     EXPECT_EQ(1, std::get<0>(invocation[0])[1].intValue);
 }
 
+TEST(script_execution, should_run_script_program__action_reading_arguments_from_stack) {
+    // given
+    auto program = std::make_shared<ScriptProgram>("some_program");
+    program->add(Instruction::newCONSTI(7));
+    program->add(Instruction::newCONSTI(1));
+    program->add(Instruction::newCONSTS("some_tag"));
+    program->add(Instruction::newACTION(0, 2));
+
+    auto routine = std::make_shared<MockRoutine>(
+        "SomeAction",
+        VariableType::Int,
+        Variable::ofInt(42),
+        std::vector<VariableType> {VariableType::String, VariableType::Int});
+    auto routines = MockRoutines();
+    EXPECT_CALL(routines, get(0))
+        .WillOnce(ReturnRef(*routine));
+
+    auto context = std::make_unique<ExecutionContext>();
+    context->routines = &routines;
+
+    auto execution = ScriptExecution(program, std::move(context));
+
+    // when
+    auto result = execution.run();
+
+    // then
+    EXPECT_TRUE(routine->hasStackArguments());
+    EXPECT_EQ(2, execution.getStackSize());
+    EXPECT_EQ(7, execution.getStackVariable(0).intValue);
+    EXPECT_EQ(42, execution.getStackVariable(1).intValue);
+}
+
 TEST(script_execution, should_run_script_program__action_with_vectors) {
     // given
     auto program = std::make_shared<ScriptProgram>("some_program");
@@ -460,3 +492,19 @@ TEST(script_execution, should_run_script_program__structs) {
     // then
     EXPECT_EQ(1, result);
 }
+
+TEST(script_execution, should_run_native_function_instead_of_script_program) {
+    // given
+    auto program = std::make_shared<ScriptProgram>("some_program");
+    program->add(Instruction::newCONSTI(1));
+    program->setNative([](ExecutionContext &ctx) { return 2; });
+
+    auto context = std::make_unique<ExecutionContext>();
+    auto execution = ScriptExecution(program, std::move(context));
+
+    // when
+    auto result = execution.run();
+
+    // then
+    EXPECT_EQ(2, result);
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/script/execution.h"
+#include "reone/script/executioncontext.h"
+#include "reone/script/native.h"
+#include "reone/script/program.h"
+
+using namespace reone;
+using namespace reone::script;
+
+/**
+ * Runs instructions through the interpreter and returns the resulting stack.
+ */
+static std::vector<Variable> interpret(const std::vector<Instruction> &instructions) {
+    auto program = std::make_shared<ScriptProgram>("some_program");
+    for (auto &ins : instructions) {
+        program->add(ins);
+    }
+    auto execution = ScriptExecution(program, std::make_unique<ExecutionContext>());
+    execution.run();
+
+    auto stack = std::vector<Variable>();
+    for (int i = 0; i < execution.getStackSize(); ++i) {
+        stack.push_back(execution.getStackVariable(i));
+    }
+    return stack;
+}
+
+TEST(native_scripts, should_find_script_by_res_ref_and_hash) {
+    // given
+    auto natives = NativeScripts();
+    auto bytes = std::string("some_bytes");
+    auto hash = hashScriptBytes(bytes.data(), bytes.size());
+    natives.add("some_script", hash, [](ExecutionContext &ctx) { return 1; });
+
+    // when
+    auto found = natives.find("some_script", hash);
+    auto notFoundByHash = natives.find("some_script", hash + 1);
+    auto notFoundByResRef = natives.find("other_script", hash);
+
+    // then
+    ASSERT_NE(nullptr, found);
+    EXPECT_EQ(nullptr, notFoundByHash);
+    EXPECT_EQ(nullptr, notFoundByResRef);
+}
+
+TEST(native_scripts, should_divide_floats_like_interpreter) {
+    // given
+    auto instructions = std::vector<Instruction> {
+        Instruction::newCONSTI(1),
+        Instruction::newCONSTF(0.0f),
+        Instruction(InstructionType::DIVIF),
+        Instruction::newCONSTF(4.0f),
+        Instruction::newCONSTF(-2.0f),
+        Instruction(InstructionType::DIVFF),
+        Instruction::newCONSTF(3.0f),
+        Instruction::newCONSTF(2.0f),
+        Instruction(InstructionType::DIVFF)};
+
+    // when
+    auto stack = interpret(instructions);
+
+    // then
+    ASSERT_EQ(3ll, stack.size());
+    EXPECT_EQ(stack[0].floatValue, nativeDivide(1, 0.0f));
+    EXPECT_EQ(stack[1].floatValue, nativeDivide(4.0f, -2.0f));
+    EXPECT_EQ(stack[2].floatValue, nativeDivide(3.0f, 2.0f));
+    EXPECT_EQ(1.5f, stack[2].floatValue);
+}
+
+TEST(native_scripts, should_compare_floats_like_interpreter) {
+    // given
+    auto instructions = std::vector<Instruction> {
+        Instruction::newCONSTF(1.0f),
+        Instruction::newCONSTF(1.000001f),
+        Instruction(InstructionType::EQUALFF),
+        Instruction::newCONSTF(1.0f),
+        Instruction::newCONSTF(1.000001f),
+        Instruction(InstructionType::NEQUALFF),
+        Instruction::newCONSTF(1.0f),
+        Instruction::newCONSTF(1.1f),
+        Instruction(InstructionType::EQUALFF)};
+
+    // when
+    auto stack = interpret(instructions);
+
+    // then
+    ASSERT_EQ(3ll, stack.size());
+    EXPECT_EQ(stack[0].intValue, static_cast<int>(nativeEqual(1.0f, 1.000001f)));
+    EXPECT_EQ(1, stack[0].intValue);
+    EXPECT_EQ(stack[1].intValue, static_cast<int>(1.0f != 1.000001f));
+    EXPECT_EQ(1, stack[1].intValue);
+    EXPECT_EQ(stack[2].intValue, static_cast<int>(nativeEqual(1.0f, 1.1f)));
+    EXPECT_EQ(0, stack[2].intValue);
+}
+
+TEST(native_scripts, should_shift_right_like_interpreter) {
+    // given
+    auto instructions = std::vector<Instruction> {
+        Instruction::newCONSTI(-7),
+        Instruction::newCONSTI(1),
+        Instruction(InstructionType::SHRIGHTII),
+        Instruction::newCONSTI(7),
+        Instruction::newCONSTI(1),
+        Instruction(InstructionType::SHRIGHTII)};
+
+    // when
+    auto stack = interpret(instructions);
+
+    // then
+    ASSERT_EQ(2ll, stack.size());
+    EXPECT_EQ(stack[0].intValue, nativeShiftRight(-7, 1));
+    EXPECT_EQ(-3, stack[0].intValue);
+    EXPECT_EQ(stack[1].intValue, nativeShiftRight(7, 1));
+    EXPECT_EQ(3, stack[1].intValue);
+}
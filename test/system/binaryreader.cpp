@@ -18,6 +18,7 @@
 #include <gtest/gtest.h>
 
 #include "reone/system/binaryreader.h"
+#include "reone/system/exception/endofstream.h"
 #include "reone/system/stream/memoryinput.h"
 #include "reone/system/stringbuilder.h"
 
@@ -150,3 +151,74 @@ TEST(binary_reader, should_read_from_big_endian_stream) {
     EXPECT_EQ(expectedFloat, actualFloat);
     EXPECT_EQ(expectedDouble, actualDouble);
 }
+
+TEST(binary_reader, should_read_arrays_from_little_endian_stream) {
+    // given
+    auto input = StringBuilder()
+                     .append("\x01\x00\x02\x00", 4)
+                     .append("\x03\x00\x00\x00\x04\x00\x00\x00", 8)
+                     .append("\xfe\xff\xff\xff", 4)
+                     .append("\x00\x00\x80\x3f\x00\x00\x00\x40", 8)
+                     .string();
+    auto inputBytes = ByteBuffer(input.begin(), input.end());
+    auto stream = MemoryInputStream(inputBytes);
+    auto reader = BinaryReader(stream, boost::endian::order::little);
+    auto expectedUint16s = std::vector<uint16_t> {1, 2};
+    auto expectedUint32s = std::vector<uint32_t> {3, 4};
+    auto expectedInt32s = std::vector<int32_t> {-2};
+    auto expectedFloats = std::vector<float> {1.0f, 2.0f};
+
+    // when
+    auto actualUint16s = reader.readUint16Array(2);
+    auto actualUint32s = reader.readUint32Array(2);
+    auto actualInt32s = reader.readInt32Array(1);
+    float actualFloats[2];
+    reader.readFloatArray(actualFloats, 2);
+
+    // then
+    EXPECT_EQ(expectedUint16s, actualUint16s);
+    EXPECT_EQ(expectedUint32s, actualUint32s);
+    EXPECT_EQ(expectedInt32s, actualInt32s);
+    EXPECT_EQ(expectedFloats[0], actualFloats[0]);
+    EXPECT_EQ(expectedFloats[1], actualFloats[1]);
+    EXPECT_EQ(24ll, reader.position());
+}
+
+TEST(binary_reader, should_read_arrays_from_big_endian_stream) {
+    // given
+    auto input = StringBuilder()
+                     .append("\x00\x01\x00\x02", 4)
+                     .append("\x00\x00\x00\x03\x00\x00\x00\x04", 8)
+                     .append("\xff\xff\xff\xfe", 4)
+                     .append("\x3f\x80\x00\x00\x40\x00\x00\x00", 8)
+                     .string();
+    auto inputBytes = ByteBuffer(input.begin(), input.end());
+    auto stream = MemoryInputStream(inputBytes);
+    auto reader = BinaryReader(stream, boost::endian::order::big);
+    auto expectedUint16s = std::vector<uint16_t> {1, 2};
+    auto expectedUint32s = std::vector<uint32_t> {3, 4};
+    auto expectedInt32s = std::vector<int32_t> {-2};
+    auto expectedFloats = std::vector<float> {1.0f, 2.0f};
+
+    // when
+    auto actualUint16s = reader.readUint16Array(2);
+    auto actualUint32s = reader.readUint32Array(2);
+    auto actualInt32s = reader.readInt32Array(1);
+    auto actualFloats = reader.readFloatArray(2);
+
+    // then
+    EXPECT_EQ(expectedUint16s, actualUint16s);
+    EXPECT_EQ(expectedUint32s, actualUint32s);
+    EXPECT_EQ(expectedInt32s, actualInt32s);
+    EXPECT_EQ(expectedFloats, actualFloats);
+}
+
+TEST(binary_reader, should_throw_when_reading_array_past_end_of_stream) {
+    // given
+    auto inputBytes = ByteBuffer {'\x01', '\x00', '\x00', '\x00', '\x02', '\x00'};
+    auto stream = MemoryInputStream(inputBytes);
+    auto reader = BinaryReader(stream, boost::endian::order::little);
+
+    // when / then
+    EXPECT_THROW(reader.readUint32Array(2), EndOfStreamException);
+}
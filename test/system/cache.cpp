@@ -87,3 +87,42 @@ TEST(cache, should_clear_cached_items) {
     // then
     EXPECT_TRUE(value && (*value) == 2);
 }
+
+TEST(cache, should_allow_value_factory_to_access_cache_recursively) {
+    // given
+    Cache<int, int> cache;
+
+    // when
+    auto value = cache.getOrAdd(0, [&cache]() {
+        auto dependency = cache.getOrAdd(1, []() { return std::make_shared<int>(1); });
+        return std::make_shared<int>(*dependency + 1);
+    });
+
+    // then
+    EXPECT_TRUE(value && (*value) == 2);
+    auto dependency = cache.getOrAdd(1, []() { return std::make_shared<int>(0); });
+    EXPECT_TRUE(dependency && (*dependency) == 1);
+}
+
+TEST(cache, should_return_same_value_to_concurrent_callers) {
+    // given
+    Cache<int, int> cache;
+    std::atomic_int counter {0};
+    std::vector<std::shared_ptr<int>> values(8);
+
+    // when
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < values.size(); ++i) {
+        threads.emplace_back([&, i]() {
+            values[i] = cache.getOrAdd(0, [&counter]() { return std::make_shared<int>(counter++); });
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    // then
+    for (auto &value : values) {
+        EXPECT_EQ(values[0], value);
+    }
+}
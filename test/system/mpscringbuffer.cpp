@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/system/mpscringbuffer.h"
+
+using namespace reone;
+
+TEST(mpsc_ring_buffer, should_push_and_pop_in_order_until_full) {
+    // given
+    auto buffer = MpscRingBuffer<int>(4);
+
+    // when
+    auto pushed = std::vector<bool>();
+    for (int i = 0; i < 5; ++i) {
+        pushed.push_back(buffer.tryPush(std::move(i)));
+    }
+    auto popped = std::vector<int>();
+    int value;
+    while (buffer.tryPop(value)) {
+        popped.push_back(value);
+    }
+
+    // then
+    EXPECT_EQ((std::vector<bool> {true, true, true, true, false}), pushed);
+    EXPECT_EQ((std::vector<int> {0, 1, 2, 3}), popped);
+    EXPECT_TRUE(buffer.tryPush(4));
+    EXPECT_TRUE(buffer.tryPop(value));
+    EXPECT_EQ(4, value);
+}
+
+TEST(mpsc_ring_buffer, should_deliver_every_value_from_multiple_producers) {
+    // given
+    constexpr int kNumProducers = 4;
+    constexpr int kNumValuesPerProducer = 10000;
+    auto buffer = MpscRingBuffer<int>(64);
+
+    // when
+    auto producers = std::vector<std::thread>();
+    for (int p = 0; p < kNumProducers; ++p) {
+        producers.emplace_back([&buffer, p]() {
+            for (int i = 0; i < kNumValuesPerProducer; ++i) {
+                int value = p * kNumValuesPerProducer + i;
+                while (!buffer.tryPush(std::move(value))) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    auto received = std::vector<int>();
+    auto lastByProducer = std::vector<int>(kNumProducers, -1);
+    bool ordered = true;
+    while (received.size() < kNumProducers * kNumValuesPerProducer) {
+        int value;
+        if (!buffer.tryPop(value)) {
+            std::this_thread::yield();
+            continue;
+        }
+        int producer = value / kNumValuesPerProducer;
+        ordered &= value > lastByProducer[producer];
+        lastByProducer[producer] = value;
+        received.push_back(value);
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+
+    // then
+    std::sort(received.begin(), received.end());
+    auto expected = std::vector<int>(kNumProducers * kNumValuesPerProducer);
+    std::iota(expected.begin(), expected.end(), 0);
+    EXPECT_EQ(expected, received);
+    EXPECT_TRUE(ordered);
+}
+
+TEST(mpsc_ring_buffer, should_throw_when_capacity_is_not_power_of_two) {
+    // expect
+    EXPECT_THROW(MpscRingBuffer<int>(3), std::invalid_argument);
+}
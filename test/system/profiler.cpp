@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/system/profiler.h"
+#include "reone/system/stream/memoryoutput.h"
+
+using namespace reone;
+
+TEST(profile_event_ring, should_keep_newest_events_when_full) {
+    // given
+    auto ring = ProfileEventRing(1, 3);
+    static const char *names[] {"a", "b", "c", "d", "e"};
+
+    // when
+    for (int i = 0; i < 5; ++i) {
+        ring.push(ProfileEvent {names[i], static_cast<uint64_t>(i), static_cast<uint64_t>(i + 1)});
+    }
+    auto events = ring.snapshot();
+
+    // then
+    ASSERT_EQ(3ll, events.size());
+    EXPECT_STREQ("c", events[0].name);
+    EXPECT_STREQ("d", events[1].name);
+    EXPECT_STREQ("e", events[2].name);
+    EXPECT_EQ(4ll, events[2].startNs);
+}
+
+TEST(profiler, should_aggregate_zones_when_enabled) {
+    // given
+    uint64_t startNs = profileTimestamp();
+
+    // when
+    setProfilingEnabled(false);
+    { PROFILE_ZONE("profiler_test_zone"); }
+    setProfilingEnabled(true);
+    for (int i = 0; i < 2; ++i) {
+        PROFILE_ZONE("profiler_test_zone");
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    setProfilingEnabled(false);
+    auto stats = profileZoneStats(startNs, profileTimestamp());
+
+    // then
+    auto zone = std::find_if(stats.begin(), stats.end(), [](auto &s) { return s.name == "profiler_test_zone"; });
+    ASSERT_NE(stats.end(), zone);
+    EXPECT_EQ(2, zone->count);
+    EXPECT_LE(2000000ull, zone->totalNs);
+}
+
+TEST(profiler, should_write_chrome_trace) {
+    // given
+    profileEvent("profiler_test_trace", 1000, 3500);
+    auto bytes = ByteBuffer();
+    auto stream = MemoryOutputStream(bytes);
+
+    // when
+    writeChromeTrace(stream);
+
+    // then
+    auto json = std::string(bytes.begin(), bytes.end());
+    EXPECT_EQ(0, json.find("{\"displayTimeUnit\": \"ms\", \"traceEvents\": ["));
+    auto event = json.find("{\"name\": \"profiler_test_trace\", \"ph\": \"X\", \"pid\": 1, \"tid\": ");
+    ASSERT_NE(std::string::npos, event);
+    EXPECT_NE(std::string::npos, json.find("\"ts\": 1.000, \"dur\": 2.500}", event));
+    EXPECT_NE(std::string::npos, json.find("]}"));
+}
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/system/slotmap.h"
+
+using namespace reone;
+
+TEST(slot_map, should_insert_find_and_erase_values) {
+    // given
+    auto map = SlotMap<std::string>();
+    auto first = map.insert("first");
+    auto second = map.insert("second");
+    auto third = map.insert("third");
+
+    // when
+    bool erased = map.erase(first);
+
+    // then
+    EXPECT_TRUE(erased);
+    EXPECT_EQ(2ll, map.size());
+    EXPECT_EQ(nullptr, map.find(first));
+    ASSERT_NE(nullptr, map.find(second));
+    EXPECT_EQ("second", *map.find(second));
+    ASSERT_NE(nullptr, map.find(third));
+    EXPECT_EQ("third", *map.find(third));
+    auto values = std::vector<std::string>(map.begin(), map.end());
+    EXPECT_EQ((std::vector<std::string> {"third", "second"}), values);
+}
+
+TEST(slot_map, should_detect_stale_handle_when_slot_is_reused) {
+    // given
+    auto map = SlotMap<int>();
+    auto stale = map.insert(1);
+    map.erase(stale);
+
+    // when
+    auto fresh = map.insert(2);
+
+    // then
+    EXPECT_EQ(stale & SlotMap<int>::kIndexMask, fresh & SlotMap<int>::kIndexMask);
+    EXPECT_NE(stale, fresh);
+    EXPECT_FALSE(map.contains(stale));
+    EXPECT_FALSE(map.erase(stale));
+    ASSERT_TRUE(map.contains(fresh));
+    EXPECT_EQ(2, *map.find(fresh));
+}
+
+TEST(slot_map, should_never_produce_reserved_handles) {
+    // given
+    auto map = SlotMap<int>();
+
+    // when
+    auto handle = map.insert(1);
+
+    // then
+    EXPECT_LE(1u << SlotMap<int>::kIndexBits, handle);
+    EXPECT_FALSE(map.contains(0));
+    EXPECT_FALSE(map.contains(1));
+}
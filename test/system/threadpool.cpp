@@ -75,3 +75,37 @@ TEST(thread_pool, should_cancel_enqueued_task) {
     // then
     EXPECT_TRUE(exited);
 }
+
+TEST(thread_pool, should_invoke_function_for_every_index_in_parallel_for) {
+    // given
+    ThreadPool pool(4);
+    pool.init();
+    std::vector<std::atomic_int> invocations(100);
+
+    // when
+    parallelFor(pool, invocations.size(), [&invocations](size_t i) { ++invocations[i]; });
+
+    // then
+    for (auto &count : invocations) {
+        EXPECT_EQ(1, count);
+    }
+}
+
+TEST(thread_pool, should_rethrow_exception_from_parallel_for) {
+    // given
+    ThreadPool pool(2);
+    pool.init();
+    std::atomic_int numInvoked {0};
+
+    // when
+    auto func = [&numInvoked](size_t i) {
+        ++numInvoked;
+        if (i == 3) {
+            throw std::runtime_error("failure");
+        }
+    };
+
+    // then
+    EXPECT_THROW(parallelFor(pool, 10, func), std::runtime_error);
+    EXPECT_EQ(10, numInvoked);
+}
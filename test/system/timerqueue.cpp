@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/system/timerqueue.h"
+
+using namespace reone;
+
+TEST(timer_queue, should_run_due_callbacks_in_order_of_due_time) {
+    // given
+    auto queue = TimerQueue();
+    auto fired = std::vector<int>();
+    queue.schedule(2.0f, [&fired]() { fired.push_back(2); });
+    queue.schedule(1.0f, [&fired]() { fired.push_back(1); });
+    queue.schedule(1.0f, [&fired]() { fired.push_back(3); });
+    queue.schedule(5.0f, [&fired]() { fired.push_back(5); });
+
+    // when
+    queue.update(0.5f);
+    auto firedEarly = fired;
+    queue.update(2.0f);
+
+    // then
+    EXPECT_TRUE(firedEarly.empty());
+    EXPECT_EQ((std::vector<int> {1, 3, 2}), fired);
+    EXPECT_EQ(1, queue.size());
+}
+
+TEST(timer_queue, should_not_run_cancelled_callbacks) {
+    // given
+    auto queue = TimerQueue();
+    int numFired = 0;
+    auto id = queue.schedule(1.0f, [&numFired]() { ++numFired; });
+    queue.schedule(1.0f, [&numFired]() { ++numFired; });
+
+    // when
+    bool cancelled = queue.cancel(id);
+    bool cancelledTwice = queue.cancel(id);
+    queue.update(1.0f);
+
+    // then
+    EXPECT_TRUE(cancelled);
+    EXPECT_FALSE(cancelledTwice);
+    EXPECT_EQ(1, numFired);
+    EXPECT_EQ(0, queue.size());
+}
+
+TEST(timer_queue, should_defer_timers_scheduled_by_callbacks_until_next_update) {
+    // given
+    auto queue = TimerQueue();
+    int numFired = 0;
+    std::function<void()> callback;
+    callback = [&queue, &numFired, &callback]() {
+        ++numFired;
+        queue.schedule(0.0f, callback);
+    };
+    queue.schedule(0.0f, callback);
+
+    // when
+    queue.update(0.0f);
+    queue.update(0.0f);
+
+    // then
+    EXPECT_EQ(2, numFired);
+    EXPECT_EQ(1, queue.size());
+}
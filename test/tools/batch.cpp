@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/tools/batch.h"
+
+using namespace reone;
+
+TEST(batch_executor, should_process_all_paths_and_collect_errors_in_input_order) {
+    // given
+    auto input = std::vector<std::filesystem::path>();
+    for (int i = 0; i < 64; ++i) {
+        input.push_back(std::to_string(i));
+    }
+    auto executor = BatchExecutor(4);
+    std::atomic_int numInvocations {0};
+    std::vector<size_t> progressValues;
+
+    // when
+    auto errors = executor.execute(
+        input,
+        [&numInvocations](auto &path) {
+            ++numInvocations;
+            if (std::stoi(path.string()) % 10 == 0) {
+                throw std::runtime_error("Failed " + path.string());
+            }
+        },
+        [&progressValues](auto numProcessed, auto numTotal) {
+            progressValues.push_back(numProcessed);
+        });
+
+    // then
+    EXPECT_EQ(64, numInvocations);
+    ASSERT_EQ(7ll, errors.size());
+    for (size_t i = 0; i < errors.size(); ++i) {
+        EXPECT_EQ(std::to_string(10 * i), errors[i].path.string());
+        EXPECT_EQ("Failed " + std::to_string(10 * i), errors[i].message);
+    }
+    ASSERT_FALSE(progressValues.empty());
+    EXPECT_TRUE(std::is_sorted(progressValues.begin(), progressValues.end()));
+    EXPECT_EQ(64ll, progressValues.back());
+}
+
+TEST(batch_executor, should_process_paths_sequentially_with_single_worker) {
+    // given
+    auto input = std::vector<std::filesystem::path> {"a", "b", "c"};
+    auto executor = BatchExecutor(1);
+    std::vector<std::string> processed;
+
+    // when
+    auto errors = executor.execute(input, [&processed](auto &path) {
+        processed.push_back(path.string());
+    });
+
+    // then
+    EXPECT_TRUE(errors.empty());
+    EXPECT_EQ((std::vector<std::string> {"a", "b", "c"}), processed);
+}
+
+TEST(batch_executor, should_collect_errors_not_derived_from_std_exception) {
+    // given
+    auto input = std::vector<std::filesystem::path> {"a", "b", "c", "d"};
+    auto executor = BatchExecutor(2);
+
+    // when
+    auto errors = executor.execute(input, [](auto &path) {
+        if (path == "b") {
+            throw 42;
+        }
+    });
+
+    // then
+    ASSERT_EQ(1ll, errors.size());
+    EXPECT_EQ("b", errors[0].path.string());
+    EXPECT_EQ("Unknown error", errors[0].message);
+}
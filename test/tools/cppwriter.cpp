@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/game/script/routines.h"
+#include "reone/system/stream/memoryoutput.h"
+#include "reone/system/stringbuilder.h"
+#include "reone/tools/script/exprtree.h"
+#include "reone/tools/script/exprtreeoptimizer.h"
+#include "reone/tools/script/format/cppwriter.h"
+
+using namespace reone;
+using namespace reone::game;
+using namespace reone::script;
+
+static std::string lowerToCpp(ScriptProgram &program) {
+    auto routines = Routines(GameID::KotOR, nullptr, nullptr);
+    routines.init();
+
+    auto optimizer = ExpressionTreeOptimizer(false);
+    auto tree = ExpressionTree::fromProgram(program, routines, optimizer);
+
+    auto bytes = ByteBuffer();
+    auto stream = MemoryOutputStream(bytes);
+    auto writer = CppWriter(tree, routines);
+    writer.save("some_script", stream);
+
+    return std::string(bytes.begin(), bytes.end());
+}
+
+/**
+ * Wraps instructions leaving a single integer on the stack into a
+ * StartingConditional returning that integer.
+ */
+static void addStartingConditional(ScriptProgram &program, const std::vector<Instruction> &body) {
+    program.add(Instruction(InstructionType::RSADDI));
+    program.add(Instruction::newJSR(8));
+    program.add(Instruction(InstructionType::RETN));
+    for (auto &ins : body) {
+        program.add(ins);
+    }
+    program.add(Instruction::newCPDOWNSP(-8, 4));
+    program.add(Instruction::newMOVSP(-4));
+    program.add(Instruction(InstructionType::RETN));
+}
+
+static bool contains(const std::string &code, const std::string &line) {
+    return code.find(line) != std::string::npos;
+}
+
+TEST(cpp_writer, should_write_starting_conditional) {
+    // given
+
+    auto program = ScriptProgram("");
+    program.add(Instruction(InstructionType::RSADDI));
+    program.add(Instruction::newJSR(8));
+    program.add(Instruction(InstructionType::RETN));
+    program.add(Instruction::newCONSTI(1));
+    program.add(Instruction::newCPDOWNSP(-8, 4));
+    program.add(Instruction::newMOVSP(-4));
+    program.add(Instruction(InstructionType::RETN));
+
+    auto routines = Routines(GameID::KotOR, nullptr, nullptr);
+    routines.init();
+
+    auto optimizer = ExpressionTreeOptimizer(false);
+    auto tree = ExpressionTree::fromProgram(program, routines, optimizer);
+
+    auto bytes = ByteBuffer();
+    auto stream = MemoryOutputStream(bytes);
+    auto writer = CppWriter(tree, routines);
+
+    // when
+
+    writer.save("some_script", stream);
+
+    // then
+
+    auto code = std::string(bytes.begin(), bytes.end());
+    auto expectedCode = StringBuilder()
+                            .append("class some_script {\n")
+                            .append("public:\n")
+                            .append("    some_script(ExecutionContext &ctx) :\n")
+                            .append("        _ctx(ctx) {\n")
+                            .append("    }\n")
+                            .append("\n")
+                            .append("    static int run(ExecutionContext &ctx) {\n")
+                            .append("        auto script = some_script(ctx);\n")
+                            .append("        return script.StartingConditional();\n")
+                            .append("    }\n")
+                            .append("\n")
+                            .append("    int32_t StartingConditional() {\n")
+                            .append("        int32_t ret_fffffffc {0};\n")
+                            .append("        int32_t var_00000017 {0};\n")
+                            .append("        ret_fffffffc = 0;\n")
+                            .append("        var_00000017 = 1;\n")
+                            .append("        ret_fffffffc = var_00000017;\n")
+                            .append("        return ret_fffffffc;\n")
+                            .append("    }\n")
+                            .append("\n")
+                            .append("private:\n")
+                            .append("    ExecutionContext &_ctx;\n")
+                            .append("};\n")
+                            .string();
+    EXPECT_EQ(expectedCode, code);
+}
+
+TEST(cpp_writer, should_lower_float_division_and_equality_to_native_helpers) {
+    // given
+    auto program = ScriptProgram("");
+    addStartingConditional(program, {Instruction::newCONSTI(1),
+                                     Instruction::newCONSTF(0.0f),
+                                     Instruction(InstructionType::DIVIF),
+                                     Instruction::newCONSTF(100000.0f),
+                                     Instruction(InstructionType::EQUALFF)});
+
+    // when
+    auto code = lowerToCpp(program);
+
+    // then
+    EXPECT_TRUE(contains(code, "        var_00000023 = nativeDivide(var_00000017, var_0000001d);\n")) << code;
+    EXPECT_TRUE(contains(code, "        var_0000002b = nativeEqual(var_00000023, var_00000025);\n")) << code;
+}
+
+TEST(cpp_writer, should_lower_float_inequality_to_exact_comparison) {
+    // given
+    auto program = ScriptProgram("");
+    addStartingConditional(program, {Instruction::newCONSTF(1.0f),
+                                     Instruction::newCONSTF(1.000001f),
+                                     Instruction(InstructionType::NEQUALFF)});
+
+    // when
+    auto code = lowerToCpp(program);
+
+    // then
+    EXPECT_TRUE(contains(code, "        var_00000023 = var_00000017 != var_0000001d;\n")) << code;
+    EXPECT_FALSE(contains(code, "nativeEqual")) << code;
+}
+
+TEST(cpp_writer, should_lower_shifts) {
+    // given
+    auto program = ScriptProgram("");
+    addStartingConditional(program, {Instruction::newCONSTI(-7),
+                                     Instruction::newCONSTI(1),
+                                     Instruction(InstructionType::SHRIGHTII),
+                                     Instruction::newCONSTI(1),
+                                     Instruction(InstructionType::SHLEFTII),
+                                     Instruction::newCONSTI(2),
+                                     Instruction(InstructionType::USHRIGHTII)});
+
+    // when
+    auto code = lowerToCpp(program);
+
+    // then
+    EXPECT_TRUE(contains(code, "        var_00000023 = nativeShiftRight(var_00000017, var_0000001d);\n")) << code;
+    EXPECT_TRUE(contains(code, "        var_0000002b = var_00000023 << var_00000025;\n")) << code;
+    EXPECT_TRUE(contains(code, "        var_00000033 = static_cast<int32_t>(static_cast<uint32_t>(var_0000002b) >> var_0000002d);\n")) << code;
+}
+
+TEST(cpp_writer, should_lower_action_call) {
+    // given
+    auto program = ScriptProgram("");
+    addStartingConditional(program, {Instruction::newCONSTI(10),
+                                     Instruction::newACTION(0, 1)}); // Random
+
+    // when
+    auto code = lowerToCpp(program);
+
+    // then
+    EXPECT_TRUE(contains(code, "        var_0000001d = callRoutine(_ctx, 0, {Variable::ofInt(var_00000017)}).intValue;\n")) << code;
+}
+
+TEST(cpp_writer, should_lower_globals_to_initialized_members) {
+    // given
+    auto program = ScriptProgram("");
+    program.add(Instruction::newJSR(8));
+    program.add(Instruction(InstructionType::RETN));
+    program.add(Instruction(InstructionType::RSADDI));
+    program.add(Instruction::newCONSTI(1));
+    program.add(Instruction::newCPDOWNSP(-8, 4));
+    program.add(Instruction::newMOVSP(-4));
+    program.add(Instruction(InstructionType::SAVEBP));
+    program.add(Instruction::newJSR(10));
+    program.add(Instruction(InstructionType::RESTOREBP));
+    program.add(Instruction(InstructionType::RETN));
+    program.add(Instruction::newINCIBP(-4));
+    program.add(Instruction(InstructionType::RETN));
+
+    // when
+    auto code = lowerToCpp(program);
+
+    // then
+    EXPECT_TRUE(contains(code, "    void main() {\n        glob_00000015++;\n    }\n")) << code;
+    EXPECT_TRUE(contains(code, "    ExecutionContext &_ctx;\n    int32_t glob_00000015 {1};\n")) << code;
+}
+
+TEST(cpp_writer, should_lower_loop_to_goto) {
+    // given
+    auto program = ScriptProgram("");
+    program.add(Instruction::newJSR(8));
+    program.add(Instruction(InstructionType::RETN));
+    program.add(Instruction(InstructionType::RSADDI));
+    program.add(Instruction::newCONSTI(0));
+    program.add(Instruction::newCPDOWNSP(-8, 4));
+    program.add(Instruction::newMOVSP(-4));
+    program.add(Instruction::newINCISP(-4));
+    program.add(Instruction::newCONSTI(10));
+    program.add(Instruction::newCPTOPSP(-8, 4));
+    program.add(Instruction(InstructionType::LTII));
+    program.add(Instruction::newJNZ(-22));
+    program.add(Instruction::newMOVSP(-4));
+    program.add(Instruction(InstructionType::RETN));
+
+    // when
+    auto code = lowerToCpp(program);
+
+    // then
+    auto expectedBody = StringBuilder()
+                            .append("        loc_0000002b:;\n")
+                            .append("        var_00000015++;\n")
+                            .append("        var_00000031 = 10;\n")
+                            .append("        var_00000037 = var_00000015;\n")
+                            .append("        var_0000003f = var_00000031 < var_00000037;\n")
+                            .append("        if (var_0000003f != 0) {\n")
+                            .append("            goto loc_0000002b;\n")
+                            .append("        }\n")
+                            .string();
+    EXPECT_TRUE(contains(code, expectedBody)) << code;
+}